@@ -11,11 +11,18 @@
 #define EFSBADCRC	EBADMSG		/* Bad CRC detected */
 #define EFSCORRUPTED	EUCLEAN		/* Filesystem is corrupted */
 
+struct file;
+struct inode;
+
 /*
  * Inode and file operations
  */
 
+/* export.c */
+extern const struct export_operations apfs_export_ops;
+
 /* file.c */
+extern int apfs_file_open(struct inode *inode, struct file *filp);
 extern const struct file_operations apfs_file_operations;
 extern const struct inode_operations apfs_file_inode_operations;
 
@@ -23,6 +30,8 @@ extern const struct inode_operations apfs_file_inode_operations;
 extern const struct inode_operations apfs_dir_inode_operations;
 extern const struct inode_operations apfs_special_inode_operations;
 extern const struct dentry_operations apfs_dentry_operations;
+extern const struct dentry_operations apfs_firmlink_dentry_operations;
+extern const struct dentry_operations apfs_snapshot_dentry_operations;
 
 /* symlink.c */
 extern const struct inode_operations apfs_symlink_inode_operations;
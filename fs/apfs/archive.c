@@ -0,0 +1,589 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/archive.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ *
+ * Export of a whole directory tree as a cpio archive, in the "newc" format
+ * that cpio and bsdtar both extract.  The tree is scanned breadth first, so
+ * the directories go first, with each parent before its children; the other
+ * files follow in the order of the first physical block of their data, and
+ * their data gets read ahead a few files at a time, so that the export makes
+ * a single sweep over the disk with plenty of reads in flight.
+ */
+
+#include <linux/fadvise.h>
+#include <linux/file.h>
+#include <linux/fs.h>
+#include <linux/kdev_t.h>
+#include <linux/mm.h>
+#include <linux/mount.h>
+#include <linux/sched/signal.h>
+#include <linux/slab.h>
+#include <linux/sort.h>
+#include "apfs.h"
+#include "archive.h"
+#include "btree.h"
+#include "dir.h"
+#include "extents.h"
+#include "inode.h"
+#include "ioctl.h"
+#include "key.h"
+#include "message.h"
+#include "super.h"
+#include "xattr.h"
+
+/* No parent, for the entry of the directory archived */
+#define APFS_ARCHIVE_ROOT	U32_MAX
+
+/* Size of the ascii header of each entry of a newc archive */
+#define APFS_CPIO_HDR_SIZE	110
+
+/*
+ * File of the tree being archived
+ */
+struct apfs_archive_ent {
+	u64 cnid;			/* Inode number */
+	u64 bno;			/* First block of the data, or 0 */
+	u64 size;			/* Size of the file */
+	u32 parent;			/* Index of the parent entry */
+	u32 name_off;			/* Offset of the name in the names */
+	u16 name_len;			/* Length of the name, without null */
+	u8 type;			/* Type of the file, as for readdir */
+};
+
+/*
+ * Position of a file in the physical order of the export
+ */
+struct apfs_archive_order {
+	u64 bno;			/* First block of the data, or 0 */
+	u32 idx;			/* Index of the entry */
+};
+
+/*
+ * State of an export
+ */
+struct apfs_archive {
+	struct super_block *sb;
+	struct vfsmount *mnt;		/* Mount of the directory archived */
+	struct file *out;		/* Destination of the archive */
+	loff_t pos;			/* Position in @out */
+
+	struct apfs_archive_ent *ents;	/* Files of the tree, breadth first */
+	u32 nr;				/* Number of entries */
+	u32 alloc;			/* Size of the array of entries */
+	char *names;			/* Names, not null-terminated */
+	size_t names_len;		/* Bytes in use in @names */
+	size_t names_size;		/* Size of @names */
+
+	char *buf;			/* Buffer for the file data */
+	char *path;			/* Buffer of PATH_MAX bytes for paths */
+	u32 seq;			/* Inode numbers used in the archive */
+	u64 entries;			/* Entries written */
+	u64 bytes;			/* Bytes written */
+};
+
+/**
+ * apfs_archive_add - Add a file to the list of entries of an export
+ * @ar:		the export
+ * @cnid:	inode number of the file
+ * @parent:	index of the parent entry
+ * @name:	name of the file, not null-terminated
+ * @len:	length of @name
+ * @type:	type of the file
+ *
+ * Returns 0 on success, or -ENOMEM in case of failure.
+ */
+static int apfs_archive_add(struct apfs_archive *ar, u64 cnid, u32 parent,
+			    const char *name, int len, u8 type)
+{
+	struct apfs_archive_ent *ent;
+
+	if (ar->nr == ar->alloc) {
+		u32 alloc = ar->alloc ? 2 * ar->alloc : 256;
+		struct apfs_archive_ent *ents;
+
+		if (alloc <= ar->alloc)
+			return -ENOMEM;
+		ents = kvmalloc_array(alloc, sizeof(*ents), GFP_KERNEL);
+		if (!ents)
+			return -ENOMEM;
+		if (ar->nr)
+			memcpy(ents, ar->ents, ar->nr * sizeof(*ents));
+		kvfree(ar->ents);
+		ar->ents = ents;
+		ar->alloc = alloc;
+	}
+	if (ar->names_len + len > ar->names_size) {
+		size_t size = max(2 * ar->names_size, (size_t)PAGE_SIZE);
+		char *names;
+
+		while (size < ar->names_len + len)
+			size *= 2;
+		names = kvmalloc(size, GFP_KERNEL);
+		if (!names)
+			return -ENOMEM;
+		memcpy(names, ar->names, ar->names_len);
+		kvfree(ar->names);
+		ar->names = names;
+		ar->names_size = size;
+	}
+
+	ent = &ar->ents[ar->nr++];
+	ent->cnid = cnid;
+	ent->bno = 0;
+	ent->size = 0;
+	ent->parent = parent;
+	ent->name_off = ar->names_len;
+	ent->name_len = len;
+	ent->type = type;
+	memcpy(ar->names + ar->names_len, name, len);
+	ar->names_len += len;
+	return 0;
+}
+
+/**
+ * apfs_archive_locate - Find the size and first data block of a regular file
+ * @ar:		the export
+ * @ent:	entry of the file
+ *
+ * Compressed files keep their data elsewhere, so they get no block.  Returns
+ * 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_archive_locate(struct apfs_archive *ar,
+			       struct apfs_archive_ent *ent)
+{
+	struct apfs_file_extent ext;
+	struct inode *inode;
+
+	inode = apfs_iget(ar->sb, ent->cnid);
+	if (IS_ERR(inode))
+		return PTR_ERR(inode);
+	ent->size = inode->i_size;
+	/* The order is only a hint, so files without a first extent go first */
+	if (ent->size && !apfs_inode_is_compressed(inode) &&
+	    !apfs_extent_read(inode, 0 /* iblock */, &ext, false /* nowait */))
+		ent->bno = ext.phys_block_num;
+	iput(inode);
+	return 0;
+}
+
+/**
+ * apfs_archive_scan - List all the files in the tree of an export
+ * @ar:		the export
+ * @root:	inode number of the directory archived
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_archive_scan(struct apfs_archive *ar, u64 root)
+{
+	struct super_block *sb = ar->sb;
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	u32 i;
+	int err;
+
+	err = apfs_archive_add(ar, root, APFS_ARCHIVE_ROOT, ".", 1, DT_DIR);
+	for (i = 0; !err && i < ar->nr; i++) {
+		struct apfs_key key;
+		struct apfs_query query;
+		u64 cnid = ar->ents[i].cnid;
+
+		if (ar->ents[i].type == DT_REG) {
+			err = apfs_archive_locate(ar, &ar->ents[i]);
+			continue;
+		}
+		if (ar->ents[i].type != DT_DIR)
+			continue;
+
+		apfs_init_drec_hashed_key(sb, cnid, NULL /* name */, &key);
+		apfs_btree_iter_init(&query, sbi->s_cat_root, &key,
+				     APFS_QUERY_CAT | APFS_QUERY_MULTIPLE);
+		for (err = apfs_btree_iter_seek(sb, &query); !err;
+		     err = apfs_btree_iter_next(sb, &query)) {
+			struct apfs_drec drec;
+
+			err = apfs_drec_from_query(&query, &drec);
+			if (err) {
+				apfs_alert(sb, "bad dentry record in directory 0x%llx",
+					   cnid);
+				break;
+			}
+			err = apfs_archive_add(ar, drec.ino, i, drec.name,
+					       drec.name_len, drec.type);
+			if (err)
+				break;
+
+			if (fatal_signal_pending(current)) {
+				err = -EINTR;
+				break;
+			}
+			cond_resched();
+		}
+		apfs_free_query(sb, &query);
+		if (err == -ENODATA)
+			err = 0;
+	}
+	return err;
+}
+
+/**
+ * apfs_archive_path - Put together the path of an entry in the archive
+ * @ar:		the export
+ * @idx:	index of the entry
+ *
+ * The path is relative to the directory archived, which is itself ".".
+ * Returns a pointer to the null-terminated path, inside @ar->path, or an
+ * error pointer in case of failure.
+ */
+static char *apfs_archive_path(struct apfs_archive *ar, u32 idx)
+{
+	char *p = ar->path + PATH_MAX - 1;
+
+	*p = 0;
+	if (ar->ents[idx].parent == APFS_ARCHIVE_ROOT)
+		return strcpy(ar->path, ".");
+
+	while (ar->ents[idx].parent != APFS_ARCHIVE_ROOT) {
+		struct apfs_archive_ent *ent = &ar->ents[idx];
+
+		if (p - ar->path < ent->name_len + 1)
+			return ERR_PTR(-ENAMETOOLONG);
+		if (*p)
+			*--p = '/';
+		p -= ent->name_len;
+		memcpy(p, ar->names + ent->name_off, ent->name_len);
+		idx = ent->parent;
+	}
+	return p;
+}
+
+/**
+ * apfs_archive_write - Write to the destination of an export
+ * @ar:		the export
+ * @data:	bytes to write, or NULL for zeroes
+ * @len:	number of bytes, no more than APFS_ARCHIVE_BUF_SIZE for zeroes
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_archive_write(struct apfs_archive *ar, const void *data,
+			      size_t len)
+{
+	static const char zeroes[4];
+	ssize_t ret;
+
+	if (!data)
+		data = zeroes;
+	while (len) {
+		ret = kernel_write(ar->out, data, len, &ar->pos);
+		if (ret < 0)
+			return ret;
+		if (ret == 0)
+			return -EIO;
+		data += ret;
+		len -= ret;
+		ar->bytes += ret;
+	}
+	return 0;
+}
+
+/**
+ * apfs_archive_pad - Pad the archive to a multiple of four bytes
+ * @ar:		the export
+ */
+static int apfs_archive_pad(struct apfs_archive *ar)
+{
+	return apfs_archive_write(ar, NULL, -ar->bytes & 3);
+}
+
+/**
+ * apfs_archive_header - Write the header and the path of an archive entry
+ * @ar:		the export
+ * @inode:	the file, or NULL for the trailer
+ * @path:	path of the file in the archive
+ * @size:	bytes of data that follow
+ *
+ * Every entry gets its own inode number and a single link, so hard links are
+ * extracted as copies.  Returns 0 on success, or a negative error code in
+ * case of failure.
+ */
+static int apfs_archive_header(struct apfs_archive *ar, struct inode *inode,
+			       const char *path, u32 size)
+{
+	char hdr[APFS_CPIO_HDR_SIZE + 1];
+	u32 mode = 0, uid = 0, gid = 0, mtime = 0, rmaj = 0, rmin = 0;
+	u32 namesize = strlen(path) + 1;
+	int err;
+
+	if (inode) {
+		mode = inode->i_mode;
+		uid = from_kuid_munged(current_user_ns(), inode->i_uid);
+		gid = from_kgid_munged(current_user_ns(), inode->i_gid);
+		mtime = inode->i_mtime.tv_sec;
+		rmaj = MAJOR(inode->i_rdev);
+		rmin = MINOR(inode->i_rdev);
+	}
+	snprintf(hdr, sizeof(hdr),
+		 "070701%08X%08X%08X%08X%08X%08X%08X%08X%08X%08X%08X%08X%08X",
+		 inode ? ++ar->seq : 0, mode, uid, gid, 1 /* nlink */, mtime,
+		 size, 0 /* devmajor */, 0 /* devminor */, rmaj, rmin,
+		 namesize, 0 /* check */);
+
+	err = apfs_archive_write(ar, hdr, APFS_CPIO_HDR_SIZE);
+	if (!err)
+		err = apfs_archive_write(ar, path, namesize);
+	if (!err)
+		err = apfs_archive_pad(ar);
+	if (!err)
+		ar->entries++;
+	return err;
+}
+
+/**
+ * apfs_archive_open - Open a file of the tree for reading
+ * @ar:		the export
+ * @inode:	the file
+ *
+ * Returns the new file, or an error pointer in case of failure.
+ */
+static struct file *apfs_archive_open(struct apfs_archive *ar,
+				      struct inode *inode)
+{
+	struct path path;
+	struct file *file;
+
+	path.mnt = ar->mnt;
+	path.dentry = d_obtain_alias(igrab(inode));
+	if (IS_ERR(path.dentry))
+		return ERR_CAST(path.dentry);
+	file = dentry_open(&path, O_RDONLY | O_LARGEFILE | O_NOATIME,
+			   current_cred());
+	dput(path.dentry);
+	return file;
+}
+
+/**
+ * apfs_archive_readahead - Start the reads of the data of a regular file
+ * @ar:		the export
+ * @ent:	entry of the file
+ *
+ * The advice maps all the extents of the file and reads them in physical
+ * order.  It's only a hint, so any errors are ignored.
+ */
+static void apfs_archive_readahead(struct apfs_archive *ar,
+				   struct apfs_archive_ent *ent)
+{
+	struct inode *inode;
+	struct file *file;
+
+	inode = apfs_iget(ar->sb, ent->cnid);
+	if (IS_ERR(inode))
+		return;
+	file = apfs_archive_open(ar, inode);
+	iput(inode);
+	if (IS_ERR(file))
+		return;
+	vfs_fadvise(file, 0, 0 /* len */, POSIX_FADV_WILLNEED);
+	fput(file);
+}
+
+/**
+ * apfs_archive_data - Copy the data of a regular file to the archive
+ * @ar:		the export
+ * @inode:	the file
+ *
+ * The file is read through the page cache, so its data gets decompressed and
+ * decrypted as needed.  Returns 0 on success, or a negative error code in
+ * case of failure.
+ */
+static int apfs_archive_data(struct apfs_archive *ar, struct inode *inode)
+{
+	struct file *file;
+	loff_t pos = 0, size = inode->i_size;
+	ssize_t ret;
+	int err = 0;
+
+	file = apfs_archive_open(ar, inode);
+	if (IS_ERR(file))
+		return PTR_ERR(file);
+	while (pos < size) {
+		size_t len = min_t(loff_t, size - pos, APFS_ARCHIVE_BUF_SIZE);
+
+		ret = kernel_read(file, ar->buf, len, &pos);
+		if (ret < 0) {
+			err = ret;
+			break;
+		}
+		if (ret == 0) { /* The size in the header must be right */
+			err = -EIO;
+			break;
+		}
+		err = apfs_archive_write(ar, ar->buf, ret);
+		if (err)
+			break;
+		if (fatal_signal_pending(current)) {
+			err = -EINTR;
+			break;
+		}
+	}
+	fput(file);
+	return err;
+}
+
+/**
+ * apfs_archive_entry - Write the entry of a file to the archive
+ * @ar:		the export
+ * @idx:	index of the entry
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_archive_entry(struct apfs_archive *ar, u32 idx)
+{
+	struct inode *inode;
+	char *path, *target = NULL;
+	u32 size = 0;
+	int err;
+
+	path = apfs_archive_path(ar, idx);
+	if (IS_ERR(path))
+		return PTR_ERR(path);
+	inode = apfs_iget(ar->sb, ar->ents[idx].cnid);
+	if (IS_ERR(inode))
+		return PTR_ERR(inode);
+
+	if (S_ISREG(inode->i_mode)) {
+		/* The newc format has no room for bigger sizes */
+		if (inode->i_size > U32_MAX) {
+			err = -EFBIG;
+			goto out;
+		}
+		size = inode->i_size;
+	} else if (S_ISLNK(inode->i_mode)) {
+		err = apfs_xattr_get_alloc(inode, APFS_XATTR_NAME_SYMLINK,
+					   PATH_MAX, (void **)&target);
+		if (err < 0)
+			goto out;
+		/* The archive has the target without the null termination */
+		size = strnlen(target, err);
+	}
+
+	err = apfs_archive_header(ar, inode, path, size);
+	if (err)
+		goto out;
+	if (S_ISREG(inode->i_mode))
+		err = apfs_archive_data(ar, inode);
+	else if (target)
+		err = apfs_archive_write(ar, target, size);
+	if (!err)
+		err = apfs_archive_pad(ar);
+out:
+	kfree(target);
+	iput(inode);
+	return err;
+}
+
+static int apfs_archive_order_cmp(const void *a, const void *b)
+{
+	const struct apfs_archive_order *order_a = a, *order_b = b;
+
+	if (order_a->bno != order_b->bno)
+		return order_a->bno < order_b->bno ? -1 : 1;
+	if (order_a->idx != order_b->idx)
+		return order_a->idx < order_b->idx ? -1 : 1;
+	return 0;
+}
+
+/**
+ * apfs_archive_files - Write the entries of all the files but directories
+ * @ar:		the export
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_archive_files(struct apfs_archive *ar)
+{
+	struct apfs_archive_order *order;
+	u64 ahead = 0;
+	u32 i, nr = 0, next = 0;
+	int err = 0;
+
+	order = kvmalloc_array(ar->nr, sizeof(*order), GFP_KERNEL);
+	if (!order)
+		return -ENOMEM;
+	for (i = 0; i < ar->nr; i++) {
+		if (ar->ents[i].type == DT_DIR)
+			continue;
+		order[nr].bno = ar->ents[i].bno;
+		order[nr++].idx = i;
+	}
+	sort(order, nr, sizeof(*order), apfs_archive_order_cmp, NULL);
+
+	for (i = 0; !err && i < nr; i++) {
+		struct apfs_archive_ent *ent = &ar->ents[order[i].idx];
+
+		/* Keep the next few files in flight while this one is copied */
+		while (next < nr &&
+		       (next <= i || ahead < APFS_ARCHIVE_RA_BYTES)) {
+			struct apfs_archive_ent *ra;
+
+			ra = &ar->ents[order[next++].idx];
+			if (ra->type != DT_REG || !ra->size)
+				continue;
+			apfs_archive_readahead(ar, ra);
+			ahead += ra->size;
+		}
+
+		err = apfs_archive_entry(ar, order[i].idx);
+		if (ent->type == DT_REG)
+			ahead -= min(ahead, ent->size);
+		cond_resched();
+	}
+	kvfree(order);
+	return err;
+}
+
+/**
+ * apfs_archive - Write a directory tree to a file, as a cpio archive
+ * @dir:	the directory, open
+ * @out:	the destination, open for writing
+ * @req:	the request, with its counters updated on return
+ *
+ * Returns 0 on success, or a negative error code in case of failure; even
+ * then, the counters tell how much got written.
+ */
+int apfs_archive(struct file *dir, struct file *out,
+		 struct apfs_archive_req *req)
+{
+	struct apfs_archive ar = {
+		.sb = file_inode(dir)->i_sb,
+		.mnt = dir->f_path.mnt,
+		.out = out,
+		.pos = out->f_pos,
+	};
+	u32 i;
+	int err;
+
+	ar.buf = kvmalloc(APFS_ARCHIVE_BUF_SIZE, GFP_KERNEL);
+	ar.path = kmalloc(PATH_MAX, GFP_KERNEL);
+	if (!ar.buf || !ar.path) {
+		err = -ENOMEM;
+		goto out;
+	}
+
+	err = apfs_archive_scan(&ar, apfs_ino(file_inode(dir)));
+	for (i = 0; !err && i < ar.nr; i++) {
+		if (ar.ents[i].type == DT_DIR)
+			err = apfs_archive_entry(&ar, i);
+	}
+	if (!err)
+		err = apfs_archive_files(&ar);
+	if (!err)
+		err = apfs_archive_header(&ar, NULL, "TRAILER!!!", 0);
+out:
+	out->f_pos = ar.pos;
+	req->ar_entries = ar.entries;
+	req->ar_bytes = ar.bytes;
+	kvfree(ar.ents);
+	kvfree(ar.names);
+	kfree(ar.path);
+	kvfree(ar.buf);
+	return err;
+}
@@ -0,0 +1,26 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/archive.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_ARCHIVE_H
+#define _APFS_ARCHIVE_H
+
+#include <linux/sizes.h>
+#include <linux/types.h>
+
+struct apfs_archive_req;
+struct file;
+
+/* Size of the buffer for the copies of the file data */
+#define APFS_ARCHIVE_BUF_SIZE	SZ_1M
+
+/* Bytes of file data read ahead of the copy */
+#define APFS_ARCHIVE_RA_BYTES	SZ_64M
+
+extern int apfs_archive(struct file *dir, struct file *out,
+			struct apfs_archive_req *req);
+
+#endif	/* _APFS_ARCHIVE_H */
@@ -0,0 +1,452 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/bench.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ *
+ * Microbenchmarks for the filename code and for the searches inside nodes,
+ * run when the module is loaded.
+ */
+
+#include <linux/fs.h>
+#include <linux/ktime.h>
+#include <linux/math64.h>
+#include <linux/sched.h>
+#include <linux/slab.h>
+#include <linux/string.h>
+#include <linux/timex.h>
+#include "apfs.h"
+#include "bench.h"
+#include "inode.h"
+#include "key.h"
+#include "node.h"
+#include "super.h"
+#include "unicode.h"
+
+/* Variants of each corpus name, and passes over the whole set of names */
+#define APFS_BENCH_VARIANTS	64
+#define APFS_BENCH_PASSES	100
+
+/*
+ * Set of filenames in a single script
+ */
+struct apfs_bench_corpus {
+	const char *name;
+	const char * const *stems;
+	unsigned int nr_stems;
+};
+
+static const char * const apfs_bench_ascii[] = {
+	"Documents", "IMG_0001.JPG", "README.md", "Makefile",
+	"project-final-v2 (copy).docx", "libapfs.so.1.0.0", "Desktop",
+	"A rather long filename for a downloaded report.pdf",
+};
+
+/* Both precomposed and decomposed forms, as created by different apps */
+static const char * const apfs_bench_latin[] = {
+	"Caf\xc3\xa9", "Cafe\xcc\x81", "D\xc3\xa9j\xc3\xa0 vu.txt",
+	"\xc3\x85ngstr\xc3\xb6m", "A\xcc\x8angstro\xcc\x88m",
+	"Fran\xc3\xa7ois M\xc3\xbcller.pages", "se\xc3\xb1or", "\xc3\x9f",
+};
+
+static const char * const apfs_bench_cjk[] = {
+	"\xe6\x9d\xb1\xe4\xba\xac\xe9\x83\xbd",
+	"\xe4\xb8\xad\xe6\x96\x87\xe6\x96\x87\xe4\xbb\xb6\xe5\x90\x8d.txt",
+	"\xe5\x86\x99\xe7\x9c\x9f", "\xe3\x83\x95\xe3\x82\xa1\xe3\x82\xa4"
+	"\xe3\x83\xab", "\xe3\x83\x8f\xe3\x82\x9a\xe3\x83\xb3",
+};
+
+/* Hangul gets decomposed algorithmically, so it has its own corpus */
+static const char * const apfs_bench_hangul[] = {
+	"\xed\x95\x9c\xea\xb5\xad\xec\x96\xb4",
+	"\xed\x8c\x8c\xec\x9d\xbc \xec\x9d\xb4\xeb\xa6\x84.hwp",
+	"\xe1\x84\x92\xe1\x85\xa1\xe1\x86\xab\xea\xb8\x80",
+	"\xec\x82\xac\xec\xa7\x84",
+};
+
+static const char * const apfs_bench_emoji[] = {
+	"\xf0\x9f\x93\xb7 Photos", "Party \xf0\x9f\x8e\x89\xf0\x9f\x8e\x89",
+	"\xf0\x9f\x91\xa8\xe2\x80\x8d\xf0\x9f\x91\xa9\xe2\x80\x8d\xf0\x9f\x91"
+	"\xa7 family", "\xe2\x9d\xa4\xef\xb8\x8f",
+};
+
+#define APFS_BENCH_CORPUS(n, s) { n, s, ARRAY_SIZE(s) }
+
+static const struct apfs_bench_corpus apfs_bench_corpora[] = {
+	APFS_BENCH_CORPUS("ascii", apfs_bench_ascii),
+	APFS_BENCH_CORPUS("latin", apfs_bench_latin),
+	APFS_BENCH_CORPUS("cjk", apfs_bench_cjk),
+	APFS_BENCH_CORPUS("hangul", apfs_bench_hangul),
+	APFS_BENCH_CORPUS("emoji", apfs_bench_emoji),
+};
+
+/*
+ * Fake mount, only good enough for the case sensitivity checks
+ */
+static struct super_block apfs_bench_sb;
+static struct apfs_sb_info apfs_bench_sbi;
+static struct apfs_superblock apfs_bench_vsb;
+
+/*
+ * Names of a corpus, with their total length
+ */
+struct apfs_bench_names {
+	char **names;
+	unsigned int nr;
+	u64 bytes;
+};
+
+/* Keeps the compiler from optimizing the calls away */
+static volatile u64 apfs_bench_sink;
+
+/**
+ * apfs_bench_report - Print the result of a benchmark
+ * @corpus:	name of the corpus
+ * @test:	name of the benchmark
+ * @cf:		was the mount case insensitive?
+ * @ops:	number of calls made
+ * @bytes:	number of name bytes processed
+ * @ns:		time spent
+ * @cycles:	cycles spent
+ */
+static void apfs_bench_report(const char *corpus, const char *test, bool cf,
+			      u64 ops, u64 bytes, u64 ns, u64 cycles)
+{
+	u64 ns_op = div64_u64(ns * 100, ops);
+	u64 cycles_byte = bytes ? div64_u64(cycles * 100, bytes) : 0;
+
+	pr_info("apfs_bench: %-6s %-18s %s: %llu.%02llu ns/op, %llu.%02llu cycles/byte\n",
+		corpus, test, cf ? "ci" : "cs", ns_op / 100, ns_op % 100,
+		cycles_byte / 100, cycles_byte % 100);
+}
+
+/**
+ * apfs_bench_names_build - Build the names for a corpus
+ * @corpus:	the corpus
+ * @names:	on return, the names
+ *
+ * Each stem gets a numeric suffix, so that the comparisons don't all stop at
+ * the first byte.  Returns 0 on success, or -ENOMEM in case of failure.
+ */
+static int apfs_bench_names_build(const struct apfs_bench_corpus *corpus,
+				  struct apfs_bench_names *names)
+{
+	unsigned int i;
+
+	names->nr = corpus->nr_stems * APFS_BENCH_VARIANTS;
+	names->bytes = 0;
+	names->names = kcalloc(names->nr, sizeof(*names->names), GFP_KERNEL);
+	if (!names->names)
+		return -ENOMEM;
+
+	for (i = 0; i < names->nr; ++i) {
+		names->names[i] = kasprintf(GFP_KERNEL, "%s %u",
+				corpus->stems[i % corpus->nr_stems],
+				i / corpus->nr_stems);
+		if (!names->names[i])
+			return -ENOMEM;
+		names->bytes += strlen(names->names[i]);
+	}
+	return 0;
+}
+
+static void apfs_bench_names_free(struct apfs_bench_names *names)
+{
+	unsigned int i;
+
+	if (!names->names)
+		return;
+	for (i = 0; i < names->nr; ++i)
+		kfree(names->names[i]);
+	kfree(names->names);
+}
+
+static void apfs_bench_normalize(const char *corpus,
+				 struct apfs_bench_names *names, bool cf)
+{
+	struct apfs_unicursor cursor;
+	u64 start, cycles, sum = 0;
+	unsigned int i, pass;
+
+	cycles = get_cycles();
+	start = ktime_get_ns();
+	for (pass = 0; pass < APFS_BENCH_PASSES; ++pass) {
+		for (i = 0; i < names->nr; ++i) {
+			unicode_t uni;
+
+			apfs_init_unicursor(&cursor, names->names[i]);
+			while ((uni = apfs_normalize_next(&cursor, cf)))
+				sum += uni;
+		}
+		cond_resched();
+	}
+	apfs_bench_report(corpus, "normalize_next", cf,
+			  (u64)names->nr * APFS_BENCH_PASSES,
+			  names->bytes * APFS_BENCH_PASSES,
+			  ktime_get_ns() - start, get_cycles() - cycles);
+	apfs_bench_sink = sum;
+}
+
+/* Each name is compared with the next one, as in a bisection step */
+static void apfs_bench_filename_cmp(const char *corpus,
+				    struct apfs_bench_names *names, bool cf)
+{
+	u64 start, cycles, sum = 0;
+	unsigned int i, pass;
+
+	cycles = get_cycles();
+	start = ktime_get_ns();
+	for (pass = 0; pass < APFS_BENCH_PASSES; ++pass) {
+		for (i = 0; i < names->nr; ++i)
+			sum += apfs_filename_cmp(&apfs_bench_sb,
+				names->names[i],
+				names->names[(i + 1) % names->nr]);
+		cond_resched();
+	}
+	apfs_bench_report(corpus, "filename_cmp", cf,
+			  (u64)names->nr * APFS_BENCH_PASSES,
+			  2 * names->bytes * APFS_BENCH_PASSES,
+			  ktime_get_ns() - start, get_cycles() - cycles);
+	apfs_bench_sink = sum;
+}
+
+static void apfs_bench_keycmp(const char *corpus,
+			      struct apfs_bench_names *names, bool cf)
+{
+	struct apfs_key k1, k2;
+	u64 start, cycles, sum = 0;
+	unsigned int i, pass;
+
+	apfs_init_drec_key_by_hash(APFS_ROOT_DIR_INO_NUM, 0, &k1);
+	apfs_init_drec_key_by_hash(APFS_ROOT_DIR_INO_NUM, 0, &k2);
+
+	cycles = get_cycles();
+	start = ktime_get_ns();
+	for (pass = 0; pass < APFS_BENCH_PASSES; ++pass) {
+		for (i = 0; i < names->nr; ++i) {
+			k1.name = names->names[i];
+			k2.name = names->names[(i + 1) % names->nr];
+			sum += apfs_keycmp(&apfs_bench_sb, &k1, &k2);
+		}
+		cond_resched();
+	}
+	apfs_bench_report(corpus, "keycmp", cf,
+			  (u64)names->nr * APFS_BENCH_PASSES,
+			  2 * names->bytes * APFS_BENCH_PASSES,
+			  ktime_get_ns() - start, get_cycles() - cycles);
+	apfs_bench_sink = sum;
+}
+
+static void apfs_bench_hashed_key(const char *corpus,
+				  struct apfs_bench_names *names, bool cf)
+{
+	struct apfs_key key;
+	u64 start, cycles, sum = 0;
+	unsigned int i, pass;
+
+	cycles = get_cycles();
+	start = ktime_get_ns();
+	for (pass = 0; pass < APFS_BENCH_PASSES; ++pass) {
+		for (i = 0; i < names->nr; ++i) {
+			apfs_init_drec_hashed_key(&apfs_bench_sb,
+						  APFS_ROOT_DIR_INO_NUM,
+						  names->names[i], &key);
+			sum += key.number;
+		}
+		cond_resched();
+	}
+	apfs_bench_report(corpus, "drec_hashed_key", cf,
+			  (u64)names->nr * APFS_BENCH_PASSES,
+			  names->bytes * APFS_BENCH_PASSES,
+			  ktime_get_ns() - start, get_cycles() - cycles);
+	apfs_bench_sink = sum;
+}
+
+/*
+ * Layouts of the keys in the benchmark nodes: a leaf with a few records for
+ * each inode, or the extents of a single fragmented file
+ */
+enum {
+	APFS_BENCH_TOC_CATALOG,
+	APFS_BENCH_TOC_EXTENTS,
+	APFS_BENCH_TOC_LAYOUTS,
+};
+
+static const char * const apfs_bench_toc_names[] = {
+	[APFS_BENCH_TOC_CATALOG] = "catalog",
+	[APFS_BENCH_TOC_EXTENTS] = "extents",
+};
+
+/**
+ * apfs_bench_toc_build - Fill a table of contents for a benchmark node
+ * @toc:	the table to fill
+ * @nr:		number of entries
+ * @layout:	layout of the keys
+ */
+static void apfs_bench_toc_build(struct apfs_toc_entry *toc, int nr,
+				 int layout)
+{
+	static const u8 types[] = {
+		APFS_TYPE_INODE, APFS_TYPE_XATTR, APFS_TYPE_FILE_EXTENT,
+	};
+	int i;
+
+	memset(toc, 0, nr * sizeof(*toc));
+	for (i = 0; i < nr; ++i) {
+		if (layout == APFS_BENCH_TOC_CATALOG) {
+			toc[i].id = 0x10000 + i / ARRAY_SIZE(types);
+			toc[i].type = types[i % ARRAY_SIZE(types)];
+		} else {
+			toc[i].id = 0x10000;
+			toc[i].type = APFS_TYPE_FILE_EXTENT;
+			toc[i].number = (u64)i << 20;
+		}
+	}
+}
+
+/* Same search as apfs_node_query() does by bisection, over the toc */
+static int apfs_bench_toc_bisect(const struct apfs_toc_entry *toc, int end,
+				 struct apfs_key *key)
+{
+	int left = 0, right = end - 1, found = -1;
+
+	while (left <= right) {
+		int mid = (left + right) / 2;
+		struct apfs_key curr = {
+			.id = toc[mid].id,
+			.type = toc[mid].type,
+			.number = toc[mid].number,
+		};
+
+		if (apfs_keycmp(&apfs_bench_sb, &curr, key) <= 0) {
+			found = mid;
+			left = mid + 1;
+		} else {
+			right = mid - 1;
+		}
+	}
+	return found;
+}
+
+/**
+ * apfs_bench_toc_search - Time the searches of a node by bisection and scan
+ * @toc:	the table of contents
+ * @nr:		number of entries
+ * @layout:	layout of the keys
+ *
+ * Looks up every key in the node, and a missing key right after each of
+ * them, so that both hits and floor searches are measured.  The number of
+ * entries must be a power of two.
+ */
+static void apfs_bench_toc_search(struct apfs_toc_entry *toc, int nr,
+				  int layout)
+{
+	u64 start, cycles, ns[2], cyc[2], ops, sum = 0;
+	unsigned int pass;
+	int scan, i;
+
+	ops = (u64)2 * nr * APFS_BENCH_PASSES * APFS_BENCH_VARIANTS;
+	for (scan = 0; scan <= 1; ++scan) {
+		cycles = get_cycles();
+		start = ktime_get_ns();
+		for (pass = 0; pass < APFS_BENCH_PASSES * APFS_BENCH_VARIANTS;
+		     ++pass) {
+			for (i = 0; i < 2 * nr; ++i) {
+				/* A permutation, so branches are not learned */
+				int j = (i * 7) % (2 * nr);
+				struct apfs_key key = {
+					.id = toc[j / 2].id,
+					.type = toc[j / 2].type,
+					.number = toc[j / 2].number + j % 2,
+				};
+
+				if (scan)
+					sum += apfs_toc_scan(toc, nr,
+							     NULL /* raw */,
+							     &key);
+				else
+					sum += apfs_bench_toc_bisect(toc, nr,
+								     &key);
+			}
+			if (pass % APFS_BENCH_PASSES == 0)
+				cond_resched();
+		}
+		ns[scan] = ktime_get_ns() - start;
+		cyc[scan] = get_cycles() - cycles;
+	}
+	apfs_bench_sink = sum;
+
+	for (scan = 0; scan <= 1; ++scan) {
+		u64 ns_op = div64_u64(ns[scan] * 100, ops);
+		u64 cycles_op = div64_u64(cyc[scan] * 100, ops);
+
+		pr_info("apfs_bench: %-7s %3d keys %-6s: %llu.%02llu ns/op, %llu.%02llu cycles/op\n",
+			apfs_bench_toc_names[layout], nr,
+			scan ? "scan" : "bisect", ns_op / 100, ns_op % 100,
+			cycles_op / 100, cycles_op % 100);
+	}
+}
+
+/**
+ * apfs_bench_toc - Compare the searches of a node for several node sizes
+ *
+ * Sizes go past APFS_TOC_SCAN_MAX, to check that the switch to bisection is
+ * made where it should be.
+ */
+static void apfs_bench_toc(void)
+{
+	struct apfs_toc_entry *toc;
+	int layout, nr;
+
+	toc = kcalloc(4 * APFS_TOC_SCAN_MAX, sizeof(*toc), GFP_KERNEL);
+	if (!toc) {
+		pr_warn("apfs_bench: out of memory\n");
+		return;
+	}
+	for (layout = 0; layout < APFS_BENCH_TOC_LAYOUTS; ++layout) {
+		for (nr = 4; nr <= 4 * APFS_TOC_SCAN_MAX; nr *= 2) {
+			apfs_bench_toc_build(toc, nr, layout);
+			apfs_bench_toc_search(toc, nr, layout);
+		}
+	}
+	kfree(toc);
+}
+
+/**
+ * apfs_bench_run - Time the filename code over all the corpora
+ *
+ * Each filename benchmark runs twice, for case sensitive and case insensitive
+ * mounts, and then the node searches are timed.  The results only go to the
+ * kernel log.
+ */
+void __init apfs_bench_run(void)
+{
+	unsigned int i;
+	int cf;
+
+	apfs_bench_sb.s_fs_info = &apfs_bench_sbi;
+	apfs_bench_sbi.s_vsb_raw = &apfs_bench_vsb;
+
+	for (i = 0; i < ARRAY_SIZE(apfs_bench_corpora); ++i) {
+		const char *corpus = apfs_bench_corpora[i].name;
+		struct apfs_bench_names names = {0};
+
+		if (apfs_bench_names_build(&apfs_bench_corpora[i], &names)) {
+			pr_warn("apfs_bench: out of memory\n");
+			apfs_bench_names_free(&names);
+			return;
+		}
+
+		for (cf = 0; cf <= 1; ++cf) {
+			apfs_bench_vsb.apfs_incompatible_features = cf ?
+				cpu_to_le64(APFS_INCOMPAT_CASE_INSENSITIVE) : 0;
+			apfs_set_case_fold(&apfs_bench_sbi);
+			apfs_bench_normalize(corpus, &names, cf);
+			apfs_bench_filename_cmp(corpus, &names, cf);
+			apfs_bench_keycmp(corpus, &names, cf);
+			apfs_bench_hashed_key(corpus, &names, cf);
+		}
+		apfs_bench_names_free(&names);
+	}
+	apfs_bench_toc();
+}
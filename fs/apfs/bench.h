@@ -0,0 +1,17 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/bench.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_BENCH_H
+#define _APFS_BENCH_H
+
+#ifdef CONFIG_APFS_BENCH
+extern void __init apfs_bench_run(void);
+#else
+static inline void apfs_bench_run(void) {}
+#endif
+
+#endif	/* _APFS_BENCH_H */
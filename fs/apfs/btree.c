@@ -5,14 +5,24 @@
  * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
  */
 
+#include <linux/blkdev.h>
 #include <linux/buffer_head.h>
+#include <linux/hash.h>
+#include <linux/jhash.h>
+#include <linux/log2.h>
+#include <linux/mm.h>
+#include <linux/mutex.h>
 #include <linux/slab.h>
+#include <linux/sort.h>
 #include "apfs.h"
 #include "btree.h"
+#include "catidx.h"
 #include "key.h"
 #include "message.h"
 #include "node.h"
+#include "stats.h"
 #include "super.h"
+#include "trace.h"
 
 /**
  * apfs_child_from_query - Read the child id found by a successful nonleaf query
@@ -25,7 +35,7 @@
  */
 static int apfs_child_from_query(struct apfs_query *query, u64 *child)
 {
-	char *raw = query->node->object.bh->b_data;
+	char *raw = query->node->object.data;
 
 	if (query->len != 8) /* The data on a nonleaf node is the child id */
 		return -EFSCORRUPTED;
@@ -35,193 +45,2075 @@ static int apfs_child_from_query(struct apfs_query *query, u64 *child)
 }
 
 /**
- * apfs_omap_lookup_block - Find the block number of a b-tree node from its id
+ * apfs_omap_cache_init - Allocate an omap translation cache
+ * @cache:	the omap cache
+ * @size:	number of entries wanted
+ *
+ * The size of the cache is rounded up to a power of two, and to the smallest
+ * table; a size of zero disables it.  The table starts small and only grows
+ * to that size if the mount gets used, so that idle mounts stay cheap.  It
+ * gets charged to the memory cgroup of the task that mounts.  Returns 0 on
+ * success or -ENOMEM in case of failure.
+ */
+static int apfs_omap_cache_init(struct apfs_omap_cache *cache,
+				unsigned long size)
+{
+	spin_lock_init(&cache->lock);
+	cache->entries = NULL;
+	cache->bits = 0;
+	cache->fill = 0;
+	if (!size)
+		return 0;
+
+	/* Tiny sizes would leave no bits for the hash */
+	cache->max_bits = max_t(unsigned int, order_base_2(size),
+				APFS_CACHE_MIN_BITS);
+	cache->bits = APFS_CACHE_MIN_BITS;
+	cache->entries = kvcalloc(1UL << cache->bits, sizeof(*cache->entries),
+				  GFP_KERNEL | __GFP_ACCOUNT);
+	if (!cache->entries)
+		return -ENOMEM;
+	return 0;
+}
+
+/**
+ * apfs_omap_cache_slot - Find the cache slot for a translation
+ * @cache:	the omap cache, locked
+ * @oid:	virtual object id
+ * @xid:	transaction id
+ */
+static inline struct apfs_omap_cache_entry *
+apfs_omap_cache_slot(struct apfs_omap_cache *cache, u64 oid, u64 xid)
+{
+	return &cache->entries[hash_64(oid ^ xid, cache->bits)];
+}
+
+/**
+ * apfs_omap_cache_lookup - Look up a translation in the omap cache
+ * @cache:	the omap cache
+ * @oid:	virtual object id
+ * @xid:	transaction id
+ * @block:	on return, the cached block number
+ *
+ * Returns true on a cache hit.
+ */
+static bool apfs_omap_cache_lookup(struct apfs_omap_cache *cache,
+				   u64 oid, u64 xid, u64 *block)
+{
+	struct apfs_omap_cache_entry *entry;
+	bool hit = false;
+
+	if (!cache->entries)
+		return false;
+
+	spin_lock(&cache->lock);
+	entry = apfs_omap_cache_slot(cache, oid, xid);
+	if (entry->oid == oid && entry->xid == xid) {
+		*block = entry->bno;
+		hit = true;
+	}
+	spin_unlock(&cache->lock);
+	return hit;
+}
+
+/**
+ * apfs_omap_cache_grow - Move the omap cache to a bigger table
+ * @cache:	the omap cache
+ *
+ * Failure is harmless, the cache just keeps its current size for a while.
+ */
+static void apfs_omap_cache_grow(struct apfs_omap_cache *cache)
+{
+	struct apfs_omap_cache_entry *new, *old;
+	unsigned int bits, old_bits;
+	unsigned long i;
+
+	bits = min(READ_ONCE(cache->bits) + APFS_CACHE_GROW_BITS,
+		   cache->max_bits);
+	new = kvcalloc(1UL << bits, sizeof(*new),
+		       GFP_KERNEL | __GFP_ACCOUNT | __GFP_NOWARN);
+
+	spin_lock(&cache->lock);
+	cache->fill = 0;
+	if (!new || cache->bits >= bits || bits > cache->max_bits) {
+		/* Someone else got here first, or the cache was resized */
+		spin_unlock(&cache->lock);
+		kvfree(new);
+		return;
+	}
+	old = cache->entries;
+	old_bits = cache->bits;
+	for (i = 0; i < 1UL << old_bits; i++) {
+		if (old[i].oid)
+			new[hash_64(old[i].oid ^ old[i].xid, bits)] = old[i];
+	}
+	cache->entries = new;
+	cache->bits = bits;
+	spin_unlock(&cache->lock);
+	kvfree(old);
+}
+
+/**
+ * apfs_omap_cache_insert - Add a translation to the omap cache
+ * @cache:	the omap cache
+ * @oid:	virtual object id
+ * @xid:	transaction id
+ * @block:	physical block number
+ * @flags:	flags of the query that found the translation
+ */
+static void apfs_omap_cache_insert(struct apfs_omap_cache *cache,
+				   u64 oid, u64 xid, u64 block,
+				   unsigned int flags)
+{
+	struct apfs_omap_cache_entry *entry;
+	bool grow;
+
+	if (!cache->entries)
+		return;
+
+	spin_lock(&cache->lock);
+	entry = apfs_omap_cache_slot(cache, oid, xid);
+	entry->oid = oid;
+	entry->xid = xid;
+	entry->bno = block;
+	grow = cache->bits < cache->max_bits &&
+	       ++cache->fill > (1U << cache->bits);
+	spin_unlock(&cache->lock);
+
+	if (grow && !(flags & APFS_QUERY_NOWAIT))
+		apfs_omap_cache_grow(cache);
+}
+
+/**
+ * apfs_cache_resize_bits - Find the table size for a new cache limit
+ * @size:	most entries wanted
+ * @max_size:	most entries allowed for the cache
+ *
+ * Rounds down, so that the table stays within the limit; the only exception
+ * is the smallest table.  Returns the log2 of the size.
+ */
+static unsigned int apfs_cache_resize_bits(unsigned long size,
+					   unsigned long max_size)
+{
+	size = min(size, max_size);
+	if (size <= 1UL << APFS_CACHE_MIN_BITS)
+		return APFS_CACHE_MIN_BITS;
+	return ilog2(size);
+}
+
+/**
+ * apfs_omap_cache_resize - Change the full size of the omap cache of a mount
+ * @sb:		filesystem superblock
+ * @size:	number of entries wanted
+ *
+ * A smaller table replaces the current one right away, and a bigger one is
+ * only reached with use, as after mount.  The cache can't be turned off with
+ * a size of zero, because lookups check for the table without the lock; it
+ * gets the smallest table instead.  Shared caches are resized for all their
+ * mounts.  Returns 0 on success or -ENOMEM in case of failure.
+ */
+int apfs_omap_cache_resize(struct super_block *sb, unsigned long size)
+{
+	struct apfs_omap_cache *cache = &APFS_SB(sb)->s_meta_cache->omap;
+	struct apfs_omap_cache_entry *new = NULL, *old = NULL;
+	unsigned int max_bits, bits;
+	unsigned long i;
+
+	max_bits = apfs_cache_resize_bits(size, APFS_OMAP_CACHE_MAX_SIZE);
+	bits = min(max_bits, READ_ONCE(cache->bits));
+	if (!READ_ONCE(cache->entries))
+		bits = min_t(unsigned int, max_bits, APFS_CACHE_MIN_BITS);
+	new = kvcalloc(1UL << bits, sizeof(*new), GFP_KERNEL | __GFP_ACCOUNT);
+	if (!new)
+		return -ENOMEM;
+
+	spin_lock(&cache->lock);
+	cache->max_bits = max_bits;
+	if (cache->entries && cache->bits <= max_bits) {
+		/* The table may stay, it will grow with use if needed */
+		spin_unlock(&cache->lock);
+		kvfree(new);
+		return 0;
+	}
+	old = cache->entries;
+	for (i = 0; old && i < 1UL << cache->bits; i++) {
+		if (old[i].oid)
+			new[hash_64(old[i].oid ^ old[i].xid, bits)] = old[i];
+	}
+	cache->entries = new;
+	cache->bits = bits;
+	cache->fill = 0;
+	spin_unlock(&cache->lock);
+	kvfree(old);
+	return 0;
+}
+
+/**
+ * apfs_query_get_node - Read a node for a query
+ * @sb:		filesystem superblock
+ * @flags:	flags of the query
+ * @block:	number of the block where the node is stored
+ *
+ * Queries with APFS_QUERY_NOWAIT only take nodes from the cache, and fail
+ * with -EAGAIN if the node would have to be read.
+ */
+static inline struct apfs_node *apfs_query_get_node(struct super_block *sb,
+						    unsigned int flags,
+						    u64 block)
+{
+	if (flags & APFS_QUERY_NOWAIT)
+		return apfs_read_cached_node(sb, block);
+	return apfs_read_node(sb, block);
+}
+
+/**
+ * apfs_omap_lookup - Find the block number of a b-tree node from its id
  * @sb:		filesystem superblock
  * @tbl:	Root of the object map to be searched
  * @id:		id of the node
  * @block:	on return, the found block number
+ * @flags:	extra flags for the omap query
  *
- * Returns 0 on success or a negative error code in case of failure.
+ * Same as apfs_omap_lookup_block(), but the caller may ask for a query that
+ * doesn't block.
  */
-int apfs_omap_lookup_block(struct super_block *sb, struct apfs_node *tbl,
-			   u64 id, u64 *block)
+static int apfs_omap_lookup(struct super_block *sb, struct apfs_node *tbl,
+			    u64 id, u64 *block, unsigned int flags)
 {
 	struct apfs_sb_info *sbi = APFS_SB(sb);
-	struct apfs_query *query;
+	struct apfs_omap_cache *cache = &sbi->s_meta_cache->omap;
+	bool cacheable = tbl == sbi->s_omap_root;
+	struct apfs_query query;
 	struct apfs_key key;
 	int ret = 0;
 
-	query = apfs_alloc_query(tbl, NULL /* parent */);
-	if (!query)
-		return -ENOMEM;
+	if (cacheable) {
+		if (apfs_omap_cache_lookup(cache, id, sbi->s_xid, block)) {
+			apfs_stat_inc(sb, APFS_STAT_OMAP_CACHE_HITS);
+			trace_apfs_omap_lookup_block(sb, id, *block, true, 0);
+			return 0;
+		}
+		apfs_stat_inc(sb, APFS_STAT_OMAP_CACHE_MISSES);
+	}
 
+	apfs_init_query(&query, tbl);
 	apfs_init_omap_key(id, sbi->s_xid, &key);
-	query->key = &key;
-	query->flags |= APFS_QUERY_OMAP;
+	query.key = &key;
+	query.flags |= APFS_QUERY_OMAP | flags;
 
 	ret = apfs_btree_query(sb, &query);
 	if (ret)
 		goto fail;
 
-	ret = apfs_bno_from_query(query, block);
+	ret = apfs_bno_from_query(&query, block);
 	if (ret)
 		apfs_alert(sb, "bad object map leaf block: 0x%llx",
-			   query->node->object.block_nr);
+			   query.node->object.block_nr);
+	else if (cacheable)
+		apfs_omap_cache_insert(cache, id, sbi->s_xid, *block, flags);
 
 fail:
-	apfs_free_query(sb, query);
+	apfs_free_query(sb, &query);
+	trace_apfs_omap_lookup_block(sb, id, ret ? 0 : *block, false, ret);
 	return ret;
 }
 
 /**
- * apfs_alloc_query - Allocates a query structure
- * @node:	node to be searched
- * @parent:	query for the parent node
+ * apfs_omap_lookup_block - Find the block number of a b-tree node from its id
+ * @sb:		filesystem superblock
+ * @tbl:	Root of the object map to be searched
+ * @id:		id of the node
+ * @block:	on return, the found block number
  *
- * Callers other than apfs_btree_query() should set @parent to NULL, and @node
- * to the root of the b-tree. They should also initialize most of the query
- * fields themselves; when @parent is not NULL the query will inherit them.
+ * Translations from the volume object map are looked up in the omap cache
+ * first.  Returns 0 on success or a negative error code in case of failure.
+ */
+int apfs_omap_lookup_block(struct super_block *sb, struct apfs_node *tbl,
+			   u64 id, u64 *block)
+{
+	return apfs_omap_lookup(sb, tbl, id, block, 0 /* flags */);
+}
+
+/**
+ * apfs_rec_cache_init - Allocate a catalog record cache
+ * @cache:	the record cache
+ * @size:	number of entries wanted
  *
- * Returns the allocated query, or NULL in case of failure.
+ * The size of the cache is rounded up to a power of two, and to the smallest
+ * table; a size of zero disables it.  Like the omap cache, the table starts
+ * small and grows with use.  The catalog finger is set up here as well, even
+ * if the cache is disabled.  Returns 0 on success or -ENOMEM in case of
+ * failure.
  */
-struct apfs_query *apfs_alloc_query(struct apfs_node *node,
-				    struct apfs_query *parent)
+static int apfs_rec_cache_init(struct apfs_rec_cache *cache,
+			       unsigned long size)
 {
-	struct apfs_query *query;
+	spin_lock_init(&cache->finger.lock);
+	cache->finger.leaf = 0;
+	spin_lock_init(&cache->lock);
+	cache->entries = NULL;
+	cache->bits = 0;
+	cache->fill = 0;
+	if (!size)
+		return 0;
 
-	query = kmalloc(sizeof(*query), GFP_KERNEL);
-	if (!query)
-		return NULL;
+	/* Tiny sizes would leave no bits for the hash */
+	cache->max_bits = max_t(unsigned int, order_base_2(size),
+				APFS_CACHE_MIN_BITS);
+	cache->bits = APFS_CACHE_MIN_BITS;
+	cache->entries = kvcalloc(1UL << cache->bits, sizeof(*cache->entries),
+				  GFP_KERNEL | __GFP_ACCOUNT);
+	if (!cache->entries)
+		return -ENOMEM;
+	return 0;
+}
 
-	/* To be released by free_query. */
-	apfs_node_get(node);
-	query->node = node;
-	query->key = parent ? parent->key : NULL;
-	query->flags = parent ?
-		parent->flags & ~(APFS_QUERY_DONE | APFS_QUERY_NEXT) : 0;
-	query->parent = parent;
-	/* Start the search with the last record and go backwards */
-	query->index = node->records;
-	query->depth = parent ? parent->depth + 1 : 0;
+/* List of the caches shared by mounts, protected by apfs_meta_caches_mutex */
+static LIST_HEAD(apfs_meta_caches);
+static DEFINE_MUTEX(apfs_meta_caches_mutex);
 
-	return query;
+/**
+ * apfs_meta_cache_free - Free the omap and record caches of a mount
+ * @cache:	the caches, no longer in use
+ */
+static void apfs_meta_cache_free(struct apfs_meta_cache *cache)
+{
+	kvfree(cache->omap.entries);
+	kvfree(cache->rec.entries);
+	kfree(cache->snap_name);
+	kfree(cache);
 }
 
 /**
- * apfs_free_query - Free a query structure
+ * apfs_meta_cache_alloc - Allocate the omap and record caches for a mount
  * @sb:		filesystem superblock
- * @query:	query to free
  *
- * Also frees the ancestor queries, if they are kept.
+ * Returns the new caches, with a single user, or NULL in case of failure.
  */
-void apfs_free_query(struct super_block *sb, struct apfs_query *query)
+static struct apfs_meta_cache *apfs_meta_cache_alloc(struct super_block *sb)
 {
-	while (query) {
-		struct apfs_query *parent = query->parent;
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_meta_cache *cache;
 
-		apfs_node_put(query->node);
-		kfree(query);
-		query = parent;
+	cache = kzalloc(sizeof(*cache), GFP_KERNEL | __GFP_ACCOUNT);
+	if (!cache)
+		return NULL;
+	INIT_LIST_HEAD(&cache->list);
+	cache->users = 1;
+	if (apfs_omap_cache_init(&cache->omap, sbi->s_omap_cache_size) ||
+	    apfs_rec_cache_init(&cache->rec, sbi->s_rec_cache_size)) {
+		apfs_meta_cache_free(cache);
+		return NULL;
 	}
+	return cache;
 }
 
 /**
- * apfs_btree_query - Execute a query on a b-tree
+ * apfs_meta_cache_match - Check if shared caches are for the image of a mount
+ * @cache:	the shared caches
  * @sb:		filesystem superblock
- * @query:	the query to execute
+ */
+static bool apfs_meta_cache_match(struct apfs_meta_cache *cache,
+				  struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_nxsb_info *nxi = sbi->s_nxi;
+
+	if (memcmp(cache->nx_uuid, nxi->nx_raw->nx_uuid, sizeof(cache->nx_uuid)))
+		return false;
+	if (cache->nx_xid != nxi->nx_xid || cache->vol_nr != sbi->s_vol_nr)
+		return false;
+	if (!cache->snap_name || !sbi->s_snap_name)
+		return !cache->snap_name && !sbi->s_snap_name;
+	return strcmp(cache->snap_name, sbi->s_snap_name) == 0;
+}
+
+/**
+ * apfs_meta_cache_get - Set up the omap and record caches for a new mount
+ * @sb:		filesystem superblock, with the container mapped
  *
- * Searches the b-tree starting at @query->index in @query->node, looking for
- * the record corresponding to @query->key.
+ * With the sharecache option, the mount gets the caches of any other mount of
+ * the same image, or new ones that later mounts of the image can find.  Other
+ * mounts get caches of their own.  Returns 0 on success or -ENOMEM in case of
+ * failure.
+ */
+int apfs_meta_cache_get(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_nxsb_info *nxi = sbi->s_nxi;
+	struct apfs_meta_cache *cache;
+
+	if (!(sbi->s_flags & APFS_SHARE_CACHE)) {
+		sbi->s_meta_cache = apfs_meta_cache_alloc(sb);
+		return sbi->s_meta_cache ? 0 : -ENOMEM;
+	}
+
+	mutex_lock(&apfs_meta_caches_mutex);
+	list_for_each_entry(cache, &apfs_meta_caches, list) {
+		if (apfs_meta_cache_match(cache, sb)) {
+			cache->users++;
+			goto out;
+		}
+	}
+
+	cache = apfs_meta_cache_alloc(sb);
+	if (!cache)
+		goto out;
+	memcpy(cache->nx_uuid, nxi->nx_raw->nx_uuid, sizeof(cache->nx_uuid));
+	cache->nx_xid = nxi->nx_xid;
+	cache->vol_nr = sbi->s_vol_nr;
+	if (sbi->s_snap_name) {
+		cache->snap_name = kstrdup(sbi->s_snap_name, GFP_KERNEL);
+		if (!cache->snap_name) {
+			apfs_meta_cache_free(cache);
+			cache = NULL;
+			goto out;
+		}
+	}
+	list_add(&cache->list, &apfs_meta_caches);
+out:
+	mutex_unlock(&apfs_meta_caches_mutex);
+	sbi->s_meta_cache = cache;
+	return cache ? 0 : -ENOMEM;
+}
+
+/**
+ * apfs_meta_cache_put - Drop the omap and record caches of a mount
+ * @sb:		filesystem superblock
  *
- * Returns 0 in case of success and sets the @query->len, @query->off and
- * @query->index fields to the results of the query. @query->node will now
- * point to the leaf node holding the record.
+ * Shared caches are only freed once the last mount of the image is gone.
+ */
+void apfs_meta_cache_put(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_meta_cache *cache = sbi->s_meta_cache;
+	bool last;
+
+	if (!cache)
+		return;
+	sbi->s_meta_cache = NULL;
+
+	mutex_lock(&apfs_meta_caches_mutex);
+	last = --cache->users == 0;
+	if (last)
+		list_del(&cache->list);
+	mutex_unlock(&apfs_meta_caches_mutex);
+	if (last)
+		apfs_meta_cache_free(cache);
+}
+
+/**
+ * apfs_rec_cache_wanted - Check if the result of a query can be cached
+ * @sb:		filesystem superblock
+ * @query:	the query, not yet executed
  *
- * In case of failure returns an appropriate error code.
+ * Only exact queries from the root of the catalog are cached; the others
+ * don't find a single record for their key.  The same goes for the external
+ * catalog index.
  */
-int apfs_btree_query(struct super_block *sb, struct apfs_query **query)
+static bool apfs_rec_cache_wanted(struct super_block *sb,
+				  struct apfs_query *query)
 {
 	struct apfs_sb_info *sbi = APFS_SB(sb);
+
+	if (!sbi->s_meta_cache->rec.entries && !sbi->s_catidx.slots)
+		return false;
+	if ((query->flags & APFS_QUERY_TREE_MASK) != APFS_QUERY_CAT)
+		return false;
+	if (!(query->flags & APFS_QUERY_EXACT))
+		return false;
+	if (query->flags & APFS_QUERY_MULTIPLE)
+		return false;
+	return query->depth == 0 && query->node == sbi->s_cat_root;
+}
+
+/**
+ * apfs_rec_cache_hash - Hash the key fields of a record for the cache
+ * @id:		id of the record
+ * @type:	type of the record
+ * @number:	number of the record
+ * @name_hash:	hash of the key name, or 0
+ */
+static inline u64 apfs_rec_cache_hash(u64 id, u8 type, u64 number,
+				      u32 name_hash)
+{
+	u64 hash;
+
+	hash = id ^ ((u64)type << 56) ^ hash_64(number, 32);
+	return hash ^ ((u64)name_hash << 32);
+}
+
+/**
+ * apfs_rec_cache_slot - Find the cache slot for a key
+ * @cache:	the record cache, locked
+ * @key:	the key
+ * @name_hash:	hash of the key name, or 0
+ */
+static struct apfs_rec_cache_entry *
+apfs_rec_cache_slot(struct apfs_rec_cache *cache, struct apfs_key *key,
+		    u32 name_hash)
+{
+	u64 hash;
+
+	hash = apfs_rec_cache_hash(key->id, key->type, key->number, name_hash);
+	return &cache->entries[hash_64(hash, cache->bits)];
+}
+
+/**
+ * apfs_rec_cache_name_hash - Hash the name of a key for the record cache
+ * @key:	the key
+ */
+static inline u32 apfs_rec_cache_name_hash(struct apfs_key *key)
+{
+	return key->name ? jhash(key->name, strlen(key->name), 0) : 0;
+}
+
+/**
+ * apfs_query_set_record - Position a query on a known catalog record
+ * @sb:		filesystem superblock
+ * @query:	the query, not yet executed
+ * @bno:	block number of the leaf that should hold the record
+ * @index:	index of the record in the leaf
+ *
+ * Returns true if the record is there, with @query set as if by a successful
+ * search.
+ */
+static bool apfs_query_set_record(struct super_block *sb,
+				  struct apfs_query *query, u64 bno, int index)
+{
+	struct apfs_query leaf_query;
+	struct apfs_key *key = query->key;
+	struct apfs_key curr_key;
 	struct apfs_node *node;
-	struct apfs_query *parent;
-	u64 child_id, child_blk;
-	int err;
 
-next_node:
-	if ((*query)->depth >= 12) {
-		/*
-		 * We need a maximum depth for the tree so we can't loop
-		 * forever if the filesystem is damaged. 12 should be more
-		 * than enough to map every block.
-		 */
-		apfs_alert(sb, "b-tree is corrupted");
-		return -EFSCORRUPTED;
-	}
+	node = apfs_query_get_node(sb, query->flags, bno);
+	if (IS_ERR(node))
+		return false;
+	if (!apfs_node_is_leaf(node) || index >= node->records)
+		goto miss;
 
-	err = apfs_node_query(sb, *query);
-	if (err == -EAGAIN) {
-		if (!(*query)->parent) /* We are at the root of the tree */
-			return -ENODATA;
+	leaf_query = *query;
+	leaf_query.node = node;
+	leaf_query.index = index;
+	if (apfs_node_read_record(&leaf_query, &curr_key))
+		goto miss;
+	if (apfs_keycmp(sb, &curr_key, key))
+		goto miss;
 
-		/* Move back up one level and continue the query */
-		parent = (*query)->parent;
-		(*query)->parent = NULL; /* Don't free the parent */
-		apfs_free_query(sb, *query);
-		*query = parent;
-		goto next_node;
+	/* Drop the root, the query now holds the leaf reference */
+	apfs_node_put(query->node);
+	query->node = node;
+	query->index = index;
+	query->key_off = leaf_query.key_off;
+	query->key_len = leaf_query.key_len;
+	query->off = leaf_query.off;
+	query->len = leaf_query.len;
+	return true;
+
+miss:
+	apfs_node_put(node);
+	return false;
+}
+
+/**
+ * apfs_rec_cache_lookup - Position a query on a cached catalog record
+ * @sb:		filesystem superblock
+ * @query:	the query, not yet executed
+ *
+ * Returns true on a cache hit, with @query set as if by a successful search.
+ */
+static bool apfs_rec_cache_lookup(struct super_block *sb,
+				  struct apfs_query *query)
+{
+	struct apfs_rec_cache *cache = &APFS_SB(sb)->s_meta_cache->rec;
+	struct apfs_rec_cache_entry *entry;
+	struct apfs_key *key = query->key;
+	u32 name_hash;
+	u64 bno;
+	int index;
+	bool hit = false;
+
+	if (!cache->entries)
+		return false;
+
+	name_hash = apfs_rec_cache_name_hash(key);
+	spin_lock(&cache->lock);
+	entry = apfs_rec_cache_slot(cache, key, name_hash);
+	if (entry->type == key->type && entry->id == key->id &&
+	    entry->number == key->number && entry->name_hash == name_hash) {
+		bno = entry->bno;
+		index = entry->index;
+		hit = true;
 	}
-	if (err)
-		return err;
-	if (apfs_node_is_leaf((*query)->node)) /* All done */
-		return 0;
+	spin_unlock(&cache->lock);
+	return hit && apfs_query_set_record(sb, query, bno, index);
+}
 
-	err = apfs_child_from_query(*query, &child_id);
-	if (err) {
-		apfs_alert(sb, "bad index block: 0x%llx",
-			   (*query)->node->object.block_nr);
-		return err;
+/**
+ * apfs_catidx_lookup - Position a query on a record from the catalog index
+ * @sb:		filesystem superblock
+ * @query:	the query, not yet executed
+ *
+ * Returns true on an index hit, with @query set as if by a successful search.
+ */
+static bool apfs_catidx_lookup(struct super_block *sb,
+			       struct apfs_query *query)
+{
+	u64 bno;
+	int index;
+
+	if (!apfs_catidx_find(&APFS_SB(sb)->s_catidx, query->key, &bno,
+			      &index))
+		return false;
+	return apfs_query_set_record(sb, query, bno, index);
+}
+
+/**
+ * apfs_rec_cache_grow - Move the record cache to a bigger table
+ * @cache:	the record cache
+ *
+ * Failure is harmless, the cache just keeps its current size for a while.
+ */
+static void apfs_rec_cache_grow(struct apfs_rec_cache *cache)
+{
+	struct apfs_rec_cache_entry *new, *old;
+	unsigned int bits, old_bits;
+	unsigned long i;
+
+	bits = min(READ_ONCE(cache->bits) + APFS_CACHE_GROW_BITS,
+		   cache->max_bits);
+	new = kvcalloc(1UL << bits, sizeof(*new),
+		       GFP_KERNEL | __GFP_ACCOUNT | __GFP_NOWARN);
+
+	spin_lock(&cache->lock);
+	cache->fill = 0;
+	if (!new || cache->bits >= bits || bits > cache->max_bits) {
+		/* Someone else got here first, or the cache was resized */
+		spin_unlock(&cache->lock);
+		kvfree(new);
+		return;
 	}
+	old = cache->entries;
+	old_bits = cache->bits;
+	for (i = 0; i < 1UL << old_bits; i++) {
+		u64 hash;
 
-	/*
-	 * The omap maps a node id into a block number. The nodes
-	 * of the omap itself do not need this translation.
-	 */
-	if ((*query)->flags & APFS_QUERY_OMAP) {
-		child_blk = child_id;
-	} else {
-		/*
-		 * we are always performing lookup from omap root. Might
-		 * need improvement in the future.
-		 */
-		err = apfs_omap_lookup_block(sb, sbi->s_omap_root,
-					     child_id, &child_blk);
-		if (err)
-			return err;
+		if (!old[i].type)
+			continue;
+		hash = apfs_rec_cache_hash(old[i].id, old[i].type,
+					   old[i].number, old[i].name_hash);
+		new[hash_64(hash, bits)] = old[i];
 	}
+	cache->entries = new;
+	cache->bits = bits;
+	spin_unlock(&cache->lock);
+	kvfree(old);
+}
 
-	/* Now go a level deeper and search the child */
-	node = apfs_read_node(sb, child_blk);
-	if (IS_ERR(node))
-		return PTR_ERR(node);
+/**
+ * apfs_rec_cache_resize - Change the full size of the record cache of a mount
+ * @sb:		filesystem superblock
+ * @size:	number of entries wanted
+ *
+ * Same as apfs_omap_cache_resize(), for the catalog record cache.  Returns 0
+ * on success or -ENOMEM in case of failure.
+ */
+int apfs_rec_cache_resize(struct super_block *sb, unsigned long size)
+{
+	struct apfs_rec_cache *cache = &APFS_SB(sb)->s_meta_cache->rec;
+	struct apfs_rec_cache_entry *new = NULL, *old = NULL;
+	unsigned int max_bits, bits;
+	unsigned long i;
 
-	if (node->object.oid != child_id)
-		apfs_debug(sb, "corrupt b-tree");
+	max_bits = apfs_cache_resize_bits(size, APFS_REC_CACHE_MAX_SIZE);
+	bits = min(max_bits, READ_ONCE(cache->bits));
+	if (!READ_ONCE(cache->entries))
+		bits = min_t(unsigned int, max_bits, APFS_CACHE_MIN_BITS);
+	new = kvcalloc(1UL << bits, sizeof(*new), GFP_KERNEL | __GFP_ACCOUNT);
+	if (!new)
+		return -ENOMEM;
 
-	if ((*query)->flags & APFS_QUERY_MULTIPLE) {
-		/*
-		 * We are looking for multiple entries, so we must remember
-		 * the parent node and index to continue the search later.
-		 */
-		*query = apfs_alloc_query(node, *query);
-		apfs_node_put(node);
-	} else {
-		/* Reuse the same query structure to search the child */
-		apfs_node_put((*query)->node);
-		(*query)->node = node;
-		(*query)->index = node->records;
-		(*query)->depth++;
+	spin_lock(&cache->lock);
+	cache->max_bits = max_bits;
+	if (cache->entries && cache->bits <= max_bits) {
+		/* The table may stay, it will grow with use if needed */
+		spin_unlock(&cache->lock);
+		kvfree(new);
+		return 0;
 	}
-	goto next_node;
+	old = cache->entries;
+	for (i = 0; old && i < 1UL << cache->bits; i++) {
+		u64 hash;
+
+		if (!old[i].type)
+			continue;
+		hash = apfs_rec_cache_hash(old[i].id, old[i].type,
+					   old[i].number, old[i].name_hash);
+		new[hash_64(hash, bits)] = old[i];
+	}
+	cache->entries = new;
+	cache->bits = bits;
+	cache->fill = 0;
+	spin_unlock(&cache->lock);
+	kvfree(old);
+	return 0;
+}
+
+/**
+ * apfs_rec_cache_insert - Remember where a query found its record
+ * @sb:		filesystem superblock
+ * @query:	the query, after a successful search
+ */
+static void apfs_rec_cache_insert(struct super_block *sb,
+				  struct apfs_query *query)
+{
+	struct apfs_rec_cache *cache = &APFS_SB(sb)->s_meta_cache->rec;
+	struct apfs_rec_cache_entry *entry;
+	struct apfs_key *key = query->key;
+	u32 name_hash;
+	bool grow;
+
+	if (!cache->entries || query->index > U16_MAX)
+		return;
+	name_hash = apfs_rec_cache_name_hash(key);
+	spin_lock(&cache->lock);
+	entry = apfs_rec_cache_slot(cache, key, name_hash);
+	entry->id = key->id;
+	entry->number = key->number;
+	entry->name_hash = name_hash;
+	entry->type = key->type;
+	entry->index = query->index;
+	entry->bno = query->node->object.block_nr;
+	grow = cache->bits < cache->max_bits &&
+	       ++cache->fill > (1U << cache->bits);
+	spin_unlock(&cache->lock);
+
+	if (grow && !(query->flags & APFS_QUERY_NOWAIT))
+		apfs_rec_cache_grow(cache);
+}
+
+/**
+ * apfs_finger_wanted - Check if a query may start from the catalog finger
+ * @sb:		filesystem superblock
+ * @query:	the query, not yet executed
+ *
+ * Multiple queries need the whole path from the root, so only the queries
+ * for a single catalog record can use the finger.
+ */
+static bool apfs_finger_wanted(struct super_block *sb,
+			       struct apfs_query *query)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+
+	if ((query->flags & APFS_QUERY_TREE_MASK) != APFS_QUERY_CAT)
+		return false;
+	if (query->flags & (APFS_QUERY_MULTIPLE | APFS_QUERY_ANY_ID |
+			    APFS_QUERY_NEXT))
+		return false;
+	return query->depth == 0 && query->node == sbi->s_cat_root;
+}
+
+/**
+ * apfs_finger_set - Remember the last catalog leaf reached from the root
+ * @sb:		filesystem superblock
+ * @parent:	parent of the leaf
+ * @index:	index of the leaf in @parent
+ * @leaf:	the leaf
+ */
+static void apfs_finger_set(struct super_block *sb, struct apfs_node *parent,
+			    int index, struct apfs_node *leaf)
+{
+	struct apfs_cat_finger *finger = &APFS_SB(sb)->s_meta_cache->rec.finger;
+
+	spin_lock(&finger->lock);
+	finger->leaf = leaf->object.block_nr;
+	finger->parent = parent->object.block_nr;
+	finger->index = index;
+	spin_unlock(&finger->lock);
+}
+
+/**
+ * apfs_finger_locate - Compare the key of a query with the records of a leaf
+ * @sb:		filesystem superblock
+ * @query:	the query, not yet executed
+ * @leaf:	the leaf
+ * @pos:	on return, -1 if the key comes before the first record, 1 if it
+ *		comes after the last one, and 0 if it's in between
+ *
+ * Returns 0 on success, or a negative error code in case of corruption.
+ */
+static int apfs_finger_locate(struct super_block *sb, struct apfs_query *query,
+			      struct apfs_node *leaf, int *pos)
+{
+	struct apfs_query leaf_query = *query;
+	struct apfs_key curr_key;
+	int err;
+
+	leaf_query.node = leaf;
+	leaf_query.index = 0;
+	err = apfs_node_read_record(&leaf_query, &curr_key);
+	if (err)
+		return err;
+	if (apfs_keycmp(sb, &curr_key, query->key) > 0) {
+		*pos = -1;
+		return 0;
+	}
+
+	leaf_query.index = leaf->records - 1;
+	err = apfs_node_read_record(&leaf_query, &curr_key);
+	if (err)
+		return err;
+	*pos = apfs_keycmp(sb, &curr_key, query->key) < 0 ? 1 : 0;
+	return 0;
+}
+
+/**
+ * apfs_finger_next_leaf - Read the leaf that follows the catalog finger
+ * @sb:		filesystem superblock
+ * @query:	the query, not yet executed
+ * @parent:	block number of the parent of the finger
+ * @index:	index of the wanted leaf in the parent
+ *
+ * Returns the leaf with a reference taken, or NULL if it's not under the same
+ * parent, or can't be read.
+ */
+static struct apfs_node *apfs_finger_next_leaf(struct super_block *sb,
+					       struct apfs_query *query,
+					       u64 parent, int index)
+{
+	struct apfs_query parent_query = *query;
+	struct apfs_node *node;
+
+	node = apfs_query_get_node(sb, query->flags, parent);
+	if (IS_ERR(node))
+		return NULL;
+	if (apfs_node_is_leaf(node) || index >= node->records) {
+		apfs_node_put(node);
+		return NULL;
+	}
+	parent_query.node = node;
+	parent_query.index = index;
+	node = apfs_query_read_child(sb, &parent_query);
+	apfs_node_put(parent_query.node);
+	if (IS_ERR(node))
+		return NULL;
+	if (!apfs_node_is_leaf(node) || !node->records) {
+		apfs_node_put(node);
+		return NULL;
+	}
+	return node;
+}
+
+/**
+ * apfs_finger_lookup - Search for the record of a query near the last leaf
+ * @sb:		filesystem superblock
+ * @query:	the query, not yet executed
+ * @err:	on return, the result of the search
+ *
+ * Scans often ask for records in increasing key order, for example the inodes
+ * of consecutive cnids, or the extents of a file.  A key that falls between
+ * the first and last records of the last leaf visited gets searched right
+ * there.  A key past the last record gets a look at the next leaf under the
+ * same parent; if the key comes before the first record of that leaf, it must
+ * belong to the last one after all.  Everything else needs a descent.
+ *
+ * Returns true if the search was done, with @query set the same as
+ * apfs_btree_descend() would, and @err set to its return value.
+ */
+static bool apfs_finger_lookup(struct super_block *sb,
+			       struct apfs_query *query, int *err)
+{
+	struct apfs_cat_finger *finger = &APFS_SB(sb)->s_meta_cache->rec.finger;
+	struct apfs_query leaf_query;
+	struct apfs_node *node, *next;
+	u64 leaf, parent;
+	int index, pos;
+
+	spin_lock(&finger->lock);
+	leaf = finger->leaf;
+	parent = finger->parent;
+	index = finger->index;
+	spin_unlock(&finger->lock);
+	if (!leaf)
+		return false;
+
+	node = apfs_query_get_node(sb, query->flags, leaf);
+	if (IS_ERR(node))
+		return false;
+	if (!apfs_node_is_leaf(node))
+		goto miss;
+	if (apfs_finger_locate(sb, query, node, &pos) || pos < 0)
+		goto miss;
+
+	if (pos > 0) {
+		next = apfs_finger_next_leaf(sb, query, parent, index + 1);
+		if (!next)
+			goto miss;
+		if (apfs_finger_locate(sb, query, next, &pos) || pos > 0) {
+			apfs_node_put(next);
+			goto miss;
+		}
+		if (pos < 0) {
+			/* The key is in the gap between the two leaves */
+			apfs_node_put(next);
+		} else {
+			apfs_node_put(node);
+			node = next;
+			++index;
+			spin_lock(&finger->lock);
+			finger->leaf = node->object.block_nr;
+			finger->parent = parent;
+			finger->index = index;
+			spin_unlock(&finger->lock);
+		}
+	}
+
+	leaf_query = *query;
+	leaf_query.node = node;
+	leaf_query.index = node->records;
+	*err = apfs_node_query(sb, &leaf_query);
+	if (*err && *err != -ENODATA)
+		goto miss;
+
+	/* Drop the root, the query now holds the leaf reference */
+	apfs_node_put(query->node);
+	*query = leaf_query;
+	return true;
+
+miss:
+	apfs_node_put(node);
+	return false;
+}
+
+/**
+ * apfs_init_query - Initialize a query structure
+ * @query:	query to initialize
+ * @node:	root of the b-tree to be searched
+ *
+ * Callers should set the @query->key and @query->flags fields themselves
+ * after this.  The query takes its own reference to @node; it must be
+ * released with apfs_free_query() after use.
+ */
+void apfs_init_query(struct apfs_query *query, struct apfs_node *node)
+{
+	/* To be released by free_query. */
+	apfs_node_get(node);
+	query->node = node;
+	query->key = NULL;
+	query->end = NULL;
+	query->flags = 0;
+	/* Start the search with the last record and go backwards */
+	query->index = node->records;
+	query->depth = 0;
+}
+
+/**
+ * apfs_free_query - Release the nodes held by a query structure
+ * @sb:		filesystem superblock
+ * @query:	query to release
+ *
+ * Also releases the ancestor nodes, if they are kept.
+ */
+void apfs_free_query(struct super_block *sb, struct apfs_query *query)
+{
+	int i;
+
+	apfs_node_put(query->node);
+	for (i = 0; i < query->depth; ++i) {
+		if (query->path[i].node)
+			apfs_node_put(query->path[i].node);
+	}
+}
+
+/**
+ * apfs_query_push - Move a query down to a child node
+ * @query:	the query
+ * @node:	child node; the query takes over the caller's reference
+ * @keep:	remember the parent node?
+ *
+ * Multiple queries and iterators remember the parent node and index so that
+ * they can continue the search later; other queries just drop the parent.
+ */
+static void apfs_query_push(struct apfs_query *query, struct apfs_node *node,
+			    bool keep)
+{
+	struct apfs_query_level *level = &query->path[query->depth];
+
+	if (keep) {
+		level->node = query->node;
+		level->index = query->index;
+		level->flags = query->flags;
+		query->flags &= ~(APFS_QUERY_DONE | APFS_QUERY_NEXT);
+	} else {
+		apfs_node_put(query->node);
+		level->node = NULL;
+	}
+
+	query->node = node;
+	query->index = node->records;
+	query->depth++;
+}
+
+/**
+ * apfs_query_pop - Move a multiple query back up to the parent node
+ * @query:	the query
+ *
+ * Returns false if there is no parent to go back to.
+ */
+static bool apfs_query_pop(struct apfs_query *query)
+{
+	struct apfs_query_level *level;
+
+	if (!query->depth)
+		return false;
+	level = &query->path[query->depth - 1];
+	if (!level->node)
+		return false;
+
+	apfs_node_put(query->node);
+	query->node = level->node;
+	query->index = level->index;
+	query->flags = level->flags;
+	level->node = NULL;
+	query->depth--;
+	return true;
+}
+
+/*
+ * Child of an index node, in the list sorted by object id for the omap scan
+ */
+struct apfs_child_oid {
+	u64 oid;
+	int index;
+};
+
+static int apfs_child_oid_cmp(const void *a, const void *b)
+{
+	const struct apfs_child_oid *ca = a, *cb = b;
+
+	if (ca->oid < cb->oid)
+		return -1;
+	return ca->oid > cb->oid;
+}
+
+/**
+ * apfs_node_map_children - Translate the ids of all children of an index node
+ * @sb:		filesystem superblock
+ * @node:	index node of the catalog
+ *
+ * Siblings tend to have ids close to each other, so they are all translated
+ * with a single scan of the range of the object map that covers them, rather
+ * than a query for each.  The scan gives up after APFS_CHILD_MAP_SCAN records
+ * per child, in case the ids are far apart; the children it misses are left
+ * at zero, to be looked up one by one.  So is the child it stopped at, since
+ * its newest version may not have been reached.  Returns the table of block
+ * numbers, or NULL if it couldn't be built.  The children of a node never
+ * change, so the first table to be published is shared by all later queries.
+ */
+static u64 *apfs_node_map_children(struct super_block *sb,
+				   struct apfs_node *node)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_query query = { .node = node, .flags = APFS_QUERY_CAT };
+	struct apfs_key start, end, key;
+	struct apfs_child_oid *oids;
+	u64 *children, *old;
+	int nr = node->records;
+	int budget = nr * APFS_CHILD_MAP_SCAN;
+	int i, j, err;
+
+	oids = kvmalloc_array(nr, sizeof(*oids), GFP_KERNEL);
+	children = kvcalloc(nr, sizeof(*children), GFP_KERNEL | __GFP_ACCOUNT);
+	if (!oids || !children)
+		goto fail;
+
+	for (i = 0; i < nr; i++) {
+		query.index = i;
+		if (apfs_node_read_record(&query, NULL /* key */) ||
+		    apfs_child_from_query(&query, &oids[i].oid))
+			goto fail; /* Leave the error reports to the queries */
+		oids[i].index = i;
+	}
+	sort(oids, nr, sizeof(*oids), apfs_child_oid_cmp, NULL);
+
+	apfs_init_omap_key(oids[0].oid, 0 /* xid */, &start);
+	apfs_init_omap_key(oids[nr - 1].oid + 1, 0 /* xid */, &end);
+	apfs_btree_iter_range(&query, sbi->s_omap_root, &start, &end,
+			      APFS_QUERY_OMAP);
+	err = apfs_btree_iter_seek(sb, &query);
+	for (j = 0; !err && budget--; err = apfs_btree_iter_next(sb, &query)) {
+		u64 bno;
+
+		if (apfs_node_read_record(&query, &key))
+			break;
+		while (j < nr && oids[j].oid < key.id)
+			j++;
+		if (j == nr)
+			break;
+		/* The xids come in order, so the last one in range wins */
+		if (key.number > sbi->s_xid)
+			continue;
+		if (apfs_bno_from_query(&query, &bno))
+			continue;
+		for (i = j; i < nr && oids[i].oid == key.id; i++)
+			children[oids[i].index] = bno;
+	}
+	if (err != -ENODATA && j < nr) {
+		/* Stopped early, maybe short of the last xid of this id */
+		for (i = j; i < nr && oids[i].oid == oids[j].oid; i++)
+			children[oids[i].index] = 0;
+	}
+	apfs_free_query(sb, &query);
+	kvfree(oids);
+
+	old = cmpxchg(&node->children, NULL, children);
+	if (old) { /* Someone else got there first */
+		kvfree(children);
+		return old;
+	}
+	return children;
+
+fail:
+	set_bit(APFS_NODE_NO_MAP, &node->state);
+	kvfree(children);
+	kvfree(oids);
+	return NULL;
+}
+
+/**
+ * apfs_child_block - Find the block number of a child of an index node
+ * @sb:		filesystem superblock
+ * @query:	query positioned on a record of an index node
+ * @child_id:	object id of the child
+ * @child_blk:	on return, the block number of the child
+ * @siblings:	will the siblings of the child be needed soon?
+ *
+ * The nodes of the physical trees are their own block numbers.  For virtual
+ * trees like the catalog, the table of children of the node is tried before
+ * the omap; it gets built once the node is hot, or right away if
+ * the caller is about to visit the siblings.  Returns 0 on success, or a
+ * negative error code in case of failure.
+ */
+static int apfs_child_block(struct super_block *sb, struct apfs_query *query,
+			    u64 child_id, u64 *child_blk, bool siblings)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_node *node = query->node;
+	unsigned int flags = query->flags;
+	u64 *children;
+
+	if (!apfs_tree_desc(flags)->virtual) {
+		*child_blk = child_id;
+		return 0;
+	}
+
+	children = smp_load_acquire(&node->children);
+	if (!children && !(flags & APFS_QUERY_NOWAIT) && node->records > 1 &&
+	    !test_bit(APFS_NODE_NO_MAP, &node->state) &&
+	    (siblings || test_bit(APFS_NODE_HOT, &node->state)))
+		children = apfs_node_map_children(sb, node);
+	if (children && children[query->index]) {
+		apfs_stat_inc(sb, APFS_STAT_CHILD_MAP_HITS);
+		*child_blk = children[query->index];
+		return 0;
+	}
+
+	/*
+	 * we are always performing lookup from omap root. Might
+	 * need improvement in the future.
+	 */
+	return apfs_omap_lookup(sb, sbi->s_omap_root, child_id, child_blk,
+				flags & APFS_QUERY_NOWAIT);
+}
+
+/**
+ * apfs_query_child_block - Find the child block for the current index record
+ * @sb:		filesystem superblock
+ * @query:	query positioned on a record of an index node
+ * @child_id:	on return, the object id of the child
+ * @child_blk:	on return, the block number of the child
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+int apfs_query_child_block(struct super_block *sb, struct apfs_query *query,
+			   u64 *child_id, u64 *child_blk)
+{
+	int err;
+
+	err = apfs_child_from_query(query, child_id);
+	if (err) {
+		apfs_alert(sb, "bad index block: 0x%llx",
+			   query->node->object.block_nr);
+		return err;
+	}
+
+	return apfs_child_block(sb, query, *child_id, child_blk,
+				false /* siblings */);
+}
+
+/**
+ * apfs_query_read_child - Read the child node for the current index record
+ * @sb:		filesystem superblock
+ * @query:	query positioned on a record of an index node
+ *
+ * Returns the child node with a reference taken, or an error pointer in case
+ * of failure.
+ */
+struct apfs_node *apfs_query_read_child(struct super_block *sb,
+					struct apfs_query *query)
+{
+	struct apfs_node *node;
+	u64 child_id, child_blk;
+	int err;
+
+	err = apfs_query_child_block(sb, query, &child_id, &child_blk);
+	if (err)
+		return ERR_PTR(err);
+
+	/* Now go a level deeper and search the child */
+	node = apfs_query_get_node(sb, query->flags, child_blk);
+	if (IS_ERR(node))
+		return node;
+
+	if (node->object.oid != child_id)
+		apfs_debug(sb, "corrupt b-tree");
+	return node;
+}
+
+/**
+ * apfs_btree_descend - Search a b-tree for the record of a query
+ * @sb:		filesystem superblock
+ * @query:	the query to execute
+ * @finger:	update the catalog finger with the leaf reached?
+ *
+ * Same as apfs_btree_query(), but without the record cache.
+ */
+static int apfs_btree_descend(struct super_block *sb, struct apfs_query *query,
+			      bool finger)
+{
+	struct apfs_node *node;
+	unsigned int depth = query->depth;
+	int err;
+
+	apfs_stat_inc(sb, APFS_STAT_DESCENTS);
+next_node:
+	if (query->depth >= APFS_BTREE_MAX_DEPTH) {
+		apfs_alert(sb, "b-tree is corrupted");
+		return -EFSCORRUPTED;
+	}
+
+	err = apfs_node_query(sb, query);
+	if (err == -EAGAIN) {
+		/* Move back up one level and continue the query */
+		if (!apfs_query_pop(query)) /* We are at the root of the tree */
+			return -ENODATA;
+		goto next_node;
+	}
+	if (err)
+		return err;
+	if (apfs_node_is_leaf(query->node)) { /* All done */
+		if (query->depth > depth)
+			apfs_stat_add(sb, APFS_STAT_DESCENT_LEVELS,
+				      query->depth - depth);
+		return 0;
+	}
+
+	node = apfs_query_read_child(sb, query);
+	if (IS_ERR(node))
+		return PTR_ERR(node);
+	if (finger && apfs_node_is_leaf(node))
+		apfs_finger_set(sb, query->node, query->index, node);
+
+	apfs_query_push(query, node, query->flags & APFS_QUERY_MULTIPLE);
+	goto next_node;
+}
+
+/**
+ * apfs_btree_descend_physical - Search a physical b-tree for a query
+ * @sb:		filesystem superblock
+ * @query:	the query to execute
+ *
+ * Same as apfs_btree_descend(), for the trees whose child ids are block
+ * numbers: there is nothing to translate and no finger to update, so each
+ * step down is just a read of the child node.
+ */
+static int apfs_btree_descend_physical(struct super_block *sb,
+				       struct apfs_query *query)
+{
+	struct apfs_node *node;
+	unsigned int depth = query->depth;
+	u64 child;
+	int err;
+
+	apfs_stat_inc(sb, APFS_STAT_DESCENTS);
+	while (1) {
+		if (query->depth >= APFS_BTREE_MAX_DEPTH) {
+			apfs_alert(sb, "b-tree is corrupted");
+			return -EFSCORRUPTED;
+		}
+
+		err = apfs_node_query(sb, query);
+		if (err == -EAGAIN) {
+			/* Move back up one level and continue the query */
+			if (!apfs_query_pop(query))
+				return -ENODATA;
+			continue;
+		}
+		if (err)
+			return err;
+		if (apfs_node_is_leaf(query->node))
+			break;
+
+		err = apfs_child_from_query(query, &child);
+		if (err) {
+			apfs_alert(sb, "bad index block: 0x%llx",
+				   query->node->object.block_nr);
+			return err;
+		}
+		node = apfs_query_get_node(sb, query->flags, child);
+		if (IS_ERR(node))
+			return PTR_ERR(node);
+		if (node->object.oid != child)
+			apfs_debug(sb, "corrupt b-tree");
+		apfs_query_push(query, node, query->flags & APFS_QUERY_MULTIPLE);
+	}
+
+	if (query->depth > depth)
+		apfs_stat_add(sb, APFS_STAT_DESCENT_LEVELS,
+			      query->depth - depth);
+	return 0;
+}
+
+/**
+ * apfs_btree_query_stats - Count a new query in the performance counters
+ * @sb:		filesystem superblock
+ * @query:	the query, not yet executed
+ */
+static void apfs_btree_query_stats(struct super_block *sb,
+				   struct apfs_query *query)
+{
+	switch (query->flags & APFS_QUERY_TREE_MASK) {
+	case APFS_QUERY_OMAP:
+		apfs_stat_inc(sb, APFS_STAT_QUERY_OMAP);
+		break;
+	case APFS_QUERY_CAT:
+		apfs_stat_inc(sb, APFS_STAT_QUERY_CAT);
+		break;
+	default:
+		apfs_stat_inc(sb, APFS_STAT_QUERY_OTHER);
+		break;
+	}
+	if (query->flags & APFS_QUERY_MULTIPLE)
+		apfs_stat_inc(sb, APFS_STAT_QUERY_MULTIPLE);
+	else if (query->flags & APFS_QUERY_EXACT)
+		apfs_stat_inc(sb, APFS_STAT_QUERY_EXACT);
+}
+
+#ifdef CONFIG_APFS_DEBUG
+/**
+ * apfs_btree_query_latency - Count a query in the latency histograms
+ * @sb:		filesystem superblock
+ * @flags:	flags of the query, before it was executed
+ * @start:	start time of the query
+ */
+static void apfs_btree_query_latency(struct super_block *sb,
+				     unsigned int flags, u64 start)
+{
+	enum apfs_lat_item item;
+
+	switch (flags & APFS_QUERY_TREE_MASK) {
+	case APFS_QUERY_OMAP:
+		item = APFS_LAT_OMAP_EXACT;
+		break;
+	case APFS_QUERY_CAT:
+		item = APFS_LAT_CAT_EXACT;
+		break;
+	default:
+		return;
+	}
+	/* The histograms for each tree are in the same order */
+	if (flags & APFS_QUERY_NEXT)
+		item += APFS_LAT_OMAP_NEXT - APFS_LAT_OMAP_EXACT;
+	else if (flags & APFS_QUERY_MULTIPLE)
+		item += APFS_LAT_OMAP_MULTIPLE - APFS_LAT_OMAP_EXACT;
+	apfs_lat_end(sb, item, start);
+}
+#else
+#define apfs_btree_query_latency(sb, flags, start)	\
+	do { (void)(flags); (void)(start); } while (0)
+#endif
+
+/**
+ * apfs_btree_query - Execute a query on a b-tree
+ * @sb:		filesystem superblock
+ * @query:	the query to execute
+ *
+ * Searches the b-tree starting at @query->index in @query->node, looking for
+ * the record corresponding to @query->key.  Exact catalog queries check the
+ * record cache and the external catalog index first, and other single catalog
+ * queries try to start from the last leaf reached.  Physical trees take a
+ * simpler loop, with no omap translation.
+ *
+ * Returns 0 in case of success and sets the @query->len, @query->off and
+ * @query->index fields to the results of the query. @query->node will now
+ * point to the leaf node holding the record.
+ *
+ * In case of failure returns an appropriate error code.
+ */
+int apfs_btree_query(struct super_block *sb, struct apfs_query *query)
+{
+	bool cacheable = apfs_rec_cache_wanted(sb, query);
+	bool finger = apfs_finger_wanted(sb, query);
+	unsigned int flags = query->flags;
+	u64 lat = apfs_lat_start();
+	int err;
+
+	apfs_btree_query_stats(sb, query);
+	if (cacheable && apfs_rec_cache_lookup(sb, query)) {
+		apfs_stat_inc(sb, APFS_STAT_REC_CACHE_HITS);
+		err = 0;
+		goto out;
+	}
+	if (cacheable && apfs_catidx_lookup(sb, query)) {
+		apfs_stat_inc(sb, APFS_STAT_CATIDX_HITS);
+		apfs_rec_cache_insert(sb, query);
+		err = 0;
+		goto out;
+	}
+	if (!apfs_tree_desc(flags)->virtual)
+		err = apfs_btree_descend_physical(sb, query);
+	else if (finger && apfs_finger_lookup(sb, query, &err))
+		apfs_stat_inc(sb, APFS_STAT_FINGER_HITS);
+	else
+		err = apfs_btree_descend(sb, query, finger);
+	if (!err && cacheable)
+		apfs_rec_cache_insert(sb, query);
+out:
+	apfs_btree_query_latency(sb, flags, lat);
+	trace_apfs_btree_query(sb, query->flags, query->depth, err);
+	return err;
+}
+
+/**
+ * apfs_batch_climb - Move a batch query up to the lowest node that covers a key
+ * @sb:		filesystem superblock
+ * @query:	the batch query, left where the previous key was searched
+ * @key:	the next key, not before the previous one
+ *
+ * The range of a node on the path ends right before the following record of
+ * its nearest ancestor that has one, so the query only needs to go back up to
+ * the parent of the first node whose range ends before @key.  Returns 0 on
+ * success, or a negative error code in case of corruption.
+ */
+static int apfs_batch_climb(struct super_block *sb, struct apfs_query *query,
+			    struct apfs_key *key)
+{
+	struct apfs_node *node = query->node;
+	int index = query->index;
+	int target = query->depth;
+	int d, err = 0;
+
+	for (d = query->depth - 1; d >= 0; d--) {
+		struct apfs_query_level *level = &query->path[d];
+		struct apfs_key bound;
+
+		if (level->index + 1 >= level->node->records)
+			continue;
+		query->node = level->node;
+		query->index = level->index + 1;
+		err = apfs_node_read_record(query, &bound);
+		if (err)
+			break;
+		if (apfs_tree_keycmp(sb, query->flags, &bound, key) > 0)
+			break;
+		target = d;
+	}
+	query->node = node;
+	query->index = index;
+	if (err)
+		return err;
+
+	while (query->depth > target)
+		apfs_query_pop(query);
+	return 0;
+}
+
+/**
+ * apfs_btree_ra_init - Set up the readahead feedback for a new mount
+ * @sb:	filesystem superblock
+ */
+void apfs_btree_ra_init(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_btree_ra *ra = &sbi->s_btree_ra;
+
+	memset(ra->blocks, 0, sizeof(ra->blocks));
+	/* Devices with a high latency need a deeper queue to keep busy */
+	ra->max_depth = sbi->s_queue_depth ?: APFS_BTREE_RA_MAX;
+	atomic_set(&ra->depth, min(APFS_BTREE_READAHEAD, ra->max_depth));
+	atomic_set(&ra->issued, 0);
+	atomic_set(&ra->used, 0);
+	atomic64_set(&ra->total_issued, 0);
+	atomic64_set(&ra->total_used, 0);
+}
+
+static inline int apfs_btree_ra_depth(struct super_block *sb)
+{
+	return atomic_read(&APFS_SB(sb)->s_btree_ra.depth);
+}
+
+/**
+ * apfs_btree_ra_adjust - Set the readahead depth for the next window
+ * @ra:	readahead feedback of the mount
+ *
+ * A scan uses most of the nodes read ahead, so the depth doubles if three
+ * quarters of them were used; random lookups waste most, so it halves if not
+ * even a quarter were.
+ */
+static void apfs_btree_ra_adjust(struct apfs_btree_ra *ra)
+{
+	int used = atomic_xchg(&ra->used, 0);
+	int depth = atomic_read(&ra->depth);
+
+	atomic_sub(APFS_BTREE_RA_WINDOW, &ra->issued);
+	if (used * 4 >= APFS_BTREE_RA_WINDOW * 3)
+		depth = min(depth * 2, ra->max_depth);
+	else if (used * 4 < APFS_BTREE_RA_WINDOW)
+		depth = max(depth / 2, APFS_BTREE_RA_MIN);
+	atomic_set(&ra->depth, depth);
+}
+
+/**
+ * apfs_btree_ra_issue - Read ahead a node for an iterator or a batch query
+ * @sb:		filesystem superblock
+ * @bno:	block number of the node
+ *
+ * Nodes already in the cache are skipped.  The others are remembered, so that
+ * apfs_btree_ra_used() can tell if they were worth the read.
+ */
+static void apfs_btree_ra_issue(struct super_block *sb, u64 bno)
+{
+	struct apfs_btree_ra *ra = &APFS_SB(sb)->s_btree_ra;
+
+	if (apfs_node_is_cached(sb, bno))
+		return;
+	apfs_spec_readahead(sb, bno);
+	WRITE_ONCE(ra->blocks[hash_64(bno, APFS_BTREE_RA_BITS)], bno);
+	atomic64_inc(&ra->total_issued);
+	if (atomic_inc_return(&ra->issued) == APFS_BTREE_RA_WINDOW)
+		apfs_btree_ra_adjust(ra);
+}
+
+/**
+ * apfs_btree_ra_used - Report that a node is being parsed from disk
+ * @sb:		filesystem superblock
+ * @bno:	block number of the node
+ *
+ * Called by apfs_read_node() on every miss of the node cache, to count the
+ * hits of the readahead.
+ */
+void apfs_btree_ra_used(struct super_block *sb, u64 bno)
+{
+	struct apfs_btree_ra *ra = &APFS_SB(sb)->s_btree_ra;
+	unsigned long *slot = &ra->blocks[hash_64(bno, APFS_BTREE_RA_BITS)];
+
+	/* Block zero is never a node, so it marks the empty slots */
+	if (READ_ONCE(*slot) != (unsigned long)bno ||
+	    cmpxchg(slot, (unsigned long)bno, 0) != (unsigned long)bno)
+		return;
+	atomic_inc(&ra->used);
+	atomic64_inc(&ra->total_used);
+}
+
+/**
+ * apfs_batch_readahead - Start reading the children needed by later keys
+ * @sb:		filesystem superblock
+ * @query:	the batch query, positioned on a record of an index node
+ * @keys:	all the keys of the batch
+ * @curr:	index in @keys of the key being searched
+ * @nr:		number of keys
+ *
+ * Issues non-blocking reads for the children of the node that the following
+ * keys will descend into, up to the readahead depth, so that they
+ * are on their way before the walk blocks on the current child.  These reads
+ * are not speculative, so with the queuedepth mount option they go as deep as
+ * it says, regardless of how the readahead has been doing.  This is only a
+ * hint; the position of @query is left as it was.
+ */
+static void apfs_batch_readahead(struct super_block *sb,
+				 struct apfs_query *query,
+				 struct apfs_key *keys, int curr, int nr)
+{
+	struct apfs_key *key = query->key;
+	int index = query->index;
+	int key_off = query->key_off, key_len = query->key_len;
+	int off = query->off, len = query->len;
+	int last = index, count = 0, i;
+	int depth = APFS_SB(sb)->s_queue_depth ?: apfs_btree_ra_depth(sb);
+	struct blk_plug plug;
+	u64 child_id, child_blk;
+
+	blk_start_plug(&plug);
+	for (i = curr + 1; i < nr && count < depth; i++) {
+		/* The keys are sorted, so their children come in order too */
+		if (last == query->node->records - 1)
+			break;
+		query->key = &keys[i];
+		query->index = query->node->records;
+		if (apfs_node_query(sb, query))
+			break;
+		if (query->index == last)
+			continue;
+		last = query->index;
+		if (apfs_child_from_query(query, &child_id))
+			break;
+		if (apfs_child_block(sb, query, child_id, &child_blk,
+				     true /* siblings */))
+			break;
+		apfs_btree_ra_issue(sb, child_blk);
+		count++;
+	}
+	blk_finish_plug(&plug);
+
+	query->key = key;
+	query->index = index;
+	query->key_off = key_off;
+	query->key_len = key_len;
+	query->off = off;
+	query->len = len;
+}
+
+/**
+ * apfs_batch_descend - Search for one key of a batch below the current node
+ * @sb:		filesystem superblock
+ * @query:	the batch query, on a node whose range covers the key
+ * @keys:	all the keys of the batch
+ * @curr:	index in @keys of the key to search
+ * @nr:		number of keys
+ *
+ * The whole path is kept, for the keys that follow.  Returns 0 on success,
+ * -ENODATA if the record doesn't exist, or another negative error code in
+ * case of failure.
+ */
+static int apfs_batch_descend(struct super_block *sb, struct apfs_query *query,
+			      struct apfs_key *keys, int curr, int nr)
+{
+	struct apfs_node *node;
+	int err;
+
+	query->key = &keys[curr];
+	while (1) {
+		if (query->depth >= APFS_BTREE_MAX_DEPTH) {
+			apfs_alert(sb, "b-tree is corrupted");
+			return -EFSCORRUPTED;
+		}
+
+		query->index = query->node->records;
+		err = apfs_node_query(sb, query);
+		if (err)
+			return err;
+		if (apfs_node_is_leaf(query->node))
+			return 0;
+
+		apfs_batch_readahead(sb, query, keys, curr, nr);
+		node = apfs_query_read_child(sb, query);
+		if (IS_ERR(node))
+			return PTR_ERR(node);
+		apfs_query_push(query, node, true /* keep */);
+	}
+}
+
+/**
+ * apfs_btree_query_batch - Search a b-tree for many exact records in one walk
+ * @sb:		filesystem superblock
+ * @root:	root of the b-tree
+ * @keys:	keys of the records, sorted in the order of apfs_keycmp()
+ * @nr:		number of keys
+ * @flags:	tree type
+ * @actor:	called for each record found, with the query positioned on it
+ * @data:	passed to @actor, along with the index of the key
+ *
+ * Neighbouring keys usually share most of the path from the root, so after
+ * each record the walk only goes back up as far as needed to reach the next
+ * key, without a new descent.  Keys with no record are skipped.  @actor may
+ * move @query->index inside the leaf, but must leave the rest of the query
+ * alone.  Returns 0 on success, the first nonzero value returned by @actor,
+ * or a negative error code in case of failure.
+ */
+int apfs_btree_query_batch(struct super_block *sb, struct apfs_node *root,
+			   struct apfs_key *keys, int nr, unsigned int flags,
+			   int (*actor)(struct apfs_query *query, int idx,
+					void *data),
+			   void *data)
+{
+	struct apfs_query query;
+	int i, err = 0;
+
+	apfs_init_query(&query, root);
+	query.flags = (flags & APFS_QUERY_TREE_MASK) | APFS_QUERY_EXACT;
+
+	for (i = 0; i < nr; i++) {
+		apfs_btree_query_stats(sb, &query);
+		err = apfs_batch_climb(sb, &query, &keys[i]);
+		if (err)
+			break;
+		err = apfs_batch_descend(sb, &query, keys, i, nr);
+		if (err == -ENODATA) {
+			err = 0;
+			continue;
+		}
+		if (err)
+			break;
+		err = actor(&query, i, data);
+		if (err)
+			break;
+	}
+	apfs_free_query(sb, &query);
+	return err;
+}
+
+/**
+ * apfs_btree_iter_init - Initialize a query for a forward scan of a b-tree
+ * @query:	query structure to initialize
+ * @root:	root of the b-tree
+ * @key:	key for the records to return
+ * @flags:	tree type, and the key fields to ignore in the comparisons
+ *
+ * Unlike apfs_btree_query(), an iterator keeps the whole root-to-leaf path
+ * and visits the records in key order, going from one leaf to the next
+ * without searching the tree again.  It should be released with
+ * apfs_free_query() after use.
+ */
+void apfs_btree_iter_init(struct apfs_query *query, struct apfs_node *root,
+			  struct apfs_key *key, unsigned int flags)
+{
+	apfs_init_query(query, root);
+	query->key = key;
+	query->flags = flags;
+}
+
+/**
+ * apfs_btree_iter_range - Initialize a query for a scan of a range of keys
+ * @query:	query structure to initialize
+ * @root:	root of the b-tree
+ * @start:	first key of the range
+ * @end:	first key past the range
+ * @flags:	tree type
+ *
+ * The iterator returns every record from @start up to, but not including,
+ * @end.  The scan stops at the last record in range without going into the
+ * next leaf, and then sets APFS_QUERY_AT_END in @query->flags, so callers can
+ * tell it apart from the end of the tree.
+ */
+void apfs_btree_iter_range(struct apfs_query *query, struct apfs_node *root,
+			   struct apfs_key *start, struct apfs_key *end,
+			   unsigned int flags)
+{
+	apfs_btree_iter_init(query, root, start, flags | APFS_QUERY_ANY_ID);
+	query->end = end;
+}
+
+/**
+ * apfs_btree_iter_match - Check if a key is a match for an iterator
+ * @sb:		filesystem superblock
+ * @query:	the iterator
+ * @key:	key of a record, or of an index entry, not before the start key
+ *
+ * Returns 0 if @key matches, or -ENODATA if it doesn't, in which case no key
+ * that follows will match either.  With APFS_QUERY_ANY_ID, every key that
+ * doesn't come before the start key matches, up to the end key if any.
+ */
+static int apfs_btree_iter_match(struct super_block *sb,
+				 struct apfs_query *query, struct apfs_key *key)
+{
+	if (query->end &&
+	    apfs_tree_keycmp(sb, query->flags, key, query->end) >= 0) {
+		query->flags |= APFS_QUERY_AT_END;
+		return -ENODATA;
+	}
+	if (query->flags & APFS_QUERY_ANY_ID)
+		return 0;
+	return apfs_tree_keycmp(sb, query->flags, key, query->key) ?
+	       -ENODATA : 0;
+}
+
+/**
+ * apfs_btree_iter_check - Check that the current record matches the key
+ * @sb:		filesystem superblock
+ * @query:	the iterator
+ *
+ * Returns 0 if the record matches, -ENODATA if it doesn't (meaning that the
+ * scan is over), or another negative error code in case of failure.
+ */
+static int apfs_btree_iter_check(struct super_block *sb,
+				 struct apfs_query *query)
+{
+	struct apfs_key curr_key;
+	int err;
+
+	err = apfs_node_read_record(query, &curr_key);
+	if (err)
+		return err;
+
+	if (apfs_tree_keycmp(sb, query->flags, &curr_key, query->key) < 0)
+		return -EFSCORRUPTED; /* Records are out of order */
+	return apfs_btree_iter_match(sb, query, &curr_key);
+}
+
+/**
+ * apfs_btree_iter_readahead - Start reading sibling children of an index node
+ * @sb:		filesystem superblock
+ * @query:	the iterator, positioned on a record of an index node
+ * @first:	offset from @query->index of the first child to read ahead
+ *
+ * An iterator will visit the children that follow @query->index in order, so
+ * issue non-blocking reads for them, up to the readahead depth past the
+ * current one.  This is only a hint: the function gives up quietly on any
+ * error, and the position of @query is left as it was.
+ */
+static void apfs_btree_iter_readahead(struct super_block *sb,
+				      struct apfs_query *query, int first)
+{
+	int index = query->index;
+	int key_off = query->key_off, key_len = query->key_len;
+	int off = query->off, len = query->len;
+	unsigned int flags = query->flags;
+	struct blk_plug plug;
+	int last;
+	u64 child_id, child_blk;
+
+	last = min_t(int, index + apfs_btree_ra_depth(sb),
+		     query->node->records - 1);
+	/* Siblings are often adjacent on disk, let the block layer merge them */
+	blk_start_plug(&plug);
+	for (query->index = index + first; query->index <= last;
+	     query->index++) {
+		struct apfs_key key;
+
+		if (apfs_node_read_record(query, &key))
+			break;
+		/* Children past the end of the scan won't be needed */
+		if (apfs_btree_iter_match(sb, query, &key))
+			break;
+		if (apfs_child_from_query(query, &child_id))
+			break;
+		if (apfs_child_block(sb, query, child_id, &child_blk,
+				     true /* siblings */))
+			break;
+		apfs_btree_ra_issue(sb, child_blk);
+	}
+	blk_finish_plug(&plug);
+
+	query->flags = flags;
+	query->index = index;
+	query->key_off = key_off;
+	query->key_len = key_len;
+	query->off = off;
+	query->len = len;
+}
+
+/**
+ * apfs_btree_iter_next_leaf - Move an iterator to the first record of the
+ *			       next leaf
+ * @sb:		filesystem superblock
+ * @query:	the iterator, past the last record of its leaf node
+ *
+ * Returns 0 on success, -ENODATA if this was the last leaf, or another
+ * negative error code in case of failure.
+ */
+static int apfs_btree_iter_next_leaf(struct super_block *sb,
+				     struct apfs_query *query)
+{
+	struct apfs_node *node;
+	struct apfs_key key;
+	int ra_first, err;
+
+	/* Go up until we find an ancestor with children left to visit */
+	do {
+		if (!apfs_query_pop(query))
+			return -ENODATA;
+		query->index++;
+	} while (query->index >= query->node->records);
+
+	/*
+	 * The index key is the first key of the subtree, so if it doesn't
+	 * match then nothing else will; don't read a leaf just to find out.
+	 */
+	err = apfs_node_read_record(query, &key);
+	if (err)
+		return err;
+	err = apfs_btree_iter_match(sb, query, &key);
+	if (err)
+		return err;
+
+	/*
+	 * The siblings of this child were already requested on earlier visits,
+	 * so just slide the readahead window by one.  If the depth changed in
+	 * between, this leaves a gap or an overlap once, which is harmless.
+	 */
+	ra_first = apfs_btree_ra_depth(sb);
+
+	/* Then go down to the leftmost leaf of the next subtree */
+	while (!apfs_node_is_leaf(query->node)) {
+		if (query->depth >= APFS_BTREE_MAX_DEPTH) {
+			apfs_alert(sb, "b-tree is corrupted");
+			return -EFSCORRUPTED;
+		}
+		err = apfs_node_read_record(query, NULL /* key */);
+		if (err)
+			return err;
+		apfs_btree_iter_readahead(sb, query, ra_first);
+		node = apfs_query_read_child(sb, query);
+		if (IS_ERR(node))
+			return PTR_ERR(node);
+		apfs_query_push(query, node, true /* keep */);
+		query->index = 0;
+		ra_first = 1;
+	}
+	return 0;
+}
+
+/**
+ * apfs_btree_iter_seek - Position an iterator on its first matching record
+ * @sb:		filesystem superblock
+ * @query:	the iterator, as set by apfs_btree_iter_init()
+ *
+ * Returns 0 on success, -ENODATA if no matching record exists, or another
+ * negative error code in case of failure.  On success, the @query->off,
+ * @query->len, @query->key_off and @query->key_len fields locate the record
+ * inside @query->node.
+ */
+int apfs_btree_iter_seek(struct super_block *sb, struct apfs_query *query)
+{
+	struct apfs_node *node;
+	int err;
+
+	while (1) {
+		if (query->depth >= APFS_BTREE_MAX_DEPTH) {
+			apfs_alert(sb, "b-tree is corrupted");
+			return -EFSCORRUPTED;
+		}
+
+		err = apfs_node_seek(sb, query);
+		if (err)
+			return err;
+		if (apfs_node_is_leaf(query->node))
+			break;
+
+		err = apfs_node_read_record(query, NULL /* key */);
+		if (err)
+			return err;
+		apfs_btree_iter_readahead(sb, query, 1 /* first */);
+		node = apfs_query_read_child(sb, query);
+		if (IS_ERR(node))
+			return PTR_ERR(node);
+		apfs_query_push(query, node, true /* keep */);
+	}
+
+	if (query->index >= query->node->records) {
+		/* The first match, if any, starts the next leaf */
+		err = apfs_btree_iter_next_leaf(sb, query);
+		if (err)
+			return err;
+	}
+	return apfs_btree_iter_check(sb, query);
+}
+
+/**
+ * apfs_btree_iter_widen - Change the key of an iterator that is in position
+ * @query:	the iterator, positioned on a record by a previous call
+ * @key:	key for the records to return from now on
+ * @flags:	additional key fields to ignore in the comparisons
+ *
+ * This allows a scan to start at an exact record and then continue through
+ * all the records that follow it under a looser key, without searching the
+ * tree again.
+ */
+void apfs_btree_iter_widen(struct apfs_query *query, struct apfs_key *key,
+			   unsigned int flags)
+{
+	int i;
+
+	query->key = key;
+	query->flags |= flags;
+	/* The flags get restored from the ancestors when moving up the tree */
+	for (i = 0; i < query->depth; ++i)
+		query->path[i].flags |= flags;
+}
+
+/**
+ * apfs_btree_iter_next - Move an iterator to the next matching record
+ * @sb:		filesystem superblock
+ * @query:	the iterator, positioned on a record by a previous call
+ *
+ * Returns 0 on success, -ENODATA if there are no more matching records, or
+ * another negative error code in case of failure.
+ */
+int apfs_btree_iter_next(struct super_block *sb, struct apfs_query *query)
+{
+	int err;
+
+	query->index++;
+	if (query->index >= query->node->records) {
+		err = apfs_btree_iter_next_leaf(sb, query);
+		if (err)
+			return err;
+	}
+	return apfs_btree_iter_check(sb, query);
+}
+
+/**
+ * apfs_btree_pin - Pin the top levels of a b-tree in the node cache
+ * @sb:		filesystem superblock
+ * @root:	root node of the tree, which the caller already holds
+ * @flags:	tree type
+ * @levels:	number of levels to keep in memory, counting the root
+ * @count:	incremented by the number of nodes pinned
+ *
+ * Reads every node in the top @levels of the tree and pins it, so that all
+ * queries will find the upper index nodes in memory.  Leaves are never pinned,
+ * since they would be the whole tree: @levels is in effect clamped to the
+ * index levels of the tree, whatever the mount option says.  Returns 0 on
+ * success, or a negative error code in case of failure; the nodes pinned so
+ * far stay pinned until unmount.
+ */
+int apfs_btree_pin(struct super_block *sb, struct apfs_node *root,
+		   unsigned int flags, unsigned int levels,
+		   unsigned long *count)
+{
+	struct apfs_query query;
+	int err = 0;
+
+	if (levels <= 1 || apfs_node_is_leaf(root))
+		return 0;
+
+	apfs_init_query(&query, root);
+	query.flags = flags;
+	for (query.index = 0; query.index < root->records; query.index++) {
+		struct apfs_node *child;
+
+		err = apfs_node_read_record(&query, NULL /* key */);
+		if (err)
+			break;
+		child = apfs_query_read_child(sb, &query);
+		if (IS_ERR(child)) {
+			err = PTR_ERR(child);
+			break;
+		}
+		if (apfs_node_is_leaf(child)) {
+			/* All the other children are leaves too */
+			apfs_node_put(child);
+			break;
+		}
+		if (apfs_node_pin(child))
+			(*count)++;
+		err = apfs_btree_pin(sb, child, flags, levels - 1, count);
+		apfs_node_put(child);
+		if (err)
+			break;
+	}
+	apfs_free_query(sb, &query);
+	return err;
 }
 
 /**
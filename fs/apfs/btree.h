@@ -8,30 +8,133 @@
 #ifndef _APFS_BTREE_H
 #define _APFS_BTREE_H
 
+#include <linux/list.h>
+#include <linux/spinlock.h>
 #include <linux/types.h>
+#include "key.h"
 
+struct apfs_query;
 struct super_block;
 
 /* Flags for the query structure */
 #define APFS_QUERY_TREE_MASK	0007	/* Which b-tree we query */
 #define APFS_QUERY_OMAP		0001	/* This is a b-tree object map query */
 #define APFS_QUERY_CAT		0002	/* This is a catalog tree query */
+#define APFS_QUERY_SNAP_META	0003	/* This is a snapshot metadata query */
+#define APFS_QUERY_EXTENTREF	0004	/* This is an extent reference query */
+#define APFS_QUERY_FUSION	0005	/* This is a fusion middle tree query */
 #define APFS_QUERY_NEXT		0010	/* Find next of multiple matches */
 #define APFS_QUERY_EXACT	0020	/* Search for an exact match */
 #define APFS_QUERY_DONE		0040	/* The search at this level is over */
 #define APFS_QUERY_ANY_NAME	0100	/* Multiple search for any name */
 #define APFS_QUERY_ANY_NUMBER	0200	/* Multiple search for any number */
 #define APFS_QUERY_MULTIPLE	(APFS_QUERY_ANY_NAME | APFS_QUERY_ANY_NUMBER)
+#define APFS_QUERY_ANY_ID	0400	/* Iterate to the end of the tree */
+#define APFS_QUERY_NOWAIT	01000	/* Only use nodes already in memory */
+#define APFS_QUERY_AT_END	02000	/* A scan stopped at its end key */
+
+/*
+ * We need a maximum depth for the tree so we can't loop forever if the
+ * filesystem is damaged. 12 should be more than enough to map every block.
+ */
+#define APFS_BTREE_MAX_DEPTH	12
+
+/* Maximum number of b-tree levels that can be pinned in memory at mount */
+#define APFS_BTREE_MAX_PIN_LEVELS	4
+
+/*
+ * Number of sibling child nodes to read ahead during a forward scan, at the
+ * start of a mount.  From there the depth changes with the share of the nodes
+ * read ahead that get used, within the given bounds.
+ */
+#define APFS_BTREE_READAHEAD	8
+#define APFS_BTREE_RA_MIN	1
+#define APFS_BTREE_RA_MAX	64
+
+/* Highest value for the queuedepth mount option */
+#define APFS_BTREE_QUEUE_MAX	512
+
+/* Nodes read ahead between adjustments of the depth */
+#define APFS_BTREE_RA_WINDOW	256
+
+/* Log2 of the number of nodes read ahead that are tracked until used */
+#define APFS_BTREE_RA_BITS	9
+
+/*
+ * Most omap records to scan per child when translating all the children of an
+ * index node at once, in case their ids are far apart
+ */
+#define APFS_CHILD_MAP_SCAN	4
+
+/*
+ * Description of a kind of b-tree, selected by the tree bits of the query
+ * flags.  It decides how the nodes are searched and how the children are
+ * found, so that the physical trees never go through the object map.
+ */
+struct apfs_tree_desc {
+	const char *name;
+	bool virtual;		/* Child ids must be translated by the omap */
+	bool fixed_kv;		/* Nodes normally have fixed-size entries */
+	/* Parser for the on-disk keys, or NULL if they can't be decoded */
+	int (*read_key)(void *raw, int size, struct apfs_key *key);
+	/* Order of the keys, or NULL for apfs_keycmp() */
+	int (*keycmp)(struct super_block *sb, struct apfs_key *k1,
+		      struct apfs_key *k2);
+	/* Single-record search for nodes with fixed-size entries, or NULL */
+	int (*node_query)(struct super_block *sb, struct apfs_query *query);
+};
+
+extern const struct apfs_tree_desc apfs_tree_descs[APFS_QUERY_TREE_MASK + 1];
+
+/**
+ * apfs_tree_desc - Get the description of the tree that a query searches
+ * @flags:	flags of the query
+ */
+static inline const struct apfs_tree_desc *apfs_tree_desc(unsigned int flags)
+{
+	return &apfs_tree_descs[flags & APFS_QUERY_TREE_MASK];
+}
+
+/**
+ * apfs_tree_keycmp - Compare two keys in the order of the tree of a query
+ * @sb:		filesystem superblock
+ * @flags:	flags of the query
+ * @k1, @k2:	keys to compare
+ *
+ * The usual comparator is called directly, to keep indirect calls out of the
+ * searches of the common trees.
+ */
+static inline int apfs_tree_keycmp(struct super_block *sb, unsigned int flags,
+				   struct apfs_key *k1, struct apfs_key *k2)
+{
+	const struct apfs_tree_desc *desc = apfs_tree_desc(flags);
+
+	if (!desc->keycmp)
+		return apfs_keycmp(sb, k1, k2);
+	return desc->keycmp(sb, k1, k2);
+}
+
+/*
+ * Position saved for an ancestor of the node being searched by a multiple
+ * query, so that the search can go back up and continue later
+ */
+struct apfs_query_level {
+	struct apfs_node *node;		/* Ancestor node (NULL if not kept) */
+	int index;			/* Index of the entry in the node */
+	unsigned int flags;		/* Query flags for this level */
+};
 
 /*
  * Structure used to retrieve data from an APFS B-Tree. For now only used
- * on the calalog and the object map.
+ * on the calalog and the object map.  The whole root-to-leaf path is kept
+ * inside the structure, so queries can live on the stack and never need to
+ * allocate memory.
  */
 struct apfs_query {
 	struct apfs_node *node;		/* Node being searched */
 	struct apfs_key *key;		/* What the query is looking for */
+	struct apfs_key *end;		/* First key past the range, or NULL */
 
-	struct apfs_query *parent;	/* Query for parent node */
 	unsigned int flags;
 
 	/* Set by the query on success */
@@ -42,14 +145,156 @@ struct apfs_query {
 	int len;			/* Length of the data */
 
 	int depth;			/* Put a limit on recursion */
+	struct apfs_query_level path[APFS_BTREE_MAX_DEPTH]; /* Ancestors */
+};
+
+/* Number of entries for the omap translation cache */
+#define APFS_OMAP_CACHE_DEFAULT_SIZE	4096
+#define APFS_OMAP_CACHE_MAX_SIZE	(1 << 20)
+
+/*
+ * The omap and record caches start this small, and grow by a factor of four
+ * up to their full size once they have taken as many insertions as entries
+ */
+#define APFS_CACHE_MIN_BITS		6
+#define APFS_CACHE_GROW_BITS		2
+
+/*
+ * Entry in the object map translation cache
+ */
+struct apfs_omap_cache_entry {
+	u64 oid;			/* Virtual object id (0 if unused) */
+	u64 xid;			/* Transaction id of the lookup */
+	u64 bno;			/* Physical block number */
+};
+
+/*
+ * Direct-mapped cache of (oid, xid) -> block translations from the volume
+ * object map.  The mount is read-only, so entries never need invalidation;
+ * a colliding lookup just replaces the previous entry.
+ */
+struct apfs_omap_cache {
+	spinlock_t lock;		/* Protects the other fields */
+	struct apfs_omap_cache_entry *entries;
+	unsigned int bits;		/* Log2 of the number of entries */
+	unsigned int max_bits;		/* Log2 of the full size */
+	unsigned int fill;		/* Insertions since the last resize */
+};
+
+/* Number of entries for the catalog record cache */
+#define APFS_REC_CACHE_DEFAULT_SIZE	4096
+#define APFS_REC_CACHE_MAX_SIZE		(1 << 20)
+
+/*
+ * Entry in the catalog record cache
+ */
+struct apfs_rec_cache_entry {
+	u64 id;				/* Key fields of the record */
+	u64 number;
+	u32 name_hash;			/* Hash of the key name, or 0 */
+	u8 type;			/* Record type (0 if unused) */
+	u16 index;			/* Index of the record in its leaf */
+	u64 bno;			/* Block number of the leaf */
+};
+
+/*
+ * Last catalog leaf reached by a descent from the root, so that queries for
+ * increasing keys can be served from there without a new descent
+ */
+struct apfs_cat_finger {
+	spinlock_t lock;		/* Protects the other fields */
+	u64 leaf;			/* Block number of the leaf (0 if none) */
+	u64 parent;			/* Block number of its parent */
+	int index;			/* Index of the leaf in the parent */
+};
+
+/*
+ * Direct-mapped cache of the leaf locations of the catalog records found by
+ * exact queries, so that repeated lookups don't need to descend the tree.
+ * Records never move on a read-only mount; a hit is still checked against
+ * the key in the leaf, so hash collisions are harmless.
+ */
+struct apfs_rec_cache {
+	spinlock_t lock;		/* Protects the table fields */
+	struct apfs_rec_cache_entry *entries;
+	unsigned int bits;		/* Log2 of the number of entries */
+	unsigned int max_bits;		/* Log2 of the full size */
+	unsigned int fill;		/* Insertions since the last resize */
+	struct apfs_cat_finger finger;	/* Last leaf visited */
+};
+
+/*
+ * The omap and record caches of a mount.  With the sharecache option, the
+ * mounts of identical images share a single copy of them, found by the uuid
+ * and checkpoint of the container, and by the volume and snapshot mounted.
+ * All mounts are read-only, so that key always stands for the same metadata;
+ * the first mount picks the sizes of the caches for all of them.
+ */
+struct apfs_meta_cache {
+	struct list_head list;		/* Entry in the list of shared caches */
+	unsigned int users;		/* Mounts of the cache */
+	char nx_uuid[16];		/* Uuid of the container */
+	u64 nx_xid;			/* Transaction id of its checkpoint */
+	unsigned int vol_nr;		/* Index of the volume */
+	char *snap_name;		/* Snapshot mounted, or NULL */
+	struct apfs_omap_cache omap;	/* Volume object map translations */
+	struct apfs_rec_cache rec;	/* Catalog record locations */
+};
+
+/*
+ * Feedback for the readahead of a mount.  The nodes read ahead are remembered
+ * in a table, until apfs_read_node() parses them or a later one takes their
+ * slot; the share of them that get used in each window sets the depth for the
+ * next.  The accounting is lockless, so it's only approximate.
+ */
+struct apfs_btree_ra {
+	unsigned long blocks[1 << APFS_BTREE_RA_BITS]; /* Not yet used */
+	atomic_t depth;			/* Siblings to read ahead */
+	int max_depth;			/* Highest depth allowed */
+	atomic_t issued;		/* Reads ahead in this window */
+	atomic_t used;			/* The ones that got used */
+	atomic64_t total_issued;	/* Reads ahead since mount */
+	atomic64_t total_used;		/* Those used since mount */
 };
 
-extern struct apfs_query *apfs_alloc_query(struct apfs_node *node,
-					   struct apfs_query *parent);
+extern void apfs_init_query(struct apfs_query *query, struct apfs_node *node);
 extern void apfs_free_query(struct super_block *sb, struct apfs_query *query);
-extern int apfs_btree_query(struct super_block *sb, struct apfs_query **query);
+extern int apfs_btree_query(struct super_block *sb, struct apfs_query *query);
+extern int apfs_btree_query_batch(struct super_block *sb,
+				  struct apfs_node *root, struct apfs_key *keys,
+				  int nr, unsigned int flags,
+				  int (*actor)(struct apfs_query *query,
+					       int idx, void *data),
+				  void *data);
+extern void apfs_btree_iter_init(struct apfs_query *query,
+				 struct apfs_node *root, struct apfs_key *key,
+				 unsigned int flags);
+extern void apfs_btree_iter_range(struct apfs_query *query,
+				  struct apfs_node *root,
+				  struct apfs_key *start, struct apfs_key *end,
+				  unsigned int flags);
+extern int apfs_btree_iter_seek(struct super_block *sb,
+				struct apfs_query *query);
+extern void apfs_btree_iter_widen(struct apfs_query *query,
+				  struct apfs_key *key, unsigned int flags);
+extern int apfs_btree_iter_next(struct super_block *sb,
+				struct apfs_query *query);
+extern int apfs_query_child_block(struct super_block *sb,
+				  struct apfs_query *query, u64 *child_id,
+				  u64 *child_blk);
+extern struct apfs_node *apfs_query_read_child(struct super_block *sb,
+					       struct apfs_query *query);
+extern int apfs_btree_pin(struct super_block *sb, struct apfs_node *root,
+			  unsigned int flags, unsigned int levels,
+			  unsigned long *count);
+extern void apfs_btree_ra_init(struct super_block *sb);
+extern void apfs_btree_ra_used(struct super_block *sb, u64 bno);
 extern struct apfs_node *apfs_omap_read_node(struct super_block *sb, u64 id);
 extern int apfs_omap_lookup_block(struct super_block *sb,
 				  struct apfs_node *tbl, u64 id, u64 *block);
+extern int apfs_meta_cache_get(struct super_block *sb);
+extern void apfs_meta_cache_put(struct super_block *sb);
+extern int apfs_omap_cache_resize(struct super_block *sb, unsigned long size);
+extern int apfs_rec_cache_resize(struct super_block *sb, unsigned long size);
 
 #endif	/* _APFS_BTREE_H */
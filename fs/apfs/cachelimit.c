@@ -0,0 +1,346 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/cachelimit.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ *
+ * Memory budgets for the metadata caches, set through sysfs.  Each cache of a
+ * mount has a limit in bytes, which gets turned into a number of entries for
+ * the cache itself; a new limit takes effect right away, and the entries over
+ * it are dropped.  The limits of all the mounts together can be held under a
+ * global cap: a limit that won't fit is refused, and lowering the cap scales
+ * all the limits down.  The omap and record caches shared by several mounts
+ * are only counted once.
+ */
+
+#include <linux/list.h>
+#include <linux/math64.h>
+#include <linux/mutex.h>
+#include "apfs.h"
+#include "btree.h"
+#include "cachelimit.h"
+#include "extents.h"
+#include "node.h"
+#include "super.h"
+
+/* Mounts with cache limits, and the global cap; all under the mutex */
+static LIST_HEAD(apfs_cache_mounts);
+static DEFINE_MUTEX(apfs_cache_limits_mutex);
+static u64 apfs_cache_cap;		/* Zero if there is no cap */
+
+/**
+ * apfs_cache_entry_size - Memory taken by each entry of a cache
+ * @sbi:	sb info of the mount
+ * @kind:	the cache
+ *
+ * A cached node keeps its block mapped, so that counts too.
+ */
+static u64 apfs_cache_entry_size(struct apfs_sb_info *sbi,
+				 enum apfs_cache_kind kind)
+{
+	struct super_block *sb = sbi->s_vobject.sb;
+
+	switch (kind) {
+	case APFS_CACHE_NODE:
+		return sizeof(struct apfs_node) + sb->s_blocksize;
+	case APFS_CACHE_OMAP:
+		return sizeof(struct apfs_omap_cache_entry);
+	case APFS_CACHE_REC:
+		return sizeof(struct apfs_rec_cache_entry);
+	default:
+		return sizeof(struct apfs_extent_map);
+	}
+}
+
+/**
+ * apfs_cache_usage - Memory taken by a cache of a mount right now
+ * @sbi:	sb info of the mount
+ * @kind:	the cache
+ *
+ * The tables of the omap and record caches count whole, whether their slots
+ * are used or not.  The nodes pinned in memory don't count, since they are
+ * not evicted.
+ */
+static u64 apfs_cache_usage(struct apfs_sb_info *sbi,
+			    enum apfs_cache_kind kind)
+{
+	struct apfs_meta_cache *meta = sbi->s_meta_cache;
+	u64 size = apfs_cache_entry_size(sbi, kind);
+
+	switch (kind) {
+	case APFS_CACHE_NODE:
+		return size * list_lru_count(&sbi->s_node_cache.lru);
+	case APFS_CACHE_OMAP:
+		if (!READ_ONCE(meta->omap.entries))
+			return 0;
+		return size << READ_ONCE(meta->omap.bits);
+	case APFS_CACHE_REC:
+		if (!READ_ONCE(meta->rec.entries))
+			return 0;
+		return size << READ_ONCE(meta->rec.bits);
+	default:
+		return size * list_lru_count(&sbi->s_extent_maps.lru);
+	}
+}
+
+/**
+ * apfs_cache_is_meta - Check if a cache may be shared by several mounts
+ * @kind:	the cache
+ */
+static inline bool apfs_cache_is_meta(enum apfs_cache_kind kind)
+{
+	return kind == APFS_CACHE_OMAP || kind == APFS_CACHE_REC;
+}
+
+/**
+ * apfs_cache_counted - Check if a cache of a mount counts for the global cap
+ * @sbi:	sb info of the mount, which is on the list
+ * @kind:	the cache
+ *
+ * Shared caches only count for the first of their mounts on the list.
+ */
+static bool apfs_cache_counted(struct apfs_sb_info *sbi,
+			       enum apfs_cache_kind kind)
+{
+	struct apfs_sb_info *other;
+
+	if (!apfs_cache_is_meta(kind))
+		return true;
+	list_for_each_entry(other, &apfs_cache_mounts, s_cache_limits.list) {
+		if (other == sbi)
+			return true;
+		if (other->s_meta_cache == sbi->s_meta_cache)
+			return false;
+	}
+	return true;
+}
+
+/**
+ * apfs_cache_limits_total - Add up the limits of all the mounts
+ * @skip:	mount to leave out, or NULL
+ * @kind:	cache of @skip to leave out
+ */
+static u64 apfs_cache_limits_total(struct apfs_sb_info *skip,
+				   enum apfs_cache_kind kind)
+{
+	struct apfs_sb_info *sbi;
+	u64 total = 0;
+	int i;
+
+	lockdep_assert_held(&apfs_cache_limits_mutex);
+	list_for_each_entry(sbi, &apfs_cache_mounts, s_cache_limits.list) {
+		for (i = 0; i < APFS_CACHE_NR_KINDS; i++) {
+			if (sbi == skip && i == kind)
+				continue;
+			/* Nor the other mounts of a shared cache */
+			if (skip && i == kind && apfs_cache_is_meta(kind) &&
+			    sbi->s_meta_cache == skip->s_meta_cache)
+				continue;
+			if (apfs_cache_counted(sbi, i))
+				total += sbi->s_cache_limits.bytes[i];
+		}
+	}
+	return total;
+}
+
+/**
+ * apfs_cache_limit_apply - Set the limit of a cache of a mount
+ * @sbi:	sb info of the mount
+ * @kind:	the cache
+ * @bytes:	the new limit
+ *
+ * Resizes the cache right away.  The new limit of a shared cache is recorded
+ * for all its mounts.  Returns 0 on success or -ENOMEM in case of failure.
+ */
+static int apfs_cache_limit_apply(struct apfs_sb_info *sbi,
+				  enum apfs_cache_kind kind, u64 bytes)
+{
+	struct super_block *sb = sbi->s_vobject.sb;
+	struct apfs_sb_info *other;
+	u64 entries = div64_u64(bytes, apfs_cache_entry_size(sbi, kind));
+	int err = 0;
+
+	switch (kind) {
+	case APFS_CACHE_NODE:
+		apfs_node_cache_set_max(sb, entries);
+		break;
+	case APFS_CACHE_OMAP:
+		err = apfs_omap_cache_resize(sb, entries);
+		break;
+	case APFS_CACHE_REC:
+		err = apfs_rec_cache_resize(sb, entries);
+		break;
+	default:
+		apfs_extent_maps_set_max(sb, entries);
+		break;
+	}
+	if (err)
+		return err;
+
+	sbi->s_cache_limits.bytes[kind] = bytes;
+	if (!apfs_cache_is_meta(kind))
+		return 0;
+	list_for_each_entry(other, &apfs_cache_mounts, s_cache_limits.list) {
+		if (other->s_meta_cache == sbi->s_meta_cache)
+			other->s_cache_limits.bytes[kind] = bytes;
+	}
+	return 0;
+}
+
+/**
+ * apfs_cache_limits_scale - Cut down the limits of a mount in proportion
+ * @sbi:	sb info of the mount
+ * @num:	numerator of the proportion
+ * @den:	denominator of the proportion, bigger than @num
+ *
+ * Only the limits that count for the global cap are changed.  Failure to
+ * resize a cache is not an error, it just keeps its previous limit.
+ */
+static void apfs_cache_limits_scale(struct apfs_sb_info *sbi, u64 num, u64 den)
+{
+	u64 ratio = div64_u64(num << 10, den); /* In units of 1/1024 */
+	int i;
+
+	for (i = 0; i < APFS_CACHE_NR_KINDS; i++) {
+		u64 bytes = sbi->s_cache_limits.bytes[i];
+
+		if (apfs_cache_counted(sbi, i))
+			apfs_cache_limit_apply(sbi, i, (bytes * ratio) >> 10);
+	}
+}
+
+/**
+ * apfs_cache_limits_register - Start keeping the cache limits of a new mount
+ * @sb:		filesystem superblock, with all the caches set up
+ *
+ * The initial limits come from the mount options and the defaults, cut down
+ * if needed to fit under the global cap.
+ */
+void apfs_cache_limits_register(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_cache_limits *limits = &sbi->s_cache_limits;
+	struct apfs_meta_cache *meta = sbi->s_meta_cache;
+	u64 total, used = 0;
+	int i;
+
+	limits->bytes[APFS_CACHE_NODE] = sbi->s_node_cache.max;
+	limits->bytes[APFS_CACHE_OMAP] =
+		meta->omap.entries ? 1ULL << meta->omap.max_bits : 0;
+	limits->bytes[APFS_CACHE_REC] =
+		meta->rec.entries ? 1ULL << meta->rec.max_bits : 0;
+	limits->bytes[APFS_CACHE_EXTENT] = sbi->s_extent_maps.max;
+	for (i = 0; i < APFS_CACHE_NR_KINDS; i++)
+		limits->bytes[i] *= apfs_cache_entry_size(sbi, i);
+
+	mutex_lock(&apfs_cache_limits_mutex);
+	list_add_tail(&limits->list, &apfs_cache_mounts);
+	if (!apfs_cache_cap)
+		goto out;
+	for (i = 0; i < APFS_CACHE_NR_KINDS; i++) {
+		if (apfs_cache_counted(sbi, i))
+			used += limits->bytes[i];
+	}
+	total = apfs_cache_limits_total(NULL, 0);
+	if (total > apfs_cache_cap && used) {
+		u64 others = total - used;
+		u64 room = 0;
+
+		if (others < apfs_cache_cap)
+			room = apfs_cache_cap - others;
+		apfs_cache_limits_scale(sbi, room, used);
+	}
+out:
+	mutex_unlock(&apfs_cache_limits_mutex);
+}
+
+/**
+ * apfs_cache_limits_unregister - Stop keeping the cache limits of a mount
+ * @sb:		filesystem superblock
+ */
+void apfs_cache_limits_unregister(struct super_block *sb)
+{
+	mutex_lock(&apfs_cache_limits_mutex);
+	list_del(&APFS_SB(sb)->s_cache_limits.list);
+	mutex_unlock(&apfs_cache_limits_mutex);
+}
+
+/**
+ * apfs_cache_limit_show - Report the usage and the limit of a cache of a mount
+ * @sbi:	sb info of the mount
+ * @kind:	the cache
+ * @buf:	sysfs buffer
+ */
+ssize_t apfs_cache_limit_show(struct apfs_sb_info *sbi,
+			      enum apfs_cache_kind kind, char *buf)
+{
+	u64 limit;
+
+	mutex_lock(&apfs_cache_limits_mutex);
+	limit = sbi->s_cache_limits.bytes[kind];
+	mutex_unlock(&apfs_cache_limits_mutex);
+	return sprintf(buf, "%llu %llu\n", apfs_cache_usage(sbi, kind), limit);
+}
+
+/**
+ * apfs_cache_limit_store - Set a new limit for a cache of a mount
+ * @sbi:	sb info of the mount
+ * @kind:	the cache
+ * @bytes:	the new limit
+ *
+ * Returns 0 on success, -ENOSPC if the limit won't fit under the global cap,
+ * or -ENOMEM in case of failure.
+ */
+int apfs_cache_limit_store(struct apfs_sb_info *sbi,
+			   enum apfs_cache_kind kind, u64 bytes)
+{
+	int err = -ENOSPC;
+
+	mutex_lock(&apfs_cache_limits_mutex);
+	if (apfs_cache_cap &&
+	    apfs_cache_limits_total(sbi, kind) + bytes > apfs_cache_cap)
+		goto out;
+	err = apfs_cache_limit_apply(sbi, kind, bytes);
+out:
+	mutex_unlock(&apfs_cache_limits_mutex);
+	return err;
+}
+
+/**
+ * apfs_cache_cap_show - Report the global cap and the limits under it
+ * @buf:	sysfs buffer
+ */
+ssize_t apfs_cache_cap_show(char *buf)
+{
+	u64 total, cap;
+
+	mutex_lock(&apfs_cache_limits_mutex);
+	total = apfs_cache_limits_total(NULL, 0);
+	cap = apfs_cache_cap;
+	mutex_unlock(&apfs_cache_limits_mutex);
+	return sprintf(buf, "%llu %llu\n", total, cap);
+}
+
+/**
+ * apfs_cache_cap_store - Set a new global cap for the cache limits
+ * @bytes:	the new cap, or zero for none
+ *
+ * If the limits of the mounts add up to more than the new cap, they are all
+ * cut down in the same proportion.  Returns 0 on success.
+ */
+int apfs_cache_cap_store(u64 bytes)
+{
+	struct apfs_sb_info *sbi;
+	u64 total;
+
+	mutex_lock(&apfs_cache_limits_mutex);
+	apfs_cache_cap = bytes;
+	total = apfs_cache_limits_total(NULL, 0);
+	if (bytes && total > bytes) {
+		list_for_each_entry(sbi, &apfs_cache_mounts,
+				    s_cache_limits.list)
+			apfs_cache_limits_scale(sbi, bytes, total);
+	}
+	mutex_unlock(&apfs_cache_limits_mutex);
+	return 0;
+}
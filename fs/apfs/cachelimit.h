@@ -0,0 +1,45 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/cachelimit.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_CACHELIMIT_H
+#define _APFS_CACHELIMIT_H
+
+#include <linux/list.h>
+#include <linux/types.h>
+
+struct apfs_sb_info;
+struct super_block;
+
+/*
+ * Metadata caches of a mount with a memory budget
+ */
+enum apfs_cache_kind {
+	APFS_CACHE_NODE,		/* Parsed b-tree nodes */
+	APFS_CACHE_OMAP,		/* Object map translations */
+	APFS_CACHE_REC,			/* Catalog record locations */
+	APFS_CACHE_EXTENT,		/* Extent maps of the inodes */
+	APFS_CACHE_NR_KINDS
+};
+
+/*
+ * Memory budgets of the caches of a mount, in bytes
+ */
+struct apfs_cache_limits {
+	struct list_head list;		/* Entry in the list of mounts */
+	u64 bytes[APFS_CACHE_NR_KINDS];	/* Limit for each cache */
+};
+
+extern void apfs_cache_limits_register(struct super_block *sb);
+extern void apfs_cache_limits_unregister(struct super_block *sb);
+extern ssize_t apfs_cache_limit_show(struct apfs_sb_info *sbi,
+				     enum apfs_cache_kind kind, char *buf);
+extern int apfs_cache_limit_store(struct apfs_sb_info *sbi,
+				  enum apfs_cache_kind kind, u64 bytes);
+extern ssize_t apfs_cache_cap_show(char *buf);
+extern int apfs_cache_cap_store(u64 bytes);
+
+#endif	/* _APFS_CACHELIMIT_H */
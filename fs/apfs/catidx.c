@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/catidx.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ *
+ * External catalog index for images that never change.  The file is built
+ * once by apfs-mkindex and given to each mount with the index option, so that
+ * exact catalog queries are answered with a probe of the table and a read of
+ * the leaf, whatever the state of the caches.  The index is only a hint: a
+ * file that doesn't match the mount is ignored, and every location it gives
+ * is checked against the key found there.
+ */
+
+#include <linux/crc32c.h>
+#include <linux/fs.h>
+#include <linux/vmalloc.h>
+#include "apfs.h"
+#include "catidx.h"
+#include "message.h"
+#include "super.h"
+
+/**
+ * apfs_catidx_check - Check that an index file is valid for a mount
+ * @sb:		filesystem superblock
+ * @buf:	contents of the file
+ * @size:	size of the file
+ *
+ * Returns 0 if the index can be used, or a negative error code otherwise.
+ */
+static int apfs_catidx_check(struct super_block *sb, const void *buf,
+			     loff_t size)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	const struct apfs_catidx_header *hdr = buf;
+	u64 table_size;
+	u32 bits;
+
+	if (size < sizeof(*hdr) ||
+	    memcmp(hdr->ch_magic, APFS_CATIDX_MAGIC, sizeof(hdr->ch_magic))) {
+		apfs_warn(sb, "%s is not a catalog index", sbi->s_catidx_path);
+		return -EINVAL;
+	}
+	if (le32_to_cpu(hdr->ch_version) != APFS_CATIDX_VERSION) {
+		apfs_warn(sb, "unsupported catalog index version %u",
+			  le32_to_cpu(hdr->ch_version));
+		return -EINVAL;
+	}
+	bits = le32_to_cpu(hdr->ch_bits);
+	table_size = (u64)sizeof(struct apfs_catidx_slot) <<
+		     min_t(u32, bits, APFS_CATIDX_MAX_BITS);
+	if (bits > APFS_CATIDX_MAX_BITS || size != sizeof(*hdr) + table_size) {
+		apfs_warn(sb, "bad size for the catalog index");
+		return -EINVAL;
+	}
+	if (memcmp(hdr->ch_nx_uuid, sbi->s_msb_raw->nx_uuid,
+		   sizeof(hdr->ch_nx_uuid)) ||
+	    memcmp(hdr->ch_vol_uuid, sbi->s_vsb_raw->apfs_vol_uuid,
+		   sizeof(hdr->ch_vol_uuid)) ||
+	    le64_to_cpu(hdr->ch_xid) != sbi->s_xid) {
+		apfs_warn(sb, "catalog index was built for another checkpoint");
+		return -ESTALE;
+	}
+	if (crc32c(~0, hdr + 1, size - sizeof(*hdr)) !=
+	    le32_to_cpu(hdr->ch_csum)) {
+		apfs_warn(sb, "bad checksum for the catalog index");
+		return -EFSBADCRC;
+	}
+	return 0;
+}
+
+/**
+ * apfs_catidx_load - Read the external catalog index of a new mount
+ * @sb:		filesystem superblock
+ *
+ * Does nothing unless the index mount option was given.  The mount goes on
+ * without the index if it can't be used.
+ */
+void apfs_catidx_load(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_catidx *idx = &sbi->s_catidx;
+	const struct apfs_catidx_header *hdr;
+	loff_t size, max_size;
+	void *buf = NULL;
+	int err;
+
+	if (!sbi->s_catidx_path)
+		return;
+
+	max_size = (u64)sizeof(struct apfs_catidx_slot) << APFS_CATIDX_MAX_BITS;
+	max_size += sizeof(*hdr);
+	err = kernel_read_file_from_path(sbi->s_catidx_path, &buf, &size,
+					 max_size, READING_UNKNOWN);
+	if (err) {
+		apfs_warn(sb, "unable to read catalog index %s (%d)",
+			  sbi->s_catidx_path, err);
+		return;
+	}
+	if (apfs_catidx_check(sb, buf, size)) {
+		vfree(buf);
+		return;
+	}
+
+	hdr = buf;
+	idx->buf = buf;
+	idx->slots = (struct apfs_catidx_slot *)(hdr + 1);
+	idx->bits = le32_to_cpu(hdr->ch_bits);
+	apfs_info(sb, "catalog index has %llu records",
+		  le64_to_cpu(hdr->ch_count));
+}
+
+/**
+ * apfs_catidx_destroy - Free the external catalog index of a mount
+ * @sb:		filesystem superblock
+ */
+void apfs_catidx_destroy(struct super_block *sb)
+{
+	struct apfs_catidx *idx = &APFS_SB(sb)->s_catidx;
+
+	vfree(idx->buf);
+	idx->buf = NULL;
+	idx->slots = NULL;
+}
@@ -0,0 +1,115 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/catidx.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_CATIDX_H
+#define _APFS_CATIDX_H
+
+#include <linux/hash.h>
+#include <linux/types.h>
+#include "key.h"
+
+struct super_block;
+
+/*
+ * An external catalog index is a file built offline by apfs-mkindex, for a
+ * single checkpoint of a volume.  It's a header followed by an open hash
+ * table of slots, all in little endian.  Each slot gives the leaf and the
+ * record index of a catalog key that has no name in its in-memory form: the
+ * inode records, and the first directory record for each name hash.
+ */
+#define APFS_CATIDX_MAGIC	"APFSCIDX"
+#define APFS_CATIDX_VERSION	1
+
+/* Limit on the size of the table, to keep a bad file from using up memory */
+#define APFS_CATIDX_MAX_BITS	26
+
+struct apfs_catidx_header {
+	char ch_magic[8];	/* APFS_CATIDX_MAGIC, not null-terminated */
+	__le32 ch_version;	/* APFS_CATIDX_VERSION */
+	__le32 ch_bits;		/* Log2 of the number of slots */
+	char ch_nx_uuid[16];	/* Container the index was built for */
+	char ch_vol_uuid[16];	/* Volume the index was built for */
+	__le64 ch_xid;		/* Checkpoint or snapshot of the volume */
+	__le64 ch_count;	/* Slots in use */
+	__le32 ch_csum;		/* crc32c of the slots */
+	__le32 ch_pad;
+} __packed;
+
+struct apfs_catidx_slot {
+	__le64 cs_id;		/* Object id of the key */
+	__le64 cs_number;	/* Number of the key, as in struct apfs_key */
+	__le64 cs_bno;		/* Leaf node that contains the record */
+	__le16 cs_index;	/* Index of the record in the leaf */
+	u8 cs_type;		/* Record type of the key, 0 if free */
+	u8 cs_pad[5];
+} __packed;
+
+/*
+ * In-memory catalog index of a mount
+ */
+struct apfs_catidx {
+	void *buf;			/* The whole file, or NULL */
+	struct apfs_catidx_slot *slots;	/* Hash table in @buf */
+	unsigned int bits;		/* Log2 of the number of slots */
+};
+
+/**
+ * apfs_catidx_hash - Find the first slot to try for a key
+ * @id:		object id of the key
+ * @type:	record type of the key
+ * @number:	number of the key
+ * @bits:	log2 of the number of slots
+ *
+ * This is part of the file format, so it must never change for a version.
+ */
+static inline u64 apfs_catidx_hash(u64 id, u8 type, u64 number,
+				   unsigned int bits)
+{
+	return hash_64(id ^ ((u64)type << 56) ^ hash_64(number, 32), bits);
+}
+
+/**
+ * apfs_catidx_find - Look up the location of a catalog record in the index
+ * @idx:	the index
+ * @key:	key of the record
+ * @bno:	on return, block number of the leaf with the record
+ * @index:	on return, index of the record in the leaf
+ *
+ * The location still has to be checked against the key, since the index may
+ * be wrong.  Returns true if @key was found.
+ */
+static inline bool apfs_catidx_find(const struct apfs_catidx *idx,
+				    const struct apfs_key *key, u64 *bno,
+				    int *index)
+{
+	u64 mask, i, probes;
+
+	if (!idx->slots || key->name)
+		return false;
+
+	mask = (1ULL << idx->bits) - 1;
+	i = apfs_catidx_hash(key->id, key->type, key->number, idx->bits);
+	for (probes = 0; probes <= mask; probes++, i = (i + 1) & mask) {
+		const struct apfs_catidx_slot *slot = &idx->slots[i];
+
+		if (!slot->cs_type)
+			return false;
+		if (slot->cs_type == key->type &&
+		    le64_to_cpu(slot->cs_id) == key->id &&
+		    le64_to_cpu(slot->cs_number) == key->number) {
+			*bno = le64_to_cpu(slot->cs_bno);
+			*index = le16_to_cpu(slot->cs_index);
+			return true;
+		}
+	}
+	return false;
+}
+
+extern void apfs_catidx_load(struct super_block *sb);
+extern void apfs_catidx_destroy(struct super_block *sb);
+
+#endif	/* _APFS_CATIDX_H */
@@ -0,0 +1,168 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/clone.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ *
+ * Reads of the data blocks that cloned files share, through the page cache of
+ * the device
+ */
+
+#include <linux/blkdev.h>
+#include <linux/buffer_head.h>
+#include <linux/highmem.h>
+#include <linux/iomap.h>
+#include <linux/pagemap.h>
+#include "apfs.h"
+#include "clone.h"
+#include "extents.h"
+#include "inode.h"
+#include "stats.h"
+#include "super.h"
+
+/**
+ * apfs_clone_wanted - Check if the reads of a file may go through the device
+ * @inode:	the file
+ *
+ * Only files that have been cloned can share their blocks with others, and
+ * checking the extent reference tree for the rest would be a waste.
+ */
+bool apfs_clone_wanted(struct inode *inode)
+{
+	if (!(APFS_SB(inode->i_sb)->s_flags & APFS_SHARE_CLONES))
+		return false;
+	return APFS_I(inode)->i_cloned;
+}
+
+/**
+ * apfs_clone_map - Find where the device keeps a page of a shared extent
+ * @inode:	the file
+ * @page:	page of the file, which may not be in the page cache yet
+ * @addr:	on return, the byte offset of the data in the device
+ *
+ * Returns true if the whole page belongs to a single extent that is shared
+ * with another file, and it matches a single page of the device.
+ */
+static bool apfs_clone_map(struct inode *inode, struct page *page, u64 *addr)
+{
+	struct apfs_file_extent ext;
+	loff_t pos = page_offset(page);
+
+	if (pos >= i_size_read(inode))
+		return false;
+	/* The blocks of a Fusion container may be on either device */
+	if (APFS_SB(inode->i_sb)->s_nxi->nx_tier2_bdev)
+		return false;
+	if (apfs_extent_read(inode, pos >> inode->i_blkbits, &ext, false))
+		return false;
+	if (!ext.shared || !ext.phys_block_num)
+		return false;
+	if (pos < ext.logical_addr ||
+	    pos + PAGE_SIZE > ext.logical_addr + ext.len)
+		return false;
+
+	*addr = (ext.phys_block_num << inode->i_blkbits) +
+		(pos - ext.logical_addr);
+	return !(*addr & ~PAGE_MASK);
+}
+
+/**
+ * apfs_clone_fill - Copy a page of a shared extent from the device
+ * @inode:	the file
+ * @page:	locked page of the file
+ * @addr:	byte offset of the data in the device
+ *
+ * The page of the device stays cached for the other clones.  Returns 0 on
+ * success, or a negative error code in case of failure.
+ */
+static int apfs_clone_fill(struct inode *inode, struct page *page, u64 addr)
+{
+	struct address_space *bmap = inode->i_sb->s_bdev->bd_inode->i_mapping;
+	loff_t tail = i_size_read(inode) - page_offset(page);
+	struct page *src;
+
+	src = read_mapping_page(bmap, addr >> PAGE_SHIFT, NULL);
+	if (IS_ERR(src))
+		return PTR_ERR(src);
+	copy_highpage(page, src);
+	put_page(src);
+
+	if (tail < PAGE_SIZE)
+		zero_user_segment(page, tail, PAGE_SIZE);
+	SetPageUptodate(page);
+	apfs_stat_inc(inode->i_sb, APFS_STAT_CLONE_PAGES);
+	return 0;
+}
+
+/**
+ * apfs_clone_readpage - Read a page of a file through the device, if shared
+ * @page:	locked page of the file
+ *
+ * Returns true if the page was read, and unlocked; otherwise it's left for
+ * the usual read path, which will report any errors.
+ */
+bool apfs_clone_readpage(struct page *page)
+{
+	struct inode *inode = page->mapping->host;
+	u64 addr;
+
+	if (!apfs_clone_wanted(inode) || !apfs_clone_map(inode, page, &addr))
+		return false;
+	if (apfs_clone_fill(inode, page, addr))
+		return false;
+	unlock_page(page);
+	return true;
+}
+
+/**
+ * apfs_clone_readpages - Read the shared pages of a readahead window
+ * @mapping:	address space of the file
+ * @pages:	pages of the window, not yet in the page cache
+ * @nr_pages:	number of pages in the window, will be updated
+ *
+ * The pages for shared extents are taken out of @pages and read through the
+ * device, with the reads for all of them started together; only the rest is
+ * left for the caller.
+ */
+void apfs_clone_readpages(struct address_space *mapping,
+			  struct list_head *pages, unsigned int *nr_pages)
+{
+	struct inode *inode = mapping->host;
+	struct super_block *sb = inode->i_sb;
+	unsigned int per_page = PAGE_SIZE >> inode->i_blkbits;
+	struct page *page, *tmp;
+	struct blk_plug plug;
+	LIST_HEAD(shared);
+	unsigned int i;
+	u64 addr;
+
+	if (!apfs_clone_wanted(inode))
+		return;
+
+	blk_start_plug(&plug);
+	list_for_each_entry_safe(page, tmp, pages, lru) {
+		if (!apfs_clone_map(inode, page, &addr))
+			continue;
+		list_move(&page->lru, &shared);
+		--*nr_pages;
+		for (i = 0; i < per_page; ++i)
+			sb_breadahead(sb, (addr >> inode->i_blkbits) + i);
+	}
+	blk_finish_plug(&plug);
+
+	list_for_each_entry_safe(page, tmp, &shared, lru) {
+		list_del(&page->lru);
+		if (add_to_page_cache_lru(page, mapping, page->index,
+					  readahead_gfp_mask(mapping))) {
+			/* Someone else is reading it already */
+			put_page(page);
+			continue;
+		}
+		if (apfs_clone_map(inode, page, &addr) &&
+		    !apfs_clone_fill(inode, page, addr))
+			unlock_page(page);
+		else
+			iomap_readpage(page, &apfs_iomap_ops);
+		put_page(page);
+	}
+}
@@ -0,0 +1,24 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/clone.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_CLONE_H
+#define _APFS_CLONE_H
+
+#include <linux/types.h>
+
+struct address_space;
+struct inode;
+struct list_head;
+struct page;
+
+extern bool apfs_clone_wanted(struct inode *inode);
+extern bool apfs_clone_readpage(struct page *page);
+extern void apfs_clone_readpages(struct address_space *mapping,
+				 struct list_head *pages,
+				 unsigned int *nr_pages);
+
+#endif	/* _APFS_CLONE_H */
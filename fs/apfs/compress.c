@@ -0,0 +1,1111 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/compress.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ *
+ * Read support for files compressed with decmpfs
+ */
+
+#include <linux/fs.h>
+#include <linux/highmem.h>
+#include <linux/mm.h>
+#include <linux/pagemap.h>
+#include <linux/slab.h>
+#include <linux/spinlock.h>
+#include <linux/wait.h>
+#include <linux/workqueue.h>
+#include <linux/zlib.h>
+#include "apfs.h"
+#include "compress.h"
+#include "inode.h"
+#include "ioctl.h"
+#include "lzfse.h"
+#include "message.h"
+#include "stats.h"
+#include "super.h"
+#include "xattr.h"
+
+/*
+ * Pool of decompression workspaces, shared by all mounts
+ */
+static struct apfs_workspace_pool {
+	spinlock_t lock;
+	struct list_head idle;		/* Workspaces not in use */
+	unsigned int nr_idle;		/* Length of the idle list */
+	unsigned int nr_total;		/* Workspaces allocated, idle or not */
+	wait_queue_head_t wait;		/* Readers waiting for a workspace */
+} apfs_workspaces = {
+	.lock	= __SPIN_LOCK_UNLOCKED(apfs_workspaces.lock),
+	.idle	= LIST_HEAD_INIT(apfs_workspaces.idle),
+	.wait	= __WAIT_QUEUE_HEAD_INITIALIZER(apfs_workspaces.wait),
+};
+
+/* Workqueue for the chunks of readahead windows */
+static struct workqueue_struct *apfs_decompress_wq;
+
+/* Pages in a chunk; huge pages hold several chunks instead */
+#define APFS_COMPRESS_CHUNK_PAGES	(APFS_COMPRESS_CHUNK_SIZE >> PAGE_SHIFT)
+
+/*
+ * Chunk of a readahead window, decompressed by a worker
+ */
+struct apfs_decompress_work {
+	struct work_struct work;
+	struct inode *inode;		/* Reference held until done */
+	u32 index;			/* Number of the chunk */
+	unsigned int nr;		/* Number of pages */
+	struct page *pages[APFS_COMPRESS_CHUNK_PAGES ?: 1]; /* Locked */
+};
+
+/**
+ * apfs_workspace_free - Free a decompression workspace
+ * @ws:	the workspace
+ */
+static void apfs_workspace_free(struct apfs_workspace *ws)
+{
+	kvfree(ws->zlib);
+	kvfree(ws->lzfse);
+	kvfree(ws->src);
+	kfree(ws);
+}
+
+/**
+ * apfs_workspace_alloc - Allocate a decompression workspace
+ * @gfp:	allocation flags
+ *
+ * Returns the new workspace, or NULL in case of failure.
+ */
+static struct apfs_workspace *apfs_workspace_alloc(gfp_t gfp)
+{
+	struct apfs_workspace *ws;
+
+	ws = kzalloc(sizeof(*ws), gfp);
+	if (!ws)
+		return NULL;
+	INIT_LIST_HEAD(&ws->list);
+	ws->zlib = kvmalloc(zlib_inflate_workspacesize(), gfp);
+	ws->lzfse = kvmalloc(apfs_lzfse_workspace_size(), gfp);
+	ws->src = kvmalloc(APFS_COMPRESS_MAX_CHUNK_SIZE, gfp);
+	if (!ws->zlib || !ws->lzfse || !ws->src) {
+		apfs_workspace_free(ws);
+		return NULL;
+	}
+	return ws;
+}
+
+/**
+ * apfs_workspace_can_get - Check if apfs_workspace_get() may not wait
+ * @pool:	the workspace pool
+ */
+static inline bool apfs_workspace_can_get(struct apfs_workspace_pool *pool)
+{
+	return READ_ONCE(pool->nr_idle) ||
+	       READ_ONCE(pool->nr_total) < num_online_cpus();
+}
+
+/**
+ * apfs_workspace_get - Take a decompression workspace from the pool
+ *
+ * There is at most one workspace for each cpu.  If they are all busy, or if a
+ * new one can't be allocated, waits for another reader to be done with one;
+ * the workspace allocated at module load guarantees that this will happen.
+ * The workspace must be returned with apfs_workspace_put().
+ */
+static struct apfs_workspace *apfs_workspace_get(void)
+{
+	struct apfs_workspace_pool *pool = &apfs_workspaces;
+	struct apfs_workspace *ws;
+
+	while (1) {
+		spin_lock(&pool->lock);
+		if (!list_empty(&pool->idle)) {
+			ws = list_first_entry(&pool->idle,
+					      struct apfs_workspace, list);
+			list_del(&ws->list);
+			pool->nr_idle--;
+			spin_unlock(&pool->lock);
+			return ws;
+		}
+		if (pool->nr_total < num_online_cpus()) {
+			pool->nr_total++;
+			spin_unlock(&pool->lock);
+
+			ws = apfs_workspace_alloc(GFP_NOFS);
+			if (ws)
+				return ws;
+
+			spin_lock(&pool->lock);
+			pool->nr_total--;
+		}
+		spin_unlock(&pool->lock);
+
+		wait_event(pool->wait, apfs_workspace_can_get(pool));
+	}
+}
+
+/**
+ * apfs_workspace_put - Return a decompression workspace to the pool
+ * @ws:	the workspace
+ *
+ * The workspace is only freed if there are more idle ones than cpus, which
+ * may happen if they go offline.
+ */
+static void apfs_workspace_put(struct apfs_workspace *ws)
+{
+	struct apfs_workspace_pool *pool = &apfs_workspaces;
+
+	spin_lock(&pool->lock);
+	if (pool->nr_idle < num_online_cpus()) {
+		list_add(&ws->list, &pool->idle);
+		pool->nr_idle++;
+		ws = NULL;
+	} else {
+		pool->nr_total--;
+	}
+	spin_unlock(&pool->lock);
+
+	if (ws)
+		apfs_workspace_free(ws);
+	if (wq_has_sleeper(&pool->wait))
+		wake_up(&pool->wait);
+}
+
+/**
+ * apfs_zlib_decompress - Decompress part of a zlib stream
+ * @ws:		decompression workspace
+ * @src:	compressed data
+ * @src_len:	length of @src
+ * @dst:	buffer for the decompressed data
+ * @dst_len:	number of bytes wanted
+ * @skip:	number of decompressed bytes to discard before @dst gets filled
+ *
+ * Returns the number of bytes written to @dst, which will only be less than
+ * @dst_len if the stream ends early; in case of failure, returns a negative
+ * error code.
+ */
+static int apfs_zlib_decompress(struct apfs_workspace *ws, const u8 *src,
+				size_t src_len, u8 *dst, size_t dst_len,
+				u64 skip)
+{
+	z_stream strm;
+	int err, ret;
+
+	if (src_len && (src[0] & 0x0f) == 0x0f) {
+		/* The data was stored uncompressed */
+		src++;
+		src_len--;
+		if (skip >= src_len)
+			return 0;
+		ret = min_t(u64, src_len - skip, dst_len);
+		memcpy(dst, src + skip, ret);
+		return ret;
+	}
+
+	strm.workspace = ws->zlib;
+	strm.next_in = src;
+	strm.avail_in = src_len;
+	if (zlib_inflateInit(&strm) != Z_OK)
+		return -EFSCORRUPTED;
+
+	/* Throw away the output that comes before the range we want */
+	while (skip) {
+		strm.next_out = dst;
+		strm.avail_out = min_t(u64, skip, dst_len);
+		skip -= strm.avail_out;
+		err = zlib_inflate(&strm, Z_SYNC_FLUSH);
+		skip += strm.avail_out;
+		if (err == Z_STREAM_END) {
+			ret = 0;
+			goto end;
+		}
+		if (err != Z_OK) {
+			ret = -EFSCORRUPTED;
+			goto end;
+		}
+	}
+
+	strm.next_out = dst;
+	strm.avail_out = dst_len;
+	while (strm.avail_out) {
+		err = zlib_inflate(&strm, Z_SYNC_FLUSH);
+		if (err == Z_STREAM_END)
+			break;
+		if (err != Z_OK) {
+			ret = -EFSCORRUPTED;
+			goto end;
+		}
+	}
+	ret = dst_len - strm.avail_out;
+
+end:
+	zlib_inflateEnd(&strm);
+	return ret;
+}
+
+/**
+ * apfs_lz_decompress - Decompress a whole lzvn or lzfse stream
+ * @ws:		decompression workspace
+ * @type:	compression type
+ * @src:	compressed data
+ * @src_len:	length of @src
+ * @dst:	buffer for the decompressed data
+ * @dst_len:	length of @dst
+ *
+ * Returns the number of bytes written to @dst, or a negative error code in
+ * case of failure.
+ */
+static int apfs_lz_decompress(struct apfs_workspace *ws, unsigned int type,
+			      const u8 *src, size_t src_len, u8 *dst,
+			      size_t dst_len)
+{
+	int ret;
+
+	switch (type) {
+	case APFS_COMPRESS_LZVN_ATTR:
+	case APFS_COMPRESS_LZVN_RSRC:
+		if (src_len && src[0] == 0x06) {
+			/* The data was stored uncompressed */
+			ret = min(src_len - 1, dst_len);
+			memcpy(dst, src + 1, ret);
+			return ret;
+		}
+		return apfs_lzvn_decompress(src, src_len, dst, dst_len);
+	case APFS_COMPRESS_LZFSE_ATTR:
+	case APFS_COMPRESS_LZFSE_RSRC:
+		return apfs_lzfse_decompress(ws->lzfse, src, src_len, dst,
+					     dst_len);
+	default:
+		return -EOPNOTSUPP;
+	}
+}
+
+/**
+ * apfs_lz_decompress_inline - Decompress part of an inline lzvn/lzfse stream
+ * @ws:		decompression workspace
+ * @info:	compression info for the file
+ * @dst:	buffer for the decompressed data
+ * @dst_len:	number of bytes wanted
+ * @skip:	number of decompressed bytes to discard before @dst gets filled
+ *
+ * Matches may reach back to the start of the stream, so the whole file needs
+ * to be decompressed.  Returns the number of bytes written to @dst, or a
+ * negative error code in case of failure.
+ */
+static int apfs_lz_decompress_inline(struct apfs_workspace *ws,
+				     struct apfs_compress_info *info, u8 *dst,
+				     size_t dst_len, u64 skip)
+{
+	u8 *buf;
+	int ret;
+
+	buf = kvmalloc(info->size, GFP_NOFS);
+	if (!buf)
+		return -ENOMEM;
+	ret = apfs_lz_decompress(ws, info->type, info->data, info->data_len,
+				 buf, info->size);
+	if (ret < 0)
+		goto out;
+	if (ret <= skip) {
+		ret = 0;
+		goto out;
+	}
+	ret = min_t(u64, ret - skip, dst_len);
+	memcpy(dst, buf + skip, ret);
+out:
+	kvfree(buf);
+	return ret;
+}
+
+/**
+ * apfs_compress_rsrc_read - Read part of the resource fork of a file
+ * @inode:	the compressed file
+ * @info:	compression info for @inode
+ * @buffer:	where to copy the data
+ * @len:	number of bytes to read
+ * @off:	offset of the data in the fork
+ *
+ * Goes straight to the page cache of the fork when it's known, so that reads
+ * of each chunk don't have to search the catalog for the xattr again.
+ * Returns 0 on success, -ERANGE if the range goes beyond the end of the fork,
+ * or another negative error code in case of failure.
+ */
+static int apfs_compress_rsrc_read(struct inode *inode,
+				   struct apfs_compress_info *info,
+				   void *buffer, size_t len, u64 off)
+{
+	if (info->rsrc_stream)
+		return apfs_xattr_stream_read(info->rsrc_stream,
+					      info->rsrc_size, buffer, len,
+					      off);
+	return apfs_xattr_read_at(inode, APFS_XATTR_NAME_RSRC_FORK, buffer,
+				  len, off);
+}
+
+/**
+ * apfs_compress_read_chunk - Decompress a chunk of a compressed file
+ * @inode:	the file
+ * @index:	number of the chunk
+ * @dst:	buffer of APFS_COMPRESS_CHUNK_SIZE bytes for the result
+ *
+ * Returns the length of the chunk, which is only less than the chunk size for
+ * the last one, or a negative error code in case of failure.
+ */
+static int apfs_compress_read_chunk(struct inode *inode, u32 index, u8 *dst)
+{
+	struct super_block *sb = inode->i_sb;
+	struct apfs_compress_info *info = APFS_I(inode)->i_compress;
+	struct apfs_cmpf_rsrc_entry *entry;
+	u64 start = (u64)index << APFS_COMPRESS_CHUNK_BITS;
+	size_t want = min_t(u64, APFS_COMPRESS_CHUNK_SIZE, info->size - start);
+	struct apfs_workspace *ws;
+	size_t size;
+	u64 lat;
+	int ret;
+
+	ws = apfs_workspace_get();
+	lat = apfs_lat_start();
+	switch (info->type) {
+	case APFS_COMPRESS_ZLIB_ATTR:
+		/* Inline data is a single stream for the whole file */
+		ret = apfs_zlib_decompress(ws, info->data, info->data_len, dst,
+					   want, start);
+		break;
+	case APFS_COMPRESS_LZVN_ATTR:
+	case APFS_COMPRESS_LZFSE_ATTR:
+		ret = apfs_lz_decompress_inline(ws, info, dst, want, start);
+		break;
+	case APFS_COMPRESS_ZLIB_RSRC:
+	case APFS_COMPRESS_LZVN_RSRC:
+	case APFS_COMPRESS_LZFSE_RSRC:
+		/* The size was checked against the buffer in the workspace */
+		entry = &info->chunks[index];
+		size = le32_to_cpu(entry->size);
+		ret = apfs_compress_rsrc_read(inode, info, ws->src, size,
+					      info->rsrc_base +
+					      le32_to_cpu(entry->off));
+		if (ret == -ERANGE)
+			ret = -EFSCORRUPTED;
+		/* Only time the decompression, not the read */
+		lat = apfs_lat_start();
+		if (!ret && info->type == APFS_COMPRESS_ZLIB_RSRC)
+			ret = apfs_zlib_decompress(ws, ws->src, size, dst, want,
+						   0 /* skip */);
+		else if (!ret)
+			ret = apfs_lz_decompress(ws, info->type, ws->src, size,
+						 dst, want);
+		break;
+	default:
+		ret = -EOPNOTSUPP;
+		break;
+	}
+	apfs_workspace_put(ws);
+
+	if (ret >= 0) {
+		apfs_lat_end(sb, APFS_LAT_DECOMPRESS, lat);
+		apfs_stat_inc(sb, APFS_STAT_DECOMP_CHUNKS);
+		apfs_stat_add(sb, APFS_STAT_DECOMP_BYTES, ret);
+	}
+	if (ret >= 0 && ret < want)
+		ret = -EFSCORRUPTED;
+	if (ret == -EFSCORRUPTED)
+		apfs_alert(sb, "bad compressed data in inode 0x%llx",
+			   (unsigned long long) inode->i_ino);
+	return ret;
+}
+
+/**
+ * apfs_compress_copy_page - Copy the part of a chunk that belongs in a page
+ * @page:	the page, already zeroed
+ * @chunk:	decompressed data for the chunk
+ * @index:	number of the chunk
+ * @len:	length of the chunk
+ */
+static void apfs_compress_copy_page(struct page *page, const u8 *chunk,
+				    u32 index, size_t len)
+{
+	u64 chunk_start = (u64)index << APFS_COMPRESS_CHUNK_BITS;
+	u64 page_start = page_offset(page);
+	u64 from, to;
+	void *addr;
+
+	from = max(page_start, chunk_start);
+	to = min(page_start + PAGE_SIZE, chunk_start + len);
+	if (from >= to)
+		return;
+
+	addr = kmap_atomic(page);
+	memcpy(addr + from - page_start, chunk + from - chunk_start, to - from);
+	kunmap_atomic(addr);
+	flush_dcache_page(page);
+}
+
+/**
+ * apfs_compress_fill_cache - Put the rest of a decompressed chunk in the cache
+ * @mapping:	address space of the file
+ * @page:	page being read, which is handled by the caller
+ * @chunk:	decompressed data for the chunk
+ * @index:	number of the chunk
+ * @len:	length of the chunk
+ *
+ * The whole chunk had to be decompressed anyway, so fill all the other pages it
+ * covers, as long as that can be done without blocking.  Pages that are locked
+ * are left alone, since they belong to another read of the same chunk.
+ */
+static void apfs_compress_fill_cache(struct address_space *mapping,
+				     struct page *page, const u8 *chunk,
+				     u32 index, size_t len)
+{
+	u64 chunk_start = (u64)index << APFS_COMPRESS_CHUNK_BITS;
+	pgoff_t first = chunk_start >> PAGE_SHIFT;
+	pgoff_t last = (chunk_start + len - 1) >> PAGE_SHIFT;
+	pgoff_t i;
+
+	for (i = first; i <= last; i++) {
+		struct page *other;
+
+		if (i == page->index)
+			continue;
+		other = grab_cache_page_nowait(mapping, i);
+		if (!other)
+			continue;
+		if (!PageUptodate(other)) {
+			clear_highpage(other);
+			apfs_compress_copy_page(other, chunk, index, len);
+			SetPageUptodate(other);
+		}
+		unlock_page(other);
+		put_page(other);
+	}
+}
+
+/**
+ * apfs_chunk_cache_lookup - Find a decompressed chunk in the cache
+ * @cache:	the chunk cache, locked by the caller
+ * @cnid:	inode number of the file
+ * @index:	number of the chunk
+ *
+ * Returns the cache entry, or NULL if the chunk is not there.
+ */
+static struct apfs_chunk_cache_entry *
+apfs_chunk_cache_lookup(struct apfs_chunk_cache *cache, u64 cnid, u32 index)
+{
+	struct apfs_chunk_cache_entry *entry;
+
+	list_for_each_entry(entry, &cache->lru, list) {
+		if (!entry->len)
+			break; /* Unused entries are always at the end */
+		if (entry->cnid == cnid && entry->index == index) {
+			list_move(&entry->list, &cache->lru);
+			return entry;
+		}
+	}
+	return NULL;
+}
+
+/**
+ * apfs_chunk_cache_insert - Add a decompressed chunk to the cache
+ * @cache:	the chunk cache
+ * @cnid:	inode number of the file
+ * @index:	number of the chunk
+ * @chunk:	buffer with the decompressed chunk
+ * @len:	length of the chunk
+ *
+ * No data gets copied: the buffer goes into the least recently used entry,
+ * and that entry's old buffer is returned instead.  The caller must free it
+ * or reuse it for other chunks; it may be NULL.
+ */
+static u8 *apfs_chunk_cache_insert(struct apfs_chunk_cache *cache, u64 cnid,
+				   u32 index, u8 *chunk, int len)
+{
+	struct apfs_chunk_cache_entry *entry;
+	u8 *old;
+
+	mutex_lock(&cache->lock);
+	if (apfs_chunk_cache_lookup(cache, cnid, index)) {
+		/* Someone else got here first */
+		mutex_unlock(&cache->lock);
+		return chunk;
+	}
+	entry = list_last_entry(&cache->lru, struct apfs_chunk_cache_entry,
+				list);
+	old = entry->data;
+	entry->data = chunk;
+	entry->cnid = cnid;
+	entry->index = index;
+	entry->len = len;
+	list_move(&entry->list, &cache->lru);
+	mutex_unlock(&cache->lock);
+	return old;
+}
+
+/**
+ * apfs_compress_readpage - Read a page of a compressed file
+ * @file:	the file
+ * @page:	the locked page to fill
+ *
+ * Only the chunks that cover @page get decompressed, unless they are in the
+ * chunk cache already; all the other pages they cover get filled as well.
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_compress_readpage(struct file *file, struct page *page)
+{
+	struct inode *inode = page->mapping->host;
+	struct apfs_chunk_cache *cache = &APFS_SB(inode->i_sb)->s_chunk_cache;
+	struct apfs_compress_info *info = APFS_I(inode)->i_compress;
+	struct apfs_chunk_cache_entry *entry;
+	u64 cnid = apfs_ino(inode);
+	u64 pos = page_offset(page);
+	u32 first, last, i;
+	u8 *chunk = NULL;
+	int ret = 0;
+
+	clear_highpage(page);
+	if (pos >= info->size)
+		goto done;
+
+	first = pos >> APFS_COMPRESS_CHUNK_BITS;
+	last = (min(pos + PAGE_SIZE, info->size) - 1) >>
+						APFS_COMPRESS_CHUNK_BITS;
+	for (i = first; i <= last; i++) {
+		mutex_lock(&cache->lock);
+		entry = apfs_chunk_cache_lookup(cache, cnid, i);
+		if (entry) {
+			apfs_compress_copy_page(page, entry->data, i,
+						entry->len);
+			apfs_compress_fill_cache(page->mapping, page,
+						 entry->data, i, entry->len);
+			mutex_unlock(&cache->lock);
+			continue;
+		}
+		mutex_unlock(&cache->lock);
+
+		if (!chunk) {
+			chunk = kvmalloc(APFS_COMPRESS_CHUNK_SIZE, GFP_NOFS);
+			if (!chunk) {
+				ret = -ENOMEM;
+				goto fail;
+			}
+		}
+		ret = apfs_compress_read_chunk(inode, i, chunk);
+		if (ret < 0)
+			goto fail;
+		apfs_compress_copy_page(page, chunk, i, ret);
+		apfs_compress_fill_cache(page->mapping, page, chunk, i, ret);
+		chunk = apfs_chunk_cache_insert(cache, cnid, i, chunk, ret);
+	}
+	ret = 0;
+
+done:
+	kvfree(chunk);
+	SetPageUptodate(page);
+	unlock_page(page);
+	return 0;
+
+fail:
+	kvfree(chunk);
+	SetPageError(page);
+	unlock_page(page);
+	return ret;
+}
+
+/**
+ * apfs_compress_page_done - Fill a page from its chunk and unlock it
+ * @page:	locked page of the window, with a reference that gets dropped
+ * @chunk:	decompressed data for the chunk, or NULL in case of failure
+ * @index:	number of the chunk
+ * @len:	length of the chunk
+ *
+ * Pages that fail are just unlocked, so that the error gets reported when
+ * they are read by themselves.
+ */
+static void apfs_compress_page_done(struct page *page, const u8 *chunk,
+				    u32 index, int len)
+{
+	if (chunk) {
+		clear_highpage(page);
+		apfs_compress_copy_page(page, chunk, index, len);
+		SetPageUptodate(page);
+	}
+	unlock_page(page);
+	put_page(page);
+}
+
+static void apfs_decompress_work_fn(struct work_struct *work)
+{
+	struct apfs_decompress_work *dw;
+	struct inode *inode;
+	struct apfs_chunk_cache *cache;
+	struct apfs_chunk_cache_entry *entry;
+	u64 cnid;
+	u8 *chunk;
+	int len = -ENOMEM;
+	unsigned int i;
+
+	dw = container_of(work, struct apfs_decompress_work, work);
+	inode = dw->inode;
+	cache = &APFS_SB(inode->i_sb)->s_chunk_cache;
+	cnid = apfs_ino(inode);
+
+	mutex_lock(&cache->lock);
+	entry = apfs_chunk_cache_lookup(cache, cnid, dw->index);
+	if (entry) {
+		apfs_compress_fill_cache(inode->i_mapping, dw->pages[0],
+					 entry->data, dw->index, entry->len);
+		for (i = 0; i < dw->nr; i++)
+			apfs_compress_page_done(dw->pages[i], entry->data,
+						dw->index, entry->len);
+		mutex_unlock(&cache->lock);
+		goto out;
+	}
+	mutex_unlock(&cache->lock);
+
+	chunk = kvmalloc(APFS_COMPRESS_CHUNK_SIZE, GFP_NOFS);
+	if (chunk)
+		len = apfs_compress_read_chunk(inode, dw->index, chunk);
+	/*
+	 * A readahead window, like the one around an mmap fault, needn't be
+	 * aligned to chunks, so the pages of the chunk outside of the window
+	 * get filled too.  Otherwise the next window would decompress the
+	 * chunk again, unless it's still in the chunk cache.  The pages of
+	 * the window are still locked, so they get skipped.
+	 */
+	if (len >= 0)
+		apfs_compress_fill_cache(inode->i_mapping, dw->pages[0], chunk,
+					 dw->index, len);
+	for (i = 0; i < dw->nr; i++)
+		apfs_compress_page_done(dw->pages[i], len < 0 ? NULL : chunk,
+					dw->index, len);
+	if (len >= 0)
+		chunk = apfs_chunk_cache_insert(cache, cnid, dw->index, chunk,
+						len);
+	kvfree(chunk);
+out:
+	iput(inode);
+	kfree(dw);
+}
+
+/**
+ * apfs_compress_readpages - Read a readahead window of a compressed file
+ * @file:	the file
+ * @mapping:	address space of the file
+ * @pages:	pages of the window, not yet in the page cache
+ * @nr_pages:	number of pages in the window
+ *
+ * Each chunk of a resource fork can be decompressed on its own, so the chunks
+ * of the window are handed to workers and the pages are completed as each
+ * one is done.  The workspace pool keeps the number of chunks decompressed at
+ * the same time under the number of cpus.  Inline data is a single stream, so
+ * it's still decompressed one page at a time by the reader.
+ */
+static int apfs_compress_readpages(struct file *file,
+				   struct address_space *mapping,
+				   struct list_head *pages,
+				   unsigned int nr_pages)
+{
+	struct inode *inode = mapping->host;
+	struct apfs_compress_info *info = APFS_I(inode)->i_compress;
+	struct apfs_decompress_work *dw = NULL;
+	bool parallel = info->chunks && APFS_COMPRESS_CHUNK_PAGES;
+	struct page *page, *tmp;
+
+	list_for_each_entry_safe(page, tmp, pages, lru) {
+		u64 pos;
+		u32 index;
+
+		list_del(&page->lru);
+		if (add_to_page_cache_lru(page, mapping, page->index,
+					  readahead_gfp_mask(mapping))) {
+			/* Someone else is reading it already */
+			put_page(page);
+			continue;
+		}
+		pos = page_offset(page);
+		index = pos >> APFS_COMPRESS_CHUNK_BITS;
+
+		if (dw && (dw->index != index || pos >= info->size)) {
+			queue_work(apfs_decompress_wq, &dw->work);
+			dw = NULL;
+		}
+		if (parallel && pos < info->size && !dw) {
+			dw = kmalloc(sizeof(*dw), GFP_NOFS);
+			if (dw) {
+				INIT_WORK(&dw->work, apfs_decompress_work_fn);
+				ihold(inode);
+				dw->inode = inode;
+				dw->index = index;
+				dw->nr = 0;
+			}
+		}
+		if (!dw) {
+			/* Also takes care of the pages past the end */
+			apfs_compress_readpage(file, page);
+			put_page(page);
+			continue;
+		}
+		dw->pages[dw->nr++] = page;
+	}
+	if (dw)
+		queue_work(apfs_decompress_wq, &dw->work);
+	return 0;
+}
+
+const struct address_space_operations apfs_compress_aops = {
+	.readpage	= apfs_compress_readpage,
+	.readpages	= apfs_compress_readpages,
+};
+
+const struct file_operations apfs_compress_file_operations = {
+	.llseek		= generic_file_llseek,
+	.read_iter	= generic_file_read_iter,
+	.mmap		= generic_file_readonly_mmap,
+	.splice_read	= generic_file_splice_read,
+	.open		= apfs_file_open,
+	.unlocked_ioctl	= apfs_ioctl,
+#ifdef CONFIG_COMPAT
+	.compat_ioctl	= apfs_compat_ioctl,
+#endif
+};
+
+/**
+ * apfs_chunk_cache_init - Set up the cache of decompressed chunks for a mount
+ * @sb: filesystem superblock
+ *
+ * The buffers only get allocated as chunks are added, so mounts without
+ * compressed files don't pay for them.
+ */
+void apfs_chunk_cache_init(struct super_block *sb)
+{
+	struct apfs_chunk_cache *cache = &APFS_SB(sb)->s_chunk_cache;
+	int i;
+
+	mutex_init(&cache->lock);
+	INIT_LIST_HEAD(&cache->lru);
+	for (i = 0; i < APFS_CHUNK_CACHE_SIZE; i++) {
+		cache->entries[i].len = 0;
+		cache->entries[i].data = NULL;
+		list_add_tail(&cache->entries[i].list, &cache->lru);
+	}
+}
+
+/**
+ * apfs_chunk_cache_destroy - Free the cache of decompressed chunks
+ * @sb: filesystem superblock
+ */
+void apfs_chunk_cache_destroy(struct super_block *sb)
+{
+	struct apfs_chunk_cache *cache = &APFS_SB(sb)->s_chunk_cache;
+	int i;
+
+	for (i = 0; i < APFS_CHUNK_CACHE_SIZE; i++) {
+		kvfree(cache->entries[i].data);
+		cache->entries[i].data = NULL;
+	}
+}
+
+/**
+ * apfs_compress_read_table - Read the chunk table from the resource fork
+ * @inode:	the compressed file
+ * @info:	compression info for @inode, with the number of chunks set
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_compress_read_table(struct inode *inode,
+				    struct apfs_compress_info *info)
+{
+	__be32 hdr_size;
+	__le32 count;
+	u32 i;
+	int ret;
+
+	ret = apfs_compress_rsrc_read(inode, info, &hdr_size,
+				      sizeof(hdr_size), 0);
+	if (ret)
+		goto out;
+	info->rsrc_base = (u64)be32_to_cpu(hdr_size) + sizeof(hdr_size);
+
+	ret = apfs_compress_rsrc_read(inode, info, &count, sizeof(count),
+				      info->rsrc_base);
+	if (ret)
+		goto out;
+	if (le32_to_cpu(count) < info->nchunks) {
+		ret = -EFSCORRUPTED;
+		goto out;
+	}
+	if (!info->nchunks)
+		return 0;
+
+	info->chunks = kvmalloc_array(info->nchunks, sizeof(*info->chunks),
+				      GFP_KERNEL);
+	if (!info->chunks)
+		return -ENOMEM;
+	ret = apfs_compress_rsrc_read(inode, info, info->chunks,
+				      info->nchunks * sizeof(*info->chunks),
+				      info->rsrc_base + sizeof(count));
+	if (ret)
+		goto out;
+
+	for (i = 0; i < info->nchunks; i++) {
+		if (le32_to_cpu(info->chunks[i].size) >
+					APFS_COMPRESS_MAX_CHUNK_SIZE) {
+			ret = -EFSCORRUPTED;
+			goto out;
+		}
+	}
+
+out:
+	if (ret == -ERANGE) /* The resource fork is too short */
+		ret = -EFSCORRUPTED;
+	return ret;
+}
+
+/**
+ * apfs_compress_read_offsets - Read the chunk offsets from the resource fork
+ * @inode:	the compressed file, with lzvn or lzfse compression
+ * @info:	compression info for @inode, with the number of chunks set
+ *
+ * Converts the array of offsets at the start of the fork into the same chunk
+ * table used for zlib.  Returns 0 on success, or a negative error code in case
+ * of failure.
+ */
+static int apfs_compress_read_offsets(struct inode *inode,
+				      struct apfs_compress_info *info)
+{
+	__le32 *offs;
+	u32 i, off, end;
+	int ret;
+
+	info->rsrc_base = 0;
+	offs = kvmalloc_array(info->nchunks + 1, sizeof(*offs), GFP_KERNEL);
+	if (!offs)
+		return -ENOMEM;
+	ret = apfs_compress_rsrc_read(inode, info, offs,
+				      (info->nchunks + 1) * sizeof(*offs), 0);
+	if (ret == -ERANGE) /* The resource fork is too short */
+		ret = -EFSCORRUPTED;
+	if (ret || !info->nchunks)
+		goto out;
+
+	info->chunks = kvmalloc_array(info->nchunks, sizeof(*info->chunks),
+				      GFP_KERNEL);
+	if (!info->chunks) {
+		ret = -ENOMEM;
+		goto out;
+	}
+	for (i = 0; i < info->nchunks; i++) {
+		off = le32_to_cpu(offs[i]);
+		end = le32_to_cpu(offs[i + 1]);
+		if (end < off || end - off > APFS_COMPRESS_MAX_CHUNK_SIZE) {
+			ret = -EFSCORRUPTED;
+			goto out;
+		}
+		info->chunks[i].off = cpu_to_le32(off);
+		info->chunks[i].size = cpu_to_le32(end - off);
+	}
+
+out:
+	kvfree(offs);
+	return ret;
+}
+
+/**
+ * apfs_compress_init - Set up a compressed file for reading
+ * @inode:	the file, which has the compressed flag set
+ *
+ * Reads the decmpfs header and sets @inode->i_size to the uncompressed size,
+ * and @inode->i_blocks to the space taken by the resource fork, if any.
+ * Returns 0 on success, -EOPNOTSUPP if the compression type isn't supported,
+ * or another negative error code in case of failure.
+ */
+int apfs_compress_init(struct inode *inode)
+{
+	struct super_block *sb = inode->i_sb;
+	struct apfs_compress_info *info;
+	struct apfs_xattr_view view = {0};
+	const struct apfs_decmpfs_hdr *hdr;
+	u64 nchunks, alloced = 0;
+	int len, ret;
+
+	info = kzalloc(sizeof(*info), GFP_KERNEL);
+	if (!info)
+		return -ENOMEM;
+
+	/*
+	 * Resource fork compression only needs the header, so map the xattr
+	 * in its node; a copy is made later if the data is inline.  Big inline
+	 * data may be stored in a dstream, and that does need a copy now.
+	 */
+	len = apfs_xattr_get_view(inode, APFS_XATTR_NAME_COMPRESSED, &view);
+	if (len == -E2BIG)
+		len = apfs_xattr_get_alloc(inode, APFS_XATTR_NAME_COMPRESSED,
+					   APFS_COMPRESS_MAX_ATTR_SIZE,
+					   &info->attr);
+	if (len == -E2BIG || (len >= 0 && len < sizeof(*hdr))) {
+		ret = -EFSCORRUPTED;
+		goto fail;
+	}
+	if (len < 0) {
+		ret = len;
+		goto fail;
+	}
+	hdr = info->attr ?: (void *)view.data;
+
+	if (le32_to_cpu(hdr->magic) != APFS_DECMPFS_MAGIC) {
+		ret = -EFSCORRUPTED;
+		goto fail;
+	}
+	info->type = le32_to_cpu(hdr->type);
+	info->size = le64_to_cpu(hdr->size);
+	nchunks = DIV_ROUND_UP_ULL(info->size, APFS_COMPRESS_CHUNK_SIZE);
+	if (nchunks > U32_MAX || info->size > inode->i_sb->s_maxbytes) {
+		ret = -EFSCORRUPTED;
+		goto fail;
+	}
+	info->nchunks = nchunks;
+
+	switch (info->type) {
+	case APFS_COMPRESS_LZVN_ATTR:
+	case APFS_COMPRESS_LZFSE_ATTR:
+		if (info->size > APFS_COMPRESS_MAX_INLINE_SIZE) {
+			apfs_debug(sb, "inline data too big in inode 0x%llx",
+				   (unsigned long long) inode->i_ino);
+			ret = -EOPNOTSUPP;
+			goto fail;
+		}
+		/* Fall through */
+	case APFS_COMPRESS_ZLIB_ATTR:
+		if (!info->attr) {
+			info->attr = kmemdup(hdr, len, GFP_KERNEL);
+			if (!info->attr) {
+				ret = -ENOMEM;
+				goto fail;
+			}
+			hdr = info->attr;
+		}
+		info->data = (u8 *)hdr->data;
+		info->data_len = len - sizeof(*hdr);
+		break;
+	case APFS_COMPRESS_ZLIB_RSRC:
+		kfree(info->attr);
+		info->attr = NULL;
+		info->rsrc_stream = apfs_xattr_open_stream(inode,
+						APFS_XATTR_NAME_RSRC_FORK,
+						&info->rsrc_size, &alloced);
+		ret = apfs_compress_read_table(inode, info);
+		if (ret)
+			goto fail;
+		break;
+	case APFS_COMPRESS_LZVN_RSRC:
+	case APFS_COMPRESS_LZFSE_RSRC:
+		kfree(info->attr);
+		info->attr = NULL;
+		info->rsrc_stream = apfs_xattr_open_stream(inode,
+						APFS_XATTR_NAME_RSRC_FORK,
+						&info->rsrc_size, &alloced);
+		ret = apfs_compress_read_offsets(inode, info);
+		if (ret)
+			goto fail;
+		break;
+	default:
+		apfs_debug(sb, "unsupported compression type %u in inode 0x%llx",
+			   info->type, (unsigned long long) inode->i_ino);
+		ret = -EOPNOTSUPP;
+		goto fail;
+	}
+
+	if (view.node)
+		apfs_xattr_put_view(&view);
+	APFS_I(inode)->i_compress = info;
+	/*
+	 * The inode has no dstream of its own, so this is the only place to
+	 * find its real size.  Inline data lives in the catalog, so only a
+	 * resource fork takes up blocks.
+	 */
+	inode->i_size = info->size;
+	inode->i_blocks = alloced >> 9;
+	return 0;
+
+fail:
+	if (view.node)
+		apfs_xattr_put_view(&view);
+	kfree(info->attr);
+	kvfree(info->chunks);
+	kfree(info);
+	if (ret != -EFSCORRUPTED)
+		return ret;
+	apfs_alert(sb, "bad compression header in inode 0x%llx",
+		   (unsigned long long) inode->i_ino);
+	return ret;
+}
+
+/**
+ * apfs_compress_free - Release the compression info of an inode
+ * @inode:	the inode, which is being destroyed
+ */
+void apfs_compress_free(struct inode *inode)
+{
+	struct apfs_inode_info *ai = APFS_I(inode);
+	struct apfs_compress_info *info = ai->i_compress;
+
+	if (!info)
+		return;
+	kfree(info->attr);
+	kvfree(info->chunks);
+	kfree(info);
+	ai->i_compress = NULL;
+}
+
+/**
+ * apfs_compress_flush - Wait for the chunks of readahead windows to be done
+ *
+ * The workers use the chunk cache and the trees of the mount, and hold a
+ * reference to the inode, so this must be called on unmount before any of
+ * those are released.
+ */
+void apfs_compress_flush(void)
+{
+	flush_workqueue(apfs_decompress_wq);
+}
+
+/**
+ * apfs_workspace_init - Allocate the first decompression workspace
+ *
+ * Readers can always wait for this one, so that decompression never fails
+ * for lack of memory.  The workqueue for readahead is set up here as well.
+ * Returns 0 on success, or -ENOMEM in case of failure.
+ */
+int __init apfs_workspace_init(void)
+{
+	struct apfs_workspace *ws;
+
+	apfs_decompress_wq = alloc_workqueue("apfs-decompress", WQ_UNBOUND,
+					     num_possible_cpus());
+	if (!apfs_decompress_wq)
+		return -ENOMEM;
+	ws = apfs_workspace_alloc(GFP_KERNEL);
+	if (!ws) {
+		destroy_workqueue(apfs_decompress_wq);
+		return -ENOMEM;
+	}
+	list_add(&ws->list, &apfs_workspaces.idle);
+	apfs_workspaces.nr_idle = 1;
+	apfs_workspaces.nr_total = 1;
+	return 0;
+}
+
+/**
+ * apfs_workspace_exit - Free all the decompression workspaces
+ *
+ * The workqueue goes first, since its workers may still hold workspaces.
+ */
+void apfs_workspace_exit(void)
+{
+	struct apfs_workspace *ws, *tmp;
+
+	destroy_workqueue(apfs_decompress_wq);
+	list_for_each_entry_safe(ws, tmp, &apfs_workspaces.idle, list)
+		apfs_workspace_free(ws);
+	INIT_LIST_HEAD(&apfs_workspaces.idle);
+	apfs_workspaces.nr_idle = 0;
+	apfs_workspaces.nr_total = 0;
+}
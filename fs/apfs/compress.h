@@ -0,0 +1,140 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/compress.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_COMPRESS_H
+#define _APFS_COMPRESS_H
+
+#include <linux/list.h>
+#include <linux/mutex.h>
+#include <linux/types.h>
+
+struct inode;
+struct super_block;
+
+/* Magic number for the header of the decmpfs attribute ("fpmc") */
+#define APFS_DECMPFS_MAGIC		0x636d7066
+
+/* Compression types */
+#define APFS_COMPRESS_ZLIB_ATTR		3	/* zlib, in the decmpfs xattr */
+#define APFS_COMPRESS_ZLIB_RSRC		4	/* zlib, in the resource fork */
+#define APFS_COMPRESS_LZVN_ATTR		7	/* lzvn, in the decmpfs xattr */
+#define APFS_COMPRESS_LZVN_RSRC		8	/* lzvn, in the resource fork */
+#define APFS_COMPRESS_LZFSE_ATTR	11	/* lzfse, in the decmpfs xattr */
+#define APFS_COMPRESS_LZFSE_RSRC	12	/* lzfse, in the resource fork */
+
+/* Size of the chunks of uncompressed data */
+#define APFS_COMPRESS_CHUNK_BITS	16
+#define APFS_COMPRESS_CHUNK_SIZE	(1 << APFS_COMPRESS_CHUNK_BITS)
+
+/* Limits for the sizes we are willing to deal with, against crafted images */
+#define APFS_COMPRESS_MAX_ATTR_SIZE	65536
+#define APFS_COMPRESS_MAX_CHUNK_SIZE	(2 * APFS_COMPRESS_CHUNK_SIZE)
+
+/*
+ * Inline lzvn and lzfse data can't be decompressed starting from the middle,
+ * so the whole file gets decompressed for each chunk.  Put a limit on that.
+ */
+#define APFS_COMPRESS_MAX_INLINE_SIZE	(64 * APFS_COMPRESS_CHUNK_SIZE)
+
+/*
+ * Header of the com.apple.decmpfs attribute of a compressed file.  For inline
+ * compression types, the compressed data comes right after it.
+ */
+struct apfs_decmpfs_hdr {
+	__le32 magic;
+	__le32 type;
+	__le64 size;			/* Uncompressed size of the file */
+	u8 data[];
+} __packed;
+
+/*
+ * Location of a compressed chunk inside the resource fork.  The offset is
+ * relative to the start of the chunk table.
+ */
+struct apfs_cmpf_rsrc_entry {
+	__le32 off;
+	__le32 size;
+} __packed;
+
+/*
+ * Table of zlib compressed chunks in the resource fork.  It is located four
+ * bytes after the offset stored, as a big-endian number, at the start of the
+ * fork.  For lzvn and lzfse, the fork instead begins with a plain array of
+ * little-endian offsets, one for each chunk plus one for the end.
+ */
+struct apfs_cmpf_rsrc {
+	__le32 count;
+	struct apfs_cmpf_rsrc_entry entries[];
+} __packed;
+
+/*
+ * Compression information for an inode, in memory
+ */
+struct apfs_compress_info {
+	unsigned int type;		/* Compression type */
+	u64 size;			/* Uncompressed size */
+	u32 nchunks;			/* Number of chunks */
+
+	/* Inline compression types only */
+	void *attr;			/* Copy of the whole decmpfs xattr */
+	u8 *data;			/* Compressed data, inside @attr */
+	size_t data_len;		/* Length of @data */
+
+	/* Resource fork compression types only */
+	u64 rsrc_base;			/* Base for the chunk offsets */
+	struct apfs_cmpf_rsrc_entry *chunks; /* Chunk table */
+	struct inode *rsrc_stream;	/* Page cache of the fork, or NULL */
+	u64 rsrc_size;			/* Length of the fork */
+};
+
+/*
+ * Buffers needed to decompress a single chunk.  They are kept in a pool, so
+ * that reads of small compressed files don't have to allocate them each time.
+ */
+struct apfs_workspace {
+	struct list_head list;		/* Position in the idle list */
+	void *zlib;			/* Workspace for zlib_inflate() */
+	void *lzfse;			/* State for the lzfse decoder */
+	u8 *src;			/* Compressed chunk from the resource fork */
+};
+
+/* Number of decompressed chunks cached for each mount */
+#define APFS_CHUNK_CACHE_SIZE		8
+
+/*
+ * Decompressed chunk in the cache
+ */
+struct apfs_chunk_cache_entry {
+	struct list_head list;		/* Position in the lru list */
+	u64 cnid;			/* Inode number of the file */
+	u32 index;			/* Number of the chunk in the file */
+	int len;			/* Length of the chunk, 0 for unused */
+	u8 *data;			/* Decompressed data, may be NULL */
+};
+
+/*
+ * Cache of recently decompressed chunks, shared by all compressed files in a
+ * mount.  The filesystem is read-only, so the entries never go stale.
+ */
+struct apfs_chunk_cache {
+	struct mutex lock;
+	struct list_head lru;		/* Most recently used entries first */
+	struct apfs_chunk_cache_entry entries[APFS_CHUNK_CACHE_SIZE];
+};
+
+extern int apfs_workspace_init(void);
+extern void apfs_workspace_exit(void);
+extern void apfs_chunk_cache_init(struct super_block *sb);
+extern void apfs_chunk_cache_destroy(struct super_block *sb);
+extern int apfs_compress_init(struct inode *inode);
+extern void apfs_compress_free(struct inode *inode);
+extern void apfs_compress_flush(void);
+
+extern const struct address_space_operations apfs_compress_aops;
+extern const struct file_operations apfs_compress_file_operations;
+
+#endif	/* _APFS_COMPRESS_H */
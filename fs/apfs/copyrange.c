@@ -0,0 +1,272 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/copyrange.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ *
+ * Copies of file data out of the volume, for bulk extraction to some other
+ * filesystem.  The kernel won't call copy_file_range() across filesystems, so
+ * tools would otherwise read and write every byte, holes included, and leave
+ * a page cache full of data that nobody will read again.  Here the extent map
+ * tells where the holes are, so that they are never read, and the data that
+ * isn't cached already goes straight from the device to the destination.
+ */
+
+#include <linux/bvec.h>
+#include <linux/fs.h>
+#include <linux/iomap.h>
+#include <linux/mm.h>
+#include <linux/pagemap.h>
+#include <linux/sched/signal.h>
+#include <linux/slab.h>
+#include <linux/uio.h>
+#include "apfs.h"
+#include "copyrange.h"
+#include "extents.h"
+#include "ioctl.h"
+
+/*
+ * State of a copy
+ */
+struct apfs_copy {
+	struct file *src;
+	struct file *dst;
+	loff_t src_pos;			/* Next offset to read from @src */
+	loff_t dst_pos;			/* Next offset to write to @dst */
+	unsigned int flags;		/* APFS_COPY_RANGE_* flags */
+
+	struct bio_vec *data;		/* Pages for the data of a chunk */
+	struct bio_vec *zero;		/* The zero page, over and over */
+	unsigned int nr_pages;		/* Number of pages in each array */
+	u64 copied;			/* Bytes of data written */
+	u64 holes;			/* Bytes of holes never read */
+};
+
+/**
+ * apfs_copy_alloc - Allocate the buffers for a copy
+ * @copy:	the copy
+ *
+ * Returns 0 on success, or -ENOMEM in case of failure.
+ */
+static int apfs_copy_alloc(struct apfs_copy *copy)
+{
+	unsigned int i, nr = APFS_COPY_CHUNK_SIZE >> PAGE_SHIFT;
+
+	copy->data = kcalloc(nr, sizeof(*copy->data), GFP_KERNEL);
+	copy->zero = kcalloc(nr, sizeof(*copy->zero), GFP_KERNEL);
+	if (!copy->data || !copy->zero)
+		return -ENOMEM;
+	for (i = 0; i < nr; i++) {
+		copy->data[i].bv_page = alloc_page(GFP_KERNEL);
+		if (!copy->data[i].bv_page)
+			return -ENOMEM;
+		copy->data[i].bv_len = PAGE_SIZE;
+		copy->nr_pages++;
+
+		copy->zero[i].bv_page = ZERO_PAGE(0);
+		copy->zero[i].bv_len = PAGE_SIZE;
+	}
+	return 0;
+}
+
+/**
+ * apfs_copy_free - Free the buffers of a copy
+ * @copy:	the copy
+ */
+static void apfs_copy_free(struct apfs_copy *copy)
+{
+	unsigned int i;
+
+	for (i = 0; i < copy->nr_pages; i++)
+		__free_page(copy->data[i].bv_page);
+	kfree(copy->data);
+	kfree(copy->zero);
+}
+
+/**
+ * apfs_copy_write - Write a whole buffer to the destination of a copy
+ * @copy:	the copy
+ * @vecs:	the buffer, as an array of pages
+ * @len:	bytes to write, no more than APFS_COPY_CHUNK_SIZE
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_copy_write(struct apfs_copy *copy, struct bio_vec *vecs,
+			   size_t len)
+{
+	struct iov_iter iter;
+	ssize_t ret;
+
+	iov_iter_bvec(&iter, WRITE, vecs, DIV_ROUND_UP(len, PAGE_SIZE), len);
+	while (iov_iter_count(&iter)) {
+		ret = vfs_iter_write(copy->dst, &iter, &copy->dst_pos, 0);
+		if (ret < 0)
+			return ret;
+		if (ret == 0)
+			return -EIO;
+	}
+	return 0;
+}
+
+/**
+ * apfs_copy_hole - Leave a hole of the source out of a copy
+ * @copy:	the copy
+ * @len:	length of the hole
+ *
+ * Past the end of the destination there is nothing to overwrite, so the hole
+ * is just skipped.  Below the end, whatever is there gets zeroed.  Returns 0
+ * on success, or a negative error code in case of failure.
+ */
+static int apfs_copy_hole(struct apfs_copy *copy, loff_t len)
+{
+	loff_t dst_size = i_size_read(file_inode(copy->dst));
+	int err;
+
+	copy->holes += len;
+	while (len && copy->dst_pos < dst_size) {
+		size_t chunk = min3(len, dst_size - copy->dst_pos,
+				    (loff_t)APFS_COPY_CHUNK_SIZE);
+
+		err = apfs_copy_write(copy, copy->zero, chunk);
+		if (err)
+			return err;
+		copy->src_pos += chunk;
+		len -= chunk;
+	}
+	copy->src_pos += len;
+	copy->dst_pos += len;
+	return 0;
+}
+
+/**
+ * apfs_copy_data - Copy a chunk of data from the source
+ * @copy:	the copy
+ * @len:	bytes to copy, no more than APFS_COPY_CHUNK_SIZE
+ *
+ * Chunks with none of their pages in the cache are read with direct I/O, if
+ * the caller asked for it and the chunk is aligned to the blocks, so that
+ * cold data never goes through the page cache.  Returns the number of bytes
+ * copied, or a negative error code in case of failure.
+ */
+static ssize_t apfs_copy_data(struct apfs_copy *copy, size_t len)
+{
+	struct file *src = copy->src;
+	/* The slow device of a Fusion container may have bigger sectors */
+	unsigned int align = file_inode(src)->i_sb->s_blocksize - 1;
+	struct iov_iter iter;
+	struct kiocb kiocb;
+	ssize_t ret;
+	int err;
+
+	init_sync_kiocb(&kiocb, src);
+	kiocb.ki_pos = copy->src_pos;
+	if ((copy->flags & APFS_COPY_RANGE_DIRECT) &&
+	    !((copy->src_pos | len) & align) &&
+	    !filemap_range_has_page(src->f_mapping, copy->src_pos,
+				    copy->src_pos + len - 1))
+		kiocb.ki_flags |= IOCB_DIRECT;
+
+	iov_iter_bvec(&iter, READ, copy->data, DIV_ROUND_UP(len, PAGE_SIZE),
+		      len);
+	ret = call_read_iter(src, &kiocb, &iter);
+	if (ret <= 0)
+		return ret ?: -EIO;
+
+	err = apfs_copy_write(copy, copy->data, ret);
+	if (err)
+		return err;
+	copy->src_pos += ret;
+	copy->copied += ret;
+	return ret;
+}
+
+/**
+ * apfs_copy_range - Copy a range of a file to a file in another filesystem
+ * @src:	the file to copy from, open for reading
+ * @dst:	the file to copy to, open for writing
+ * @req:	the request, with its offsets and counters updated on return
+ *
+ * Each mapped extent is copied in chunks as big as the buffer allows; holes
+ * are never read, and are left as holes in the destination when they go past
+ * its end.  On return, the offsets in @req point right after the last byte
+ * copied, so that an interrupted copy can be resumed.  Returns 0 on success,
+ * or a negative error code in case of failure.
+ */
+int apfs_copy_range(struct file *src, struct file *dst,
+		    struct apfs_copy_range_req *req)
+{
+	struct inode *inode = file_inode(src);
+	struct apfs_copy copy = {
+		.src = src,
+		.dst = dst,
+		.src_pos = req->cr_src_off,
+		.dst_pos = req->cr_dst_off,
+		.flags = req->cr_flags,
+	};
+	loff_t end, size = i_size_read(inode);
+	int err;
+
+	if (req->cr_src_off >= size)
+		return 0;
+	end = size;
+	if (req->cr_len < size - req->cr_src_off)
+		end = req->cr_src_off + req->cr_len;
+
+	err = apfs_copy_alloc(&copy);
+	if (err)
+		goto out;
+
+	file_start_write(dst);
+	while (copy.src_pos < end) {
+		struct iomap iomap;
+		loff_t run_end;
+
+		err = apfs_iomap_ops.iomap_begin(inode, copy.src_pos,
+						 end - copy.src_pos,
+						 0 /* flags */, &iomap);
+		if (err)
+			break;
+		run_end = min_t(loff_t, iomap.offset + iomap.length, end);
+		if (run_end <= copy.src_pos) { /* Must never happen */
+			err = -EFSCORRUPTED;
+			break;
+		}
+
+		if (iomap.type == IOMAP_HOLE) {
+			err = apfs_copy_hole(&copy, run_end - copy.src_pos);
+			if (err)
+				break;
+		}
+		while (copy.src_pos < run_end) {
+			ssize_t ret;
+
+			ret = apfs_copy_data(&copy, min_t(loff_t,
+					     run_end - copy.src_pos,
+					     APFS_COPY_CHUNK_SIZE));
+			if (ret < 0) {
+				err = ret;
+				break;
+			}
+			if (fatal_signal_pending(current)) {
+				err = -EINTR;
+				break;
+			}
+			cond_resched();
+		}
+		if (err)
+			break;
+	}
+	file_end_write(dst);
+
+	/* A copy that ends in a hole must still leave the right size */
+	if (!err && copy.dst_pos > i_size_read(file_inode(dst)))
+		err = vfs_truncate(&dst->f_path, copy.dst_pos);
+
+out:
+	req->cr_src_off = copy.src_pos;
+	req->cr_dst_off = copy.dst_pos;
+	req->cr_copied = copy.copied;
+	req->cr_holes = copy.holes;
+	apfs_copy_free(&copy);
+	return err;
+}
@@ -0,0 +1,23 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/copyrange.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_COPYRANGE_H
+#define _APFS_COPYRANGE_H
+
+#include <linux/sizes.h>
+#include <linux/types.h>
+
+struct apfs_copy_range_req;
+struct file;
+
+/* Most bytes handed to the destination in a single write */
+#define APFS_COPY_CHUNK_SIZE	SZ_4M
+
+extern int apfs_copy_range(struct file *src, struct file *dst,
+			   struct apfs_copy_range_req *req);
+
+#endif	/* _APFS_COPYRANGE_H */
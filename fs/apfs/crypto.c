@@ -0,0 +1,554 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/crypto.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ *
+ * Software decryption for volumes encrypted with a single key.  The key is
+ * never read from the keybag: it must be unwrapped in userspace and added to
+ * the keyring as a logon key called "apfs:<volume uuid>".
+ *
+ * The ciphertext is read through the page cache of the device, and each block
+ * is decrypted straight into its own page, so the cached device pages are
+ * never modified.  The cipher works on data units of 512 bytes, each with its
+ * own tweak, so a single block takes several requests; all the requests for a
+ * whole readahead window are issued together and only waited for at the end,
+ * so that asynchronous implementations can work on all of them at once.
+ */
+
+#include <crypto/skcipher.h>
+#include <keys/user-type.h>
+#include <linux/blkdev.h>
+#include <linux/buffer_head.h>
+#include <linux/completion.h>
+#include <linux/highmem.h>
+#include <linux/key.h>
+#include <linux/pagemap.h>
+#include <linux/scatterlist.h>
+#include <linux/slab.h>
+#include <linux/string.h>
+#include "apfs.h"
+#include "crypto.h"
+#include "extents.h"
+#include "inode.h"
+#include "message.h"
+#include "object.h"
+#include "stats.h"
+#include "super.h"
+
+/*
+ * Decryption requests issued together, to be waited for at once
+ */
+struct apfs_crypt_batch {
+	struct super_block *sb;
+	atomic_t pending;		/* Requests in flight, plus one */
+	struct completion done;		/* All requests have finished */
+	int err;			/* First error seen, if any */
+	struct list_head units;		/* Requests to free after completion */
+	unsigned int nr_units;		/* Length of @units */
+};
+
+/*
+ * Decryption request for a single data unit
+ */
+struct apfs_crypt_unit {
+	struct list_head list;		/* Entry in the list of the batch */
+	struct apfs_crypt_batch *batch;
+	struct page *src_page;		/* Reference held until completion */
+	struct scatterlist src;
+	struct scatterlist dst;
+	__le64 iv[2];			/* The tweak, as a little-endian 128 */
+	struct skcipher_request req;	/* Must be last, for its context */
+};
+
+static void apfs_crypt_batch_init(struct apfs_crypt_batch *batch,
+				  struct super_block *sb)
+{
+	batch->sb = sb;
+	atomic_set(&batch->pending, 1);
+	init_completion(&batch->done);
+	batch->err = 0;
+	INIT_LIST_HEAD(&batch->units);
+	batch->nr_units = 0;
+}
+
+/**
+ * apfs_crypt_unit_end - Account for a request that has finished
+ * @batch:	the batch of the request
+ * @err:	result of the request
+ */
+static void apfs_crypt_unit_end(struct apfs_crypt_batch *batch, int err)
+{
+	if (err)
+		cmpxchg(&batch->err, 0, err);
+	if (atomic_dec_and_test(&batch->pending))
+		complete(&batch->done);
+}
+
+static void apfs_crypt_done(struct crypto_async_request *areq, int err)
+{
+	struct apfs_crypt_unit *unit = areq->data;
+
+	/* The request just left the backlog, and is still running */
+	if (err == -EINPROGRESS)
+		return;
+	apfs_crypt_unit_end(unit->batch, err);
+}
+
+/**
+ * apfs_crypt_wait - Wait for all the requests of a batch
+ * @batch:	the batch
+ *
+ * The batch can then be used for more requests, but errors are remembered.
+ * Returns 0 on success, or the first error seen by the batch.
+ */
+static int apfs_crypt_wait(struct apfs_crypt_batch *batch)
+{
+	struct apfs_crypt_unit *unit, *tmp;
+
+	apfs_crypt_unit_end(batch, 0 /* err */);
+	wait_for_completion(&batch->done);
+
+	list_for_each_entry_safe(unit, tmp, &batch->units, list) {
+		list_del(&unit->list);
+		put_page(unit->src_page);
+		kzfree(unit);
+	}
+	if (batch->nr_units)
+		apfs_stat_inc(batch->sb, APFS_STAT_CRYPT_BATCHES);
+	batch->nr_units = 0;
+	atomic_set(&batch->pending, 1);
+	reinit_completion(&batch->done);
+	return batch->err;
+}
+
+/**
+ * apfs_crypt_queue - Start the decryption of a range of a page
+ * @batch:	batch for the requests
+ * @dst:	page for the plaintext
+ * @dst_off:	offset of the plaintext in @dst
+ * @src:	page with the ciphertext
+ * @src_off:	offset of the ciphertext in @src
+ * @len:	length of the range, a multiple of the data unit size
+ * @tweak:	tweak for the first data unit
+ *
+ * Returns 0 on success, or a negative error code in case of failure; the
+ * requests already issued must still be waited for.
+ */
+static int apfs_crypt_queue(struct apfs_crypt_batch *batch, struct page *dst,
+			    unsigned int dst_off, struct page *src,
+			    unsigned int src_off, unsigned int len, u64 tweak)
+{
+	struct crypto_skcipher *tfm = APFS_SB(batch->sb)->s_tfm;
+	unsigned int done;
+	int err;
+
+	for (done = 0; done < len; done += APFS_CRYPT_UNIT_SIZE) {
+		struct apfs_crypt_unit *unit;
+
+		if (batch->nr_units >= APFS_CRYPT_MAX_UNITS) {
+			err = apfs_crypt_wait(batch);
+			if (err)
+				return err;
+		}
+
+		unit = kmalloc(sizeof(*unit) + crypto_skcipher_reqsize(tfm),
+			       GFP_NOFS);
+		if (!unit)
+			return -ENOMEM;
+		unit->batch = batch;
+		get_page(src);
+		unit->src_page = src;
+		sg_init_table(&unit->src, 1);
+		sg_set_page(&unit->src, src, APFS_CRYPT_UNIT_SIZE,
+			    src_off + done);
+		sg_init_table(&unit->dst, 1);
+		sg_set_page(&unit->dst, dst, APFS_CRYPT_UNIT_SIZE,
+			    dst_off + done);
+		unit->iv[0] = cpu_to_le64(tweak +
+					  (done >> APFS_CRYPT_UNIT_BITS));
+		unit->iv[1] = 0;
+
+		skcipher_request_set_tfm(&unit->req, tfm);
+		skcipher_request_set_callback(&unit->req,
+					      CRYPTO_TFM_REQ_MAY_BACKLOG |
+					      CRYPTO_TFM_REQ_MAY_SLEEP,
+					      apfs_crypt_done, unit);
+		skcipher_request_set_crypt(&unit->req, &unit->src, &unit->dst,
+					   APFS_CRYPT_UNIT_SIZE, unit->iv);
+		list_add_tail(&unit->list, &batch->units);
+		batch->nr_units++;
+		atomic_inc(&batch->pending);
+
+		err = crypto_skcipher_decrypt(&unit->req);
+		if (err != -EINPROGRESS && err != -EBUSY)
+			apfs_crypt_unit_end(batch, err);
+	}
+	apfs_stat_add(batch->sb, APFS_STAT_CRYPT_BYTES, len);
+	return 0;
+}
+
+/**
+ * apfs_crypt_block - Decrypt a single block into a page
+ * @sb:		filesystem superblock
+ * @dst:	page for the plaintext, at offset zero
+ * @src:	page with the ciphertext
+ * @src_off:	offset of the ciphertext in @src
+ * @tweak:	tweak for the first data unit of the block
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+int apfs_crypt_block(struct super_block *sb, struct page *dst,
+		     struct page *src, unsigned int src_off, u64 tweak)
+{
+	struct apfs_crypt_batch batch;
+	int err;
+
+	apfs_crypt_batch_init(&batch, sb);
+	err = apfs_crypt_queue(&batch, dst, 0 /* dst_off */, src, src_off,
+			       sb->s_blocksize, tweak);
+	return apfs_crypt_wait(&batch) ?: err;
+}
+
+/**
+ * apfs_crypt_node - Replace the ciphertext of a node with its plaintext
+ * @sb:		filesystem superblock
+ * @obj:	the node object, as read by apfs_object_read()
+ *
+ * The plaintext goes to a new page owned by the object, so the one in the
+ * page cache of the device is left alone.  Metadata blocks are tweaked with
+ * their block number.  Returns 0 on success, or a negative error code in case
+ * of failure.
+ */
+int apfs_crypt_node(struct super_block *sb, struct apfs_object *obj)
+{
+	struct page *page;
+	int err;
+
+	if (obj->nr_pages != 1)
+		return -EOPNOTSUPP;
+	page = alloc_page(GFP_NOFS);
+	if (!page)
+		return -ENOMEM;
+
+	err = apfs_crypt_block(sb, page, obj->page, offset_in_page(obj->data),
+			       obj->block_nr << (sb->s_blocksize_bits -
+						 APFS_CRYPT_UNIT_BITS));
+	if (err) {
+		__free_page(page);
+		return err;
+	}
+	put_page(obj->page);
+	obj->page = page;
+	obj->data = page_address(page);
+	return 0;
+}
+
+/**
+ * apfs_crypt_map - Find where the ciphertext for a block of a file is
+ * @inode:	the file
+ * @pos:	offset of the block in the file
+ * @bno:	on return, the block number in the device
+ * @tweak:	on return, the tweak for the first data unit of the block
+ *
+ * Returns 0 on success, 1 for a hole, or a negative error code in case of
+ * failure.
+ */
+static int apfs_crypt_map(struct inode *inode, loff_t pos, u64 *bno,
+			  u64 *tweak)
+{
+	struct apfs_file_extent ext;
+	u64 off;
+	int err;
+
+	err = apfs_extent_read(inode, pos >> inode->i_blkbits, &ext, false);
+	if (err == -ENODATA)
+		return 1;
+	if (err)
+		return err;
+	if (pos < ext.logical_addr || pos >= ext.logical_addr + ext.len)
+		return 1;
+	if (!ext.phys_block_num)
+		return 1;
+
+	off = pos - ext.logical_addr;
+	*bno = ext.phys_block_num + (off >> inode->i_blkbits);
+	*tweak = ext.crypto_id + (off >> APFS_CRYPT_UNIT_BITS);
+	return 0;
+}
+
+/**
+ * apfs_crypt_readahead - Start the reads of the ciphertext for a file page
+ * @inode:	the file
+ * @page:	page of the file, which may not be in the page cache yet
+ */
+static void apfs_crypt_readahead(struct inode *inode, struct page *page)
+{
+	loff_t pos = page_offset(page);
+	loff_t end = min_t(loff_t, pos + PAGE_SIZE, i_size_read(inode));
+	u64 bno, tweak;
+
+	for (; pos < end; pos += i_blocksize(inode)) {
+		if (apfs_crypt_map(inode, pos, &bno, &tweak) == 0)
+			sb_breadahead(inode->i_sb, bno);
+	}
+}
+
+/**
+ * apfs_crypt_queue_page - Start the decryption of a page of a file
+ * @batch:	batch for the requests
+ * @inode:	the file
+ * @page:	locked page of the file
+ *
+ * Holes, and the blocks past the end of the file, are zeroed right away.
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_crypt_queue_page(struct apfs_crypt_batch *batch,
+				 struct inode *inode, struct page *page)
+{
+	struct address_space *bmap = inode->i_sb->s_bdev->bd_inode->i_mapping;
+	unsigned int bits = PAGE_SHIFT - inode->i_blkbits;
+	unsigned int blocksize = i_blocksize(inode);
+	loff_t size = i_size_read(inode);
+	unsigned int off;
+	int err;
+
+	for (off = 0; off < PAGE_SIZE; off += blocksize) {
+		loff_t pos = page_offset(page) + off;
+		struct page *src;
+		u64 bno, tweak;
+
+		err = pos < size ? apfs_crypt_map(inode, pos, &bno, &tweak) : 1;
+		if (err < 0)
+			return err;
+		if (err) {
+			zero_user(page, off, blocksize);
+			continue;
+		}
+
+		src = read_mapping_page(bmap, bno >> bits, NULL);
+		if (IS_ERR(src))
+			return PTR_ERR(src);
+		err = apfs_crypt_queue(batch, page, off, src,
+				       (bno << inode->i_blkbits) & ~PAGE_MASK,
+				       blocksize, tweak);
+		put_page(src);
+		if (err)
+			return err;
+	}
+	return 0;
+}
+
+/**
+ * apfs_crypt_page_done - Finish the read of a decrypted page
+ * @inode:	the file
+ * @page:	locked page of the file, with its plaintext
+ */
+static void apfs_crypt_page_done(struct inode *inode, struct page *page)
+{
+	loff_t tail = i_size_read(inode) - page_offset(page);
+
+	/* The last block was decrypted whole */
+	if (tail < PAGE_SIZE)
+		zero_user_segment(page, tail, PAGE_SIZE);
+	SetPageUptodate(page);
+	unlock_page(page);
+}
+
+/**
+ * apfs_crypt_readpage - Read a page of a file in an encrypted volume
+ * @page:	locked page of the file
+ *
+ * The page is unlocked when done.  Returns 0 on success, or a negative error
+ * code in case of failure.
+ */
+int apfs_crypt_readpage(struct page *page)
+{
+	struct inode *inode = page->mapping->host;
+	struct apfs_crypt_batch batch;
+	int err, wait_err;
+
+	apfs_crypt_batch_init(&batch, inode->i_sb);
+	err = apfs_crypt_queue_page(&batch, inode, page);
+	wait_err = apfs_crypt_wait(&batch);
+	if (!err)
+		err = wait_err;
+	if (err) {
+		SetPageError(page);
+		unlock_page(page);
+		return err;
+	}
+	apfs_crypt_page_done(inode, page);
+	return 0;
+}
+
+/**
+ * apfs_crypt_readpages - Read a readahead window of an encrypted file
+ * @mapping:	address space of the file
+ * @pages:	pages of the window, not yet in the page cache
+ * @nr_pages:	number of pages in the window
+ *
+ * The reads of the ciphertext for the whole window are started together, and
+ * then the decryption of all the pages goes in a single batch.  In case of
+ * failure the pages are just unlocked, so that the error gets reported when
+ * they are read by themselves.
+ */
+void apfs_crypt_readpages(struct address_space *mapping,
+			  struct list_head *pages, unsigned int nr_pages)
+{
+	struct inode *inode = mapping->host;
+	struct apfs_crypt_batch batch;
+	struct page **added;
+	struct page *page, *tmp;
+	struct blk_plug plug;
+	unsigned int nr = 0, i;
+	int err = 0;
+
+	added = kmalloc_array(nr_pages, sizeof(*added), GFP_NOFS);
+
+	blk_start_plug(&plug);
+	list_for_each_entry(page, pages, lru)
+		apfs_crypt_readahead(inode, page);
+	blk_finish_plug(&plug);
+
+	apfs_crypt_batch_init(&batch, inode->i_sb);
+	list_for_each_entry_safe(page, tmp, pages, lru) {
+		list_del(&page->lru);
+		if (add_to_page_cache_lru(page, mapping, page->index,
+					  readahead_gfp_mask(mapping))) {
+			/* Someone else is reading it already */
+			put_page(page);
+			continue;
+		}
+		if (!added) {
+			/* No memory to keep track of them, go one by one */
+			apfs_crypt_readpage(page);
+			put_page(page);
+			continue;
+		}
+		if (!err)
+			err = apfs_crypt_queue_page(&batch, inode, page);
+		added[nr++] = page;
+	}
+
+	if (!err)
+		err = apfs_crypt_wait(&batch);
+	else
+		apfs_crypt_wait(&batch);
+	for (i = 0; i < nr; i++) {
+		if (err)
+			unlock_page(added[i]);
+		else
+			apfs_crypt_page_done(inode, added[i]);
+		put_page(added[i]);
+	}
+	kfree(added);
+}
+
+/**
+ * apfs_crypt_read_key - Get the volume encryption key from the keyring
+ * @sb:		filesystem superblock
+ * @vek:	on return, the key
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_crypt_read_key(struct super_block *sb, u8 *vek)
+{
+	struct apfs_superblock *vsb_raw = APFS_SB(sb)->s_vsb_raw;
+	const struct user_key_payload *payload;
+	char desc[48];
+	struct key *key;
+	int err = 0;
+
+	snprintf(desc, sizeof(desc), "apfs:%pUb", vsb_raw->apfs_vol_uuid);
+	key = request_key(&key_type_logon, desc, NULL);
+	if (IS_ERR(key)) {
+		apfs_err(sb, "encrypted volume, add its key as logon key %s",
+			 desc);
+		return PTR_ERR(key);
+	}
+
+	down_read(&key->sem);
+	payload = user_key_payload_locked(key);
+	if (!payload) { /* Revoked */
+		err = -EKEYREVOKED;
+	} else if (payload->datalen != APFS_VEK_SIZE) {
+		apfs_err(sb, "key %s should be %d bytes long", desc,
+			 APFS_VEK_SIZE);
+		err = -EINVAL;
+	} else {
+		memcpy(vek, payload->data, APFS_VEK_SIZE);
+	}
+	up_read(&key->sem);
+	key_put(key);
+	return err;
+}
+
+/**
+ * apfs_crypt_init - Set up the cipher for an encrypted volume
+ * @sb:		filesystem superblock, with the volume superblock mapped
+ *
+ * Does nothing for volumes that are not encrypted in software.  Returns 0 on
+ * success, or a negative error code in case of failure.
+ */
+int apfs_crypt_init(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	u64 fs_flags = le64_to_cpu(sbi->s_vsb_raw->apfs_fs_flags);
+	u64 nx_flags = le64_to_cpu(sbi->s_msb_raw->nx_flags);
+	struct crypto_skcipher *tfm;
+	u8 vek[APFS_VEK_SIZE];
+	int err;
+
+	if (fs_flags & APFS_FS_UNENCRYPTED || !(nx_flags & APFS_NX_CRYPTO_SW))
+		return 0;
+	if (!(fs_flags & APFS_FS_ONEKEY)) {
+		apfs_err(sb, "per-file encryption keys are not supported");
+		return -EOPNOTSUPP;
+	}
+	if (sbi->s_nxi->nx_tier2_bdev) {
+		apfs_err(sb, "encrypted fusion containers are not supported");
+		return -EOPNOTSUPP;
+	}
+	if (sb->s_blocksize > PAGE_SIZE) {
+		apfs_err(sb, "encrypted volume with blocks bigger than a page");
+		return -EOPNOTSUPP;
+	}
+
+	err = apfs_crypt_read_key(sb, vek);
+	if (err)
+		return err;
+
+	tfm = crypto_alloc_skcipher("xts(aes)", 0, 0);
+	if (IS_ERR(tfm)) {
+		apfs_err(sb, "unable to allocate the xts(aes) cipher");
+		err = PTR_ERR(tfm);
+		goto out;
+	}
+	err = crypto_skcipher_setkey(tfm, vek, APFS_VEK_SIZE);
+	if (err) {
+		apfs_err(sb, "bad volume encryption key");
+		crypto_free_skcipher(tfm);
+		goto out;
+	}
+	sbi->s_tfm = tfm;
+	apfs_info(sb, "decrypting with %s",
+		  crypto_tfm_alg_driver_name(crypto_skcipher_tfm(tfm)));
+out:
+	memzero_explicit(vek, sizeof(vek));
+	return err;
+}
+
+/**
+ * apfs_crypt_destroy - Free the cipher of an encrypted volume
+ * @sb:		filesystem superblock
+ */
+void apfs_crypt_destroy(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+
+	if (!sbi->s_tfm)
+		return;
+	crypto_free_skcipher(sbi->s_tfm);
+	sbi->s_tfm = NULL;
+}
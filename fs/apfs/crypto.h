@@ -0,0 +1,39 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/crypto.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_CRYPTO_H
+#define _APFS_CRYPTO_H
+
+#include <linux/types.h>
+
+struct address_space;
+struct apfs_object;
+struct list_head;
+struct page;
+struct super_block;
+
+/* Size of the data units of the XTS cipher, each with its own tweak */
+#define APFS_CRYPT_UNIT_SIZE	512
+#define APFS_CRYPT_UNIT_BITS	9
+
+/* Length of a volume encryption key, for AES-128 in XTS mode */
+#define APFS_VEK_SIZE		32
+
+/* Most data units in flight for a single batch */
+#define APFS_CRYPT_MAX_UNITS	1024
+
+extern int apfs_crypt_init(struct super_block *sb);
+extern void apfs_crypt_destroy(struct super_block *sb);
+extern int apfs_crypt_node(struct super_block *sb, struct apfs_object *obj);
+extern int apfs_crypt_block(struct super_block *sb, struct page *dst,
+			    struct page *src, unsigned int src_off, u64 tweak);
+extern int apfs_crypt_readpage(struct page *page);
+extern void apfs_crypt_readpages(struct address_space *mapping,
+				 struct list_head *pages,
+				 unsigned int nr_pages);
+
+#endif	/* _APFS_CRYPTO_H */
@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/dax.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ *
+ * Direct access to the data of regular files, for images kept on persistent
+ * memory.  Reads and page faults are served from the memory of the device
+ * through the usual iomap mappings, so file data never goes through the page
+ * cache.  Metadata is still read through the page cache of the device: nodes
+ * stay in our caches for a long time, and the device memory may only be
+ * referenced inside a dax_read_lock() section.
+ */
+
+#include <linux/dax.h>
+#include <linux/fs.h>
+#include <linux/mm.h>
+#include <linux/uio.h>
+#include "apfs.h"
+#include "dax.h"
+#include "extents.h"
+#include "inode.h"
+#include "message.h"
+#include "super.h"
+
+/**
+ * apfs_dax_init - Get the dax device for a mount with the dax option
+ * @sb:		filesystem superblock, with the cipher already set up
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+int apfs_dax_init(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+
+	if (!(sbi->s_flags & APFS_DAX))
+		return 0;
+	if (sbi->s_tfm) {
+		apfs_err(sb, "dax is not supported for encrypted volumes");
+		return -EINVAL;
+	}
+	if (sbi->s_nxi->nx_tier2_bdev) {
+		apfs_err(sb, "dax is not supported for fusion containers");
+		return -EINVAL;
+	}
+	if (!bdev_dax_supported(sb->s_bdev, sb->s_blocksize)) {
+		apfs_err(sb, "dax is not supported by the device");
+		return -EINVAL;
+	}
+	sbi->s_daxdev = fs_dax_get_by_bdev(sb->s_bdev);
+	if (!sbi->s_daxdev)
+		return -EINVAL;
+	apfs_warn(sb, "dax is experimental");
+	return 0;
+}
+
+/**
+ * apfs_dax_destroy - Put the dax device of a mount
+ * @sb:		filesystem superblock
+ */
+void apfs_dax_destroy(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+
+	fs_put_dax(sbi->s_daxdev);
+	sbi->s_daxdev = NULL;
+}
+
+/**
+ * apfs_dax_read_iter - Read from a file in device memory
+ * @iocb:	the read request
+ * @to:		destination of the data
+ *
+ * Returns the number of bytes read, or a negative error code in case of
+ * failure.
+ */
+ssize_t apfs_dax_read_iter(struct kiocb *iocb, struct iov_iter *to)
+{
+	struct inode *inode = file_inode(iocb->ki_filp);
+	ssize_t ret;
+
+	if (!iov_iter_count(to))
+		return 0;
+
+	if (iocb->ki_flags & IOCB_NOWAIT) {
+		if (!inode_trylock_shared(inode))
+			return -EAGAIN;
+	} else {
+		inode_lock_shared(inode);
+	}
+	ret = dax_iomap_rw(iocb, to, &apfs_iomap_ops);
+	inode_unlock_shared(inode);
+
+	file_accessed(iocb->ki_filp);
+	return ret;
+}
+
+static vm_fault_t apfs_dax_huge_fault(struct vm_fault *vmf,
+				      enum page_entry_size pe_size)
+{
+	return dax_iomap_fault(vmf, pe_size, NULL /* pfnp */, NULL /* errp */,
+			       &apfs_iomap_ops);
+}
+
+static vm_fault_t apfs_dax_fault(struct vm_fault *vmf)
+{
+	return apfs_dax_huge_fault(vmf, PE_SIZE_PTE);
+}
+
+static const struct vm_operations_struct apfs_dax_vm_ops = {
+	.fault		= apfs_dax_fault,
+	.huge_fault	= apfs_dax_huge_fault,
+};
+
+/**
+ * apfs_dax_mmap - Map a file in device memory
+ * @file:	the file
+ * @vma:	the new mapping
+ *
+ * Shared writable mappings are refused, as for files in the page cache.
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+int apfs_dax_mmap(struct file *file, struct vm_area_struct *vma)
+{
+	if ((vma->vm_flags & VM_SHARED) && (vma->vm_flags & VM_MAYWRITE))
+		return -EINVAL;
+	file_accessed(file);
+	vma->vm_ops = &apfs_dax_vm_ops;
+	vma->vm_flags |= VM_MIXEDMAP | VM_HUGEPAGE;
+	return 0;
+}
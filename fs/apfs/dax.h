@@ -0,0 +1,24 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/dax.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_DAX_H
+#define _APFS_DAX_H
+
+#include <linux/types.h>
+
+struct file;
+struct iov_iter;
+struct kiocb;
+struct super_block;
+struct vm_area_struct;
+
+extern int apfs_dax_init(struct super_block *sb);
+extern void apfs_dax_destroy(struct super_block *sb);
+extern ssize_t apfs_dax_read_iter(struct kiocb *iocb, struct iov_iter *to);
+extern int apfs_dax_mmap(struct file *file, struct vm_area_struct *vma);
+
+#endif	/* _APFS_DAX_H */
@@ -0,0 +1,459 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/debugfs.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ *
+ * Inspection of the trees and caches of each mount, under
+ * /sys/kernel/debug/apfs/<device>/
+ */
+
+#include <linux/debugfs.h>
+#include <linux/jiffies.h>
+#include <linux/log2.h>
+#include <linux/sched/signal.h>
+#include <linux/seq_file.h>
+#include <linux/slab.h>
+#include "apfs.h"
+#include "btree.h"
+#include "debugfs.h"
+#include "key.h"
+#include "node.h"
+#include "stats.h"
+#include "super.h"
+
+/* The /sys/kernel/debug/apfs directory */
+static struct dentry *apfs_debugfs_root;
+
+/*
+ * Directory found by a catalog walk, with its number of dentry records
+ */
+struct apfs_debug_dir {
+	u64 id;
+	u64 count;
+};
+
+/*
+ * Shape of a b-tree, as found by a walk.  Levels are counted from the leaves.
+ */
+struct apfs_debug_tree {
+	unsigned int depth;
+	u64 nodes[APFS_BTREE_MAX_DEPTH];	/* Nodes in each level */
+	u64 records[APFS_BTREE_MAX_DEPTH];	/* Records in each level */
+	u64 fanout[APFS_DEBUG_FANOUT_BUCKETS];	/* Index nodes by log2 fanout */
+	u64 fill[APFS_DEBUG_FILL_BUCKETS];	/* Nodes by tenths filled */
+	u64 types[APFS_TYPE_MAX + 1];		/* Leaf records by type */
+
+	/* Catalog only: the directories with most children */
+	struct apfs_debug_dir dirs[APFS_DEBUG_DIRS];
+	struct apfs_debug_dir curr_dir;		/* Directory being counted */
+};
+
+/**
+ * apfs_debug_dir_done - Rank a directory once all its records are counted
+ * @tree:	tree shape
+ */
+static void apfs_debug_dir_done(struct apfs_debug_tree *tree)
+{
+	struct apfs_debug_dir *dirs = tree->dirs;
+	int i;
+
+	if (tree->curr_dir.count <= dirs[APFS_DEBUG_DIRS - 1].count)
+		return;
+	for (i = APFS_DEBUG_DIRS - 1; i > 0; --i) {
+		if (dirs[i - 1].count >= tree->curr_dir.count)
+			break;
+		dirs[i] = dirs[i - 1];
+	}
+	dirs[i] = tree->curr_dir;
+}
+
+/**
+ * apfs_debug_count_record - Count a leaf record of a catalog walk
+ * @tree:	tree shape
+ * @key:	key of the record
+ *
+ * The dentry records of a directory are contiguous in the catalog, so their
+ * count is over as soon as a record for another directory shows up.
+ */
+static void apfs_debug_count_record(struct apfs_debug_tree *tree,
+				    struct apfs_key *key)
+{
+	if (key->type <= APFS_TYPE_MAX)
+		tree->types[key->type]++;
+	if (key->type != APFS_TYPE_DIR_REC)
+		return;
+	if (key->id != tree->curr_dir.id) {
+		apfs_debug_dir_done(tree);
+		tree->curr_dir.id = key->id;
+		tree->curr_dir.count = 0;
+	}
+	tree->curr_dir.count++;
+}
+
+/**
+ * apfs_debug_walk - Walk a subtree to find its shape
+ * @sb:		filesystem superblock
+ * @node:	root of the subtree, which the caller holds
+ * @flags:	tree type
+ * @tree:	tree shape to update
+ *
+ * Returns 0 on success, -EINTR if the reader got killed, or another negative
+ * error code in case of failure.
+ */
+static int apfs_debug_walk(struct super_block *sb, struct apfs_node *node,
+			   unsigned int flags, struct apfs_debug_tree *tree)
+{
+	struct apfs_btree_node_phys *raw;
+	struct apfs_query query;
+	unsigned int level, fill;
+	int err = 0;
+
+	raw = (struct apfs_btree_node_phys *)node->object.data;
+	level = le16_to_cpu(raw->btn_level);
+	if (level >= APFS_BTREE_MAX_DEPTH)
+		return -EFSCORRUPTED;
+
+	tree->depth = max(tree->depth, level + 1);
+	tree->nodes[level]++;
+	tree->records[level] += node->records;
+	fill = (node->object.size - le16_to_cpu(raw->btn_free_space.len)) *
+	       (APFS_DEBUG_FILL_BUCKETS - 1) / node->object.size;
+	tree->fill[min(fill, APFS_DEBUG_FILL_BUCKETS - 1U)]++;
+	if (!apfs_node_is_leaf(node))
+		tree->fanout[min_t(unsigned int, ilog2(node->records | 1),
+				   APFS_DEBUG_FANOUT_BUCKETS - 1)]++;
+	else if ((flags & APFS_QUERY_TREE_MASK) != APFS_QUERY_CAT)
+		return 0;
+
+	apfs_init_query(&query, node);
+	query.flags = flags;
+	for (query.index = 0; query.index < node->records; query.index++) {
+		struct apfs_node *child;
+		struct apfs_key key;
+
+		if (fatal_signal_pending(current)) {
+			err = -EINTR;
+			break;
+		}
+
+		err = apfs_node_read_record(&query, &key);
+		if (err)
+			break;
+		if (apfs_node_is_leaf(node)) {
+			apfs_debug_count_record(tree, &key);
+			continue;
+		}
+
+		child = apfs_query_read_child(sb, &query);
+		if (IS_ERR(child)) {
+			err = PTR_ERR(child);
+			break;
+		}
+		err = apfs_debug_walk(sb, child, flags, tree);
+		apfs_node_put(child);
+		if (err)
+			break;
+		cond_resched();
+	}
+	apfs_free_query(sb, &query);
+	return err;
+}
+
+static const char * const apfs_debug_type_names[] = {
+	[APFS_TYPE_SNAP_METADATA]	= "snap_metadata",
+	[APFS_TYPE_EXTENT]		= "extent",
+	[APFS_TYPE_INODE]		= "inode",
+	[APFS_TYPE_XATTR]		= "xattr",
+	[APFS_TYPE_SIBLING_LINK]	= "sibling_link",
+	[APFS_TYPE_DSTREAM_ID]		= "dstream_id",
+	[APFS_TYPE_CRYPTO_STATE]	= "crypto_state",
+	[APFS_TYPE_FILE_EXTENT]		= "file_extent",
+	[APFS_TYPE_DIR_REC]		= "dir_rec",
+	[APFS_TYPE_DIR_STATS]		= "dir_stats",
+	[APFS_TYPE_SNAP_NAME]		= "snap_name",
+	[APFS_TYPE_SIBLING_MAP]		= "sibling_map",
+};
+
+static void apfs_debug_show_tree(struct seq_file *m, const char *name,
+				 struct apfs_debug_tree *tree)
+{
+	int i;
+
+	seq_printf(m, "%s:\n  depth: %u\n", name, tree->depth);
+	for (i = tree->depth - 1; i >= 0; --i)
+		seq_printf(m, "  level %d: %llu nodes, %llu records\n", i,
+			   tree->nodes[i], tree->records[i]);
+
+	seq_puts(m, "  fanout:");
+	for (i = 0; i < APFS_DEBUG_FANOUT_BUCKETS; ++i)
+		if (tree->fanout[i])
+			seq_printf(m, " %lu-%lu:%llu", 1UL << i,
+				   (2UL << i) - 1, tree->fanout[i]);
+	seq_puts(m, "\n  fill:");
+	for (i = 0; i < APFS_DEBUG_FILL_BUCKETS; ++i)
+		seq_printf(m, " %d%%:%llu", i * 10, tree->fill[i]);
+	seq_putc(m, '\n');
+}
+
+/**
+ * apfs_debug_walk_trees - Find the shape of the omap and catalog of a mount
+ * @sb:		filesystem superblock
+ * @omap:	on return, shape of the omap
+ * @cat:	on return, shape of the catalog
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_debug_walk_trees(struct super_block *sb,
+				 struct apfs_debug_tree *omap,
+				 struct apfs_debug_tree *cat)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	int err;
+
+	err = apfs_debug_walk(sb, sbi->s_omap_root, APFS_QUERY_OMAP, omap);
+	if (err)
+		return err;
+	err = apfs_debug_walk(sb, sbi->s_cat_root, APFS_QUERY_CAT, cat);
+	if (err)
+		return err;
+	apfs_debug_dir_done(cat);
+	return 0;
+}
+
+static int apfs_debug_trees_show(struct seq_file *m, void *v)
+{
+	struct super_block *sb = m->private;
+	struct apfs_debug_tree *trees;
+	int i, err;
+
+	trees = kcalloc(2, sizeof(*trees), GFP_KERNEL);
+	if (!trees)
+		return -ENOMEM;
+	err = apfs_debug_walk_trees(sb, &trees[0], &trees[1]);
+	if (err)
+		goto out;
+
+	apfs_debug_show_tree(m, "omap", &trees[0]);
+	apfs_debug_show_tree(m, "catalog", &trees[1]);
+	seq_puts(m, "  records:\n");
+	for (i = 0; i <= APFS_TYPE_MAX; ++i) {
+		const char *name = NULL;
+
+		if (!trees[1].types[i])
+			continue;
+		if (i < ARRAY_SIZE(apfs_debug_type_names))
+			name = apfs_debug_type_names[i];
+		if (name)
+			seq_printf(m, "    %s: %llu\n", name, trees[1].types[i]);
+		else
+			seq_printf(m, "    type %d: %llu\n", i,
+				   trees[1].types[i]);
+	}
+out:
+	kfree(trees);
+	return err;
+}
+
+static int apfs_debug_dirs_show(struct seq_file *m, void *v)
+{
+	struct super_block *sb = m->private;
+	struct apfs_debug_tree *trees;
+	int i, err;
+
+	trees = kcalloc(2, sizeof(*trees), GFP_KERNEL);
+	if (!trees)
+		return -ENOMEM;
+	err = apfs_debug_walk_trees(sb, &trees[0], &trees[1]);
+	if (err)
+		goto out;
+
+	for (i = 0; i < APFS_DEBUG_DIRS && trees[1].dirs[i].count; ++i)
+		seq_printf(m, "0x%llx %llu\n", trees[1].dirs[i].id,
+			   trees[1].dirs[i].count);
+out:
+	kfree(trees);
+	return err;
+}
+
+static void apfs_debug_show_node(struct seq_file *m, struct apfs_node *node)
+{
+	struct apfs_btree_node_phys *raw;
+
+	raw = (struct apfs_btree_node_phys *)node->object.data;
+	seq_printf(m, "0x%llx 0x%llx %u %u %u %c%c %u\n",
+		   node->object.block_nr, node->object.oid,
+		   le16_to_cpu(raw->btn_level), node->records,
+		   jiffies_to_msecs(jiffies - node->time),
+		   test_bit(APFS_NODE_HOT, &node->state) ? 'h' : '-',
+		   test_bit(APFS_NODE_PINNED, &node->state) ? 'p' : '-',
+		   kref_read(&node->refcount));
+}
+
+static enum lru_status apfs_debug_show_lru(struct list_head *item,
+					   struct list_lru_one *lru,
+					   spinlock_t *lru_lock, void *arg)
+{
+	apfs_debug_show_node(arg, container_of(item, struct apfs_node, lru));
+	return LRU_SKIP;
+}
+
+static int apfs_debug_node_cache_show(struct seq_file *m, void *v)
+{
+	struct super_block *sb = m->private;
+	struct apfs_node_cache *cache = &APFS_SB(sb)->s_node_cache;
+	struct apfs_node *node;
+
+	seq_puts(m, "# block oid level records age_ms flags refs\n");
+	spin_lock(&cache->pin_lock);
+	seq_printf(m, "# %lu cached, %lu pinned, limit %lu, %u bytes each\n",
+		   list_lru_count(&cache->lru), cache->nr_pinned, cache->max,
+		   apfs_node_size());
+	list_for_each_entry(node, &cache->pinned, lru)
+		apfs_debug_show_node(m, node);
+	spin_unlock(&cache->pin_lock);
+	/* Least recently used first, for each NUMA node */
+	list_lru_walk(&cache->lru, apfs_debug_show_lru, m, ULONG_MAX);
+	return 0;
+}
+
+/*
+ * Only the regions that were read get a line, with the byte offset of their
+ * start and the counts of node reads and of file data reads.
+ */
+static int apfs_debug_heatmap_show(struct seq_file *m, void *v)
+{
+	struct super_block *sb = m->private;
+	struct apfs_heatmap *heat = APFS_SB(sb)->s_heatmap;
+	unsigned long i;
+
+	seq_printf(m, "region_bytes %llu\n", 1ULL << heat->shift);
+	for (i = 0; i < heat->nr; ++i) {
+		atomic_t *counts = heat->counts[i];
+		unsigned int nodes = atomic_read(&counts[APFS_HEAT_NODE]);
+		unsigned int data = atomic_read(&counts[APFS_HEAT_DATA]);
+
+		if (!nodes && !data)
+			continue;
+		seq_printf(m, "0x%llx %u %u\n", (u64)i << heat->shift, nodes,
+			   data);
+		if (i % 1024 == 0)
+			cond_resched();
+	}
+	return 0;
+}
+
+#ifdef CONFIG_APFS_DEBUG
+
+static const char * const apfs_debug_lat_names[APFS_NR_LATS] = {
+	[APFS_LAT_OMAP_EXACT]		= "omap_exact",
+	[APFS_LAT_OMAP_MULTIPLE]	= "omap_multiple",
+	[APFS_LAT_OMAP_NEXT]		= "omap_next",
+	[APFS_LAT_CAT_EXACT]		= "cat_exact",
+	[APFS_LAT_CAT_MULTIPLE]		= "cat_multiple",
+	[APFS_LAT_CAT_NEXT]		= "cat_next",
+	[APFS_LAT_NODE_READ]		= "node_read",
+	[APFS_LAT_DECOMPRESS]		= "decompress_chunk",
+};
+
+/*
+ * Each histogram gets a line with the count for every bucket; the bucket n
+ * holds the latencies from 2^n to 2^(n+1) - 1 nanoseconds.
+ */
+static int apfs_debug_latency_show(struct seq_file *m, void *v)
+{
+	struct super_block *sb = m->private;
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	int item, bucket;
+
+	for (item = 0; item < APFS_NR_LATS; ++item) {
+		seq_printf(m, "%-16s", apfs_debug_lat_names[item]);
+		for (bucket = 0; bucket < APFS_LAT_BUCKETS; ++bucket)
+			seq_printf(m, " %llu", apfs_lat_read(sbi, item, bucket));
+		seq_putc(m, '\n');
+	}
+	return 0;
+}
+
+#endif	/* CONFIG_APFS_DEBUG */
+
+#define APFS_DEBUG_FILE(name)						\
+static int apfs_debug_##name##_open(struct inode *inode,		\
+				    struct file *file)			\
+{									\
+	return single_open(file, apfs_debug_##name##_show,		\
+			   inode->i_private);				\
+}									\
+static const struct file_operations apfs_debug_##name##_fops = {	\
+	.owner		= THIS_MODULE,					\
+	.open		= apfs_debug_##name##_open,			\
+	.read		= seq_read,					\
+	.llseek		= seq_lseek,					\
+	.release	= single_release,				\
+}
+
+APFS_DEBUG_FILE(trees);
+APFS_DEBUG_FILE(dirs);
+APFS_DEBUG_FILE(node_cache);
+APFS_DEBUG_FILE(heatmap);
+#ifdef CONFIG_APFS_DEBUG
+APFS_DEBUG_FILE(latency);
+#endif
+
+/**
+ * apfs_debugfs_register - Create the debugfs directory for a new mount
+ * @sb:		filesystem superblock
+ *
+ * The directory has the same name as in sysfs.  Debugfs failures are not
+ * reported, the mount goes on without it.  The tree files walk the whole
+ * omap and catalog each time they are read, so they may take a while.
+ */
+void apfs_debugfs_register(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct dentry *dir;
+
+	dir = debugfs_create_dir(kobject_name(&sbi->s_kobj),
+				 apfs_debugfs_root);
+	sbi->s_debugfs = dir;
+	debugfs_create_file("trees", 0400, dir, sb, &apfs_debug_trees_fops);
+	debugfs_create_file("largest_dirs", 0400, dir, sb,
+			    &apfs_debug_dirs_fops);
+	debugfs_create_file("node_cache", 0400, dir, sb,
+			    &apfs_debug_node_cache_fops);
+	if (sbi->s_heatmap)
+		debugfs_create_file("heatmap", 0400, dir, sb,
+				    &apfs_debug_heatmap_fops);
+#ifdef CONFIG_APFS_DEBUG
+	debugfs_create_file("latency", 0400, dir, sb,
+			    &apfs_debug_latency_fops);
+#endif
+}
+
+/**
+ * apfs_debugfs_unregister - Remove the debugfs directory of a mount
+ * @sb:		filesystem superblock
+ */
+void apfs_debugfs_unregister(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+
+	debugfs_remove_recursive(sbi->s_debugfs);
+	sbi->s_debugfs = NULL;
+}
+
+/**
+ * apfs_debugfs_init - Create the debugfs directory for the module
+ */
+void __init apfs_debugfs_init(void)
+{
+	apfs_debugfs_root = debugfs_create_dir("apfs", NULL);
+}
+
+/**
+ * apfs_debugfs_exit - Remove the debugfs directory of the module
+ */
+void apfs_debugfs_exit(void)
+{
+	debugfs_remove_recursive(apfs_debugfs_root);
+}
@@ -0,0 +1,29 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/debugfs.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_DEBUGFS_H
+#define _APFS_DEBUGFS_H
+
+#include <linux/types.h>
+
+struct super_block;
+
+/* Buckets for the fanout histograms, by log2 of the record count */
+#define APFS_DEBUG_FANOUT_BUCKETS	17
+
+/* Buckets for the fill factor histograms, one per tenth of the node */
+#define APFS_DEBUG_FILL_BUCKETS		11
+
+/* Number of directories to report in largest_dirs */
+#define APFS_DEBUG_DIRS			16
+
+extern void apfs_debugfs_register(struct super_block *sb);
+extern void apfs_debugfs_unregister(struct super_block *sb);
+extern void __init apfs_debugfs_init(void);
+extern void apfs_debugfs_exit(void);
+
+#endif	/* _APFS_DEBUGFS_H */
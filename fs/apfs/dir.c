@@ -7,13 +7,23 @@
 
 #include <linux/slab.h>
 #include <linux/buffer_head.h>
+#include <linux/mm.h>
+#include <linux/sort.h>
+#include <linux/workqueue.h>
 #include "apfs.h"
 #include "btree.h"
 #include "dir.h"
+#include "dirindex.h"
+#include "inode.h"
+#include "ioctl.h"
 #include "key.h"
 #include "message.h"
+#include "namecache.h"
 #include "node.h"
+#include "stats.h"
 #include "super.h"
+#include "trace.h"
+#include "unicode.h"
 
 /**
  * apfs_drec_from_query - Read the directory record found by a successful query
@@ -29,7 +39,7 @@
  */
 int apfs_drec_from_query(struct apfs_query *query, struct apfs_drec *drec)
 {
-	char *raw = query->node->object.bh->b_data;
+	char *raw = query->node->object.data;
 	struct apfs_drec_hashed_key *de_key;
 	struct apfs_drec_val *de;
 	int namelen = query->key_len - sizeof(*de_key);
@@ -53,6 +63,8 @@ int apfs_drec_from_query(struct apfs_query *query, struct apfs_drec *drec)
 	drec->name = de_key->name;
 	drec->name_len = namelen - 1; /* Don't count the NULL termination */
 	drec->ino = le64_to_cpu(de->file_id);
+	drec->hash = le32_to_cpu(de_key->name_len_and_hash) &
+		     APFS_DREC_HASH_MASK;
 
 	drec->type = le16_to_cpu(de->flags) & APFS_DREC_TYPE_MASK;
 	if (drec->type != DT_FIFO && drec->type & 1) /* Invalid file type */
@@ -60,31 +72,75 @@ int apfs_drec_from_query(struct apfs_query *query, struct apfs_drec *drec)
 	return 0;
 }
 
+/**
+ * apfs_drec_name_match - Check if a directory record has the wanted name
+ * @sb:		filesystem superblock
+ * @child:	the wanted name
+ * @nchild:	normalization of @child, built on the first call that needs it;
+ *		@nchild->chars must be NULL before that
+ * @name:	name in the directory record
+ *
+ * The wanted name is normalized only once for all the candidates that share
+ * its hash, and each of them is then checked with a memcmp().  Returns 1 if
+ * the names match, 0 if they don't, or -ENOMEM in case of failure.
+ */
+static int apfs_drec_name_match(struct super_block *sb, const char *child,
+				struct apfs_nname *nchild, const char *name)
+{
+	bool case_fold = apfs_is_case_insensitive(sb);
+	struct apfs_nname nname;
+	int err;
+
+	/* Most matches have the same bytes, don't bother normalizing them */
+	if (!strcmp(child, name))
+		return 1;
+
+	if (!nchild->chars) {
+		err = apfs_normalize_name(child, case_fold, nchild);
+		if (err)
+			return err;
+	}
+	err = apfs_normalize_name(name, case_fold, &nname);
+	if (!err)
+		err = apfs_nname_equal(nchild, &nname);
+	apfs_nname_free(&nname);
+	return err;
+}
+
 /**
  * apfs_inode_by_name - Find the cnid for a given filename
  * @dir:	parent directory
  * @child:	filename
+ * @hash:	hash of @child, from apfs_filename_hash()
  * @ino:	on return, the inode number found
  *
  * Returns 0 and the inode number (which is the cnid of the file
  * record); otherwise, return the appropriate error code.
  */
-int apfs_inode_by_name(struct inode *dir, const struct qstr *child, u64 *ino)
+int apfs_inode_by_name(struct inode *dir, const struct qstr *child, u32 hash,
+		       u64 *ino)
 {
 	struct super_block *sb = dir->i_sb;
 	struct apfs_sb_info *sbi = APFS_SB(sb);
 	struct apfs_key key;
-	struct apfs_query *query;
+	struct apfs_query query;
 	struct apfs_drec drec;
+	struct apfs_nname nchild;
 	u64 cnid = dir->i_ino;
 	int err;
 
-	apfs_init_drec_hashed_key(sb, cnid, child->name, &key);
+	apfs_init_drec_key_by_hash(cnid, hash, &key);
 
-	query = apfs_alloc_query(sbi->s_cat_root, NULL /* parent */);
-	if (!query)
-		return -ENOMEM;
-	query->key = &key;
+	if (sbi->s_flags & APFS_DIR_INDEX) {
+		err = apfs_dir_index_lookup(dir, child, key.number, ino);
+		if (err != -EAGAIN)
+			return err;
+		if (!apfs_dir_bloom_check(dir, key.number))
+			return -ENODATA;
+	}
+
+	apfs_init_query(&query, sbi->s_cat_root);
+	query.key = &key;
 
 	/*
 	 * Distinct filenames in the same directory may (rarely) share the same
@@ -92,31 +148,172 @@ int apfs_inode_by_name(struct inode *dir, const struct qstr *child, u64 *ino)
 	 * b-tree would	depend on their unnormalized original names.  Just get
 	 * all the candidates and check them one by one.
 	 */
-	query->flags |= APFS_QUERY_CAT | APFS_QUERY_ANY_NAME | APFS_QUERY_EXACT;
+	query.flags |= APFS_QUERY_CAT | APFS_QUERY_ANY_NAME | APFS_QUERY_EXACT;
+	nchild.chars = NULL;
 	do {
 		err = apfs_btree_query(sb, &query);
 		if (err)
 			goto out;
-		err = apfs_drec_from_query(query, &drec);
+		err = apfs_drec_from_query(&query, &drec);
 		if (err)
 			goto out;
-	} while (unlikely(apfs_filename_cmp(sb, child->name, drec.name)));
+		err = apfs_drec_name_match(sb, child->name, &nchild, drec.name);
+		if (err < 0)
+			goto out;
+	} while (unlikely(!err));
 
+	err = 0;
 	*ino = drec.ino;
 out:
-	apfs_free_query(sb, query);
+	apfs_nname_free(&nchild);
+	apfs_free_query(sb, &query);
+	if (err == -ENODATA && sbi->s_flags & APFS_DIR_INDEX)
+		apfs_dir_bloom_miss(dir);
 	return err;
 }
 
+/**
+ * apfs_readdir_resume - Position a readdir scan on the record of a cursor
+ * @sb:		filesystem superblock
+ * @query:	iterator for all the records of the directory, not yet in place
+ * @any_key:	key for all the records of the directory
+ * @cursor:	the cursor
+ *
+ * Records with the same hash are not ordered by name in any way we know, so
+ * seek to the first of them and look for the name among them.  Returns 0 on
+ * success, -ENODATA if the directory has no more records, or another negative
+ * error code in case of failure.
+ */
+static int apfs_readdir_resume(struct super_block *sb,
+			       struct apfs_query *query,
+			       struct apfs_key *any_key,
+			       struct apfs_dir_cursor *cursor)
+{
+	struct apfs_key key = *any_key;
+	int err;
+
+	key.number = cursor->hash;
+	query->key = &key;
+	query->flags &= ~APFS_QUERY_ANY_NUMBER;
+	err = apfs_btree_iter_seek(sb, query);
+	if (err)
+		return err;
+	/* From here on, any record of the directory is a match */
+	apfs_btree_iter_widen(query, any_key, APFS_QUERY_ANY_NUMBER);
+
+	while (1) {
+		struct apfs_drec drec;
+
+		err = apfs_drec_from_query(query, &drec);
+		if (err)
+			return err;
+		if (drec.hash != cursor->hash)
+			return 0;
+		if (drec.name_len == cursor->name_len &&
+		    !memcmp(drec.name, cursor->name, drec.name_len))
+			return 0;
+		err = apfs_btree_iter_next(sb, query);
+		if (err)
+			return err;
+	}
+}
+
+/**
+ * apfs_readdir_save - Remember where a readdir scan stopped
+ * @cursor:	the cursor to set
+ * @drec:	next record to emit
+ * @pos:	position of @drec
+ */
+static void apfs_readdir_save(struct apfs_dir_cursor *cursor,
+			      struct apfs_drec *drec, loff_t pos)
+{
+	cursor->pos = pos;
+	cursor->at_end = false;
+	cursor->hash = drec->hash;
+	cursor->name_len = drec->name_len;
+	memcpy(cursor->name, drec->name, drec->name_len);
+}
+
+static int apfs_cnid_cmp(const void *a, const void *b)
+{
+	u64 cnid_a = *(const u64 *)a;
+	u64 cnid_b = *(const u64 *)b;
+
+	if (cnid_a == cnid_b)
+		return 0;
+	return cnid_a < cnid_b ? -1 : 1;
+}
+
+/**
+ * apfs_readdir_prefetch - Bring the inodes just listed into the inode cache
+ * @sb:		filesystem superblock
+ * @cursor:	cursor with the inode numbers emitted by the last readdir call
+ *
+ * Listings are often followed by a stat() of every entry, so read all the
+ * inodes now, in cnid order: their records are then found in consecutive
+ * catalog leaves, in a single walk of the tree.  This is only a hint, so any
+ * errors are ignored.
+ */
+static void apfs_readdir_prefetch(struct super_block *sb,
+				  struct apfs_dir_cursor *cursor)
+{
+	sort(cursor->prefetch, cursor->nr_prefetch, sizeof(u64),
+	     apfs_cnid_cmp, NULL);
+	apfs_iget_many(sb, cursor->prefetch, cursor->nr_prefetch);
+	cursor->nr_prefetch = 0;
+}
+
+/**
+ * apfs_readdir_listing - Emit the children of a directory from its listing
+ * @inode:	the directory
+ * @ctx:	the readdir context, past the dot entries
+ * @cursor:	the cursor of the open directory
+ * @listing:	the listing of @inode
+ *
+ * The position of each record is its index in the listing, so this may start
+ * anywhere with no scan at all.
+ */
+static void apfs_readdir_listing(struct inode *inode, struct dir_context *ctx,
+				 struct apfs_dir_cursor *cursor,
+				 struct apfs_dir_listing *listing)
+{
+	struct super_block *sb = inode->i_sb;
+	loff_t i, start_pos = ctx->pos;
+
+	for (i = ctx->pos - 2; i < listing->nr; i++) {
+		struct apfs_dir_listing_entry *entry = &listing->entries[i];
+		char *name = listing->names + entry->name_off;
+
+		if (!dir_emit(ctx, name, entry->name_len, entry->cnid,
+			      entry->type))
+			break;
+		ctx->pos++;
+		apfs_name_cache_insert(sb, entry->cnid, inode->i_ino, name,
+				       entry->name_len);
+		if (cursor->nr_prefetch < APFS_READDIR_PREFETCH)
+			cursor->prefetch[cursor->nr_prefetch++] = entry->cnid;
+	}
+	if (i >= listing->nr) { /* Got all the records */
+		cursor->pos = ctx->pos;
+		cursor->at_end = true;
+	}
+
+	apfs_stat_inc(sb, APFS_STAT_LISTING_HITS);
+	trace_apfs_readdir(inode, start_pos, 0, ctx->pos - start_pos, 0);
+}
+
 static int apfs_readdir(struct file *file, struct dir_context *ctx)
 {
 	struct inode *inode = file_inode(file);
 	struct super_block *sb = inode->i_sb;
 	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_dir_cursor *cursor = file->private_data;
+	struct apfs_dir_listing *listing;
 	struct apfs_key key;
-	struct apfs_query *query;
+	struct apfs_query query;
 	u64 cnid = inode->i_ino;
-	loff_t pos;
+	bool resume;
+	loff_t pos, skipped, start_pos;
 	int err = 0;
 
 	if (ctx->pos == 0) {
@@ -130,58 +327,261 @@ static int apfs_readdir(struct file *file, struct dir_context *ctx)
 		ctx->pos++;
 	}
 
-	query = apfs_alloc_query(sbi->s_cat_root, NULL /* parent */);
-	if (!query)
-		return -ENOMEM;
+	if (!cursor) {
+		cursor = kzalloc(sizeof(*cursor), GFP_KERNEL);
+		if (!cursor)
+			return -ENOMEM;
+		file->private_data = cursor;
+	}
+	/* A seek to any other position needs a scan from the start */
+	resume = cursor->pos && cursor->pos == ctx->pos;
+	if (resume && cursor->at_end)
+		return 0;
+	cursor->pos = 0;
+	cursor->nr_prefetch = 0;
+
+	listing = apfs_dir_listing_get(inode);
+	if (listing) {
+		apfs_readdir_listing(inode, ctx, cursor, listing);
+		apfs_dir_listing_put(listing);
+		goto prefetch;
+	}
+
+	/* Only a full scan, done in order, can build a bloom filter */
+	if (!resume) {
+		kvfree(cursor->bloom);
+		cursor->bloom = NULL;
+		if (ctx->pos == 2 && sbi->s_flags & APFS_DIR_INDEX &&
+		    !rcu_access_pointer(APFS_I(inode)->i_dir_bloom))
+			cursor->bloom =
+				apfs_dir_bloom_alloc(APFS_I(inode)->i_nchildren);
+	}
 
 	/* We want all the children for the cnid, regardless of the name */
 	apfs_init_drec_hashed_key(sb, cnid, NULL /* name */, &key);
-	query->key = &key;
-	query->flags = APFS_QUERY_CAT | APFS_QUERY_MULTIPLE | APFS_QUERY_EXACT;
+	apfs_btree_iter_init(&query, sbi->s_cat_root, &key,
+			     APFS_QUERY_CAT | APFS_QUERY_MULTIPLE);
 
-	pos = ctx->pos - 2;
-	while (1) {
+	/*
+	 * The records are visited in key order, one by one.  Unless the cursor
+	 * says where to resume, the first ctx->pos - 2 are skipped.
+	 */
+	if (resume) {
+		pos = 0;
+		err = apfs_readdir_resume(sb, &query, &key, cursor);
+	} else {
+		pos = ctx->pos - 2;
+		if (pos)
+			apfs_stat_inc(sb, APFS_STAT_READDIR_RESTARTS);
+		err = apfs_btree_iter_seek(sb, &query);
+	}
+	skipped = pos;
+	start_pos = ctx->pos;
+	while (!err) {
 		struct apfs_drec drec;
-		/*
-		 * We query for the matching records, one by one. After we
-		 * pass ctx->pos we begin to emit them.
-		 *
-		 * TODO: Faster approach for large directories?
-		 */
 
-		err = apfs_btree_query(sb, &query);
-		if (err == -ENODATA) { /* Got all the records */
-			err = 0;
-			break;
-		}
-		if (err)
-			break;
-
-		err = apfs_drec_from_query(query, &drec);
+		err = apfs_drec_from_query(&query, &drec);
 		if (err) {
 			apfs_alert(sb, "bad dentry record in directory 0x%llx",
 				   cnid);
 			break;
 		}
 
-		err = 0;
-		if (pos <= 0) {
+		if (pos > 0) {
+			pos--;
+		} else {
 			if (!dir_emit(ctx, drec.name, drec.name_len,
-				      drec.ino, drec.type))
+				      drec.ino, drec.type)) {
+				apfs_readdir_save(cursor, &drec, ctx->pos);
 				break;
+			}
 			ctx->pos++;
+			apfs_name_cache_insert(sb, drec.ino, cnid, drec.name,
+					       drec.name_len);
+			if (cursor->bloom)
+				apfs_dir_bloom_add(cursor->bloom, drec.hash);
+			if (cursor->nr_prefetch < APFS_READDIR_PREFETCH)
+				cursor->prefetch[cursor->nr_prefetch++] =
+								drec.ino;
+		}
+		err = apfs_btree_iter_next(sb, &query);
+	}
+	if (err == -ENODATA) { /* Got all the records */
+		cursor->pos = ctx->pos;
+		cursor->at_end = true;
+		err = 0;
+		if (cursor->bloom) {
+			apfs_dir_bloom_publish(inode, cursor->bloom);
+			cursor->bloom = NULL;
 		}
-		pos--;
 	}
 
-	if (pos < 0)
-		ctx->pos -= pos;
-	apfs_free_query(sb, query);
+	apfs_free_query(sb, &query);
+	trace_apfs_readdir(inode, start_pos, skipped - pos,
+			   ctx->pos - start_pos, err);
+prefetch:
+	if (sbi->s_flags & APFS_PREFETCH_INODES)
+		apfs_readdir_prefetch(sb, cursor);
 	return err;
 }
 
+/**
+ * apfs_dir_get_name - Find the name of a child of a directory by its cnid
+ * @dir:	the directory
+ * @ino:	inode number of the child
+ * @name:	buffer of NAME_MAX + 1 bytes for the null-terminated name
+ *
+ * Scans all the records of @dir, so it should only be used when nothing else
+ * knows the name.  Returns 0 on success, -ENOENT if @ino is not a child of
+ * @dir, or another negative error code in case of failure.
+ */
+int apfs_dir_get_name(struct inode *dir, u64 ino, char *name)
+{
+	struct super_block *sb = dir->i_sb;
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_key key;
+	struct apfs_query query;
+	u64 cnid = apfs_ino(dir);
+	int err;
+
+	apfs_init_drec_hashed_key(sb, cnid, NULL /* name */, &key);
+	apfs_btree_iter_init(&query, sbi->s_cat_root, &key,
+			     APFS_QUERY_CAT | APFS_QUERY_MULTIPLE);
+
+	err = apfs_btree_iter_seek(sb, &query);
+	for (; !err; err = apfs_btree_iter_next(sb, &query)) {
+		struct apfs_drec drec;
+
+		err = apfs_drec_from_query(&query, &drec);
+		if (err) {
+			apfs_alert(sb, "bad dentry record in directory 0x%llx",
+				   cnid);
+			break;
+		}
+		/* The whole scan is paid for, so remember all the children */
+		apfs_name_cache_insert(sb, drec.ino, cnid, drec.name,
+				       drec.name_len);
+		if (drec.ino != ino)
+			continue;
+		if (drec.name_len > NAME_MAX) {
+			err = -ENAMETOOLONG;
+			break;
+		}
+		memcpy(name, drec.name, drec.name_len + 1);
+		break;
+	}
+	apfs_free_query(sb, &query);
+	return err == -ENODATA ? -ENOENT : err;
+}
+
+static struct workqueue_struct *apfs_dir_ra_wq;
+
+/*
+ * Read ahead of the records of a directory that was just opened
+ */
+struct apfs_dir_ra {
+	struct work_struct work;
+	struct super_block *sb;
+	u64 cnid;
+};
+
+static void apfs_dir_ra_work(struct work_struct *work)
+{
+	struct apfs_dir_ra *ra = container_of(work, struct apfs_dir_ra, work);
+	struct super_block *sb = ra->sb;
+	struct apfs_key key;
+	struct apfs_query query;
+
+	apfs_init_drec_hashed_key(sb, ra->cnid, NULL /* name */, &key);
+	apfs_btree_iter_init(&query, APFS_SB(sb)->s_cat_root, &key,
+			     APFS_QUERY_CAT | APFS_QUERY_MULTIPLE);
+	/* The seek reads ahead the leaves that follow, it's all we need */
+	apfs_btree_iter_seek(sb, &query);
+	apfs_free_query(sb, &query);
+	kfree(ra);
+}
+
+/**
+ * apfs_dir_open - Start reading the records of a directory on open
+ * @inode:	the directory
+ * @file:	the file being opened
+ *
+ * A directory that gets opened is almost always listed right away, so queue
+ * the seek to its first record in the background; the iterator reads ahead
+ * the leaves that follow, and the first readdir finds them in memory.  This
+ * is only a hint, so it never fails.
+ */
+static int apfs_dir_open(struct inode *inode, struct file *file)
+{
+	struct super_block *sb = inode->i_sb;
+	struct apfs_dir_ra *ra;
+
+	/* With metadata=ram all the nodes are in memory already */
+	if (APFS_SB(sb)->s_flags & APFS_METADATA_RAM)
+		return 0;
+	/* There are no records to read for an empty directory */
+	if (!APFS_I(inode)->i_nchildren)
+		return 0;
+
+	ra = kmalloc(sizeof(*ra), GFP_KERNEL | __GFP_NOWARN);
+	if (!ra)
+		return 0;
+	ra->sb = sb;
+	ra->cnid = apfs_ino(inode);
+	INIT_WORK(&ra->work, apfs_dir_ra_work);
+	queue_work(apfs_dir_ra_wq, &ra->work);
+	return 0;
+}
+
+/**
+ * apfs_dir_ra_flush - Wait for the directory read aheads to finish
+ *
+ * Must be called on unmount, before the trees are released.
+ */
+void apfs_dir_ra_flush(void)
+{
+	flush_workqueue(apfs_dir_ra_wq);
+}
+
+/**
+ * apfs_dir_init - Create the workqueue for the directory read aheads
+ *
+ * Returns 0 on success, or -ENOMEM in case of failure.
+ */
+int __init apfs_dir_init(void)
+{
+	apfs_dir_ra_wq = alloc_workqueue("apfs-dir-ra", WQ_UNBOUND, 0);
+	if (!apfs_dir_ra_wq)
+		return -ENOMEM;
+	return 0;
+}
+
+/**
+ * apfs_dir_exit - Destroy the workqueue for the directory read aheads
+ */
+void apfs_dir_exit(void)
+{
+	destroy_workqueue(apfs_dir_ra_wq);
+}
+
+static int apfs_dir_release(struct inode *inode, struct file *file)
+{
+	struct apfs_dir_cursor *cursor = file->private_data;
+
+	if (cursor)
+		kvfree(cursor->bloom);
+	kfree(cursor);
+	return 0;
+}
+
 const struct file_operations apfs_dir_operations = {
 	.llseek		= generic_file_llseek,
 	.read		= generic_read_dir,
 	.iterate_shared	= apfs_readdir,
+	.open		= apfs_dir_open,
+	.release	= apfs_dir_release,
+	.unlocked_ioctl	= apfs_ioctl,
+#ifdef CONFIG_COMPAT
+	.compat_ioctl	= apfs_compat_ioctl,
+#endif
 };
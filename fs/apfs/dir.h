@@ -9,10 +9,12 @@
 #define _APFS_DIR_H
 
 #include <linux/types.h>
+#include "key.h"
 
 struct inode;
 struct qstr;
 struct apfs_query;
+struct apfs_dir_bloom;
 
 /*
  * Structure of the value of a directory entry. This is the data in
@@ -32,13 +34,41 @@ struct apfs_drec {
 	u8 *name;
 	u64 ino;
 	int name_len;
+	u32 hash;		/* Name hash, as it goes in the catalog key */
 	unsigned int type;
 };
 
+/* Most inodes whose records get prefetched after a single readdir call */
+#define APFS_READDIR_PREFETCH	128
+
+/*
+ * Position of a readdir scan, kept in the private data of an open directory.
+ * It locates the next record to emit, so that readdir can resume the scan
+ * right there instead of walking all the previous records again.
+ */
+struct apfs_dir_cursor {
+	loff_t pos;		/* Position of the record, 0 if not set */
+	bool at_end;		/* The scan is over, there is no record */
+	u32 hash;		/* Name hash of the record */
+	int name_len;		/* Length of the name of the record */
+	u8 name[APFS_NAME_LEN + 1];
+
+	/* Children emitted by the last call, for the prefetch mount option */
+	u64 prefetch[APFS_READDIR_PREFETCH];
+	int nr_prefetch;
+
+	/* Filter built by a scan from the start, published once it's over */
+	struct apfs_dir_bloom *bloom;
+};
+
 extern int apfs_drec_from_query(struct apfs_query *query,
 				struct apfs_drec *drec);
 extern int apfs_inode_by_name(struct inode *dir, const struct qstr *child,
-			      u64 *ino);
+			      u32 hash, u64 *ino);
+extern int apfs_dir_get_name(struct inode *dir, u64 ino, char *name);
+extern void apfs_dir_ra_flush(void);
+extern int apfs_dir_init(void);
+extern void apfs_dir_exit(void);
 
 extern const struct file_operations apfs_dir_operations;
 
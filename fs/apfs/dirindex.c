@@ -0,0 +1,813 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/dirindex.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ *
+ * In-memory name indexes, bloom filters and listings for directories
+ */
+
+#include <linux/fs.h>
+#include <linux/hash.h>
+#include <linux/jhash.h>
+#include <linux/log2.h>
+#include <linux/mm.h>
+#include <linux/sched/signal.h>
+#include <linux/slab.h>
+#include <linux/wait_bit.h>
+#include "apfs.h"
+#include "btree.h"
+#include "dir.h"
+#include "dirindex.h"
+#include "inode.h"
+#include "key.h"
+#include "message.h"
+#include "super.h"
+
+/**
+ * apfs_dir_index_release - Free a name index and all its buffers
+ * @index: the index
+ */
+static void apfs_dir_index_release(struct apfs_dir_index *index)
+{
+	kvfree(index->buckets);
+	kvfree(index->entries);
+	kvfree(index->names);
+	kfree(index);
+}
+
+static void apfs_dir_index_rcu_free(struct rcu_head *head)
+{
+	apfs_dir_index_release(container_of(head, struct apfs_dir_index, rcu));
+}
+
+/**
+ * apfs_dir_index_grow - Make room in one of the buffers of an index
+ * @buf:	pointer to the buffer, will be updated
+ * @size:	pointer to the size of the buffer, will be updated
+ * @used:	number of bytes in use
+ * @need:	number of bytes needed past @used
+ *
+ * Returns 0 on success, or -ENOMEM in case of failure.
+ */
+static int apfs_dir_index_grow(void **buf, size_t *size, size_t used,
+			       size_t need)
+{
+	size_t new_size = *size ?: PAGE_SIZE;
+	void *new;
+
+	if (used + need <= *size)
+		return 0;
+	while (new_size < used + need)
+		new_size *= 2;
+
+	new = kvmalloc(new_size, GFP_KERNEL);
+	if (!new)
+		return -ENOMEM;
+	memcpy(new, *buf, used);
+	kvfree(*buf);
+	*buf = new;
+	*size = new_size;
+	return 0;
+}
+
+/**
+ * apfs_dir_index_build - Build the name index for a directory
+ * @dir: the directory
+ *
+ * Scans all the directory records of @dir.  Returns the new index on success,
+ * or an error pointer in case of failure; -E2BIG means that the directory has
+ * too many children.
+ */
+static struct apfs_dir_index *apfs_dir_index_build(struct inode *dir)
+{
+	struct super_block *sb = dir->i_sb;
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_dir_index *index;
+	struct apfs_key key;
+	struct apfs_query query;
+	size_t entries_size = 0, names_size = 0, names_len = 0;
+	u32 i;
+	int err;
+
+	index = kzalloc(sizeof(*index), GFP_KERNEL);
+	if (!index)
+		return ERR_PTR(-ENOMEM);
+
+	apfs_init_drec_hashed_key(sb, dir->i_ino, NULL /* name */, &key);
+	apfs_btree_iter_init(&query, sbi->s_cat_root, &key,
+			     APFS_QUERY_CAT | APFS_QUERY_MULTIPLE);
+	err = apfs_btree_iter_seek(sb, &query);
+	while (!err) {
+		struct apfs_dir_index_entry *entry;
+		struct apfs_drec drec;
+
+		err = apfs_drec_from_query(&query, &drec);
+		if (err) {
+			apfs_alert(sb, "bad dentry record in directory 0x%llx",
+				   (unsigned long long) dir->i_ino);
+			break;
+		}
+		if (index->nr == APFS_DIR_INDEX_MAX) {
+			err = -E2BIG;
+			break;
+		}
+
+		err = apfs_dir_index_grow((void **)&index->entries,
+					  &entries_size,
+					  index->nr * sizeof(*entry),
+					  sizeof(*entry));
+		if (err)
+			break;
+		err = apfs_dir_index_grow((void **)&index->names, &names_size,
+					  names_len, drec.name_len + 1);
+		if (err)
+			break;
+
+		entry = &index->entries[index->nr++];
+		entry->cnid = drec.ino;
+		entry->hash = drec.hash;
+		entry->name_off = names_len;
+		memcpy(index->names + names_len, drec.name, drec.name_len);
+		names_len += drec.name_len;
+		index->names[names_len++] = 0;
+
+		err = apfs_btree_iter_next(sb, &query);
+	}
+	apfs_free_query(sb, &query);
+	if (err != -ENODATA)
+		goto fail;
+
+	/* hash_32() needs at least one bit, even for tiny directories */
+	index->bucket_bits = index->nr > 1 ? ilog2(index->nr - 1) + 1 : 1;
+	index->buckets = kvmalloc_array(1U << index->bucket_bits,
+					sizeof(*index->buckets), GFP_KERNEL);
+	if (!index->buckets) {
+		err = -ENOMEM;
+		goto fail;
+	}
+	memset(index->buckets, 0xff,
+	       (1U << index->bucket_bits) * sizeof(*index->buckets));
+	for (i = 0; i < index->nr; i++) {
+		struct apfs_dir_index_entry *entry = &index->entries[i];
+		u32 bucket = hash_32(entry->hash, index->bucket_bits);
+
+		entry->next = index->buckets[bucket];
+		index->buckets[bucket] = i;
+	}
+	return index;
+
+fail:
+	apfs_dir_index_release(index);
+	return ERR_PTR(err);
+}
+
+/**
+ * apfs_dir_index_publish - Build the name index for a directory and set it
+ * @dir: the directory
+ *
+ * Failure is not an error, the lookups will just go to the catalog.
+ */
+static void apfs_dir_index_publish(struct inode *dir)
+{
+	struct apfs_dir_indexes *indexes = &APFS_SB(dir->i_sb)->s_dir_indexes;
+	struct apfs_inode_info *ai = APFS_I(dir);
+	struct apfs_dir_index *index;
+
+	index = apfs_dir_index_build(dir);
+	if (IS_ERR(index))
+		return;
+
+	spin_lock(&indexes->lock);
+	if (rcu_access_pointer(ai->i_dir_index)) {
+		/* Another lookup got here first */
+		spin_unlock(&indexes->lock);
+		apfs_dir_index_release(index);
+		return;
+	}
+	rcu_assign_pointer(ai->i_dir_index, index);
+	list_add_tail(&ai->i_dir_index_list, &indexes->list);
+	indexes->count++;
+	spin_unlock(&indexes->lock);
+}
+
+/**
+ * apfs_dir_index_find - Look for a name in the index of a directory
+ * @dir:	the directory
+ * @child:	the name
+ * @hash:	hash of @child, as in the catalog key
+ * @ino:	on return, the inode number found
+ *
+ * Returns 0 if the name was found, -ENODATA if it isn't in the directory, or
+ * -EAGAIN if @dir has no index.
+ */
+static int apfs_dir_index_find(struct inode *dir, const struct qstr *child,
+			       u32 hash, u64 *ino)
+{
+	struct super_block *sb = dir->i_sb;
+	struct apfs_dir_index *index;
+	u32 i;
+	int err = -ENODATA;
+
+	rcu_read_lock();
+	index = rcu_dereference(APFS_I(dir)->i_dir_index);
+	if (!index) {
+		err = -EAGAIN;
+		goto out;
+	}
+	i = index->buckets[hash_32(hash, index->bucket_bits)];
+	while (i != U32_MAX) {
+		struct apfs_dir_index_entry *entry = &index->entries[i];
+
+		if (entry->hash == hash &&
+		    !apfs_filename_cmp(sb, child->name,
+				       index->names + entry->name_off)) {
+			*ino = entry->cnid;
+			err = 0;
+			break;
+		}
+		i = entry->next;
+	}
+out:
+	rcu_read_unlock();
+	return err;
+}
+
+/**
+ * apfs_dir_index_lookup - Find the cnid for a filename in a directory index
+ * @dir:	parent directory
+ * @child:	filename
+ * @hash:	hash of @child, as in the catalog key
+ * @ino:	on return, the inode number found
+ *
+ * The index for a large directory gets built once it has seen a few lookups.
+ * Returns 0 if the name was found, -ENODATA if it isn't in the directory, or
+ * -EAGAIN if the directory has no index and the catalog must be searched.
+ */
+int apfs_dir_index_lookup(struct inode *dir, const struct qstr *child,
+			  u32 hash, u64 *ino)
+{
+	struct apfs_inode_info *ai = APFS_I(dir);
+	int err;
+
+	err = apfs_dir_index_find(dir, child, hash, ino);
+	if (err != -EAGAIN)
+		return err;
+
+	if (ai->i_nchildren < APFS_DIR_INDEX_MIN ||
+	    ai->i_nchildren > APFS_DIR_INDEX_MAX)
+		return -EAGAIN;
+	if (atomic_inc_return(&ai->i_dir_lookups) != APFS_DIR_INDEX_TRIGGER)
+		return -EAGAIN;
+
+	apfs_dir_index_publish(dir);
+	return apfs_dir_index_find(dir, child, hash, ino);
+}
+
+/**
+ * apfs_dir_index_free - Release the name index and listing of an inode
+ * @inode:	the inode, which is being destroyed
+ */
+void apfs_dir_index_free(struct inode *inode)
+{
+	struct apfs_dir_indexes *indexes =
+				&APFS_SB(inode->i_sb)->s_dir_indexes;
+	struct apfs_inode_info *ai = APFS_I(inode);
+	struct apfs_dir_listing *listing;
+	struct apfs_dir_index *index;
+
+	spin_lock(&indexes->lock);
+	if (!list_empty(&ai->i_dir_index_list)) {
+		list_del_init(&ai->i_dir_index_list);
+		indexes->count--;
+	}
+	if (!list_empty(&ai->i_dir_listing_list)) {
+		list_del_init(&ai->i_dir_listing_list);
+		indexes->nr_listings--;
+	}
+	spin_unlock(&indexes->lock);
+
+	/* Nobody else can be using the inode at this point */
+	index = rcu_dereference_protected(ai->i_dir_index, 1);
+	if (index)
+		apfs_dir_index_release(index);
+	RCU_INIT_POINTER(ai->i_dir_index, NULL);
+
+	kvfree(rcu_dereference_protected(ai->i_dir_bloom, 1));
+	RCU_INIT_POINTER(ai->i_dir_bloom, NULL);
+
+	listing = rcu_dereference_protected(ai->i_dir_listing, 1);
+	if (listing)
+		apfs_dir_listing_put(listing);
+	RCU_INIT_POINTER(ai->i_dir_listing, NULL);
+}
+
+/**
+ * apfs_dir_bloom_alloc - Allocate an empty bloom filter for a directory
+ * @nchildren:	number of children of the directory
+ *
+ * Returns the new filter, or NULL if the directory is too big or the
+ * allocation fails; either way the directory just goes without a filter.
+ */
+struct apfs_dir_bloom *apfs_dir_bloom_alloc(u32 nchildren)
+{
+	struct apfs_dir_bloom *bloom;
+	u32 nbits;
+
+	if (nchildren > APFS_DIR_BLOOM_MAX)
+		return NULL;
+	nbits = max_t(u32, nchildren * APFS_DIR_BLOOM_BITS, BITS_PER_LONG);
+	nbits = roundup_pow_of_two(nbits);
+
+	bloom = kvzalloc(sizeof(*bloom) + BITS_TO_LONGS(nbits) * sizeof(long),
+			 GFP_KERNEL);
+	if (!bloom)
+		return NULL;
+	bloom->mask = nbits - 1;
+	return bloom;
+}
+
+/*
+ * The bits for a name come from double hashing of its catalog hash.  Distinct
+ * names with the same catalog hash always collide, but they are rare.
+ */
+#define apfs_dir_bloom_for_each_bit(bloom, hash, h1, h2, i, bit)	\
+	for (h1 = jhash_1word(hash, 0), h2 = jhash_1word(hash, 1) | 1,	\
+	     i = 0, bit = h1 & (bloom)->mask;				\
+	     i < APFS_DIR_BLOOM_HASHES;					\
+	     i++, bit = (h1 + i * h2) & (bloom)->mask)
+
+/**
+ * apfs_dir_bloom_add - Add a name to a bloom filter that isn't published yet
+ * @bloom:	the filter
+ * @hash:	hash of the name, as in the catalog key
+ */
+void apfs_dir_bloom_add(struct apfs_dir_bloom *bloom, u32 hash)
+{
+	u32 h1, h2, i, bit;
+
+	apfs_dir_bloom_for_each_bit(bloom, hash, h1, h2, i, bit)
+		__set_bit(bit, bloom->bits);
+}
+
+/**
+ * apfs_dir_bloom_test - Check if a bloom filter may include a name
+ * @bloom:	the filter
+ * @hash:	hash of the name, as in the catalog key
+ */
+static bool apfs_dir_bloom_test(struct apfs_dir_bloom *bloom, u32 hash)
+{
+	u32 h1, h2, i, bit;
+
+	apfs_dir_bloom_for_each_bit(bloom, hash, h1, h2, i, bit) {
+		if (!test_bit(bit, bloom->bits))
+			return false;
+	}
+	return true;
+}
+
+/**
+ * apfs_dir_bloom_publish - Set the bloom filter for a directory
+ * @dir:	the directory
+ * @bloom:	filter with the hashes of all the children of @dir
+ *
+ * The caller gives up its reference to @bloom, which may get freed right away
+ * if the directory already had a filter.
+ */
+void apfs_dir_bloom_publish(struct inode *dir, struct apfs_dir_bloom *bloom)
+{
+	struct apfs_dir_indexes *indexes = &APFS_SB(dir->i_sb)->s_dir_indexes;
+	struct apfs_inode_info *ai = APFS_I(dir);
+
+	spin_lock(&indexes->lock);
+	if (rcu_access_pointer(ai->i_dir_bloom)) {
+		spin_unlock(&indexes->lock);
+		kvfree(bloom);
+		return;
+	}
+	rcu_assign_pointer(ai->i_dir_bloom, bloom);
+	spin_unlock(&indexes->lock);
+}
+
+/**
+ * apfs_dir_bloom_check - Check if a name may be in a directory
+ * @dir:	the directory
+ * @hash:	hash of the name, as in the catalog key
+ *
+ * Returns false only if the name is certainly not in @dir; if the directory
+ * has no bloom filter yet, the answer is always true.
+ */
+bool apfs_dir_bloom_check(struct inode *dir, u32 hash)
+{
+	struct apfs_dir_bloom *bloom;
+	bool ret = true;
+
+	rcu_read_lock();
+	bloom = rcu_dereference(APFS_I(dir)->i_dir_bloom);
+	if (bloom && !apfs_dir_bloom_test(bloom, hash)) {
+		atomic64_inc(&APFS_SB(dir->i_sb)->s_dir_indexes.bloom_hits);
+		ret = false;
+	}
+	rcu_read_unlock();
+	return ret;
+}
+
+/**
+ * apfs_dir_bloom_build - Build the bloom filter for a directory
+ * @dir: the directory
+ *
+ * Scans all the directory records of @dir.  This runs inside a lookup, so it
+ * gives up the cpu between records, and gives up entirely on a fatal signal.
+ * Returns the new filter, or NULL in case of failure.
+ */
+static struct apfs_dir_bloom *apfs_dir_bloom_build(struct inode *dir)
+{
+	struct super_block *sb = dir->i_sb;
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_dir_bloom *bloom;
+	struct apfs_key key;
+	struct apfs_query query;
+	int err;
+
+	bloom = apfs_dir_bloom_alloc(APFS_I(dir)->i_nchildren);
+	if (!bloom)
+		return NULL;
+
+	apfs_init_drec_hashed_key(sb, dir->i_ino, NULL /* name */, &key);
+	apfs_btree_iter_init(&query, sbi->s_cat_root, &key,
+			     APFS_QUERY_CAT | APFS_QUERY_MULTIPLE);
+	err = apfs_btree_iter_seek(sb, &query);
+	while (!err) {
+		struct apfs_drec drec;
+
+		err = apfs_drec_from_query(&query, &drec);
+		if (err) {
+			apfs_alert(sb, "bad dentry record in directory 0x%llx",
+				   (unsigned long long) dir->i_ino);
+			break;
+		}
+		apfs_dir_bloom_add(bloom, drec.hash);
+		if (fatal_signal_pending(current)) {
+			err = -EINTR;
+			break;
+		}
+		cond_resched();
+		err = apfs_btree_iter_next(sb, &query);
+	}
+	apfs_free_query(sb, &query);
+	if (err != -ENODATA) {
+		kvfree(bloom);
+		return NULL;
+	}
+	return bloom;
+}
+
+/**
+ * apfs_dir_bloom_miss - Account for a failed catalog lookup in a directory
+ * @dir:	the directory
+ *
+ * A directory that keeps seeing failed lookups gets its bloom filter built,
+ * unless a readdir scan already took care of that.  If the build fails, the
+ * count starts over, so that the next misses can try again.  Only used with
+ * the dirindex mount option.
+ */
+void apfs_dir_bloom_miss(struct inode *dir)
+{
+	struct apfs_inode_info *ai = APFS_I(dir);
+	struct apfs_dir_bloom *bloom;
+
+	if (rcu_access_pointer(ai->i_dir_bloom)) {
+		atomic64_inc(&APFS_SB(dir->i_sb)->s_dir_indexes.bloom_false_pos);
+		return;
+	}
+	if (atomic_inc_return(&ai->i_dir_misses) != APFS_DIR_BLOOM_TRIGGER)
+		return;
+
+	bloom = apfs_dir_bloom_build(dir);
+	if (bloom)
+		apfs_dir_bloom_publish(dir, bloom);
+	else
+		atomic_set(&ai->i_dir_misses, 0);
+}
+
+/**
+ * apfs_dir_listing_release - Free a directory listing and its buffers
+ * @listing:	the listing
+ */
+static void apfs_dir_listing_release(struct apfs_dir_listing *listing)
+{
+	kvfree(listing->entries);
+	kvfree(listing->names);
+	kfree(listing);
+}
+
+static void apfs_dir_listing_rcu_free(struct rcu_head *head)
+{
+	apfs_dir_listing_release(container_of(head, struct apfs_dir_listing,
+					      rcu));
+}
+
+/**
+ * apfs_dir_listing_put - Drop a reference to a directory listing
+ * @listing:	the listing
+ *
+ * Readers may still be trying to take a reference under rcu, so the last one
+ * frees the listing after a grace period.
+ */
+void apfs_dir_listing_put(struct apfs_dir_listing *listing)
+{
+	if (refcount_dec_and_test(&listing->refcount))
+		call_rcu(&listing->rcu, apfs_dir_listing_rcu_free);
+}
+
+/**
+ * apfs_dir_listing_build - Decode all the records of a directory
+ * @dir:	the directory
+ *
+ * A bloom filter for the directory gets built along the way, if it doesn't
+ * have one yet and the mount has dirindex set.  Returns the new listing, with
+ * a single reference, or an error pointer in case of failure.
+ */
+static struct apfs_dir_listing *apfs_dir_listing_build(struct inode *dir)
+{
+	struct super_block *sb = dir->i_sb;
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_inode_info *ai = APFS_I(dir);
+	struct apfs_dir_listing *listing;
+	struct apfs_dir_bloom *bloom = NULL;
+	struct apfs_key key;
+	struct apfs_query query;
+	size_t entries_size = 0, names_size = 0, names_len = 0;
+	int err;
+
+	listing = kzalloc(sizeof(*listing), GFP_KERNEL);
+	if (!listing)
+		return ERR_PTR(-ENOMEM);
+	refcount_set(&listing->refcount, 1);
+	if (sbi->s_flags & APFS_DIR_INDEX &&
+	    !rcu_access_pointer(ai->i_dir_bloom))
+		bloom = apfs_dir_bloom_alloc(ai->i_nchildren);
+
+	apfs_init_drec_hashed_key(sb, dir->i_ino, NULL /* name */, &key);
+	apfs_btree_iter_init(&query, sbi->s_cat_root, &key,
+			     APFS_QUERY_CAT | APFS_QUERY_MULTIPLE);
+	err = apfs_btree_iter_seek(sb, &query);
+	while (!err) {
+		struct apfs_dir_listing_entry *entry;
+		struct apfs_drec drec;
+
+		err = apfs_drec_from_query(&query, &drec);
+		if (err) {
+			apfs_alert(sb, "bad dentry record in directory 0x%llx",
+				   (unsigned long long) dir->i_ino);
+			break;
+		}
+		if (listing->nr == APFS_DIR_LISTING_MAX) {
+			err = -E2BIG;
+			break;
+		}
+
+		err = apfs_dir_index_grow((void **)&listing->entries,
+					  &entries_size,
+					  listing->nr * sizeof(*entry),
+					  sizeof(*entry));
+		if (err)
+			break;
+		err = apfs_dir_index_grow((void **)&listing->names,
+					  &names_size, names_len,
+					  drec.name_len + 1);
+		if (err)
+			break;
+
+		entry = &listing->entries[listing->nr++];
+		entry->cnid = drec.ino;
+		entry->name_off = names_len;
+		entry->name_len = drec.name_len;
+		entry->type = drec.type;
+		memcpy(listing->names + names_len, drec.name, drec.name_len);
+		names_len += drec.name_len;
+		listing->names[names_len++] = 0;
+		if (bloom)
+			apfs_dir_bloom_add(bloom, drec.hash);
+
+		err = apfs_btree_iter_next(sb, &query);
+	}
+	apfs_free_query(sb, &query);
+	if (err != -ENODATA) {
+		kvfree(bloom);
+		apfs_dir_listing_release(listing);
+		return ERR_PTR(err);
+	}
+	if (bloom)
+		apfs_dir_bloom_publish(dir, bloom);
+	return listing;
+}
+
+/**
+ * apfs_dir_listing_find - Take a reference to the listing of a directory
+ * @dir:	the directory
+ *
+ * Returns the listing, or NULL if @dir has none.
+ */
+static struct apfs_dir_listing *apfs_dir_listing_find(struct inode *dir)
+{
+	struct apfs_dir_listing *listing;
+
+	rcu_read_lock();
+	listing = rcu_dereference(APFS_I(dir)->i_dir_listing);
+	if (listing && !refcount_inc_not_zero(&listing->refcount))
+		listing = NULL;
+	rcu_read_unlock();
+	return listing;
+}
+
+/**
+ * apfs_dir_listing_publish - Build the listing for a directory and set it
+ * @dir:	the directory
+ *
+ * Only one reader builds the listing, the others that come in the meantime
+ * wait for it instead of scanning the catalog themselves.  Failure is not an
+ * error, readdir will just go to the catalog.
+ */
+static void apfs_dir_listing_publish(struct inode *dir)
+{
+	struct apfs_dir_indexes *indexes = &APFS_SB(dir->i_sb)->s_dir_indexes;
+	struct apfs_inode_info *ai = APFS_I(dir);
+	struct apfs_dir_listing *listing;
+
+	if (wait_on_bit_lock(&ai->i_dir_listing_state,
+			     APFS_DIR_LISTING_BUILDING, TASK_KILLABLE))
+		return;
+	if (rcu_access_pointer(ai->i_dir_listing)) {
+		/* Another reader got here first */
+		goto out;
+	}
+
+	listing = apfs_dir_listing_build(dir);
+	if (IS_ERR(listing))
+		goto out;
+	spin_lock(&indexes->lock);
+	rcu_assign_pointer(ai->i_dir_listing, listing);
+	list_add_tail(&ai->i_dir_listing_list, &indexes->listings);
+	indexes->nr_listings++;
+	spin_unlock(&indexes->lock);
+out:
+	clear_and_wake_up_bit(APFS_DIR_LISTING_BUILDING,
+			      &ai->i_dir_listing_state);
+}
+
+/**
+ * apfs_dir_listing_get - Get the listing of a directory for a readdir
+ * @dir:	the directory
+ *
+ * The listing of a big directory gets built on its first readdir, and stays
+ * around for the others until memory runs short.  Returns the listing, with
+ * a reference taken for the caller, or NULL if the records must be read from
+ * the catalog.
+ */
+struct apfs_dir_listing *apfs_dir_listing_get(struct inode *dir)
+{
+	struct apfs_inode_info *ai = APFS_I(dir);
+	struct apfs_dir_listing *listing;
+
+	listing = apfs_dir_listing_find(dir);
+	if (listing)
+		return listing;
+
+	if (ai->i_nchildren < APFS_DIR_LISTING_MIN ||
+	    ai->i_nchildren > APFS_DIR_LISTING_MAX)
+		return NULL;
+	apfs_dir_listing_publish(dir);
+	return apfs_dir_listing_find(dir);
+}
+
+static unsigned long apfs_dir_indexes_count(struct shrinker *shrink,
+					    struct shrink_control *sc)
+{
+	struct apfs_dir_indexes *indexes =
+		container_of(shrink, struct apfs_dir_indexes, shrinker);
+
+	return READ_ONCE(indexes->count) ?: SHRINK_EMPTY;
+}
+
+static unsigned long apfs_dir_indexes_scan(struct shrinker *shrink,
+					   struct shrink_control *sc)
+{
+	struct apfs_dir_indexes *indexes =
+		container_of(shrink, struct apfs_dir_indexes, shrinker);
+	unsigned long nr = sc->nr_to_scan;
+	unsigned long freed = 0;
+
+	spin_lock(&indexes->lock);
+	while (nr-- && !list_empty(&indexes->list)) {
+		struct apfs_inode_info *ai;
+		struct apfs_dir_index *index;
+
+		ai = list_first_entry(&indexes->list, struct apfs_inode_info,
+				      i_dir_index_list);
+		list_del_init(&ai->i_dir_index_list);
+		indexes->count--;
+
+		index = rcu_dereference_protected(ai->i_dir_index,
+					lockdep_is_held(&indexes->lock));
+		RCU_INIT_POINTER(ai->i_dir_index, NULL);
+		/* Let the index get rebuilt if the lookups keep coming */
+		atomic_set(&ai->i_dir_lookups, 0);
+
+		if (index) {
+			call_rcu(&index->rcu, apfs_dir_index_rcu_free);
+			freed++;
+		}
+	}
+	spin_unlock(&indexes->lock);
+	return freed;
+}
+
+static unsigned long apfs_dir_listings_count(struct shrinker *shrink,
+					     struct shrink_control *sc)
+{
+	struct apfs_dir_indexes *indexes =
+		container_of(shrink, struct apfs_dir_indexes, listing_shrinker);
+
+	return READ_ONCE(indexes->nr_listings) ?: SHRINK_EMPTY;
+}
+
+/* Listings still in use by a readdir are freed once it's done */
+static unsigned long apfs_dir_listings_scan(struct shrinker *shrink,
+					    struct shrink_control *sc)
+{
+	struct apfs_dir_indexes *indexes =
+		container_of(shrink, struct apfs_dir_indexes, listing_shrinker);
+	unsigned long nr = sc->nr_to_scan;
+	unsigned long freed = 0;
+
+	spin_lock(&indexes->lock);
+	while (nr-- && !list_empty(&indexes->listings)) {
+		struct apfs_inode_info *ai;
+		struct apfs_dir_listing *listing;
+
+		ai = list_first_entry(&indexes->listings,
+				      struct apfs_inode_info,
+				      i_dir_listing_list);
+		list_del_init(&ai->i_dir_listing_list);
+		indexes->nr_listings--;
+
+		listing = rcu_dereference_protected(ai->i_dir_listing,
+					lockdep_is_held(&indexes->lock));
+		RCU_INIT_POINTER(ai->i_dir_listing, NULL);
+		if (listing) {
+			apfs_dir_listing_put(listing);
+			freed++;
+		}
+	}
+	spin_unlock(&indexes->lock);
+	return freed;
+}
+
+/**
+ * apfs_dir_indexes_init - Set up the reclaim of name indexes for a new mount
+ * @sb:		filesystem superblock
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+int apfs_dir_indexes_init(struct super_block *sb)
+{
+	struct apfs_dir_indexes *indexes = &APFS_SB(sb)->s_dir_indexes;
+	int err;
+
+	spin_lock_init(&indexes->lock);
+	INIT_LIST_HEAD(&indexes->list);
+	indexes->count = 0;
+	atomic64_set(&indexes->bloom_hits, 0);
+	atomic64_set(&indexes->bloom_false_pos, 0);
+
+	INIT_LIST_HEAD(&indexes->listings);
+	indexes->nr_listings = 0;
+
+	indexes->shrinker.count_objects = apfs_dir_indexes_count;
+	indexes->shrinker.scan_objects = apfs_dir_indexes_scan;
+	indexes->shrinker.seeks = DEFAULT_SEEKS;
+	err = register_shrinker(&indexes->shrinker);
+	if (err)
+		return err;
+
+	indexes->listing_shrinker.count_objects = apfs_dir_listings_count;
+	indexes->listing_shrinker.scan_objects = apfs_dir_listings_scan;
+	indexes->listing_shrinker.seeks = DEFAULT_SEEKS;
+	err = register_shrinker(&indexes->listing_shrinker);
+	if (err)
+		unregister_shrinker(&indexes->shrinker);
+	return err;
+}
+
+/**
+ * apfs_dir_indexes_destroy - Stop the reclaim of name indexes before unmount
+ * @sb:		filesystem superblock
+ *
+ * All inodes are gone by now, and so are their indexes.
+ */
+void apfs_dir_indexes_destroy(struct super_block *sb)
+{
+	unregister_shrinker(&APFS_SB(sb)->s_dir_indexes.listing_shrinker);
+	unregister_shrinker(&APFS_SB(sb)->s_dir_indexes.shrinker);
+}
@@ -0,0 +1,138 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/dirindex.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_DIRINDEX_H
+#define _APFS_DIRINDEX_H
+
+#include <linux/atomic.h>
+#include <linux/list.h>
+#include <linux/rcupdate.h>
+#include <linux/refcount.h>
+#include <linux/shrinker.h>
+#include <linux/spinlock.h>
+#include <linux/types.h>
+
+struct inode;
+struct qstr;
+struct super_block;
+
+/* Limits on the number of children of a directory that gets a name index */
+#define APFS_DIR_INDEX_MIN	1024		/* Smaller ones don't need it */
+#define APFS_DIR_INDEX_MAX	(256 * 1024)	/* Bigger ones cost too much */
+
+/* Number of lookups in a directory before its name index gets built */
+#define APFS_DIR_INDEX_TRIGGER	16
+
+/* Bits per child in a directory bloom filter, and bits set for each name */
+#define APFS_DIR_BLOOM_BITS	10
+#define APFS_DIR_BLOOM_HASHES	4
+
+/* Most children for a directory that gets a bloom filter */
+#define APFS_DIR_BLOOM_MAX	(1024 * 1024)
+
+/* Failed lookups in a directory before it gets scanned for a bloom filter */
+#define APFS_DIR_BLOOM_TRIGGER	8
+
+/*
+ * Entry of a directory name index
+ */
+struct apfs_dir_index_entry {
+	u64 cnid;			/* Inode number of the child */
+	u32 hash;			/* Name hash, as in the catalog key */
+	u32 next;			/* Next entry in the bucket, or U32_MAX */
+	u32 name_off;			/* Offset of the name in the index */
+};
+
+/*
+ * Hash table of all the children of a directory.  It is never modified after
+ * it gets published, and the mount is read-only, so it never goes stale;
+ * readers only need rcu protection against the shrinker.
+ */
+struct apfs_dir_index {
+	struct rcu_head rcu;
+	u32 nr;				/* Number of entries */
+	u32 bucket_bits;		/* Log2 of the number of buckets */
+	u32 *buckets;			/* First entry for each bucket */
+	struct apfs_dir_index_entry *entries;
+	char *names;			/* Null-terminated names of entries */
+};
+
+/*
+ * Bloom filter of the name hashes of all the children of a directory, so that
+ * failed lookups can be answered without a catalog query.  It never changes
+ * after it gets published, and it's small, so it lives as long as the inode.
+ */
+struct apfs_dir_bloom {
+	u32 mask;			/* Number of bits, minus one */
+	unsigned long bits[];
+};
+
+/* Limits on the number of children of a directory that gets a listing */
+#define APFS_DIR_LISTING_MIN	256		/* Smaller ones are cheap */
+#define APFS_DIR_LISTING_MAX	(1024 * 1024)	/* Bigger ones cost too much */
+
+/* Bit of @i_dir_listing_state held while a listing is being built */
+#define APFS_DIR_LISTING_BUILDING	0
+
+/*
+ * Entry of a directory listing
+ */
+struct apfs_dir_listing_entry {
+	u64 cnid;			/* Inode number of the child */
+	u32 name_off;			/* Offset of the name in the listing */
+	u16 name_len;			/* Length of the name, without null */
+	u8 type;			/* Type of the child, as for readdir */
+};
+
+/*
+ * Decoded records of all the children of a directory, in catalog order, so
+ * that a readdir can start at any position without a scan.  The listing is
+ * shared by all the readers of the directory, who hold a reference while they
+ * copy out of it; the inode holds one as well, until the shrinker drops it.
+ * Like the name indexes, it never changes after it gets published.
+ */
+struct apfs_dir_listing {
+	struct rcu_head rcu;
+	refcount_t refcount;
+	u32 nr;				/* Number of entries */
+	struct apfs_dir_listing_entry *entries;
+	char *names;			/* Null-terminated names of entries */
+};
+
+/*
+ * List of the directories that have a name index or a listing, so that they
+ * can be reclaimed under memory pressure
+ */
+struct apfs_dir_indexes {
+	spinlock_t lock;		/* Protects lists, counts and filters */
+	struct list_head list;		/* Oldest indexes first */
+	unsigned long count;		/* Number of inodes in @list */
+	struct shrinker shrinker;
+
+	struct list_head listings;	/* Oldest listings first */
+	unsigned long nr_listings;	/* Number of inodes in @listings */
+	struct shrinker listing_shrinker;
+
+	atomic64_t bloom_hits;		/* Lookups failed by a bloom filter */
+	atomic64_t bloom_false_pos;	/* Failed lookups the filter let by */
+};
+
+extern int apfs_dir_index_lookup(struct inode *dir, const struct qstr *child,
+				 u32 hash, u64 *ino);
+extern void apfs_dir_index_free(struct inode *inode);
+extern struct apfs_dir_bloom *apfs_dir_bloom_alloc(u32 nchildren);
+extern void apfs_dir_bloom_add(struct apfs_dir_bloom *bloom, u32 hash);
+extern void apfs_dir_bloom_publish(struct inode *dir,
+				   struct apfs_dir_bloom *bloom);
+extern bool apfs_dir_bloom_check(struct inode *dir, u32 hash);
+extern void apfs_dir_bloom_miss(struct inode *dir);
+extern struct apfs_dir_listing *apfs_dir_listing_get(struct inode *dir);
+extern void apfs_dir_listing_put(struct apfs_dir_listing *listing);
+extern int apfs_dir_indexes_init(struct super_block *sb);
+extern void apfs_dir_indexes_destroy(struct super_block *sb);
+
+#endif	/* _APFS_DIRINDEX_H */
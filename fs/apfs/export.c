@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/export.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ *
+ * Support for exporting the filesystem over NFS
+ */
+
+#include <linux/exportfs.h>
+#include <linux/fs.h>
+#include "apfs.h"
+#include "dir.h"
+#include "inode.h"
+#include "sibling.h"
+
+/*
+ * File handle types.  A handle is just the 64-bit cnid of the inode, split in
+ * two 32-bit words, and may be followed by the cnid of the parent.  There is
+ * no generation number because the filesystem is read-only, so inode numbers
+ * never get reused.
+ */
+#define APFS_FILEID_CNID		0xa1
+#define APFS_FILEID_CNID_PARENT		0xa2
+
+/* Length of a file handle, in 32-bit words */
+#define APFS_FH_LEN			2
+#define APFS_FH_LEN_PARENT		4
+
+static void apfs_fh_put_cnid(__u32 *fh, u64 cnid)
+{
+	fh[0] = lower_32_bits(cnid);
+	fh[1] = upper_32_bits(cnid);
+}
+
+static u64 apfs_fh_get_cnid(const __u32 *fh)
+{
+	return (u64)fh[1] << 32 | fh[0];
+}
+
+static int apfs_encode_fh(struct inode *inode, __u32 *fh, int *max_len,
+			  struct inode *parent)
+{
+	int len = parent ? APFS_FH_LEN_PARENT : APFS_FH_LEN;
+
+	if (*max_len < len) {
+		*max_len = len;
+		return FILEID_INVALID;
+	}
+	*max_len = len;
+
+	apfs_fh_put_cnid(fh, apfs_ino(inode));
+	if (!parent)
+		return APFS_FILEID_CNID;
+	apfs_fh_put_cnid(fh + APFS_FH_LEN, apfs_ino(parent));
+	return APFS_FILEID_CNID_PARENT;
+}
+
+/**
+ * apfs_export_iget - Get the dentry for an inode number from a file handle
+ * @sb:		filesystem superblock
+ * @cnid:	the inode number
+ *
+ * The inode gets read straight from the catalog, with no need for a path walk.
+ * Returns the dentry, or an error pointer in case of failure; -ESTALE if the
+ * inode doesn't exist.
+ */
+static struct dentry *apfs_export_iget(struct super_block *sb, u64 cnid)
+{
+	struct inode *inode;
+
+	/* The special inodes, other than the root, are not for the user */
+	if (cnid < APFS_MIN_USER_INO_NUM && cnid != APFS_ROOT_DIR_INO_NUM)
+		return ERR_PTR(-ESTALE);
+
+	inode = apfs_iget(sb, cnid);
+	if (IS_ERR(inode)) {
+		if (PTR_ERR(inode) == -ENODATA)
+			return ERR_PTR(-ESTALE);
+		return ERR_CAST(inode);
+	}
+	return d_obtain_alias(inode);
+}
+
+static struct dentry *apfs_fh_to_dentry(struct super_block *sb,
+					struct fid *fid, int fh_len,
+					int fh_type)
+{
+	if (fh_len < APFS_FH_LEN)
+		return NULL;
+	if (fh_type != APFS_FILEID_CNID && fh_type != APFS_FILEID_CNID_PARENT)
+		return NULL;
+	return apfs_export_iget(sb, apfs_fh_get_cnid(fid->raw));
+}
+
+static struct dentry *apfs_fh_to_parent(struct super_block *sb,
+					struct fid *fid, int fh_len,
+					int fh_type)
+{
+	if (fh_len < APFS_FH_LEN_PARENT || fh_type != APFS_FILEID_CNID_PARENT)
+		return NULL;
+	return apfs_export_iget(sb, apfs_fh_get_cnid(fid->raw + APFS_FH_LEN));
+}
+
+static struct dentry *apfs_get_parent(struct dentry *child)
+{
+	struct inode *inode = d_inode(child);
+
+	/* Directories can't have hard links, so the parent id is reliable */
+	return apfs_export_iget(inode->i_sb, APFS_I(inode)->i_parent_id);
+}
+
+/**
+ * apfs_get_name - Find the name of an inode in a given directory
+ * @parent:	the directory
+ * @name:	buffer of NAME_MAX + 1 bytes for the null-terminated name
+ * @child:	the inode
+ *
+ * The names of hard links are all kept in the sibling records of the inode,
+ * and the inode record has the name of any other file, so the directory only
+ * gets scanned if that's missing.  Returns 0 on success or a negative error
+ * code in case of failure.
+ */
+static int apfs_get_name(struct dentry *parent, char *name,
+			 struct dentry *child)
+{
+	struct inode *dir = d_inode(parent);
+	struct inode *inode = d_inode(child);
+	struct apfs_siblings *siblings;
+	const struct apfs_sibling *link;
+
+	if (S_ISDIR(inode->i_mode) || inode->i_nlink <= 1) {
+		/* The inode record keeps the name, for the primary link */
+		const char *iname = APFS_I(inode)->i_name;
+
+		if (iname && APFS_I(inode)->i_parent_id == apfs_ino(dir) &&
+		    strlen(iname) <= NAME_MAX) {
+			strcpy(name, iname);
+			return 0;
+		}
+		return apfs_dir_get_name(dir, apfs_ino(inode), name);
+	}
+
+	siblings = apfs_siblings_get(inode);
+	if (IS_ERR(siblings))
+		return PTR_ERR(siblings);
+	link = apfs_sibling_by_parent(siblings, apfs_ino(dir));
+	if (!link)
+		return -ENOENT;
+	if (link->name_len > NAME_MAX)
+		return -ENAMETOOLONG;
+	memcpy(name, link->name, link->name_len + 1);
+	return 0;
+}
+
+const struct export_operations apfs_export_ops = {
+	.encode_fh	= apfs_encode_fh,
+	.fh_to_dentry	= apfs_fh_to_dentry,
+	.fh_to_parent	= apfs_fh_to_parent,
+	.get_name	= apfs_get_name,
+	.get_parent	= apfs_get_parent,
+};
@@ -6,15 +6,24 @@
  */
 
 #include <linux/buffer_head.h>
+#include <linux/fadvise.h>
+#include <linux/iomap.h>
+#include <linux/sched/signal.h>
 #include <linux/slab.h>
+#include <linux/sort.h>
 #include "apfs.h"
 #include "btree.h"
+#include "clone.h"
 #include "extents.h"
+#include "fusion.h"
 #include "inode.h"
+#include "ioctl.h"
 #include "key.h"
 #include "message.h"
 #include "node.h"
+#include "stats.h"
 #include "super.h"
+#include "trace.h"
 
 /**
  * apfs_extent_from_query - Read the extent found by a successful query
@@ -31,7 +40,7 @@ int apfs_extent_from_query(struct apfs_query *query,
 	struct super_block *sb = query->node->object.sb;
 	struct apfs_file_extent_val *ext;
 	struct apfs_file_extent_key *ext_key;
-	char *raw = query->node->object.bh->b_data;
+	char *raw = query->node->object.data;
 	u64 ext_len;
 
 	if (query->len != sizeof(*ext) || query->key_len != sizeof(*ext_key))
@@ -48,100 +57,1101 @@ int apfs_extent_from_query(struct apfs_query *query,
 	extent->logical_addr = le64_to_cpu(ext_key->logical_addr);
 	extent->phys_block_num = le64_to_cpu(ext->phys_block_num);
 	extent->len = ext_len;
+	extent->crypto_id = le64_to_cpu(ext->crypto_id);
+	extent->shared = false;
 	return 0;
 }
 
+/**
+ * apfs_extent_map_find - Find the last mapped extent that starts before an
+ *			  address
+ * @map:	extent map
+ * @iaddr:	logical address
+ *
+ * Returns the index of the extent, or -1 if there is none.
+ */
+static int apfs_extent_map_find(struct apfs_extent_map *map, u64 iaddr)
+{
+	int left = 0, right = map->nr - 1;
+
+	while (left <= right) {
+		int mid = left + (right - left) / 2;
+
+		if (map->extents[mid].logical_addr <= iaddr)
+			left = mid + 1;
+		else
+			right = mid - 1;
+	}
+	return right;
+}
+
+/**
+ * apfs_extent_map_lookup - Look for the extent covering an address in the map
+ * @ai:		the inode
+ * @iaddr:	logical address
+ * @extent:	Return parameter.  The extent found.
+ *
+ * Returns true if the extent was found in the map.  This takes no locks, so
+ * that parallel readers of the same file don't contend with each other.
+ */
+static bool apfs_extent_map_lookup(struct apfs_inode_info *ai, u64 iaddr,
+				   struct apfs_file_extent *extent)
+{
+	struct apfs_extent_map *map;
+	struct apfs_file_extent *curr;
+	bool found = false;
+	int index;
+
+	rcu_read_lock();
+	map = rcu_dereference(ai->i_extent_map);
+	if (map) {
+		index = apfs_extent_map_find(map, iaddr);
+		if (index >= 0) {
+			curr = &map->extents[index];
+			if (iaddr < curr->logical_addr + curr->len) {
+				*extent = *curr;
+				found = true;
+			}
+		}
+	}
+	rcu_read_unlock();
+
+	apfs_stat_inc(ai->vfs_inode.i_sb, found ? APFS_STAT_EXTENT_HITS :
+						  APFS_STAT_EXTENT_MISSES);
+	return found;
+}
+
+static void apfs_extent_maps_trim(struct apfs_extent_maps *maps);
+
+/**
+ * apfs_extent_map_insert - Add an extent read from the catalog to the map
+ * @inode:	the inode
+ * @extent:	the new extent
+ *
+ * Publishes a copy of the current map with the new extent added.  Once the
+ * map is full, an extent is dropped from the end farthest from the new one,
+ * since scans tend to move in one direction.  Failure to allocate is not an
+ * error; the extent simply won't be cached.
+ */
+void apfs_extent_map_insert(struct inode *inode,
+			    struct apfs_file_extent *extent)
+{
+	struct apfs_extent_maps *maps = &APFS_SB(inode->i_sb)->s_extent_maps;
+	struct apfs_inode_info *ai = APFS_I(inode);
+	struct apfs_extent_map *old, *new;
+	int pos, nr, drop = 0;
+
+	new = kmalloc(sizeof(*new), GFP_NOFS | __GFP_ACCOUNT);
+	if (!new)
+		return;
+
+	spin_lock(&ai->i_extent_lock);
+	old = rcu_dereference_protected(ai->i_extent_map,
+					lockdep_is_held(&ai->i_extent_lock));
+	if (old) {
+		nr = old->nr;
+		pos = apfs_extent_map_find(old, extent->logical_addr) + 1;
+		if (pos > 0 &&
+		    old->extents[pos - 1].logical_addr == extent->logical_addr) {
+			/* Another reader got here first */
+			spin_unlock(&ai->i_extent_lock);
+			kfree(new);
+			return;
+		}
+	} else {
+		nr = pos = 0;
+	}
+
+	if (nr == APFS_EXTENT_MAP_SIZE) {
+		if (pos > nr / 2) {
+			drop = 1; /* Drop the first extent */
+			pos--;
+		}
+		nr--;
+	}
+	if (old) {
+		memcpy(new->extents, old->extents + drop,
+		       pos * sizeof(*extent));
+		memcpy(new->extents + pos + 1, old->extents + drop + pos,
+		       (nr - pos) * sizeof(*extent));
+	}
+	new->extents[pos] = *extent;
+	new->nr = nr + 1;
+	rcu_assign_pointer(ai->i_extent_map, new);
+	spin_unlock(&ai->i_extent_lock);
+
+	if (old) {
+		kfree_rcu(old, rcu);
+		return;
+	}
+	list_lru_add(&maps->lru, &ai->i_extent_list);
+	apfs_extent_maps_trim(maps);
+}
+
+/**
+ * apfs_extent_map_insert_run - Add consecutive extents of a file to the map
+ * @inode:	the inode
+ * @exts:	the new extents, in the order of their catalog records
+ * @nr:		number of extents, no more than APFS_EXTENT_MAP_SIZE
+ *
+ * The records come one after another in the catalog, so any extent already
+ * in the map that starts inside the run must be one of them.  What the run
+ * leaves free of the map is kept for the old extents closest to it.  Failure
+ * to allocate is not an error, like for apfs_extent_map_insert().
+ */
+static void apfs_extent_map_insert_run(struct inode *inode,
+				       struct apfs_file_extent *exts, int nr)
+{
+	struct apfs_extent_maps *maps = &APFS_SB(inode->i_sb)->s_extent_maps;
+	struct apfs_inode_info *ai = APFS_I(inode);
+	struct apfs_extent_map *old, *new;
+	u64 first = exts[0].logical_addr, last = exts[nr - 1].logical_addr;
+	int before = 0, after = 0, skip = 0, room = APFS_EXTENT_MAP_SIZE - nr;
+	int keep_before, keep_after;
+
+	new = kmalloc(sizeof(*new), GFP_NOFS | __GFP_ACCOUNT);
+	if (!new)
+		return;
+
+	spin_lock(&ai->i_extent_lock);
+	old = rcu_dereference_protected(ai->i_extent_map,
+					lockdep_is_held(&ai->i_extent_lock));
+	if (old) {
+		before = apfs_extent_map_find(old, first - 1) + 1;
+		if (!first)
+			before = 0;
+		skip = apfs_extent_map_find(old, last) + 1 - before;
+		after = old->nr - before - skip;
+	}
+
+	keep_before = min(before, room / 2);
+	keep_after = min(after, room - keep_before);
+	keep_before = min(before, room - keep_after);
+
+	if (old)
+		memcpy(new->extents, old->extents + before - keep_before,
+		       keep_before * sizeof(*exts));
+	memcpy(new->extents + keep_before, exts, nr * sizeof(*exts));
+	if (old)
+		memcpy(new->extents + keep_before + nr,
+		       old->extents + before + skip,
+		       keep_after * sizeof(*exts));
+	new->nr = keep_before + nr + keep_after;
+	rcu_assign_pointer(ai->i_extent_map, new);
+	spin_unlock(&ai->i_extent_lock);
+
+	if (old) {
+		kfree_rcu(old, rcu);
+		return;
+	}
+	list_lru_add(&maps->lru, &ai->i_extent_list);
+	apfs_extent_maps_trim(maps);
+}
+
+/**
+ * apfs_extent_map_free - Release the extent map of an inode
+ * @inode:	the inode, which is being destroyed
+ */
+void apfs_extent_map_free(struct inode *inode)
+{
+	struct apfs_extent_maps *maps = &APFS_SB(inode->i_sb)->s_extent_maps;
+	struct apfs_inode_info *ai = APFS_I(inode);
+
+	list_lru_del(&maps->lru, &ai->i_extent_list);
+
+	/* Nobody else can be using the inode at this point */
+	kfree(rcu_dereference_protected(ai->i_extent_map, 1));
+	RCU_INIT_POINTER(ai->i_extent_map, NULL);
+}
+
+/**
+ * apfs_extent_map_isolate - Drop the extent map of an inode on the lru
+ * @item:	lru entry of the inode
+ * @list:	lru list, locked
+ * @lock:	the lock of @list
+ * @arg:	unused
+ */
+static enum lru_status apfs_extent_map_isolate(struct list_head *item,
+					       struct list_lru_one *list,
+					       spinlock_t *lock, void *arg)
+{
+	struct apfs_inode_info *ai;
+	struct apfs_extent_map *map;
+
+	ai = container_of(item, struct apfs_inode_info, i_extent_list);
+	list_lru_isolate(list, item);
+
+	spin_lock(&ai->i_extent_lock);
+	map = rcu_dereference_protected(ai->i_extent_map,
+					lockdep_is_held(&ai->i_extent_lock));
+	RCU_INIT_POINTER(ai->i_extent_map, NULL);
+	spin_unlock(&ai->i_extent_lock);
+
+	if (map)
+		kfree_rcu(map, rcu);
+	return LRU_REMOVED;
+}
+
+static unsigned long apfs_extent_maps_count(struct shrinker *shrink,
+					    struct shrink_control *sc)
+{
+	struct apfs_extent_maps *maps =
+		container_of(shrink, struct apfs_extent_maps, shrinker);
+
+	return list_lru_shrink_count(&maps->lru, sc) ?: SHRINK_EMPTY;
+}
+
+static unsigned long apfs_extent_maps_scan(struct shrinker *shrink,
+					   struct shrink_control *sc)
+{
+	struct apfs_extent_maps *maps =
+		container_of(shrink, struct apfs_extent_maps, shrinker);
+
+	return list_lru_shrink_walk(&maps->lru, sc, apfs_extent_map_isolate,
+				    NULL);
+}
+
+/**
+ * apfs_extent_maps_trim - Drop the oldest extent maps over the limit
+ * @maps:	the extent maps of a mount
+ */
+static void apfs_extent_maps_trim(struct apfs_extent_maps *maps)
+{
+	unsigned long count = list_lru_count(&maps->lru);
+	unsigned long max = READ_ONCE(maps->max);
+
+	if (count > max)
+		list_lru_walk(&maps->lru, apfs_extent_map_isolate, NULL,
+			      count - max);
+}
+
+/**
+ * apfs_extent_maps_set_max - Change the limit for the extent maps of a mount
+ * @sb:		filesystem superblock
+ * @max:	new limit
+ *
+ * The maps over the new limit are dropped right away, oldest first.
+ */
+void apfs_extent_maps_set_max(struct super_block *sb, unsigned long max)
+{
+	struct apfs_extent_maps *maps = &APFS_SB(sb)->s_extent_maps;
+
+	WRITE_ONCE(maps->max, max);
+	apfs_extent_maps_trim(maps);
+}
+
+/**
+ * apfs_extent_maps_init - Set up the reclaim of extent maps for a new mount
+ * @sb:		filesystem superblock
+ *
+ * Maps are charged to the memory cgroup of the task that read the extents,
+ * and the oldest ones get dropped once there are too many.  Returns 0 on
+ * success, or a negative error code in case of failure.
+ */
+int apfs_extent_maps_init(struct super_block *sb)
+{
+	struct apfs_extent_maps *maps = &APFS_SB(sb)->s_extent_maps;
+	int err;
+
+	maps->max = APFS_EXTENT_MAPS_DEFAULT_SIZE;
+	maps->shrinker.count_objects = apfs_extent_maps_count;
+	maps->shrinker.scan_objects = apfs_extent_maps_scan;
+	maps->shrinker.seeks = DEFAULT_SEEKS;
+	maps->shrinker.flags = SHRINKER_NUMA_AWARE | SHRINKER_MEMCG_AWARE;
+	err = prealloc_shrinker(&maps->shrinker);
+	if (err)
+		return err;
+	err = list_lru_init_memcg(&maps->lru, &maps->shrinker);
+	if (err) {
+		free_prealloced_shrinker(&maps->shrinker);
+		return err;
+	}
+	register_shrinker_prepared(&maps->shrinker);
+	return 0;
+}
+
+/**
+ * apfs_extent_maps_destroy - Stop the reclaim of extent maps before unmount
+ * @sb:		filesystem superblock
+ *
+ * All inodes are gone by now, and so are their extent maps.
+ */
+void apfs_extent_maps_destroy(struct super_block *sb)
+{
+	struct apfs_extent_maps *maps = &APFS_SB(sb)->s_extent_maps;
+
+	unregister_shrinker(&maps->shrinker);
+	list_lru_destroy(&maps->lru);
+}
+
+/**
+ * apfs_extent_is_shared - Check if a physical block belongs to a shared extent
+ * @sb:		filesystem superblock
+ * @root:	root of the extent reference tree
+ * @bno:	the block number
+ * @shared:	Return parameter.  Is the block shared?
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_extent_is_shared(struct super_block *sb,
+				 struct apfs_node *root, u64 bno, bool *shared)
+{
+	struct apfs_phys_ext_val *val;
+	struct apfs_query query;
+	struct apfs_key key, curr_key;
+	u64 len;
+	int ret;
+
+	*shared = false;
+	apfs_init_phys_ext_key(bno, &key);
+
+	apfs_init_query(&query, root);
+	query.key = &key;
+	query.flags = APFS_QUERY_EXTENTREF;
+
+	/* Find the last physical extent that starts at or before @bno */
+	ret = apfs_btree_query(sb, &query);
+	if (ret) {
+		if (ret == -ENODATA) /* Not referenced at all */
+			ret = 0;
+		goto done;
+	}
+	ret = apfs_node_read_record(&query, &curr_key);
+	if (ret || curr_key.type != APFS_TYPE_EXTENT)
+		goto done;
+
+	if (query.len < sizeof(*val)) {
+		apfs_alert(sb, "bad physical extent record for block 0x%llx",
+			   bno);
+		ret = -EFSCORRUPTED;
+		goto done;
+	}
+	val = (struct apfs_phys_ext_val *)(query.node->object.data +
+					   query.off);
+	len = le64_to_cpu(val->len_and_kind) & APFS_PEXT_LEN_MASK;
+	if (bno - curr_key.id < len)
+		*shared = le32_to_cpu(val->refcnt) > 1;
+
+done:
+	apfs_free_query(sb, &query);
+	return ret;
+}
+
+/**
+ * apfs_extent_check_shared - Find out if an extent is shared with other files
+ * @inode:	the file
+ * @extent:	extent read from the catalog, to be updated
+ *
+ * Only the first block of the extent gets checked; this is only used to
+ * decide how to read the blocks, and they hold the same data anyway.  Returns
+ * 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_extent_check_shared(struct inode *inode,
+				    struct apfs_file_extent *extent)
+{
+	struct super_block *sb = inode->i_sb;
+	struct apfs_node *extref_root;
+	int ret;
+
+	if (!extent->phys_block_num)
+		return 0;
+	extref_root = apfs_read_node(sb,
+		le64_to_cpu(APFS_SB(sb)->s_vsb_raw->apfs_extentref_tree_oid));
+	if (IS_ERR(extref_root)) {
+		apfs_err(sb, "unable to read the extent reference tree");
+		return PTR_ERR(extref_root);
+	}
+	ret = apfs_extent_is_shared(sb, extref_root, extent->phys_block_num,
+				    &extent->shared);
+	apfs_node_put(extref_root);
+	return ret;
+}
+
+/**
+ * apfs_extent_harvest - Cache the extents of a file found in the same leaf
+ * @inode:	the file
+ * @query:	the query that found one of its extents, which is then cached
+ * @extent:	the extent found
+ *
+ * The other extents of the file are usually next to the one found, so they
+ * get into the map as well, up to as many as it can hold.  This is only an
+ * optimization, so any problems with records other than @extent are left for
+ * their own reads to report.
+ */
+static void apfs_extent_harvest(struct inode *inode, struct apfs_query *query,
+				struct apfs_file_extent *extent)
+{
+	u64 id = APFS_I(inode)->i_extent_id;
+	struct apfs_file_extent *exts;
+	struct apfs_key key;
+	int found = query->index, half = APFS_EXTENT_MAP_SIZE / 2;
+	int start, end, i, nr = 0;
+
+	exts = kmalloc_array(APFS_EXTENT_MAP_SIZE, sizeof(*exts), GFP_NOFS);
+	if (!exts) {
+		apfs_extent_map_insert(inode, extent);
+		return;
+	}
+
+	/* Take the neighbours on both sides, so backward scans gain too */
+	for (start = found; start > 0 && found - start < half; start--) {
+		query->index = start - 1;
+		if (apfs_node_read_record(query, &key) || key.id != id ||
+		    key.type != APFS_TYPE_FILE_EXTENT)
+			break;
+	}
+	for (end = found + 1; end < query->node->records &&
+	     end - start < APFS_EXTENT_MAP_SIZE; end++) {
+		query->index = end;
+		if (apfs_node_read_record(query, &key) || key.id != id ||
+		    key.type != APFS_TYPE_FILE_EXTENT)
+			break;
+	}
+
+	for (i = start; i < end; i++) {
+		if (i == found) {
+			exts[nr++] = *extent;
+			continue;
+		}
+		query->index = i;
+		if (apfs_node_read_record(query, NULL /* key */) ||
+		    apfs_extent_from_query(query, &exts[nr])) {
+			/* Keep the run consecutive */
+			if (i > found)
+				break;
+			nr = 0;
+			continue;
+		}
+		nr++;
+	}
+	query->index = found;
+
+	apfs_extent_map_insert_run(inode, exts, nr);
+	kfree(exts);
+}
+
 /**
  * apfs_extent_read - Read the extent record that covers a block
  * @inode:	inode that owns the record
  * @iblock:	logical number of the wanted block
  * @extent:	Return parameter.  The extent found.
+ * @nowait:	fail with -EAGAIN if a catalog node would have to be read
  *
- * Finds and caches the extent record.  On success, returns a pointer to the
- * cache record; on failure, returns an error code.
+ * Looks for the extent in the inode's extent map first; if it's not there,
+ * finds the record in the catalog and adds it to the map, along with the
+ * other extents of the file in the same leaf.  Files that may be read through
+ * the device instead get only the one extent checked for sharing and cached.
+ * Returns 0 on success, or a negative error code in case of failure.
  */
-static int apfs_extent_read(struct inode *inode, sector_t iblock,
-			    struct apfs_file_extent *extent)
+int apfs_extent_read(struct inode *inode, sector_t iblock,
+		     struct apfs_file_extent *extent, bool nowait)
 {
 	struct super_block *sb = inode->i_sb;
 	struct apfs_sb_info *sbi = APFS_SB(sb);
 	struct apfs_inode_info *ai = APFS_I(inode);
-	struct apfs_key key;
-	struct apfs_query *query;
-	struct apfs_file_extent *cache = &ai->i_cached_extent;
+	struct apfs_key key, curr_key;
+	struct apfs_query query;
 	u64 iaddr = iblock << inode->i_blkbits;
 	int ret = 0;
 
-	spin_lock(&ai->i_extent_lock);
-	if (iaddr >= cache->logical_addr &&
-	    iaddr < cache->logical_addr + cache->len) {
-		*extent = *cache;
-		spin_unlock(&ai->i_extent_lock);
+	if (apfs_extent_map_lookup(ai, iaddr, extent))
 		return 0;
-	}
-	spin_unlock(&ai->i_extent_lock);
+	/* The extent reference tree is not searched without blocking */
+	if (nowait && apfs_clone_wanted(inode))
+		return -EAGAIN;
 
 	/* We will search for the extent that covers iblock */
 	apfs_init_file_extent_key(ai->i_extent_id, iaddr, &key);
 
-	query = apfs_alloc_query(sbi->s_cat_root, NULL /* parent */);
-	if (!query)
-		return -ENOMEM;
-	query->key = &key;
-	query->flags = APFS_QUERY_CAT;
+	apfs_init_query(&query, sbi->s_cat_root);
+	query.key = &key;
+	query.flags = APFS_QUERY_CAT;
+	if (nowait)
+		query.flags |= APFS_QUERY_NOWAIT;
 
 	ret = apfs_btree_query(sb, &query);
 	if (ret)
 		goto done;
 
-	ret = apfs_extent_from_query(query, extent);
+	/* The record found may come before all the extents of the file */
+	ret = apfs_node_read_record(&query, &curr_key);
+	if (ret)
+		goto done;
+	if (curr_key.id != key.id || curr_key.type != key.type) {
+		ret = -ENODATA;
+		goto done;
+	}
+
+	ret = apfs_extent_from_query(&query, extent);
 	if (ret) {
 		apfs_alert(sb, "bad extent record for inode 0x%llx",
 			   (unsigned long long) inode->i_ino);
 		goto done;
 	}
+	if (apfs_clone_wanted(inode)) {
+		/* The neighbours would need their own checks for sharing */
+		ret = apfs_extent_check_shared(inode, extent);
+		if (ret)
+			goto done;
+		apfs_extent_map_insert(inode, extent);
+		goto done;
+	}
 
-	spin_lock(&ai->i_extent_lock);
-	*cache = *extent;
-	spin_unlock(&ai->i_extent_lock);
+	apfs_extent_harvest(inode, &query, extent);
 
 done:
-	apfs_free_query(sb, query);
+	apfs_free_query(sb, &query);
 	return ret;
 }
 
-int apfs_get_block(struct inode *inode, sector_t iblock,
-		   struct buffer_head *bh_result, int create)
+/**
+ * apfs_fiemap - Report the extents of a file
+ * @inode:	the file
+ * @fieinfo:	fiemap request
+ * @start:	first logical address of interest
+ * @len:	length of the range of interest
+ *
+ * Walks all the file extent records in a single scan of the catalog.  Holes
+ * are reported as gaps between extents.  Returns 0 on success, or a negative
+ * error code in case of failure.
+ */
+int apfs_fiemap(struct inode *inode, struct fiemap_extent_info *fieinfo,
+		u64 start, u64 len)
 {
 	struct super_block *sb = inode->i_sb;
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_file_extent ext, prev = {0};
+	struct apfs_query query;
+	struct apfs_node *extref_root;
+	struct apfs_key key, end_key;
+	bool have_prev = false, at_end;
+	u32 prev_flags = 0;
+	u64 end;
+	int ret;
+
+	ret = fiemap_check_flags(fieinfo, FIEMAP_FLAG_SYNC);
+	if (ret)
+		return ret;
+	end = (len > U64_MAX - start) ? U64_MAX : start + len;
+
+	extref_root = apfs_read_node(sb,
+			le64_to_cpu(sbi->s_vsb_raw->apfs_extentref_tree_oid));
+	if (IS_ERR(extref_root)) {
+		apfs_err(sb, "unable to read the extent reference tree");
+		return PTR_ERR(extref_root);
+	}
+
+	apfs_init_file_extent_key(APFS_I(inode)->i_extent_id, 0, &key);
+	apfs_init_file_extent_key(APFS_I(inode)->i_extent_id, end, &end_key);
+	apfs_btree_iter_range(&query, sbi->s_cat_root, &key, &end_key,
+			      APFS_QUERY_CAT);
+
+	for (ret = apfs_btree_iter_seek(sb, &query); !ret;
+	     ret = apfs_btree_iter_next(sb, &query)) {
+		bool shared;
+
+		ret = apfs_extent_from_query(&query, &ext);
+		if (ret) {
+			apfs_alert(sb, "bad extent record for inode 0x%llx",
+				   (unsigned long long) inode->i_ino);
+			break;
+		}
+		if (ext.logical_addr + ext.len <= start)
+			continue;
+		if (ext.phys_block_num == 0) /* A hole */
+			continue;
+
+		ret = apfs_extent_is_shared(sb, extref_root,
+					    ext.phys_block_num, &shared);
+		if (ret)
+			break;
+
+		/* Only report an extent once we know if it's the last one */
+		if (have_prev) {
+			ret = fiemap_fill_next_extent(fieinfo,
+				prev.logical_addr,
+				prev.phys_block_num << inode->i_blkbits,
+				prev.len, prev_flags);
+			if (ret)
+				break;
+		}
+		prev = ext;
+		prev_flags = shared ? FIEMAP_EXTENT_SHARED : 0;
+		have_prev = true;
+	}
+	/* Extents may follow the range, unless it goes on to the end */
+	at_end = (query.flags & APFS_QUERY_AT_END) && end != U64_MAX;
+	apfs_free_query(sb, &query);
+	apfs_node_put(extref_root);
+
+	if (ret == 1) /* The user buffer is full */
+		return 0;
+	if (ret && ret != -ENODATA)
+		return ret;
+
+	if (!have_prev)
+		return 0;
+	if (ret == -ENODATA && !at_end) /* The scan went past the last extent */
+		prev_flags |= FIEMAP_EXTENT_LAST;
+	ret = fiemap_fill_next_extent(fieinfo, prev.logical_addr,
+				      prev.phys_block_num << inode->i_blkbits,
+				      prev.len, prev_flags);
+	return ret == 1 ? 0 : ret;
+}
+
+/**
+ * apfs_extent_frag - Measure the fragmentation of a file
+ * @inode:	the file
+ * @rep:	on return, the report for APFS_IOC_FRAG_REPORT
+ *
+ * Walks all the file extent records in a single scan of the catalog.  The
+ * extent reference tree is only searched for files that were ever cloned,
+ * since no other file can share its blocks.  Returns 0 on success, or a
+ * negative error code in case of failure.
+ */
+int apfs_extent_frag(struct inode *inode, struct apfs_frag_report *rep)
+{
+	struct super_block *sb = inode->i_sb;
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_node *extref_root = NULL;
 	struct apfs_file_extent ext;
-	u64 blk_off, bno, map_len;
+	struct apfs_query query;
+	struct apfs_key key, end_key;
+	u64 next_block = 0;
 	int ret;
 
-	ret = apfs_extent_read(inode, iblock, &ext);
+	memset(rep, 0, sizeof(*rep));
+	if (APFS_I(inode)->i_cloned) {
+		extref_root = apfs_read_node(sb,
+			le64_to_cpu(sbi->s_vsb_raw->apfs_extentref_tree_oid));
+		if (IS_ERR(extref_root)) {
+			apfs_err(sb, "unable to read the extent reference tree");
+			return PTR_ERR(extref_root);
+		}
+	}
+
+	apfs_init_file_extent_key(APFS_I(inode)->i_extent_id, 0, &key);
+	apfs_init_file_extent_key(APFS_I(inode)->i_extent_id, U64_MAX,
+				  &end_key);
+	apfs_btree_iter_range(&query, sbi->s_cat_root, &key, &end_key,
+			      APFS_QUERY_CAT);
+
+	for (ret = apfs_btree_iter_seek(sb, &query); !ret;
+	     ret = apfs_btree_iter_next(sb, &query)) {
+		bool shared = false;
+
+		ret = apfs_extent_from_query(&query, &ext);
+		if (ret) {
+			apfs_alert(sb, "bad extent record for inode 0x%llx",
+				   (unsigned long long) inode->i_ino);
+			break;
+		}
+		if (ext.phys_block_num == 0) /* A hole */
+			continue;
+
+		if (extref_root) {
+			ret = apfs_extent_is_shared(sb, extref_root,
+						    ext.phys_block_num, &shared);
+			if (ret)
+				break;
+		}
+		if (rep->fr_extents && ext.phys_block_num != next_block)
+			rep->fr_discont++;
+		next_block = ext.phys_block_num +
+			     (ext.len >> sb->s_blocksize_bits);
+
+		rep->fr_extents++;
+		rep->fr_mapped += ext.len;
+		rep->fr_max_len = max(rep->fr_max_len, ext.len);
+		if (shared)
+			rep->fr_shared += ext.len;
+		cond_resched();
+	}
+	apfs_free_query(sb, &query);
+	if (extref_root)
+		apfs_node_put(extref_root);
+	if (ret != -ENODATA)
+		return ret;
+
+	if (rep->fr_extents)
+		rep->fr_avg_len = div64_u64(rep->fr_mapped, rep->fr_extents);
+	if (rep->fr_mapped)
+		rep->fr_shared_ratio = div64_u64(rep->fr_shared * 10000,
+						 rep->fr_mapped);
+	return 0;
+}
+
+static int apfs_extent_phys_cmp(const void *a, const void *b)
+{
+	u64 bno_a = ((const struct apfs_file_extent *)a)->phys_block_num;
+	u64 bno_b = ((const struct apfs_file_extent *)b)->phys_block_num;
+
+	if (bno_a == bno_b)
+		return 0;
+	return bno_a < bno_b ? -1 : 1;
+}
+
+/**
+ * apfs_extent_prefetch_flush - Read ahead the data of a batch of extents
+ * @file:	the open file
+ * @exts:	data extents of the batch, already in the extent map
+ * @nr:		number of extents
+ * @start:	start of the range of interest
+ * @end:	end of the range of interest
+ *
+ * The reads are issued in the physical order of the extents, so that the
+ * device sees one pass over the file instead of a seek for each extent.
+ */
+static void apfs_extent_prefetch_flush(struct file *file,
+				       struct apfs_file_extent *exts, int nr,
+				       loff_t start, loff_t end)
+{
+	int i;
+
+	sort(exts, nr, sizeof(*exts), apfs_extent_phys_cmp, NULL);
+	for (i = 0; i < nr; ++i) {
+		loff_t from = max_t(loff_t, exts[i].logical_addr, start);
+		loff_t to = min_t(loff_t, exts[i].logical_addr + exts[i].len,
+				  end);
+
+		generic_fadvise(file, from, to - from, POSIX_FADV_WILLNEED);
+	}
+}
+
+/**
+ * apfs_extent_prefetch - Map a range of a file and read its data ahead
+ * @file:	the open file
+ * @start:	start of the range
+ * @end:	end of the range, past the end of the file if it goes on to it
+ *
+ * The extents come from a single range scan of the catalog, and go into the
+ * extent map in batches that fit in it, so that the readahead of each batch
+ * never blocks on the catalog.  Returns 0 on success, or a negative error code
+ * in case of failure.
+ */
+int apfs_extent_prefetch(struct file *file, loff_t start, loff_t end)
+{
+	struct inode *inode = file_inode(file);
+	struct super_block *sb = inode->i_sb;
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_file_extent *exts;
+	struct apfs_key key, end_key;
+	struct apfs_query query;
+	u64 id = APFS_I(inode)->i_extent_id;
+	int nr = 0, ret;
+
+	exts = kmalloc_array(APFS_EXTENT_MAP_SIZE, sizeof(*exts), GFP_KERNEL);
+	if (!exts)
+		return -ENOMEM;
+
+	/* The extent that covers @start begins before it */
+	apfs_init_file_extent_key(id, 0, &key);
+	apfs_init_file_extent_key(id, end, &end_key);
+	apfs_btree_iter_range(&query, sbi->s_cat_root, &key, &end_key,
+			      APFS_QUERY_CAT);
+
+	for (ret = apfs_btree_iter_seek(sb, &query); !ret;
+	     ret = apfs_btree_iter_next(sb, &query)) {
+		struct apfs_file_extent *ext = &exts[nr];
+
+		ret = apfs_extent_from_query(&query, ext);
+		if (ret) {
+			apfs_alert(sb, "bad extent record for inode 0x%llx",
+				   (unsigned long long) inode->i_ino);
+			break;
+		}
+		if (ext->logical_addr + ext->len <= start)
+			continue;
+		if (apfs_clone_wanted(inode)) {
+			ret = apfs_extent_check_shared(inode, ext);
+			if (ret)
+				break;
+		}
+		apfs_extent_map_insert(inode, ext);
+		if (!ext->phys_block_num) /* Holes need no reads */
+			continue;
+
+		if (++nr == APFS_EXTENT_MAP_SIZE) {
+			apfs_extent_prefetch_flush(file, exts, nr, start, end);
+			nr = 0;
+		}
+		if (fatal_signal_pending(current)) {
+			ret = -EINTR;
+			break;
+		}
+		cond_resched();
+	}
+	apfs_free_query(sb, &query);
+	if (ret == -ENODATA)
+		ret = 0;
+
+	if (!ret)
+		apfs_extent_prefetch_flush(file, exts, nr, start, end);
+	kfree(exts);
+	return ret;
+}
+
+/**
+ * apfs_extent_read_next - Read the extent record that follows another one
+ * @inode:	inode that owns the records
+ * @prev:	the previous extent, or NULL to get the first one
+ * @next:	Return parameter.  The extent found.
+ *
+ * Returns 0 on success, -ENODATA if there are no more extents, or another
+ * negative error code in case of failure.
+ */
+static int apfs_extent_read_next(struct inode *inode,
+				 struct apfs_file_extent *prev,
+				 struct apfs_file_extent *next)
+{
+	struct super_block *sb = inode->i_sb;
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_query query;
+	struct apfs_key key, any_key;
+	u64 id = APFS_I(inode)->i_extent_id;
+	int ret;
+
+	apfs_init_file_extent_key(id, 0, &any_key);
+	if (prev) {
+		apfs_init_file_extent_key(id, prev->logical_addr, &key);
+		apfs_btree_iter_init(&query, sbi->s_cat_root, &key,
+				     APFS_QUERY_CAT);
+		ret = apfs_btree_iter_seek(sb, &query);
+		if (!ret) {
+			/* From here on, any extent of the file is a match */
+			apfs_btree_iter_widen(&query, &any_key,
+					      APFS_QUERY_ANY_NUMBER);
+			ret = apfs_btree_iter_next(sb, &query);
+		}
+	} else {
+		apfs_btree_iter_init(&query, sbi->s_cat_root, &any_key,
+				     APFS_QUERY_CAT | APFS_QUERY_ANY_NUMBER);
+		ret = apfs_btree_iter_seek(sb, &query);
+	}
+	if (!ret) {
+		ret = apfs_extent_from_query(&query, next);
+		if (ret)
+			apfs_alert(sb, "bad extent record for inode 0x%llx",
+				   (unsigned long long) inode->i_ino);
+	}
+
+	apfs_free_query(sb, &query);
+	return ret;
+}
+
+/**
+ * apfs_iomap_hole - Map a file range that no extent record covers
+ * @inode:	the file
+ * @prev:	last extent before @pos, or NULL if there is none
+ * @pos:	file offset to map
+ * @length:	length of the range wanted by the caller
+ * @flags:	type of operation
+ * @iomap:	the mapping, already set up as a hole
+ *
+ * The hole goes on until the next extent record, or past @length if there is
+ * none.  Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_iomap_hole(struct inode *inode, struct apfs_file_extent *prev,
+			   loff_t pos, loff_t length, unsigned int flags,
+			   struct iomap *iomap)
+{
+	struct apfs_file_extent next;
+	int ret;
+
+	/* The scan for the next extent can't be done without blocking */
+	if (flags & IOMAP_NOWAIT)
+		return -EAGAIN;
+
+	iomap->offset = pos;
+	iomap->length = length;
+
+	ret = apfs_extent_read_next(inode, prev, &next);
+	if (ret == -ENODATA)
+		return 0;
 	if (ret)
 		return ret;
+	if (next.logical_addr <= pos) {
+		apfs_alert(inode->i_sb,
+			   "extent records out of order for inode 0x%llx",
+			   (unsigned long long) inode->i_ino);
+		return -EFSCORRUPTED;
+	}
+	iomap->length = next.logical_addr - pos;
+	return 0;
+}
+
+/**
+ * apfs_iomap_fusion - Map part of a file extent in a Fusion container
+ * @inode:	the file
+ * @ext:	extent that covers @pos
+ * @pos:	file offset to map
+ * @iomap:	the mapping, with the whole extent set up
+ *
+ * The blocks of an extent may be split between the devices, or partly kept in
+ * the write-back cache, so the mapping starts at the block of @pos and only
+ * goes on for as long as they stay in one place.  Returns 0 on success, or a
+ * negative error code in case of failure.
+ */
+static int apfs_iomap_fusion(struct inode *inode, struct apfs_file_extent *ext,
+			     loff_t pos, struct iomap *iomap)
+{
+	struct super_block *sb = inode->i_sb;
+	struct block_device *bdev;
+	u64 skip = (pos - ext->logical_addr) >> inode->i_blkbits;
+	u64 dev_bno, count;
+	int err;
 
-	/* Find the block offset of iblock within the extent */
-	blk_off = iblock - (ext.logical_addr >> inode->i_blkbits);
+	err = apfs_fusion_map(sb, ext->phys_block_num + skip, &bdev, &dev_bno,
+			      &count);
+	if (err)
+		return err;
 
-	/* Make sure we don't read past the extent boundaries */
-	map_len = ext.len - (blk_off << inode->i_blkbits);
-	if (bh_result->b_size > map_len)
-		bh_result->b_size = map_len;
+	iomap->offset = ext->logical_addr + (skip << inode->i_blkbits);
+	iomap->length = ext->len - (skip << inode->i_blkbits);
+	if (count < iomap->length >> inode->i_blkbits)
+		iomap->length = count << inode->i_blkbits;
+	iomap->bdev = bdev;
+	iomap->addr = dev_bno << inode->i_blkbits;
+	return 0;
+}
 
-	/*
-	 * Save the requested mapping length as map_bh() replaces it with
-	 * the filesystem block size
-	 */
-	map_len = bh_result->b_size;
+/**
+ * apfs_iomap_extent - Map the file extent that covers a file offset
+ * @inode:	the file
+ * @pos:	file offset to map
+ * @length:	length of the range wanted by the caller
+ * @flags:	type of operation (only reads are supported)
+ * @iomap:	Return parameter.  The mapping found.
+ *
+ * Always reports the whole extent record, so that the iomap code can build
+ * bios as large as the extent.  Returns 0 on success, or a negative error
+ * code in case of failure.
+ */
+static int apfs_iomap_extent(struct inode *inode, loff_t pos, loff_t length,
+			     unsigned int flags, struct iomap *iomap)
+{
+	struct super_block *sb = inode->i_sb;
+	struct apfs_file_extent ext;
+	int ret;
+
+	if (flags & IOMAP_WRITE)
+		return -EROFS;
+
+	iomap->bdev = sb->s_bdev;
+	iomap->dax_dev = APFS_SB(sb)->s_daxdev;
+	iomap->flags = 0;
+	iomap->type = IOMAP_HOLE;
+	iomap->addr = IOMAP_NULL_ADDR;
+
+	ret = apfs_extent_read(inode, pos >> inode->i_blkbits, &ext,
+			       flags & IOMAP_NOWAIT);
+	if (ret == -ENODATA)
+		return apfs_iomap_hole(inode, NULL, pos, length, flags,
+				       iomap);
+	if (ret)
+		return ret;
+	if (pos >= ext.logical_addr + ext.len)
+		return apfs_iomap_hole(inode, &ext, pos, length, flags,
+				       iomap);
+
+	iomap->offset = ext.logical_addr;
+	iomap->length = ext.len;
 	/* Extents representing holes have block number 0 */
-	if (ext.phys_block_num != 0) {
-		/* Find the block number of iblock within the disk */
-		bno = ext.phys_block_num + blk_off;
-		map_bh(bh_result, sb, bno);
+	if (ext.phys_block_num == 0)
+		return 0;
+	iomap->type = IOMAP_MAPPED;
+	if (APFS_SB(sb)->s_nxi->nx_tier2_bdev) {
+		/* The middle tree may need to be read */
+		if (flags & IOMAP_NOWAIT)
+			return -EAGAIN;
+		return apfs_iomap_fusion(inode, &ext, pos, iomap);
+	}
+	iomap->addr = ext.phys_block_num << inode->i_blkbits;
+	if (!(flags & IOMAP_REPORT))
+		apfs_heat_inc(sb, APFS_HEAT_DATA,
+			      iomap->addr + pos - iomap->offset);
+	return 0;
+}
+
+/**
+ * apfs_iomap_map - Map the file extent or hole run that covers a file offset
+ * @inode:	the file
+ * @pos:	file offset to map
+ * @length:	length of the range wanted by the caller
+ * @flags:	type of operation (only reads are supported)
+ * @iomap:	Return parameter.  The mapping found.
+ *
+ * Sparse files often have a hole made of several sparse extent records, and
+ * of the gaps between them.  All of it inside the range is reported as one
+ * hole, so that readahead and seeks don't go through the records one by one.
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_iomap_map(struct inode *inode, loff_t pos, loff_t length,
+			  unsigned int flags, struct iomap *iomap)
+{
+	loff_t end = pos + length;
+	int ret;
+
+	ret = apfs_iomap_extent(inode, pos, length, flags, iomap);
+	if (ret || iomap->type != IOMAP_HOLE)
+		return ret;
+
+	while (iomap->offset + iomap->length < end) {
+		loff_t next_pos = iomap->offset + iomap->length;
+		struct iomap next;
+
+		/* The hole found so far is valid, whatever happens here */
+		if (apfs_iomap_extent(inode, next_pos, end - next_pos, flags,
+				      &next))
+			break;
+		if (next.type != IOMAP_HOLE)
+			break;
+		iomap->length = next.offset + next.length - iomap->offset;
 	}
+	return 0;
+}
+
+/**
+ * apfs_iomap_begin - Map the file extent that covers a file offset
+ * @inode:	the file
+ * @pos:	file offset to map
+ * @length:	length of the range wanted by the caller
+ * @flags:	type of operation (only reads are supported)
+ * @iomap:	Return parameter.  The mapping found.
+ *
+ * Same as apfs_iomap_map(), but with a tracepoint.
+ */
+static int apfs_iomap_begin(struct inode *inode, loff_t pos, loff_t length,
+			    unsigned int flags, struct iomap *iomap)
+{
+	int ret;
+
+	ret = apfs_iomap_map(inode, pos, length, flags, iomap);
+	trace_apfs_iomap_begin(inode, pos, length, iomap, ret);
+	return ret;
+}
+
+/**
+ * apfs_extent_end - Find where the extent or hole that covers an offset ends
+ * @inode:	the file
+ * @pos:	file offset, below the file size
+ * @end:	Return parameter.  The offset where the mapping ends.
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+int apfs_extent_end(struct inode *inode, loff_t pos, loff_t *end)
+{
+	struct iomap iomap;
+	int ret;
 
-	bh_result->b_size = map_len;
+	ret = apfs_iomap_begin(inode, pos, i_size_read(inode) - pos,
+			       0 /* flags */, &iomap);
+	if (ret)
+		return ret;
+	*end = iomap.offset + iomap.length;
 	return 0;
 }
+
+const struct iomap_ops apfs_iomap_ops = {
+	.iomap_begin	= apfs_iomap_begin,
+};
@@ -8,11 +8,20 @@
 #ifndef _EXTENTS_H
 #define _EXTENTS_H
 
+#include <linux/list.h>
+#include <linux/list_lru.h>
+#include <linux/rcupdate.h>
+#include <linux/shrinker.h>
+#include <linux/spinlock.h>
 #include <linux/types.h>
 
-struct inode;
-struct buffer_head;
+struct apfs_frag_report;
 struct apfs_query;
+struct fiemap_extent_info;
+struct file;
+struct inode;
+struct iomap_ops;
+struct super_block;
 
 /* File extent records */
 #define APFS_FILE_EXTENT_LEN_MASK	0x00ffffffffffffffULL
@@ -28,6 +37,20 @@ struct apfs_file_extent_val {
 	__le64 crypto_id;
 } __packed;
 
+/* Physical extent records */
+#define APFS_PEXT_LEN_MASK	0x0fffffffffffffffULL
+#define APFS_PEXT_KIND_MASK	0xf000000000000000ULL
+#define APFS_PEXT_KIND_SHIFT	60
+
+/*
+ * Structure of a physical extent record, from the extent reference tree
+ */
+struct apfs_phys_ext_val {
+	__le64 len_and_kind;
+	__le64 owning_obj_id;
+	__le32 refcnt;
+} __packed;
+
 /*
  * Extent record data in memory
  */
@@ -35,11 +58,54 @@ struct apfs_file_extent {
 	u64 logical_addr;
 	u64 phys_block_num;
 	u64 len;
+	u64 crypto_id;		/* Tweak for the first sector, if encrypted */
+	bool shared;		/* Checked only if the blocks may be shared */
+};
+
+/* Maximum number of extents kept in the extent map of an inode */
+#define APFS_EXTENT_MAP_SIZE	32
+
+/*
+ * Sorted array of the extents of an inode.  Maps are never modified after
+ * they are published, so readers only need rcu protection; updates replace
+ * the whole map.
+ */
+struct apfs_extent_map {
+	struct rcu_head rcu;
+	int nr;				/* Number of extents */
+	struct apfs_file_extent extents[APFS_EXTENT_MAP_SIZE];
+};
+
+/* Number of extent maps kept for a mount by default */
+#define APFS_EXTENT_MAPS_DEFAULT_SIZE	8192
+
+/*
+ * List of the inodes that have an extent map, so that the maps can be
+ * reclaimed under memory pressure.  The inodes are kept apart by memory
+ * cgroup, so that each container only gives up its own maps.
+ */
+struct apfs_extent_maps {
+	struct list_lru lru;		/* Inodes with a map, oldest first */
+	unsigned long max;		/* Limit for the maps in @lru */
+	struct shrinker shrinker;
 };
 
 extern int apfs_extent_from_query(struct apfs_query *query,
 				  struct apfs_file_extent *extent);
-extern int apfs_get_block(struct inode *inode, sector_t iblock,
-			  struct buffer_head *bh_result, int create);
+extern int apfs_fiemap(struct inode *inode, struct fiemap_extent_info *fieinfo,
+		       u64 start, u64 len);
+extern int apfs_extent_frag(struct inode *inode, struct apfs_frag_report *rep);
+extern int apfs_extent_end(struct inode *inode, loff_t pos, loff_t *end);
+extern int apfs_extent_read(struct inode *inode, sector_t iblock,
+			    struct apfs_file_extent *extent, bool nowait);
+extern void apfs_extent_map_insert(struct inode *inode,
+				   struct apfs_file_extent *extent);
+extern void apfs_extent_map_free(struct inode *inode);
+extern int apfs_extent_prefetch(struct file *file, loff_t start, loff_t end);
+extern int apfs_extent_maps_init(struct super_block *sb);
+extern void apfs_extent_maps_destroy(struct super_block *sb);
+extern void apfs_extent_maps_set_max(struct super_block *sb,
+				     unsigned long max);
+extern const struct iomap_ops apfs_iomap_ops;
 
 #endif	/* _EXTENTS_H */
@@ -5,18 +5,213 @@
  * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
  */
 
+#include <linux/fadvise.h>
+#include <linux/iomap.h>
+#include <linux/mm.h>
+#include <linux/pfn_t.h>
+#include <linux/uio.h>
 #include "apfs.h"
+#include "dax.h"
+#include "extents.h"
 #include "inode.h"
+#include "ioctl.h"
+#include "super.h"
 #include "xattr.h"
 
+/**
+ * apfs_file_read_iter - Read from a regular file
+ * @iocb:	the read request
+ * @to:		destination of the data
+ *
+ * Direct reads go straight from the extents to the user buffers, without
+ * polluting the page cache; holes get zeroed by the iomap code.  Returns the
+ * number of bytes read, or a negative error code in case of failure.
+ */
+static ssize_t apfs_file_read_iter(struct kiocb *iocb, struct iov_iter *to)
+{
+	struct inode *inode = file_inode(iocb->ki_filp);
+	ssize_t ret;
+
+	if (IS_DAX(inode))
+		return apfs_dax_read_iter(iocb, to);
+	/* Ciphertext can't go straight to the user, so fall back to buffered */
+	if (APFS_SB(inode->i_sb)->s_tfm)
+		iocb->ki_flags &= ~IOCB_DIRECT;
+	if (!(iocb->ki_flags & IOCB_DIRECT))
+		return generic_file_read_iter(iocb, to);
+	if (!iov_iter_count(to))
+		return 0;
+
+	file_accessed(iocb->ki_filp);
+
+	if (iocb->ki_flags & IOCB_NOWAIT) {
+		if (!inode_trylock_shared(inode))
+			return -EAGAIN;
+	} else {
+		inode_lock_shared(inode);
+	}
+	ret = iomap_dio_rw(iocb, to, &apfs_iomap_ops, NULL /* end_io */);
+	inode_unlock_shared(inode);
+	return ret;
+}
+
+/**
+ * apfs_filemap_fault - Handle a page fault on a mapped regular file
+ * @vmf:	the fault
+ *
+ * A read fault on a page that lies entirely inside a hole gets the shared
+ * zero page, so large sparse files can be mapped without allocating page
+ * cache for their holes.  Everything else goes to filemap_fault().
+ */
+static vm_fault_t apfs_filemap_fault(struct vm_fault *vmf)
+{
+	struct vm_area_struct *vma = vmf->vma;
+	struct inode *inode = file_inode(vma->vm_file);
+	loff_t pos = (loff_t)vmf->pgoff << PAGE_SHIFT;
+	loff_t end = min_t(loff_t, pos + PAGE_SIZE, i_size_read(inode));
+	struct iomap iomap;
+	pfn_t pfn;
+
+	/* Private copies need a page to copy, and past the end is a SIGBUS */
+	if ((vmf->flags & FAULT_FLAG_WRITE) || pos >= end)
+		return filemap_fault(vmf);
+	if (apfs_iomap_ops.iomap_begin(inode, pos, end - pos, 0 /* flags */,
+				       &iomap))
+		return filemap_fault(vmf);
+	if (iomap.type != IOMAP_HOLE || iomap.offset + iomap.length < end)
+		return filemap_fault(vmf);
+
+	pfn = pfn_to_pfn_t(my_zero_pfn(vmf->address));
+	return vmf_insert_mixed(vma, vmf->address, pfn);
+}
+
+static const struct vm_operations_struct apfs_file_vm_ops = {
+	.fault		= apfs_filemap_fault,
+	.map_pages	= filemap_map_pages,
+};
+
+/**
+ * apfs_file_mmap - Map a regular file in memory
+ * @file:	the file
+ * @vma:	the new mapping
+ *
+ * The mapping may hold the zero page for holes, alongside the page cache.
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_file_mmap(struct file *file, struct vm_area_struct *vma)
+{
+	int err;
+
+	if (IS_DAX(file_inode(file)))
+		return apfs_dax_mmap(file, vma);
+	err = generic_file_readonly_mmap(file, vma);
+	if (err)
+		return err;
+	vma->vm_ops = &apfs_file_vm_ops;
+	vma->vm_flags |= VM_MIXEDMAP;
+	return 0;
+}
+
+/**
+ * apfs_file_open - Open a regular file
+ * @inode:	the file
+ * @filp:	the open file structure
+ *
+ * Reads honour IOCB_NOWAIT: buffered ones never get past the page cache, and
+ * the mapping for direct ones only uses catalog nodes already in memory.  This
+ * is what allows RWF_NOWAIT on our files.  Returns 0 on success, or a negative
+ * error code in case of failure.
+ */
+int apfs_file_open(struct inode *inode, struct file *filp)
+{
+	filp->f_mode |= FMODE_NOWAIT;
+	return generic_file_open(inode, filp);
+}
+
+/**
+ * apfs_file_llseek - Change the file position, with support for sparse files
+ * @file:	the file
+ * @offset:	new position, or starting point for the search
+ * @whence:	how to interpret @offset
+ *
+ * SEEK_DATA and SEEK_HOLE are answered from the extent records, so sparse
+ * files can be skipped through without reading the holes.  Returns the new
+ * position, or a negative error code in case of failure.
+ */
+static loff_t apfs_file_llseek(struct file *file, loff_t offset, int whence)
+{
+	struct inode *inode = file->f_mapping->host;
+
+	switch (whence) {
+	default:
+		return generic_file_llseek(file, offset, whence);
+	case SEEK_HOLE:
+		/* Only the implicit hole at the end, no need to check extents */
+		if (!APFS_I(inode)->i_sparse_bytes) {
+			if (offset < 0 || offset >= i_size_read(inode))
+				return -ENXIO;
+			offset = i_size_read(inode);
+			break;
+		}
+		inode_lock_shared(inode);
+		offset = iomap_seek_hole(inode, offset, &apfs_iomap_ops);
+		inode_unlock_shared(inode);
+		break;
+	case SEEK_DATA:
+		inode_lock_shared(inode);
+		offset = iomap_seek_data(inode, offset, &apfs_iomap_ops);
+		inode_unlock_shared(inode);
+		break;
+	}
+
+	if (offset < 0)
+		return offset;
+	return vfs_setpos(file, offset, inode->i_sb->s_maxbytes);
+}
+
+/**
+ * apfs_file_fadvise - Act on advice about the access pattern of a file
+ * @file:	the file
+ * @offset:	start of the range
+ * @len:	length of the range, or 0 to go on to the end of the file
+ * @advice:	the advice
+ *
+ * For POSIX_FADV_WILLNEED, all the extents of the range are mapped before the
+ * data is read ahead, so the readahead doesn't stop at each one to search the
+ * catalog.  Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_file_fadvise(struct file *file, loff_t offset, loff_t len,
+			     int advice)
+{
+	struct inode *inode = file_inode(file);
+	loff_t end;
+
+	/* Leave the bad requests, and the rest of the advice, to the vfs */
+	if (advice != POSIX_FADV_WILLNEED || IS_DAX(inode) ||
+	    offset < 0 || len < 0)
+		return generic_fadvise(file, offset, len, advice);
+
+	end = (!len || len > LLONG_MAX - offset) ? LLONG_MAX : offset + len;
+	if (apfs_extent_prefetch(file, offset, end))
+		return generic_fadvise(file, offset, len, advice);
+	return 0;
+}
+
 const struct file_operations apfs_file_operations = {
-	.llseek		= generic_file_llseek,
-	.read_iter	= generic_file_read_iter,
-	.mmap		= generic_file_readonly_mmap,
-	.open		= generic_file_open,
+	.llseek		= apfs_file_llseek,
+	.read_iter	= apfs_file_read_iter,
+	.mmap		= apfs_file_mmap,
+	.splice_read	= generic_file_splice_read,
+	.open		= apfs_file_open,
+	.fadvise	= apfs_file_fadvise,
+	.unlocked_ioctl	= apfs_ioctl,
+#ifdef CONFIG_COMPAT
+	.compat_ioctl	= apfs_compat_ioctl,
+#endif
 };
 
 const struct inode_operations apfs_file_inode_operations = {
 	.getattr	= apfs_getattr,
 	.listxattr	= apfs_listxattr,
+	.fiemap		= apfs_fiemap,
 };
@@ -0,0 +1,466 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/freeidx.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ *
+ * In-memory index of the free space of a container, built from the bitmaps
+ * of the space manager.  Every free extent is kept in two trees: one sorted
+ * by first block, to find space right after a given block, and one sorted by
+ * length, for best-fit searches.  Both take logarithmic time, so allocations
+ * never have to scan the bitmaps again.
+ *
+ * Only the main device is indexed; the blocks of the second tier of a Fusion
+ * container have a separate address space.
+ */
+
+#include <linux/blkdev.h>
+#include <linux/buffer_head.h>
+#include <linux/log2.h>
+#include <linux/sched/signal.h>
+#include <linux/slab.h>
+#include "apfs.h"
+#include "freeidx.h"
+#include "message.h"
+#include "object.h"
+#include "spaceman.h"
+#include "super.h"
+
+/*
+ * State of the build of an index
+ */
+struct apfs_free_build {
+	struct super_block *sb;
+	struct apfs_free_index *fi;
+	u64 start;		/* Free run not yet in the index */
+	u64 len;
+};
+
+/**
+ * apfs_free_index_clear - Remove all the extents from an index
+ * @fi:		the index
+ */
+static void apfs_free_index_clear(struct apfs_free_index *fi)
+{
+	struct apfs_free_extent *ext, *tmp;
+
+	rbtree_postorder_for_each_entry_safe(ext, tmp, &fi->by_start, by_start)
+		kfree(ext);
+	fi->by_start = RB_ROOT;
+	fi->by_len = RB_ROOT;
+	fi->nr = fi->blocks = 0;
+	memset(fi->buckets, 0, sizeof(fi->buckets));
+}
+
+/**
+ * apfs_free_index_insert - Add a free extent to an index
+ * @fi:		the index
+ * @start:	first block of the extent
+ * @len:	length of the extent, in blocks
+ *
+ * Returns 0 on success, or -ENOMEM in case of failure.
+ */
+static int apfs_free_index_insert(struct apfs_free_index *fi, u64 start,
+				  u64 len)
+{
+	struct rb_node **new, *parent;
+	struct apfs_free_extent *ext, *curr;
+
+	ext = kmalloc(sizeof(*ext), GFP_KERNEL);
+	if (!ext)
+		return -ENOMEM;
+	ext->start = start;
+	ext->len = len;
+
+	new = &fi->by_start.rb_node;
+	parent = NULL;
+	while (*new) {
+		curr = rb_entry(*new, struct apfs_free_extent, by_start);
+		parent = *new;
+		if (start < curr->start)
+			new = &parent->rb_left;
+		else
+			new = &parent->rb_right;
+	}
+	rb_link_node(&ext->by_start, parent, new);
+	rb_insert_color(&ext->by_start, &fi->by_start);
+
+	new = &fi->by_len.rb_node;
+	parent = NULL;
+	while (*new) {
+		curr = rb_entry(*new, struct apfs_free_extent, by_len);
+		parent = *new;
+		if (len < curr->len ||
+		    (len == curr->len && start < curr->start))
+			new = &parent->rb_left;
+		else
+			new = &parent->rb_right;
+	}
+	rb_link_node(&ext->by_len, parent, new);
+	rb_insert_color(&ext->by_len, &fi->by_len);
+
+	fi->nr++;
+	fi->blocks += len;
+	fi->buckets[min_t(unsigned int, ilog2(len), APFS_FREE_BUCKETS - 1)]++;
+	return 0;
+}
+
+/**
+ * apfs_free_build_add - Add a run of free blocks found in a bitmap
+ * @b:		the build
+ * @start:	first free block
+ * @len:	number of free blocks
+ *
+ * Runs that continue in the next chunk become a single extent.  Returns 0 on
+ * success, or -ENOMEM in case of failure.
+ */
+static int apfs_free_build_add(struct apfs_free_build *b, u64 start, u64 len)
+{
+	int err = 0;
+
+	if (b->len && b->start + b->len == start) {
+		b->len += len;
+		return 0;
+	}
+	if (b->len)
+		err = apfs_free_index_insert(b->fi, b->start, b->len);
+	b->start = start;
+	b->len = len;
+	return err;
+}
+
+/**
+ * apfs_free_build_chunk - Add the free blocks of a chunk to the index
+ * @b:		the build
+ * @ci:		chunk-info for the chunk
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_free_build_chunk(struct apfs_free_build *b,
+				 struct apfs_chunk_info *ci)
+{
+	struct super_block *sb = b->sb;
+	u64 first = le64_to_cpu(ci->ci_addr);
+	u64 bitmap = le64_to_cpu(ci->ci_bitmap_addr);
+	u32 count = le32_to_cpu(ci->ci_block_count) & APFS_CI_COUNT_MASK;
+	u32 free = le32_to_cpu(ci->ci_free_count) & APFS_CI_COUNT_MASK;
+	struct buffer_head *bh;
+	unsigned long pos, end;
+	int err = 0;
+
+	if (free > count || count > sb->s_blocksize * BITS_PER_BYTE)
+		return -EFSCORRUPTED;
+	if (!free)
+		return 0;
+	if (!bitmap) {
+		/* Chunks without a bitmap were never allocated from */
+		if (free != count)
+			return -EFSCORRUPTED;
+		return apfs_free_build_add(b, first, count);
+	}
+
+	bh = sb_bread(sb, bitmap);
+	if (!bh)
+		return -EIO;
+	pos = find_next_zero_bit_le(bh->b_data, count, 0);
+	while (!err && pos < count) {
+		end = find_next_bit_le(bh->b_data, count, pos);
+		err = apfs_free_build_add(b, first + pos, end - pos);
+		pos = find_next_zero_bit_le(bh->b_data, count, end);
+	}
+	brelse(bh);
+	return err;
+}
+
+/**
+ * apfs_free_build_cib - Add the free blocks of a chunk-info block to the index
+ * @b:		the build
+ * @bno:	block number of the chunk-info block
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_free_build_cib(struct apfs_free_build *b, u64 bno)
+{
+	struct super_block *sb = b->sb;
+	struct apfs_chunk_info_block *cib;
+	struct buffer_head *bh;
+	struct blk_plug plug;
+	u32 type, count, max_count, i;
+	int err = 0;
+
+	bh = sb_bread(sb, bno);
+	if (!bh)
+		return -EIO;
+	cib = (struct apfs_chunk_info_block *)bh->b_data;
+	type = le32_to_cpu(cib->cib_o.o_type) & APFS_OBJECT_TYPE_MASK;
+	if (type != APFS_OBJECT_TYPE_SPACEMAN_CIB) {
+		err = -EFSCORRUPTED;
+		goto out;
+	}
+	if (!apfs_obj_verify_csum(sb, &cib->cib_o)) {
+		err = -EFSBADCRC;
+		goto out;
+	}
+	count = le32_to_cpu(cib->cib_chunk_info_count);
+	max_count = (sb->s_blocksize - sizeof(*cib)) /
+		    sizeof(struct apfs_chunk_info);
+	if (count > max_count) {
+		err = -EFSCORRUPTED;
+		goto out;
+	}
+
+	/* Start the reads for all the bitmaps before waiting on the first */
+	blk_start_plug(&plug);
+	for (i = 0; i < count; i++) {
+		u64 bitmap = le64_to_cpu(cib->cib_chunk_info[i].ci_bitmap_addr);
+
+		if (bitmap)
+			sb_breadahead(sb, bitmap);
+	}
+	blk_finish_plug(&plug);
+
+	for (i = 0; i < count; i++) {
+		err = apfs_free_build_chunk(b, &cib->cib_chunk_info[i]);
+		if (err)
+			break;
+		if (fatal_signal_pending(current)) {
+			err = -EINTR;
+			break;
+		}
+		cond_resched();
+	}
+out:
+	brelse(bh);
+	return err;
+}
+
+/**
+ * apfs_free_build_cab - Add the free blocks of a chunk-info address block
+ * @b:		the build
+ * @bno:	block number of the chunk-info address block
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_free_build_cab(struct apfs_free_build *b, u64 bno)
+{
+	struct super_block *sb = b->sb;
+	struct apfs_cib_addr_block *cab;
+	struct buffer_head *bh;
+	u32 type, count, max_count, i;
+	int err = 0;
+
+	bh = sb_bread(sb, bno);
+	if (!bh)
+		return -EIO;
+	cab = (struct apfs_cib_addr_block *)bh->b_data;
+	type = le32_to_cpu(cab->cab_o.o_type) & APFS_OBJECT_TYPE_MASK;
+	if (type != APFS_OBJECT_TYPE_SPACEMAN_CAB) {
+		err = -EFSCORRUPTED;
+		goto out;
+	}
+	if (!apfs_obj_verify_csum(sb, &cab->cab_o)) {
+		err = -EFSBADCRC;
+		goto out;
+	}
+	count = le32_to_cpu(cab->cab_cib_count);
+	max_count = (sb->s_blocksize - sizeof(*cab)) / sizeof(__le64);
+	if (count > max_count) {
+		err = -EFSCORRUPTED;
+		goto out;
+	}
+	for (i = 0; i < count && !err; i++)
+		err = apfs_free_build_cib(b, le64_to_cpu(cab->cab_cib_addr[i]));
+out:
+	brelse(bh);
+	return err;
+}
+
+/**
+ * apfs_free_index_build - Read the space manager bitmaps into the index
+ * @sb:		filesystem superblock
+ *
+ * Returns 0 on success, or a negative error code in case of failure.  In that
+ * case the index is left empty, and the next caller tries again.
+ */
+static int apfs_free_index_build(struct super_block *sb)
+{
+	struct apfs_nxsb_info *nxi = APFS_SB(sb)->s_nxi;
+	struct apfs_spaceman *sm = &nxi->nx_spaceman;
+	struct apfs_free_build b = {
+		.sb = sb,
+		.fi = &nxi->nx_free_index,
+	};
+	struct apfs_spaceman_phys *sm_raw;
+	struct apfs_spaceman_device *dev;
+	struct apfs_object obj;
+	__le64 *addrs;
+	u32 cib_count, cab_count, nr, off, i;
+	int err;
+
+	if (!sm->valid)
+		return -ENODATA;
+	err = apfs_object_read(sb, sm->paddr, sm->blocks, &obj);
+	if (err)
+		return err;
+	sm_raw = (struct apfs_spaceman_phys *)obj.data;
+	dev = &sm_raw->sm_dev[APFS_SD_MAIN];
+
+	/* Large containers need an extra level to locate the chunk-infos */
+	cib_count = le32_to_cpu(dev->sm_cib_count);
+	cab_count = le32_to_cpu(dev->sm_cab_count);
+	nr = cab_count ? cab_count : cib_count;
+	off = le32_to_cpu(dev->sm_addr_offset);
+	if (off & (sizeof(*addrs) - 1) || off > obj.size ||
+	    nr > (obj.size - off) / sizeof(*addrs)) {
+		apfs_err(sb, "bad address array for the space manager");
+		err = -EFSCORRUPTED;
+		goto out;
+	}
+	addrs = (__le64 *)(obj.data + off);
+
+	for (i = 0; i < nr && !err; i++) {
+		u64 bno = le64_to_cpu(addrs[i]);
+
+		if (cab_count)
+			err = apfs_free_build_cab(&b, bno);
+		else
+			err = apfs_free_build_cib(&b, bno);
+	}
+	if (!err && b.len)
+		err = apfs_free_index_insert(b.fi, b.start, b.len);
+	if (err)
+		apfs_free_index_clear(b.fi);
+out:
+	apfs_object_release(&obj);
+	return err;
+}
+
+/**
+ * apfs_free_index_get - Build the free space index if needed
+ * @sb:		filesystem superblock
+ *
+ * Must be called with the index lock held.  Returns 0 on success, or a
+ * negative error code in case of failure.
+ */
+static int apfs_free_index_get(struct super_block *sb)
+{
+	struct apfs_free_index *fi = &APFS_SB(sb)->s_nxi->nx_free_index;
+	int err;
+
+	lockdep_assert_held(&fi->lock);
+	if (fi->built)
+		return 0;
+	err = apfs_free_index_build(sb);
+	if (err)
+		return err;
+	fi->built = true;
+	return 0;
+}
+
+void apfs_free_index_init(struct apfs_free_index *fi)
+{
+	mutex_init(&fi->lock);
+	fi->by_start = RB_ROOT;
+	fi->by_len = RB_ROOT;
+}
+
+void apfs_free_index_destroy(struct apfs_free_index *fi)
+{
+	apfs_free_index_clear(fi);
+	fi->built = false;
+}
+
+/**
+ * apfs_free_index_find - Find free space for an allocation
+ * @sb:		filesystem superblock
+ * @len:	number of blocks wanted
+ * @goal:	block that the new extent should start at if possible, such as
+ *		the one that follows the previous extent of the file; 0 for none
+ * @bno:	on return, the first block of the free space found
+ *
+ * Space right at @goal, or in the free extent that follows it, is taken if
+ * it's large enough; otherwise the smallest free extent that will do.  The
+ * index is not modified.  Returns 0 on success, -ENOSPC if no free extent is
+ * large enough, or another negative error code in case of failure.
+ */
+int apfs_free_index_find(struct super_block *sb, u64 len, u64 goal, u64 *bno)
+{
+	struct apfs_free_index *fi = &APFS_SB(sb)->s_nxi->nx_free_index;
+	struct apfs_free_extent *ext, *best = NULL;
+	struct rb_node *node;
+	int err;
+
+	mutex_lock(&fi->lock);
+	err = apfs_free_index_get(sb);
+	if (err)
+		goto out;
+
+	if (goal) {
+		/* The last free extent that starts at or before the goal */
+		for (node = fi->by_start.rb_node; node;) {
+			ext = rb_entry(node, struct apfs_free_extent, by_start);
+			if (ext->start <= goal) {
+				best = ext;
+				node = node->rb_right;
+			} else {
+				node = node->rb_left;
+			}
+		}
+		if (best && goal - best->start < best->len &&
+		    best->len - (goal - best->start) >= len) {
+			*bno = goal;
+			goto out;
+		}
+		node = best ? rb_next(&best->by_start) :
+			      rb_first(&fi->by_start);
+		ext = node ? rb_entry(node, struct apfs_free_extent, by_start) :
+			     NULL;
+		if (ext && ext->len >= len) {
+			*bno = ext->start;
+			goto out;
+		}
+		best = NULL;
+	}
+
+	for (node = fi->by_len.rb_node; node;) {
+		ext = rb_entry(node, struct apfs_free_extent, by_len);
+		if (ext->len >= len) {
+			best = ext;
+			node = node->rb_left;
+		} else {
+			node = node->rb_right;
+		}
+	}
+	if (best)
+		*bno = best->start;
+	else
+		err = -ENOSPC;
+out:
+	mutex_unlock(&fi->lock);
+	return err;
+}
+
+/**
+ * apfs_free_index_show - Print the free extents by size for sysfs
+ * @sbi:	in-memory superblock info
+ * @buf:	page to print to
+ *
+ * Each line has the smallest length for a bucket, in blocks, followed by the
+ * number of free extents in it.  Empty buckets are left out.
+ */
+ssize_t apfs_free_index_show(struct apfs_sb_info *sbi, char *buf)
+{
+	struct apfs_free_index *fi = &sbi->s_nxi->nx_free_index;
+	ssize_t len = 0;
+	int err, i;
+
+	mutex_lock(&fi->lock);
+	err = apfs_free_index_get(sbi->s_vobject.sb);
+	for (i = 0; !err && i < APFS_FREE_BUCKETS; i++) {
+		if (fi->buckets[i])
+			len += sprintf(buf + len, "%llu %llu\n", 1ULL << i,
+				       fi->buckets[i]);
+	}
+	mutex_unlock(&fi->lock);
+	return err ? err : len;
+}
@@ -0,0 +1,52 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/freeidx.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_FREEIDX_H
+#define _APFS_FREEIDX_H
+
+#include <linux/mutex.h>
+#include <linux/rbtree.h>
+#include <linux/types.h>
+
+struct apfs_sb_info;
+struct super_block;
+
+/* Number of size buckets, each for the lengths with the same log2 */
+#define APFS_FREE_BUCKETS	32
+
+/*
+ * Free extent of the container, in the two trees of the index
+ */
+struct apfs_free_extent {
+	struct rb_node by_start;	/* Sorted by first block */
+	struct rb_node by_len;		/* Sorted by length, then first block */
+	u64 start;
+	u64 len;
+};
+
+/*
+ * Index of the free extents of the main device of a container, as of the
+ * mounted checkpoint.  It's built from the space manager bitmaps the first
+ * time it's needed, since that means reading all of them.
+ */
+struct apfs_free_index {
+	struct mutex lock;		/* Protects all the fields */
+	bool built;			/* Have the bitmaps been read? */
+	struct rb_root by_start;
+	struct rb_root by_len;
+	u64 nr;				/* Number of free extents */
+	u64 blocks;			/* Total free blocks */
+	u64 buckets[APFS_FREE_BUCKETS];	/* Free extents by log2 of length */
+};
+
+extern void apfs_free_index_init(struct apfs_free_index *fi);
+extern void apfs_free_index_destroy(struct apfs_free_index *fi);
+extern int apfs_free_index_find(struct super_block *sb, u64 len, u64 goal,
+				u64 *bno);
+extern ssize_t apfs_free_index_show(struct apfs_sb_info *sbi, char *buf);
+
+#endif	/* _APFS_FREEIDX_H */
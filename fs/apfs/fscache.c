@@ -0,0 +1,358 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/fscache.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ *
+ * Local caching of file data with fscache, for images that live on network
+ * block devices.  Each mount gets an index keyed by the uuids of the container
+ * and the volume and by the transaction id; the mount is read-only, so the
+ * cached data for a given key never goes stale and survives remounts.
+ *
+ * Pages missing from the cache are read from the device as usual, and then
+ * written to the cache by a worker once the read is over, since the bios are
+ * owned by the iomap code.
+ */
+
+#include <linux/fs.h>
+#include <linux/fscache.h>
+#include <linux/mm.h>
+#include <linux/pagemap.h>
+#include <linux/slab.h>
+#include <linux/workqueue.h>
+#include "apfs.h"
+#include "fscache.h"
+#include "inode.h"
+#include "message.h"
+#include "super.h"
+
+static struct fscache_netfs apfs_fscache_netfs = {
+	.name		= "apfs",
+	.version	= 0,
+};
+
+static const struct fscache_cookie_def apfs_fscache_super_def = {
+	.name		= "APFS.super",
+	.type		= FSCACHE_COOKIE_TYPE_INDEX,
+};
+
+static const struct fscache_cookie_def apfs_fscache_inode_def = {
+	.name		= "APFS.inode",
+	.type		= FSCACHE_COOKIE_TYPE_DATAFILE,
+};
+
+/*
+ * Index key for a mount
+ */
+struct apfs_fscache_key {
+	char nx_uuid[16];	/* Container */
+	char vol_uuid[16];	/* Volume */
+	__le64 xid;		/* Checkpoint or snapshot being mounted */
+} __packed;
+
+/*
+ * Pages read from the device that should then be stored in the cache
+ */
+struct apfs_fscache_store {
+	struct work_struct work;
+	struct inode *inode;		/* Reference held until done */
+	unsigned int nr;
+	struct page *pages[];		/* References held until done */
+};
+
+/* Workqueue for the writes to the cache */
+static struct workqueue_struct *apfs_fscache_wq;
+
+/**
+ * apfs_fscache_register - Register the filesystem with fscache
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+int apfs_fscache_register(void)
+{
+	int err;
+
+	apfs_fscache_wq = alloc_workqueue("apfs-fscache", WQ_UNBOUND, 0);
+	if (!apfs_fscache_wq)
+		return -ENOMEM;
+	err = fscache_register_netfs(&apfs_fscache_netfs);
+	if (err)
+		destroy_workqueue(apfs_fscache_wq);
+	return err;
+}
+
+void apfs_fscache_unregister(void)
+{
+	fscache_unregister_netfs(&apfs_fscache_netfs);
+	destroy_workqueue(apfs_fscache_wq);
+}
+
+/**
+ * apfs_fscache_get_super - Get the fscache index for a mount
+ * @sb:		filesystem superblock
+ *
+ * Does nothing unless the fsc mount option was given.  A missing cache is
+ * not an error, the mount just goes on without one.  Returns 0 on success, or
+ * a negative error code in case of failure.
+ */
+int apfs_fscache_get_super(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct fscache_cookie *primary = apfs_fscache_netfs.primary_index;
+	struct apfs_fscache_key key;
+
+	if (!(sbi->s_flags & APFS_FSCACHE))
+		return 0;
+	/* Plaintext is not to be left on a local disk */
+	if (sbi->s_tfm) {
+		apfs_err(sb, "fsc is not supported for encrypted volumes");
+		return -EINVAL;
+	}
+
+	memset(&key, 0, sizeof(key));
+	memcpy(key.nx_uuid, sbi->s_msb_raw->nx_uuid, sizeof(key.nx_uuid));
+	memcpy(key.vol_uuid, sbi->s_vsb_raw->apfs_vol_uuid,
+	       sizeof(key.vol_uuid));
+	key.xid = cpu_to_le64(sbi->s_xid);
+
+	sbi->s_fscache = fscache_acquire_cookie(primary, &apfs_fscache_super_def,
+						&key, sizeof(key),
+						NULL /* aux_data */, 0,
+						sbi, 0 /* object_size */,
+						true /* enable */);
+	if (!sbi->s_fscache)
+		apfs_warn(sb, "no cache available, fsc has no effect");
+	return 0;
+}
+
+/**
+ * apfs_fscache_put_super - Release the fscache index for a mount
+ * @sb:		filesystem superblock
+ *
+ * The pending writes to the cache are waited for first, because they hold
+ * references to the inodes.
+ */
+void apfs_fscache_put_super(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+
+	if (!(sbi->s_flags & APFS_FSCACHE))
+		return;
+	flush_workqueue(apfs_fscache_wq);
+	fscache_relinquish_cookie(sbi->s_fscache, NULL /* aux_data */,
+				  false /* retire */);
+	sbi->s_fscache = NULL;
+}
+
+/**
+ * apfs_fscache_get_inode - Get the fscache object for a regular file
+ * @inode:	the file, with its data read through apfs_aops
+ */
+void apfs_fscache_get_inode(struct inode *inode)
+{
+	struct apfs_sb_info *sbi = APFS_SB(inode->i_sb);
+	struct apfs_inode_info *ai = APFS_I(inode);
+	__le64 key = cpu_to_le64(apfs_ino(inode));
+
+	if (!sbi->s_fscache)
+		return;
+	ai->i_fscache = fscache_acquire_cookie(sbi->s_fscache,
+					       &apfs_fscache_inode_def,
+					       &key, sizeof(key),
+					       NULL /* aux_data */, 0,
+					       ai, i_size_read(inode),
+					       true /* enable */);
+}
+
+/**
+ * apfs_fscache_put_inode - Release the fscache object for a file
+ * @inode:	the file, with its pages already truncated
+ */
+void apfs_fscache_put_inode(struct inode *inode)
+{
+	struct apfs_inode_info *ai = APFS_I(inode);
+
+	if (!ai->i_fscache)
+		return;
+	fscache_relinquish_cookie(ai->i_fscache, NULL /* aux_data */,
+				  false /* retire */);
+	ai->i_fscache = NULL;
+}
+
+static void apfs_fscache_read_done(struct page *page, void *context, int error)
+{
+	if (!error)
+		SetPageUptodate(page);
+	unlock_page(page);
+}
+
+static void apfs_fscache_store_work(struct work_struct *work)
+{
+	struct apfs_fscache_store *store;
+	struct inode *inode;
+	struct fscache_cookie *cookie;
+	unsigned int i;
+
+	store = container_of(work, struct apfs_fscache_store, work);
+	inode = store->inode;
+	cookie = APFS_I(inode)->i_fscache;
+
+	for (i = 0; i < store->nr; i++) {
+		struct page *page = store->pages[i];
+
+		/* Waits for the read, and for truncation to be done with it */
+		lock_page(page);
+		if (!PageFsCache(page))
+			goto next;
+		/* Pages the iomap code didn't add to the cache were dropped */
+		if (page->mapping != inode->i_mapping || !PageUptodate(page) ||
+		    fscache_write_page(cookie, page, i_size_read(inode),
+				       GFP_KERNEL))
+			fscache_uncache_page(cookie, page);
+next:
+		unlock_page(page);
+		put_page(page);
+	}
+	iput(inode);
+	kfree(store);
+}
+
+/**
+ * apfs_fscache_store_alloc - Allocate the list of pages to store in the cache
+ * @inode:	the file
+ * @nr:		number of pages that will be added
+ *
+ * Returns the new list, or NULL in case of failure.
+ */
+static struct apfs_fscache_store *apfs_fscache_store_alloc(struct inode *inode,
+							    unsigned int nr)
+{
+	struct apfs_fscache_store *store;
+
+	store = kmalloc(struct_size(store, pages, nr), GFP_NOFS);
+	if (!store)
+		return NULL;
+	INIT_WORK(&store->work, apfs_fscache_store_work);
+	ihold(inode);
+	store->inode = inode;
+	store->nr = 0;
+	return store;
+}
+
+/**
+ * apfs_fscache_store - Store pages in the cache once they are read
+ * @store:	pages to store, may be NULL
+ *
+ * Must be called once the reads for the pages have been submitted.
+ */
+void apfs_fscache_store(struct apfs_fscache_store *store)
+{
+	if (!store)
+		return;
+	queue_work(apfs_fscache_wq, &store->work);
+}
+
+/**
+ * apfs_fscache_readpage - Read a page of a file from the cache
+ * @page:	locked page of the file
+ * @store:	on return, the page to store once read, or NULL
+ *
+ * Returns 0 if the cache will fill the page, or a negative error code if the
+ * page has to be read from the device.
+ */
+int apfs_fscache_readpage(struct page *page, struct apfs_fscache_store **store)
+{
+	struct inode *inode = page->mapping->host;
+	struct fscache_cookie *cookie = APFS_I(inode)->i_fscache;
+	int err;
+
+	*store = NULL;
+	if (!cookie)
+		return -ENOBUFS;
+	err = fscache_read_or_alloc_page(cookie, page, apfs_fscache_read_done,
+					 NULL /* context */, GFP_KERNEL);
+	if (err != -ENODATA)
+		return err;
+
+	/* The page has a block in the cache, store it there after the read */
+	*store = apfs_fscache_store_alloc(inode, 1);
+	if (!*store) {
+		fscache_uncache_page(cookie, page);
+		return err;
+	}
+	get_page(page);
+	(*store)->pages[(*store)->nr++] = page;
+	return err;
+}
+
+/**
+ * apfs_fscache_readpages - Read a readahead window of a file from the cache
+ * @mapping:	address space of the file
+ * @pages:	pages of the window; the ones filled by the cache are removed
+ * @nr_pages:	number of pages in the window, will be updated
+ * @store:	on return, the pages to store once read, or NULL
+ *
+ * Returns 0 if the cache will fill all the pages, or a negative error code if
+ * some have to be read from the device.  Pages that are left in @pages with a
+ * block reserved in the cache must not be dropped before @store is queued.
+ */
+int apfs_fscache_readpages(struct address_space *mapping,
+			   struct list_head *pages, unsigned int *nr_pages,
+			   struct apfs_fscache_store **store)
+{
+	struct inode *inode = mapping->host;
+	struct fscache_cookie *cookie = APFS_I(inode)->i_fscache;
+	struct page *page;
+	unsigned int nr = 0;
+	int err;
+
+	*store = NULL;
+	if (!cookie)
+		return -ENOBUFS;
+	err = fscache_read_or_alloc_pages(cookie, mapping, pages, nr_pages,
+					  apfs_fscache_read_done,
+					  NULL /* context */,
+					  mapping_gfp_mask(mapping));
+	if (!*nr_pages)
+		return 0;
+
+	/* Even with -ENOBUFS, some of the pages may have a block reserved */
+	list_for_each_entry(page, pages, lru) {
+		if (PageFsCache(page))
+			nr++;
+	}
+	if (!nr)
+		return err;
+	*store = apfs_fscache_store_alloc(inode, nr);
+	if (!*store) {
+		fscache_readpages_cancel(cookie, pages);
+		return err;
+	}
+	list_for_each_entry(page, pages, lru) {
+		if (!PageFsCache(page))
+			continue;
+		get_page(page);
+		(*store)->pages[(*store)->nr++] = page;
+	}
+	return err;
+}
+
+int apfs_fscache_releasepage(struct page *page, gfp_t gfp)
+{
+	struct fscache_cookie *cookie = APFS_I(page->mapping->host)->i_fscache;
+
+	if (!PageFsCache(page))
+		return 1;
+	return fscache_maybe_release_page(cookie, page, gfp);
+}
+
+void apfs_fscache_invalidatepage(struct page *page, unsigned int off,
+				 unsigned int len)
+{
+	struct fscache_cookie *cookie = APFS_I(page->mapping->host)->i_fscache;
+
+	if (off || len != PAGE_SIZE || !PageFsCache(page))
+		return;
+	fscache_wait_on_page_write(cookie, page);
+	fscache_uncache_page(cookie, page);
+}
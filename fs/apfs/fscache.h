@@ -0,0 +1,69 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/fscache.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_FSCACHE_H
+#define _APFS_FSCACHE_H
+
+#include <linux/errno.h>
+#include <linux/types.h>
+
+struct address_space;
+struct apfs_fscache_store;
+struct inode;
+struct list_head;
+struct page;
+struct super_block;
+
+#ifdef CONFIG_APFS_FSCACHE
+extern int apfs_fscache_register(void);
+extern void apfs_fscache_unregister(void);
+extern int apfs_fscache_get_super(struct super_block *sb);
+extern void apfs_fscache_put_super(struct super_block *sb);
+extern void apfs_fscache_get_inode(struct inode *inode);
+extern void apfs_fscache_put_inode(struct inode *inode);
+extern int apfs_fscache_readpage(struct page *page,
+				 struct apfs_fscache_store **store);
+extern int apfs_fscache_readpages(struct address_space *mapping,
+				  struct list_head *pages,
+				  unsigned int *nr_pages,
+				  struct apfs_fscache_store **store);
+extern void apfs_fscache_store(struct apfs_fscache_store *store);
+extern int apfs_fscache_releasepage(struct page *page, gfp_t gfp);
+extern void apfs_fscache_invalidatepage(struct page *page, unsigned int off,
+					unsigned int len);
+#else
+static inline int apfs_fscache_register(void) { return 0; }
+static inline void apfs_fscache_unregister(void) {}
+static inline int apfs_fscache_get_super(struct super_block *sb) { return 0; }
+static inline void apfs_fscache_put_super(struct super_block *sb) {}
+static inline void apfs_fscache_get_inode(struct inode *inode) {}
+static inline void apfs_fscache_put_inode(struct inode *inode) {}
+static inline int apfs_fscache_readpage(struct page *page,
+					struct apfs_fscache_store **store)
+{
+	*store = NULL;
+	return -ENOBUFS;
+}
+static inline int apfs_fscache_readpages(struct address_space *mapping,
+					 struct list_head *pages,
+					 unsigned int *nr_pages,
+					 struct apfs_fscache_store **store)
+{
+	*store = NULL;
+	return -ENOBUFS;
+}
+static inline void apfs_fscache_store(struct apfs_fscache_store *store) {}
+static inline int apfs_fscache_releasepage(struct page *page, gfp_t gfp)
+{
+	return 1;
+}
+static inline void apfs_fscache_invalidatepage(struct page *page,
+					       unsigned int off,
+					       unsigned int len) {}
+#endif
+
+#endif	/* _APFS_FSCACHE_H */
@@ -0,0 +1,210 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/fusion.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#include <linux/fs.h>
+#include <linux/kernel.h>
+#include "apfs.h"
+#include "btree.h"
+#include "fusion.h"
+#include "message.h"
+#include "node.h"
+#include "super.h"
+
+/**
+ * apfs_fusion_read_key - Read the slow device address of a middle tree record
+ * @query:	query on a middle tree node, with @query->index set
+ * @paddr:	on return, the address in the key
+ *
+ * Returns 0 on success, or a negative error code in case of corruption.
+ */
+static int apfs_fusion_read_key(struct apfs_query *query, u64 *paddr)
+{
+	struct apfs_fusion_mt_key *key;
+	int err;
+
+	err = apfs_node_read_record(query, NULL /* key */);
+	if (err)
+		return err;
+	if (query->key_len != sizeof(*key))
+		return -EFSCORRUPTED;
+	key = (struct apfs_fusion_mt_key *)(query->node->object.data +
+					    query->key_off);
+	*paddr = le64_to_cpu(key->fmk_paddr);
+	return 0;
+}
+
+/**
+ * apfs_fusion_node_find - Find the last middle tree record not above a block
+ * @query:	query on a middle tree node
+ * @bno:	block number on the slow device
+ * @next:	lowered to the address of the following record, if any
+ *
+ * Returns 0 and sets @query->index on success, -ENODATA if every record in
+ * the node is above @bno, or another negative error code in case of failure.
+ */
+static int apfs_fusion_node_find(struct apfs_query *query, u64 bno, u64 *next)
+{
+	int left = 0, right = query->node->records - 1;
+	u64 paddr;
+	int err;
+
+	query->index = 0;
+	err = apfs_fusion_read_key(query, &paddr);
+	if (err)
+		return err;
+	if (paddr > bno) {
+		*next = min(*next, paddr);
+		return -ENODATA;
+	}
+
+	while (left < right) {
+		query->index = DIV_ROUND_UP(left + right, 2);
+		err = apfs_fusion_read_key(query, &paddr);
+		if (err)
+			return err;
+		if (paddr > bno) {
+			*next = min(*next, paddr);
+			right = query->index - 1;
+		} else {
+			left = query->index;
+		}
+	}
+	query->index = left;
+	return apfs_fusion_read_key(query, &paddr);
+}
+
+/**
+ * apfs_fusion_mt_lookup - Look for a block in the write-back cache
+ * @sb:		filesystem superblock
+ * @bno:	block number on the slow device, with the tier 2 bit set
+ * @lba:	on a hit, block number of the cached copy on the fast device
+ * @count:	on a hit, blocks cached from @bno on; on a miss, blocks before
+ *		the next cached range, or U64_MAX if none is known
+ *
+ * Returns 0 on a hit, -ENODATA on a miss, or another negative error code in
+ * case of failure.
+ */
+static int apfs_fusion_mt_lookup(struct super_block *sb, u64 bno, u64 *lba,
+				 u64 *count)
+{
+	struct apfs_nxsb_info *nxi = APFS_SB(sb)->s_nxi;
+	struct apfs_fusion_mt_val *val;
+	struct apfs_query query;
+	struct apfs_node *node;
+	u64 next = U64_MAX;
+	u64 paddr, blocks;
+	int depth, err;
+
+	node = apfs_read_node(sb, nxi->nx_fusion_mt);
+	if (IS_ERR(node))
+		return PTR_ERR(node);
+
+	/* The middle tree is physical, so the children need no omap */
+	for (depth = 0; depth < APFS_BTREE_MAX_DEPTH; ++depth) {
+		struct apfs_node *child;
+		u64 child_id, child_blk;
+
+		apfs_init_query(&query, node);
+		query.flags = APFS_QUERY_FUSION;
+		apfs_node_put(node);
+
+		err = apfs_fusion_node_find(&query, bno, &next);
+		if (err)
+			goto out;
+		if (apfs_node_is_leaf(query.node))
+			break;
+
+		err = apfs_query_child_block(sb, &query, &child_id, &child_blk);
+		if (err)
+			goto out;
+		/* Reading the tree must never need the tree itself */
+		if (child_blk & apfs_fusion_tier2(sb)) {
+			err = -EFSCORRUPTED;
+			goto out;
+		}
+		child = apfs_read_node(sb, child_blk);
+		if (IS_ERR(child)) {
+			err = PTR_ERR(child);
+			goto out;
+		}
+		apfs_free_query(sb, &query);
+		node = child;
+	}
+	if (depth == APFS_BTREE_MAX_DEPTH) {
+		apfs_alert(sb, "fusion middle tree is too deep");
+		apfs_node_put(node);
+		return -EFSCORRUPTED;
+	}
+
+	err = apfs_fusion_read_key(&query, &paddr);
+	if (err)
+		goto out;
+	if (query.len != sizeof(*val)) {
+		err = -EFSCORRUPTED;
+		goto out;
+	}
+	val = (struct apfs_fusion_mt_val *)(query.node->object.data +
+					    query.off);
+	blocks = DIV_ROUND_UP(le32_to_cpu(val->fmv_length), sb->s_blocksize);
+	if (bno >= paddr + blocks) {
+		err = -ENODATA;
+		goto out;
+	}
+	*lba = le64_to_cpu(val->fmv_lba) + bno - paddr;
+	*count = paddr + blocks - bno;
+
+out:
+	if (err == -ENODATA)
+		*count = next == U64_MAX ? U64_MAX : next - bno;
+	apfs_free_query(sb, &query);
+	return err;
+}
+
+/**
+ * apfs_fusion_map - Find the device that holds a block of the container
+ * @sb:		filesystem superblock
+ * @bno:	block number, as found in the filesystem structures
+ * @bdev:	on return, the block device to read the block from
+ * @dev_bno:	on return, the block number within @bdev
+ * @count:	on return, number of blocks for which the mapping holds, or
+ *		U64_MAX if there is no limit
+ *
+ * Blocks flagged for the slow device are served from the write-back cache of
+ * the fast device whenever the middle tree has them.  Returns 0 on success,
+ * or a negative error code in case of failure.
+ */
+int apfs_fusion_map(struct super_block *sb, u64 bno,
+		    struct block_device **bdev, u64 *dev_bno, u64 *count)
+{
+	struct apfs_nxsb_info *nxi = APFS_SB(sb)->s_nxi;
+	u64 tier2 = apfs_fusion_tier2(sb);
+	u64 lba;
+	int err;
+
+	if (!nxi->nx_tier2_bdev || !(bno & tier2)) {
+		*bdev = sb->s_bdev;
+		*dev_bno = bno;
+		*count = nxi->nx_tier2_bdev ? tier2 - bno : U64_MAX;
+		return 0;
+	}
+
+	if (nxi->nx_fusion_mt) {
+		err = apfs_fusion_mt_lookup(sb, bno, &lba, count);
+		if (!err) {
+			*bdev = sb->s_bdev;
+			*dev_bno = lba;
+			return 0;
+		}
+		if (err != -ENODATA)
+			return err;
+	} else {
+		*count = U64_MAX;
+	}
+	*bdev = nxi->nx_tier2_bdev;
+	*dev_bno = bno & ~tier2;
+	return 0;
+}
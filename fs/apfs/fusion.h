@@ -0,0 +1,54 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/fusion.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_FUSION_H
+#define _APFS_FUSION_H
+
+#include <linux/types.h>
+
+struct block_device;
+struct super_block;
+
+/* Bit set in the byte addresses of the slow device of a Fusion container */
+#define APFS_FUSION_TIER2_DEVICE_BYTE_ADDR	0x4000000000000000ULL
+
+/* Flags for the entries of the Fusion middle tree */
+#define APFS_FUSION_MT_DIRTY		0x00000001
+#define APFS_FUSION_MT_TENANT		0x00000002
+
+/*
+ * Structure of the key of a Fusion middle tree record, the address of a
+ * range of blocks in the slow device
+ */
+struct apfs_fusion_mt_key {
+	__le64 fmk_paddr;
+} __packed;
+
+/*
+ * Structure of the value of a Fusion middle tree record, the location of the
+ * range in the write-back cache of the fast device
+ */
+struct apfs_fusion_mt_val {
+	__le64 fmv_lba;
+	__le32 fmv_length;
+	__le32 fmv_flags;
+} __packed;
+
+/**
+ * apfs_fusion_tier2 - Get the block number bit that flags the slow device
+ * @sb: filesystem superblock
+ */
+static inline u64 apfs_fusion_tier2(struct super_block *sb)
+{
+	return APFS_FUSION_TIER2_DEVICE_BYTE_ADDR >> sb->s_blocksize_bits;
+}
+
+extern int apfs_fusion_map(struct super_block *sb, u64 bno,
+			   struct block_device **bdev, u64 *dev_bno,
+			   u64 *count);
+
+#endif	/* _APFS_FUSION_H */
@@ -6,42 +6,308 @@
  */
 
 #include <linux/slab.h>
+#include <linux/backing-dev.h>
+#include <linux/blkdev.h>
 #include <linux/buffer_head.h>
-#include <linux/mpage.h>
+#include <linux/iomap.h>
 #include <asm/div64.h>
+#include <asm/unaligned.h>
 #include "apfs.h"
 #include "btree.h"
+#include "clone.h"
+#include "crypto.h"
 #include "dir.h"
 #include "extents.h"
+#include "fscache.h"
 #include "inode.h"
 #include "key.h"
 #include "message.h"
 #include "node.h"
+#include "stats.h"
 #include "super.h"
+#include "trace.h"
+#include "vgroup.h"
 #include "xattr.h"
 
 static int apfs_readpage(struct file *file, struct page *page)
 {
-	return mpage_readpage(page, apfs_get_block);
+	struct super_block *sb = page->mapping->host->i_sb;
+	struct apfs_fscache_store *store;
+	int err;
+
+	apfs_stat_inc(sb, APFS_STAT_DATA_READS);
+	apfs_stat_add(sb, APFS_STAT_DATA_BYTES, PAGE_SIZE);
+	if (APFS_SB(sb)->s_tfm)
+		return apfs_crypt_readpage(page);
+	if (!apfs_fscache_readpage(page, &store))
+		return 0;
+	if (apfs_clone_readpage(page))
+		err = 0;
+	else
+		err = iomap_readpage(page, &apfs_iomap_ops);
+	apfs_fscache_store(store);
+	return err;
+}
+
+/**
+ * apfs_readahead_adjust - Fit a readahead window to the extents of a file
+ * @file:	the file being read, may be NULL
+ * @mapping:	address space of the file
+ * @pages:	pages of the window, in descending order of index
+ * @nr_pages:	number of pages in the window, will be updated
+ *
+ * The window is trimmed at the end of the extent or hole where it starts, so
+ * that the next one begins right at the boundary and the i/o stays physically
+ * contiguous; this is not done for small remainders, or fragmented files
+ * would get tiny windows.  The readahead limit of the file is then grown to
+ * cover the rest of the extent, which only matters for sequential streams
+ * because the generic code never ramps up random reads.  The limit is kept a
+ * multiple of the largest request the device takes, so that the block layer
+ * doesn't have to leave a short request at the end of each window.
+ */
+static void apfs_readahead_adjust(struct file *file,
+				  struct address_space *mapping,
+				  struct list_head *pages,
+				  unsigned int *nr_pages)
+{
+	struct inode *inode = mapping->host;
+	struct request_queue *q = bdev_get_queue(inode->i_sb->s_bdev);
+	struct page *page, *tmp;
+	unsigned long base, want, io, limit;
+	loff_t start, end;
+
+	page = list_last_entry(pages, struct page, lru);
+	start = page_offset(page);
+	if (start >= i_size_read(inode) || apfs_extent_end(inode, start, &end))
+		return;
+
+	if (end - start >= APFS_RA_MIN_TRIM_PAGES << PAGE_SHIFT) {
+		list_for_each_entry_safe(page, tmp, pages, lru) {
+			if (page_offset(page) < end)
+				break;
+			list_del(&page->lru);
+			put_page(page);
+			--*nr_pages;
+		}
+	}
+
+	if (!file || (file->f_mode & FMODE_RANDOM))
+		return;
+	base = inode_to_bdi(inode)->ra_pages;
+	io = max_t(unsigned long, queue_max_sectors(q) >> (PAGE_SHIFT - 9), 1);
+	limit = max(rounddown(APFS_RA_MAX_PAGES, io), io);
+	want = roundup(DIV_ROUND_UP(end - start, PAGE_SIZE), io);
+	file->f_ra.ra_pages = clamp_t(unsigned long, want, base,
+				      max(base, limit));
 }
 
 static int apfs_readpages(struct file *file, struct address_space *mapping,
 			  struct list_head *pages, unsigned int nr_pages)
 {
-	return mpage_readpages(mapping, pages, nr_pages, apfs_get_block);
+	struct super_block *sb = mapping->host->i_sb;
+	struct apfs_fscache_store *store;
+	int err;
+
+	apfs_readahead_adjust(file, mapping, pages, &nr_pages);
+	apfs_stat_inc(sb, APFS_STAT_DATA_READS);
+	apfs_stat_add(sb, APFS_STAT_DATA_BYTES, (u64)nr_pages << PAGE_SHIFT);
+	if (APFS_SB(sb)->s_tfm) {
+		apfs_crypt_readpages(mapping, pages, nr_pages);
+		return 0;
+	}
+	if (!apfs_fscache_readpages(mapping, pages, &nr_pages, &store))
+		return 0;
+	apfs_clone_readpages(mapping, pages, &nr_pages);
+	err = 0;
+	if (nr_pages)
+		err = iomap_readpages(mapping, pages, nr_pages,
+				      &apfs_iomap_ops);
+	apfs_fscache_store(store);
+	return err;
+}
+
+static int apfs_releasepage(struct page *page, gfp_t gfp)
+{
+	if (!apfs_fscache_releasepage(page, gfp))
+		return 0;
+	return iomap_releasepage(page, gfp);
+}
+
+static void apfs_invalidatepage(struct page *page, unsigned int offset,
+				unsigned int len)
+{
+	apfs_fscache_invalidatepage(page, offset, len);
+	iomap_invalidatepage(page, offset, len);
 }
 
 static sector_t apfs_bmap(struct address_space *mapping, sector_t block)
 {
-	return generic_block_bmap(mapping, block, apfs_get_block);
+	return iomap_bmap(mapping, block, &apfs_iomap_ops);
 }
 
 static const struct address_space_operations apfs_aops = {
 	.readpage	= apfs_readpage,
 	.readpages	= apfs_readpages,
 	.bmap		= apfs_bmap,
+	.direct_IO	= noop_direct_IO,
+	.releasepage	= apfs_releasepage,
+	.invalidatepage	= apfs_invalidatepage,
+	.is_partially_uptodate = iomap_is_partially_uptodate,
+	.migratepage	= iomap_migrate_page,
 };
 
+/**
+ * apfs_inode_xfield - Find an extended field of an inode record
+ * @query:	the query that found the inode record, of at least the size of
+ *		struct apfs_inode_val
+ * @type:	type of the field, one of the APFS_INO_EXT_TYPE_* values
+ * @len:	on return, length of the field, without the padding
+ *
+ * Returns a pointer to the on-disk field, NULL if the inode has none, or
+ * -EFSCORRUPTED if the extended fields don't fit the record.
+ */
+void *apfs_inode_xfield(struct apfs_query *query, u8 type, int *len)
+{
+	struct apfs_inode_val *inode_val;
+	struct apfs_xf_blob *xblob;
+	struct apfs_x_field *xfield;
+	char *raw = query->node->object.data;
+	int rest, i;
+
+	inode_val = (struct apfs_inode_val *)(raw + query->off);
+	xblob = (struct apfs_xf_blob *) inode_val->xfields;
+	xfield = (struct apfs_x_field *) xblob->xf_data;
+	rest = query->len - (sizeof(*inode_val) + sizeof(*xblob));
+	rest -= le16_to_cpu(xblob->xf_num_exts) * sizeof(xfield[0]);
+	if (rest < 0)
+		return ERR_PTR(-EFSCORRUPTED);
+	for (i = 0; i < le16_to_cpu(xblob->xf_num_exts); ++i) {
+		int attrlen;
+
+		/* Attribute length is padded to a multiple of 8 */
+		attrlen = round_up(le16_to_cpu(xfield[i].x_size), 8);
+		if (attrlen > rest)
+			break;
+		if (xfield[i].x_type == type) {
+			*len = le16_to_cpu(xfield[i].x_size);
+			return (char *)inode_val + query->len - rest;
+		}
+		rest -= attrlen;
+	}
+	return NULL;
+}
+
+/**
+ * apfs_inode_dstream - Find the data stream field of an inode record
+ * @query:	the query that found the inode record, of at least the size of
+ *		struct apfs_inode_val
+ *
+ * Returns a pointer to the on-disk data stream information, NULL if the inode
+ * has none, or -EFSCORRUPTED if the extended fields don't fit the record.
+ */
+struct apfs_dstream *apfs_inode_dstream(struct apfs_query *query)
+{
+	struct apfs_dstream *dstream;
+	int len;
+
+	dstream = apfs_inode_xfield(query, APFS_INO_EXT_TYPE_DSTREAM, &len);
+	if (IS_ERR_OR_NULL(dstream))
+		return dstream;
+	if (len < sizeof(*dstream))
+		return ERR_PTR(-EFSCORRUPTED);
+	return dstream;
+}
+
+/**
+ * apfs_inode_read_xfields - Decode all the extended fields of an inode record
+ * @query:	the query that found the inode record, of at least the size of
+ *		struct apfs_inode_val
+ * @inode:	vfs inode to be filled with the fields
+ *
+ * The fields are all walked just once, and the ones that matter for a mount
+ * are kept in @inode, so that nothing needs to search for the record again.
+ * Returns 0 on success, or -EFSCORRUPTED if any of them is malformed.
+ */
+static int apfs_inode_read_xfields(struct apfs_query *query,
+				   struct inode *inode)
+{
+	struct apfs_inode_info *ai = APFS_I(inode);
+	struct apfs_inode_val *inode_val;
+	struct apfs_xf_blob *xblob;
+	struct apfs_x_field *xfield;
+	char *raw = query->node->object.data;
+	char *data;
+	int rest, i;
+
+	inode->i_size = inode->i_blocks = 0;
+	ai->i_dir_stats_id = 0;
+	ai->i_name = NULL;
+	ai->i_sparse_bytes = 0;
+	ai->i_document_id = 0;
+	ai->i_rdev = 0;
+
+	inode_val = (struct apfs_inode_val *)(raw + query->off);
+	xblob = (struct apfs_xf_blob *) inode_val->xfields;
+	xfield = (struct apfs_x_field *) xblob->xf_data;
+	rest = query->len - (sizeof(*inode_val) + sizeof(*xblob));
+	rest -= le16_to_cpu(xblob->xf_num_exts) * sizeof(xfield[0]);
+	if (rest < 0)
+		return -EFSCORRUPTED;
+	data = (char *)inode_val + query->len - rest;
+
+	for (i = 0; i < le16_to_cpu(xblob->xf_num_exts); ++i) {
+		int len = le16_to_cpu(xfield[i].x_size);
+		/* Attribute length is padded to a multiple of 8 */
+		int attrlen = round_up(len, 8);
+
+		if (attrlen > rest)
+			break;
+
+		switch (xfield[i].x_type) {
+		case APFS_INO_EXT_TYPE_DSTREAM: {
+			struct apfs_dstream *dstream = (void *)data;
+
+			if (len < sizeof(*dstream))
+				return -EFSCORRUPTED;
+			inode->i_size = le64_to_cpu(dstream->size);
+			inode->i_blocks =
+				le64_to_cpu(dstream->alloced_size) >> 9;
+			break;
+		}
+		case APFS_INO_EXT_TYPE_DIR_STATS_KEY:
+			if (len != sizeof(__le64))
+				return -EFSCORRUPTED;
+			ai->i_dir_stats_id = get_unaligned_le64(data);
+			break;
+		case APFS_INO_EXT_TYPE_NAME:
+			if (!len || data[len - 1] != 0)
+				return -EFSCORRUPTED;
+			/* This is just a hint, so no need to fail on ENOMEM */
+			if (!ai->i_name)
+				ai->i_name = kmemdup(data, len, GFP_KERNEL);
+			break;
+		case APFS_INO_EXT_TYPE_SPARSE_BYTES:
+			if (len != sizeof(__le64))
+				return -EFSCORRUPTED;
+			ai->i_sparse_bytes = get_unaligned_le64(data);
+			break;
+		case APFS_INO_EXT_TYPE_DOCUMENT_ID:
+			if (len != sizeof(__le32))
+				return -EFSCORRUPTED;
+			ai->i_document_id = get_unaligned_le32(data);
+			break;
+		case APFS_INO_EXT_TYPE_RDEV:
+			if (len != sizeof(__le32))
+				return -EFSCORRUPTED;
+			ai->i_rdev = get_unaligned_le32(data);
+			break;
+		}
+		data += attrlen;
+		rest -= attrlen;
+	}
+	return 0;
+}
+
 /**
  * apfs_inode_from_query - Read the inode found by a successful query
  * @query:	the query that found the record
@@ -55,19 +321,22 @@ static int apfs_inode_from_query(struct apfs_query *query, struct inode *inode)
 {
 	struct apfs_inode_info *ai = APFS_I(inode);
 	struct apfs_inode_val *inode_val;
-	struct apfs_dstream *dstream = NULL;
-	struct apfs_xf_blob *xblob;
-	struct apfs_x_field *xfield;
-	char *raw = query->node->object.bh->b_data;
-	int rest, i;
+	char *raw = query->node->object.data;
 	u64 secs;
+	int err;
 
 	if (query->len < sizeof(*inode_val))
 		return -EFSCORRUPTED;
 
 	inode_val = (struct apfs_inode_val *)(raw + query->off);
 
+	ai->i_parent_id = le64_to_cpu(inode_val->parent_id);
 	ai->i_extent_id = le64_to_cpu(inode_val->private_id);
+	ai->i_bsd_flags = le32_to_cpu(inode_val->bsd_flags);
+	ai->i_cloned = le64_to_cpu(inode_val->internal_flags) &
+		       (APFS_INODE_WAS_CLONED | APFS_INODE_WAS_EVER_CLONED);
+	ai->i_no_xattrs = false;
+	ai->i_firmlink = APFS_FIRMLINK_UNKNOWN;
 	inode->i_mode = le16_to_cpu(inode_val->mode);
 	i_uid_write(inode, (uid_t)le32_to_cpu(inode_val->owner));
 	i_gid_write(inode, (gid_t)le32_to_cpu(inode_val->group));
@@ -76,12 +345,12 @@ static int apfs_inode_from_query(struct apfs_query *query, struct inode *inode)
 		/*
 		 * It seems that hard links are only allowed for regular files,
 		 * and perhaps for symlinks.
-		 *
-		 * Directory inodes don't store their link count, so to provide
-		 * it we would have to actually count the subdirectories. The
-		 * HFS/HFS+ modules just leave it at 1, and so do we, for now.
 		 */
 		set_nlink(inode, le32_to_cpu(inode_val->nlink));
+	} else if (S_ISDIR(inode->i_mode)) {
+		ai->i_nchildren = le32_to_cpu(inode_val->nchildren);
+		atomic_set(&ai->i_dir_lookups, 0);
+		atomic_set(&ai->i_dir_misses, 0);
 	}
 
 	/* APFS stores the time as unsigned nanoseconds since the epoch */
@@ -98,43 +367,87 @@ static int apfs_inode_from_query(struct apfs_query *query, struct inode *inode)
 	ai->i_crtime.tv_nsec = do_div(secs, NSEC_PER_SEC);
 	ai->i_crtime.tv_sec = secs;
 
-	xblob = (struct apfs_xf_blob *) inode_val->xfields;
-	xfield = (struct apfs_x_field *) xblob->xf_data;
-	rest = query->len - (sizeof(*inode_val) + sizeof(*xblob));
-	rest -= le16_to_cpu(xblob->xf_num_exts) * sizeof(xfield[0]);
-	if (rest < 0)
-		return -EFSCORRUPTED;
-	for (i = 0; i < le16_to_cpu(xblob->xf_num_exts); ++i) {
-		int attrlen;
+	/*
+	 * An inode without a data stream is "empty", but it may actually hold
+	 * compressed data in the named attribute com.apple.decmpfs, and
+	 * sometimes in com.apple.ResourceFork; apfs_iget() takes care of that.
+	 */
+	err = apfs_inode_read_xfields(query, inode);
+	if (err)
+		return err;
 
-		/* Attribute length is padded to a multiple of 8 */
-		attrlen = round_up(le16_to_cpu(xfield[i].x_size), 8);
-		if (attrlen > rest)
-			break;
-		if (xfield[i].x_type == APFS_INO_EXT_TYPE_DSTREAM) {
-			/* The only optional attr we care about, for now */
-			dstream = (struct apfs_dstream *)
-					((char *)inode_val + query->len - rest);
-			break;
-		}
-		rest -= attrlen;
-	}
-
-	if (dstream) {
-		inode->i_size = le64_to_cpu(dstream->size);
-		inode->i_blocks = le64_to_cpu(dstream->alloced_size) >> 9;
-	} else {
+	if (S_ISDIR(inode->i_mode)) {
 		/*
-		 * This inode is "empty", but it may actually hold compressed
-		 * data in the named attribute com.apple.decmpfs, and sometimes
-		 * in com.apple.ResourceFork
+		 * Directory inodes don't store their link count, only their
+		 * number of children.  Count the children as links, plus "."
+		 * and "..", like macOS does: walkers that trust the link count
+		 * to skip leaf directories then never miss a subdirectory, and
+		 * they can tell the empty ones apart.  The size is the number
+		 * of entries, like in the HFS+ module.
 		 */
-		inode->i_size = inode->i_blocks = 0;
+		set_nlink(inode, min_t(u64, ai->i_nchildren + 2ULL, UINT_MAX));
+		inode->i_size = ai->i_nchildren + 2ULL;
 	}
 
 	return 0;
 }
 
+/**
+ * apfs_inode_scan_leaf - Read the records that follow an inode in its leaf
+ * @query:	the query that found the inode record
+ * @inode:	vfs inode, already filled with the inode record
+ *
+ * All the other records of an inode come right after it in the catalog, so
+ * some of them are likely in the same leaf.  While the node is still at hand,
+ * find out if the inode has any xattrs, and cache its symlink target and its
+ * first extents.  This is only an optimization, so any problems are left for
+ * the actual reads to report.
+ */
+static void apfs_inode_scan_leaf(struct apfs_query *query, struct inode *inode)
+{
+	struct apfs_inode_info *ai = APFS_I(inode);
+	u64 cnid = apfs_ino(inode);
+	bool xattrs = false, past_xattrs = false;
+	int extents = 0;
+
+	while (++query->index < query->node->records) {
+		struct apfs_key key;
+		struct apfs_file_extent ext;
+
+		if (apfs_node_read_record(query, &key))
+			return;
+		if (key.id != cnid || key.type > APFS_TYPE_XATTR)
+			past_xattrs = true;
+		if (key.id != cnid || key.type > APFS_TYPE_FILE_EXTENT)
+			break;
+
+		if (key.type == APFS_TYPE_XATTR) {
+			xattrs = true;
+			if (S_ISLNK(inode->i_mode))
+				apfs_xattr_prime_link(inode, query);
+			else if (S_ISDIR(inode->i_mode))
+				apfs_xattr_prime_firmlink(inode, query);
+		} else if (key.type == APFS_TYPE_FILE_EXTENT) {
+			/*
+			 * Clones keep their extents under a different id.  The
+			 * extents of a file that may be read through the
+			 * device need to be checked for sharing first.
+			 */
+			if (!S_ISREG(inode->i_mode) || ai->i_extent_id != cnid ||
+			    apfs_clone_wanted(inode))
+				break;
+			if (extents++ == APFS_INODE_SCAN_EXTENTS)
+				break;
+			if (apfs_extent_from_query(query, &ext))
+				return;
+			apfs_extent_map_insert(inode, &ext);
+		}
+	}
+	ai->i_no_xattrs = past_xattrs && !xattrs;
+	if (past_xattrs && ai->i_firmlink == APFS_FIRMLINK_UNKNOWN)
+		ai->i_firmlink = APFS_FIRMLINK_NONE;
+}
+
 /**
  * apfs_inode_lookup - Lookup an inode record in the b-tree and read its data
  * @inode:	vfs inode to lookup and fill
@@ -147,28 +460,28 @@ static int apfs_inode_lookup(struct inode *inode)
 	struct super_block *sb = inode->i_sb;
 	struct apfs_sb_info *sbi = APFS_SB(sb);
 	struct apfs_key key;
-	struct apfs_query *query;
+	struct apfs_query query;
 	u64 cnid = inode->i_ino;
 	int ret;
 
 	apfs_init_inode_key(cnid, &key);
 
-	query = apfs_alloc_query(sbi->s_cat_root, NULL /* parent */);
-	if (!query)
-		return -ENOMEM;
-	query->key = &key;
-	query->flags |= APFS_QUERY_CAT | APFS_QUERY_EXACT;
+	apfs_init_query(&query, sbi->s_cat_root);
+	query.key = &key;
+	query.flags |= APFS_QUERY_CAT | APFS_QUERY_EXACT;
 
 	ret = apfs_btree_query(sb, &query);
 	if (ret)
 		goto done;
 
-	ret = apfs_inode_from_query(query, inode);
+	ret = apfs_inode_from_query(&query, inode);
 	if (ret)
 		apfs_alert(sb, "bad inode record for inode 0x%llx", cnid);
+	else
+		apfs_inode_scan_leaf(&query, inode);
 
 done:
-	apfs_free_query(sb, query);
+	apfs_free_query(sb, &query);
 	return ret;
 }
 
@@ -219,31 +532,38 @@ static struct inode *apfs_iget_locked(struct super_block *sb, u64 cnid)
 #endif /* BITS_PER_LONG == 64 */
 
 /**
- * apfs_iget - Populate inode structures with metadata from disk
- * @sb:		filesystem superblock
- * @cnid:	inode number
+ * apfs_iget_compressed - Set up the operations for a compressed file
+ * @inode:	the file
  *
- * Populates the vfs inode and the corresponding apfs_inode_info structure.
- * Returns a pointer to the vfs inode in case of success, or an appropriate
- * error pointer otherwise.
+ * Files with an unsupported compression type, or a bad compression header,
+ * are left looking empty just like before; only an allocation failure is
+ * reported as an error.
  */
-struct inode *apfs_iget(struct super_block *sb, u64 cnid)
+static int apfs_iget_compressed(struct inode *inode)
 {
-	struct apfs_sb_info *sbi = APFS_SB(sb);
-	struct inode *inode;
 	int err;
 
-	inode = apfs_iget_locked(sb, cnid);
-	if (!inode)
-		return ERR_PTR(-ENOMEM);
-	if (!(inode->i_state & I_NEW))
-		return inode;
+	err = apfs_compress_init(inode);
+	if (err == -ENOMEM)
+		return err;
+	if (err)
+		return 0;
 
-	err = apfs_inode_lookup(inode);
-	if (err) {
-		iget_failed(inode);
-		return ERR_PTR(err);
-	}
+	inode->i_fop = &apfs_compress_file_operations;
+	inode->i_mapping->a_ops = &apfs_compress_aops;
+	return 0;
+}
+
+/**
+ * apfs_iget_setup - Set up a new inode after its record was read
+ * @inode:	the inode, still locked
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_iget_setup(struct inode *inode)
+{
+	struct apfs_sb_info *sbi = APFS_SB(inode->i_sb);
+	int err;
 
 	/* Allow the user to override the ownership */
 	if (sbi->s_flags & APFS_UID_OVERRIDE)
@@ -256,30 +576,199 @@ struct inode *apfs_iget(struct super_block *sb, u64 cnid)
 		inode->i_op = &apfs_file_inode_operations;
 		inode->i_fop = &apfs_file_operations;
 		inode->i_mapping->a_ops = &apfs_aops;
+		if (apfs_inode_is_compressed(inode)) {
+			err = apfs_iget_compressed(inode);
+			if (err)
+				return err;
+		} else if (sbi->s_daxdev) {
+			/* The page cache is never used, so fscache has no role */
+			inode->i_flags |= S_DAX;
+		} else {
+			apfs_fscache_get_inode(inode);
+		}
 	} else if (S_ISDIR(inode->i_mode)) {
 		inode->i_op = &apfs_dir_inode_operations;
 		inode->i_fop = &apfs_dir_operations;
+		apfs_firmlink_setup(inode);
 	} else if (S_ISLNK(inode->i_mode)) {
 		inode->i_op = &apfs_symlink_inode_operations;
 	} else {
+		dev_t rdev = apfs_decode_rdev(APFS_I(inode)->i_rdev);
+
 		inode->i_op = &apfs_special_inode_operations;
+		if (S_ISCHR(inode->i_mode) || S_ISBLK(inode->i_mode) ||
+		    S_ISFIFO(inode->i_mode) || S_ISSOCK(inode->i_mode))
+			init_special_inode(inode, inode->i_mode, rdev);
 	}
 
 	/* Inode flags are not important for now, leave them at 0 */
+	return 0;
+}
+
+/**
+ * apfs_iget - Populate inode structures with metadata from disk
+ * @sb:		filesystem superblock
+ * @cnid:	inode number
+ *
+ * Populates the vfs inode and the corresponding apfs_inode_info structure.
+ * Returns a pointer to the vfs inode in case of success, or an appropriate
+ * error pointer otherwise.
+ */
+struct inode *apfs_iget(struct super_block *sb, u64 cnid)
+{
+	struct inode *inode;
+	int err;
+
+	inode = apfs_iget_locked(sb, cnid);
+	if (!inode)
+		return ERR_PTR(-ENOMEM);
+	if (!(inode->i_state & I_NEW))
+		return inode;
+
+	err = apfs_inode_lookup(inode);
+	if (!err)
+		err = apfs_iget_setup(inode);
+	if (err) {
+		iget_failed(inode);
+		return ERR_PTR(err);
+	}
 	unlock_new_inode(inode);
 	return inode;
 }
 
+/*
+ * New inode of a batch for apfs_iget_many(), with the result of its lookup
+ */
+struct apfs_iget_slot {
+	struct inode *inode;
+	int err;
+};
+
+static int apfs_iget_many_actor(struct apfs_query *query, int idx, void *data)
+{
+	struct apfs_iget_slot *slot = (struct apfs_iget_slot *)data + idx;
+	struct inode *inode = slot->inode;
+
+	slot->err = apfs_inode_from_query(query, inode);
+	if (slot->err)
+		apfs_alert(inode->i_sb, "bad inode record for inode 0x%llx",
+			   apfs_ino(inode));
+	else
+		apfs_inode_scan_leaf(query, inode);
+	return 0;
+}
+
+/**
+ * apfs_iget_many - Bring several inodes into the inode cache at once
+ * @sb:		filesystem superblock
+ * @cnids:	inode numbers in increasing order, possibly repeated
+ * @nr:		number of inode numbers
+ *
+ * The records of all the inodes not yet in the cache are found in a single
+ * walk of the catalog.  The new inodes are locked in cnid order, so that two
+ * batches can't wait on each other.  This is only a hint, so any errors are
+ * ignored.
+ */
+void apfs_iget_many(struct super_block *sb, const u64 *cnids, int nr)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_iget_slot *slots;
+	struct apfs_key *keys;
+	int i, count = 0;
+
+	keys = kmalloc_array(nr, sizeof(*keys), GFP_KERNEL);
+	slots = kmalloc_array(nr, sizeof(*slots), GFP_KERNEL);
+	if (!keys || !slots)
+		goto out;
+
+	for (i = 0; i < nr; i++) {
+		struct inode *inode;
+
+		if (i && cnids[i] == cnids[i - 1]) /* Hard links */
+			continue;
+		inode = apfs_iget_locked(sb, cnids[i]);
+		if (!inode)
+			continue;
+		if (!(inode->i_state & I_NEW)) {
+			iput(inode);
+			continue;
+		}
+		apfs_init_inode_key(cnids[i], &keys[count]);
+		slots[count].inode = inode;
+		slots[count].err = -ENODATA;
+		count++;
+	}
+
+	apfs_btree_query_batch(sb, sbi->s_cat_root, keys, count, APFS_QUERY_CAT,
+			       apfs_iget_many_actor, slots);
+
+	for (i = 0; i < count; i++) {
+		struct inode *inode = slots[i].inode;
+		int err = slots[i].err;
+
+		if (!err)
+			err = apfs_iget_setup(inode);
+		if (err) {
+			iget_failed(inode);
+			continue;
+		}
+		unlock_new_inode(inode);
+		iput(inode);
+	}
+out:
+	kfree(slots);
+	kfree(keys);
+}
+
+/**
+ * apfs_new_stream_inode - Create an inode to cache a data stream of a file
+ * @parent:	inode the stream belongs to
+ * @extent_id:	id of the extent records of the stream
+ * @size:	size of the stream
+ *
+ * The new inode is never hashed and has no operations of its own; it only
+ * gives the stream an address space, mapped by the usual extent code.  Returns
+ * the inode, or NULL if it couldn't be allocated.
+ */
+struct inode *apfs_new_stream_inode(struct inode *parent, u64 extent_id,
+				    loff_t size)
+{
+	struct inode *inode;
+	struct apfs_inode_info *ai;
+
+	inode = new_inode(parent->i_sb);
+	if (!inode)
+		return NULL;
+	ai = APFS_I(inode);
+
+	/* Report any problems with the extents against the parent */
+	inode->i_ino = parent->i_ino;
+#if BITS_PER_LONG == 32
+	ai->i_ino = apfs_ino(parent);
+#endif
+	ai->i_parent_id = apfs_ino(parent);
+	ai->i_extent_id = extent_id;
+	ai->i_bsd_flags = 0;
+	ai->i_cloned = false;
+	ai->i_no_xattrs = true;
+
+	inode->i_mode = S_IFREG;
+	inode->i_mapping->a_ops = &apfs_aops;
+	i_size_write(inode, size);
+	return inode;
+}
+
 int apfs_getattr(const struct path *path, struct kstat *stat,
 		 u32 request_mask, unsigned int query_flags)
 {
 	struct inode *inode = d_inode(path->dentry);
 	struct apfs_inode_info *ai = APFS_I(inode);
 
+	trace_apfs_getattr(inode);
 	stat->result_mask |= STATX_BTIME;
 	stat->btime = ai->i_crtime;
 
-	if (apfs_xattr_get(inode, APFS_XATTR_NAME_COMPRESSED, NULL, 0) >= 0)
+	if (apfs_inode_is_compressed(inode))
 		stat->attributes |= STATX_ATTR_COMPRESSED;
 
 	stat->attributes_mask |= STATX_ATTR_COMPRESSED;
@@ -9,8 +9,15 @@
 #define _APFS_INODE_H
 
 #include <linux/fs.h>
+#include <linux/sizes.h>
 #include <linux/types.h>
+#include "compress.h"
+#include "dirindex.h"
 #include "extents.h"
+#include "sibling.h"
+
+struct apfs_query;
+struct apfs_xattr_names;
 
 /* Inode numbers for special inodes */
 #define APFS_INVALID_INO_NUM		0
@@ -103,14 +110,69 @@ struct apfs_dstream {
 	__le64 total_bytes_read;
 } __packed;
 
+/*
+ * Value of a directory statistics record, kept up to date for the whole tree
+ * under a directory
+ */
+struct apfs_dir_stats_val {
+	__le64 num_children;	/* Files and directories in the tree */
+	__le64 total_size;	/* Logical size of all its files, in bytes */
+	__le64 chained_key;	/* Stats record of the parent directory */
+	__le64 gen_count;	/* Bumped on every update */
+} __packed;
+
+/* Internal flags of an inode */
+#define APFS_INODE_WAS_CLONED		0x00000010
+#define APFS_INODE_WAS_EVER_CLONED	0x00000400
+
+/* BSD flags of an inode */
+#define APFS_INOBSD_COMPRESSED		0x00000020
+
+/* Readahead limits for regular files, in pages */
+#define APFS_RA_MAX_PAGES	(SZ_1M / PAGE_SIZE)	/* Largest window */
+#define APFS_RA_MIN_TRIM_PAGES	(SZ_64K / PAGE_SIZE)	/* Smallest trimmed */
+
+/* Most extents to cache from the leaf of the inode record, on lookup */
+#define APFS_INODE_SCAN_EXTENTS	8
+
 /*
  * APFS inode data in memory
  */
 struct apfs_inode_info {
+	u64			i_parent_id;	 /* ID of the parent directory */
 	u64			i_extent_id;	 /* ID of the extent records */
-	struct apfs_file_extent	i_cached_extent; /* Latest extent record */
-	spinlock_t		i_extent_lock;	 /* Protects i_cached_extent */
+	struct apfs_extent_map __rcu *i_extent_map; /* Cached extents */
+	spinlock_t		i_extent_lock;	 /* Serializes map updates */
+	struct list_head	i_extent_list;	 /* Entry in s_extent_maps */
 	struct timespec64	i_crtime;	 /* Time of creation */
+	u32			i_bsd_flags;	 /* BSD flags of the inode */
+	bool			i_cloned;	 /* May share blocks with clones */
+	char			*i_name;	 /* Name in parent, or NULL */
+	u64			i_sparse_bytes;	 /* Bytes in holes of a file */
+	u32			i_document_id;	 /* Document id, or 0 if none */
+	u32			i_rdev;		 /* Device, in Darwin format */
+	struct apfs_compress_info *i_compress; /* NULL if not compressed */
+	struct inode		*i_xattr_stream; /* Page cache of a xattr */
+	bool			i_no_xattrs;	 /* Known to have no xattrs */
+	struct apfs_xattr_names	*i_xattr_names;	 /* Listxattr result, if built */
+	struct apfs_xattr_cached *i_xattr_cache; /* Small inline values */
+	struct apfs_siblings	*i_siblings;	 /* Hard links, once read */
+#ifdef CONFIG_APFS_FSCACHE
+	struct fscache_cookie	*i_fscache;	 /* Cache object, or NULL */
+#endif
+
+	/* Directories only */
+	u32			i_nchildren;	 /* Number of children */
+	u64			i_dir_stats_id;	 /* Stats record, or 0 if none */
+	atomic_t		i_dir_lookups;	 /* Lookups without index */
+	struct apfs_dir_index __rcu *i_dir_index; /* Name index, if built */
+	struct list_head	i_dir_index_list; /* Entry in s_dir_indexes */
+	atomic_t		i_dir_misses;	 /* Failed lookups without filter */
+	struct apfs_dir_bloom __rcu *i_dir_bloom; /* Bloom filter, if built */
+	struct apfs_dir_listing __rcu *i_dir_listing; /* Records, if built */
+	struct list_head	i_dir_listing_list; /* Entry in s_dir_indexes */
+	unsigned long		i_dir_listing_state; /* Locked while built */
+	u8			i_firmlink;	 /* APFS_FIRMLINK_* state */
 
 #if BITS_PER_LONG == 32
 	/* This is the actual inode number; vfs_inode.i_ino could overflow */
@@ -124,7 +186,48 @@ static inline struct apfs_inode_info *APFS_I(struct inode *inode)
 	return container_of(inode, struct apfs_inode_info, vfs_inode);
 }
 
+/**
+ * apfs_ino - Get the full inode number of an inode
+ * @inode: the vfs inode
+ */
+static inline u64 apfs_ino(struct inode *inode)
+{
+#if BITS_PER_LONG == 32
+	return APFS_I(inode)->i_ino;
+#else
+	return inode->i_ino;
+#endif
+}
+
+/**
+ * apfs_inode_is_compressed - Check if an inode has transparent compression
+ * @inode: the vfs inode
+ *
+ * The bsd flag is set for all the files that have a decmpfs xattr, so there
+ * is never any need to look for it in the catalog.
+ */
+static inline bool apfs_inode_is_compressed(struct inode *inode)
+{
+	return APFS_I(inode)->i_bsd_flags & APFS_INOBSD_COMPRESSED;
+}
+
+/**
+ * apfs_decode_rdev - Convert the device number of an inode record
+ * @rdev:	device number, as found in the APFS_INO_EXT_TYPE_RDEV field
+ *
+ * Darwin uses 8 bits for the major number and 24 for the minor.
+ */
+static inline dev_t apfs_decode_rdev(u32 rdev)
+{
+	return MKDEV(rdev >> 24, rdev & 0xffffff);
+}
+
+extern void *apfs_inode_xfield(struct apfs_query *query, u8 type, int *len);
+extern struct apfs_dstream *apfs_inode_dstream(struct apfs_query *query);
 extern struct inode *apfs_iget(struct super_block *sb, u64 cnid);
+extern void apfs_iget_many(struct super_block *sb, const u64 *cnids, int nr);
+extern struct inode *apfs_new_stream_inode(struct inode *parent, u64 extent_id,
+					   loff_t size);
 extern int apfs_getattr(const struct path *path, struct kstat *stat,
 			u32 request_mask, unsigned int query_flags);
 
@@ -0,0 +1,994 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/ioctl.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#include <linux/capability.h>
+#include <linux/compat.h>
+#include <linux/file.h>
+#include <linux/fs.h>
+#include <linux/mm.h>
+#include <linux/sched/signal.h>
+#include <linux/slab.h>
+#include <linux/sort.h>
+#include <linux/uaccess.h>
+#include "apfs.h"
+#include "archive.h"
+#include "btree.h"
+#include "copyrange.h"
+#include "extents.h"
+#include "inode.h"
+#include "ioctl.h"
+#include "key.h"
+#include "message.h"
+#include "namecache.h"
+#include "node.h"
+#include "physmap.h"
+#include "prefetch.h"
+#include "revmap.h"
+#include "sibling.h"
+#include "snapdiff.h"
+#include "snapshot.h"
+#include "super.h"
+#include "warmup.h"
+#include "xattr.h"
+
+/**
+ * apfs_bulkstat_from_query - Read the attributes of an inode from its record
+ * @sb:		filesystem superblock
+ * @query:	iterator positioned on the inode record
+ * @cnid:	inode number
+ * @bs:		on return, the attributes of the inode
+ *
+ * Returns 0 on success or -EFSCORRUPTED otherwise.
+ */
+static int apfs_bulkstat_from_query(struct super_block *sb,
+				    struct apfs_query *query, u64 cnid,
+				    struct apfs_bulkstat *bs)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_inode_val *inode_val;
+	struct apfs_dstream *dstream;
+	char *raw = query->node->object.data;
+	kuid_t uid;
+	kgid_t gid;
+
+	if (query->len < sizeof(*inode_val))
+		return -EFSCORRUPTED;
+	inode_val = (struct apfs_inode_val *)(raw + query->off);
+	dstream = apfs_inode_dstream(query);
+	if (IS_ERR(dstream))
+		return PTR_ERR(dstream);
+
+	memset(bs, 0, sizeof(*bs));
+	bs->bs_ino = cnid;
+	bs->bs_parent_id = le64_to_cpu(inode_val->parent_id);
+	if (dstream) {
+		bs->bs_size = le64_to_cpu(dstream->size);
+		bs->bs_blocks = le64_to_cpu(dstream->alloced_size) >> 9;
+	}
+	bs->bs_atime = le64_to_cpu(inode_val->access_time);
+	bs->bs_mtime = le64_to_cpu(inode_val->mod_time);
+	bs->bs_ctime = le64_to_cpu(inode_val->change_time);
+	bs->bs_crtime = le64_to_cpu(inode_val->create_time);
+	bs->bs_mode = le16_to_cpu(inode_val->mode);
+	bs->bs_nlink = S_ISDIR(bs->bs_mode) ?
+		       le32_to_cpu(inode_val->nchildren) :
+		       le32_to_cpu(inode_val->nlink);
+	bs->bs_bsd_flags = le32_to_cpu(inode_val->bsd_flags);
+
+	/* Report the same ownership as stat() */
+	uid = make_kuid(&init_user_ns, le32_to_cpu(inode_val->owner));
+	gid = make_kgid(&init_user_ns, le32_to_cpu(inode_val->group));
+	if (sbi->s_flags & APFS_UID_OVERRIDE)
+		uid = sbi->s_uid;
+	if (sbi->s_flags & APFS_GID_OVERRIDE)
+		gid = sbi->s_gid;
+	bs->bs_uid = from_kuid_munged(current_user_ns(), uid);
+	bs->bs_gid = from_kgid_munged(current_user_ns(), gid);
+	return 0;
+}
+
+/**
+ * apfs_ioc_bulkstat - Report the attributes of many inodes, in cnid order
+ * @sb:		filesystem superblock
+ * @argp:	user address of the struct apfs_bulkstat_req
+ *
+ * The inode records are found with a single forward scan of the catalog,
+ * starting at the requested inode number, instead of one search for each;
+ * the request is updated so that the next call resumes where this one
+ * stopped.  A count of zero on return means that no inodes are left.  Returns
+ * 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_ioc_bulkstat(struct super_block *sb, void __user *argp)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_bulkstat_req req;
+	struct apfs_bulkstat __user *ubuf;
+	struct apfs_key key;
+	struct apfs_query query;
+	u32 done = 0;
+	int err;
+
+	if (!capable(CAP_SYS_ADMIN))
+		return -EPERM;
+	if (copy_from_user(&req, argp, sizeof(req)))
+		return -EFAULT;
+	if (req.br_flags)
+		return -EINVAL;
+	ubuf = u64_to_user_ptr(req.br_buffer);
+	req.br_count = min_t(u32, req.br_count, APFS_BULKSTAT_MAX);
+
+	apfs_init_inode_key(req.br_ino, &key);
+	apfs_btree_iter_init(&query, sbi->s_cat_root, &key,
+			     APFS_QUERY_CAT | APFS_QUERY_ANY_ID);
+
+	err = apfs_btree_iter_seek(sb, &query);
+	while (!err && done < req.br_count) {
+		struct apfs_key curr_key;
+		struct apfs_bulkstat bs;
+
+		err = apfs_node_read_record(&query, &curr_key);
+		if (err)
+			break;
+		if (curr_key.type != APFS_TYPE_INODE)
+			goto next;
+
+		err = apfs_bulkstat_from_query(sb, &query, curr_key.id, &bs);
+		if (err) {
+			apfs_alert(sb, "bad inode record for inode 0x%llx",
+				   curr_key.id);
+			break;
+		}
+		if (copy_to_user(&ubuf[done], &bs, sizeof(bs))) {
+			err = -EFAULT;
+			break;
+		}
+		done++;
+		req.br_ino = curr_key.id + 1;
+next:
+		if (fatal_signal_pending(current)) {
+			err = -EINTR;
+			break;
+		}
+		cond_resched();
+		err = apfs_btree_iter_next(sb, &query);
+	}
+	apfs_free_query(sb, &query);
+
+	if (err == -ENODATA) /* Got all the inodes */
+		err = 0;
+	/* Don't lose the entries already copied */
+	if (err && !done)
+		return err;
+	req.br_count = done;
+	if (copy_to_user(argp, &req, sizeof(req)))
+		return -EFAULT;
+	return 0;
+}
+
+/*
+ * Entry of an APFS_IOC_READDIR_PLUS call, sorted by inode number once the
+ * listing is over
+ */
+struct apfs_rdplus_slot {
+	u64 cnid;		/* Inode number of the entry */
+	u32 off;		/* Offset of the record in the buffer */
+};
+
+/*
+ * State of an APFS_IOC_READDIR_PLUS call
+ */
+struct apfs_rdplus_ctx {
+	struct dir_context ctx;
+	struct super_block *sb;
+	char *buf;			/* Records for the user */
+	u32 size;			/* Size of @buf */
+	u32 used;			/* Bytes of @buf already filled */
+	struct apfs_rdplus_slot *slots;	/* One for each record */
+	u32 nr;				/* Number of records */
+	u32 *first;			/* First slot for each inode number */
+	int err;
+};
+
+/* Size of the record for a name of @len bytes */
+#define APFS_RDPLUS_RECLEN(len) \
+	ALIGN(sizeof(struct apfs_dirent_plus) + (len) + 1, sizeof(u64))
+
+static int apfs_rdplus_fill(struct dir_context *ctx, const char *name,
+			    int namelen, loff_t offset, u64 ino,
+			    unsigned int d_type)
+{
+	struct apfs_rdplus_ctx *rp = container_of(ctx, struct apfs_rdplus_ctx,
+						  ctx);
+	struct apfs_dirent_plus *dp;
+	u32 reclen = APFS_RDPLUS_RECLEN(namelen);
+
+	/* The dot entries come first, and the caller knows them already */
+	if (offset < 2)
+		return 0;
+	if (reclen > rp->size - rp->used) {
+		/* Readdir saves its cursor here, for the next call */
+		if (!rp->nr)
+			rp->err = -EINVAL;
+		return -ENOSPC;
+	}
+
+	dp = (struct apfs_dirent_plus *)(rp->buf + rp->used);
+	memset(dp, 0, reclen);
+	dp->dp_ino = ino;
+	dp->dp_reclen = reclen;
+	dp->dp_namelen = namelen;
+	dp->dp_type = d_type;
+	memcpy(dp->dp_name, name, namelen);
+
+	rp->slots[rp->nr].cnid = ino;
+	rp->slots[rp->nr].off = rp->used;
+	rp->nr++;
+	rp->used += reclen;
+	return 0;
+}
+
+static int apfs_rdplus_slot_cmp(const void *a, const void *b)
+{
+	const struct apfs_rdplus_slot *slot_a = a;
+	const struct apfs_rdplus_slot *slot_b = b;
+
+	if (slot_a->cnid == slot_b->cnid)
+		return slot_a->off < slot_b->off ? -1 : 1;
+	return slot_a->cnid < slot_b->cnid ? -1 : 1;
+}
+
+static int apfs_rdplus_actor(struct apfs_query *query, int idx, void *data)
+{
+	struct apfs_rdplus_ctx *rp = data;
+	struct apfs_bulkstat bs;
+	u64 cnid;
+	u32 i;
+
+	i = rp->first[idx];
+	cnid = rp->slots[i].cnid;
+	if (apfs_bulkstat_from_query(rp->sb, query, cnid, &bs)) {
+		apfs_alert(rp->sb, "bad inode record for inode 0x%llx", cnid);
+		return 0;
+	}
+
+	/* Hard links in the same directory share the inode record */
+	for (; i < rp->nr && rp->slots[i].cnid == cnid; i++) {
+		struct apfs_dirent_plus *dp;
+
+		dp = (struct apfs_dirent_plus *)(rp->buf + rp->slots[i].off);
+		dp->dp_size = bs.bs_size;
+		dp->dp_mtime = bs.bs_mtime;
+		dp->dp_crtime = bs.bs_crtime;
+		dp->dp_mode = bs.bs_mode;
+		dp->dp_bsd_flags = bs.bs_bsd_flags;
+	}
+	return 0;
+}
+
+/**
+ * apfs_rdplus_stat - Fill the attributes for the records of a call
+ * @rp:		state of the call, with all the records listed
+ *
+ * The inode records are found in cnid order, with a single walk of the
+ * catalog.  Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_rdplus_stat(struct apfs_rdplus_ctx *rp)
+{
+	struct apfs_key *keys;
+	u32 i, count = 0;
+	int err;
+
+	sort(rp->slots, rp->nr, sizeof(*rp->slots), apfs_rdplus_slot_cmp,
+	     NULL);
+
+	keys = kvmalloc_array(rp->nr, sizeof(*keys), GFP_KERNEL);
+	rp->first = kvmalloc_array(rp->nr, sizeof(*rp->first), GFP_KERNEL);
+	if (!keys || !rp->first) {
+		err = -ENOMEM;
+		goto out;
+	}
+	for (i = 0; i < rp->nr; i++) {
+		if (i && rp->slots[i].cnid == rp->slots[i - 1].cnid)
+			continue;
+		apfs_init_inode_key(rp->slots[i].cnid, &keys[count]);
+		rp->first[count] = i;
+		count++;
+	}
+
+	err = apfs_btree_query_batch(rp->sb, APFS_SB(rp->sb)->s_cat_root, keys,
+				     count, APFS_QUERY_CAT, apfs_rdplus_actor,
+				     rp);
+out:
+	kvfree(rp->first);
+	kvfree(keys);
+	return err;
+}
+
+/**
+ * apfs_ioc_readdir_plus - List a directory with the attributes of each entry
+ * @file:	the open directory
+ * @argp:	user address of the struct apfs_readdir_plus_req
+ *
+ * The names come from the usual readdir code, so the scan resumes from the
+ * same cursor as getdents().  The attributes are then read for all the
+ * entries at once, instead of with a stat() for each name, which would need
+ * a search of the catalog every time.  Those stat() calls would need search
+ * permission on the directory, and so does this.  Returns 0 on success, or a
+ * negative error code in case of failure.
+ */
+static int apfs_ioc_readdir_plus(struct file *file, void __user *argp)
+{
+	struct inode *inode = file_inode(file);
+	struct apfs_readdir_plus_req req;
+	struct apfs_rdplus_ctx rp = {
+		.ctx.actor = apfs_rdplus_fill,
+		.sb = inode->i_sb,
+	};
+	int err;
+
+	if (!S_ISDIR(inode->i_mode))
+		return -ENOTDIR;
+	err = inode_permission(inode, MAY_EXEC);
+	if (err)
+		return err;
+	if (copy_from_user(&req, argp, sizeof(req)))
+		return -EFAULT;
+	if (req.rp_flags || req.rp_pad)
+		return -EINVAL;
+	rp.size = min_t(u32, req.rp_size, APFS_READDIR_PLUS_MAX);
+	if (rp.size < APFS_RDPLUS_RECLEN(0))
+		return -EINVAL;
+
+	rp.buf = kvmalloc(rp.size, GFP_KERNEL);
+	rp.slots = kvmalloc_array(rp.size / APFS_RDPLUS_RECLEN(0),
+				  sizeof(*rp.slots), GFP_KERNEL);
+	if (!rp.buf || !rp.slots) {
+		err = -ENOMEM;
+		goto out;
+	}
+
+	/* Getdents takes this lock as well, to protect the file position */
+	mutex_lock(&file->f_pos_lock);
+	err = iterate_dir(file, &rp.ctx);
+	mutex_unlock(&file->f_pos_lock);
+	if (!err)
+		err = rp.err;
+	if (!err && rp.nr)
+		err = apfs_rdplus_stat(&rp);
+	if (err)
+		goto out;
+
+	if (copy_to_user(u64_to_user_ptr(req.rp_buffer), rp.buf, rp.used)) {
+		err = -EFAULT;
+		goto out;
+	}
+	req.rp_size = rp.used;
+	req.rp_count = rp.nr;
+	if (copy_to_user(argp, &req, sizeof(req)))
+		err = -EFAULT;
+out:
+	kvfree(rp.slots);
+	kvfree(rp.buf);
+	return err;
+}
+
+/**
+ * apfs_ioc_get_links - Report all the hard links of an inode
+ * @inode:	the inode
+ * @argp:	user address of the struct apfs_links_req
+ *
+ * The links come from the sibling records of the inode, which are cached, so
+ * paths for hard-linked files can be rebuilt without searching directories.
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_ioc_get_links(struct inode *inode, void __user *argp)
+{
+	struct apfs_links_req req;
+	struct apfs_link __user *ubuf;
+	struct apfs_siblings *siblings;
+	struct apfs_link *link;
+	int err = 0;
+	int i;
+
+	if (!capable(CAP_SYS_ADMIN))
+		return -EPERM;
+	if (copy_from_user(&req, argp, sizeof(req)))
+		return -EFAULT;
+	ubuf = u64_to_user_ptr(req.lr_buffer);
+
+	if (S_ISDIR(inode->i_mode)) {
+		req.lr_count = req.lr_total = 0;
+		goto out;
+	}
+	siblings = apfs_siblings_get(inode);
+	if (IS_ERR(siblings))
+		return PTR_ERR(siblings);
+
+	link = kmalloc(sizeof(*link), GFP_KERNEL);
+	if (!link)
+		return -ENOMEM;
+	req.lr_total = siblings->nr;
+	req.lr_count = min_t(u32, req.lr_count, siblings->nr);
+	for (i = 0; i < req.lr_count; i++) {
+		const struct apfs_sibling *sibling = &siblings->links[i];
+
+		link->al_parent_id = sibling->parent_id;
+		link->al_sibling_id = sibling->id;
+		memset(link->al_name, 0, sizeof(link->al_name));
+		memcpy(link->al_name, sibling->name, sibling->name_len);
+		if (copy_to_user(&ubuf[i], link, sizeof(*link))) {
+			err = -EFAULT;
+			break;
+		}
+	}
+	kfree(link);
+	if (err)
+		return err;
+
+out:
+	if (copy_to_user(argp, &req, sizeof(req)))
+		return -EFAULT;
+	return 0;
+}
+
+/**
+ * apfs_diff_check_xid - Check that a transaction id belongs to a snapshot
+ * @sb:		filesystem superblock
+ * @xid:	the transaction id
+ *
+ * Returns 0 on success, -EINVAL if there is no such snapshot, or another
+ * negative error code in case of failure.
+ */
+static int apfs_diff_check_xid(struct super_block *sb, u64 xid)
+{
+	struct apfs_snapshot snap;
+	char name[24];
+	int err;
+
+	snprintf(name, sizeof(name), "%llu", xid);
+	err = apfs_snapshot_find(sb, name, &snap);
+	return err == -ENOENT ? -EINVAL : err;
+}
+
+/**
+ * apfs_ioc_snap_diff - Report the catalog records changed between two xids
+ * @sb:		filesystem superblock
+ * @argp:	user address of the struct apfs_diff_req
+ *
+ * The base must be a snapshot, so that the omap still maps its nodes; the
+ * target is either a later snapshot or the mounted transaction.  Only the
+ * catalog nodes written in between are read, so incremental backups don't
+ * need to walk the whole tree.  Returns 0 on success, or a negative error code
+ * in case of failure.
+ */
+static int apfs_ioc_snap_diff(struct super_block *sb, void __user *argp)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_diff_req req;
+	int err;
+
+	if (!capable(CAP_SYS_ADMIN))
+		return -EPERM;
+	if (copy_from_user(&req, argp, sizeof(req)))
+		return -EFAULT;
+	if (req.dr_flags || req.dr_pad || !req.dr_count)
+		return -EINVAL;
+	req.dr_count = min_t(u32, req.dr_count, APFS_DIFF_MAX);
+
+	if (!req.dr_target_xid)
+		req.dr_target_xid = sbi->s_xid;
+	if (req.dr_base_xid >= req.dr_target_xid)
+		return -EINVAL;
+	err = apfs_diff_check_xid(sb, req.dr_base_xid);
+	if (!err && req.dr_target_xid != sbi->s_xid)
+		err = apfs_diff_check_xid(sb, req.dr_target_xid);
+	if (err)
+		return err;
+
+	err = apfs_snapdiff(sb, &req, u64_to_user_ptr(req.dr_buffer));
+	if (err)
+		return err;
+	if (copy_to_user(argp, &req, sizeof(req)))
+		return -EFAULT;
+	return 0;
+}
+
+/**
+ * apfs_ioc_phys_extents - Report file extents in physical block order
+ * @inode:	inode the ioctl was called on
+ * @argp:	user address of the struct apfs_extents_req
+ *
+ * Copy tools on rotational disks can read the files in this order to sweep
+ * the device once, instead of seeking for every file.  The data of compressed
+ * files is not in file extents, so they get -EOPNOTSUPP.  Returns 0 on
+ * success, or a negative error code in case of failure.
+ */
+static int apfs_ioc_phys_extents(struct inode *inode, void __user *argp)
+{
+	struct apfs_extents_req req;
+	int err;
+
+	if (!capable(CAP_SYS_ADMIN))
+		return -EPERM;
+	if (copy_from_user(&req, argp, sizeof(req)))
+		return -EFAULT;
+	if (req.er_flags & ~APFS_EXTENTS_SUBTREE || !req.er_count)
+		return -EINVAL;
+	if (req.er_flags & APFS_EXTENTS_SUBTREE && !S_ISDIR(inode->i_mode))
+		return -ENOTDIR;
+	if (!(req.er_flags & APFS_EXTENTS_SUBTREE) &&
+	    apfs_inode_is_compressed(inode))
+		return -EOPNOTSUPP;
+	req.er_count = min_t(u32, req.er_count, APFS_EXTENTS_MAX);
+
+	err = apfs_physmap(inode, &req, u64_to_user_ptr(req.er_buffer));
+	if (err)
+		return err;
+	if (copy_to_user(argp, &req, sizeof(req)))
+		return -EFAULT;
+	return 0;
+}
+
+/**
+ * apfs_ioc_dir_stats - Report the size of the tree under a directory
+ * @inode:	the directory
+ * @argp:	user address of the struct apfs_dir_stats
+ *
+ * The statistics are read from a single catalog record, when the directory
+ * has one, so du-style tools can skip the recursive walk.  Returns 0 on
+ * success, -ENODATA if the directory has no statistics, or another negative
+ * error code in case of failure.
+ */
+static int apfs_ioc_dir_stats(struct inode *inode, void __user *argp)
+{
+	struct super_block *sb = inode->i_sb;
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	u64 id = APFS_I(inode)->i_dir_stats_id;
+	struct apfs_dir_stats_val *val;
+	struct apfs_dir_stats stats;
+	struct apfs_key key;
+	struct apfs_query query;
+	int err;
+
+	if (!S_ISDIR(inode->i_mode))
+		return -ENOTDIR;
+	if (!id)
+		return -ENODATA;
+
+	apfs_init_dir_stats_key(id, &key);
+	apfs_init_query(&query, sbi->s_cat_root);
+	query.key = &key;
+	query.flags |= APFS_QUERY_CAT | APFS_QUERY_EXACT;
+
+	err = apfs_btree_query(sb, &query);
+	if (err == -ENODATA) {
+		apfs_alert(sb, "missing dir stats 0x%llx for inode 0x%llx", id,
+			   apfs_ino(inode));
+		err = -EFSCORRUPTED;
+	}
+	if (err)
+		goto out;
+	if (query.len != sizeof(*val)) {
+		apfs_alert(sb, "bad dir stats record 0x%llx", id);
+		err = -EFSCORRUPTED;
+		goto out;
+	}
+	val = (struct apfs_dir_stats_val *)(query.node->object.data +
+					    query.off);
+	stats.ds_children = le64_to_cpu(val->num_children);
+	stats.ds_total_size = le64_to_cpu(val->total_size);
+	stats.ds_chained_id = le64_to_cpu(val->chained_key);
+	stats.ds_gen_count = le64_to_cpu(val->gen_count);
+out:
+	apfs_free_query(sb, &query);
+	if (err)
+		return err;
+	if (copy_to_user(argp, &stats, sizeof(stats)))
+		return -EFAULT;
+	return 0;
+}
+
+/**
+ * apfs_ioc_block_owners - Report the files that own a range of blocks
+ * @sb:		filesystem superblock
+ * @argp:	user address of the struct apfs_owners_req
+ *
+ * The owners come from the extent reference tree, so a bad sector reported
+ * by the device can be traced back to a file without scanning the catalog.
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_ioc_block_owners(struct super_block *sb, void __user *argp)
+{
+	struct apfs_owners_req req;
+	int err;
+
+	if (!capable(CAP_SYS_ADMIN))
+		return -EPERM;
+	if (copy_from_user(&req, argp, sizeof(req)))
+		return -EFAULT;
+	if (req.or_flags || !req.or_count || req.or_block >= req.or_end)
+		return -EINVAL;
+	req.or_count = min_t(u32, req.or_count, APFS_OWNERS_MAX);
+
+	err = apfs_revmap(sb, &req, u64_to_user_ptr(req.or_buffer));
+	if (err)
+		return err;
+	if (copy_to_user(argp, &req, sizeof(req)))
+		return -EFAULT;
+	return 0;
+}
+
+/**
+ * apfs_ioc_prefetch - Load the catalog records for a directory tree
+ * @inode:	the directory
+ * @argp:	user address of the struct apfs_prefetch_req
+ *
+ * Batch jobs can call this before they start, so that their walk of the tree
+ * doesn't wait on the disk for every file.  Returns 0 on success, or a
+ * negative error code in case of failure.
+ */
+static int apfs_ioc_prefetch(struct inode *inode, void __user *argp)
+{
+	struct apfs_prefetch_req req;
+	int err;
+
+	if (!capable(CAP_SYS_ADMIN))
+		return -EPERM;
+	if (!S_ISDIR(inode->i_mode))
+		return -ENOTDIR;
+	if (copy_from_user(&req, argp, sizeof(req)))
+		return -EFAULT;
+	if (req.pf_flags || req.pf_dirs || req.pf_inodes || req.pf_extents)
+		return -EINVAL;
+	if (!req.pf_batch)
+		req.pf_batch = APFS_PREFETCH_BATCH;
+	req.pf_batch = min_t(u32, req.pf_batch, APFS_PREFETCH_MAX);
+
+	err = apfs_prefetch(inode, &req, argp);
+	if (err)
+		return err;
+	if (copy_to_user(argp, &req, sizeof(req)))
+		return -EFAULT;
+	return 0;
+}
+
+/**
+ * apfs_ioc_get_warmset - Report the blocks of the nodes in the cache
+ * @sb:		filesystem superblock
+ * @argp:	user address of the struct apfs_warmset_req
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_ioc_get_warmset(struct super_block *sb, void __user *argp)
+{
+	struct apfs_warmset_req req;
+	int err;
+
+	if (!capable(CAP_SYS_ADMIN))
+		return -EPERM;
+	if (copy_from_user(&req, argp, sizeof(req)))
+		return -EFAULT;
+	if (req.ws_flags || !req.ws_count)
+		return -EINVAL;
+	req.ws_count = min_t(u32, req.ws_count, APFS_WARMSET_MAX);
+
+	err = apfs_warmset_get(sb, &req);
+	if (err)
+		return err;
+	if (copy_to_user(argp, &req, sizeof(req)))
+		return -EFAULT;
+	return 0;
+}
+
+/**
+ * apfs_ioc_load_warmset - Read ahead the blocks of a saved warm set
+ * @sb:		filesystem superblock
+ * @argp:	user address of the struct apfs_warmset_req
+ *
+ * Meant to be called right after mount, with the list that the previous
+ * mount of the same checkpoint reported with APFS_IOC_GET_WARMSET.  Returns
+ * 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_ioc_load_warmset(struct super_block *sb, void __user *argp)
+{
+	struct apfs_warmset_req req;
+
+	if (!capable(CAP_SYS_ADMIN))
+		return -EPERM;
+	if (copy_from_user(&req, argp, sizeof(req)))
+		return -EFAULT;
+	if (req.ws_flags || req.ws_count > APFS_WARMSET_MAX)
+		return -EINVAL;
+	return apfs_warmset_load(sb, &req);
+}
+
+/**
+ * apfs_ioc_get_xattrs - Report the names and values of all the xattrs of a file
+ * @inode:	the inode
+ * @argp:	user address of the struct apfs_xattrs_req
+ *
+ * Backup tools that keep the macOS metadata would otherwise call listxattr()
+ * and then getxattr() twice for each name, with a search of the catalog every
+ * time.  Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_ioc_get_xattrs(struct inode *inode, void __user *argp)
+{
+	struct apfs_xattrs_req req;
+	char *buf;
+	int err;
+
+	/* Same as for getxattr() of a name outside the known namespaces */
+	err = inode_permission(inode, MAY_READ);
+	if (err)
+		return err;
+	if (copy_from_user(&req, argp, sizeof(req)))
+		return -EFAULT;
+	if (req.xr_flags)
+		return -EINVAL;
+	req.xr_size = min_t(u32, req.xr_size, APFS_XATTRS_MAX);
+	if (req.xr_size < sizeof(struct apfs_xattr_entry))
+		return -EINVAL;
+
+	buf = kvmalloc(req.xr_size, GFP_KERNEL);
+	if (!buf)
+		return -ENOMEM;
+	err = apfs_xattr_get_all(inode, &req, buf);
+	if (err && err != -ERANGE)
+		goto out;
+
+	if (!err && copy_to_user(u64_to_user_ptr(req.xr_buffer), buf,
+				 req.xr_size)) {
+		err = -EFAULT;
+		goto out;
+	}
+	/* On ERANGE the caller still needs the size of the first record */
+	if (copy_to_user(argp, &req, sizeof(req)))
+		err = -EFAULT;
+out:
+	kvfree(buf);
+	return err;
+}
+
+/**
+ * apfs_ioc_frag_report - Report how fragmented a file is
+ * @inode:	the regular file
+ * @argp:	user address of the struct apfs_frag_report
+ *
+ * Tools that decide what to defragment or copy again would otherwise ask for
+ * the whole extent list with fiemap and work the numbers out themselves.
+ * Compressed files have no extents to measure, so they get -EOPNOTSUPP.
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_ioc_frag_report(struct inode *inode, void __user *argp)
+{
+	struct apfs_frag_report rep;
+	int err;
+
+	if (!S_ISREG(inode->i_mode))
+		return -EINVAL;
+	if (apfs_inode_is_compressed(inode))
+		return -EOPNOTSUPP;
+	if (copy_from_user(&rep, argp, sizeof(rep)))
+		return -EFAULT;
+	if (rep.fr_flags)
+		return -EINVAL;
+
+	err = apfs_extent_frag(inode, &rep);
+	if (err)
+		return err;
+	if (copy_to_user(argp, &rep, sizeof(rep)))
+		return -EFAULT;
+	return 0;
+}
+
+/**
+ * apfs_ioc_ino_path - Find the path of an inode from its number
+ * @sb:		filesystem superblock
+ * @argp:	user address of the struct apfs_ino_path_req
+ *
+ * Audit tools get inode numbers from fanotify or file handles, and need the
+ * paths for them.  The path is written even for inodes in directories that
+ * the caller can't search, so this needs CAP_SYS_ADMIN.  Returns 0 on
+ * success, or a negative error code in case of failure.
+ */
+static int apfs_ioc_ino_path(struct super_block *sb, void __user *argp)
+{
+	struct apfs_ino_path_req req;
+	int err;
+
+	if (!capable(CAP_SYS_ADMIN))
+		return -EPERM;
+	if (copy_from_user(&req, argp, sizeof(req)))
+		return -EFAULT;
+	if (req.ip_flags & ~APFS_INO_PATH_CACHED)
+		return -EINVAL;
+
+	err = apfs_ino_path(sb, &req, u64_to_user_ptr(req.ip_buffer));
+	/* The caller needs the size of the path to retry */
+	if (err && err != -ERANGE)
+		return err;
+	if (copy_to_user(argp, &req, sizeof(req)))
+		return -EFAULT;
+	return err;
+}
+
+/**
+ * apfs_ioc_archive - Stream a directory tree to a file as a cpio archive
+ * @file:	the directory, open
+ * @argp:	user address of the struct apfs_archive_req
+ *
+ * Backups of a big tree spend most of their time seeking between the files,
+ * in the order they come out of readdir; this reads the files in the order of
+ * their data on disk instead, with readahead at a depth that userspace can't
+ * get without knowing the layout.  Every file in the tree gets read, whatever
+ * its permissions, so this needs CAP_SYS_ADMIN.  Returns 0 on success, or a
+ * negative error code in case of failure.
+ */
+static int apfs_ioc_archive(struct file *file, void __user *argp)
+{
+	struct apfs_archive_req req;
+	struct fd out;
+	int err;
+
+	if (!capable(CAP_SYS_ADMIN))
+		return -EPERM;
+	if (!S_ISDIR(file_inode(file)->i_mode))
+		return -ENOTDIR;
+	if (copy_from_user(&req, argp, sizeof(req)))
+		return -EFAULT;
+	if (req.ar_flags)
+		return -EINVAL;
+
+	out = fdget(req.ar_fd);
+	if (!out.file)
+		return -EBADF;
+	if (!(out.file->f_mode & FMODE_WRITE)) {
+		fdput(out);
+		return -EBADF;
+	}
+	err = apfs_archive(file, out.file, &req);
+	fdput(out);
+
+	if (copy_to_user(argp, &req, sizeof(req)))
+		return -EFAULT;
+	return err;
+}
+
+/**
+ * apfs_ioc_copy_range - Copy part of a file to a file on another filesystem
+ * @file:	the file to copy from
+ * @argp:	user address of the struct apfs_copy_range_req
+ *
+ * The vfs only passes copy_file_range() to the filesystem of the destination,
+ * and only when both files are on the same one, so extraction tools need this
+ * to copy their data with no reads of the holes.  It only reads what the
+ * caller could read anyway, so no capabilities are needed.  The extent map of
+ * a compressed file says nothing about its data, so those get -EOPNOTSUPP and
+ * must be copied with plain reads.  Returns 0 on success, or a negative error
+ * code in case of failure.
+ */
+static int apfs_ioc_copy_range(struct file *file, void __user *argp)
+{
+	struct apfs_copy_range_req req;
+	struct fd dst;
+	int err;
+
+	if (!S_ISREG(file_inode(file)->i_mode))
+		return -EINVAL;
+	if (!(file->f_mode & FMODE_READ))
+		return -EBADF;
+	if (apfs_inode_is_compressed(file_inode(file)))
+		return -EOPNOTSUPP;
+	if (copy_from_user(&req, argp, sizeof(req)))
+		return -EFAULT;
+	if (req.cr_flags & ~APFS_COPY_RANGE_DIRECT)
+		return -EINVAL;
+	if ((loff_t)req.cr_src_off < 0 || (loff_t)req.cr_dst_off < 0)
+		return -EINVAL;
+
+	dst = fdget(req.cr_fd);
+	if (!dst.file)
+		return -EBADF;
+	if (!S_ISREG(file_inode(dst.file)->i_mode)) {
+		err = -EINVAL;
+		goto out;
+	}
+	if (!(dst.file->f_mode & FMODE_WRITE) ||
+	    (dst.file->f_flags & O_APPEND)) {
+		err = -EBADF;
+		goto out;
+	}
+	err = apfs_copy_range(file, dst.file, &req);
+out:
+	fdput(dst);
+	if (copy_to_user(argp, &req, sizeof(req)))
+		return -EFAULT;
+	return err;
+}
+
+/**
+ * apfs_ioctl_check_layout - Check the layout of the ioctl structures
+ *
+ * The sizes are part of the ioctl numbers, and they must be the same for
+ * 32-bit tasks, or apfs_compat_ioctl() would need to convert the requests.
+ */
+static inline void apfs_ioctl_check_layout(void)
+{
+	BUILD_BUG_ON(sizeof(struct apfs_bulkstat) != 88);
+	BUILD_BUG_ON(sizeof(struct apfs_bulkstat_req) != 24);
+	BUILD_BUG_ON(sizeof(struct apfs_dirent_plus) != 48);
+	BUILD_BUG_ON(sizeof(struct apfs_readdir_plus_req) != 24);
+	BUILD_BUG_ON(sizeof(struct apfs_link) != 1040);
+	BUILD_BUG_ON(sizeof(struct apfs_links_req) != 16);
+	BUILD_BUG_ON(sizeof(struct apfs_diff_entry) != 32);
+	BUILD_BUG_ON(sizeof(struct apfs_diff_req) != 48);
+	BUILD_BUG_ON(sizeof(struct apfs_extent_entry) != 32);
+	BUILD_BUG_ON(sizeof(struct apfs_extents_req) != 40);
+	BUILD_BUG_ON(sizeof(struct apfs_dir_stats) != 32);
+	BUILD_BUG_ON(sizeof(struct apfs_owner_entry) != 40);
+	BUILD_BUG_ON(sizeof(struct apfs_owners_req) != 32);
+	BUILD_BUG_ON(sizeof(struct apfs_prefetch_req) != 32);
+	BUILD_BUG_ON(sizeof(struct apfs_warmset_req) != 56);
+	BUILD_BUG_ON(sizeof(struct apfs_xattr_entry) != 16);
+	BUILD_BUG_ON(sizeof(struct apfs_xattrs_req) != 24);
+	BUILD_BUG_ON(sizeof(struct apfs_frag_report) != 56);
+	BUILD_BUG_ON(sizeof(struct apfs_ino_path_req) != 32);
+	BUILD_BUG_ON(sizeof(struct apfs_archive_req) != 24);
+	BUILD_BUG_ON(sizeof(struct apfs_copy_range_req) != 48);
+}
+
+long apfs_ioctl(struct file *file, unsigned int cmd, unsigned long arg)
+{
+	struct inode *inode = file_inode(file);
+	struct super_block *sb = inode->i_sb;
+	void __user *argp = (void __user *)arg;
+
+	apfs_ioctl_check_layout();
+
+	switch (cmd) {
+	case APFS_IOC_BULKSTAT:
+		return apfs_ioc_bulkstat(sb, argp);
+	case APFS_IOC_GET_LINKS:
+		return apfs_ioc_get_links(inode, argp);
+	case APFS_IOC_SNAP_DIFF:
+		return apfs_ioc_snap_diff(sb, argp);
+	case APFS_IOC_PHYS_EXTENTS:
+		return apfs_ioc_phys_extents(inode, argp);
+	case APFS_IOC_DIR_STATS:
+		return apfs_ioc_dir_stats(inode, argp);
+	case APFS_IOC_BLOCK_OWNERS:
+		return apfs_ioc_block_owners(sb, argp);
+	case APFS_IOC_PREFETCH:
+		return apfs_ioc_prefetch(inode, argp);
+	case APFS_IOC_GET_WARMSET:
+		return apfs_ioc_get_warmset(sb, argp);
+	case APFS_IOC_LOAD_WARMSET:
+		return apfs_ioc_load_warmset(sb, argp);
+	case APFS_IOC_READDIR_PLUS:
+		return apfs_ioc_readdir_plus(file, argp);
+	case APFS_IOC_GET_XATTRS:
+		return apfs_ioc_get_xattrs(inode, argp);
+	case APFS_IOC_FRAG_REPORT:
+		return apfs_ioc_frag_report(inode, argp);
+	case APFS_IOC_INO_PATH:
+		return apfs_ioc_ino_path(sb, argp);
+	case APFS_IOC_ARCHIVE:
+		return apfs_ioc_archive(file, argp);
+	case APFS_IOC_COPY_RANGE:
+		return apfs_ioc_copy_range(file, argp);
+	default:
+		return -ENOTTY;
+	}
+}
+
+#ifdef CONFIG_COMPAT
+long apfs_compat_ioctl(struct file *file, unsigned int cmd, unsigned long arg)
+{
+	/* The request structures have the same layout for 32-bit tasks */
+	return apfs_ioctl(file, cmd, (unsigned long)compat_ptr(arg));
+}
+#endif
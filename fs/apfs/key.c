@@ -6,7 +6,12 @@
  */
 
 #include <linux/crc32c.h>
+#include <linux/fs.h>
+#include <linux/kernel.h>
+#include <linux/string.h>
+#include <asm/unaligned.h>
 #include "apfs.h"
+#include "fusion.h"
 #include "key.h"
 #include "super.h"
 #include "unicode.h"
@@ -37,22 +42,74 @@ static inline u64 apfs_cat_cnid(struct apfs_key_header *key)
 }
 
 /**
- * apfs_filename_cmp - Normalize and compare two APFS filenames
- * @sb:			filesystem superblock
+ * apfs_ascii_prefix_cmp - Compare two filenames a word at a time, while they
+ *			   are plain ascii
+ * @name1, @name2:	names to compare
+ * @len:		length of the shorter name
+ * @case_fold:		case fold the names?
+ * @result:		on return, the result of the comparison, if decided
+ *
+ * Ascii characters are their own normalization, so they can be compared as
+ * they are once case folded.  Returns the length of the prefix found to be
+ * the same in both names, where a normal comparison can take over; or -1 if
+ * the names were found to differ, and @result is set.
+ */
+static __always_inline int apfs_ascii_prefix_cmp(const char *name1,
+						  const char *name2, int len,
+						  const bool case_fold,
+						  int *result)
+{
+	int off;
+
+	for (off = 0; off + sizeof(u64) <= len; off += sizeof(u64)) {
+		u64 word1 = get_unaligned_le64(name1 + off);
+		u64 word2 = get_unaligned_le64(name2 + off);
+		int shift;
+
+		if ((word1 | word2) & APFS_ASCII_HIGH_BITS)
+			break;
+		if (case_fold) {
+			word1 = apfs_ascii_fold_word(word1);
+			word2 = apfs_ascii_fold_word(word2);
+		}
+		if (word1 == word2)
+			continue;
+
+		/* The words are little endian, so this is the first mismatch */
+		shift = __ffs64(word1 ^ word2) & ~7;
+		*result = (u8)(word1 >> shift) < (u8)(word2 >> shift) ? -1 : 1;
+		return -1;
+	}
+	return off;
+}
+
+/**
+ * __apfs_filename_cmp - Normalize and compare two APFS filenames
  * @name1, @name2:	names to compare
+ * @case_fold:		case fold the names?  Must be a constant.
  *
  * returns   0 if @name1 and @name2 are equal
  *	   < 0 if @name1 comes before @name2
  *	   > 0 if @name1 comes after @name2
  */
-int apfs_filename_cmp(struct super_block *sb,
-		      const char *name1, const char *name2)
+static __always_inline int __apfs_filename_cmp(const char *name1,
+					       const char *name2,
+					       const bool case_fold)
 {
 	struct apfs_unicursor cursor1, cursor2;
-	bool case_fold = apfs_is_case_insensitive(sb);
+	int len, off, result = 0;
+
+	/* Most matches have the same bytes, don't bother normalizing them */
+	if (!strcmp(name1, name2))
+		return 0;
+
+	len = min(strlen(name1), strlen(name2));
+	off = apfs_ascii_prefix_cmp(name1, name2, len, case_fold, &result);
+	if (off < 0)
+		return result;
 
-	apfs_init_unicursor(&cursor1, name1);
-	apfs_init_unicursor(&cursor2, name2);
+	apfs_init_unicursor(&cursor1, name1 + off);
+	apfs_init_unicursor(&cursor2, name2 + off);
 
 	while (1) {
 		unicode_t uni1, uni2;
@@ -67,6 +124,22 @@ int apfs_filename_cmp(struct super_block *sb,
 	}
 }
 
+/**
+ * apfs_filename_cmp - Normalize and compare two APFS filenames
+ * @sb:			filesystem superblock
+ * @name1, @name2:	names to compare
+ *
+ * The mode of the volume is checked once here, and not for every character.
+ * Returns the same as __apfs_filename_cmp().
+ */
+int apfs_filename_cmp(struct super_block *sb,
+		      const char *name1, const char *name2)
+{
+	if (apfs_is_case_insensitive(sb))
+		return __apfs_filename_cmp(name1, name2, true /* case_fold */);
+	return __apfs_filename_cmp(name1, name2, false /* case_fold */);
+}
+
 /**
  * apfs_keycmp - Compare two keys
  * @sb:		filesystem superblock
@@ -79,10 +152,24 @@ int apfs_filename_cmp(struct super_block *sb,
 int apfs_keycmp(struct super_block *sb,
 		struct apfs_key *k1, struct apfs_key *k2)
 {
-	if (k1->id != k2->id)
-		return k1->id < k2->id ? -1 : 1;
-	if (k1->type != k2->type)
-		return k1->type < k2->type ? -1 : 1;
+	u64 hi1, hi2;
+
+	/*
+	 * Catalog ids only have 60 bits, so the id and type can be packed in a
+	 * single sortable value, and compared at once.  Omap ids may use all
+	 * 64 bits; those few take the long way.
+	 */
+	if (likely(!((k1->id | k2->id) & APFS_OBJ_TYPE_MASK))) {
+		hi1 = k1->id << (64 - APFS_OBJ_TYPE_SHIFT) | k1->type;
+		hi2 = k2->id << (64 - APFS_OBJ_TYPE_SHIFT) | k2->type;
+	} else {
+		if (k1->id != k2->id)
+			return k1->id < k2->id ? -1 : 1;
+		hi1 = k1->type;
+		hi2 = k2->type;
+	}
+	if (hi1 != hi2)
+		return hi1 < hi2 ? -1 : 1;
 	if (k1->number != k2->number)
 		return k1->number < k2->number ? -1 : 1;
 	if (!k1->name)
@@ -169,32 +256,96 @@ int apfs_read_omap_key(void *raw, int size, struct apfs_key *key)
 }
 
 /**
- * apfs_init_drec_hashed_key - Initialize an in-memory key for a dentry query
- * @sb:		filesystem superblock
- * @ino:	inode number of the parent directory
- * @name:	filename (NULL for a multiple query)
- * @key:	apfs_key structure to initialize
+ * apfs_read_snap_key - Parse an on-disk snapshot metadata key
+ * @raw:	pointer to the raw key
+ * @size:	size of the raw key
+ * @key:	apfs_key structure to store the result
+ *
+ * The metadata records are keyed by the xid of the snapshot, and the name
+ * records by the name itself.  Returns 0 on success, or a negative error code
+ * otherwise.
  */
-void apfs_init_drec_hashed_key(struct super_block *sb, u64 ino,
-			       const char *name, struct apfs_key *key)
+int apfs_read_snap_key(void *raw, int size, struct apfs_key *key)
 {
-	struct apfs_unicursor cursor;
-	bool case_fold = apfs_is_case_insensitive(sb);
-	u32 hash = 0xFFFFFFFF;
+	struct apfs_snap_name_key *name_key = raw;
 
-	key->id = ino;
-	key->type = APFS_TYPE_DIR_REC;
+	if (size < sizeof(struct apfs_key_header))
+		return -EFSCORRUPTED;
+	key->id = apfs_cat_cnid(&name_key->hdr);
+	key->type = apfs_cat_type(&name_key->hdr);
+	key->number = 0;
+	key->name = NULL;
 
-	/* To respect normalization, queries can only consider the hash */
+	if (key->type == APFS_TYPE_SNAP_NAME) {
+		if (size < sizeof(*name_key) + 1 ||
+		    *((char *)raw + size - 1) != 0) {
+			/* Snapshot name must have NULL-termination */
+			return -EFSCORRUPTED;
+		}
+		key->name = (char *)name_key->name;
+	}
+	return 0;
+}
+
+/**
+ * apfs_read_fusion_key - Parse an on-disk fusion middle tree key
+ * @raw:	pointer to the raw key
+ * @size:	size of the raw key
+ * @key:	apfs_key structure to store the result
+ *
+ * Returns 0 on success, or a negative error code otherwise.
+ */
+int apfs_read_fusion_key(void *raw, int size, struct apfs_key *key)
+{
+	if (size != sizeof(struct apfs_fusion_mt_key))
+		return -EFSCORRUPTED;
+
+	key->id = le64_to_cpu(((struct apfs_fusion_mt_key *)raw)->fmk_paddr);
+	key->type = 0;
+	key->number = 0;
 	key->name = NULL;
 
-	if (!name) {
-		key->number = 0;
-		return;
+	return 0;
+}
+
+/**
+ * __apfs_filename_hash - Compute the catalog hash of a filename
+ * @name:	the filename
+ * @case_fold:	case fold the name?  Must be a constant.
+ *
+ * Returns the crc32c of the normalized name; only the bits that fit under
+ * APFS_DREC_HASH_MASK end up in the catalog keys.
+ */
+static __always_inline u32 __apfs_filename_hash(const char *name,
+						const bool case_fold)
+{
+	struct apfs_unicursor cursor;
+	unicode_t batch[APFS_HASH_BATCH];
+	u32 hash = 0xFFFFFFFF;
+	int len = strlen(name);
+	int count = 0, off;
+
+	/* Plain ascii is its own normalization, take it a word at a time */
+	for (off = 0; off + sizeof(u64) <= len; off += sizeof(u64)) {
+		u64 word = get_unaligned_le64(name + off);
+		int i;
+
+		if (word & APFS_ASCII_HIGH_BITS)
+			break;
+		if (case_fold)
+			word = apfs_ascii_fold_word(word);
+		for (i = 0; i < sizeof(u64); i++, word >>= 8)
+			batch[count++] = (u8)word;
+		if (count == APFS_HASH_BATCH) {
+			hash = crc32c(hash, batch, sizeof(batch));
+			count = 0;
+		}
 	}
 
-	apfs_init_unicursor(&cursor, name);
+	/* The rest goes through the normalization code */
+	apfs_init_unicursor(&cursor, name + off);
 
+	/* Feed crc32c whole batches, so that it can run at full width */
 	while (1) {
 		unicode_t utf32;
 
@@ -202,9 +353,42 @@ void apfs_init_drec_hashed_key(struct super_block *sb, u64 ino,
 		if (!utf32)
 			break;
 
-		hash = crc32c(hash, &utf32, sizeof(utf32));
+		batch[count++] = utf32;
+		if (count == APFS_HASH_BATCH) {
+			hash = crc32c(hash, batch, sizeof(batch));
+			count = 0;
+		}
 	}
+	if (count)
+		hash = crc32c(hash, batch, count * sizeof(batch[0]));
+	return hash;
+}
+
+/**
+ * apfs_filename_hash - Compute the catalog hash of a filename
+ * @sb:		filesystem superblock
+ * @name:	the filename
+ *
+ * Returns the same as __apfs_filename_hash(), for the mode of the volume.
+ */
+u32 apfs_filename_hash(struct super_block *sb, const char *name)
+{
+	if (apfs_is_case_insensitive(sb))
+		return __apfs_filename_hash(name, true /* case_fold */);
+	return __apfs_filename_hash(name, false /* case_fold */);
+}
+
+/**
+ * apfs_init_drec_hashed_key - Initialize an in-memory key for a dentry query
+ * @sb:		filesystem superblock
+ * @ino:	inode number of the parent directory
+ * @name:	filename (NULL for a multiple query)
+ * @key:	apfs_key structure to initialize
+ */
+void apfs_init_drec_hashed_key(struct super_block *sb, u64 ino,
+			       const char *name, struct apfs_key *key)
+{
+	u32 hash = name ? apfs_filename_hash(sb, name) : 0;
 
-	/* The filename length doesn't matter, so it's left as zero */
-	key->number = hash << APFS_DREC_HASH_SHIFT;
+	apfs_init_drec_key_by_hash(ino, hash, key);
 }
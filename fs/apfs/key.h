@@ -77,6 +77,9 @@ struct apfs_dstream_id_key {
 #define APFS_DREC_HASH_MASK	0xfffffc00
 #define APFS_DREC_HASH_SHIFT	10
 
+/* Normalized characters fed to crc32c at once when hashing a filename */
+#define APFS_HASH_BATCH		64
+
 /* The name length in the catalog key counts the terminating null byte. */
 #define APFS_NAME_LEN		(APFS_DREC_LEN_MASK - 1)
 
@@ -96,6 +99,15 @@ struct apfs_drec_hashed_key {
 	u8 name[0];
 } __packed;
 
+/*
+ * Structure of the key for a snapshot name record
+ */
+struct apfs_snap_name_key {
+	struct apfs_key_header hdr;
+	__le16 name_len;
+	u8 name[0];
+} __packed;
+
 /*
  * Structure of the key for an extended attributes record
  */
@@ -105,6 +117,14 @@ struct apfs_xattr_key {
 	u8 name[0];
 } __packed;
 
+/*
+ * Structure of the key for a sibling link record
+ */
+struct apfs_sibling_link_key {
+	struct apfs_key_header hdr;
+	__le64 sibling_id;
+} __packed;
+
 /*
  * In-memory representation of a key, as relevant for a b-tree query.
  */
@@ -142,6 +162,34 @@ static inline void apfs_init_inode_key(u64 ino, struct apfs_key *key)
 	key->name = NULL;
 }
 
+/**
+ * apfs_init_dir_stats_key - Initialize an in-memory key for a dir stats query
+ * @id:		id of the directory statistics record
+ * @key:	apfs_key structure to initialize
+ */
+static inline void apfs_init_dir_stats_key(u64 id, struct apfs_key *key)
+{
+	key->id = id;
+	key->type = APFS_TYPE_DIR_STATS;
+	key->number = 0;
+	key->name = NULL;
+}
+
+/**
+ * apfs_init_sibling_link_key - Initialize an in-memory key for a sibling query
+ * @ino:	inode number
+ * @key:	apfs_key structure to initialize
+ *
+ * This is only used for multiple queries, to find all the hard links.
+ */
+static inline void apfs_init_sibling_link_key(u64 ino, struct apfs_key *key)
+{
+	key->id = ino;
+	key->type = APFS_TYPE_SIBLING_LINK;
+	key->number = 0;
+	key->name = NULL;
+}
+
 /**
  * apfs_init_file_extent_key - Initialize an in-memory key for an extent query
  * @id:		extent id
@@ -157,6 +205,40 @@ static inline void apfs_init_file_extent_key(u64 id, u64 offset,
 	key->name = NULL;
 }
 
+/**
+ * apfs_init_phys_ext_key - Initialize an in-memory key for a physical extent
+ *			    query
+ * @bno:	first block number of the physical extent
+ * @key:	apfs_key structure to initialize
+ */
+static inline void apfs_init_phys_ext_key(u64 bno, struct apfs_key *key)
+{
+	key->id = bno;
+	key->type = APFS_TYPE_EXTENT;
+	key->number = 0;
+	key->name = NULL;
+}
+
+/**
+ * apfs_init_drec_key_by_hash - Initialize an in-memory key for a dentry query,
+ *				with a filename hash that's already known
+ * @ino:	inode number of the parent directory
+ * @hash:	hash of the filename, from apfs_filename_hash()
+ * @key:	apfs_key structure to initialize
+ */
+static inline void apfs_init_drec_key_by_hash(u64 ino, u32 hash,
+					      struct apfs_key *key)
+{
+	key->id = ino;
+	key->type = APFS_TYPE_DIR_REC;
+
+	/* To respect normalization, queries can only consider the hash */
+	key->name = NULL;
+
+	/* The filename length doesn't matter, so it's left as zero */
+	key->number = (u32)(hash << APFS_DREC_HASH_SHIFT);
+}
+
 extern void apfs_init_drec_hashed_key(struct super_block *sb, u64 ino,
 				      const char *name, struct apfs_key *key);
 
@@ -175,11 +257,14 @@ static inline void apfs_init_xattr_key(u64 ino, const char *name,
 	key->name = name;
 }
 
+extern u32 apfs_filename_hash(struct super_block *sb, const char *name);
 extern int apfs_filename_cmp(struct super_block *sb,
 			     const char *name1, const char *name2);
 extern int apfs_keycmp(struct super_block *sb,
 		       struct apfs_key *k1, struct apfs_key *k2);
 extern int apfs_read_cat_key(void *raw, int size, struct apfs_key *key);
 extern int apfs_read_omap_key(void *raw, int size, struct apfs_key *key);
+extern int apfs_read_snap_key(void *raw, int size, struct apfs_key *key);
+extern int apfs_read_fusion_key(void *raw, int size, struct apfs_key *key);
 
 #endif	/* _APFS_KEY_H */
@@ -0,0 +1,829 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/lzfse.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ *
+ * Decoders for the lzvn and lzfse compression formats used by decmpfs
+ */
+
+#include <linux/errno.h>
+#include <linux/kernel.h>
+#include <linux/string.h>
+#include <asm/unaligned.h>
+#include "apfs.h"
+#include "lzfse.h"
+
+/**
+ * apfs_lz_copy_match - Copy a match from earlier in the output buffer
+ * @dst:	start of the output buffer
+ * @out:	current position in the output, will be updated
+ * @dst_end:	end of the output buffer
+ * @dist:	distance back to the start of the match
+ * @len:	length of the match
+ *
+ * Returns 0 on success, or -EFSCORRUPTED if the match is out of bounds.
+ */
+static inline int apfs_lz_copy_match(u8 *dst, u8 **out, u8 *dst_end,
+				     size_t dist, size_t len)
+{
+	u8 *to = *out;
+	const u8 *from = to - dist;
+
+	if (unlikely(!dist || dist > to - dst || len > dst_end - to))
+		return -EFSCORRUPTED;
+	*out = to + len;
+
+	if (likely(dist >= 8 && dst_end - to >= len + 8)) {
+		/* Copy whole words, it's fine to overrun by a few bytes */
+		while (1) {
+			put_unaligned(get_unaligned((u64 *)from), (u64 *)to);
+			if (len <= 8)
+				return 0;
+			from += 8;
+			to += 8;
+			len -= 8;
+		}
+	}
+
+	while (len--)
+		*to++ = *from++;
+	return 0;
+}
+
+/**
+ * apfs_lz_copy_literals - Copy literal bytes to the output buffer
+ * @out:	current position in the output, will be updated
+ * @dst_end:	end of the output buffer
+ * @lit:	the literals
+ * @len:	number of literals
+ *
+ * Returns 0 on success, or -EFSCORRUPTED if the output buffer is too short.
+ */
+static inline int apfs_lz_copy_literals(u8 **out, u8 *dst_end, const u8 *lit,
+					size_t len)
+{
+	if (unlikely(len > dst_end - *out))
+		return -EFSCORRUPTED;
+	memcpy(*out, lit, len);
+	*out += len;
+	return 0;
+}
+
+/* Classes of lzvn opcodes */
+enum {
+	APFS_LZVN_SML_D,	/* LLMMMDDD DDDDDDDD + literals */
+	APFS_LZVN_MED_D,	/* 101LLMMM DDDDDDMM DDDDDDDD + literals */
+	APFS_LZVN_LRG_D,	/* LLMMM111 DDDDDDDD DDDDDDDD + literals */
+	APFS_LZVN_PRE_D,	/* LLMMM110 + literals */
+	APFS_LZVN_SML_L,	/* 1110LLLL + literals */
+	APFS_LZVN_LRG_L,	/* 11100000 LLLLLLLL + literals */
+	APFS_LZVN_SML_M,	/* 1111MMMM */
+	APFS_LZVN_LRG_M,	/* 11110000 MMMMMMMM */
+	APFS_LZVN_NOP,
+	APFS_LZVN_EOS,
+	APFS_LZVN_UDEF,
+};
+
+/**
+ * apfs_lzvn_class - Find the class of an lzvn opcode
+ * @op: the opcode
+ */
+static inline int apfs_lzvn_class(u8 op)
+{
+	if (op >= 0xe0) {
+		if (op >= 0xf0)
+			return op == 0xf0 ? APFS_LZVN_LRG_M : APFS_LZVN_SML_M;
+		return op == 0xe0 ? APFS_LZVN_LRG_L : APFS_LZVN_SML_L;
+	}
+	if ((op & 0xe0) == 0xa0)
+		return APFS_LZVN_MED_D;
+	if ((op & 0xf0) == 0x70 || (op & 0xf0) == 0xd0)
+		return APFS_LZVN_UDEF;
+
+	switch (op & 7) {
+	case 7:
+		return APFS_LZVN_LRG_D;
+	case 6:
+		/* Repeating the distance makes no sense without literals */
+		if (op >= 0x40)
+			return APFS_LZVN_PRE_D;
+		if (op == 0x06)
+			return APFS_LZVN_EOS;
+		if (op == 0x0e || op == 0x16)
+			return APFS_LZVN_NOP;
+		return APFS_LZVN_UDEF;
+	default:
+		return APFS_LZVN_SML_D;
+	}
+}
+
+/**
+ * apfs_lzvn_decode - Decode an lzvn stream
+ * @src:	compressed data
+ * @src_len:	length of @src
+ * @dst:	start of the output buffer, for the match distances
+ * @out:	position where the output starts, will be updated
+ * @dst_end:	end of the output buffer
+ *
+ * Returns 0 once the end of the stream is reached, or -EFSCORRUPTED if the
+ * data is invalid or won't fit in the buffer.
+ */
+static int apfs_lzvn_decode(const u8 *src, size_t src_len, u8 *dst, u8 **out,
+			    u8 *dst_end)
+{
+	const u8 *src_end = src + src_len;
+	size_t lit, match, dist = 0;
+	size_t op_len;
+	u8 op;
+
+	while (src < src_end) {
+		op = *src;
+		switch (apfs_lzvn_class(op)) {
+		case APFS_LZVN_SML_D:
+			op_len = 2;
+			if (unlikely(src_end - src < op_len))
+				return -EFSCORRUPTED;
+			lit = op >> 6;
+			match = ((op >> 3) & 7) + 3;
+			dist = ((op & 7) << 8) | src[1];
+			break;
+		case APFS_LZVN_MED_D:
+			op_len = 3;
+			if (unlikely(src_end - src < op_len))
+				return -EFSCORRUPTED;
+			lit = (op >> 3) & 3;
+			match = (((op & 7) << 2) | (src[1] & 3)) + 3;
+			dist = (src[1] >> 2) | (src[2] << 6);
+			break;
+		case APFS_LZVN_LRG_D:
+			op_len = 3;
+			if (unlikely(src_end - src < op_len))
+				return -EFSCORRUPTED;
+			lit = op >> 6;
+			match = ((op >> 3) & 7) + 3;
+			dist = src[1] | (src[2] << 8);
+			break;
+		case APFS_LZVN_PRE_D:
+			op_len = 1;
+			lit = op >> 6;
+			match = ((op >> 3) & 7) + 3;
+			break;
+		case APFS_LZVN_SML_L:
+			op_len = 1;
+			lit = op & 0xf;
+			match = 0;
+			break;
+		case APFS_LZVN_LRG_L:
+			op_len = 2;
+			if (unlikely(src_end - src < op_len))
+				return -EFSCORRUPTED;
+			lit = src[1] + 16;
+			match = 0;
+			break;
+		case APFS_LZVN_SML_M:
+			op_len = 1;
+			lit = 0;
+			match = op & 0xf;
+			break;
+		case APFS_LZVN_LRG_M:
+			op_len = 2;
+			if (unlikely(src_end - src < op_len))
+				return -EFSCORRUPTED;
+			lit = 0;
+			match = src[1] + 16;
+			break;
+		case APFS_LZVN_NOP:
+			src++;
+			continue;
+		case APFS_LZVN_EOS:
+			return 0;
+		default:
+			return -EFSCORRUPTED;
+		}
+
+		src += op_len;
+		if (lit) {
+			if (unlikely(src_end - src < lit))
+				return -EFSCORRUPTED;
+			if (apfs_lz_copy_literals(out, dst_end, src, lit))
+				return -EFSCORRUPTED;
+			src += lit;
+		}
+		if (match && apfs_lz_copy_match(dst, out, dst_end, dist, match))
+			return -EFSCORRUPTED;
+	}
+
+	/* The stream must be terminated by its end-of-stream opcode */
+	return -EFSCORRUPTED;
+}
+
+/**
+ * apfs_lzvn_decompress - Decompress an lzvn stream
+ * @src:	compressed data
+ * @src_len:	length of @src
+ * @dst:	buffer for the decompressed data
+ * @dst_len:	length of @dst
+ *
+ * Returns the number of bytes written to @dst, or -EFSCORRUPTED if the data
+ * is invalid or doesn't fit in the buffer.
+ */
+int apfs_lzvn_decompress(const u8 *src, size_t src_len, u8 *dst,
+			 size_t dst_len)
+{
+	u8 *out = dst;
+	int err;
+
+	err = apfs_lzvn_decode(src, src_len, dst, &out, dst + dst_len);
+	if (err)
+		return err;
+	return out - dst;
+}
+
+/*
+ * Entry of the decoding table for the fse literal stream
+ */
+struct apfs_fse_entry {
+	s8 k;			/* Number of bits to read for the next state */
+	u8 symbol;		/* Decoded symbol */
+	s16 delta;		/* Base of the next state */
+};
+
+/*
+ * Entry of the decoding table for the fse L, M and D streams; each symbol
+ * stands for a range of values, so some extra bits must be read as well.
+ */
+struct apfs_fse_value_entry {
+	u8 total_bits;		/* State bits plus extra value bits */
+	u8 value_bits;		/* Extra value bits */
+	s16 delta;		/* Base of the next state */
+	s32 vbase;		/* Base of the decoded value */
+};
+
+/*
+ * Stream of bits for fse, read backwards from the end of the payload
+ */
+struct apfs_fse_in {
+	u64 accum;		/* Bits not yet consumed */
+	int nbits;		/* Number of bits in @accum */
+	const u8 *pos;		/* Next bytes go before this position */
+	const u8 *start;	/* Start of the payload */
+};
+
+/*
+ * Decoding state for an lzfse stream, too big for the stack
+ */
+struct apfs_lzfse_state {
+	u16 l_freq[APFS_LZFSE_L_SYMBOLS];
+	u16 m_freq[APFS_LZFSE_M_SYMBOLS];
+	u16 d_freq[APFS_LZFSE_D_SYMBOLS];
+	u16 lit_freq[APFS_LZFSE_LIT_SYMBOLS];
+
+	struct apfs_fse_value_entry l_table[APFS_LZFSE_L_STATES];
+	struct apfs_fse_value_entry m_table[APFS_LZFSE_M_STATES];
+	struct apfs_fse_value_entry d_table[APFS_LZFSE_D_STATES];
+	struct apfs_fse_entry lit_table[APFS_LZFSE_LIT_STATES];
+
+	/* Literals for the current block, plus room for the last group of 4 */
+	u8 literals[APFS_LZFSE_LITERALS_PER_BLOCK + 64];
+};
+
+/* Extra bits and base values for the symbols of the L, M and D streams */
+static const u8 apfs_lzfse_l_bits[APFS_LZFSE_L_SYMBOLS] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 5, 8,
+};
+static const s32 apfs_lzfse_l_base[APFS_LZFSE_L_SYMBOLS] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 20, 28, 60,
+};
+static const u8 apfs_lzfse_m_bits[APFS_LZFSE_M_SYMBOLS] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 5, 8, 11,
+};
+static const s32 apfs_lzfse_m_base[APFS_LZFSE_M_SYMBOLS] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 24, 56, 312,
+};
+static const u8 apfs_lzfse_d_bits[APFS_LZFSE_D_SYMBOLS] = {
+	0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+	4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7,
+	8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 11,
+	12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15,
+};
+static const s32 apfs_lzfse_d_base[APFS_LZFSE_D_SYMBOLS] = {
+	0, 1, 2, 3, 4, 6, 8, 10, 12, 16, 20, 24, 28, 36, 44, 52,
+	60, 76, 92, 108, 124, 156, 188, 220,
+	252, 316, 380, 444, 508, 636, 764, 892,
+	1020, 1276, 1532, 1788, 2044, 2556, 3068, 3580,
+	4092, 5116, 6140, 7164, 8188, 10236, 12284, 14332,
+	16380, 20476, 24572, 28668, 32764, 40956, 49148, 57340,
+	65532, 81916, 98300, 114684, 131068, 163836, 196604, 229372,
+};
+
+/**
+ * apfs_fse_check_freq - Check that a frequency table adds up correctly
+ * @freq:	the frequency table
+ * @nsymbols:	number of symbols
+ * @nstates:	number of states
+ *
+ * Returns true if the frequencies add up to @nstates.  A table of zeroes is
+ * accepted too, for streams that are empty; in that case the decoding table
+ * must be zeroed so that a crafted image can't make us use its garbage.
+ */
+static bool apfs_fse_check_freq(const u16 *freq, int nsymbols, int nstates)
+{
+	int sum = 0;
+	int i;
+
+	for (i = 0; i < nsymbols; i++)
+		sum += freq[i];
+	return sum == nstates || sum == 0;
+}
+
+/**
+ * apfs_fse_init_table - Build the decoding table for the fse literal stream
+ * @nstates:	number of states
+ * @nsymbols:	number of symbols
+ * @freq:	frequency table, already checked
+ * @t:		table to fill
+ */
+static void apfs_fse_init_table(int nstates, int nsymbols, const u16 *freq,
+				struct apfs_fse_entry *t)
+{
+	int n_clz = __builtin_clz(nstates);
+	int i, j;
+
+	memset(t, 0, nstates * sizeof(*t));
+	for (i = 0; i < nsymbols; i++) {
+		int f = freq[i];
+		int k, j0;
+
+		if (!f)
+			continue;
+		/* Shift needed so that nstates <= (f << k) < 2 * nstates */
+		k = __builtin_clz(f) - n_clz;
+		j0 = ((2 * nstates) >> k) - f;
+		for (j = 0; j < f; j++, t++) {
+			t->symbol = i;
+			if (j < j0) {
+				t->k = k;
+				t->delta = ((f + j) << k) - nstates;
+			} else {
+				t->k = k - 1;
+				t->delta = (j - j0) << (k - 1);
+			}
+		}
+	}
+}
+
+/**
+ * apfs_fse_init_value_table - Build the decoding table for an fse L, M or D
+ *			       stream
+ * @nstates:	number of states
+ * @nsymbols:	number of symbols
+ * @freq:	frequency table, already checked
+ * @vbits:	number of extra value bits for each symbol
+ * @vbase:	base value for each symbol
+ * @t:		table to fill
+ */
+static void apfs_fse_init_value_table(int nstates, int nsymbols,
+				      const u16 *freq, const u8 *vbits,
+				      const s32 *vbase,
+				      struct apfs_fse_value_entry *t)
+{
+	int n_clz = __builtin_clz(nstates);
+	int i, j;
+
+	memset(t, 0, nstates * sizeof(*t));
+	for (i = 0; i < nsymbols; i++) {
+		int f = freq[i];
+		int k, j0;
+
+		if (!f)
+			continue;
+		k = __builtin_clz(f) - n_clz;
+		j0 = ((2 * nstates) >> k) - f;
+		for (j = 0; j < f; j++, t++) {
+			t->value_bits = vbits[i];
+			t->vbase = vbase[i];
+			if (j < j0) {
+				t->total_bits = k + vbits[i];
+				t->delta = ((f + j) << k) - nstates;
+			} else {
+				t->total_bits = k - 1 + vbits[i];
+				t->delta = (j - j0) << (k - 1);
+			}
+		}
+	}
+}
+
+/**
+ * apfs_fse_in_init - Start reading a stream of fse bits
+ * @in:		stream to initialize
+ * @nbits:	number of valid bits in the last byte, minus 8 (from -7 to 0)
+ * @start:	start of the payload
+ * @end:	end of the payload
+ *
+ * Returns 0 on success, or -EFSCORRUPTED if the payload is invalid.
+ */
+static int apfs_fse_in_init(struct apfs_fse_in *in, int nbits,
+			    const u8 *start, const u8 *end)
+{
+	in->start = start;
+	if (nbits) {
+		if (end - start < 8)
+			return -EFSCORRUPTED;
+		in->pos = end - 8;
+		in->accum = get_unaligned_le64(in->pos);
+		in->nbits = nbits + 64;
+	} else {
+		if (end - start < 7)
+			return -EFSCORRUPTED;
+		in->pos = end - 7;
+		in->accum = get_unaligned_le32(in->pos) |
+			    (u64)get_unaligned_le16(in->pos + 4) << 32 |
+			    (u64)in->pos[6] << 48;
+		in->nbits = 56;
+	}
+
+	if (in->nbits < 56 || in->nbits >= 64 || in->accum >> in->nbits)
+		return -EFSCORRUPTED;
+	return 0;
+}
+
+/**
+ * apfs_fse_in_flush - Refill a stream of fse bits to at least 56 bits
+ * @in: the stream
+ *
+ * Returns 0 on success, or -EFSCORRUPTED if we ran past the start of the
+ * payload.
+ */
+static inline int apfs_fse_in_flush(struct apfs_fse_in *in)
+{
+	int nbits = (63 - in->nbits) & -8;
+	const u8 *pos = in->pos - (nbits >> 3);
+	u64 incoming;
+
+	if (unlikely(pos < in->start))
+		return -EFSCORRUPTED;
+	if (!nbits)
+		return 0;
+	incoming = get_unaligned_le64(pos);
+	in->accum = (in->accum << nbits) | (incoming & ((1ULL << nbits) - 1));
+	in->nbits += nbits;
+	in->pos = pos;
+	return 0;
+}
+
+/**
+ * apfs_fse_in_pull - Take bits from a stream of fse bits
+ * @in:		the stream
+ * @nbits:	number of bits to take, no more than the stream has
+ */
+static inline u64 apfs_fse_in_pull(struct apfs_fse_in *in, int nbits)
+{
+	u64 result;
+
+	in->nbits -= nbits;
+	result = in->accum >> in->nbits;
+	in->accum &= (1ULL << in->nbits) - 1;
+	return result;
+}
+
+/**
+ * apfs_fse_decode - Decode a literal from an fse stream
+ * @state:	current state, will be updated
+ * @t:		decoding table
+ * @in:		stream of bits
+ */
+static inline u8 apfs_fse_decode(u16 *state, const struct apfs_fse_entry *t,
+				 struct apfs_fse_in *in)
+{
+	const struct apfs_fse_entry e = t[*state];
+
+	*state = e.delta + apfs_fse_in_pull(in, e.k);
+	return e.symbol;
+}
+
+/**
+ * apfs_fse_value_decode - Decode an L, M or D value from an fse stream
+ * @state:	current state, will be updated
+ * @t:		decoding table
+ * @in:		stream of bits
+ */
+static inline u32 apfs_fse_value_decode(u16 *state,
+					const struct apfs_fse_value_entry *t,
+					struct apfs_fse_in *in)
+{
+	const struct apfs_fse_value_entry e = t[*state];
+	u32 bits = apfs_fse_in_pull(in, e.total_bits);
+
+	*state = e.delta + (bits >> e.value_bits);
+	return e.vbase + (bits & ((1U << e.value_bits) - 1));
+}
+
+/**
+ * apfs_lzfse_freq_value - Decode a single value from a packed frequency table
+ * @bits:	next bits of the table
+ * @nbits:	on return, the number of bits used
+ */
+static int apfs_lzfse_freq_value(u32 bits, int *nbits)
+{
+	static const s8 nbits_table[32] = {
+		2, 3, 2, 5, 2, 3, 2, 8, 2, 3, 2, 5, 2, 3, 2, 14,
+		2, 3, 2, 5, 2, 3, 2, 8, 2, 3, 2, 5, 2, 3, 2, 14,
+	};
+	static const s8 value_table[32] = {
+		0, 2, 1, 4, 0, 3, 1, -1, 0, 2, 1, 5, 0, 3, 1, -1,
+		0, 2, 1, 6, 0, 3, 1, -1, 0, 2, 1, 7, 0, 3, 1, -1,
+	};
+	u32 b = bits & 31;
+
+	*nbits = nbits_table[b];
+	if (*nbits == 8)
+		return 8 + ((bits >> 4) & 0xf);
+	if (*nbits == 14)
+		return 24 + ((bits >> 4) & 0x3ff);
+	return value_table[b];
+}
+
+/**
+ * apfs_lzfse_read_freq - Read the packed frequency tables of a block
+ * @state:	decoding state where the tables are stored
+ * @src:	start of the packed tables
+ * @src_end:	end of the block header
+ *
+ * Returns 0 on success, or -EFSCORRUPTED if the tables are invalid.
+ */
+static int apfs_lzfse_read_freq(struct apfs_lzfse_state *state,
+				const u8 *src, const u8 *src_end)
+{
+	u16 *freq = state->l_freq;
+	u32 accum = 0;
+	int accum_nbits = 0;
+	int i, nbits;
+
+	/* The four tables are contiguous, so read them all at once */
+	BUILD_BUG_ON(offsetof(struct apfs_lzfse_state, lit_freq) !=
+		     sizeof(u16) * (APFS_LZFSE_L_SYMBOLS + APFS_LZFSE_M_SYMBOLS +
+				    APFS_LZFSE_D_SYMBOLS));
+
+	if (src == src_end) {
+		memset(freq, 0, sizeof(u16) * (APFS_LZFSE_L_SYMBOLS +
+		       APFS_LZFSE_M_SYMBOLS + APFS_LZFSE_D_SYMBOLS +
+		       APFS_LZFSE_LIT_SYMBOLS));
+		return 0;
+	}
+
+	for (i = 0; i < APFS_LZFSE_L_SYMBOLS + APFS_LZFSE_M_SYMBOLS +
+			APFS_LZFSE_D_SYMBOLS + APFS_LZFSE_LIT_SYMBOLS; i++) {
+		while (src < src_end && accum_nbits + 8 <= 32) {
+			accum |= (u32)*src << accum_nbits;
+			accum_nbits += 8;
+			src++;
+		}
+		freq[i] = apfs_lzfse_freq_value(accum, &nbits);
+		if (nbits > accum_nbits)
+			return -EFSCORRUPTED;
+		accum >>= nbits;
+		accum_nbits -= nbits;
+	}
+
+	if (accum_nbits >= 8 || src != src_end)
+		return -EFSCORRUPTED;
+	return 0;
+}
+
+/* Extract a field from the packed header of a compressed block */
+static inline u32 apfs_lzfse_field(u64 packed, int off, int nbits)
+{
+	return (packed >> off) & ((1ULL << nbits) - 1);
+}
+
+/**
+ * apfs_lzfse_decode_v2 - Decode a compressed block from an lzfse stream
+ * @state:	decoding state
+ * @src:	start of the block
+ * @src_end:	end of the compressed data
+ * @dst:	start of the output buffer, for the match distances
+ * @out:	position where the output starts, will be updated
+ * @dst_end:	end of the output buffer
+ *
+ * Returns the length of the block on success, or -EFSCORRUPTED if the data is
+ * invalid or doesn't fit in the buffer.
+ */
+static int apfs_lzfse_decode_v2(struct apfs_lzfse_state *state,
+				const u8 *src, const u8 *src_end,
+				u8 *dst, u8 **out, u8 *dst_end)
+{
+	const struct apfs_lzfse_v2_hdr *hdr = (void *)src;
+	struct apfs_fse_in in;
+	u64 v0, v1, v2;
+	u32 n_raw, n_lit, n_lit_bytes, n_matches, n_lmd_bytes, hdr_size;
+	int lit_bits, lmd_bits;
+	u16 lit_state[4], l_state, m_state, d_state;
+	const u8 *lit_start, *lmd_start, *lmd_end;
+	const u8 *lit, *lit_end;
+	u8 *block_end;
+	u32 i, dist = 0;
+	int err;
+
+	if (src_end - src < sizeof(*hdr))
+		return -EFSCORRUPTED;
+	n_raw = le32_to_cpu(hdr->n_raw_bytes);
+	v0 = le64_to_cpu(hdr->packed_fields[0]);
+	v1 = le64_to_cpu(hdr->packed_fields[1]);
+	v2 = le64_to_cpu(hdr->packed_fields[2]);
+
+	n_lit = apfs_lzfse_field(v0, 0, 20);
+	n_lit_bytes = apfs_lzfse_field(v0, 20, 20);
+	n_matches = apfs_lzfse_field(v0, 40, 20);
+	lit_bits = (int)apfs_lzfse_field(v0, 60, 3) - 7;
+	for (i = 0; i < 4; i++)
+		lit_state[i] = apfs_lzfse_field(v1, 10 * i, 10);
+	n_lmd_bytes = apfs_lzfse_field(v1, 40, 20);
+	lmd_bits = (int)apfs_lzfse_field(v1, 60, 3) - 7;
+	hdr_size = apfs_lzfse_field(v2, 0, 32);
+	l_state = apfs_lzfse_field(v2, 32, 10);
+	m_state = apfs_lzfse_field(v2, 42, 10);
+	d_state = apfs_lzfse_field(v2, 52, 10);
+
+	if (n_lit > APFS_LZFSE_LITERALS_PER_BLOCK ||
+	    n_matches > APFS_LZFSE_MATCHES_PER_BLOCK)
+		return -EFSCORRUPTED;
+	if (l_state >= APFS_LZFSE_L_STATES || m_state >= APFS_LZFSE_M_STATES ||
+	    d_state >= APFS_LZFSE_D_STATES)
+		return -EFSCORRUPTED;
+	/* The literal states are 10 bits long, so they are always in range */
+	BUILD_BUG_ON(APFS_LZFSE_LIT_STATES != 1 << 10);
+
+	if (hdr_size < sizeof(*hdr) || hdr_size > src_end - src)
+		return -EFSCORRUPTED;
+	lit_start = src + hdr_size;
+	if (n_lit_bytes > src_end - lit_start)
+		return -EFSCORRUPTED;
+	lmd_start = lit_start + n_lit_bytes;
+	if (n_lmd_bytes > src_end - lmd_start)
+		return -EFSCORRUPTED;
+	lmd_end = lmd_start + n_lmd_bytes;
+	if (n_raw > dst_end - *out)
+		return -EFSCORRUPTED;
+	block_end = *out + n_raw;
+
+	err = apfs_lzfse_read_freq(state, hdr->freq, lit_start);
+	if (err)
+		return err;
+	if (!apfs_fse_check_freq(state->l_freq, APFS_LZFSE_L_SYMBOLS,
+				 APFS_LZFSE_L_STATES) ||
+	    !apfs_fse_check_freq(state->m_freq, APFS_LZFSE_M_SYMBOLS,
+				 APFS_LZFSE_M_STATES) ||
+	    !apfs_fse_check_freq(state->d_freq, APFS_LZFSE_D_SYMBOLS,
+				 APFS_LZFSE_D_STATES) ||
+	    !apfs_fse_check_freq(state->lit_freq, APFS_LZFSE_LIT_SYMBOLS,
+				 APFS_LZFSE_LIT_STATES))
+		return -EFSCORRUPTED;
+	apfs_fse_init_value_table(APFS_LZFSE_L_STATES, APFS_LZFSE_L_SYMBOLS,
+				  state->l_freq, apfs_lzfse_l_bits,
+				  apfs_lzfse_l_base, state->l_table);
+	apfs_fse_init_value_table(APFS_LZFSE_M_STATES, APFS_LZFSE_M_SYMBOLS,
+				  state->m_freq, apfs_lzfse_m_bits,
+				  apfs_lzfse_m_base, state->m_table);
+	apfs_fse_init_value_table(APFS_LZFSE_D_STATES, APFS_LZFSE_D_SYMBOLS,
+				  state->d_freq, apfs_lzfse_d_bits,
+				  apfs_lzfse_d_base, state->d_table);
+	apfs_fse_init_table(APFS_LZFSE_LIT_STATES, APFS_LZFSE_LIT_SYMBOLS,
+			    state->lit_freq, state->lit_table);
+
+	/*
+	 * The literals come first, as four interleaved streams.  Each decode
+	 * takes at most 10 bits, so a single flush is enough for a group.
+	 */
+	err = apfs_fse_in_init(&in, lit_bits, lit_start, lmd_start);
+	if (err)
+		return err;
+	for (i = 0; i < n_lit; i += 4) {
+		if (apfs_fse_in_flush(&in))
+			return -EFSCORRUPTED;
+		state->literals[i + 0] = apfs_fse_decode(&lit_state[0],
+							 state->lit_table, &in);
+		state->literals[i + 1] = apfs_fse_decode(&lit_state[1],
+							 state->lit_table, &in);
+		state->literals[i + 2] = apfs_fse_decode(&lit_state[2],
+							 state->lit_table, &in);
+		state->literals[i + 3] = apfs_fse_decode(&lit_state[3],
+							 state->lit_table, &in);
+	}
+	lit = state->literals;
+	lit_end = lit + n_lit;
+
+	/*
+	 * Then the (literal length, match length, distance) triples.  They
+	 * take at most 14 + 17 + 23 bits, so again a single flush will do.
+	 */
+	err = apfs_fse_in_init(&in, lmd_bits, lmd_start, lmd_end);
+	if (err)
+		return err;
+	for (i = 0; i < n_matches; i++) {
+		u32 l, m, d;
+
+		if (apfs_fse_in_flush(&in))
+			return -EFSCORRUPTED;
+		l = apfs_fse_value_decode(&l_state, state->l_table, &in);
+		m = apfs_fse_value_decode(&m_state, state->m_table, &in);
+		d = apfs_fse_value_decode(&d_state, state->d_table, &in);
+		if (d) /* A zero distance repeats the previous one */
+			dist = d;
+
+		if (unlikely(l > lit_end - lit))
+			return -EFSCORRUPTED;
+		if (apfs_lz_copy_literals(out, block_end, lit, l))
+			return -EFSCORRUPTED;
+		lit += l;
+		if (m && apfs_lz_copy_match(dst, out, block_end, dist, m))
+			return -EFSCORRUPTED;
+	}
+
+	if (*out != block_end)
+		return -EFSCORRUPTED;
+	return lmd_end - src;
+}
+
+/**
+ * apfs_lzfse_workspace_size - Size of the workspace for the lzfse decoder
+ */
+size_t apfs_lzfse_workspace_size(void)
+{
+	return sizeof(struct apfs_lzfse_state);
+}
+
+/**
+ * apfs_lzfse_decompress - Decompress an lzfse stream
+ * @workspace:	at least apfs_lzfse_workspace_size() bytes for the decoder
+ * @src:	compressed data
+ * @src_len:	length of @src
+ * @dst:	buffer for the decompressed data
+ * @dst_len:	length of @dst
+ *
+ * Returns the number of bytes written to @dst, or a negative error code in
+ * case of failure, which will be -EFSCORRUPTED if the data is invalid or
+ * doesn't fit in the buffer.
+ */
+int apfs_lzfse_decompress(void *workspace, const u8 *src, size_t src_len,
+			  u8 *dst, size_t dst_len)
+{
+	const u8 *src_end = src + src_len;
+	u8 *out = dst, *dst_end = dst + dst_len;
+	struct apfs_lzfse_state *state = workspace;
+	int ret;
+
+	while (1) {
+		const struct apfs_lzfse_lzvn_hdr *lzvn_hdr;
+		const struct apfs_lzfse_raw_hdr *raw_hdr;
+		u32 n_raw, n_payload;
+		u8 *block_end;
+
+		if (src_end - src < sizeof(__le32))
+			return -EFSCORRUPTED;
+
+		switch (get_unaligned_le32(src)) {
+		case APFS_LZFSE_MAGIC_END:
+			return out - dst;
+		case APFS_LZFSE_MAGIC_RAW:
+			raw_hdr = (void *)src;
+			if (src_end - src < sizeof(*raw_hdr))
+				return -EFSCORRUPTED;
+			src += sizeof(*raw_hdr);
+			n_raw = le32_to_cpu(raw_hdr->n_raw_bytes);
+			if (n_raw > src_end - src ||
+			    apfs_lz_copy_literals(&out, dst_end, src, n_raw))
+				return -EFSCORRUPTED;
+			src += n_raw;
+			break;
+		case APFS_LZFSE_MAGIC_LZVN:
+			lzvn_hdr = (void *)src;
+			if (src_end - src < sizeof(*lzvn_hdr))
+				return -EFSCORRUPTED;
+			src += sizeof(*lzvn_hdr);
+			n_raw = le32_to_cpu(lzvn_hdr->n_raw_bytes);
+			n_payload = le32_to_cpu(lzvn_hdr->n_payload_bytes);
+			if (n_payload > src_end - src || n_raw > dst_end - out)
+				return -EFSCORRUPTED;
+			block_end = out + n_raw;
+			ret = apfs_lzvn_decode(src, n_payload, dst, &out,
+					       block_end);
+			if (ret)
+				return ret;
+			if (out != block_end)
+				return -EFSCORRUPTED;
+			src += n_payload;
+			break;
+		case APFS_LZFSE_MAGIC_V2:
+			ret = apfs_lzfse_decode_v2(state, src, src_end, dst,
+						   &out, dst_end);
+			if (ret < 0)
+				return ret;
+			src += ret;
+			break;
+		default:
+			/* Uncompressed v1 headers are never written in practice */
+			return -EFSCORRUPTED;
+		}
+	}
+}
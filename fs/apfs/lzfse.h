@@ -0,0 +1,67 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/lzfse.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_LZFSE_H
+#define _APFS_LZFSE_H
+
+#include <linux/types.h>
+
+/* Block magic numbers for lzfse streams */
+#define APFS_LZFSE_MAGIC_END	0x24787662	/* "bvx$" */
+#define APFS_LZFSE_MAGIC_RAW	0x2d787662	/* "bvx-" */
+#define APFS_LZFSE_MAGIC_V1	0x31787662	/* "bvx1" */
+#define APFS_LZFSE_MAGIC_V2	0x32787662	/* "bvx2" */
+#define APFS_LZFSE_MAGIC_LZVN	0x6e787662	/* "bvxn" */
+
+/* Limits on the contents of a single compressed block */
+#define APFS_LZFSE_MATCHES_PER_BLOCK	10000
+#define APFS_LZFSE_LITERALS_PER_BLOCK	(4 * APFS_LZFSE_MATCHES_PER_BLOCK)
+
+/* Number of symbols and states for each of the fse streams */
+#define APFS_LZFSE_L_SYMBOLS		20
+#define APFS_LZFSE_M_SYMBOLS		20
+#define APFS_LZFSE_D_SYMBOLS		64
+#define APFS_LZFSE_LIT_SYMBOLS		256
+#define APFS_LZFSE_L_STATES		64
+#define APFS_LZFSE_M_STATES		64
+#define APFS_LZFSE_D_STATES		256
+#define APFS_LZFSE_LIT_STATES		1024
+
+/*
+ * Header of a compressed block with packed fields and frequency tables
+ */
+struct apfs_lzfse_v2_hdr {
+	__le32 magic;
+	__le32 n_raw_bytes;
+	__le64 packed_fields[3];
+	u8 freq[];
+} __packed;
+
+/*
+ * Header of a block of lzvn data inside an lzfse stream
+ */
+struct apfs_lzfse_lzvn_hdr {
+	__le32 magic;
+	__le32 n_raw_bytes;
+	__le32 n_payload_bytes;
+} __packed;
+
+/*
+ * Header of a block of uncompressed data inside an lzfse stream
+ */
+struct apfs_lzfse_raw_hdr {
+	__le32 magic;
+	__le32 n_raw_bytes;
+} __packed;
+
+extern int apfs_lzvn_decompress(const u8 *src, size_t src_len, u8 *dst,
+				size_t dst_len);
+extern size_t apfs_lzfse_workspace_size(void);
+extern int apfs_lzfse_decompress(void *workspace, const u8 *src,
+				 size_t src_len, u8 *dst, size_t dst_len);
+
+#endif	/* _APFS_LZFSE_H */
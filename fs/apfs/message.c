@@ -5,14 +5,66 @@
  * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
  */
 
+#include <linux/atomic.h>
 #include <linux/fs.h>
+#include <linux/printk.h>
+#include <linux/ratelimit.h>
+#include "apfs.h"
 #include "message.h"
+#include "super.h"
+
+/**
+ * apfs_msg_init - Set up the rate limit for the messages of a mount
+ * @sbi:	in-memory superblock info, just allocated
+ */
+void apfs_msg_init(struct apfs_sb_info *sbi)
+{
+	/* The count of suppressed messages is reported by apfs_msg() instead */
+	ratelimit_state_init(&sbi->s_msg_ratelimit, DEFAULT_RATELIMIT_INTERVAL,
+			     DEFAULT_RATELIMIT_BURST);
+	ratelimit_set_flags(&sbi->s_msg_ratelimit, RATELIMIT_MSG_ON_RELEASE);
+	atomic64_set(&sbi->s_msg_suppressed, 0);
+	atomic_set(&sbi->s_msg_missed, 0);
+}
+
+/**
+ * apfs_msg_allowed - Check the rate limit for a message
+ * @sb:		filesystem superblock
+ * @prefix:	log level of the message
+ *
+ * Errors are usually reported once for each bad record, so a damaged image
+ * could otherwise flood the console and keep every cpu waiting on printk.
+ * Only errors and worse are limited, so as not to hide the informational
+ * messages of the mount.  Returns true if the message should be printed.
+ */
+static bool apfs_msg_allowed(struct super_block *sb, const char *prefix)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	int missed;
+
+	if (!sbi || printk_get_level(prefix) > KERN_ERR[1])
+		return true;
+	if (!__ratelimit(&sbi->s_msg_ratelimit)) {
+		atomic64_inc(&sbi->s_msg_suppressed);
+		atomic_inc(&sbi->s_msg_missed);
+		return false;
+	}
+
+	missed = atomic_xchg(&sbi->s_msg_missed, 0);
+	if (missed)
+		printk("%sAPFS (%s): %d error messages suppressed\n",
+		       KERN_WARNING, sb->s_id, missed);
+	return true;
+}
 
 void apfs_msg(struct super_block *sb, const char *prefix, const char *fmt, ...)
 {
 	struct va_format vaf;
 	va_list args;
 
+	if (!apfs_msg_allowed(sb, prefix))
+		return;
+
 	va_start(args, fmt);
 
 	vaf.fmt = fmt;
@@ -8,8 +8,10 @@
 #ifndef _APFS_MESSAGE_H
 #define _APFS_MESSAGE_H
 
+struct apfs_sb_info;
 struct super_block;
 
+extern void apfs_msg_init(struct apfs_sb_info *sbi);
 extern __printf(3, 4)
 void apfs_msg(struct super_block *sb, const char *prefix, const char *fmt, ...);
 
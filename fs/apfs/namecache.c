@@ -0,0 +1,258 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/namecache.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ *
+ * Paths of inodes from their numbers, for tools that get cnids from fanotify
+ * or file handles.  Each step to the root needs the parent and the name of an
+ * inode, which would take an iget and maybe a scan of the parent directory;
+ * the name cache remembers them from the lookups and the directory scans, so
+ * that the steps it knows cost no catalog queries at all.
+ */
+
+#include <linux/fs.h>
+#include <linux/hash.h>
+#include <linux/log2.h>
+#include <linux/mm.h>
+#include <linux/sched/signal.h>
+#include <linux/slab.h>
+#include <linux/uaccess.h>
+#include "apfs.h"
+#include "dir.h"
+#include "inode.h"
+#include "ioctl.h"
+#include "namecache.h"
+#include "super.h"
+
+/**
+ * apfs_name_cache_init - Allocate the name cache for a new mount
+ * @sb:		filesystem superblock
+ *
+ * The size of the cache is rounded up to a power of two; a size of zero
+ * disables it.  Returns 0 on success or -ENOMEM in case of failure.
+ */
+int apfs_name_cache_init(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_name_cache *cache = &sbi->s_name_cache;
+	unsigned long size = sbi->s_name_cache_size;
+
+	spin_lock_init(&cache->lock);
+	cache->entries = NULL;
+	cache->bits = 0;
+	if (!size)
+		return 0;
+
+	cache->bits = max_t(unsigned int, order_base_2(size), 1);
+	cache->entries = kvcalloc(1UL << cache->bits, sizeof(*cache->entries),
+				  GFP_KERNEL | __GFP_ACCOUNT);
+	if (!cache->entries)
+		return -ENOMEM;
+	return 0;
+}
+
+/**
+ * apfs_name_cache_destroy - Free the name cache
+ * @sb:		filesystem superblock
+ */
+void apfs_name_cache_destroy(struct super_block *sb)
+{
+	struct apfs_name_cache *cache = &APFS_SB(sb)->s_name_cache;
+
+	kvfree(cache->entries);
+	cache->entries = NULL;
+}
+
+/**
+ * apfs_name_cache_slot - Find the cache slot for an inode
+ * @cache:	the name cache, locked
+ * @cnid:	inode number
+ */
+static inline struct apfs_name_cache_entry *
+apfs_name_cache_slot(struct apfs_name_cache *cache, u64 cnid)
+{
+	return &cache->entries[hash_64(cnid, cache->bits)];
+}
+
+/**
+ * apfs_name_cache_insert - Remember the parent and name of an inode
+ * @sb:		filesystem superblock
+ * @cnid:	inode number
+ * @parent:	inode number of the parent directory
+ * @name:	name of the inode in @parent, not null-terminated
+ * @len:	length of @name
+ */
+void apfs_name_cache_insert(struct super_block *sb, u64 cnid, u64 parent,
+			    const char *name, unsigned int len)
+{
+	struct apfs_name_cache *cache = &APFS_SB(sb)->s_name_cache;
+	struct apfs_name_cache_entry *entry;
+
+	if (!cache->entries || len > APFS_NAME_CACHE_NAME_LEN)
+		return;
+
+	spin_lock(&cache->lock);
+	entry = apfs_name_cache_slot(cache, cnid);
+	entry->cnid = cnid;
+	entry->parent = parent;
+	entry->len = len;
+	memcpy(entry->name, name, len);
+	spin_unlock(&cache->lock);
+}
+
+/**
+ * apfs_name_cache_lookup - Look up the parent and name of an inode
+ * @sb:		filesystem superblock
+ * @cnid:	inode number
+ * @parent:	on return, inode number of the parent directory
+ * @name:	on return, the name, not null-terminated
+ *
+ * Returns the length of the name on a cache hit, or -1 on a miss.
+ */
+static int apfs_name_cache_lookup(struct super_block *sb, u64 cnid,
+				  u64 *parent, char *name)
+{
+	struct apfs_name_cache *cache = &APFS_SB(sb)->s_name_cache;
+	struct apfs_name_cache_entry *entry;
+	int len = -1;
+
+	if (!cache->entries)
+		return -1;
+
+	spin_lock(&cache->lock);
+	entry = apfs_name_cache_slot(cache, cnid);
+	if (entry->cnid == cnid) {
+		*parent = entry->parent;
+		len = entry->len;
+		memcpy(name, entry->name, len);
+	}
+	spin_unlock(&cache->lock);
+	return len;
+}
+
+/**
+ * apfs_ino_path_step - Find the parent and name of an inode without the cache
+ * @sb:		filesystem superblock
+ * @cnid:	inode number
+ * @parent:	on return, inode number of the parent directory
+ * @name:	buffer of NAME_MAX + 1 bytes for the null-terminated name
+ *
+ * The inode record has the name of the primary link, which is reliable for
+ * a directory or a file with no other links.  For the others the parent gets
+ * scanned, the same as for nfs.  Returns the length of the name on success,
+ * or a negative error code in case of failure.
+ */
+static int apfs_ino_path_step(struct super_block *sb, u64 cnid, u64 *parent,
+			      char *name)
+{
+	struct inode *inode, *dir;
+	const char *iname;
+	int err;
+
+	inode = apfs_iget(sb, cnid);
+	if (IS_ERR(inode))
+		return PTR_ERR(inode);
+	*parent = APFS_I(inode)->i_parent_id;
+
+	iname = APFS_I(inode)->i_name;
+	if (iname && (S_ISDIR(inode->i_mode) || inode->i_nlink <= 1) &&
+	    strlen(iname) <= NAME_MAX) {
+		strcpy(name, iname);
+		err = strlen(name);
+		goto out;
+	}
+
+	dir = apfs_iget(sb, *parent);
+	if (IS_ERR(dir)) {
+		err = PTR_ERR(dir);
+		goto out;
+	}
+	err = apfs_dir_get_name(dir, cnid, name);
+	if (!err)
+		err = strlen(name);
+	iput(dir);
+out:
+	iput(inode);
+	return err;
+}
+
+/**
+ * apfs_ino_path - Put together the path of an inode, for APFS_IOC_INO_PATH
+ * @sb:		filesystem superblock
+ * @req:	the request, with its fields updated on return
+ * @buf:	user buffer for the path
+ *
+ * The path is built backwards from the inode, one step at a time; every step
+ * that misses the name cache gets added to it, so that the paths of nearby
+ * inodes are quick to find later.  Returns 0 on success, or a negative error
+ * code in case of failure.
+ */
+int apfs_ino_path(struct super_block *sb, struct apfs_ino_path_req *req,
+		  char __user *buf)
+{
+	char name[NAME_MAX + 1];
+	char *path, *p;
+	u64 cnid = req->ip_ino, parent = 0;
+	int len, err = 0;
+
+	req->ip_hops = req->ip_cached = 0;
+	path = kmalloc(PATH_MAX, GFP_KERNEL);
+	if (!path)
+		return -ENOMEM;
+	p = path + PATH_MAX - 1;
+	*p = 0;
+
+	while (cnid != APFS_ROOT_DIR_INO_NUM) {
+		/* The private directory and its files are out of the tree */
+		if (cnid == APFS_ROOT_DIR_PARENT) {
+			err = -ENOENT;
+			goto out;
+		}
+		if (req->ip_hops == APFS_INO_PATH_MAX_HOPS) {
+			err = -ELOOP;
+			goto out;
+		}
+		if (fatal_signal_pending(current)) {
+			err = -EINTR;
+			goto out;
+		}
+
+		len = apfs_name_cache_lookup(sb, cnid, &parent, name);
+		if (len >= 0) {
+			req->ip_cached++;
+		} else if (req->ip_flags & APFS_INO_PATH_CACHED) {
+			err = -EAGAIN;
+			goto out;
+		} else {
+			len = apfs_ino_path_step(sb, cnid, &parent, name);
+			if (len < 0) {
+				err = len;
+				goto out;
+			}
+			apfs_name_cache_insert(sb, cnid, parent, name, len);
+		}
+		req->ip_hops++;
+
+		if (p - path < len + 1) {
+			err = -ENAMETOOLONG;
+			goto out;
+		}
+		p -= len;
+		memcpy(p, name, len);
+		*--p = '/';
+		cnid = parent;
+	}
+	if (!*p) /* The root itself */
+		*--p = '/';
+
+	len = path + PATH_MAX - p;
+	if (len > req->ip_size)
+		err = -ERANGE;
+	else if (copy_to_user(buf, p, len))
+		err = -EFAULT;
+	req->ip_size = len;
+out:
+	kfree(path);
+	return err;
+}
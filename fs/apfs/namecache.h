@@ -0,0 +1,59 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/namecache.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_NAMECACHE_H
+#define _APFS_NAMECACHE_H
+
+#include <linux/limits.h>
+#include <linux/spinlock.h>
+#include <linux/types.h>
+
+struct apfs_ino_path_req;
+struct super_block;
+
+/* Number of entries for the name cache, disabled by default */
+#define APFS_NAME_CACHE_DEFAULT_SIZE	0
+#define APFS_NAME_CACHE_MAX_SIZE	(1 << 20)
+
+/* Longest name kept in the cache, so that an entry fills 64 bytes */
+#define APFS_NAME_CACHE_NAME_LEN	47
+
+/* Most hops from an inode to the root, to be safe from loops */
+#define APFS_INO_PATH_MAX_HOPS		(PATH_MAX / 2)
+
+/*
+ * Entry in the name cache
+ */
+struct apfs_name_cache_entry {
+	u64 cnid;			/* Inode number (0 if unused) */
+	u64 parent;			/* Inode number of the parent */
+	u8 len;				/* Length of the name */
+	char name[APFS_NAME_CACHE_NAME_LEN]; /* Not null-terminated */
+};
+
+/*
+ * Direct-mapped cache of the parent and name of the inodes seen by lookups
+ * and readdir, so that the path of an inode can be put together with no
+ * catalog queries.  A colliding insertion just replaces the previous entry,
+ * and names that don't fit are not cached.  An inode with hard links may have
+ * any of them cached; each one is a valid path.
+ */
+struct apfs_name_cache {
+	spinlock_t lock;		/* Protects the other fields */
+	struct apfs_name_cache_entry *entries; /* NULL if disabled */
+	unsigned int bits;		/* Log2 of the number of entries */
+};
+
+extern int apfs_name_cache_init(struct super_block *sb);
+extern void apfs_name_cache_destroy(struct super_block *sb);
+extern void apfs_name_cache_insert(struct super_block *sb, u64 cnid,
+				   u64 parent, const char *name,
+				   unsigned int len);
+extern int apfs_ino_path(struct super_block *sb, struct apfs_ino_path_req *req,
+			 char __user *buf);
+
+#endif	/* _APFS_NAMECACHE_H */
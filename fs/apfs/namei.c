@@ -5,25 +5,62 @@
  * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
  */
 
+#include <linux/hash.h>
+#include <linux/rcupdate.h>
+#include <linux/slab.h>
 #include "apfs.h"
 #include "dir.h"
 #include "inode.h"
 #include "key.h"
+#include "namecache.h"
+#include "snapdir.h"
 #include "super.h"
+#include "trace.h"
 #include "unicode.h"
+#include "vgroup.h"
 #include "xattr.h"
 
+/*
+ * Normalized (and case folded) name of a dentry, kept in its d_fsdata so that
+ * d_compare only has to normalize the name it's given
+ */
+struct apfs_dname {
+	struct rcu_head rcu;	/* Path walk may still be reading it */
+	unsigned int len;	/* Number of characters in @chars */
+	unicode_t chars[];
+};
+
+/**
+ * apfs_dentry_salt - Get the value mixed into the hashes of a dentry's children
+ * @parent: the parent dentry
+ *
+ * The dcache hash of a name is its catalog hash xor'ed with this value, so
+ * that the catalog hash can be recovered without normalizing the name again.
+ * Mixing in the parent keeps the children of each directory in their own
+ * hash chains, like init_name_hash() does.
+ */
+static inline u32 apfs_dentry_salt(const struct dentry *parent)
+{
+	return hash_ptr((void *)parent, 32);
+}
+
 static struct dentry *apfs_lookup(struct inode *dir, struct dentry *dentry,
 				  unsigned int flags)
 {
 	struct inode *inode = NULL;
 	u64 ino = 0;
+	u32 hash;
 	int err;
 
 	if (dentry->d_name.len > APFS_NAME_LEN)
 		return ERR_PTR(-ENAMETOOLONG);
+	if (apfs_is_snapdir(dir, &dentry->d_name))
+		return apfs_snapdir_lookup_root(dir, dentry);
 
-	err = apfs_inode_by_name(dir, &dentry->d_name, &ino);
+	/* The name went through apfs_dentry_hash() already */
+	hash = dentry->d_name.hash ^ apfs_dentry_salt(dentry->d_parent);
+	err = apfs_inode_by_name(dir, &dentry->d_name, hash, &ino);
+	trace_apfs_lookup(dir, &dentry->d_name, ino, err);
 	if (err && err != -ENODATA)
 		return ERR_PTR(err);
 
@@ -31,6 +68,10 @@ static struct dentry *apfs_lookup(struct inode *dir, struct dentry *dentry,
 		inode = apfs_iget(dir->i_sb, ino);
 		if (IS_ERR(inode))
 			return ERR_CAST(inode);
+		apfs_name_cache_insert(dir->i_sb, ino, apfs_ino(dir),
+				       dentry->d_name.name,
+				       dentry->d_name.len);
+		apfs_firmlink_set_dentry(dentry, inode);
 	}
 
 	return d_splice_alias(inode, dentry);
@@ -49,40 +90,125 @@ const struct inode_operations apfs_special_inode_operations = {
 
 static int apfs_dentry_hash(const struct dentry *dir, struct qstr *child)
 {
-	struct apfs_unicursor cursor;
-	unsigned long hash;
-	bool case_fold = apfs_is_case_insensitive(dir->d_sb);
+	char name[APFS_NAME_LEN + 1];
+
+	if (child->len > APFS_NAME_LEN)
+		return -ENAMETOOLONG;
+	/* Path components are not null-terminated, unicode.c needs that */
+	memcpy(name, child->name, child->len);
+	name[child->len] = 0;
+
+	/*
+	 * The catalog hash is a crc32c of the normalized name, so it's as good
+	 * as any for the dcache.  Computing it here saves the lookup another
+	 * normalization pass over the name.
+	 */
+	child->hash = apfs_filename_hash(dir->d_sb, name) ^
+		      apfs_dentry_salt(dir);
 
-	apfs_init_unicursor(&cursor, child->name);
-	hash = init_name_hash(dir);
-
-	while (1) {
-		int i;
-		unicode_t utf32;
+	/* TODO: return error instead of truncating invalid UTF-8? */
+	return 0;
+}
 
-		utf32 = apfs_normalize_next(&cursor, case_fold);
-		if (!utf32)
-			break;
+/**
+ * apfs_dname_match - Check if a name matches the cached name of a dentry
+ * @sb:		filesystem superblock
+ * @dname:	normalized name of the dentry
+ * @name:	null-terminated name to check
+ *
+ * Only @name is normalized, and the walk stops at the first difference.
+ */
+static bool apfs_dname_match(struct super_block *sb,
+			     const struct apfs_dname *dname, const char *name)
+{
+	bool case_fold = apfs_is_case_insensitive(sb);
+	struct apfs_unicursor cursor;
+	unsigned int i;
 
-		/* Hash the unicode character one byte at a time */
-		for (i = 0; i < 4; ++i) {
-			hash = partial_name_hash((u8)utf32, hash);
-			utf32 = utf32 >> 8;
-		}
+	apfs_init_unicursor(&cursor, name);
+	for (i = 0; i < dname->len; i++) {
+		if (apfs_normalize_next(&cursor, case_fold) != dname->chars[i])
+			return false;
 	}
-	child->hash = end_name_hash(hash);
-
-	/* TODO: return error instead of truncating invalid UTF-8? */
-	return 0;
+	return !apfs_normalize_next(&cursor, case_fold);
 }
 
 static int apfs_dentry_compare(const struct dentry *dentry, unsigned int len,
 			       const char *str, const struct qstr *name)
 {
-	return apfs_filename_cmp(dentry->d_sb, name->name, str);
+	const struct apfs_dname *dname;
+	char buf[APFS_NAME_LEN + 1];
+
+	if (len == name->len && !memcmp(str, name->name, len))
+		return 0;
+	if (name->len > APFS_NAME_LEN)
+		return 1;
+	memcpy(buf, name->name, name->len);
+	buf[name->len] = 0;
+
+	/* This may run under rcu-walk, so it must not allocate */
+	dname = READ_ONCE(dentry->d_fsdata);
+	if (dname)
+		return !apfs_dname_match(dentry->d_sb, dname, buf);
+	return apfs_filename_cmp(dentry->d_sb, buf, str);
+}
+
+/**
+ * apfs_dentry_init - Cache the normalized name of a new dentry
+ * @dentry:	the dentry
+ *
+ * The names of dentries never change on a read-only mount, so they can be
+ * normalized once here.  If that fails, d_compare just normalizes both names
+ * every time, so the dentry is still usable.
+ */
+static int apfs_dentry_init(struct dentry *dentry)
+{
+	bool case_fold = apfs_is_case_insensitive(dentry->d_sb);
+	struct apfs_dname *dname;
+	struct apfs_nname nname;
+
+	if (apfs_normalize_name(dentry->d_name.name, case_fold, &nname))
+		goto out;
+	dname = kmalloc(struct_size(dname, chars, nname.len), GFP_KERNEL);
+	if (!dname)
+		goto out;
+	dname->len = nname.len;
+	memcpy(dname->chars, nname.chars, nname.len * sizeof(*nname.chars));
+	dentry->d_fsdata = dname;
+out:
+	apfs_nname_free(&nname);
+	return 0;
+}
+
+static void apfs_dentry_release(struct dentry *dentry)
+{
+	struct apfs_dname *dname = dentry->d_fsdata;
+
+	if (dname)
+		kfree_rcu(dname, rcu);
 }
 
 const struct dentry_operations apfs_dentry_operations = {
 	.d_hash		= apfs_dentry_hash,
 	.d_compare	= apfs_dentry_compare,
+	.d_init		= apfs_dentry_init,
+	.d_release	= apfs_dentry_release,
+};
+
+/* Directories of a system volume that lead into the data volume */
+const struct dentry_operations apfs_firmlink_dentry_operations = {
+	.d_hash		= apfs_dentry_hash,
+	.d_compare	= apfs_dentry_compare,
+	.d_init		= apfs_dentry_init,
+	.d_release	= apfs_dentry_release,
+	.d_automount	= apfs_firmlink_automount,
+};
+
+/* Entries of the snapshot directory, for the snapdir mount option */
+const struct dentry_operations apfs_snapshot_dentry_operations = {
+	.d_hash		= apfs_dentry_hash,
+	.d_compare	= apfs_dentry_compare,
+	.d_init		= apfs_dentry_init,
+	.d_release	= apfs_dentry_release,
+	.d_automount	= apfs_snapshot_automount,
 };
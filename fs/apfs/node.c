@@ -7,23 +7,109 @@
 
 #include <linux/slab.h>
 #include <linux/buffer_head.h>
+#include <linux/hash.h>
+#include <linux/jiffies.h>
+#include <linux/ktime.h>
+#include <linux/mm.h>
+#include <linux/prefetch.h>
 #include "apfs.h"
 #include "btree.h"
+#include "crypto.h"
 #include "key.h"
 #include "message.h"
 #include "node.h"
 #include "object.h"
+#include "stats.h"
 #include "super.h"
+#include "trace.h"
+
+/**
+ * __apfs_node_locate_key - Locate the key of a node record, without checks
+ * @node:	the node
+ * @index:	number of the entry to locate, below @node->records
+ * @off:	on return will hold the offset in the block
+ *
+ * Returns the length of the key.  The bounds of every entry are checked once,
+ * by apfs_node_is_valid(), before the node can be used.
+ */
+static __always_inline int __apfs_node_locate_key(struct apfs_node *node,
+						  int index, int *off)
+{
+	struct apfs_btree_node_phys *raw;
+
+	raw = (struct apfs_btree_node_phys *)node->object.data;
+	if (apfs_node_has_fixed_kv_size(node)) {
+		struct apfs_kvoff *entry;
+
+		entry = (struct apfs_kvoff *)raw->btn_data + index;
+		/* Translate offset in key area to offset in block */
+		*off = node->key + le16_to_cpu(entry->k);
+		return 16;
+	} else {
+		/* These node types have variable length keys and data */
+		struct apfs_kvloc *entry;
+
+		entry = (struct apfs_kvloc *)raw->btn_data + index;
+		/* Translate offset in key area to offset in block */
+		*off = node->key + le16_to_cpu(entry->k.off);
+		return le16_to_cpu(entry->k.len);
+	}
+}
+
+/**
+ * __apfs_node_locate_data - Locate the data of a node record, without checks
+ * @node:	the node
+ * @index:	number of the entry to locate, below @node->records
+ * @off:	on return will hold the offset in the block
+ *
+ * Returns the length of the data.  The bounds of every entry are checked once,
+ * by apfs_node_is_valid(), before the node can be used.
+ */
+static __always_inline int __apfs_node_locate_data(struct apfs_node *node,
+						   int index, int *off)
+{
+	struct super_block *sb = node->object.sb;
+	struct apfs_btree_node_phys *raw;
+	int end = sb->s_blocksize;
+	int len;
+
+	/*
+	 * Data offsets are counted backwards from the end of the block, or
+	 * from the beginning of the footer when it exists
+	 */
+	if (apfs_node_is_root(node))
+		end -= sizeof(struct apfs_btree_info);
+
+	raw = (struct apfs_btree_node_phys *)node->object.data;
+	if (apfs_node_has_fixed_kv_size(node)) {
+		/* These node types have fixed length keys and data */
+		struct apfs_kvoff *entry;
+
+		entry = (struct apfs_kvoff *)raw->btn_data + index;
+		/* Node type decides length */
+		len = apfs_node_is_leaf(node) ? 16 : 8;
+		*off = end - le16_to_cpu(entry->v);
+	} else {
+		/* These node types have variable length keys and data */
+		struct apfs_kvloc *entry;
+
+		entry = (struct apfs_kvloc *)raw->btn_data + index;
+		len = le16_to_cpu(entry->v.len);
+		*off = end - le16_to_cpu(entry->v.off);
+	}
+	return len;
+}
 
 /**
  * apfs_node_is_valid - Check basic sanity of the node index
  * @sb:		filesystem superblock
  * @node:	node to check
  *
- * Verifies that the node index fits in a single block, and that the number
- * of records fits in the index. Without this check a crafted filesystem could
- * pretend to have too many records, and calls to apfs_node_locate_key() and
- * apfs_node_locate_data() would read beyond the limits of the node.
+ * Verifies that the node index fits in a single block, that the number of
+ * records fits in the index, and that the key and data of every record are
+ * inside the block. Without this check a crafted filesystem could send the
+ * queries to read beyond the limits of the node.  The nodes are immutable, so
+ * it's enough to do it once, before they get cached.
  */
 static bool apfs_node_is_valid(struct super_block *sb,
 			       struct apfs_node *node)
@@ -31,6 +117,7 @@ static bool apfs_node_is_valid(struct super_block *sb,
 	int records = node->records;
 	int index_size = node->key - sizeof(struct apfs_btree_node_phys);
 	int entry_size;
+	int i;
 
 	if (!records) /* Empty nodes could keep a multiple query spinning */
 		return false;
@@ -41,7 +128,98 @@ static bool apfs_node_is_valid(struct super_block *sb,
 	entry_size = (apfs_node_has_fixed_kv_size(node)) ?
 		sizeof(struct apfs_kvoff) : sizeof(struct apfs_kvloc);
 
-	return records * entry_size <= index_size;
+	if (records * entry_size > index_size)
+		return false;
+
+	for (i = 0; i < records; ++i) {
+		int off, len;
+
+		len = __apfs_node_locate_key(node, i, &off);
+		if (off + len > sb->s_blocksize)
+			return false;
+		len = __apfs_node_locate_data(node, i, &off);
+		if (off < 0 || off + len > sb->s_blocksize)
+			return false;
+	}
+	return true;
+}
+
+/**
+ * apfs_node_locate_key - Locate the key of a node record
+ * @node:	node to be searched
+ * @index:	number of the entry to locate
+ * @off:	on return will hold the offset in the block
+ *
+ * Returns the length of the key, or 0 if there is no such entry.  The node was
+ * validated on load, so the returned length always fits within the block.
+ */
+static inline int apfs_node_locate_key(struct apfs_node *node, int index,
+				       int *off)
+{
+	if (index >= node->records)
+		return 0;
+	return __apfs_node_locate_key(node, index, off);
+}
+
+/**
+ * apfs_node_locate_data - Locate the data of a node record
+ * @node:	node to be searched
+ * @index:	number of the entry to locate
+ * @off:	on return will hold the offset in the block
+ *
+ * Returns the length of the data, or 0 if there is no such entry.  The node
+ * was validated on load, so the returned length always fits within the block.
+ */
+static inline int apfs_node_locate_data(struct apfs_node *node, int index,
+					int *off)
+{
+	if (index >= node->records)
+		return 0;
+	return __apfs_node_locate_data(node, index, off);
+}
+
+static struct kmem_cache *apfs_node_cachep;
+
+/**
+ * apfs_node_size - Number of bytes of slab taken by each in-memory node
+ *
+ * The block itself is not counted, since it belongs to the page cache.
+ */
+unsigned int apfs_node_size(void)
+{
+	return kmem_cache_size(apfs_node_cachep);
+}
+
+/**
+ * apfs_node_init - Create the slab cache for the in-memory nodes
+ *
+ * Returns 0 on success, or -ENOMEM in case of failure.
+ */
+int __init apfs_node_init(void)
+{
+	apfs_node_cachep = kmem_cache_create("apfs_node_cache",
+					     sizeof(struct apfs_node), 0,
+					     SLAB_RECLAIM_ACCOUNT | SLAB_ACCOUNT,
+					     NULL);
+	if (!apfs_node_cachep)
+		return -ENOMEM;
+	return 0;
+}
+
+/**
+ * apfs_node_exit - Destroy the slab cache for the in-memory nodes
+ */
+void apfs_node_exit(void)
+{
+	/* Wait for the nodes still waiting on a grace period */
+	rcu_barrier();
+	kmem_cache_destroy(apfs_node_cachep);
+}
+
+static void apfs_node_free_rcu(struct rcu_head *head)
+{
+	kmem_cache_free(apfs_node_cachep,
+			container_of(head, struct apfs_node, rcu));
 }
 
 static void apfs_node_release(struct kref *kref)
@@ -49,20 +227,371 @@ static void apfs_node_release(struct kref *kref)
 	struct apfs_node *node =
 		container_of(kref, struct apfs_node, refcount);
 
-	brelse(node->object.bh);
-	kfree(node);
+	apfs_object_release(&node->object);
+	kvfree(node->toc);
+	kvfree(node->children);
+	/*
+	 * A lockless lookup may still be looking at this node.  The rcu head
+	 * shares its space with the lru entry, but the node can't be on any
+	 * list by now, and lookups never touch that field.
+	 */
+	call_rcu(&node->rcu, apfs_node_free_rcu);
 }
 
+/*
+ * Pinned nodes stay in the cache until unmount, so their references don't need
+ * counting; this keeps the roots of the trees, which every query starts from,
+ * from bouncing between cpus on parallel lookups.  The refcount of a node that
+ * got pinned while in use is left too high, and it gets freed anyway by
+ * apfs_node_cache_destroy().
+ */
 void apfs_node_get(struct apfs_node *node)
 {
+	if (test_bit(APFS_NODE_PINNED, &node->state))
+		return;
 	kref_get(&node->refcount);
 }
 
 void apfs_node_put(struct apfs_node *node)
 {
+	if (test_bit(APFS_NODE_PINNED, &node->state))
+		return;
 	kref_put(&node->refcount, apfs_node_release);
 }
 
+/**
+ * apfs_node_shard - Find the shard of the node cache for a block
+ * @cache:	the node cache
+ * @block:	number of the block where the node is stored
+ */
+static inline struct apfs_node_cache_shard *
+apfs_node_shard(struct apfs_node_cache *cache, u64 block)
+{
+	return &cache->shards[hash_64(block, APFS_NODE_CACHE_SHARD_BITS)];
+}
+
+/**
+ * apfs_node_cache_lookup - Find a node in the cache and take a reference
+ * @cache:	the node cache
+ * @block:	number of the block where the node is stored
+ *
+ * Returns the node, or NULL if it's not cached.  No locks are needed; a node
+ * that is being evicted at the same time may be reported as not cached.
+ */
+static struct apfs_node *apfs_node_cache_lookup(struct apfs_node_cache *cache,
+						u64 block)
+{
+	struct apfs_node_cache_shard *shard = apfs_node_shard(cache, block);
+	struct apfs_node *node;
+
+	rcu_read_lock();
+	hash_for_each_possible_rcu(shard->table, node, hash, block) {
+		if (node->object.block_nr != block)
+			continue;
+		if (!test_bit(APFS_NODE_PINNED, &node->state) &&
+		    !kref_get_unless_zero(&node->refcount))
+			break;
+		rcu_read_unlock();
+
+		/* Don't dirty the cache line of a hot node for nothing */
+		if (!test_bit(APFS_NODE_REFERENCED, &node->state))
+			set_bit(APFS_NODE_REFERENCED, &node->state);
+		if (!test_bit(APFS_NODE_HOT, &node->state))
+			set_bit(APFS_NODE_HOT, &node->state);
+		return node;
+	}
+	rcu_read_unlock();
+	return NULL;
+}
+
+/**
+ * apfs_node_lru_isolate - Take a node out of the cache, if it's not in use
+ * @item:	lru entry of the node
+ * @lru:	lru list of the node
+ * @lru_lock:	lock for @lru, which is held
+ * @arg:	list of the nodes to be put once the locks are dropped
+ *
+ * Nodes that were hit since the last pass get another one.  The shard lock
+ * comes after the lru locks here, and before them everywhere else, so it can
+ * only be tried.
+ */
+static enum lru_status apfs_node_lru_isolate(struct list_head *item,
+					     struct list_lru_one *lru,
+					     spinlock_t *lru_lock, void *arg)
+{
+	struct apfs_node *node = container_of(item, struct apfs_node, lru);
+	struct apfs_node_cache *cache =
+				&APFS_SB(node->object.sb)->s_node_cache;
+	struct apfs_node_cache_shard *shard;
+	struct list_head *dispose = arg;
+
+	if (test_bit(APFS_NODE_REFERENCED, &node->state)) {
+		clear_bit(APFS_NODE_REFERENCED, &node->state);
+		return LRU_ROTATE;
+	}
+
+	shard = apfs_node_shard(cache, node->object.block_nr);
+	if (!spin_trylock(&shard->lock))
+		return LRU_SKIP;
+	hash_del_rcu(&node->hash);
+	list_lru_isolate_move(lru, item, dispose);
+	spin_unlock(&shard->lock);
+	return LRU_REMOVED;
+}
+
+/**
+ * apfs_node_cache_dispose - Drop the cache references of evicted nodes
+ * @dispose:	list of the nodes, which is left empty
+ *
+ * Nodes still in use by a query are freed once their last user puts them.
+ */
+static void apfs_node_cache_dispose(struct list_head *dispose)
+{
+	struct apfs_node *node, *tmp;
+
+	list_for_each_entry_safe(node, tmp, dispose, lru) {
+		list_del_init(&node->lru);
+		apfs_node_put(node);
+	}
+}
+
+/**
+ * apfs_node_cache_evict - Evict the least recently used nodes from the cache
+ * @cache:	the node cache
+ * @nr:		maximum number of nodes to look at, in all the lru lists
+ *
+ * Returns the number of evicted nodes.
+ */
+static unsigned long apfs_node_cache_evict(struct apfs_node_cache *cache,
+					   unsigned long nr)
+{
+	LIST_HEAD(dispose);
+	unsigned long freed;
+
+	freed = list_lru_walk(&cache->lru, apfs_node_lru_isolate, &dispose, nr);
+	apfs_node_cache_dispose(&dispose);
+	return freed;
+}
+
+/**
+ * apfs_node_cache_insert - Add a freshly read node to the cache
+ * @cache:	the node cache
+ * @node:	the new node
+ *
+ * Returns the node that ends up in the cache, with a reference taken for the
+ * caller.  This is @node itself, unless another reader cached the same block
+ * in the meantime; in that case @node is released and the cached copy is
+ * returned instead.
+ */
+static struct apfs_node *apfs_node_cache_insert(struct apfs_node_cache *cache,
+						struct apfs_node *node)
+{
+	u64 block = node->object.block_nr;
+	struct apfs_node_cache_shard *shard = apfs_node_shard(cache, block);
+	struct apfs_node *cached;
+	unsigned long count, max;
+
+	spin_lock(&shard->lock);
+	cached = apfs_node_cache_lookup(cache, block);
+	if (cached) {
+		spin_unlock(&shard->lock);
+		apfs_node_put(node);
+		return cached;
+	}
+
+	/* The cache keeps its own reference to the node */
+	apfs_node_get(node);
+	hash_add_rcu(shard->table, &node->hash, block);
+	list_lru_add(&cache->lru, &node->lru);
+	spin_unlock(&shard->lock);
+
+	count = list_lru_count(&cache->lru);
+	max = READ_ONCE(cache->max);
+	if (count > max)
+		apfs_node_cache_evict(cache, count - max);
+	return node;
+}
+
+static unsigned long apfs_node_cache_count(struct shrinker *shrink,
+					   struct shrink_control *sc)
+{
+	struct apfs_node_cache *cache =
+		container_of(shrink, struct apfs_node_cache, shrinker);
+
+	return list_lru_shrink_count(&cache->lru, sc) ?: SHRINK_EMPTY;
+}
+
+static unsigned long apfs_node_cache_scan(struct shrinker *shrink,
+					  struct shrink_control *sc)
+{
+	struct apfs_node_cache *cache =
+		container_of(shrink, struct apfs_node_cache, shrinker);
+	LIST_HEAD(dispose);
+	unsigned long freed;
+
+	freed = list_lru_shrink_walk(&cache->lru, sc, apfs_node_lru_isolate,
+				     &dispose);
+	apfs_node_cache_dispose(&dispose);
+	return freed;
+}
+
+/**
+ * apfs_node_cache_init - Set up the node cache for a new mount
+ * @sb:		filesystem superblock
+ *
+ * Nodes are charged to the memory cgroup of the task that read them, and the
+ * lru keeps them apart by cgroup, so that the reclaim for one container only
+ * drops its own nodes.  Returns 0 on success, or a negative error code in case
+ * of failure.
+ */
+int apfs_node_cache_init(struct super_block *sb)
+{
+	struct apfs_node_cache *cache = &APFS_SB(sb)->s_node_cache;
+	int err, i;
+
+	for (i = 0; i < APFS_NODE_CACHE_SHARDS; ++i) {
+		spin_lock_init(&cache->shards[i].lock);
+		hash_init(cache->shards[i].table);
+	}
+	spin_lock_init(&cache->pin_lock);
+	INIT_LIST_HEAD(&cache->pinned);
+	cache->nr_pinned = 0;
+	cache->max = APFS_NODE_CACHE_DEFAULT_SIZE;
+
+	cache->shrinker.count_objects = apfs_node_cache_count;
+	cache->shrinker.scan_objects = apfs_node_cache_scan;
+	cache->shrinker.seeks = DEFAULT_SEEKS;
+	cache->shrinker.flags = SHRINKER_NUMA_AWARE | SHRINKER_MEMCG_AWARE;
+	err = prealloc_shrinker(&cache->shrinker);
+	if (err)
+		return err;
+	err = list_lru_init_memcg(&cache->lru, &cache->shrinker);
+	if (err) {
+		free_prealloced_shrinker(&cache->shrinker);
+		return err;
+	}
+	register_shrinker_prepared(&cache->shrinker);
+	return 0;
+}
+
+/**
+ * apfs_node_cache_set_max - Change the limit for the nodes in the cache
+ * @sb:		filesystem superblock
+ * @max:	new limit
+ *
+ * Evicts right away whatever is over the new limit.  Nodes that were hit
+ * recently need a second pass, and the ones in use by a query can't go at
+ * all, so the count may stay a little above @max for a while.
+ */
+void apfs_node_cache_set_max(struct super_block *sb, unsigned long max)
+{
+	struct apfs_node_cache *cache = &APFS_SB(sb)->s_node_cache;
+	unsigned long count;
+	int pass;
+
+	WRITE_ONCE(cache->max, max);
+	for (pass = 0; pass < 2; pass++) {
+		count = list_lru_count(&cache->lru);
+		if (count <= max)
+			break;
+		apfs_node_cache_evict(cache, count - max);
+	}
+}
+
+/**
+ * apfs_node_cache_destroy - Drop all cached nodes before unmount
+ * @sb:		filesystem superblock
+ *
+ * The pinned nodes are freed whatever their refcount says; the caller must
+ * make sure that nobody uses them anymore.
+ */
+void apfs_node_cache_destroy(struct super_block *sb)
+{
+	struct apfs_node_cache *cache = &APFS_SB(sb)->s_node_cache;
+	struct apfs_node *node, *tmp;
+	unsigned long count;
+	LIST_HEAD(pinned);
+
+	unregister_shrinker(&cache->shrinker);
+
+	/* Referenced nodes only go on the second pass */
+	while ((count = list_lru_count(&cache->lru)))
+		apfs_node_cache_evict(cache, 2 * count);
+
+	/* Freeing the nodes may sleep, so take them off the list first */
+	spin_lock(&cache->pin_lock);
+	list_splice_init(&cache->pinned, &pinned);
+	cache->nr_pinned = 0;
+	spin_unlock(&cache->pin_lock);
+
+	list_for_each_entry_safe(node, tmp, &pinned, lru) {
+		hash_del_rcu(&node->hash);
+		list_del_init(&node->lru);
+		apfs_node_release(&node->refcount);
+	}
+
+	list_lru_destroy(&cache->lru);
+}
+
+/**
+ * apfs_node_cache_collect - List the blocks of the nodes in the cache
+ * @sb:		filesystem superblock
+ * @bnos:	array for the block numbers
+ * @max:	size of @bnos
+ *
+ * Pinned nodes are reported as well.  Nodes that get added or evicted during
+ * the walk may or may not be seen.  Returns the number of entries filled, in
+ * no particular order.
+ */
+unsigned long apfs_node_cache_collect(struct super_block *sb, u64 *bnos,
+				      unsigned long max)
+{
+	struct apfs_node_cache *cache = &APFS_SB(sb)->s_node_cache;
+	struct apfs_node *node;
+	unsigned long nr = 0;
+	int i, bkt;
+
+	rcu_read_lock();
+	for (i = 0; i < APFS_NODE_CACHE_SHARDS && nr < max; i++) {
+		hash_for_each_rcu(cache->shards[i].table, bkt, node, hash) {
+			if (nr == max)
+				break;
+			bnos[nr++] = node->object.block_nr;
+		}
+	}
+	rcu_read_unlock();
+	return nr;
+}
+
+/**
+ * apfs_node_pin - Keep a cached node in memory until unmount
+ * @node:	the node to pin
+ *
+ * Pinned nodes are taken out of the lru, so neither lru eviction nor the
+ * shrinker will ever drop them.  Returns false if @node was no longer in the
+ * cache, which can only happen if it got evicted right after being read.
+ */
+bool apfs_node_pin(struct apfs_node *node)
+{
+	struct apfs_node_cache *cache = &APFS_SB(node->object.sb)->s_node_cache;
+	struct apfs_node_cache_shard *shard;
+	bool pinned = false;
+
+	shard = apfs_node_shard(cache, node->object.block_nr);
+	spin_lock(&shard->lock);
+	if (hash_hashed(&node->hash) &&
+	    !test_and_set_bit(APFS_NODE_PINNED, &node->state)) {
+		list_lru_del(&cache->lru, &node->lru);
+		spin_lock(&cache->pin_lock);
+		list_add_tail(&node->lru, &cache->pinned);
+		cache->nr_pinned++;
+		spin_unlock(&cache->pin_lock);
+		pinned = true;
+	}
+	spin_unlock(&shard->lock);
+	return pinned;
+}
+
 /**
  * apfs_read_node - Read a node header from disk
  * @sb:		filesystem superblock
@@ -71,27 +600,54 @@ void apfs_node_put(struct apfs_node *node)
  * Returns ERR_PTR in case of failure, otherwise return a pointer to the
  * resulting apfs_node structure with the initial reference taken.
  *
- * For now we assume the node has not been read before.
+ * Nodes are looked up in the cache first; if the node has not been read
+ * before, it gets parsed, checked and added to the cache.  The checksum is
+ * only verified once for each residency of the block in memory.
  */
 struct apfs_node *apfs_read_node(struct super_block *sb, u64 block)
 {
 	struct apfs_sb_info *sbi = APFS_SB(sb);
-	struct buffer_head *bh;
+	struct apfs_node_cache *cache = &sbi->s_node_cache;
 	struct apfs_btree_node_phys *raw;
 	struct apfs_node *node;
+	u64 csum_ns = 0;
+	u64 lat;
+	int err;
 
-	bh = sb_bread(sb, block);
-	if (!bh) {
-		apfs_err(sb, "unable to read node");
-		return ERR_PTR(-EINVAL);
+	node = apfs_node_cache_lookup(cache, block);
+	if (node) {
+		apfs_stat_inc(sb, APFS_STAT_NODE_CACHE_HITS);
+		trace_apfs_read_node(sb, block, true, 0);
+		return node;
 	}
-	raw = (struct apfs_btree_node_phys *) bh->b_data;
+	apfs_stat_inc(sb, APFS_STAT_NODE_READS);
+	apfs_btree_ra_used(sb, block);
+	apfs_heat_inc(sb, APFS_HEAT_NODE, block << sb->s_blocksize_bits);
 
-	node = kmalloc(sizeof(*node), GFP_KERNEL);
-	if (!node) {
-		brelse(bh);
+	node = kmem_cache_alloc(apfs_node_cachep, GFP_KERNEL);
+	if (!node)
 		return ERR_PTR(-ENOMEM);
+
+	lat = apfs_lat_start();
+	err = apfs_object_read(sb, block, 1 /* blocks */, &node->object);
+	apfs_lat_end(sb, APFS_LAT_NODE_READ, lat);
+	if (err) {
+		apfs_err(sb, "unable to read node");
+		kmem_cache_free(apfs_node_cachep, node);
+		return ERR_PTR(err);
+	}
+	/* Encrypted metadata is found out by its checksum, which is plain */
+	if (sbi->s_tfm && !apfs_object_verify_csum(&node->object)) {
+		err = apfs_crypt_node(sb, &node->object);
+		if (err) {
+			apfs_err(sb, "unable to decrypt node in block 0x%llx",
+				 block);
+			apfs_object_release(&node->object);
+			kmem_cache_free(apfs_node_cachep, node);
+			return ERR_PTR(err);
+		}
 	}
+	raw = (struct apfs_btree_node_phys *)node->object.data;
 
 	node->flags = le16_to_cpu(raw->btn_flags);
 	node->records = le32_to_cpu(raw->btn_nkeys);
@@ -100,18 +656,35 @@ struct apfs_node *apfs_read_node(struct super_block *sb, u64 block)
 	node->free = node->key + le16_to_cpu(raw->btn_free_space.off);
 	node->data = node->free + le16_to_cpu(raw->btn_free_space.len);
 
-	node->object.sb = sb;
-	node->object.block_nr = block;
 	node->object.oid = le64_to_cpu(raw->btn_o.o_oid);
-	node->object.bh = bh;
+	apfs_stat_add(sb, APFS_STAT_NODE_BYTES, sb->s_blocksize);
+	if (le32_to_cpu(raw->btn_o.o_subtype) == APFS_OBJECT_TYPE_OMAP) {
+		apfs_stat_inc(sb, APFS_STAT_OMAP_NODE_READS);
+		apfs_stat_add(sb, APFS_STAT_OMAP_NODE_BYTES, sb->s_blocksize);
+	}
 
+	node->state = 0;
+	node->time = jiffies;
+	node->toc = NULL;
+	node->children = NULL;
+
+	INIT_HLIST_NODE(&node->hash);
+	INIT_LIST_HEAD(&node->lru);
 	kref_init(&node->refcount);
 
-	if (sbi->s_flags & APFS_CHECK_NODES &&
-	    !apfs_obj_verify_csum(sb, &raw->btn_o)) {
-		apfs_alert(sb, "bad checksum for node in block 0x%llx", block);
-		apfs_node_put(node);
-		return ERR_PTR(-EFSBADCRC);
+	/* A node evicted from our cache may still be in the page cache */
+	if (sbi->s_flags & APFS_CHECK_NODES) {
+		u64 start = trace_apfs_read_node_enabled() ? ktime_get_ns() : 0;
+		bool csum_ok = apfs_object_verify_csum(&node->object);
+
+		if (start)
+			csum_ns = ktime_get_ns() - start;
+		if (!csum_ok) {
+			apfs_alert(sb, "bad checksum for node in block 0x%llx",
+				   block);
+			apfs_node_put(node);
+			return ERR_PTR(-EFSBADCRC);
+		}
 	}
 	if (!apfs_node_is_valid(sb, node)) {
 		apfs_alert(sb, "bad node in block 0x%llx", block);
@@ -119,111 +692,56 @@ struct apfs_node *apfs_read_node(struct super_block *sb, u64 block)
 		return ERR_PTR(-EFSCORRUPTED);
 	}
 
-	return node;
+	trace_apfs_read_node(sb, block, false, csum_ns);
+	/* The node holds its page, so the buffer heads have no more use */
+	apfs_object_drop_buffers(&node->object);
+	return apfs_node_cache_insert(cache, node);
 }
 
 /**
- * apfs_node_locate_key - Locate the key of a node record
- * @node:	node to be searched
- * @index:	number of the entry to locate
- * @off:	on return will hold the offset in the block
+ * apfs_read_cached_node - Get a node only if it needs no disk access
+ * @sb:		filesystem superblock
+ * @block:	number of the block where the node is stored
  *
- * Returns the length of the key, or 0 in case of failure. The function checks
- * that this length fits within the block; callers must use the returned value
- * to make sure they never operate outside its bounds.
+ * Same as apfs_read_node(), but for callers that must not block: returns
+ * ERR_PTR(-EAGAIN) if the node is not in the cache.
  */
-static int apfs_node_locate_key(struct apfs_node *node, int index, int *off)
+struct apfs_node *apfs_read_cached_node(struct super_block *sb, u64 block)
 {
-	struct super_block *sb = node->object.sb;
-	struct apfs_btree_node_phys *raw;
-	int len;
-
-	if (index >= node->records)
-		return 0;
-
-	raw = (struct apfs_btree_node_phys *)node->object.bh->b_data;
-	if (apfs_node_has_fixed_kv_size(node)) {
-		struct apfs_kvoff *entry;
-
-		entry = (struct apfs_kvoff *)raw->btn_data + index;
-		len = 16;
-		/* Translate offset in key area to offset in block */
-		*off = node->key + le16_to_cpu(entry->k);
-	} else {
-		/* These node types have variable length keys and data */
-		struct apfs_kvloc *entry;
-
-		entry = (struct apfs_kvloc *)raw->btn_data + index;
-		len = le16_to_cpu(entry->k.len);
-		/* Translate offset in key area to offset in block */
-		*off = node->key + le16_to_cpu(entry->k.off);
-	}
+	struct apfs_node *node;
 
-	if (*off + len > sb->s_blocksize) {
-		/* Avoid out-of-bounds read if corrupted */
-		return 0;
-	}
-	return len;
+	node = apfs_node_cache_lookup(&APFS_SB(sb)->s_node_cache, block);
+	if (!node)
+		return ERR_PTR(-EAGAIN);
+	apfs_stat_inc(sb, APFS_STAT_NODE_CACHE_HITS);
+	trace_apfs_read_node(sb, block, true, 0);
+	return node;
 }
 
 /**
- * apfs_node_locate_data - Locate the data of a node record
- * @node:	node to be searched
- * @index:	number of the entry to locate
- * @off:	on return will hold the offset in the block
+ * apfs_node_is_cached - Check if a node is in the cache, without getting it
+ * @sb:		filesystem superblock
+ * @block:	number of the block where the node is stored
  *
- * Returns the length of the data, or 0 in case of failure. The function checks
- * that this length fits within the block; callers must use the returned value
- * to make sure they never operate outside its bounds.
+ * Meant for the readahead, which has no use for nodes already in memory.  The
+ * answer may be out of date by the time the caller sees it.
  */
-static int apfs_node_locate_data(struct apfs_node *node, int index, int *off)
+bool apfs_node_is_cached(struct super_block *sb, u64 block)
 {
-	struct super_block *sb = node->object.sb;
-	struct apfs_btree_node_phys *raw;
-	int len;
-
-	if (index >= node->records)
-		return 0;
-
-	raw = (struct apfs_btree_node_phys *)node->object.bh->b_data;
-	if (apfs_node_has_fixed_kv_size(node)) {
-		/* These node types have fixed length keys and data */
-		struct apfs_kvoff *entry;
-
-		entry = (struct apfs_kvoff *)raw->btn_data + index;
-		/* Node type decides length */
-		len = apfs_node_is_leaf(node) ? 16 : 8;
-		/*
-		 * Data offsets are counted backwards from the end of the
-		 * block, or from the beginning of the footer when it exists
-		 */
-		if (apfs_node_is_root(node)) /* has footer */
-			*off = sb->s_blocksize - sizeof(struct apfs_btree_info)
-					- le16_to_cpu(entry->v);
-		else
-			*off = sb->s_blocksize - le16_to_cpu(entry->v);
-	} else {
-		/* These node types have variable length keys and data */
-		struct apfs_kvloc *entry;
-
-		entry = (struct apfs_kvloc *)raw->btn_data + index;
-		len = le16_to_cpu(entry->v.len);
-		/*
-		 * Data offsets are counted backwards from the end of the
-		 * block, or from the beginning of the footer when it exists
-		 */
-		if (apfs_node_is_root(node)) /* has footer */
-			*off = sb->s_blocksize - sizeof(struct apfs_btree_info)
-					- le16_to_cpu(entry->v.off);
-		else
-			*off = sb->s_blocksize - le16_to_cpu(entry->v.off);
-	}
+	struct apfs_node_cache *cache = &APFS_SB(sb)->s_node_cache;
+	struct apfs_node_cache_shard *shard = apfs_node_shard(cache, block);
+	struct apfs_node *node;
+	bool found = false;
 
-	if (*off < 0 || *off + len > sb->s_blocksize) {
-		/* Avoid out-of-bounds read if corrupted */
-		return 0;
+	rcu_read_lock();
+	hash_for_each_possible_rcu(shard->table, node, hash, block) {
+		if (node->object.block_nr == block) {
+			found = true;
+			break;
+		}
 	}
-	return len;
+	rcu_read_unlock();
+	return found;
 }
 
 /**
@@ -238,22 +756,16 @@ static int apfs_node_locate_data(struct apfs_node *node, int index, int *off)
 static int apfs_key_from_query(struct apfs_query *query, struct apfs_key *key)
 {
 	struct super_block *sb = query->node->object.sb;
-	char *raw = query->node->object.bh->b_data;
+	char *raw = query->node->object.data;
 	void *raw_key = (void *)(raw + query->key_off);
+	int (*read_key)(void *raw, int size, struct apfs_key *key);
 	int err = 0;
 
-	switch (query->flags & APFS_QUERY_TREE_MASK) {
-	case APFS_QUERY_CAT:
-		err = apfs_read_cat_key(raw_key, query->key_len, key);
-		break;
-	case APFS_QUERY_OMAP:
-		err = apfs_read_omap_key(raw_key, query->key_len, key);
-		break;
-	default:
-		/* Not implemented yet */
-		err = -EINVAL;
-		break;
-	}
+	read_key = apfs_tree_desc(query->flags)->read_key;
+	if (read_key)
+		err = read_key(raw_key, query->key_len, key);
+	else
+		err = -EINVAL; /* Not implemented yet */
 	if (err) {
 		apfs_alert(sb, "bad node key in block 0x%llx",
 			   query->node->object.block_nr);
@@ -268,6 +780,102 @@ static int apfs_key_from_query(struct apfs_query *query, struct apfs_key *key)
 	return err;
 }
 
+/**
+ * apfs_node_decode_toc - Decode all the keys of a node into its toc
+ * @query:	query being run on the node
+ *
+ * Returns the table of contents, or NULL if it couldn't be built.  The keys
+ * of a node are immutable, so the first toc to be published is shared by all
+ * later queries.
+ */
+static struct apfs_toc_entry *apfs_node_decode_toc(struct apfs_query *query)
+{
+	struct apfs_node *node = query->node;
+	char *raw = node->object.data;
+	int (*read_key)(void *raw, int size, struct apfs_key *key);
+	struct apfs_toc_entry *toc, *old;
+	int i;
+
+	read_key = apfs_tree_desc(query->flags)->read_key;
+
+	toc = kvmalloc_array(node->records, sizeof(*toc),
+			     GFP_KERNEL | __GFP_ACCOUNT);
+	if (!toc)
+		return NULL;
+
+	for (i = 0; i < node->records; ++i) {
+		struct apfs_toc_entry *entry = &toc[i];
+		struct apfs_key key;
+		int off, len, err;
+
+		len = apfs_node_locate_key(node, i, &off);
+		err = read_key ? read_key(raw + off, len, &key) : -EINVAL;
+		if (err) {
+			/* Leave the error reports to the regular code path */
+			set_bit(APFS_NODE_NO_TOC, &node->state);
+			kvfree(toc);
+			return NULL;
+		}
+
+		entry->id = key.id;
+		entry->number = key.number;
+		entry->key_off = off;
+		entry->key_len = len;
+		entry->name_off = key.name ? key.name - raw : 0;
+		entry->type = key.type;
+	}
+
+	old = cmpxchg(&node->toc, NULL, toc);
+	if (old) { /* Someone else got there first */
+		kvfree(toc);
+		return old;
+	}
+	return toc;
+}
+
+/**
+ * apfs_node_read_key - Read the key for the current index of a query
+ * @query:	the query
+ * @key:	return parameter for the key
+ *
+ * Sets @query->key_off and @query->key_len, and reads the key of the record
+ * at @query->index into @key.  Nodes that were found in the cache get their
+ * keys decoded all at once, so that later searches don't need to parse them
+ * again.  Returns 0 on success or a negative error code otherwise.
+ */
+static int apfs_node_read_key(struct apfs_query *query, struct apfs_key *key)
+{
+	struct apfs_node *node = query->node;
+	struct apfs_toc_entry *toc, *entry;
+
+	toc = smp_load_acquire(&node->toc);
+	if (!toc && test_bit(APFS_NODE_HOT, &node->state) &&
+	    !test_bit(APFS_NODE_NO_TOC, &node->state))
+		toc = apfs_node_decode_toc(query);
+	if (!toc || query->index >= node->records) {
+		query->key_len = apfs_node_locate_key(node, query->index,
+						      &query->key_off);
+		return apfs_key_from_query(query, key);
+	}
+
+	entry = &toc[query->index];
+	query->key_off = entry->key_off;
+	query->key_len = entry->key_len;
+	key->id = entry->id;
+	key->type = entry->type;
+	key->number = entry->number;
+	key->name = NULL;
+	if (entry->name_off)
+		key->name = node->object.data + entry->name_off;
+
+	/* A multiple query must ignore some of these fields */
+	if (query->flags & APFS_QUERY_ANY_NAME)
+		key->name = NULL;
+	if (query->flags & APFS_QUERY_ANY_NUMBER)
+		key->number = 0;
+	return 0;
+}
+
 /**
  * apfs_node_next - Find the next matching record in the current node
  * @sb:		filesystem superblock
@@ -291,13 +899,11 @@ static int apfs_node_next(struct super_block *sb, struct apfs_query *query)
 		return -EAGAIN;
 	--query->index;
 
-	query->key_len = apfs_node_locate_key(node, query->index,
-					      &query->key_off);
-	err = apfs_key_from_query(query, &curr_key);
+	err = apfs_node_read_key(query, &curr_key);
 	if (err)
 		return err;
 
-	cmp = apfs_keycmp(sb, &curr_key, query->key);
+	cmp = apfs_tree_keycmp(sb, query->flags, &curr_key, query->key);
 
 	if (cmp > 0) /* Records are out of order */
 		return -EFSCORRUPTED;
@@ -321,6 +927,203 @@ static int apfs_node_next(struct super_block *sb, struct apfs_query *query)
 	return 0;
 }
 
+/**
+ * apfs_omap_key_le - Check if an omap record comes before a key, or matches it
+ * @node:	fixed-size omap node
+ * @index:	index of the record
+ * @oid:	object id of the key
+ * @xid:	transaction id of the key
+ *
+ * The key offsets of the node were all checked on load, so the comparison
+ * needs no branches.
+ */
+static __always_inline bool apfs_omap_key_le(struct apfs_node *node, int index,
+					     u64 oid, u64 xid)
+{
+	char *raw = node->object.data;
+	struct apfs_kvoff *entry;
+	struct apfs_omap_key *key;
+	unsigned int off;
+	u64 curr_oid, curr_xid;
+
+	entry = (struct apfs_kvoff *)
+			((struct apfs_btree_node_phys *)raw)->btn_data + index;
+	off = node->key + le16_to_cpu(entry->k);
+	key = (struct apfs_omap_key *)(raw + off);
+
+	curr_oid = le64_to_cpu(key->ok_oid);
+	curr_xid = le64_to_cpu(key->ok_xid);
+	return (curr_oid < oid) | ((curr_oid == oid) & (curr_xid <= xid));
+}
+
+/**
+ * apfs_omap_key_prefetch - Prefetch the key of an omap record
+ * @node:	fixed-size omap node
+ * @index:	index of the record
+ */
+static __always_inline void apfs_omap_key_prefetch(struct apfs_node *node,
+						   int index)
+{
+	char *raw = node->object.data;
+	struct apfs_kvoff *entry;
+
+	entry = (struct apfs_kvoff *)
+			((struct apfs_btree_node_phys *)raw)->btn_data + index;
+	prefetch(raw + node->key + le16_to_cpu(entry->k));
+}
+
+/**
+ * apfs_omap_node_query - Execute a single-record query on a fixed-size omap node
+ * @sb:		filesystem superblock
+ * @query:	the query to execute
+ *
+ * Specialized version of apfs_node_query() for the object map, which is our
+ * hottest tree.  The (oid, xid) pairs are compared straight out of the block,
+ * and the bisection itself is branchless.  Returns 0 on success, -ENODATA if
+ * no appropriate entry was found, or -EFSCORRUPTED in case of corruption.
+ */
+static int apfs_omap_node_query(struct super_block *sb,
+				struct apfs_query *query)
+{
+	struct apfs_node *node = query->node;
+	struct apfs_omap_key *key;
+	u64 oid = query->key->id;
+	u64 xid = query->key->number;
+	int base = 0, n = node->records;
+
+	if (!apfs_omap_key_le(node, 0, oid, xid))
+		return -ENODATA;
+
+	/* Find the last record that is not above the key */
+	while (n > 1) {
+		int half = n / 2;
+
+		apfs_omap_key_prefetch(node, base + half / 2);
+		apfs_omap_key_prefetch(node, base + half + half / 2);
+		base += half & -(int)apfs_omap_key_le(node, base + half,
+						      oid, xid);
+		n -= half;
+	}
+	query->index = base;
+
+	query->key_len = apfs_node_locate_key(node, base, &query->key_off);
+	if (query->key_len != sizeof(*key))
+		return -EFSCORRUPTED;
+	key = (struct apfs_omap_key *)(node->object.data +
+				       query->key_off);
+
+	/* On a leaf, a record for an older xid of another oid is no match */
+	if (apfs_node_is_leaf(node) && le64_to_cpu(key->ok_oid) != oid)
+		return -ENODATA;
+
+	query->len = apfs_node_locate_data(node, base, &query->off);
+	if (query->len == 0)
+		return -EFSCORRUPTED;
+	return 0;
+}
+
+/*
+ * Every kind of b-tree, indexed by the tree bits of the query flags.  Queries
+ * with no tree bits can still walk a physical tree, but not decode its keys.
+ */
+const struct apfs_tree_desc apfs_tree_descs[APFS_QUERY_TREE_MASK + 1] = {
+	[0] = {
+		.name		= "unknown",
+	},
+	[APFS_QUERY_OMAP] = {
+		.name		= "omap",
+		.fixed_kv	= true,
+		.read_key	= apfs_read_omap_key,
+		.node_query	= apfs_omap_node_query,
+	},
+	[APFS_QUERY_CAT] = {
+		.name		= "catalog",
+		.virtual	= true,
+		.read_key	= apfs_read_cat_key,
+	},
+	[APFS_QUERY_SNAP_META] = {
+		.name		= "snap_meta",
+		.read_key	= apfs_read_snap_key,
+	},
+	[APFS_QUERY_EXTENTREF] = {
+		.name		= "extentref",
+		.read_key	= apfs_read_cat_key,
+	},
+	[APFS_QUERY_FUSION] = {
+		.name		= "fusion",
+		.fixed_kv	= true,
+		.read_key	= apfs_read_fusion_key,
+	},
+	[6 ... APFS_QUERY_TREE_MASK] = {
+		.name		= "unknown",
+	},
+};
+
+/**
+ * apfs_toc_scan - Search a short table of contents without bisection
+ * @toc:	the decoded keys
+ * @end:	number of entries to search
+ * @raw:	the node block, for the names
+ * @key:	the key to search for, with an id that fits in 60 bits
+ *
+ * Bisection over a few dozen keys is dominated by branch mispredictions, so
+ * the keys that come before @key are counted instead, with a comparison that
+ * compiles without branches.  Only ties on the id, type and number are then
+ * settled by name, in a short forward scan.  Returns the index of the last
+ * entry that doesn't come after @key, or -1 if there is none.
+ */
+int apfs_toc_scan(const struct apfs_toc_entry *toc, int end,
+		  const char *raw, const struct apfs_key *key)
+{
+	u64 hi = key->id << (64 - APFS_OBJ_TYPE_SHIFT) | key->type;
+	u64 number = key->number;
+	int count = 0, i;
+
+	for (i = 0; i < end; ++i) {
+		u64 curr_hi = toc[i].id << (64 - APFS_OBJ_TYPE_SHIFT) |
+			      toc[i].type;
+
+		count += (curr_hi < hi) |
+			 ((curr_hi == hi) & (toc[i].number < number));
+	}
+
+	for (i = count; i < end; ++i) {
+		u64 curr_hi = toc[i].id << (64 - APFS_OBJ_TYPE_SHIFT) |
+			      toc[i].type;
+
+		if (curr_hi != hi || toc[i].number != number)
+			break;
+		/* Same as apfs_keycmp(), names are not normalized here */
+		if (toc[i].name_off && key->name &&
+		    strcmp(raw + toc[i].name_off, key->name) > 0)
+			break;
+	}
+	return i - 1;
+}
+
+/**
+ * apfs_node_scan_wanted - Check if a query should scan the toc of its node
+ * @query:	the query
+ * @toc:	decoded keys of the node, or NULL
+ *
+ * Multiple queries mask some of the key fields, so they are left to the
+ * bisection; so are the trees with fixed-size entries, whose ids may be too
+ * long to pack with the type, and those with their own key order.
+ */
+static bool apfs_node_scan_wanted(struct apfs_query *query,
+				  struct apfs_toc_entry *toc)
+{
+	const struct apfs_tree_desc *desc = apfs_tree_desc(query->flags);
+
+	if (!toc || query->index > APFS_TOC_SCAN_MAX)
+		return false;
+	if (query->flags & APFS_QUERY_MULTIPLE)
+		return false;
+	if (desc->fixed_kv || desc->keycmp)
+		return false;
+	return !(query->key->id & APFS_OBJ_TYPE_MASK);
+}
+
 /**
  * apfs_node_query - Execute a query on a single node
  * @sb:		filesystem superblock
@@ -346,7 +1149,9 @@ static int apfs_node_next(struct super_block *sb, struct apfs_query *query)
  */
 int apfs_node_query(struct super_block *sb, struct apfs_query *query)
 {
+	const struct apfs_tree_desc *desc;
 	struct apfs_node *node = query->node;
+	struct apfs_toc_entry *toc;
 	int left, right;
 	int cmp;
 	int err;
@@ -354,6 +1159,27 @@ int apfs_node_query(struct super_block *sb, struct apfs_query *query)
 	if (query->flags & APFS_QUERY_NEXT)
 		return apfs_node_next(sb, query);
 
+	desc = apfs_tree_desc(query->flags);
+	if (desc->node_query && !(query->flags & APFS_QUERY_MULTIPLE) &&
+	    apfs_node_has_fixed_kv_size(node))
+		return desc->node_query(sb, query);
+
+	toc = smp_load_acquire(&node->toc);
+	if (apfs_node_scan_wanted(query, toc)) {
+		struct apfs_key curr_key;
+
+		query->index = apfs_toc_scan(toc, query->index,
+					     node->object.data, query->key);
+		if (query->index < 0)
+			return -ENODATA;
+		err = apfs_node_read_key(query, &curr_key);
+		if (err)
+			return err;
+		cmp = apfs_tree_keycmp(sb, query->flags, &curr_key,
+				       query->key);
+		goto found;
+	}
+
 	/* Search by bisection */
 	cmp = 1;
 	left = 0;
@@ -369,13 +1195,12 @@ int apfs_node_query(struct super_block *sb, struct apfs_query *query)
 			query->index = DIV_ROUND_UP(left + right, 2);
 		}
 
-		query->key_len = apfs_node_locate_key(node, query->index,
-						      &query->key_off);
-		err = apfs_key_from_query(query, &curr_key);
+		err = apfs_node_read_key(query, &curr_key);
 		if (err)
 			return err;
 
-		cmp = apfs_keycmp(sb, &curr_key, query->key);
+		cmp = apfs_tree_keycmp(sb, query->flags, &curr_key,
+				       query->key);
 		if (cmp == 0 && !(query->flags & APFS_QUERY_MULTIPLE))
 			break;
 	} while (left != right);
@@ -383,6 +1208,7 @@ int apfs_node_query(struct super_block *sb, struct apfs_query *query)
 	if (cmp > 0)
 		return -ENODATA;
 
+found:
 	if (cmp != 0 && apfs_node_is_leaf(query->node) &&
 	    query->flags & APFS_QUERY_EXACT)
 		return -ENODATA;
@@ -399,6 +1225,74 @@ int apfs_node_query(struct super_block *sb, struct apfs_query *query)
 	return 0;
 }
 
+/**
+ * apfs_node_read_record - Locate the current record of a query
+ * @query:	the query, with @query->index set to the wanted entry
+ * @key:	if not NULL, return parameter for the key of the record
+ *
+ * Sets the @query->key_off, @query->key_len, @query->off and @query->len
+ * fields for the entry at @query->index.  Returns 0 on success or a negative
+ * error code in case of corruption.
+ */
+int apfs_node_read_record(struct apfs_query *query, struct apfs_key *key)
+{
+	struct apfs_node *node = query->node;
+	int err;
+
+	if (key) {
+		err = apfs_node_read_key(query, key);
+		if (err)
+			return err;
+	} else {
+		query->key_len = apfs_node_locate_key(node, query->index,
+						      &query->key_off);
+	}
+	query->len = apfs_node_locate_data(node, query->index, &query->off);
+	if (query->len == 0)
+		return -EFSCORRUPTED;
+	return 0;
+}
+
+/**
+ * apfs_node_seek - Find where a forward scan should start in a single node
+ * @sb:		filesystem superblock
+ * @query:	the query being positioned
+ *
+ * On a leaf, sets @query->index to the first record that doesn't come before
+ * @query->key, or to the number of records if there is none.  On an index
+ * node, sets it to the last child that may hold such a record.
+ *
+ * Returns 0 on success or a negative error code in case of corruption.
+ */
+int apfs_node_seek(struct super_block *sb, struct apfs_query *query)
+{
+	struct apfs_node *node = query->node;
+	int left = 0, right = node->records;
+	int err;
+
+	/* Search by bisection for the first key that is not smaller */
+	while (left < right) {
+		struct apfs_key curr_key;
+
+		query->index = (left + right) / 2;
+		err = apfs_node_read_key(query, &curr_key);
+		if (err)
+			return err;
+
+		if (apfs_tree_keycmp(sb, query->flags, &curr_key,
+				     query->key) < 0)
+			left = query->index + 1;
+		else
+			right = query->index;
+	}
+
+	if (apfs_node_is_leaf(node))
+		query->index = left;
+	else /* Records equal to the key may also be in the previous child */
+		query->index = left ? left - 1 : 0;
+	return 0;
+}
+
 /**
  * apfs_bno_from_query - Read the block number found by a successful omap query
  * @query:	the query that found the record
@@ -411,7 +1305,7 @@ int apfs_node_query(struct super_block *sb, struct apfs_query *query)
 int apfs_bno_from_query(struct apfs_query *query, u64 *bno)
 {
 	struct apfs_omap_val *omap_val;
-	char *raw = query->node->object.bh->b_data;
+	char *raw = query->node->object.data;
 
 	if (query->len != sizeof(*omap_val))
 		return -EFSCORRUPTED;
@@ -8,10 +8,18 @@
 #ifndef _APFS_NODE_H
 #define _APFS_NODE_H
 
+#include <linux/cache.h>
+#include <linux/hashtable.h>
 #include <linux/kref.h>
+#include <linux/list.h>
+#include <linux/list_lru.h>
+#include <linux/rcupdate.h>
+#include <linux/shrinker.h>
+#include <linux/spinlock.h>
 #include <linux/types.h>
 #include "object.h"
 
+struct apfs_key;
 struct apfs_query;
 
 /*
@@ -39,6 +47,9 @@ struct apfs_omap_val {
 	__le64 ov_paddr;
 } __packed;
 
+/* Object map value flags */
+#define APFS_OMAP_VAL_DELETED		0x00000001
+
 /* B-tree node flags */
 #define APFS_BTNODE_ROOT		0x0001
 #define APFS_BTNODE_LEAF		0x0002
@@ -111,20 +122,96 @@ struct apfs_btree_info {
 	__le64 bt_node_count;
 } __packed;
 
+/*
+ * Decoded key of a node record, as stored in the table of contents of a
+ * cached node
+ */
+struct apfs_toc_entry {
+	u64 id;
+	u64 number;
+	u16 key_off;		/* Offset of the key in the block */
+	u16 key_len;		/* Length of the key */
+	u16 name_off;		/* Offset of the name in the block, or 0 */
+	u8 type;
+};
+
+/*
+ * Nodes with up to this many records are searched by a scan of their toc.  The
+ * scan is linear, so it stops paying off once bisection needs only a handful
+ * of steps.
+ */
+#define APFS_TOC_SCAN_MAX	16
+
+/* Bits for the state field of the in-memory node */
+enum {
+	APFS_NODE_HOT,		/* The node was found in the cache */
+	APFS_NODE_NO_TOC,	/* The keys can't be decoded */
+	APFS_NODE_NO_MAP,	/* The children can't be mapped at once */
+	APFS_NODE_PINNED,	/* Never evicted, and not refcounted */
+	APFS_NODE_REFERENCED,	/* Hit since the last pass of the lru */
+};
+
 /*
  * In-memory representation of an APFS node
  */
 struct apfs_node {
 	u16 flags;		/* Node flags */
+	struct kref refcount;	/* Fills the hole after @flags */
 	u32 records;		/* Number of records in the node */
 
 	int key;		/* Offset of the key area in the block */
 	int free;		/* Offset of the free area in the block */
 	int data;		/* Offset of the data area in the block */
 
+	unsigned long state;	/* Node state bits */
+	unsigned long time;	/* Jiffies when the node was read */
+	struct apfs_toc_entry *toc; /* Decoded keys, or NULL */
+	u64 *children;		/* Blocks of the virtual children, or NULL */
+
 	struct apfs_object object; /* Object holding the node */
 
-	struct kref refcount;
+	struct hlist_node hash;	/* Entry in the node cache hash table */
+	union {
+		/* Entry in the node cache lru or pinned list */
+		struct list_head lru;
+		/* Only used once the node is out of every list */
+		struct rcu_head rcu;
+	};
+};
+
+/* Node cache constants */
+#define APFS_NODE_CACHE_BITS		10
+#define APFS_NODE_CACHE_SHARD_BITS	4
+#define APFS_NODE_CACHE_SHARDS		(1 << APFS_NODE_CACHE_SHARD_BITS)
+#define APFS_NODE_CACHE_DEFAULT_SIZE	1024
+
+/*
+ * Part of the hash table of the node cache, with its own lock
+ */
+struct apfs_node_cache_shard {
+	spinlock_t lock;		/* Protects changes to @table */
+	DECLARE_HASHTABLE(table, APFS_NODE_CACHE_BITS -
+				 APFS_NODE_CACHE_SHARD_BITS);
+} ____cacheline_aligned_in_smp;
+
+/*
+ * Cache of parsed b-tree nodes for a mounted filesystem.  The filesystem is
+ * read-only, so a cached node never goes stale; entries are only dropped for
+ * lru eviction or under memory pressure.
+ *
+ * Lookups only take the rcu read lock.  Nodes are added and removed under the
+ * lock of their shard, which is chosen by block number, and the lru is kept
+ * for each NUMA node by the list_lru code; a hit doesn't move the node in its
+ * lru list, it just gets flagged so that eviction will give it another pass.
+ */
+struct apfs_node_cache {
+	struct apfs_node_cache_shard shards[APFS_NODE_CACHE_SHARDS];
+	struct list_lru lru;		/* Nodes that may be evicted */
+	spinlock_t pin_lock;		/* Protects @pinned and @nr_pinned */
+	struct list_head pinned;	/* Nodes kept until unmount */
+	unsigned long nr_pinned;	/* Number of pinned nodes */
+	unsigned long max;		/* Limit for the nodes in @lru */
+	struct shrinker shrinker;
 };
 
 /**
@@ -156,10 +243,27 @@ static inline bool apfs_node_has_fixed_kv_size(struct apfs_node *node)
 }
 
 extern struct apfs_node *apfs_read_node(struct super_block *sb, u64 block);
+extern struct apfs_node *apfs_read_cached_node(struct super_block *sb,
+					       u64 block);
+extern bool apfs_node_is_cached(struct super_block *sb, u64 block);
 extern int apfs_node_query(struct super_block *sb, struct apfs_query *query);
+extern int apfs_node_read_record(struct apfs_query *query, struct apfs_key *key);
+extern int apfs_node_seek(struct super_block *sb, struct apfs_query *query);
+extern int apfs_toc_scan(const struct apfs_toc_entry *toc, int end,
+			 const char *raw, const struct apfs_key *key);
 extern int apfs_bno_from_query(struct apfs_query *query, u64 *bno);
 
+extern unsigned int apfs_node_size(void);
+extern int apfs_node_init(void);
+extern void apfs_node_exit(void);
 extern void apfs_node_get(struct apfs_node *node);
 extern void apfs_node_put(struct apfs_node *node);
 
+extern int apfs_node_cache_init(struct super_block *sb);
+extern void apfs_node_cache_destroy(struct super_block *sb);
+extern void apfs_node_cache_set_max(struct super_block *sb, unsigned long max);
+extern unsigned long apfs_node_cache_collect(struct super_block *sb, u64 *bnos,
+					     unsigned long max);
+extern bool apfs_node_pin(struct apfs_node *node);
+
 #endif	/* _APFS_NODE_H */
@@ -5,24 +5,71 @@
  * Checksum routines for an APFS object
  */
 
+#include <linux/blkdev.h>
+#include <linux/buffer_head.h>
 #include <linux/fs.h>
+#include <linux/mm.h>
+#include <linux/pagemap.h>
+#include <linux/slab.h>
+#include <linux/vmalloc.h>
+#include <linux/wait_bit.h>
+#include <linux/workqueue.h>
+#include "fusion.h"
 #include "object.h"
+#include "specio.h"
+#include "stats.h"
+#include "super.h"
+
+/* Checks the nodes read ahead, off the path of the readers */
+static struct workqueue_struct *apfs_verify_wq;
+
+/*
+ * Checksum verification for a block that was read ahead
+ */
+struct apfs_verify_work {
+	struct work_struct work;
+	struct buffer_head *bh;
+	struct apfs_sb_info *sbi;	/* Mount that started the read */
+};
 
 /*
  * Note that this is not a generic implementation of fletcher64, as it assumes
  * a message length that doesn't overflow sum1 and sum2.  This constraint is ok
  * for apfs, though, since the block size is limited to 2^16.  For a more
  * generic optimized implementation, see Nakassis (1988).
+ *
+ * The main loop takes eight words at a time.  Over such a run sum1 grows by
+ * the total of the words, and sum2 by eight times the old sum1 plus the words
+ * weighted 8, 7, ..., 1; splitting the run in two halves keeps the dependency
+ * chains short, so this is about twice as fast as the word-at-a-time loop.
  */
 static u64 apfs_fletcher64(void *addr, size_t len)
 {
 	__le32 *buff = addr;
+	size_t count = len / sizeof(u32);
 	u64 sum1 = 0;
 	u64 sum2 = 0;
 	u64 c1, c2;
-	int i;
+	size_t i;
+
+	for (i = 0; i + 8 <= count; i += 8) {
+		u64 w0 = le32_to_cpu(buff[i]);
+		u64 w1 = le32_to_cpu(buff[i + 1]);
+		u64 w2 = le32_to_cpu(buff[i + 2]);
+		u64 w3 = le32_to_cpu(buff[i + 3]);
+		u64 w4 = le32_to_cpu(buff[i + 4]);
+		u64 w5 = le32_to_cpu(buff[i + 5]);
+		u64 w6 = le32_to_cpu(buff[i + 6]);
+		u64 w7 = le32_to_cpu(buff[i + 7]);
+		u64 lo = w0 + w1 + w2 + w3;
+		u64 hi = w4 + w5 + w6 + w7;
 
-	for (i = 0; i < len/sizeof(u32); i++) {
+		sum2 += 8 * sum1 + 4 * lo;
+		sum2 += 4 * w0 + 3 * w1 + 2 * w2 + w3;
+		sum2 += 4 * w4 + 3 * w5 + 2 * w6 + w7;
+		sum1 += lo + hi;
+	}
+	for (; i < count; i++) {
 		sum1 += le32_to_cpu(buff[i]);
 		sum2 += sum1;
 	}
@@ -41,3 +88,386 @@ int apfs_obj_verify_csum(struct super_block *sb, struct apfs_obj_phys *obj)
 		 apfs_fletcher64((char *) obj + APFS_MAX_CKSUM_SIZE,
 				 sb->s_blocksize - APFS_MAX_CKSUM_SIZE));
 }
+
+/**
+ * apfs_object_verify_csum - Verify the checksum of an object read in memory
+ * @obj:	the object
+ *
+ * The filesystem is read-only, so once the checksum of an object that fills
+ * its page has been verified, the page is marked and the result is reused
+ * for as long as it stays in the page cache.
+ */
+bool apfs_object_verify_csum(struct apfs_object *obj)
+{
+	struct apfs_obj_phys *raw = (struct apfs_obj_phys *)obj->data;
+	bool whole_page = obj->nr_pages == 1 && obj->size == PAGE_SIZE;
+
+	if (whole_page && PageChecked(obj->page))
+		return true;
+	if (le64_to_cpu(raw->o_cksum) !=
+	    apfs_fletcher64(obj->data + APFS_MAX_CKSUM_SIZE,
+			    obj->size - APFS_MAX_CKSUM_SIZE))
+		return false;
+	if (whole_page)
+		SetPageChecked(obj->page);
+	return true;
+}
+
+/* Blocks of an object submitted together by apfs_object_fetch() */
+#define APFS_FETCH_BATCH	16
+
+/**
+ * apfs_object_fetch - Read the blocks of an object as metadata
+ * @sb:		filesystem superblock
+ * @bdev:	device that holds the object
+ * @dev_bno:	first block of the object in @bdev
+ * @blocks:	number of blocks in the object
+ *
+ * The page cache would read the blocks as plain data, so lookups could end up
+ * queued behind bulk reads of files; instead, read the missing blocks here as
+ * priority metadata, plugged so that adjacent nodes are merged.  This is only
+ * a hint and it fails quietly; read_mapping_page() will take care of any
+ * block that is still not uptodate, and report the errors.
+ */
+static void apfs_object_fetch(struct super_block *sb, struct block_device *bdev,
+			      u64 dev_bno, unsigned int blocks)
+{
+	struct buffer_head *bhs[APFS_FETCH_BATCH];
+	struct blk_plug plug;
+	unsigned int i, nr;
+
+	while (blocks) {
+		for (nr = 0; nr < APFS_FETCH_BATCH && blocks; --blocks) {
+			struct buffer_head *bh;
+
+			bh = __getblk(bdev, dev_bno++, sb->s_blocksize);
+			if (!bh)
+				return;
+			if (buffer_uptodate(bh))
+				brelse(bh);
+			else
+				bhs[nr++] = bh;
+		}
+		if (!nr)
+			continue;
+
+		blk_start_plug(&plug);
+		ll_rw_block(REQ_OP_READ, REQ_META | REQ_PRIO, nr, bhs);
+		blk_finish_plug(&plug);
+		for (i = 0; i < nr; ++i) {
+			wait_on_buffer(bhs[i]);
+			brelse(bhs[i]);
+		}
+	}
+}
+
+/**
+ * apfs_meta_verify_done - Drop a block read ahead, once it has been checked
+ * @sbi:	in-memory superblock info of the mount that read it
+ * @bh:		the buffer
+ */
+static void apfs_meta_verify_done(struct apfs_sb_info *sbi,
+				  struct buffer_head *bh)
+{
+	put_bh(bh);
+	if (atomic_dec_and_test(&sbi->s_verify_pending))
+		wake_up_var(&sbi->s_verify_pending);
+}
+
+/**
+ * apfs_meta_verify_work - Verify the checksum of a block that was read ahead
+ * @work:	the work item, inside a struct apfs_verify_work
+ *
+ * The block fills its page, so it gets the same mark as in
+ * apfs_object_verify_csum() and the reader won't have to check it again.  A
+ * bad checksum is left for the reader to report.
+ */
+static void apfs_meta_verify_work(struct work_struct *work)
+{
+	struct apfs_verify_work *vw;
+	struct apfs_sb_info *sbi;
+	struct buffer_head *bh;
+	struct apfs_obj_phys *raw;
+
+	vw = container_of(work, struct apfs_verify_work, work);
+	bh = vw->bh;
+	sbi = vw->sbi;
+	raw = (struct apfs_obj_phys *)bh->b_data;
+	if (le64_to_cpu(raw->o_cksum) ==
+	    apfs_fletcher64(bh->b_data + APFS_MAX_CKSUM_SIZE,
+			    bh->b_size - APFS_MAX_CKSUM_SIZE))
+		SetPageChecked(bh->b_page);
+	kfree(vw);
+	apfs_meta_verify_done(sbi, bh);
+}
+
+/**
+ * apfs_meta_readahead_end_io - Completion of a metadata block read ahead
+ * @bh:		the buffer
+ * @uptodate:	was the read successful?
+ *
+ * Same as end_buffer_read_sync(), but the checksum gets verified by a worker
+ * as soon as the data arrives.  The reference to @bh is passed to the worker.
+ * The mount that started the read is in the private field of @bh.
+ */
+static void apfs_meta_readahead_end_io(struct buffer_head *bh, int uptodate)
+{
+	struct apfs_sb_info *sbi = bh->b_private;
+	struct apfs_verify_work *vw;
+
+	if (uptodate)
+		set_buffer_uptodate(bh);
+	else
+		clear_buffer_uptodate(bh);
+	unlock_buffer(bh);
+
+	if (!uptodate)
+		goto out;
+	vw = kmalloc(sizeof(*vw), GFP_ATOMIC | __GFP_NOWARN);
+	if (!vw)
+		goto out;
+	INIT_WORK(&vw->work, apfs_meta_verify_work);
+	vw->bh = bh;
+	vw->sbi = sbi;
+	queue_work(apfs_verify_wq, &vw->work);
+	return;
+out:
+	apfs_meta_verify_done(sbi, bh);
+}
+
+/**
+ * apfs_readahead_block - Start the read of a metadata block
+ * @sb:		filesystem superblock
+ * @bno:	block number
+ * @spec:	is the read speculative?
+ */
+static void apfs_readahead_block(struct super_block *sb, u64 bno, bool spec)
+{
+	struct buffer_head *bh = sb_getblk(sb, bno);
+
+	if (!bh)
+		return;
+	if (!trylock_buffer(bh)) {
+		/* Someone else is reading it already */
+		brelse(bh);
+		return;
+	}
+	if (buffer_uptodate(bh)) {
+		unlock_buffer(bh);
+		brelse(bh);
+		return;
+	}
+
+	/* Our reference goes to the completion */
+	if ((APFS_SB(sb)->s_flags & APFS_CHECK_NODES) &&
+	    sb->s_blocksize == PAGE_SIZE) {
+		atomic_inc(&APFS_SB(sb)->s_verify_pending);
+		bh->b_private = APFS_SB(sb);
+		bh->b_end_io = apfs_meta_readahead_end_io;
+	} else {
+		bh->b_end_io = end_buffer_read_sync;
+	}
+	if (spec)
+		apfs_spec_submit_bh(sb, REQ_META, bh);
+	else
+		submit_bh(REQ_OP_READ, REQ_META | REQ_RAHEAD, bh);
+}
+
+/**
+ * apfs_meta_readahead - Start the read of a metadata block
+ * @sb:		filesystem superblock
+ * @bno:	block number
+ *
+ * Like sb_breadahead(), but the request is marked as metadata.  Callers that
+ * read ahead several blocks should plug them together, so that the adjacent
+ * ones get merged.
+ *
+ * If the checksums of the nodes are checked, and a block fills a page, the
+ * check is done when the read completes instead of by the reader that later
+ * uses it.
+ */
+void apfs_meta_readahead(struct super_block *sb, u64 bno)
+{
+	apfs_readahead_block(sb, bno, false /* spec */);
+}
+
+/**
+ * apfs_spec_readahead - Start a speculative read of a metadata block
+ * @sb:		filesystem superblock
+ * @bno:	block number
+ *
+ * Same as apfs_meta_readahead(), for blocks that nobody is waiting for yet,
+ * so that the request follows the specio mount option.
+ */
+void apfs_spec_readahead(struct super_block *sb, u64 bno)
+{
+	apfs_readahead_block(sb, bno, true /* spec */);
+}
+
+/**
+ * apfs_meta_verify_flush - Wait for the checks of the nodes read ahead
+ * @sb:	filesystem superblock
+ *
+ * Called on unmount, so that no read or worker of the mount still holds
+ * buffers of the device, or uses its superblock info after it's freed.  The
+ * reads ahead of other mounts are not waited for.
+ */
+void apfs_meta_verify_flush(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+
+	wait_var_event(&sbi->s_verify_pending,
+		       !atomic_read(&sbi->s_verify_pending));
+}
+
+/**
+ * apfs_object_init - Create the workqueue for the checksums of read ahead nodes
+ *
+ * Returns 0 on success, or -ENOMEM in case of failure.
+ */
+int __init apfs_object_init(void)
+{
+	apfs_verify_wq = alloc_workqueue("apfs-verify", WQ_UNBOUND, 0);
+	if (!apfs_verify_wq)
+		return -ENOMEM;
+	return 0;
+}
+
+/**
+ * apfs_object_exit - Destroy the workqueue for the checksums
+ */
+void apfs_object_exit(void)
+{
+	destroy_workqueue(apfs_verify_wq);
+}
+
+/**
+ * apfs_object_read - Read an object through the page cache of the device
+ * @sb:		filesystem superblock
+ * @bno:	first block of the object
+ * @blocks:	number of blocks in the object
+ * @obj:	on return, the object, with its data mapped
+ *
+ * Objects that fit in a single page are used in place.  Bigger ones get their
+ * pages mapped together with vmap().  Only the sb, block_nr, data, size and
+ * page fields of @obj are set.  Returns 0 on success, or a negative error code
+ * in case of failure.
+ */
+int apfs_object_read(struct super_block *sb, u64 bno, unsigned int blocks,
+		     struct apfs_object *obj)
+{
+	struct address_space *mapping;
+	struct block_device *bdev;
+	unsigned int bits = PAGE_SHIFT - sb->s_blocksize_bits;
+	unsigned int size = blocks << sb->s_blocksize_bits;
+	unsigned int off, nr_pages;
+	struct page **pages;
+	pgoff_t first;
+	u64 dev_bno, count;
+	void *vaddr;
+	int err, i;
+
+	if (!blocks || blocks > APFS_OBJECT_MAX_BLOCKS)
+		return -EINVAL;
+
+	/* Fusion containers may keep the object in either device */
+	err = apfs_fusion_map(sb, bno, &bdev, &dev_bno, &count);
+	if (err)
+		return err;
+	if (count < blocks)
+		return -EOPNOTSUPP;
+	mapping = bdev->bd_inode->i_mapping;
+	first = dev_bno >> bits;
+	off = (dev_bno & ((1 << bits) - 1)) << sb->s_blocksize_bits;
+	nr_pages = DIV_ROUND_UP(off + size, PAGE_SIZE);
+
+	obj->sb = sb;
+	obj->block_nr = bno;
+	obj->size = size;
+	obj->nr_pages = nr_pages;
+	apfs_stat_add(sb, APFS_STAT_META_BYTES, size);
+
+	/* The slow device of a Fusion container may use another block size */
+	if (bdev == sb->s_bdev)
+		apfs_object_fetch(sb, bdev, dev_bno, blocks);
+
+	if (nr_pages == 1) {
+		struct page *page = read_mapping_page(mapping, first, NULL);
+
+		if (IS_ERR(page))
+			return PTR_ERR(page);
+		obj->page = page;
+		obj->data = page_address(page) + off;
+		return 0;
+	}
+
+	pages = kmalloc_array(nr_pages, sizeof(*pages), GFP_KERNEL);
+	if (!pages)
+		return -ENOMEM;
+	for (i = 0; i < nr_pages; ++i) {
+		pages[i] = read_mapping_page(mapping, first + i, NULL);
+		if (IS_ERR(pages[i])) {
+			err = PTR_ERR(pages[i]);
+			goto fail;
+		}
+	}
+	vaddr = vmap(pages, nr_pages, VM_MAP, PAGE_KERNEL);
+	if (!vaddr) {
+		err = -ENOMEM;
+		goto fail;
+	}
+	obj->pages = pages;
+	obj->data = vaddr + off;
+	return 0;
+
+fail:
+	while (i--)
+		put_page(pages[i]);
+	kfree(pages);
+	return err;
+}
+
+/**
+ * apfs_object_drop_buffers - Free the buffer heads of an object's page
+ * @obj:	object read by apfs_object_read()
+ *
+ * Reads through the page cache of the device leave buffer heads attached to
+ * the page, and these would stay there for as long as a cache holds on to the
+ * object.  Nothing needs them once the data is mapped, so they are dropped as
+ * soon as possible instead of waiting for reclaim.  Busy buffers, or a page
+ * that someone else has locked, are left alone.  Objects that span several
+ * pages are rare enough to not be worth the trouble.
+ */
+void apfs_object_drop_buffers(struct apfs_object *obj)
+{
+	struct page *page = obj->page;
+
+	if (obj->nr_pages != 1 || !page_has_buffers(page))
+		return;
+	if (!trylock_page(page))
+		return;
+	if (page->mapping)
+		try_to_free_buffers(page);
+	unlock_page(page);
+}
+
+/**
+ * apfs_object_release - Release the pages of an object
+ * @obj:	object read by apfs_object_read()
+ */
+void apfs_object_release(struct apfs_object *obj)
+{
+	int i;
+
+	if (!obj->data)
+		return;
+	if (obj->nr_pages == 1) {
+		put_page(obj->page);
+	} else {
+		vunmap((void *)((unsigned long)obj->data & PAGE_MASK));
+		for (i = 0; i < obj->nr_pages; ++i)
+			put_page(obj->pages[i]);
+		kfree(obj->pages);
+	}
+	obj->data = NULL;
+}
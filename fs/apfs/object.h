@@ -10,6 +10,9 @@
 
 #include <linux/types.h>
 
+struct page;
+struct super_block;
+
 /* Object identifiers constants */
 #define APFS_OID_NX_SUPERBLOCK			1
 #define APFS_OID_INVALID			0ULL
@@ -71,23 +74,39 @@ struct apfs_obj_phys {
 } __packed;
 
 /*
- * In-memory representation of an APFS object
+ * In-memory representation of an APFS object.  Its blocks are read through
+ * the page cache of the block device, and only page references are kept.
  */
 struct apfs_object {
 	struct super_block *sb;
 	u64 block_nr;
 	u64 oid;		/* Often the same as the block number */
 
-	/*
-	 * Buffer head containing the one block of the object.  TODO: support
-	 * objects with more than one block.
-	 */
-	struct buffer_head *bh;
+	char *data;		/* Contents of the object, mapped in memory */
+	unsigned int size;	/* Length of @data, a whole number of blocks */
+	unsigned int nr_pages;	/* Number of pages that hold the object */
+	union {
+		struct page *page;	/* The page, if there is only one */
+		struct page **pages;	/* All of them, vmapped, otherwise */
+	};
 };
 
 #define APFS_MAX_CKSUM_SIZE 8
 
+/* Largest object that can be read in memory, in blocks */
+#define APFS_OBJECT_MAX_BLOCKS	64
+
 extern int apfs_obj_verify_csum(struct super_block *sb,
 				struct apfs_obj_phys *obj);
+extern bool apfs_object_verify_csum(struct apfs_object *obj);
+extern int apfs_object_read(struct super_block *sb, u64 bno,
+			    unsigned int blocks, struct apfs_object *obj);
+extern void apfs_object_drop_buffers(struct apfs_object *obj);
+extern void apfs_object_release(struct apfs_object *obj);
+extern void apfs_meta_readahead(struct super_block *sb, u64 bno);
+extern void apfs_spec_readahead(struct super_block *sb, u64 bno);
+extern void apfs_meta_verify_flush(struct super_block *sb);
+extern int apfs_object_init(void);
+extern void apfs_object_exit(void);
 
 #endif	/* _APFS_OBJECT_H */
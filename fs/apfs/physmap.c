@@ -0,0 +1,356 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/physmap.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ *
+ * File extents of a whole volume, or of a directory tree, in the order of
+ * their physical blocks.  Archivers that read the files in this order make a
+ * single sweep over the disk instead of seeking back and forth.
+ */
+
+#include <linux/fs.h>
+#include <linux/mm.h>
+#include <linux/sched/signal.h>
+#include <linux/slab.h>
+#include <linux/sort.h>
+#include <linux/uaccess.h>
+#include "apfs.h"
+#include "btree.h"
+#include "dir.h"
+#include "extents.h"
+#include "inode.h"
+#include "ioctl.h"
+#include "key.h"
+#include "message.h"
+#include "physmap.h"
+#include "super.h"
+
+/*
+ * Growable list of ids
+ */
+struct apfs_id_list {
+	u64 *ids;
+	unsigned long nr;
+	unsigned long alloc;
+};
+
+/*
+ * Lowest extents found so far by a scan
+ */
+struct apfs_physmap {
+	struct apfs_extent_entry after;	/* Position given by the user */
+	struct apfs_extent_entry *ents;
+	u32 nr;
+	u32 count;			/* Extents wanted by the user */
+	u32 alloc;			/* Twice @count, to sort less often */
+	bool bounded;			/* Is @bound set? */
+	struct apfs_extent_entry bound;	/* Only lower extents are needed */
+};
+
+static int apfs_id_list_add(struct apfs_id_list *list, u64 id)
+{
+	if (list->nr == list->alloc) {
+		unsigned long alloc = list->alloc ? 2 * list->alloc : 64;
+		u64 *ids;
+
+		ids = kvmalloc_array(alloc, sizeof(*ids), GFP_KERNEL);
+		if (!ids)
+			return -ENOMEM;
+		if (list->nr)
+			memcpy(ids, list->ids, list->nr * sizeof(*ids));
+		kvfree(list->ids);
+		list->ids = ids;
+		list->alloc = alloc;
+	}
+	list->ids[list->nr++] = id;
+	return 0;
+}
+
+static int apfs_id_cmp(const void *a, const void *b)
+{
+	u64 id_a = *(const u64 *)a;
+	u64 id_b = *(const u64 *)b;
+
+	if (id_a == id_b)
+		return 0;
+	return id_a < id_b ? -1 : 1;
+}
+
+static int apfs_extent_entry_cmp(const void *a, const void *b)
+{
+	const struct apfs_extent_entry *ea = a, *eb = b;
+
+	if (ea->ee_block != eb->ee_block)
+		return ea->ee_block < eb->ee_block ? -1 : 1;
+	if (ea->ee_id != eb->ee_id)
+		return ea->ee_id < eb->ee_id ? -1 : 1;
+	if (ea->ee_offset != eb->ee_offset)
+		return ea->ee_offset < eb->ee_offset ? -1 : 1;
+	return 0;
+}
+
+/**
+ * apfs_physmap_add - Consider a file extent for the reply
+ * @pm:		state of the scan
+ * @id:		extent id of the file
+ * @extent:	the file extent
+ *
+ * Only the lowest @pm->count extents are kept.  Instead of a heap, the array
+ * has room for twice as many, and it gets sorted and cut in half whenever it
+ * fills up.
+ */
+static void apfs_physmap_add(struct apfs_physmap *pm, u64 id,
+			     struct apfs_file_extent *extent)
+{
+	struct apfs_extent_entry ent;
+
+	if (!extent->phys_block_num) /* Holes have no blocks to read */
+		return;
+	ent.ee_block = extent->phys_block_num;
+	ent.ee_id = id;
+	ent.ee_offset = extent->logical_addr;
+	ent.ee_length = extent->len;
+
+	if (apfs_extent_entry_cmp(&ent, &pm->after) <= 0)
+		return;
+	if (pm->bounded && apfs_extent_entry_cmp(&ent, &pm->bound) >= 0)
+		return;
+
+	pm->ents[pm->nr++] = ent;
+	if (pm->nr == pm->alloc) {
+		sort(pm->ents, pm->nr, sizeof(ent), apfs_extent_entry_cmp,
+		     NULL);
+		pm->nr = pm->count;
+		pm->bound = pm->ents[pm->count - 1];
+		pm->bounded = true;
+	}
+}
+
+/**
+ * apfs_physmap_scan - Consider the file extents for one id, or for all
+ * @sb:		filesystem superblock
+ * @pm:		state of the scan
+ * @id:		extent id of the file, ignored if @all is set
+ * @all:	scan the whole catalog?
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_physmap_scan(struct super_block *sb, struct apfs_physmap *pm,
+			     u64 id, bool all)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_key key;
+	struct apfs_query query;
+	int err;
+
+	apfs_init_file_extent_key(all ? 0 : id, 0 /* offset */, &key);
+	apfs_btree_iter_init(&query, sbi->s_cat_root, &key, APFS_QUERY_CAT |
+			     (all ? APFS_QUERY_ANY_ID : APFS_QUERY_ANY_NUMBER));
+
+	for (err = apfs_btree_iter_seek(sb, &query); !err;
+	     err = apfs_btree_iter_next(sb, &query)) {
+		struct apfs_file_extent extent;
+		struct apfs_key curr_key;
+
+		err = apfs_node_read_record(&query, &curr_key);
+		if (err)
+			break;
+		if (curr_key.type != APFS_TYPE_FILE_EXTENT)
+			continue;
+		err = apfs_extent_from_query(&query, &extent);
+		if (err) {
+			apfs_alert(sb, "bad extent record for 0x%llx",
+				   curr_key.id);
+			break;
+		}
+		apfs_physmap_add(pm, curr_key.id, &extent);
+
+		if (fatal_signal_pending(current)) {
+			err = -EINTR;
+			break;
+		}
+		cond_resched();
+	}
+	apfs_free_query(sb, &query);
+	return err == -ENODATA ? 0 : err;
+}
+
+/**
+ * apfs_physmap_extent_id - Find the extent id of a regular file
+ * @sb:		filesystem superblock
+ * @cnid:	inode number of the file
+ * @id:		on return, the extent id
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_physmap_extent_id(struct super_block *sb, u64 cnid, u64 *id)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_inode_val *inode_val;
+	struct apfs_key key;
+	struct apfs_query query;
+	int err;
+
+	apfs_init_inode_key(cnid, &key);
+	apfs_init_query(&query, sbi->s_cat_root);
+	query.key = &key;
+	query.flags |= APFS_QUERY_CAT | APFS_QUERY_EXACT;
+
+	err = apfs_btree_query(sb, &query);
+	if (err == -ENODATA) {
+		apfs_alert(sb, "dentry for missing inode 0x%llx", cnid);
+		err = -EFSCORRUPTED;
+	}
+	if (err)
+		goto out;
+	if (query.len < sizeof(*inode_val)) {
+		apfs_alert(sb, "bad inode record for inode 0x%llx", cnid);
+		err = -EFSCORRUPTED;
+		goto out;
+	}
+	inode_val = (struct apfs_inode_val *)(query.node->object.data +
+					      query.off);
+	*id = le64_to_cpu(inode_val->private_id);
+out:
+	apfs_free_query(sb, &query);
+	return err;
+}
+
+/**
+ * apfs_physmap_subtree - Find the extent ids of the files in a directory tree
+ * @sb:		filesystem superblock
+ * @root:	inode number of the directory
+ * @ids:	on return, the sorted extent ids, without duplicates
+ *
+ * The directories are visited breadth first, so only one catalog iterator is
+ * in use at a time.  Returns 0 on success, or a negative error code in case
+ * of failure.
+ */
+static int apfs_physmap_subtree(struct super_block *sb, u64 root,
+				struct apfs_id_list *ids)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_id_list dirs = {0};
+	unsigned long i, nr;
+	int err;
+
+	err = apfs_id_list_add(&dirs, root);
+	for (i = 0; !err && i < dirs.nr; i++) {
+		struct apfs_key key;
+		struct apfs_query query;
+
+		apfs_init_drec_hashed_key(sb, dirs.ids[i], NULL /* name */,
+					  &key);
+		apfs_btree_iter_init(&query, sbi->s_cat_root, &key,
+				     APFS_QUERY_CAT | APFS_QUERY_MULTIPLE);
+
+		for (err = apfs_btree_iter_seek(sb, &query); !err;
+		     err = apfs_btree_iter_next(sb, &query)) {
+			struct apfs_drec drec;
+			u64 id;
+
+			err = apfs_drec_from_query(&query, &drec);
+			if (err) {
+				apfs_alert(sb, "bad dentry record in directory 0x%llx",
+					   dirs.ids[i]);
+				break;
+			}
+			if (drec.type == DT_DIR) {
+				err = apfs_id_list_add(&dirs, drec.ino);
+			} else if (drec.type == DT_REG) {
+				err = apfs_physmap_extent_id(sb, drec.ino, &id);
+				if (!err)
+					err = apfs_id_list_add(ids, id);
+			}
+			if (err)
+				break;
+
+			if (fatal_signal_pending(current)) {
+				err = -EINTR;
+				break;
+			}
+			cond_resched();
+		}
+		apfs_free_query(sb, &query);
+		if (err == -ENODATA)
+			err = 0;
+	}
+	kvfree(dirs.ids);
+	if (err)
+		return err;
+
+	/* Hard links show up once for each of their parents */
+	sort(ids->ids, ids->nr, sizeof(u64), apfs_id_cmp, NULL);
+	for (i = 0, nr = 0; i < ids->nr; i++) {
+		if (nr && ids->ids[nr - 1] == ids->ids[i])
+			continue;
+		ids->ids[nr++] = ids->ids[i];
+	}
+	ids->nr = nr;
+	return 0;
+}
+
+/**
+ * apfs_physmap - Report file extents in the order of their physical blocks
+ * @inode:	inode the ioctl was called on
+ * @req:	the request, already checked by the caller
+ * @ubuf:	user buffer for the extents
+ *
+ * Every call makes a single pass over the file extent records, and keeps the
+ * lowest extents that come after the position in @req; the position is then
+ * moved to the last extent reported, and a count of zero on return means that
+ * no extents are left.  With APFS_EXTENTS_SUBTREE, only the files under
+ * @inode are considered, and their extents are searched directly instead of
+ * scanning the whole catalog.  Returns 0 on success, or a negative error code
+ * in case of failure.
+ */
+int apfs_physmap(struct inode *inode, struct apfs_extents_req *req,
+		 struct apfs_extent_entry __user *ubuf)
+{
+	struct super_block *sb = inode->i_sb;
+	struct apfs_physmap pm = {
+		.after = {
+			.ee_block = req->er_block,
+			.ee_id = req->er_id,
+			.ee_offset = req->er_offset,
+		},
+		.count = req->er_count,
+		.alloc = 2 * req->er_count,
+	};
+	struct apfs_id_list ids = {0};
+	unsigned long i;
+	int err;
+
+	pm.ents = kvmalloc_array(pm.alloc, sizeof(*pm.ents), GFP_KERNEL);
+	if (!pm.ents)
+		return -ENOMEM;
+
+	if (req->er_flags & APFS_EXTENTS_SUBTREE) {
+		err = apfs_physmap_subtree(sb, apfs_ino(inode), &ids);
+		for (i = 0; !err && i < ids.nr; i++)
+			err = apfs_physmap_scan(sb, &pm, ids.ids[i], false);
+		kvfree(ids.ids);
+	} else {
+		err = apfs_physmap_scan(sb, &pm, 0 /* id */, true);
+	}
+	if (err)
+		goto out;
+
+	sort(pm.ents, pm.nr, sizeof(*pm.ents), apfs_extent_entry_cmp, NULL);
+	req->er_count = min(pm.nr, pm.count);
+	if (copy_to_user(ubuf, pm.ents, req->er_count * sizeof(*pm.ents))) {
+		err = -EFAULT;
+		goto out;
+	}
+	if (req->er_count) {
+		struct apfs_extent_entry *last = &pm.ents[req->er_count - 1];
+
+		req->er_block = last->ee_block;
+		req->er_id = last->ee_id;
+		req->er_offset = last->ee_offset;
+	}
+out:
+	kvfree(pm.ents);
+	return err;
+}
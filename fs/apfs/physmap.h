@@ -0,0 +1,21 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/physmap.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_PHYSMAP_H
+#define _APFS_PHYSMAP_H
+
+#include <linux/compiler.h>
+#include <linux/types.h>
+
+struct apfs_extent_entry;
+struct apfs_extents_req;
+struct inode;
+
+extern int apfs_physmap(struct inode *inode, struct apfs_extents_req *req,
+			struct apfs_extent_entry __user *ubuf);
+
+#endif	/* _APFS_PHYSMAP_H */
@@ -0,0 +1,262 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/prefetch.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ *
+ * Prefetch of the catalog records for a whole directory tree, so that a job
+ * that is about to walk it finds the metadata already in the node cache.  The
+ * directories are scanned breadth first; the inodes found in them, and then
+ * the first extents of the regular files, are looked up in sorted batches,
+ * each with a single walk of the catalog.
+ */
+
+#include <linux/fs.h>
+#include <linux/mm.h>
+#include <linux/sched/signal.h>
+#include <linux/slab.h>
+#include <linux/sort.h>
+#include <linux/uaccess.h>
+#include "apfs.h"
+#include "btree.h"
+#include "dir.h"
+#include "inode.h"
+#include "ioctl.h"
+#include "key.h"
+#include "message.h"
+#include "prefetch.h"
+#include "super.h"
+
+/*
+ * State of a prefetch
+ */
+struct apfs_prefetch {
+	struct super_block *sb;
+	struct apfs_prefetch_req *req;		/* Counters for the progress */
+	struct apfs_prefetch_req __user *argp;	/* Where to report them */
+
+	u64 *dirs;		/* Queue of directories to scan */
+	unsigned long nr_dirs;
+	unsigned long alloc_dirs;
+
+	unsigned int batch;	/* Most records for a single walk */
+	u64 *cnids;		/* Inodes found in the directories */
+	unsigned int nr_cnids;
+	u64 *ext_ids;		/* Extent ids of the regular files */
+	unsigned int nr_ext_ids;
+	struct apfs_key *keys;	/* Keys for the current walk */
+};
+
+static int apfs_prefetch_id_cmp(const void *a, const void *b)
+{
+	u64 id_a = *(const u64 *)a;
+	u64 id_b = *(const u64 *)b;
+
+	return id_a < id_b ? -1 : id_a > id_b;
+}
+
+/**
+ * apfs_prefetch_sort - Sort a list of ids and drop the duplicates
+ * @ids:	the list
+ * @nr:		number of ids
+ *
+ * Returns the number of ids left.
+ */
+static unsigned int apfs_prefetch_sort(u64 *ids, unsigned int nr)
+{
+	unsigned int i, count = 0;
+
+	sort(ids, nr, sizeof(*ids), apfs_prefetch_id_cmp, NULL);
+	for (i = 0; i < nr; i++) {
+		if (count && ids[count - 1] == ids[i])
+			continue;
+		ids[count++] = ids[i];
+	}
+	return count;
+}
+
+static int apfs_prefetch_add_dir(struct apfs_prefetch *pf, u64 cnid)
+{
+	if (pf->nr_dirs == pf->alloc_dirs) {
+		unsigned long alloc = pf->alloc_dirs ? 2 * pf->alloc_dirs : 64;
+		u64 *dirs;
+
+		dirs = kvmalloc_array(alloc, sizeof(*dirs), GFP_KERNEL);
+		if (!dirs)
+			return -ENOMEM;
+		if (pf->nr_dirs)
+			memcpy(dirs, pf->dirs, pf->nr_dirs * sizeof(*dirs));
+		kvfree(pf->dirs);
+		pf->dirs = dirs;
+		pf->alloc_dirs = alloc;
+	}
+	pf->dirs[pf->nr_dirs++] = cnid;
+	return 0;
+}
+
+static int apfs_prefetch_inode_actor(struct apfs_query *query, int idx,
+				     void *data)
+{
+	struct apfs_prefetch *pf = data;
+	struct apfs_inode_val *inode_val;
+
+	if (query->len < sizeof(*inode_val)) {
+		apfs_alert(pf->sb, "bad inode record for inode 0x%llx",
+			   pf->keys[idx].id);
+		return -EFSCORRUPTED;
+	}
+	inode_val = (struct apfs_inode_val *)(query->node->object.data +
+					      query->off);
+	pf->req->pf_inodes++;
+	if (S_ISREG(le16_to_cpu(inode_val->mode)))
+		pf->ext_ids[pf->nr_ext_ids++] =
+					le64_to_cpu(inode_val->private_id);
+	return 0;
+}
+
+static int apfs_prefetch_extent_actor(struct apfs_query *query, int idx,
+				      void *data)
+{
+	struct apfs_prefetch *pf = data;
+
+	pf->req->pf_extents++;
+	return 0;
+}
+
+/**
+ * apfs_prefetch_flush - Load the records for the inodes found so far
+ * @pf:		the prefetch, with its list of inodes left empty on return
+ *
+ * The progress is reported to the user after every batch, so that it can be
+ * followed from another thread.  Returns 0 on success, or a negative error
+ * code in case of failure.
+ */
+static int apfs_prefetch_flush(struct apfs_prefetch *pf)
+{
+	struct super_block *sb = pf->sb;
+	struct apfs_node *root = APFS_SB(sb)->s_cat_root;
+	unsigned int i, nr;
+	int err;
+
+	nr = apfs_prefetch_sort(pf->cnids, pf->nr_cnids);
+	pf->nr_cnids = 0;
+	for (i = 0; i < nr; i++)
+		apfs_init_inode_key(pf->cnids[i], &pf->keys[i]);
+	pf->nr_ext_ids = 0;
+	err = apfs_btree_query_batch(sb, root, pf->keys, nr, APFS_QUERY_CAT,
+				     apfs_prefetch_inode_actor, pf);
+	if (err)
+		return err;
+
+	/* Not all files have extents, so some of them won't be found */
+	nr = apfs_prefetch_sort(pf->ext_ids, pf->nr_ext_ids);
+	for (i = 0; i < nr; i++)
+		apfs_init_file_extent_key(pf->ext_ids[i], 0 /* offset */,
+					  &pf->keys[i]);
+	err = apfs_btree_query_batch(sb, root, pf->keys, nr, APFS_QUERY_CAT,
+				     apfs_prefetch_extent_actor, pf);
+	if (err)
+		return err;
+
+	if (copy_to_user(pf->argp, pf->req, sizeof(*pf->req)))
+		return -EFAULT;
+	return 0;
+}
+
+/**
+ * apfs_prefetch_dir - Scan the records of a directory
+ * @pf:		the prefetch
+ * @cnid:	inode number of the directory
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_prefetch_dir(struct apfs_prefetch *pf, u64 cnid)
+{
+	struct super_block *sb = pf->sb;
+	struct apfs_key key;
+	struct apfs_query query;
+	int err;
+
+	apfs_init_drec_hashed_key(sb, cnid, NULL /* name */, &key);
+	apfs_btree_iter_init(&query, APFS_SB(sb)->s_cat_root, &key,
+			     APFS_QUERY_CAT | APFS_QUERY_MULTIPLE);
+
+	for (err = apfs_btree_iter_seek(sb, &query); !err;
+	     err = apfs_btree_iter_next(sb, &query)) {
+		struct apfs_drec drec;
+
+		err = apfs_drec_from_query(&query, &drec);
+		if (err) {
+			apfs_alert(sb, "bad dentry record in directory 0x%llx",
+				   cnid);
+			break;
+		}
+		if (drec.type == DT_DIR) {
+			err = apfs_prefetch_add_dir(pf, drec.ino);
+			if (err)
+				break;
+		}
+		pf->cnids[pf->nr_cnids++] = drec.ino;
+		if (pf->nr_cnids == pf->batch) {
+			err = apfs_prefetch_flush(pf);
+			if (err)
+				break;
+		}
+
+		if (fatal_signal_pending(current)) {
+			err = -EINTR;
+			break;
+		}
+		cond_resched();
+	}
+	apfs_free_query(sb, &query);
+	if (err == -ENODATA)
+		err = 0;
+	if (!err)
+		pf->req->pf_dirs++;
+	return err;
+}
+
+/**
+ * apfs_prefetch - Load the catalog records for a directory tree
+ * @dir:	root of the tree
+ * @req:	the request, already checked by the caller
+ * @argp:	user address of the request, for the progress reports
+ *
+ * The dentry, inode and first file extent records of the whole tree end up
+ * in the node cache.  Each walk issues at most APFS_BTREE_RA_MAX reads
+ * ahead of the one it waits on, and walks never overlap, so the reads in
+ * flight are bounded no matter the size of the tree.  Returns 0 on success,
+ * or a negative error code in case of failure.
+ */
+int apfs_prefetch(struct inode *dir, struct apfs_prefetch_req *req,
+		  struct apfs_prefetch_req __user *argp)
+{
+	struct apfs_prefetch pf = {0};
+	unsigned long i;
+	int err;
+
+	pf.sb = dir->i_sb;
+	pf.req = req;
+	pf.argp = argp;
+	pf.batch = req->pf_batch;
+	pf.cnids = kvmalloc_array(pf.batch, sizeof(*pf.cnids), GFP_KERNEL);
+	pf.ext_ids = kvmalloc_array(pf.batch, sizeof(*pf.ext_ids), GFP_KERNEL);
+	pf.keys = kvmalloc_array(pf.batch, sizeof(*pf.keys), GFP_KERNEL);
+	if (!pf.cnids || !pf.ext_ids || !pf.keys) {
+		err = -ENOMEM;
+		goto out;
+	}
+
+	err = apfs_prefetch_add_dir(&pf, apfs_ino(dir));
+	for (i = 0; !err && i < pf.nr_dirs; i++)
+		err = apfs_prefetch_dir(&pf, pf.dirs[i]);
+	if (!err)
+		err = apfs_prefetch_flush(&pf);
+out:
+	kvfree(pf.keys);
+	kvfree(pf.ext_ids);
+	kvfree(pf.cnids);
+	kvfree(pf.dirs);
+	return err;
+}
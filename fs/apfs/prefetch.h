@@ -0,0 +1,20 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/prefetch.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_PREFETCH_H
+#define _APFS_PREFETCH_H
+
+#include <linux/compiler.h>
+#include <linux/types.h>
+
+struct apfs_prefetch_req;
+struct inode;
+
+extern int apfs_prefetch(struct inode *dir, struct apfs_prefetch_req *req,
+			 struct apfs_prefetch_req __user *argp);
+
+#endif	/* _APFS_PREFETCH_H */
@@ -0,0 +1,228 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/revmap.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ *
+ * Owners of physical blocks, found through the extent reference tree.  Every
+ * allocated extent has a record there, keyed by its first block, that names
+ * the extent id of the file that owns it.  The logical offset then comes from
+ * the file extents of that id alone, so no catalog scan is needed.
+ */
+
+#include <linux/sched/signal.h>
+#include <linux/uaccess.h>
+#include "apfs.h"
+#include "btree.h"
+#include "extents.h"
+#include "ioctl.h"
+#include "key.h"
+#include "message.h"
+#include "node.h"
+#include "revmap.h"
+#include "super.h"
+
+/**
+ * apfs_revmap_offset - Find the logical address of a block in its owner
+ * @sb:		filesystem superblock
+ * @owner:	extent id of the owner
+ * @bno:	the physical block
+ * @offset:	on return, the logical address in bytes, or APFS_OWNER_NO_OFFSET
+ *		if no file extent of @owner maps @bno
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_revmap_offset(struct super_block *sb, u64 owner, u64 bno,
+			      u64 *offset)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_key key;
+	struct apfs_query query;
+	int err;
+
+	*offset = APFS_OWNER_NO_OFFSET;
+	apfs_init_file_extent_key(owner, 0 /* offset */, &key);
+	apfs_btree_iter_init(&query, sbi->s_cat_root, &key,
+			     APFS_QUERY_CAT | APFS_QUERY_ANY_NUMBER);
+
+	for (err = apfs_btree_iter_seek(sb, &query); !err;
+	     err = apfs_btree_iter_next(sb, &query)) {
+		struct apfs_file_extent ext;
+		u64 blocks;
+
+		err = apfs_extent_from_query(&query, &ext);
+		if (err) {
+			apfs_alert(sb, "bad extent record for 0x%llx", owner);
+			break;
+		}
+		blocks = ext.len >> sb->s_blocksize_bits;
+		if (ext.phys_block_num && bno >= ext.phys_block_num &&
+		    bno - ext.phys_block_num < blocks) {
+			*offset = ext.logical_addr +
+				  ((bno - ext.phys_block_num) <<
+				   sb->s_blocksize_bits);
+			break;
+		}
+	}
+	apfs_free_query(sb, &query);
+	return err == -ENODATA ? 0 : err;
+}
+
+/**
+ * apfs_revmap_first - Find where a scan of the extent reference tree starts
+ * @sb:		filesystem superblock
+ * @root:	root of the extent reference tree
+ * @bno:	first block of interest
+ * @start:	on return, the first block number to look for in the keys
+ *
+ * The extent that covers @bno, if any, is keyed by an earlier block, so it
+ * would be missed by a scan that starts at @bno.  Returns 0 on success, or
+ * a negative error code in case of failure.
+ */
+static int apfs_revmap_first(struct super_block *sb, struct apfs_node *root,
+			     u64 bno, u64 *start)
+{
+	struct apfs_phys_ext_val *val;
+	struct apfs_key key, curr_key;
+	struct apfs_query query;
+	u64 len;
+	int err;
+
+	*start = bno;
+	apfs_init_phys_ext_key(bno, &key);
+	apfs_init_query(&query, root);
+	query.key = &key;
+	query.flags = APFS_QUERY_EXTENTREF;
+
+	/* Find the last physical extent that starts at or before @bno */
+	err = apfs_btree_query(sb, &query);
+	if (err) {
+		if (err == -ENODATA)
+			err = 0;
+		goto out;
+	}
+	err = apfs_node_read_record(&query, &curr_key);
+	if (err || curr_key.type != APFS_TYPE_EXTENT)
+		goto out;
+	if (query.len < sizeof(*val)) {
+		apfs_alert(sb, "bad physical extent record for block 0x%llx",
+			   curr_key.id);
+		err = -EFSCORRUPTED;
+		goto out;
+	}
+	val = (struct apfs_phys_ext_val *)(query.node->object.data +
+					   query.off);
+	len = le64_to_cpu(val->len_and_kind) & APFS_PEXT_LEN_MASK;
+	if (bno - curr_key.id < len)
+		*start = curr_key.id;
+out:
+	apfs_free_query(sb, &query);
+	return err;
+}
+
+/**
+ * apfs_revmap - Report the owners of a range of physical blocks
+ * @sb:		filesystem superblock
+ * @req:	the request, already checked by the caller
+ * @ubuf:	user buffer for the entries
+ *
+ * Each physical extent that overlaps the range gets an entry, clipped to the
+ * range, with the logical address of its first reported block in the owner.
+ * Returns 0 on success, or a negative error code in case of failure; on
+ * success @req is updated with the entries filled and the block to continue
+ * from.
+ */
+int apfs_revmap(struct super_block *sb, struct apfs_owners_req *req,
+		struct apfs_owner_entry __user *ubuf)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_node *root;
+	struct apfs_key key, end_key;
+	struct apfs_query query;
+	u64 start, next = req->or_block;
+	u32 done = 0;
+	int err;
+
+	root = apfs_read_node(sb,
+			le64_to_cpu(sbi->s_vsb_raw->apfs_extentref_tree_oid));
+	if (IS_ERR(root)) {
+		apfs_err(sb, "unable to read the extent reference tree");
+		return PTR_ERR(root);
+	}
+
+	err = apfs_revmap_first(sb, root, req->or_block, &start);
+	if (err)
+		goto out_put;
+
+	apfs_init_phys_ext_key(start, &key);
+	apfs_init_phys_ext_key(req->or_end, &end_key);
+	apfs_btree_iter_range(&query, root, &key, &end_key,
+			      APFS_QUERY_EXTENTREF);
+
+	for (err = apfs_btree_iter_seek(sb, &query);
+	     !err && done < req->or_count;
+	     err = apfs_btree_iter_next(sb, &query)) {
+		struct apfs_phys_ext_val *val;
+		struct apfs_owner_entry ent;
+		struct apfs_key curr_key;
+		u64 len_and_kind, len, first, last;
+
+		err = apfs_node_read_record(&query, &curr_key);
+		if (err)
+			break;
+		if (curr_key.type != APFS_TYPE_EXTENT)
+			continue;
+		if (query.len < sizeof(*val)) {
+			apfs_alert(sb, "bad physical extent record for block 0x%llx",
+				   curr_key.id);
+			err = -EFSCORRUPTED;
+			break;
+		}
+		val = (struct apfs_phys_ext_val *)(query.node->object.data +
+						   query.off);
+		len_and_kind = le64_to_cpu(val->len_and_kind);
+		len = len_and_kind & APFS_PEXT_LEN_MASK;
+
+		first = max(curr_key.id, req->or_block);
+		last = min(curr_key.id + len, req->or_end);
+		if (first >= last) /* Ends before the range */
+			continue;
+
+		memset(&ent, 0, sizeof(ent));
+		ent.oe_block = first;
+		ent.oe_count = last - first;
+		ent.oe_owner = le64_to_cpu(val->owning_obj_id);
+		ent.oe_refcnt = le32_to_cpu(val->refcnt);
+		ent.oe_kind = (len_and_kind & APFS_PEXT_KIND_MASK) >>
+			      APFS_PEXT_KIND_SHIFT;
+		err = apfs_revmap_offset(sb, ent.oe_owner, first,
+					 &ent.oe_offset);
+		if (err)
+			break;
+		if (copy_to_user(&ubuf[done], &ent, sizeof(ent))) {
+			err = -EFAULT;
+			break;
+		}
+		done++;
+		next = last;
+
+		if (fatal_signal_pending(current)) {
+			err = -EINTR;
+			break;
+		}
+		cond_resched();
+	}
+	apfs_free_query(sb, &query);
+	if (err == -ENODATA) /* Got to the end of the range */
+		err = 0;
+	/* Don't lose the entries already copied */
+	if (err && done)
+		err = 0;
+	if (!err) {
+		req->or_count = done;
+		req->or_block = done ? next : req->or_end;
+	}
+out_put:
+	apfs_node_put(root);
+	return err;
+}
@@ -0,0 +1,21 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/revmap.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_REVMAP_H
+#define _APFS_REVMAP_H
+
+#include <linux/compiler.h>
+#include <linux/types.h>
+
+struct apfs_owner_entry;
+struct apfs_owners_req;
+struct super_block;
+
+extern int apfs_revmap(struct super_block *sb, struct apfs_owners_req *req,
+		       struct apfs_owner_entry __user *ubuf);
+
+#endif	/* _APFS_REVMAP_H */
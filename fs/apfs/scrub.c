@@ -0,0 +1,435 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/scrub.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#include <linux/blkdev.h>
+#include <linux/buffer_head.h>
+#include <linux/ioprio.h>
+#include <linux/kobject.h>
+#include <linux/kthread.h>
+#include <linux/mm.h>
+#include <linux/sched.h>
+#include <linux/sort.h>
+#include "apfs.h"
+#include "btree.h"
+#include "message.h"
+#include "node.h"
+#include "object.h"
+#include "scrub.h"
+#include "super.h"
+
+/*
+ * Leaf blocks found by a scrub, waiting to be verified
+ */
+struct apfs_scrub_batch {
+	u64 *bnos;		/* Block numbers of the leaves */
+	unsigned int nr;	/* Number of entries in @bnos */
+};
+
+static int apfs_scrub_bno_cmp(const void *a, const void *b)
+{
+	u64 bno_a = *(const u64 *)a;
+	u64 bno_b = *(const u64 *)b;
+
+	return bno_a < bno_b ? -1 : bno_a > bno_b;
+}
+
+/**
+ * apfs_scrub_report - Record a node that failed verification
+ * @scrub:	scrub structure
+ * @bno:	block number of the node
+ * @err:	error found
+ */
+static void apfs_scrub_report(struct apfs_scrub *scrub, u64 bno, int err)
+{
+	spin_lock(&scrub->lock);
+	if (scrub->nr_bad < APFS_SCRUB_MAX_BAD)
+		scrub->bad[scrub->nr_bad] = bno;
+	scrub->nr_bad++;
+	spin_unlock(&scrub->lock);
+
+	apfs_alert(scrub->sb, "scrub found bad node in block 0x%llx (%d)",
+		   bno, err);
+}
+
+/**
+ * apfs_scrub_checked - Count a node as verified
+ * @scrub:	scrub structure
+ */
+static inline void apfs_scrub_checked(struct apfs_scrub *scrub)
+{
+	spin_lock(&scrub->lock);
+	scrub->checked++;
+	spin_unlock(&scrub->lock);
+}
+
+/**
+ * apfs_scrub_object - Verify the checksum of a node in memory
+ * @scrub:	scrub structure
+ * @obj:	the node object
+ */
+static void apfs_scrub_object(struct apfs_scrub *scrub, struct apfs_object *obj)
+{
+	apfs_scrub_checked(scrub);
+	if (!apfs_object_verify_csum(obj))
+		apfs_scrub_report(scrub, obj->block_nr, -EFSBADCRC);
+}
+
+/**
+ * apfs_scrub_flush - Verify a batch of leaves in block order
+ * @scrub:	scrub structure
+ * @batch:	the batch, which is left empty
+ *
+ * The leaves are never parsed, so they don't displace the nodes in the cache.
+ * Returns 0 on success, or -EINTR if the scrub was stopped.
+ */
+static int apfs_scrub_flush(struct apfs_scrub *scrub,
+			    struct apfs_scrub_batch *batch)
+{
+	struct super_block *sb = scrub->sb;
+	struct blk_plug plug;
+	unsigned int i;
+	int err = 0;
+
+	sort(batch->bnos, batch->nr, sizeof(*batch->bnos),
+	     apfs_scrub_bno_cmp, NULL);
+
+	/* Blocks of the slow device of a Fusion container can't be hinted */
+	if (!APFS_SB(sb)->s_nxi->nx_tier2_bdev) {
+		blk_start_plug(&plug);
+		for (i = 0; i < batch->nr; ++i)
+			apfs_spec_readahead(sb, batch->bnos[i]);
+		blk_finish_plug(&plug);
+	}
+
+	for (i = 0; i < batch->nr; ++i) {
+		struct apfs_object obj;
+		int res;
+
+		if (kthread_should_stop()) {
+			err = -EINTR;
+			break;
+		}
+
+		res = apfs_object_read(sb, batch->bnos[i], 1 /* blocks */,
+				       &obj);
+		if (res) {
+			apfs_scrub_report(scrub, batch->bnos[i], res);
+			continue;
+		}
+		apfs_scrub_object(scrub, &obj);
+		apfs_object_release(&obj);
+		cond_resched();
+	}
+
+	batch->nr = 0;
+	return err;
+}
+
+/**
+ * apfs_scrub_tree - Verify all the nodes of a b-tree
+ * @scrub:	scrub structure
+ * @node:	root of the subtree, already verified by the caller
+ * @flags:	tree type
+ * @batch:	batch of leaves to verify
+ *
+ * Index nodes are verified as the tree is walked; leaves are only collected,
+ * and verified in block order once the batch is full.  Returns 0 on success,
+ * -EINTR if the scrub was stopped, or another negative error code if the tree
+ * could not be walked.
+ */
+static int apfs_scrub_tree(struct apfs_scrub *scrub, struct apfs_node *node,
+			   unsigned int flags, struct apfs_scrub_batch *batch)
+{
+	struct super_block *sb = scrub->sb;
+	struct apfs_btree_node_phys *raw;
+	struct apfs_query query;
+	bool leaf_parent;
+	int err = 0;
+
+	if (apfs_node_is_leaf(node))
+		return 0;
+	raw = (struct apfs_btree_node_phys *)node->object.data;
+	leaf_parent = le16_to_cpu(raw->btn_level) == 1;
+
+	apfs_init_query(&query, node);
+	query.flags = flags;
+	for (query.index = 0; query.index < node->records; query.index++) {
+		struct apfs_node *child;
+		u64 child_id, child_blk;
+
+		if (kthread_should_stop()) {
+			err = -EINTR;
+			break;
+		}
+
+		err = apfs_node_read_record(&query, NULL /* key */);
+		if (err)
+			break;
+		err = apfs_query_child_block(sb, &query, &child_id, &child_blk);
+		if (err)
+			break;
+
+		if (leaf_parent) {
+			batch->bnos[batch->nr++] = child_blk;
+			if (batch->nr == APFS_SCRUB_BATCH) {
+				err = apfs_scrub_flush(scrub, batch);
+				if (err)
+					break;
+			}
+			continue;
+		}
+
+		child = apfs_read_node(sb, child_blk);
+		if (IS_ERR(child)) {
+			/* The subtree can't be walked, but the scrub goes on */
+			apfs_scrub_report(scrub, child_blk, PTR_ERR(child));
+			continue;
+		}
+		apfs_scrub_object(scrub, &child->object);
+		err = apfs_scrub_tree(scrub, child, flags, batch);
+		apfs_node_put(child);
+		if (err)
+			break;
+		cond_resched();
+	}
+	apfs_free_query(sb, &query);
+	return err;
+}
+
+/**
+ * apfs_scrub_root - Verify all the nodes of a b-tree of the volume
+ * @scrub:	scrub structure
+ * @root:	root of the tree
+ * @flags:	tree type
+ * @batch:	empty batch of leaves
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_scrub_root(struct apfs_scrub *scrub, struct apfs_node *root,
+			   unsigned int flags, struct apfs_scrub_batch *batch)
+{
+	int err;
+
+	apfs_scrub_object(scrub, &root->object);
+	err = apfs_scrub_tree(scrub, root, flags, batch);
+	if (!err)
+		err = apfs_scrub_flush(scrub, batch);
+	return err;
+}
+
+/**
+ * apfs_scrub_notify - Report the end of a scrub to userspace
+ * @scrub:	scrub structure
+ */
+static void apfs_scrub_notify(struct apfs_scrub *scrub)
+{
+	struct super_block *sb = scrub->sb;
+	char result[32], nodes[48], bad[48];
+	char *envp[] = { result, nodes, bad, NULL };
+
+	spin_lock(&scrub->lock);
+	snprintf(result, sizeof(result), "APFS_SCRUB_RESULT=%d", scrub->result);
+	snprintf(nodes, sizeof(nodes), "APFS_SCRUB_NODES=%lu", scrub->checked);
+	snprintf(bad, sizeof(bad), "APFS_SCRUB_BAD=%lu", scrub->nr_bad);
+	spin_unlock(&scrub->lock);
+
+	kobject_uevent_env(&APFS_SB(sb)->s_kobj, KOBJ_CHANGE, envp);
+}
+
+/**
+ * apfs_scrub_thread - Verify the checksums of the omap and catalog nodes
+ * @data:	scrub structure
+ *
+ * The thread runs at idle io priority, so that the scrub only uses the disk
+ * when nobody else needs it.  Once the walk is over, the thread waits to be
+ * stopped, so that apfs_scrub_stop() never has to race with its exit.
+ */
+static int apfs_scrub_thread(void *data)
+{
+	struct apfs_scrub *scrub = data;
+	struct super_block *sb = scrub->sb;
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_scrub_batch batch = {0};
+	int err;
+
+	set_task_ioprio(current, IOPRIO_PRIO_VALUE(IOPRIO_CLASS_IDLE, 0));
+
+	batch.bnos = kvmalloc_array(APFS_SCRUB_BATCH, sizeof(*batch.bnos),
+				    GFP_KERNEL);
+	if (!batch.bnos) {
+		err = -ENOMEM;
+		goto out;
+	}
+
+	err = apfs_scrub_root(scrub, sbi->s_omap_root, APFS_QUERY_OMAP, &batch);
+	if (!err)
+		err = apfs_scrub_root(scrub, sbi->s_cat_root, APFS_QUERY_CAT,
+				      &batch);
+	kvfree(batch.bnos);
+
+out:
+	spin_lock(&scrub->lock);
+	scrub->running = false;
+	scrub->result = err;
+	spin_unlock(&scrub->lock);
+
+	if (err == -EINTR)
+		apfs_info(sb, "scrub stopped");
+	else if (err)
+		apfs_warn(sb, "scrub failed (%d)", err);
+	else
+		apfs_info(sb, "scrub verified %lu nodes, %lu bad",
+			  scrub->checked, scrub->nr_bad);
+	apfs_scrub_notify(scrub);
+
+	while (true) {
+		set_current_state(TASK_INTERRUPTIBLE);
+		if (kthread_should_stop())
+			break;
+		schedule();
+	}
+	__set_current_state(TASK_RUNNING);
+	return 0;
+}
+
+/**
+ * apfs_scrub_init - Set up the scrub structure for a new mount
+ * @sb:	filesystem superblock
+ */
+void apfs_scrub_init(struct super_block *sb)
+{
+	struct apfs_scrub *scrub = &APFS_SB(sb)->s_scrub;
+
+	scrub->sb = sb;
+	mutex_init(&scrub->mutex);
+	scrub->task = NULL;
+	scrub->dead = false;
+	spin_lock_init(&scrub->lock);
+	scrub->running = false;
+	scrub->result = 0;
+	scrub->checked = 0;
+	scrub->nr_bad = 0;
+}
+
+/**
+ * apfs_scrub_start - Start a new scrub of the mounted volume
+ * @scrub:	scrub structure
+ *
+ * Returns 0 on success, -EBUSY if a scrub is already running or the volume is
+ * being unmounted, or another negative error code in case of failure.
+ */
+int apfs_scrub_start(struct apfs_scrub *scrub)
+{
+	struct task_struct *task;
+	int err = 0;
+
+	mutex_lock(&scrub->mutex);
+	if (scrub->dead || (scrub->task && READ_ONCE(scrub->running))) {
+		err = -EBUSY;
+		goto out;
+	}
+	if (scrub->task)
+		kthread_stop(scrub->task);
+	scrub->task = NULL;
+
+	spin_lock(&scrub->lock);
+	scrub->running = true;
+	scrub->result = 0;
+	scrub->checked = 0;
+	scrub->nr_bad = 0;
+	spin_unlock(&scrub->lock);
+
+	task = kthread_run(apfs_scrub_thread, scrub, "apfs-scrub/%s",
+			   scrub->sb->s_id);
+	if (IS_ERR(task)) {
+		spin_lock(&scrub->lock);
+		scrub->running = false;
+		spin_unlock(&scrub->lock);
+		err = PTR_ERR(task);
+		goto out;
+	}
+	scrub->task = task;
+out:
+	mutex_unlock(&scrub->mutex);
+	return err;
+}
+
+/**
+ * apfs_scrub_cancel - Stop the running scrub of a volume, if any
+ * @scrub:	scrub structure
+ */
+void apfs_scrub_cancel(struct apfs_scrub *scrub)
+{
+	mutex_lock(&scrub->mutex);
+	if (scrub->task)
+		kthread_stop(scrub->task);
+	scrub->task = NULL;
+	mutex_unlock(&scrub->mutex);
+}
+
+/**
+ * apfs_scrub_stop - Stop the scrubs of a volume for good
+ * @sb:	filesystem superblock
+ *
+ * Must be called on unmount, before the trees and the sysfs directory are
+ * released.
+ */
+void apfs_scrub_stop(struct super_block *sb)
+{
+	struct apfs_scrub *scrub = &APFS_SB(sb)->s_scrub;
+
+	mutex_lock(&scrub->mutex);
+	scrub->dead = true;
+	mutex_unlock(&scrub->mutex);
+	apfs_scrub_cancel(scrub);
+}
+
+/**
+ * apfs_scrub_show_state - Print the state of the last scrub for sysfs
+ * @scrub:	scrub structure
+ * @buf:	page to print to
+ */
+ssize_t apfs_scrub_show_state(struct apfs_scrub *scrub, char *buf)
+{
+	unsigned long checked, nr_bad;
+	bool running;
+	int result;
+
+	spin_lock(&scrub->lock);
+	running = scrub->running;
+	result = scrub->result;
+	checked = scrub->checked;
+	nr_bad = scrub->nr_bad;
+	spin_unlock(&scrub->lock);
+
+	if (running)
+		return sprintf(buf, "running %lu %lu\n", checked, nr_bad);
+	if (!checked && !result)
+		return sprintf(buf, "idle\n");
+	if (result == -EINTR)
+		return sprintf(buf, "stopped %lu %lu\n", checked, nr_bad);
+	if (result)
+		return sprintf(buf, "failed %lu %lu\n", checked, nr_bad);
+	return sprintf(buf, "done %lu %lu\n", checked, nr_bad);
+}
+
+/**
+ * apfs_scrub_show_bad - Print the first bad blocks found by a scrub for sysfs
+ * @scrub:	scrub structure
+ * @buf:	page to print to
+ */
+ssize_t apfs_scrub_show_bad(struct apfs_scrub *scrub, char *buf)
+{
+	unsigned long i;
+	ssize_t len = 0;
+
+	spin_lock(&scrub->lock);
+	for (i = 0; i < scrub->nr_bad && i < APFS_SCRUB_MAX_BAD; ++i)
+		len += sprintf(buf + len, "0x%llx\n", scrub->bad[i]);
+	spin_unlock(&scrub->lock);
+	return len;
+}
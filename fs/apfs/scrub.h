@@ -0,0 +1,48 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/scrub.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_SCRUB_H
+#define _APFS_SCRUB_H
+
+#include <linux/mutex.h>
+#include <linux/spinlock.h>
+#include <linux/types.h>
+
+struct super_block;
+struct task_struct;
+
+/* Leaf blocks to sort and verify together */
+#define APFS_SCRUB_BATCH	4096
+
+/* Most bad block numbers to remember for sysfs */
+#define APFS_SCRUB_MAX_BAD	64
+
+/*
+ * Background verification of the checksums of all the b-tree nodes
+ */
+struct apfs_scrub {
+	struct super_block *sb;
+	struct mutex mutex;		/* Serializes starts and stops */
+	struct task_struct *task;	/* Scrub thread, or NULL */
+	bool dead;			/* Set on unmount */
+
+	spinlock_t lock;		/* Protects the fields below */
+	bool running;			/* The thread is still walking */
+	int result;			/* Result of the last scrub */
+	unsigned long checked;		/* Nodes verified so far */
+	unsigned long nr_bad;		/* Bad nodes found so far */
+	u64 bad[APFS_SCRUB_MAX_BAD];	/* First bad blocks found */
+};
+
+extern void apfs_scrub_init(struct super_block *sb);
+extern int apfs_scrub_start(struct apfs_scrub *scrub);
+extern void apfs_scrub_cancel(struct apfs_scrub *scrub);
+extern void apfs_scrub_stop(struct super_block *sb);
+extern ssize_t apfs_scrub_show_state(struct apfs_scrub *scrub, char *buf);
+extern ssize_t apfs_scrub_show_bad(struct apfs_scrub *scrub, char *buf);
+
+#endif	/* _APFS_SCRUB_H */
@@ -0,0 +1,209 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/sibling.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ *
+ * Hard links, as described by the sibling records of an inode
+ */
+
+#include <linux/fs.h>
+#include <linux/slab.h>
+#include "apfs.h"
+#include "btree.h"
+#include "inode.h"
+#include "key.h"
+#include "message.h"
+#include "node.h"
+#include "sibling.h"
+#include "super.h"
+
+/* Links to allocate room for at first, if the link count is not trusted */
+#define APFS_SIBLINGS_INITIAL	16
+
+/**
+ * apfs_sibling_from_query - Read the sibling link found by a query
+ * @query:	the query that found the record
+ * @sibling:	Return parameter.  The sibling link found.
+ *
+ * Reads the sibling link record into @sibling and performs some basic sanity
+ * checks as a protection against crafted filesystems.  Returns 0 on success
+ * or -EFSCORRUPTED otherwise.
+ *
+ * The caller must not free @query while @sibling is in use, because
+ * @sibling->name points to data on disk.
+ */
+static int apfs_sibling_from_query(struct apfs_query *query,
+				   struct apfs_sibling *sibling)
+{
+	char *raw = query->node->object.data;
+	struct apfs_sibling_link_key *key;
+	struct apfs_sibling_val *val;
+	int namelen;
+
+	if (query->key_len != sizeof(*key) || query->len < sizeof(*val))
+		return -EFSCORRUPTED;
+
+	key = (struct apfs_sibling_link_key *)(raw + query->key_off);
+	val = (struct apfs_sibling_val *)(raw + query->off);
+	namelen = le16_to_cpu(val->name_len);
+	if (namelen < 1 || namelen > APFS_NAME_LEN + 1)
+		return -EFSCORRUPTED;
+	if (namelen != query->len - sizeof(*val))
+		return -EFSCORRUPTED;
+
+	/* The name must be NULL-terminated */
+	if (val->name[namelen - 1] != 0)
+		return -EFSCORRUPTED;
+
+	sibling->id = le64_to_cpu(key->sibling_id);
+	sibling->parent_id = le64_to_cpu(val->parent_id);
+	sibling->name = val->name;
+	sibling->name_len = namelen - 1; /* Don't count the NULL termination */
+	return 0;
+}
+
+/**
+ * apfs_siblings_destroy - Free a set of hard links
+ * @siblings:	the set to free
+ */
+static void apfs_siblings_destroy(struct apfs_siblings *siblings)
+{
+	int i;
+
+	for (i = 0; i < siblings->nr; i++)
+		kfree(siblings->links[i].name);
+	kfree(siblings);
+}
+
+/**
+ * apfs_siblings_read - Read all the hard links of an inode from the catalog
+ * @inode:	the inode
+ *
+ * Returns the new set of links, or an error pointer in case of failure.
+ */
+static struct apfs_siblings *apfs_siblings_read(struct inode *inode)
+{
+	struct super_block *sb = inode->i_sb;
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_siblings *siblings, *new;
+	struct apfs_key key;
+	struct apfs_query query;
+	u64 cnid = apfs_ino(inode);
+	unsigned int max = min_t(unsigned int, inode->i_nlink,
+				 APFS_SIBLINGS_INITIAL);
+	int err;
+
+	siblings = kmalloc(sizeof(*siblings) + max * sizeof(siblings->links[0]),
+			   GFP_KERNEL);
+	if (!siblings)
+		return ERR_PTR(-ENOMEM);
+	siblings->nr = 0;
+
+	apfs_init_sibling_link_key(cnid, &key);
+	apfs_btree_iter_init(&query, sbi->s_cat_root, &key,
+			     APFS_QUERY_CAT | APFS_QUERY_ANY_NUMBER);
+
+	err = apfs_btree_iter_seek(sb, &query);
+	for (; !err; err = apfs_btree_iter_next(sb, &query)) {
+		struct apfs_sibling *link;
+
+		/* There is one sibling record for each link, no more */
+		if (siblings->nr == inode->i_nlink) {
+			err = -EFSCORRUPTED;
+			break;
+		}
+		if (siblings->nr == max) {
+			max = min(2 * max, inode->i_nlink);
+			new = krealloc(siblings, sizeof(*siblings) +
+				       max * sizeof(siblings->links[0]),
+				       GFP_KERNEL);
+			if (!new) {
+				err = -ENOMEM;
+				break;
+			}
+			siblings = new;
+		}
+
+		link = &siblings->links[siblings->nr];
+		err = apfs_sibling_from_query(&query, link);
+		if (err)
+			break;
+		link->name = kmemdup(link->name, link->name_len + 1,
+				     GFP_KERNEL);
+		if (!link->name) {
+			err = -ENOMEM;
+			break;
+		}
+		siblings->nr++;
+	}
+	apfs_free_query(sb, &query);
+
+	if (err == -ENODATA) /* Got all the links */
+		return siblings;
+	if (err == -EFSCORRUPTED)
+		apfs_alert(sb, "bad sibling records for inode 0x%llx", cnid);
+	apfs_siblings_destroy(siblings);
+	return ERR_PTR(err);
+}
+
+/**
+ * apfs_siblings_get - Get all the hard links of an inode
+ * @inode:	the inode
+ *
+ * The links are read from the catalog on the first call, and kept in memory
+ * until the inode goes away.  Returns the set of links, which is empty if the
+ * inode has none, or an error pointer in case of failure.
+ */
+struct apfs_siblings *apfs_siblings_get(struct inode *inode)
+{
+	struct apfs_inode_info *ai = APFS_I(inode);
+	struct apfs_siblings *siblings, *old;
+
+	siblings = READ_ONCE(ai->i_siblings);
+	if (siblings)
+		return siblings;
+
+	siblings = apfs_siblings_read(inode);
+	if (IS_ERR(siblings))
+		return siblings;
+	old = cmpxchg(&ai->i_siblings, NULL, siblings);
+	if (old) { /* Another reader got here first */
+		apfs_siblings_destroy(siblings);
+		return old;
+	}
+	return siblings;
+}
+
+/**
+ * apfs_sibling_by_parent - Find a hard link of an inode in a given directory
+ * @siblings:	all the hard links of the inode
+ * @parent_id:	inode number of the directory
+ *
+ * Returns the first link found, or NULL if there is none.
+ */
+const struct apfs_sibling *apfs_sibling_by_parent(
+				struct apfs_siblings *siblings, u64 parent_id)
+{
+	int i;
+
+	for (i = 0; i < siblings->nr; i++) {
+		if (siblings->links[i].parent_id == parent_id)
+			return &siblings->links[i];
+	}
+	return NULL;
+}
+
+/**
+ * apfs_siblings_free - Release the hard links of an inode
+ * @inode:	the inode, which is being destroyed
+ */
+void apfs_siblings_free(struct inode *inode)
+{
+	struct apfs_inode_info *ai = APFS_I(inode);
+
+	if (!ai->i_siblings)
+		return;
+	apfs_siblings_destroy(ai->i_siblings);
+	ai->i_siblings = NULL;
+}
@@ -0,0 +1,57 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/sibling.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_SIBLING_H
+#define _APFS_SIBLING_H
+
+#include <linux/types.h>
+
+struct inode;
+
+/*
+ * Structure of the value of a sibling link record.  There is one of these
+ * for each hard link to an inode.
+ */
+struct apfs_sibling_val {
+	__le64 parent_id;
+	__le16 name_len;
+	u8 name[0];
+} __packed;
+
+/*
+ * Structure of the value of a sibling map record, which maps a sibling id
+ * back to its inode
+ */
+struct apfs_sibling_map_val {
+	__le64 file_id;
+} __packed;
+
+/*
+ * Hard link of an inode, as read from its sibling link record
+ */
+struct apfs_sibling {
+	u64 id;				/* Sibling id, as in the dentry */
+	u64 parent_id;			/* Inode number of the parent */
+	const char *name;		/* Null-terminated name of the link */
+	unsigned int name_len;		/* Length of @name without the null */
+};
+
+/*
+ * All the hard links of an inode.  They never change after the set gets
+ * published, so it lives as long as the inode.
+ */
+struct apfs_siblings {
+	int nr;				/* Number of links */
+	struct apfs_sibling links[];
+};
+
+extern struct apfs_siblings *apfs_siblings_get(struct inode *inode);
+extern const struct apfs_sibling *apfs_sibling_by_parent(
+				struct apfs_siblings *siblings, u64 parent_id);
+extern void apfs_siblings_free(struct inode *inode);
+
+#endif	/* _APFS_SIBLING_H */
@@ -0,0 +1,447 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/snapdiff.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ *
+ * Changes in the catalog between two transactions, found through the object
+ * map.  The catalog is copy-on-write, so a node that changed after the base
+ * transaction has a new mapping in the omap, and an omap node that gained
+ * such a mapping was itself written after the base.  The whole omap subtrees
+ * that are older than the base can then be skipped, and only the catalog
+ * leaves with a new version are compared, record by record.
+ */
+
+#include <linux/sched/signal.h>
+#include <linux/string.h>
+#include <linux/uaccess.h>
+#include "apfs.h"
+#include "btree.h"
+#include "extents.h"
+#include "ioctl.h"
+#include "key.h"
+#include "message.h"
+#include "node.h"
+#include "snapdiff.h"
+#include "super.h"
+
+/*
+ * State of a snapshot diff request
+ */
+struct apfs_snapdiff {
+	struct super_block *sb;
+	u64 base;			/* Xid of the older version */
+	u64 target;			/* Xid of the newer version */
+	u64 next;			/* Lowest node id not compared yet */
+
+	struct apfs_diff_entry __user *ubuf;
+	u32 count;			/* Size of @ubuf */
+	u32 done;			/* Entries copied to @ubuf */
+
+	u64 start;			/* First node id of the request */
+	u32 start_skip;			/* Changes of @start already reported */
+	u64 oid;			/* Node being compared */
+	u32 seen;			/* Changes of @oid found so far */
+	u32 skip;			/* Changes of @oid to leave out */
+};
+
+/**
+ * apfs_snapdiff_lookup - Find the block of a virtual object at a given xid
+ * @sb:		filesystem superblock
+ * @oid:	virtual object id
+ * @xid:	transaction id
+ * @bno:	on return, the block number
+ *
+ * Unlike apfs_omap_lookup_block(), this doesn't use the mounted xid, and the
+ * omap cache is not involved.  Returns 0 on success, -ENODATA if the object
+ * didn't exist at that point, or another negative error code in case of
+ * failure.
+ */
+static int apfs_snapdiff_lookup(struct super_block *sb, u64 oid, u64 xid,
+				u64 *bno)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_omap_val *omap_val;
+	struct apfs_query query;
+	struct apfs_key key;
+	int err;
+
+	apfs_init_query(&query, sbi->s_omap_root);
+	apfs_init_omap_key(oid, xid, &key);
+	query.key = &key;
+	query.flags |= APFS_QUERY_OMAP;
+
+	err = apfs_btree_query(sb, &query);
+	if (err)
+		goto out;
+	if (query.len != sizeof(*omap_val)) {
+		apfs_alert(sb, "bad object map leaf block: 0x%llx",
+			   query.node->object.block_nr);
+		err = -EFSCORRUPTED;
+		goto out;
+	}
+	omap_val = (struct apfs_omap_val *)
+			(query.node->object.data + query.off);
+	if (le32_to_cpu(omap_val->ov_flags) & APFS_OMAP_VAL_DELETED)
+		err = -ENODATA;
+	else
+		*bno = le64_to_cpu(omap_val->ov_paddr);
+out:
+	apfs_free_query(sb, &query);
+	return err;
+}
+
+/**
+ * apfs_snapdiff_read - Read the version of a catalog leaf at a given xid
+ * @sb:		filesystem superblock
+ * @oid:	virtual object id of the node
+ * @xid:	transaction id
+ *
+ * Returns the node with a reference taken, NULL if there was no such catalog
+ * leaf at that point, or an error pointer in case of failure.
+ */
+static struct apfs_node *apfs_snapdiff_read(struct super_block *sb, u64 oid,
+					    u64 xid)
+{
+	struct apfs_node *node;
+	struct apfs_obj_phys *obj;
+	u64 bno;
+	int err;
+
+	err = apfs_snapdiff_lookup(sb, oid, xid, &bno);
+	if (err == -ENODATA)
+		return NULL;
+	if (err)
+		return ERR_PTR(err);
+
+	node = apfs_read_node(sb, bno);
+	if (IS_ERR(node))
+		return node;
+	if (node->object.oid != oid) {
+		apfs_alert(sb, "bad node id in block 0x%llx", bno);
+		apfs_node_put(node);
+		return ERR_PTR(-EFSCORRUPTED);
+	}
+
+	/* Index nodes hold no records, and other trees are not of interest */
+	obj = (struct apfs_obj_phys *)node->object.data;
+	if (le32_to_cpu(obj->o_subtype) != APFS_OBJECT_TYPE_FSTREE ||
+	    !apfs_node_is_leaf(node)) {
+		apfs_node_put(node);
+		return NULL;
+	}
+	return node;
+}
+
+/**
+ * apfs_snapdiff_emit - Report a changed catalog record to the user
+ * @diff:	state of the request
+ * @query:	query positioned on the record
+ * @key:	key of the record
+ * @change:	kind of change, one of the APFS_DIFF_* values
+ *
+ * Returns 0 on success, 1 if the user buffer is full, or a negative error
+ * code in case of failure.
+ */
+static int apfs_snapdiff_emit(struct apfs_snapdiff *diff,
+			      struct apfs_query *query, struct apfs_key *key,
+			      u32 change)
+{
+	struct apfs_diff_entry de = {0};
+
+	/* Reported by an earlier call that ran out of room in this node */
+	if (diff->seen < diff->skip) {
+		diff->seen++;
+		return 0;
+	}
+	if (diff->done == diff->count)
+		return 1;
+
+	de.de_id = key->id;
+	de.de_type = key->type;
+	de.de_change = change;
+	if (key->type == APFS_TYPE_FILE_EXTENT) {
+		struct apfs_file_extent_val *ext;
+
+		if (query->len != sizeof(*ext))
+			return -EFSCORRUPTED;
+		ext = (struct apfs_file_extent_val *)
+				(query->node->object.data + query->off);
+		de.de_offset = key->number;
+		de.de_length = le64_to_cpu(ext->len_and_flags) &
+			       APFS_FILE_EXTENT_LEN_MASK;
+	}
+	if (copy_to_user(&diff->ubuf[diff->done], &de, sizeof(de)))
+		return -EFAULT;
+	diff->done++;
+	diff->seen++;
+	return 0;
+}
+
+/**
+ * apfs_snapdiff_leaves - Compare two versions of a catalog leaf
+ * @diff:	state of the request
+ * @base:	older version of the leaf (may be NULL)
+ * @target:	newer version of the leaf (may be NULL)
+ *
+ * Both leaves are sorted, so they are merged in a single pass.  Returns 0 on
+ * success, 1 if the user buffer is full, or a negative error code in case of
+ * failure.
+ */
+static int apfs_snapdiff_leaves(struct apfs_snapdiff *diff,
+				struct apfs_node *base,
+				struct apfs_node *target)
+{
+	struct super_block *sb = diff->sb;
+	struct apfs_query bq, tq;
+	struct apfs_key bkey, tkey;
+	int bn = 0, tn = 0;
+	int err = 0;
+
+	bq.index = tq.index = 0;
+	if (base) {
+		apfs_init_query(&bq, base);
+		bq.flags = APFS_QUERY_CAT;
+		bq.index = 0;
+		bn = base->records;
+	}
+	if (target) {
+		apfs_init_query(&tq, target);
+		tq.flags = APFS_QUERY_CAT;
+		tq.index = 0;
+		tn = target->records;
+	}
+
+	while (!err && (bq.index < bn || tq.index < tn)) {
+		int cmp;
+
+		if (bq.index < bn) {
+			err = apfs_node_read_record(&bq, &bkey);
+			if (err)
+				break;
+		}
+		if (tq.index < tn) {
+			err = apfs_node_read_record(&tq, &tkey);
+			if (err)
+				break;
+		}
+
+		if (bq.index >= bn)
+			cmp = 1;
+		else if (tq.index >= tn)
+			cmp = -1;
+		else
+			cmp = apfs_keycmp(sb, &bkey, &tkey);
+
+		if (cmp < 0) {
+			err = apfs_snapdiff_emit(diff, &bq, &bkey,
+						 APFS_DIFF_REMOVED);
+			bq.index++;
+		} else if (cmp > 0) {
+			err = apfs_snapdiff_emit(diff, &tq, &tkey,
+						 APFS_DIFF_ADDED);
+			tq.index++;
+		} else {
+			if (bq.len != tq.len ||
+			    memcmp(base->object.data + bq.off,
+				   target->object.data + tq.off, tq.len))
+				err = apfs_snapdiff_emit(diff, &tq, &tkey,
+							 APFS_DIFF_MODIFIED);
+			bq.index++;
+			tq.index++;
+		}
+	}
+	if (err == -EFSCORRUPTED)
+		apfs_alert(sb, "bad record in a version of node 0x%llx",
+			   diff->oid);
+
+	if (base)
+		apfs_free_query(sb, &bq);
+	if (target)
+		apfs_free_query(sb, &tq);
+	return err;
+}
+
+/**
+ * apfs_snapdiff_node - Report the changes in a catalog node
+ * @diff:	state of the request
+ * @oid:	virtual object id of the node
+ *
+ * Returns 0 on success, 1 if the user buffer is full, or a negative error
+ * code in case of failure.
+ */
+static int apfs_snapdiff_node(struct apfs_snapdiff *diff, u64 oid)
+{
+	struct super_block *sb = diff->sb;
+	struct apfs_node *base, *target;
+	int err = 0;
+
+	diff->oid = oid;
+	diff->seen = 0;
+	diff->skip = oid == diff->start ? diff->start_skip : 0;
+
+	target = apfs_snapdiff_read(sb, oid, diff->target);
+	if (IS_ERR(target))
+		return PTR_ERR(target);
+	base = apfs_snapdiff_read(sb, oid, diff->base);
+	if (IS_ERR(base)) {
+		err = PTR_ERR(base);
+		goto out;
+	}
+
+	if (!base && !target)
+		goto out;
+	if (base && target && base->object.block_nr == target->object.block_nr)
+		goto out;
+	err = apfs_snapdiff_leaves(diff, base, target);
+
+out:
+	if (base)
+		apfs_node_put(base);
+	if (target)
+		apfs_node_put(target);
+	return err;
+}
+
+static int apfs_snapdiff_walk(struct apfs_snapdiff *diff,
+			      struct apfs_node *node, int depth);
+
+/**
+ * apfs_snapdiff_child - Walk the omap subtree for a block
+ * @diff:	state of the request
+ * @bno:	block number of the child node
+ * @depth:	depth of the child
+ */
+static int apfs_snapdiff_child(struct apfs_snapdiff *diff, u64 bno, int depth)
+{
+	struct apfs_node *child;
+	int err;
+
+	child = apfs_read_node(diff->sb, bno);
+	if (IS_ERR(child))
+		return PTR_ERR(child);
+	err = apfs_snapdiff_walk(diff, child, depth);
+	apfs_node_put(child);
+	return err;
+}
+
+/**
+ * apfs_snapdiff_walk - Report the changes for the mappings of an omap subtree
+ * @diff:	state of the request
+ * @node:	root of the omap subtree
+ * @depth:	depth of @node
+ *
+ * Returns 0 on success, 1 if the user buffer is full, or a negative error
+ * code in case of failure.
+ */
+static int apfs_snapdiff_walk(struct apfs_snapdiff *diff,
+			      struct apfs_node *node, int depth)
+{
+	struct super_block *sb = diff->sb;
+	struct apfs_obj_phys *obj = (struct apfs_obj_phys *)node->object.data;
+	struct apfs_query query;
+	struct apfs_key key;
+	bool leaf = apfs_node_is_leaf(node);
+	u64 child_id, child_bno, prev_bno = 0;
+	int err = 0;
+
+	/* Not rewritten since the base, so no mapping can be newer */
+	if (le64_to_cpu(obj->o_xid) <= diff->base)
+		return 0;
+	if (depth >= APFS_BTREE_MAX_DEPTH) {
+		apfs_alert(sb, "object map is too deep");
+		return -EFSCORRUPTED;
+	}
+
+	apfs_init_query(&query, node);
+	query.flags = APFS_QUERY_OMAP;
+	for (query.index = 0; query.index < node->records; ++query.index) {
+		err = apfs_node_read_record(&query, &key);
+		if (err) {
+			apfs_alert(sb, "bad object map block: 0x%llx",
+				   node->object.block_nr);
+			break;
+		}
+
+		if (leaf) {
+			/* Mappings of an object may span two leaves */
+			if (key.id < diff->next || key.number <= diff->base ||
+			    key.number > diff->target)
+				continue;
+			err = apfs_snapdiff_node(diff, key.id);
+			if (err)
+				break;
+			diff->next = key.id + 1;
+		} else {
+			/* The previous child ends where this one starts */
+			if (query.index && key.id >= diff->next) {
+				err = apfs_snapdiff_child(diff, prev_bno,
+							  depth + 1);
+				if (err)
+					break;
+			}
+			err = apfs_query_child_block(sb, &query, &child_id,
+						     &child_bno);
+			if (err)
+				break;
+			prev_bno = child_bno;
+		}
+
+		if (fatal_signal_pending(current)) {
+			err = -EINTR;
+			break;
+		}
+		cond_resched();
+	}
+	if (!err && !leaf && node->records)
+		err = apfs_snapdiff_child(diff, prev_bno, depth + 1);
+
+	apfs_free_query(sb, &query);
+	return err;
+}
+
+/**
+ * apfs_snapdiff - Report the catalog records changed between two xids
+ * @sb:		filesystem superblock
+ * @req:	the request, already checked by the caller
+ * @ubuf:	user buffer for the changes
+ *
+ * The nodes are visited in the order of their virtual ids, and the request is
+ * updated so that the next call resumes where this one stopped; a count of
+ * zero on return means that no changes are left.  Records that moved from one
+ * leaf to another are reported as removed from the first and added to the
+ * second.  Returns 0 on success, or a negative error code in case of failure.
+ */
+int apfs_snapdiff(struct super_block *sb, struct apfs_diff_req *req,
+		  struct apfs_diff_entry __user *ubuf)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_snapdiff diff = {
+		.sb = sb,
+		.base = req->dr_base_xid,
+		.target = req->dr_target_xid,
+		.next = req->dr_oid,
+		.ubuf = ubuf,
+		.count = req->dr_count,
+		.start = req->dr_oid,
+		.start_skip = req->dr_skip,
+		.oid = req->dr_oid,
+	};
+	int err;
+
+	err = apfs_snapdiff_walk(&diff, sbi->s_omap_root, 0 /* depth */);
+	/* Don't lose the entries already copied */
+	if (err < 0 && !diff.done)
+		return err;
+
+	if (err) {
+		/* Resume in the middle of the last node */
+		req->dr_oid = diff.oid;
+		req->dr_skip = diff.seen;
+	} else {
+		req->dr_oid = diff.next;
+		req->dr_skip = 0;
+	}
+	req->dr_count = diff.done;
+	return 0;
+}
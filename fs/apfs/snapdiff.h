@@ -0,0 +1,21 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/snapdiff.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_SNAPDIFF_H
+#define _APFS_SNAPDIFF_H
+
+#include <linux/compiler.h>
+#include <linux/types.h>
+
+struct apfs_diff_entry;
+struct apfs_diff_req;
+struct super_block;
+
+extern int apfs_snapdiff(struct super_block *sb, struct apfs_diff_req *req,
+			 struct apfs_diff_entry __user *ubuf);
+
+#endif	/* _APFS_SNAPDIFF_H */
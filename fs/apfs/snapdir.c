@@ -0,0 +1,269 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/snapdir.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ *
+ * Virtual directory of snapshots.  With the snapdir mount option, the root of
+ * a live volume has a hidden .snapshots directory with one entry for each
+ * record in the snapshot metadata tree.  Listing it only walks that tree;
+ * each entry is an automount point, and the snapshot gets mounted the first
+ * time a path walk goes into it.  These mounts share the container with the
+ * volume, and they expire once they go unused for a while, so browsing many
+ * snapshots never keeps more than the recent ones around.
+ */
+
+#include <linux/dcache.h>
+#include <linux/fs.h>
+#include <linux/mount.h>
+#include <linux/namei.h>
+#include <linux/path.h>
+#include <linux/workqueue.h>
+#include "apfs.h"
+#include "inode.h"
+#include "message.h"
+#include "snapdir.h"
+#include "snapshot.h"
+#include "super.h"
+
+static void apfs_snap_expire(struct work_struct *work);
+
+/* Snapshot mounts of all volumes, to be dropped once unused */
+static LIST_HEAD(apfs_snap_mounts);
+static DECLARE_DELAYED_WORK(apfs_snap_expiry, apfs_snap_expire);
+
+static void apfs_snap_expire(struct work_struct *work)
+{
+	if (list_empty(&apfs_snap_mounts))
+		return;
+	mark_mounts_for_expiry(&apfs_snap_mounts);
+	schedule_delayed_work(&apfs_snap_expiry, APFS_SNAP_EXPIRY * HZ);
+}
+
+/**
+ * apfs_is_snapdir - Check if a lookup is for the virtual snapshot directory
+ * @dir:	parent directory
+ * @name:	name to look up
+ */
+bool apfs_is_snapdir(struct inode *dir, const struct qstr *name)
+{
+	struct apfs_sb_info *sbi = APFS_SB(dir->i_sb);
+
+	if (!(sbi->s_flags & APFS_SNAPDIR) || sbi->s_snap_xid)
+		return false;
+	if (apfs_ino(dir) != APFS_ROOT_DIR_INO_NUM)
+		return false;
+	return name->len == strlen(APFS_SNAPDIR_NAME) &&
+	       !memcmp(name->name, APFS_SNAPDIR_NAME, name->len);
+}
+
+/**
+ * apfs_snapdir_new_inode - Create an inode that has no catalog record
+ * @dir:	parent directory
+ * @ino:	inode number to report
+ * @time:	time for the inode, in nanoseconds since the epoch
+ *
+ * The new inode is a read-only directory, never hashed, with the ownership of
+ * @dir.  Returns the inode, or NULL if it couldn't be allocated.
+ */
+static struct inode *apfs_snapdir_new_inode(struct inode *dir, u64 ino,
+					    u64 time)
+{
+	struct inode *inode;
+	struct apfs_inode_info *ai;
+	struct timespec64 ts;
+
+	inode = new_inode(dir->i_sb);
+	if (!inode)
+		return NULL;
+	ai = APFS_I(inode);
+
+	inode->i_ino = ino;
+#if BITS_PER_LONG == 32
+	ai->i_ino = ino;
+#endif
+	ai->i_parent_id = apfs_ino(dir);
+	ai->i_extent_id = ino;
+	ai->i_bsd_flags = 0;
+	ai->i_no_xattrs = true;
+	ai->i_nchildren = 0;
+
+	inode->i_mode = S_IFDIR | 0555;
+	inode->i_uid = dir->i_uid;
+	inode->i_gid = dir->i_gid;
+	set_nlink(inode, 2);
+	ts = ns_to_timespec64(time);
+	inode->i_atime = inode->i_mtime = inode->i_ctime = ai->i_crtime = ts;
+	return inode;
+}
+
+/**
+ * apfs_snapshot_set_dentry - Make a new dentry in the snapshot directory an
+ *			      automount point
+ * @dentry:	the dentry, not yet spliced
+ */
+static void apfs_snapshot_set_dentry(struct dentry *dentry)
+{
+	spin_lock(&dentry->d_lock);
+	dentry->d_op = &apfs_snapshot_dentry_operations;
+	dentry->d_flags |= DCACHE_NEED_AUTOMOUNT;
+	spin_unlock(&dentry->d_lock);
+}
+
+/*
+ * Snapshot wanted by a lookup in the snapshot directory
+ */
+struct apfs_snapdir_wanted {
+	const char *name;		/* Name of the snapshot */
+	struct apfs_snapshot *snap;	/* On a match, the snapshot found */
+};
+
+static int apfs_snapdir_match(struct super_block *sb,
+			      const struct apfs_snapshot *snap,
+			      const char *name, void *data)
+{
+	struct apfs_snapdir_wanted *wanted = data;
+
+	if (strcmp(wanted->name, name) != 0)
+		return 0;
+	*wanted->snap = *snap;
+	return 1;
+}
+
+static struct dentry *apfs_snapdir_lookup(struct inode *dir,
+					  struct dentry *dentry,
+					  unsigned int flags)
+{
+	struct apfs_snapshot snap;
+	struct apfs_snapdir_wanted wanted = {
+		.name = dentry->d_name.name,
+		.snap = &snap,
+	};
+	struct inode *inode = NULL;
+	int ret;
+
+	/* Unlike for the snap option, the xid is not accepted as a name */
+	ret = apfs_snapshot_iterate(dir->i_sb, apfs_snapdir_match, &wanted);
+	if (ret < 0)
+		return ERR_PTR(ret);
+
+	if (ret) {
+		inode = apfs_snapdir_new_inode(dir, snap.xid, snap.create_time);
+		if (!inode)
+			return ERR_PTR(-ENOMEM);
+		inode->i_op = &simple_dir_inode_operations;
+		inode->i_fop = &simple_dir_operations;
+		apfs_snapshot_set_dentry(dentry);
+	}
+	return d_splice_alias(inode, dentry);
+}
+
+/*
+ * State of a readdir of the snapshot directory
+ */
+struct apfs_snapdir_iter {
+	struct dir_context *ctx;
+	loff_t pos;			/* Position of the next snapshot */
+};
+
+static int apfs_snapdir_emit(struct super_block *sb,
+			     const struct apfs_snapshot *snap,
+			     const char *name, void *data)
+{
+	struct apfs_snapdir_iter *iter = data;
+	struct dir_context *ctx = iter->ctx;
+
+	/* Snapshots are few, so just skip the ones already emitted */
+	if (iter->pos++ < ctx->pos)
+		return 0;
+	/* The name couldn't be looked up */
+	if (strchr(name, '/')) {
+		ctx->pos++;
+		return 0;
+	}
+	if (!dir_emit(ctx, name, strlen(name), snap->xid, DT_DIR))
+		return 1;
+	ctx->pos++;
+	return 0;
+}
+
+static int apfs_snapdir_readdir(struct file *file, struct dir_context *ctx)
+{
+	struct inode *inode = file_inode(file);
+	struct apfs_snapdir_iter iter = {
+		.ctx = ctx,
+		.pos = 2,
+	};
+	int ret;
+
+	if (!dir_emit_dots(file, ctx))
+		return 0;
+	ret = apfs_snapshot_iterate(inode->i_sb, apfs_snapdir_emit, &iter);
+	return ret < 0 ? ret : 0;
+}
+
+static const struct inode_operations apfs_snapdir_inode_operations = {
+	.lookup		= apfs_snapdir_lookup,
+	.getattr	= apfs_getattr,
+};
+
+static const struct file_operations apfs_snapdir_operations = {
+	.llseek		= generic_file_llseek,
+	.read		= generic_read_dir,
+	.iterate_shared	= apfs_snapdir_readdir,
+};
+
+/**
+ * apfs_snapdir_lookup_root - Look up the snapshot directory in the root
+ * @dir:	the root directory
+ * @dentry:	dentry for the snapshot directory
+ *
+ * Returns the dentry to use, or an ERR_PTR in case of failure.
+ */
+struct dentry *apfs_snapdir_lookup_root(struct inode *dir,
+					struct dentry *dentry)
+{
+	struct inode *inode;
+	u64 time = timespec64_to_ns(&APFS_I(dir)->i_crtime);
+
+	inode = apfs_snapdir_new_inode(dir, APFS_SNAP_DIR_INO_NUM, time);
+	if (!inode)
+		return ERR_PTR(-ENOMEM);
+	inode->i_op = &apfs_snapdir_inode_operations;
+	inode->i_fop = &apfs_snapdir_operations;
+	return d_splice_alias(inode, dentry);
+}
+
+/**
+ * apfs_snapshot_automount - Mount a snapshot from the snapshot directory
+ * @path:	entry of the snapshot
+ *
+ * Returns a new mount of the snapshot, for the vfs to mount over @path, or an
+ * ERR_PTR in case of failure.
+ */
+struct vfsmount *apfs_snapshot_automount(struct path *path)
+{
+	struct inode *inode = d_inode(path->dentry);
+	struct super_block *sb = inode->i_sb;
+	struct vfsmount *mnt;
+
+	mnt = apfs_mount_sibling(sb, APFS_SB(sb)->s_vol_nr, apfs_ino(inode));
+	if (IS_ERR(mnt)) {
+		apfs_warn(sb, "unable to mount snapshot 0x%llx (%ld)",
+			  apfs_ino(inode), PTR_ERR(mnt));
+		return mnt;
+	}
+
+	mntget(mnt); /* Don't let it expire before the vfs mounts it */
+	mnt_set_expiry(mnt, &apfs_snap_mounts);
+	schedule_delayed_work(&apfs_snap_expiry, APFS_SNAP_EXPIRY * HZ);
+	return mnt;
+}
+
+/**
+ * apfs_snapdir_exit - Stop the expiry of snapshot mounts, on module exit
+ */
+void apfs_snapdir_exit(void)
+{
+	cancel_delayed_work_sync(&apfs_snap_expiry);
+}
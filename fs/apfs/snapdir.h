@@ -0,0 +1,31 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/snapdir.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_SNAPDIR_H
+#define _APFS_SNAPDIR_H
+
+#include <linux/types.h>
+
+struct dentry;
+struct inode;
+struct path;
+struct qstr;
+struct vfsmount;
+
+/* Name of the virtual directory in the root, for the snapdir mount option */
+#define APFS_SNAPDIR_NAME	".snapshots"
+
+/* Seconds before an unused snapshot mount gets dropped */
+#define APFS_SNAP_EXPIRY	600
+
+extern bool apfs_is_snapdir(struct inode *dir, const struct qstr *name);
+extern struct dentry *apfs_snapdir_lookup_root(struct inode *dir,
+					       struct dentry *dentry);
+extern struct vfsmount *apfs_snapshot_automount(struct path *path);
+extern void apfs_snapdir_exit(void);
+
+#endif	/* _APFS_SNAPDIR_H */
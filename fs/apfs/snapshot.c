@@ -0,0 +1,201 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/snapshot.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#include <linux/kernel.h>
+#include <linux/string.h>
+#include "apfs.h"
+#include "btree.h"
+#include "key.h"
+#include "message.h"
+#include "node.h"
+#include "snapshot.h"
+#include "super.h"
+
+/**
+ * apfs_snapshot_read - Read a snapshot from a record of the metadata tree
+ * @query:	query positioned on a leaf record
+ * @snap:	on return, the snapshot
+ * @name:	on return, the null-terminated name of the snapshot, on disk
+ *
+ * Returns 1 if the record is for a snapshot, 0 if it's some other kind of
+ * record, or -EFSCORRUPTED if it's malformed.
+ */
+static int apfs_snapshot_read(struct apfs_query *query,
+			      struct apfs_snapshot *snap, const char **name)
+{
+	char *raw = query->node->object.data;
+	struct apfs_key_header *hdr;
+	struct apfs_snap_metadata_val *val;
+	u64 obj_id;
+	int name_len;
+
+	if (query->key_len < sizeof(*hdr))
+		return -EFSCORRUPTED;
+	hdr = (struct apfs_key_header *)(raw + query->key_off);
+	obj_id = le64_to_cpu(hdr->obj_id_and_type);
+	if ((obj_id & APFS_OBJ_TYPE_MASK) >> APFS_OBJ_TYPE_SHIFT !=
+						APFS_TYPE_SNAP_METADATA)
+		return 0;
+
+	if (query->len < sizeof(*val))
+		return -EFSCORRUPTED;
+	val = (struct apfs_snap_metadata_val *)(raw + query->off);
+	name_len = le16_to_cpu(val->name_len);
+	if (sizeof(*val) + name_len > query->len || !name_len ||
+	    val->name[name_len - 1] != 0)
+		return -EFSCORRUPTED;
+
+	snap->xid = obj_id & APFS_OBJ_ID_MASK;
+	snap->sblock = le64_to_cpu(val->sblock_oid);
+	snap->create_time = le64_to_cpu(val->create_time);
+	*name = (char *)val->name;
+	return 1;
+}
+
+/**
+ * apfs_snapshot_scan - Walk a subtree of the metadata tree
+ * @sb:		filesystem superblock
+ * @node:	root of the subtree, which the caller already holds
+ * @actor:	called for each snapshot, in xid order
+ * @data:	passed to @actor
+ *
+ * A volume has few snapshots, so the whole tree is just walked in order.
+ * Returns 0 once all the snapshots were visited, the first nonzero value
+ * returned by @actor, or a negative error code in case of failure.
+ */
+static int apfs_snapshot_scan(struct super_block *sb, struct apfs_node *node,
+			      int (*actor)(struct super_block *sb,
+					   const struct apfs_snapshot *snap,
+					   const char *name, void *data),
+			      void *data)
+{
+	struct apfs_query query;
+	int ret = 0;
+
+	/* The metadata tree is physical, so the children need no omap */
+	apfs_init_query(&query, node);
+	query.flags = APFS_QUERY_SNAP_META;
+	for (query.index = 0; query.index < node->records; query.index++) {
+		struct apfs_node *child;
+
+		ret = apfs_node_read_record(&query, NULL /* key */);
+		if (ret)
+			break;
+
+		if (apfs_node_is_leaf(node)) {
+			struct apfs_snapshot snap;
+			const char *name;
+
+			ret = apfs_snapshot_read(&query, &snap, &name);
+			if (ret < 0)
+				break;
+			ret = ret ? actor(sb, &snap, name, data) : 0;
+			if (ret)
+				break;
+			continue;
+		}
+
+		child = apfs_query_read_child(sb, &query);
+		if (IS_ERR(child)) {
+			ret = PTR_ERR(child);
+			break;
+		}
+		ret = apfs_snapshot_scan(sb, child, actor, data);
+		apfs_node_put(child);
+		if (ret)
+			break;
+	}
+	apfs_free_query(sb, &query);
+	return ret;
+}
+
+/**
+ * apfs_snapshot_iterate - Visit all the snapshots of the mounted volume
+ * @sb:		filesystem superblock, with the live volume sb mapped
+ * @actor:	called for each snapshot, in xid order, with its name; a
+ *		nonzero return value stops the walk
+ * @data:	passed to @actor
+ *
+ * Returns 0 once all the snapshots were visited, the first nonzero value
+ * returned by @actor, or a negative error code in case of failure.
+ */
+int apfs_snapshot_iterate(struct super_block *sb,
+			  int (*actor)(struct super_block *sb,
+				       const struct apfs_snapshot *snap,
+				       const char *name, void *data),
+			  void *data)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_superblock *vsb_raw = sbi->s_vsb_raw;
+	struct apfs_node *root;
+	u64 root_bno;
+	int ret;
+
+	if (!le64_to_cpu(vsb_raw->apfs_num_snapshots))
+		return 0;
+	root_bno = le64_to_cpu(vsb_raw->apfs_snap_meta_tree_oid);
+	if (!root_bno)
+		return 0;
+
+	root = apfs_read_node(sb, root_bno);
+	if (IS_ERR(root)) {
+		apfs_err(sb, "unable to read snapshot metadata tree");
+		return PTR_ERR(root);
+	}
+	ret = apfs_snapshot_scan(sb, root, actor, data);
+	apfs_node_put(root);
+	return ret;
+}
+
+/*
+ * Snapshot wanted by apfs_snapshot_find()
+ */
+struct apfs_snapshot_wanted {
+	const char *name;		/* Its name, or its xid in decimal */
+	struct apfs_snapshot *snap;	/* On a match, the snapshot found */
+};
+
+static int apfs_snapshot_match(struct super_block *sb,
+			       const struct apfs_snapshot *snap,
+			       const char *name, void *data)
+{
+	struct apfs_snapshot_wanted *wanted = data;
+
+	if (strcmp(wanted->name, name) != 0) {
+		u64 xid;
+
+		/* Snapshots can also be requested by xid */
+		if (kstrtou64(wanted->name, 10, &xid) || xid != snap->xid)
+			return 0;
+	}
+	*wanted->snap = *snap;
+	return 1;
+}
+
+/**
+ * apfs_snapshot_find - Find a snapshot of the mounted volume
+ * @sb:		filesystem superblock, with the live volume superblock mapped
+ * @name:	name of the snapshot, or its xid in decimal
+ * @snap:	on return, the snapshot found
+ *
+ * Returns 0 on success, -ENOENT if there is no such snapshot, or another
+ * negative error code in case of failure.
+ */
+int apfs_snapshot_find(struct super_block *sb, const char *name,
+		       struct apfs_snapshot *snap)
+{
+	struct apfs_snapshot_wanted wanted = {
+		.name = name,
+		.snap = snap,
+	};
+	int ret;
+
+	ret = apfs_snapshot_iterate(sb, apfs_snapshot_match, &wanted);
+	if (ret < 0)
+		return ret;
+	return ret ? 0 : -ENOENT;
+}
@@ -0,0 +1,48 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/snapshot.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_SNAPSHOT_H
+#define _APFS_SNAPSHOT_H
+
+#include <linux/types.h>
+
+struct super_block;
+
+/*
+ * Structure of the value of a snapshot metadata record, keyed by the xid of
+ * the snapshot
+ */
+struct apfs_snap_metadata_val {
+	__le64 extentref_tree_oid;
+	__le64 sblock_oid;
+	__le64 create_time;
+	__le64 change_time;
+	__le64 inum;
+	__le32 extentref_tree_type;
+	__le32 flags;
+	__le16 name_len;
+	u8 name[0];
+} __packed;
+
+/*
+ * Snapshot found in the metadata tree of a volume
+ */
+struct apfs_snapshot {
+	u64 xid;			/* Transaction id of the snapshot */
+	u64 sblock;			/* Block of its volume superblock */
+	u64 create_time;		/* In nanoseconds since the epoch */
+};
+
+extern int apfs_snapshot_iterate(struct super_block *sb,
+				 int (*actor)(struct super_block *sb,
+					      const struct apfs_snapshot *snap,
+					      const char *name, void *data),
+				 void *data);
+extern int apfs_snapshot_find(struct super_block *sb, const char *name,
+			      struct apfs_snapshot *snap);
+
+#endif	/* _APFS_SNAPSHOT_H */
@@ -0,0 +1,257 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/spaceman.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#include <linux/buffer_head.h>
+#include <linux/fs.h>
+#include <linux/slab.h>
+#include <linux/sort.h>
+#include "apfs.h"
+#include "message.h"
+#include "object.h"
+#include "spaceman.h"
+#include "super.h"
+
+static int apfs_ckpt_map_cmp(const void *a, const void *b)
+{
+	const struct apfs_ephemeral *e1 = a, *e2 = b;
+
+	if (e1->oid != e2->oid)
+		return e1->oid < e2->oid ? -1 : 1;
+	if (e1->type != e2->type)
+		return e1->type < e2->type ? -1 : 1;
+	return 0;
+}
+
+/**
+ * apfs_ckpt_map_add - Add the mappings of a checkpoint map block to the table
+ * @sb:		filesystem superblock
+ * @map:	the checkpoint map block, already verified
+ * @table:	the table, which may be reallocated
+ * @alloc:	number of entries allocated for the table, may be updated
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_ckpt_map_add(struct super_block *sb,
+			     struct apfs_checkpoint_map_phys *map,
+			     struct apfs_ckpt_map **table, u32 *alloc)
+{
+	struct apfs_ckpt_map *tbl = *table;
+	u32 count = le32_to_cpu(map->cpm_count);
+	u32 max_count, i;
+
+	max_count = (sb->s_blocksize - sizeof(struct apfs_checkpoint_map_phys)) /
+		    sizeof(struct apfs_checkpoint_mapping);
+	if (count > max_count)
+		return -EFSCORRUPTED;
+
+	if (tbl->count + count > *alloc) {
+		u32 new_alloc = max(*alloc * 2, tbl->count + count);
+
+		tbl = krealloc(tbl, struct_size(tbl, entries, new_alloc),
+			       GFP_KERNEL);
+		if (!tbl)
+			return -ENOMEM;
+		*table = tbl;
+		*alloc = new_alloc;
+	}
+
+	for (i = 0; i < count; ++i) {
+		struct apfs_checkpoint_mapping *cpm = &map->cpm_map[i];
+		struct apfs_ephemeral *eph = &tbl->entries[tbl->count];
+		u32 size = le32_to_cpu(cpm->cpm_size);
+
+		if (!size || size & (sb->s_blocksize - 1))
+			return -EFSCORRUPTED;
+		eph->oid = le64_to_cpu(cpm->cpm_oid);
+		eph->paddr = le64_to_cpu(cpm->cpm_paddr);
+		eph->type = le32_to_cpu(cpm->cpm_type) & APFS_OBJECT_TYPE_MASK;
+		eph->blocks = size >> sb->s_blocksize_bits;
+		tbl->count++;
+	}
+	return 0;
+}
+
+/**
+ * apfs_read_ckpt_map - Load the checkpoint mappings of the mounted checkpoint
+ * @sb:	filesystem superblock
+ *
+ * Ephemeral objects, like the space manager, are located through the
+ * checkpoint map blocks in the descriptor area.  They are all read once on
+ * mount, into a table sorted by oid, so that later lookups need no I/O.
+ * Returns 0 on success, or a negative error code in case of failure; the
+ * table is then left unset.
+ */
+int apfs_read_ckpt_map(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_nx_superblock *msb_raw = sbi->s_msb_raw;
+	u64 desc_base = le64_to_cpu(msb_raw->nx_xp_desc_base);
+	u32 desc_blocks = le32_to_cpu(msb_raw->nx_xp_desc_blocks);
+	u32 desc_index = le32_to_cpu(msb_raw->nx_xp_desc_index);
+	u32 desc_len = le32_to_cpu(msb_raw->nx_xp_desc_len);
+	struct apfs_ckpt_map *table;
+	u32 alloc = APFS_CKPT_MAP_ALLOC;
+	int err = 0;
+	u32 i;
+
+	if (!desc_blocks || desc_index >= desc_blocks || desc_len > desc_blocks)
+		return -EFSCORRUPTED;
+	table = kmalloc(struct_size(table, entries, alloc), GFP_KERNEL);
+	if (!table)
+		return -ENOMEM;
+	table->count = 0;
+
+	/* The last descriptor of the checkpoint is the superblock itself */
+	for (i = 0; i < desc_len; ++i) {
+		struct apfs_checkpoint_map_phys *map;
+		struct buffer_head *bh;
+		u32 type, flags;
+
+		bh = sb_bread(sb, desc_base + (desc_index + i) % desc_blocks);
+		if (!bh) {
+			err = -EIO;
+			goto fail;
+		}
+		map = (struct apfs_checkpoint_map_phys *)bh->b_data;
+
+		type = le32_to_cpu(map->cpm_o.o_type) & APFS_OBJECT_TYPE_MASK;
+		if (type != APFS_OBJECT_TYPE_CHECKPOINT_MAP) {
+			brelse(bh);
+			continue;
+		}
+		if (!apfs_obj_verify_csum(sb, &map->cpm_o)) {
+			brelse(bh);
+			err = -EFSBADCRC;
+			goto fail;
+		}
+		flags = le32_to_cpu(map->cpm_flags);
+		err = apfs_ckpt_map_add(sb, map, &table, &alloc);
+		brelse(bh);
+		if (err)
+			goto fail;
+
+		if (flags & APFS_CHECKPOINT_MAP_LAST)
+			break;
+	}
+
+	sort(table->entries, table->count, sizeof(table->entries[0]),
+	     apfs_ckpt_map_cmp, NULL);
+	sbi->s_nxi->nx_ckpt_map = table;
+	return 0;
+
+fail:
+	kfree(table);
+	return err;
+}
+
+/**
+ * apfs_ckpt_map_lookup - Find an ephemeral object in the checkpoint mappings
+ * @sb:		filesystem superblock
+ * @oid:	object id
+ * @type:	object type
+ * @paddr:	on return, block number of the object
+ * @blocks:	on return, length of the object in blocks
+ *
+ * Returns 0 on success, or -ENOENT if the object is not mapped or the table
+ * could not be loaded.
+ */
+int apfs_ckpt_map_lookup(struct super_block *sb, u64 oid, u32 type,
+			 u64 *paddr, unsigned int *blocks)
+{
+	struct apfs_ckpt_map *table = APFS_SB(sb)->s_nxi->nx_ckpt_map;
+	struct apfs_ephemeral target = { .oid = oid, .type = type };
+	int left = 0, right;
+
+	if (!table)
+		return -ENOENT;
+	right = table->count - 1;
+	while (left <= right) {
+		int mid = left + (right - left) / 2;
+		struct apfs_ephemeral *eph = &table->entries[mid];
+		int cmp = apfs_ckpt_map_cmp(eph, &target);
+
+		if (!cmp) {
+			*paddr = eph->paddr;
+			*blocks = eph->blocks;
+			return 0;
+		}
+		if (cmp < 0)
+			left = mid + 1;
+		else
+			right = mid - 1;
+	}
+	return -ENOENT;
+}
+
+/**
+ * apfs_read_spaceman - Read the space manager counters of the container
+ * @sb: filesystem superblock
+ *
+ * The mount is read-only, so the counters of the mounted checkpoint stay
+ * valid for as long as the container is mapped.  Returns 0 on success, or a
+ * negative error code in case of failure; the caller may then ignore the space
+ * manager entirely, since nxi->nx_spaceman.valid will be false.
+ */
+int apfs_read_spaceman(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_spaceman *sm = &sbi->s_nxi->nx_spaceman;
+	struct apfs_spaceman_phys *sm_raw;
+	struct apfs_object obj;
+	u64 oid, paddr, block_count = 0, free_count = 0;
+	unsigned int blocks;
+	u32 type;
+	int err, i;
+
+	oid = le64_to_cpu(sbi->s_msb_raw->nx_spaceman_oid);
+	err = apfs_ckpt_map_lookup(sb, oid, APFS_OBJECT_TYPE_SPACEMAN, &paddr,
+				   &blocks);
+	if (err)
+		return err;
+
+	/* The space manager may take more than one block */
+	err = apfs_object_read(sb, paddr, blocks, &obj);
+	if (err)
+		return err;
+	sm_raw = (struct apfs_spaceman_phys *)obj.data;
+
+	type = le32_to_cpu(sm_raw->sm_o.o_type) & APFS_OBJECT_TYPE_MASK;
+	if (type != APFS_OBJECT_TYPE_SPACEMAN ||
+	    le64_to_cpu(sm_raw->sm_o.o_oid) != oid) {
+		err = -EFSCORRUPTED;
+		goto out;
+	}
+	if (!apfs_object_verify_csum(&obj)) {
+		err = -EFSBADCRC;
+		goto out;
+	}
+
+	for (i = 0; i < APFS_SD_COUNT; ++i) {
+		struct apfs_spaceman_device *dev = &sm_raw->sm_dev[i];
+
+		block_count += le64_to_cpu(dev->sm_block_count);
+		free_count += le64_to_cpu(dev->sm_free_count);
+	}
+	if (free_count > block_count) {
+		err = -EFSCORRUPTED;
+		goto out;
+	}
+
+	sm->free_count = free_count;
+	sm->reserve_count = le64_to_cpu(sm_raw->sm_fs_reserve_block_count);
+	sm->reserve_alloc_count =
+			le64_to_cpu(sm_raw->sm_fs_reserve_alloc_count);
+	if (sm->reserve_alloc_count > sm->reserve_count)
+		sm->reserve_alloc_count = sm->reserve_count;
+	sm->paddr = paddr;
+	sm->blocks = blocks;
+	sm->valid = true;
+
+out:
+	apfs_object_release(&obj);
+	return err;
+}
@@ -0,0 +1,159 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/spaceman.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_SPACEMAN_H
+#define _APFS_SPACEMAN_H
+
+#include <linux/types.h>
+#include "object.h"
+
+struct super_block;
+
+/* Checkpoint map flags */
+#define	APFS_CHECKPOINT_MAP_LAST	0x00000001
+
+/*
+ * Structure of a checkpoint-mapping, which gives the location of an ephemeral
+ * object in the checkpoint data area
+ */
+struct apfs_checkpoint_mapping {
+	__le32 cpm_type;
+	__le32 cpm_subtype;
+	__le32 cpm_size;
+	__le32 cpm_pad;
+	__le64 cpm_fs_oid;
+	__le64 cpm_oid;
+	__le64 cpm_paddr;
+} __packed;
+
+/*
+ * Structure of a checkpoint-mapping block
+ */
+struct apfs_checkpoint_map_phys {
+/*00*/	struct apfs_obj_phys cpm_o;
+/*20*/	__le32 cpm_flags;
+	__le32 cpm_count;
+/*28*/	struct apfs_checkpoint_mapping cpm_map[];
+} __packed;
+
+/*
+ * Location of an ephemeral object, from the checkpoint mappings
+ */
+struct apfs_ephemeral {
+	u64 oid;
+	u64 paddr;			/* First block of the object */
+	u32 type;			/* Object type, without the flags */
+	u32 blocks;			/* Length of the object in blocks */
+};
+
+/* Entries allocated at first for the checkpoint map table */
+#define APFS_CKPT_MAP_ALLOC	64
+
+/*
+ * Table of the ephemeral objects of the mounted checkpoint, sorted by oid
+ */
+struct apfs_ckpt_map {
+	u32 count;
+	struct apfs_ephemeral entries[];
+};
+
+/* Indexes into the device array of the space manager */
+enum {
+	APFS_SD_MAIN	= 0,
+	APFS_SD_TIER2	= 1,
+	APFS_SD_COUNT	= 2
+};
+
+/*
+ * Structure used to store the space manager counters for one device
+ */
+struct apfs_spaceman_device {
+	__le64 sm_block_count;
+	__le64 sm_chunk_count;
+	__le32 sm_cib_count;
+	__le32 sm_cab_count;
+	__le64 sm_free_count;
+	__le32 sm_addr_offset;
+	__le32 sm_reserved;
+	__le64 sm_reserved2;
+} __packed;
+
+/*
+ * Structure of the space manager, only up to the fields we use
+ */
+struct apfs_spaceman_phys {
+/*00*/	struct apfs_obj_phys sm_o;
+/*20*/	__le32 sm_block_size;
+	__le32 sm_blocks_per_chunk;
+	__le32 sm_chunks_per_cib;
+	__le32 sm_cibs_per_cab;
+/*30*/	struct apfs_spaceman_device sm_dev[APFS_SD_COUNT];
+/*90*/	__le32 sm_flags;
+	__le32 sm_ip_bm_tx_multiplier;
+	__le64 sm_ip_block_count;
+/*A0*/	__le32 sm_ip_bm_size_in_blocks;
+	__le32 sm_ip_bm_block_count;
+	__le64 sm_ip_bm_base;
+/*B0*/	__le64 sm_ip_base;
+	__le64 sm_fs_reserve_block_count;
+/*C0*/	__le64 sm_fs_reserve_alloc_count;
+} __packed;
+
+/*
+ * Structure of a chunk-info, which describes a chunk of blocks and the bitmap
+ * that tracks their allocation
+ */
+struct apfs_chunk_info {
+	__le64 ci_xid;
+	__le64 ci_addr;			/* First block of the chunk */
+	__le32 ci_block_count;
+	__le32 ci_free_count;
+	__le64 ci_bitmap_addr;		/* Block of the bitmap, or 0 if free */
+} __packed;
+
+/* Mask for the counts of a chunk-info; the other bits are reserved */
+#define APFS_CI_COUNT_MASK	0x000fffff
+
+/*
+ * Structure of a chunk-info block
+ */
+struct apfs_chunk_info_block {
+/*00*/	struct apfs_obj_phys cib_o;
+/*20*/	__le32 cib_index;
+	__le32 cib_chunk_info_count;
+/*28*/	struct apfs_chunk_info cib_chunk_info[];
+} __packed;
+
+/*
+ * Structure of a chunk-info address block, only used by large containers to
+ * locate their chunk-info blocks
+ */
+struct apfs_cib_addr_block {
+/*00*/	struct apfs_obj_phys cab_o;
+/*20*/	__le32 cab_index;
+	__le32 cab_cib_count;
+/*28*/	__le64 cab_cib_addr[];
+} __packed;
+
+/*
+ * Space manager counters in memory, as of the mounted checkpoint
+ */
+struct apfs_spaceman {
+	bool valid;			/* Were the counters read? */
+	u64 free_count;			/* Free blocks in all devices */
+	u64 reserve_count;		/* Blocks reserved for all volumes */
+	u64 reserve_alloc_count;	/* Reserved blocks already allocated */
+	u64 paddr;			/* Location of the space manager */
+	unsigned int blocks;		/* Its length in blocks */
+};
+
+extern int apfs_read_ckpt_map(struct super_block *sb);
+extern int apfs_ckpt_map_lookup(struct super_block *sb, u64 oid, u32 type,
+				u64 *paddr, unsigned int *blocks);
+extern int apfs_read_spaceman(struct super_block *sb);
+
+#endif	/* _APFS_SPACEMAN_H */
@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/specio.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ *
+ * Submission of the speculative reads: the nodes read ahead by the b-tree
+ * iterators and batch queries, and the reads of the warmup and the scrub.
+ * Nobody is waiting for them yet, so with the specio mount option they get
+ * out of the way of the reads that somebody is: "specio=idle" sends them at
+ * idle io priority, and "specio=cgroup" charges them to the blkio cgroup of
+ * the task that mounted, instead of whatever task started them.
+ *
+ * A bio can't be taken back once submitted.  Speculative reads skip the
+ * blocks that are already uptodate or being read, so the ones that a reader
+ * got to first are dropped.  A reader that finds a speculative read already
+ * in flight has to wait for it; the idle class gets served as soon as the
+ * device has nothing else to do, so the wait only lasts while other reads
+ * keep the device busy.
+ */
+
+#include <linux/bio.h>
+#include <linux/blk-cgroup.h>
+#include <linux/buffer_head.h>
+#include <linux/cgroup.h>
+#include <linux/ioprio.h>
+#include <linux/sched.h>
+#include "apfs.h"
+#include "message.h"
+#include "specio.h"
+#include "super.h"
+
+/**
+ * apfs_spec_init - Set up the speculative reads for a new mount
+ * @sb:		filesystem superblock, with the mount options parsed
+ *
+ * Takes a reference to the blkio cgroup of the mounting task, for
+ * "specio=cgroup".  Failure is not fatal, the reads are then charged as usual.
+ */
+void apfs_spec_init(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+
+	if (!(sbi->s_flags & APFS_SPEC_CGROUP))
+		return;
+#ifdef CONFIG_BLK_CGROUP
+	sbi->s_spec_css = task_get_css(current, io_cgrp_id);
+#else
+	apfs_warn(sb, "no blkio cgroups, specio=cgroup has no effect");
+#endif
+}
+
+/**
+ * apfs_spec_destroy - Drop the cgroup of the speculative reads of a mount
+ * @sbi:	sb info of the mount
+ */
+void apfs_spec_destroy(struct apfs_sb_info *sbi)
+{
+	if (sbi->s_spec_css)
+		css_put(sbi->s_spec_css);
+	sbi->s_spec_css = NULL;
+}
+
+/**
+ * apfs_spec_end_io - Completion of a speculative read
+ * @bio:	the bio
+ */
+static void apfs_spec_end_io(struct bio *bio)
+{
+	struct buffer_head *bh = bio->bi_private;
+
+	bh->b_end_io(bh, !bio->bi_status);
+	bio_put(bio);
+}
+
+/**
+ * apfs_spec_submit_bh - Start a speculative read of a buffer
+ * @sb:		filesystem superblock
+ * @op_flags:	request flags, on top of REQ_RAHEAD
+ * @bh:		the buffer, locked and with @b_end_io set
+ *
+ * Same as submit_bh() for a read, but the bio gets the priority and cgroup
+ * asked for by the specio option.  The reference to @bh held by the caller
+ * goes to the completion, as usual.
+ */
+void apfs_spec_submit_bh(struct super_block *sb, int op_flags,
+			 struct buffer_head *bh)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct bio *bio;
+
+	op_flags |= REQ_RAHEAD;
+	if (!(sbi->s_flags & APFS_SPEC_IDLE) && !sbi->s_spec_css) {
+		submit_bh(REQ_OP_READ, op_flags, bh);
+		return;
+	}
+
+	/* Allocations with GFP_NOIO come from the bio mempool, so never fail */
+	bio = bio_alloc(GFP_NOIO, 1);
+	bio->bi_iter.bi_sector = bh->b_blocknr * (bh->b_size >> 9);
+	bio_set_dev(bio, bh->b_bdev);
+	bio_add_page(bio, bh->b_page, bh->b_size, bh_offset(bh));
+	bio->bi_end_io = apfs_spec_end_io;
+	bio->bi_private = bh;
+	bio_set_op_attrs(bio, REQ_OP_READ, op_flags);
+	if (sbi->s_flags & APFS_SPEC_IDLE)
+		bio_set_prio(bio, IOPRIO_PRIO_VALUE(IOPRIO_CLASS_IDLE, 0));
+	if (sbi->s_spec_css)
+		bio_associate_blkcg(bio, sbi->s_spec_css);
+	submit_bio(bio);
+}
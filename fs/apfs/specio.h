@@ -0,0 +1,20 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/specio.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_SPECIO_H
+#define _APFS_SPECIO_H
+
+struct apfs_sb_info;
+struct buffer_head;
+struct super_block;
+
+extern void apfs_spec_init(struct super_block *sb);
+extern void apfs_spec_destroy(struct apfs_sb_info *sbi);
+extern void apfs_spec_submit_bh(struct super_block *sb, int op_flags,
+				struct buffer_head *bh);
+
+#endif	/* _APFS_SPECIO_H */
@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/stats.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#include <linux/log2.h>
+#include <linux/mm.h>
+#include <linux/percpu.h>
+#include <linux/seq_file.h>
+#include "apfs.h"
+#include "stats.h"
+#include "super.h"
+
+/**
+ * apfs_stat_read - Sum up a performance counter over all cpus
+ * @sbi:	sb info of the mount
+ * @item:	the counter
+ *
+ * The counters are not updated atomically with each other, so the sum is only
+ * a snapshot; that is good enough for statistics.
+ */
+u64 apfs_stat_read(struct apfs_sb_info *sbi, enum apfs_stat_item item)
+{
+	u64 sum = 0;
+	int cpu;
+
+	for_each_possible_cpu(cpu)
+		sum += per_cpu_ptr(sbi->s_stats, cpu)->count[item];
+	return sum;
+}
+
+/*
+ * Pairs of counters reported in /proc/self/mountstats, as requests and bytes
+ */
+static const struct {
+	const char *name;
+	enum apfs_stat_item reqs;
+	enum apfs_stat_item bytes;
+} apfs_io_stats[] = {
+	{ "nodes",	APFS_STAT_NODE_READS,		APFS_STAT_NODE_BYTES },
+	{ "omap_nodes",	APFS_STAT_OMAP_NODE_READS,	APFS_STAT_OMAP_NODE_BYTES },
+	{ "data",	APFS_STAT_DATA_READS,		APFS_STAT_DATA_BYTES },
+	{ "xattr_dstream", APFS_STAT_XATTR_READS,	APFS_STAT_XATTR_BYTES },
+	{ "decompressed", APFS_STAT_DECOMP_CHUNKS,	APFS_STAT_DECOMP_BYTES },
+	{ "decrypted",	APFS_STAT_CRYPT_BATCHES,	APFS_STAT_CRYPT_BYTES },
+};
+
+/**
+ * apfs_show_stats - Show the i/o counters of a mount in mountstats
+ * @seq:	the seq_file for /proc/<pid>/mountstats
+ * @root:	root dentry of the mount
+ *
+ * Each line reports the number of requests and then the number of bytes, so
+ * that tools can compute the ratios of metadata to data for the workload.
+ * The omap nodes are also counted among the nodes.  Returns 0.
+ */
+int apfs_show_stats(struct seq_file *seq, struct dentry *root)
+{
+	struct apfs_sb_info *sbi = APFS_SB(root->d_sb);
+	int i;
+
+	seq_puts(seq, "statvers=1.0");
+	for (i = 0; i < ARRAY_SIZE(apfs_io_stats); ++i)
+		seq_printf(seq, "\n\t%s: %llu %llu", apfs_io_stats[i].name,
+			   apfs_stat_read(sbi, apfs_io_stats[i].reqs),
+			   apfs_stat_read(sbi, apfs_io_stats[i].bytes));
+	seq_printf(seq, "\n\tmetadata_bytes: %llu",
+		   apfs_stat_read(sbi, APFS_STAT_META_BYTES));
+	return 0;
+}
+
+#ifdef CONFIG_APFS_DEBUG
+
+/**
+ * apfs_lat_end - Count a latency measurement in its histogram
+ * @sb:		filesystem superblock
+ * @item:	the histogram
+ * @start:	start time, from apfs_lat_start()
+ */
+void apfs_lat_end(struct super_block *sb, enum apfs_lat_item item, u64 start)
+{
+	u64 ns = ktime_get_ns() - start;
+	unsigned int bucket = ns ? min(ilog2(ns), APFS_LAT_BUCKETS - 1) : 0;
+
+	this_cpu_inc(APFS_SB(sb)->s_latency->count[item][bucket]);
+}
+
+/**
+ * apfs_lat_read - Sum up a latency histogram bucket over all cpus
+ * @sbi:	sb info of the mount
+ * @item:	the histogram
+ * @bucket:	the bucket
+ */
+u64 apfs_lat_read(struct apfs_sb_info *sbi, enum apfs_lat_item item,
+		  unsigned int bucket)
+{
+	u64 sum = 0;
+	int cpu;
+
+	for_each_possible_cpu(cpu)
+		sum += per_cpu_ptr(sbi->s_latency, cpu)->count[item][bucket];
+	return sum;
+}
+
+#endif	/* CONFIG_APFS_DEBUG */
+
+/**
+ * apfs_stats_init - Allocate the performance counters for a new mount
+ * @sb:		filesystem superblock
+ *
+ * The counters are per-cpu, so that the hot paths never share a cache line.
+ * Returns 0 on success, or -ENOMEM in case of failure.
+ */
+int apfs_stats_init(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+
+	sbi->s_stats = alloc_percpu(struct apfs_stats);
+	if (!sbi->s_stats)
+		return -ENOMEM;
+#ifdef CONFIG_APFS_DEBUG
+	sbi->s_latency = alloc_percpu(struct apfs_latency);
+	if (!sbi->s_latency) {
+		free_percpu(sbi->s_stats);
+		sbi->s_stats = NULL;
+		return -ENOMEM;
+	}
+#endif
+	return 0;
+}
+
+/**
+ * apfs_heatmap_init - Allocate the heat map for a new mount, if asked for
+ * @sb:		filesystem superblock
+ *
+ * The regions are 1 MiB, unless the container needs more than the maximum
+ * number of them.  This must be called once the container is mapped.
+ * Returns 0 on success, or -ENOMEM in case of failure.
+ */
+int apfs_heatmap_init(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_heatmap *heat;
+	unsigned int shift = APFS_HEAT_MIN_SHIFT;
+	u64 bytes;
+
+	if (!(sbi->s_flags & APFS_HEATMAP))
+		return 0;
+	bytes = le64_to_cpu(sbi->s_msb_raw->nx_block_count);
+	bytes <<= sb->s_blocksize_bits;
+	while ((bytes >> shift) >= APFS_HEAT_MAX_REGIONS)
+		shift++;
+
+	heat = kvzalloc(struct_size(heat, counts, (bytes >> shift) + 1),
+			GFP_KERNEL);
+	if (!heat)
+		return -ENOMEM;
+	heat->shift = shift;
+	heat->nr = (bytes >> shift) + 1;
+	sbi->s_heatmap = heat;
+	return 0;
+}
+
+/**
+ * apfs_stats_destroy - Free the performance counters of a mount
+ * @sbi:	sb info of the mount
+ */
+void apfs_stats_destroy(struct apfs_sb_info *sbi)
+{
+	free_percpu(sbi->s_stats);
+	sbi->s_stats = NULL;
+	kvfree(sbi->s_heatmap);
+	sbi->s_heatmap = NULL;
+#ifdef CONFIG_APFS_DEBUG
+	free_percpu(sbi->s_latency);
+	sbi->s_latency = NULL;
+#endif
+}
@@ -0,0 +1,179 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/stats.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_STATS_H
+#define _APFS_STATS_H
+
+#include <linux/atomic.h>
+#include <linux/ktime.h>
+#include <linux/percpu.h>
+#include <linux/seq_file.h>
+#include <linux/types.h>
+#include "super.h"
+
+/*
+ * Performance counters kept for each mount
+ */
+enum apfs_stat_item {
+	APFS_STAT_NODE_READS,		/* Nodes parsed from the page cache */
+	APFS_STAT_NODE_CACHE_HITS,	/* Nodes found in the node cache */
+	APFS_STAT_OMAP_CACHE_HITS,	/* Translations found in omap cache */
+	APFS_STAT_OMAP_CACHE_MISSES,	/* Translations that needed a query */
+	APFS_STAT_REC_CACHE_HITS,	/* Catalog queries answered by cache */
+	APFS_STAT_FINGER_HITS,		/* Catalog queries from the last leaf */
+	APFS_STAT_CATIDX_HITS,		/* Catalog queries answered by index */
+	APFS_STAT_CHILD_MAP_HITS,	/* Child steps with no omap lookup */
+	APFS_STAT_QUERY_OMAP,		/* Object map queries */
+	APFS_STAT_QUERY_CAT,		/* Catalog queries */
+	APFS_STAT_QUERY_OTHER,		/* Queries of the other trees */
+	APFS_STAT_QUERY_EXACT,		/* Queries for an exact match */
+	APFS_STAT_QUERY_MULTIPLE,	/* Queries for multiple records */
+	APFS_STAT_DESCENTS,		/* Searches from root to leaf */
+	APFS_STAT_DESCENT_LEVELS,	/* Levels gone down by those searches */
+	APFS_STAT_EXTENT_HITS,		/* Extents found in the extent map */
+	APFS_STAT_EXTENT_MISSES,	/* Extents not in the extent map */
+	APFS_STAT_READDIR_RESTARTS,	/* Readdirs that scanned from the start */
+	APFS_STAT_META_BYTES,		/* Bytes of metadata objects read */
+	APFS_STAT_DATA_BYTES,		/* Bytes of file data read */
+	APFS_STAT_NODE_BYTES,		/* Bytes of nodes parsed */
+	APFS_STAT_OMAP_NODE_READS,	/* Object map nodes parsed */
+	APFS_STAT_OMAP_NODE_BYTES,	/* Bytes of those nodes */
+	APFS_STAT_DATA_READS,		/* Read requests for file data */
+	APFS_STAT_CLONE_PAGES,		/* Shared data pages read via device */
+	APFS_STAT_XATTR_READS,		/* Reads from xattr dstreams */
+	APFS_STAT_XATTR_BYTES,		/* Bytes read from xattr dstreams */
+	APFS_STAT_DECOMP_CHUNKS,	/* Compressed chunks decoded */
+	APFS_STAT_DECOMP_BYTES,		/* Bytes of decompressed output */
+	APFS_STAT_CRYPT_BATCHES,	/* Batches of blocks decrypted */
+	APFS_STAT_CRYPT_BYTES,		/* Bytes decrypted in software */
+	APFS_STAT_LISTING_HITS,		/* Readdirs served from a listing */
+	APFS_NR_STATS
+};
+
+struct apfs_stats {
+	u64 count[APFS_NR_STATS];
+};
+
+/**
+ * apfs_stat_add - Add to a performance counter of a mount
+ * @sb:		filesystem superblock
+ * @item:	the counter
+ * @n:		value to add
+ */
+static inline void apfs_stat_add(struct super_block *sb,
+				 enum apfs_stat_item item, u64 n)
+{
+	this_cpu_add(APFS_SB(sb)->s_stats->count[item], n);
+}
+
+/**
+ * apfs_stat_inc - Increment a performance counter of a mount
+ * @sb:		filesystem superblock
+ * @item:	the counter
+ */
+static inline void apfs_stat_inc(struct super_block *sb,
+				 enum apfs_stat_item item)
+{
+	apfs_stat_add(sb, item, 1);
+}
+
+#ifdef CONFIG_APFS_DEBUG
+
+/*
+ * Latency histograms kept for each mount
+ */
+enum apfs_lat_item {
+	APFS_LAT_OMAP_EXACT,		/* Exact object map queries */
+	APFS_LAT_OMAP_MULTIPLE,		/* First search of multiple queries */
+	APFS_LAT_OMAP_NEXT,		/* Later searches of multiple queries */
+	APFS_LAT_CAT_EXACT,
+	APFS_LAT_CAT_MULTIPLE,
+	APFS_LAT_CAT_NEXT,
+	APFS_LAT_NODE_READ,		/* Wait for the block of a node */
+	APFS_LAT_DECOMPRESS,		/* Decompression of a single chunk */
+	APFS_NR_LATS
+};
+
+/* Buckets for each histogram, by log2 of the latency in nanoseconds */
+#define APFS_LAT_BUCKETS	32
+
+struct apfs_latency {
+	u64 count[APFS_NR_LATS][APFS_LAT_BUCKETS];
+};
+
+/**
+ * apfs_lat_start - Get the start time for a latency measurement
+ */
+static inline u64 apfs_lat_start(void)
+{
+	return ktime_get_ns();
+}
+
+extern void apfs_lat_end(struct super_block *sb, enum apfs_lat_item item,
+			 u64 start);
+extern u64 apfs_lat_read(struct apfs_sb_info *sbi, enum apfs_lat_item item,
+			 unsigned int bucket);
+
+#else	/* CONFIG_APFS_DEBUG */
+
+static inline u64 apfs_lat_start(void)
+{
+	return 0;
+}
+#define apfs_lat_end(sb, item, start)	do { (void)(start); } while (0)
+
+#endif	/* CONFIG_APFS_DEBUG */
+
+/*
+ * Kinds of reads counted in the heat map
+ */
+enum apfs_heat_kind {
+	APFS_HEAT_NODE,			/* Nodes read from the device */
+	APFS_HEAT_DATA,			/* File data mappings for reads */
+	APFS_NR_HEAT_KINDS
+};
+
+/* Smallest region of the heat map, as log2 of the bytes */
+#define APFS_HEAT_MIN_SHIFT	20
+/* Most regions in the heat map, bigger devices get bigger regions */
+#define APFS_HEAT_MAX_REGIONS	(1 << 18)
+
+/*
+ * Read counts for each region of the container, with the heatmap option
+ */
+struct apfs_heatmap {
+	unsigned int shift;		/* Log2 of the bytes in each region */
+	unsigned long nr;		/* Number of regions */
+	atomic_t counts[][APFS_NR_HEAT_KINDS];
+};
+
+/**
+ * apfs_heat_inc - Count a read in the heat map, if the mount keeps one
+ * @sb:		filesystem superblock
+ * @kind:	kind of read
+ * @addr:	byte offset of the read in the main device
+ */
+static inline void apfs_heat_inc(struct super_block *sb,
+				 enum apfs_heat_kind kind, u64 addr)
+{
+	struct apfs_heatmap *heat = APFS_SB(sb)->s_heatmap;
+	u64 region;
+
+	if (likely(!heat))
+		return;
+	region = addr >> heat->shift;
+	if (region < heat->nr)
+		atomic_inc(&heat->counts[region][kind]);
+}
+
+extern int apfs_heatmap_init(struct super_block *sb);
+extern u64 apfs_stat_read(struct apfs_sb_info *sbi, enum apfs_stat_item item);
+extern int apfs_show_stats(struct seq_file *seq, struct dentry *root);
+extern int apfs_stats_init(struct super_block *sb);
+extern void apfs_stats_destroy(struct apfs_sb_info *sbi);
+
+#endif	/* _APFS_STATS_H */
@@ -14,13 +14,37 @@
 #include <linux/statfs.h>
 #include <linux/seq_file.h>
 #include <linux/iversion.h>
+#include <linux/backing-dev.h>
+#include <linux/blkdev.h>
+#include <linux/mutex.h>
+#include <linux/pagemap.h>
+#include <linux/log2.h>
+#include <linux/loop.h>
+#include <linux/major.h>
+#include <linux/mount.h>
 #include "apfs.h"
+#include "bench.h"
 #include "btree.h"
+#include "crypto.h"
+#include "dax.h"
+#include "debugfs.h"
+#include "dir.h"
+#include "fscache.h"
+#include "fusion.h"
 #include "inode.h"
 #include "message.h"
+#include "namecache.h"
 #include "node.h"
 #include "object.h"
+#include "snapdir.h"
+#include "snapshot.h"
+#include "spaceman.h"
+#include "specio.h"
+#include "stats.h"
 #include "super.h"
+#include "sysfs.h"
+#include "trace.h"
+#include "warmup.h"
 #include "xattr.h"
 
 /**
@@ -51,6 +75,28 @@ static struct buffer_head *apfs_read_super_copy(struct super_block *sb)
 	}
 	msb_raw = (struct apfs_nx_superblock *)bh->b_data;
 	blocksize = le32_to_cpu(msb_raw->nx_block_size);
+	if (le32_to_cpu(msb_raw->nx_magic) != APFS_NX_MAGIC) {
+		apfs_err(sb, "not an apfs filesystem");
+		goto fail;
+	}
+	if (blocksize < APFS_NX_MINIMUM_BLOCK_SIZE ||
+	    blocksize > APFS_NX_MAXIMUM_BLOCK_SIZE ||
+	    !is_power_of_2(blocksize)) {
+		apfs_err(sb, "bad blocksize %d", blocksize);
+		goto fail;
+	}
+	/*
+	 * Block numbers are in units of the container block all over, and the
+	 * superblock reads and the data mappings go through buffer heads, so
+	 * the device must use the same block size; the buffer layer can't go
+	 * over a page.  Objects themselves could span several pages.
+	 */
+	if (blocksize > PAGE_SIZE) {
+		apfs_err(sb, "blocksize %d is bigger than the page size",
+			 blocksize);
+		err = -EOPNOTSUPP;
+		goto fail;
+	}
 
 	if (sb->s_blocksize != blocksize) {
 		brelse(bh);
@@ -84,22 +130,62 @@ static struct buffer_head *apfs_read_super_copy(struct super_block *sb)
 	return ERR_PTR(err);
 }
 
+static struct file_system_type apfs_fs_type;
+
+/* List of the containers with mounted volumes, protected by the mutex */
+static LIST_HEAD(apfs_nxs);
+static DEFINE_MUTEX(apfs_nxs_mutex);
+
 /**
- * apfs_map_main_super - Find the container superblock and map it into memory
- * @sb:	superblock structure
+ * apfs_desc_readahead - Start the reads for a window of checkpoint descriptors
+ * @sb:		superblock structure
+ * @base:	first block of the descriptor area
+ * @blocks:	number of blocks in the descriptor area
+ * @first:	index of the first block in the window
+ * @count:	number of blocks in the window
+ *
+ * The descriptor area is a ring, so the window may wrap around.  The reads are
+ * plugged together so that the block layer can merge them.
+ */
+static void apfs_desc_readahead(struct super_block *sb, u64 base, u32 blocks,
+				u32 first, u32 count)
+{
+	struct blk_plug plug;
+
+	blk_start_plug(&plug);
+	while (count--) {
+		apfs_meta_readahead(sb, base + first);
+		if (++first == blocks)
+			first = 0;
+	}
+	blk_finish_plug(&plug);
+}
+
+/**
+ * apfs_read_main_super - Find the container superblock and read it
+ * @sb:		superblock structure
+ * @nxi:	container structure to fill
+ * @want_xid:	xid of the checkpoint to read, or 0 for the latest
+ *
+ * The checkpoint of the superblock copy in block zero is used as a hint: any
+ * later ones were written right after it in the descriptor ring, so the scan
+ * starts there and stops once it wraps around to an older checkpoint.  Usually
+ * that takes a single batch of reads.  An older checkpoint may be anywhere in
+ * the ring, so the scan only stops once it's found.
  *
  * Returns a negative error code in case of failure.  On success, returns 0
- * and sets the s_msb_raw, s_mobject and s_xid fields of APFS_SB(@sb).
+ * and sets the nx_raw, nx_bh, nx_xid and nx_blocksize fields of @nxi.
  */
-static int apfs_map_main_super(struct super_block *sb)
+static int apfs_read_main_super(struct super_block *sb,
+				struct apfs_nxsb_info *nxi, u64 want_xid)
 {
-	struct apfs_sb_info *sbi = APFS_SB(sb);
 	struct buffer_head *bh;
 	struct buffer_head *desc_bh = NULL;
 	struct apfs_nx_superblock *msb_raw;
-	u64 xid, bno = APFS_NX_BLOCK_NUM;
+	u64 xid, copy_xid;
 	u64 desc_base;
-	u32 desc_blocks;
+	u32 desc_blocks, desc_index, desc_len, start;
+	bool reached_copy = false;
 	int err = -EINVAL;
 	int i;
 
@@ -112,7 +198,10 @@ static int apfs_map_main_super(struct super_block *sb)
 	/* We want to mount the latest valid checkpoint among the descriptors */
 	desc_base = le64_to_cpu(msb_raw->nx_xp_desc_base);
 	if (desc_base >> 63 != 0) {
-		/* The highest bit is set when checkpoints are not contiguous */
+		/*
+		 * The highest bit is set when checkpoints are not contiguous.
+		 * The layout of the tree that maps them is not documented.
+		 */
 		apfs_err(sb, "checkpoint descriptor tree not yet supported");
 		goto fail;
 	}
@@ -123,13 +212,28 @@ static int apfs_map_main_super(struct super_block *sb)
 		goto fail;
 	}
 
+	/* The last descriptor of the checkpoint is the superblock itself */
+	desc_index = le32_to_cpu(msb_raw->nx_xp_desc_index);
+	desc_len = le32_to_cpu(msb_raw->nx_xp_desc_len);
+	if (desc_index < desc_blocks && desc_len && desc_len <= desc_blocks)
+		start = (desc_index + desc_len - 1) % desc_blocks;
+	else
+		start = 0; /* Bad hint, so just scan the whole area */
+
 	/* Now we go through the checkpoints one by one */
-	xid = le64_to_cpu(msb_raw->nx_o.o_xid);
+	copy_xid = xid = le64_to_cpu(msb_raw->nx_o.o_xid);
 	for (i = 0; i < desc_blocks; ++i) {
 		struct apfs_nx_superblock *desc_raw;
+		u32 index = (start + i) % desc_blocks;
+		u64 desc_xid;
+
+		if (i % APFS_NX_DESC_RA_BLOCKS == 0)
+			apfs_desc_readahead(sb, desc_base, desc_blocks, index,
+					    min_t(u32, desc_blocks - i,
+						  APFS_NX_DESC_RA_BLOCKS));
 
 		brelse(desc_bh);
-		desc_bh = sb_bread(sb, desc_base + i);
+		desc_bh = sb_bread(sb, desc_base + index);
 		if (!desc_bh) {
 			apfs_err(sb, "unable to read checkpoint descriptor");
 			goto fail;
@@ -138,51 +242,245 @@ static int apfs_map_main_super(struct super_block *sb)
 
 		if (le32_to_cpu(desc_raw->nx_magic) != APFS_NX_MAGIC)
 			continue; /* Not a superblock */
-		if (le64_to_cpu(desc_raw->nx_o.o_xid) <= xid)
+		desc_xid = le64_to_cpu(desc_raw->nx_o.o_xid);
+		if (want_xid) {
+			if (desc_xid != want_xid ||
+			    !apfs_obj_verify_csum(sb, &desc_raw->nx_o))
+				continue;
+			xid = desc_xid;
+			msb_raw = desc_raw;
+			brelse(bh);
+			bh = desc_bh;
+			desc_bh = NULL;
+			break;
+		}
+		if (desc_xid <= xid) {
+			if (desc_xid == copy_xid)
+				reached_copy = true;
+			/* Past the newest checkpoint, into the old ones */
+			if (reached_copy && desc_xid < xid &&
+			    apfs_obj_verify_csum(sb, &desc_raw->nx_o))
+				break;
 			continue; /* Old */
+		}
 		if (!apfs_obj_verify_csum(sb, &desc_raw->nx_o))
 			continue; /* Corrupted */
 
-		xid = le64_to_cpu(desc_raw->nx_o.o_xid);
+		reached_copy = true;
+		xid = desc_xid;
 		msb_raw = desc_raw;
-		bno = desc_base + i;
 		brelse(bh);
 		bh = desc_bh;
 		desc_bh = NULL;
 	}
+	brelse(desc_bh);
+	desc_bh = NULL;
+
+	/* The copy in block zero will do if it's the one, but not otherwise */
+	if (want_xid && xid != want_xid) {
+		apfs_err(sb, "checkpoint 0x%llx is not in the descriptor area",
+			 want_xid);
+		err = -ENOENT;
+		goto fail;
+	}
 
-	sbi->s_xid = xid;
-	sbi->s_msb_raw = msb_raw;
-	sbi->s_mobject.sb = sb;
-	sbi->s_mobject.block_nr = bno;
-	sbi->s_mobject.oid = le64_to_cpu(msb_raw->nx_o.o_oid);
-	sbi->s_mobject.bh = bh;
+	nxi->nx_xid = xid;
+	nxi->nx_raw = msb_raw;
+	nxi->nx_bh = bh;
+	nxi->nx_blocksize = sb->s_blocksize;
 	return 0;
 
 fail:
+	brelse(desc_bh);
 	brelse(bh);
 	return err;
 }
 
 /**
- * apfs_unmap_main_super - Clean up apfs_map_main_super()
- * @sb:	filesystem superblock
+ * apfs_open_tier2 - Open the slow device of a Fusion container
+ * @sb:		superblock structure
+ * @nxi:	container structure, with the main superblock read
+ *
+ * Does nothing for containers that are not Fusion.  Returns 0 on success, or
+ * a negative error code in case of failure.
  */
-static inline void apfs_unmap_main_super(struct super_block *sb)
+static int apfs_open_tier2(struct super_block *sb, struct apfs_nxsb_info *nxi)
 {
 	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_nx_superblock *msb_raw = nxi->nx_raw;
+	struct apfs_nx_superblock *tier2_raw;
+	struct block_device *bdev;
+	struct page *page;
+	int err = 0;
+	int i;
+
+	if (!(le64_to_cpu(msb_raw->nx_incompatible_features) &
+	      APFS_NX_INCOMPAT_FUSION))
+		return 0;
+	if (!sbi->s_tier2_path) {
+		apfs_err(sb, "fusion container needs the tier2 mount option");
+		return -EINVAL;
+	}
+
+	bdev = blkdev_get_by_path(sbi->s_tier2_path, FMODE_READ | FMODE_EXCL,
+				  &apfs_fs_type);
+	if (IS_ERR(bdev)) {
+		apfs_err(sb, "unable to open tier2 device %s",
+			 sbi->s_tier2_path);
+		return PTR_ERR(bdev);
+	}
+
+	/* Both devices have the same fusion uuid, but for the highest bit */
+	page = read_mapping_page(bdev->bd_inode->i_mapping, 0, NULL);
+	if (IS_ERR(page)) {
+		err = PTR_ERR(page);
+		goto fail;
+	}
+	tier2_raw = page_address(page);
+	for (i = 0; i < sizeof(msb_raw->nx_fusion_uuid); ++i) {
+		u8 mask = i == 0 ? 0x7f : 0xff;
 
-	brelse(sbi->s_mobject.bh);
+		if ((msb_raw->nx_fusion_uuid[i] ^ tier2_raw->nx_fusion_uuid[i])
+		    & mask)
+			err = -EINVAL;
+	}
+	if (le32_to_cpu(tier2_raw->nx_magic) != APFS_NX_MAGIC)
+		err = -EINVAL;
+	put_page(page);
+	if (err) {
+		apfs_err(sb, "tier2 device is not part of this container");
+		goto fail;
+	}
+
+	nxi->nx_fusion_mt = le64_to_cpu(msb_raw->nx_fusion_mt_oid);
+	if (nxi->nx_fusion_mt & apfs_fusion_tier2(sb)) {
+		apfs_err(sb, "fusion middle tree is not in the main device");
+		err = -EFSCORRUPTED;
+		goto fail;
+	}
+	nxi->nx_tier2_bdev = bdev;
+	return 0;
+
+fail:
+	blkdev_put(bdev, FMODE_READ | FMODE_EXCL);
+	return err;
 }
 
 /**
- * apfs_map_volume_super - Find the volume superblock and map it into memory
+ * apfs_map_main_super - Map the container superblock into memory
  * @sb:	superblock structure
  *
- * Returns a negative error code in case of failure.  On success, returns 0
- * and sets APFS_SB(@sb)->s_vsb_raw and APFS_SB(@sb)->s_vobject.
+ * The container is only read by the first mounted volume of the device; all
+ * others share it.  Mounts of an older checkpoint, with the xid option, get a
+ * container of their own, shared only with mounts of the same checkpoint.
+ * Returns a negative error code in case of failure.  On
+ * success, returns 0 and sets the s_nxi, s_msb_raw and s_xid fields of
+ * APFS_SB(@sb).
  */
-static int apfs_map_volume_super(struct super_block *sb)
+static int apfs_map_main_super(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_nxsb_info *nxi;
+	bool new = false;
+	int err;
+
+	mutex_lock(&apfs_nxs_mutex);
+
+	list_for_each_entry(nxi, &apfs_nxs, nx_list) {
+		if (nxi->nx_bdev != sb->s_bdev ||
+		    nxi->nx_ckpt_xid != sbi->s_ckpt_xid)
+			continue;
+		/* Same size as the device already has, so no buffers lost */
+		if (!sb_set_blocksize(sb, nxi->nx_blocksize)) {
+			apfs_err(sb, "unable to set blocksize");
+			err = -EINVAL;
+			goto out;
+		}
+		++nxi->nx_refcnt;
+		goto found;
+	}
+
+	nxi = kzalloc(sizeof(*nxi), GFP_KERNEL);
+	if (!nxi) {
+		err = -ENOMEM;
+		goto out;
+	}
+	err = apfs_read_main_super(sb, nxi, sbi->s_ckpt_xid);
+	if (err) {
+		kfree(nxi);
+		goto out;
+	}
+	err = apfs_open_tier2(sb, nxi);
+	if (err) {
+		brelse(nxi->nx_bh);
+		kfree(nxi);
+		goto out;
+	}
+	nxi->nx_bdev = sb->s_bdev;
+	nxi->nx_ckpt_xid = sbi->s_ckpt_xid;
+	nxi->nx_refcnt = 1;
+	spin_lock_init(&nxi->nx_used_lock);
+	apfs_free_index_init(&nxi->nx_free_index);
+	list_add(&nxi->nx_list, &apfs_nxs);
+	new = true;
+
+found:
+	sbi->s_nxi = nxi;
+	sbi->s_msb_raw = nxi->nx_raw;
+	sbi->s_xid = nxi->nx_xid;
+
+	if (new) {
+		err = apfs_read_ckpt_map(sb);
+		if (err)
+			apfs_notice(sb, "unable to read checkpoint map (%d)",
+				    err);
+		/* Not fatal, statfs can still count the blocks of each volume */
+		err = apfs_read_spaceman(sb);
+		if (err)
+			apfs_notice(sb, "free space will be estimated (%d)",
+				    err);
+	}
+	err = 0;
+out:
+	mutex_unlock(&apfs_nxs_mutex);
+	return err;
+}
+
+/**
+ * apfs_unmap_main_super - Clean up apfs_map_main_super()
+ * @sb:	filesystem superblock
+ */
+static void apfs_unmap_main_super(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_nxsb_info *nxi = sbi->s_nxi;
+
+	mutex_lock(&apfs_nxs_mutex);
+	sbi->s_nxi = NULL;
+	sbi->s_msb_raw = NULL;
+	if (--nxi->nx_refcnt == 0) {
+		list_del(&nxi->nx_list);
+		if (nxi->nx_tier2_bdev)
+			blkdev_put(nxi->nx_tier2_bdev, FMODE_READ | FMODE_EXCL);
+		apfs_free_index_destroy(&nxi->nx_free_index);
+		kfree(nxi->nx_ckpt_map);
+		brelse(nxi->nx_bh);
+		kfree(nxi);
+	}
+	mutex_unlock(&apfs_nxs_mutex);
+}
+
+/**
+ * apfs_read_volume_super - Find the superblock of a volume and read it
+ * @sb:		superblock structure
+ * @vol_nr:	index of the volume in the container superblock
+ * @obj:	on return, the volume superblock object
+ *
+ * Returns 0 on success, -ENOENT if there is no such volume, or another
+ * negative error code in case of failure.
+ */
+static int apfs_read_volume_super(struct super_block *sb, unsigned int vol_nr,
+				  struct apfs_object *obj)
 {
 	struct apfs_sb_info *sbi = APFS_SB(sb);
 	struct apfs_nx_superblock *msb_raw = sbi->s_msb_raw;
@@ -195,15 +493,11 @@ static int apfs_map_volume_super(struct super_block *sb)
 	int err;
 
 	/* Get the id for the requested volume number */
-	if (sbi->s_vol_nr >= APFS_NX_MAX_FILE_SYSTEMS) {
-		apfs_err(sb, "volume number out of range");
-		return -EINVAL;
-	}
-	vol_id = le64_to_cpu(msb_raw->nx_fs_oid[sbi->s_vol_nr]);
-	if (vol_id == 0) {
-		apfs_err(sb, "requested volume does not exist");
-		return -EINVAL;
-	}
+	if (vol_nr >= APFS_NX_MAX_FILE_SYSTEMS)
+		return -ENOENT;
+	vol_id = le64_to_cpu(msb_raw->nx_fs_oid[vol_nr]);
+	if (vol_id == 0)
+		return -ENOENT;
 
 	/* Get the container's object map */
 	msb_omap = le64_to_cpu(msb_raw->nx_omap_oid);
@@ -215,8 +509,8 @@ static int apfs_map_volume_super(struct super_block *sb)
 	msb_omap_raw = (struct apfs_omap_phys *)bh->b_data;
 	if (!apfs_obj_verify_csum(sb, &msb_omap_raw->om_o)) {
 		apfs_err(sb, "bad checksum for the container object map");
-		err = -EFSBADCRC;
-		goto fail;
+		brelse(bh);
+		return -EFSBADCRC;
 	}
 
 	/* Get the Volume Block */
@@ -237,36 +531,118 @@ static int apfs_map_volume_super(struct super_block *sb)
 		return err;
 	}
 
-	bh = sb_bread(sb, vsb);
-	if (!bh) {
+	err = apfs_object_read(sb, vsb, 1 /* blocks */, obj);
+	if (err) {
 		apfs_err(sb, "unable to read volume superblock");
-		return -EINVAL;
+		return err;
 	}
 
-	vsb_raw = (struct apfs_superblock *)bh->b_data;
+	vsb_raw = (struct apfs_superblock *)obj->data;
 	if (le32_to_cpu(vsb_raw->apfs_magic) != APFS_MAGIC) {
 		apfs_err(sb, "wrong magic in volume superblock");
 		err = -EINVAL;
 		goto fail;
 	}
-	if (!apfs_obj_verify_csum(sb, &vsb_raw->apfs_o)) {
+	if (!apfs_object_verify_csum(obj)) {
 		apfs_err(sb, "inconsistent volume superblock");
 		err = -EFSBADCRC;
 		goto fail;
 	}
-
-	sbi->s_vsb_raw = vsb_raw;
-	sbi->s_vobject.sb = sb;
-	sbi->s_vobject.block_nr = vsb;
-	sbi->s_vobject.oid = le64_to_cpu(vsb_raw->apfs_o.o_oid);
-	sbi->s_vobject.bh = bh;
+	obj->oid = le64_to_cpu(vsb_raw->apfs_o.o_oid);
 	return 0;
 
 fail:
-	brelse(bh);
+	apfs_object_release(obj);
 	return err;
 }
 
+/**
+ * apfs_map_volume_super - Find the volume superblock and map it into memory
+ * @sb:	superblock structure
+ *
+ * Returns a negative error code in case of failure.  On success, returns 0
+ * and sets APFS_SB(@sb)->s_vsb_raw and APFS_SB(@sb)->s_vobject.
+ */
+static int apfs_map_volume_super(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	int err;
+
+	err = apfs_read_volume_super(sb, sbi->s_vol_nr, &sbi->s_vobject);
+	if (err == -ENOENT) {
+		apfs_err(sb, "requested volume does not exist");
+		return -EINVAL;
+	}
+	if (err)
+		return err;
+
+	sbi->s_vsb_raw = (struct apfs_superblock *)sbi->s_vobject.data;
+
+	/*
+	 * The catalog of a sealed volume is a physical tree of hashed nodes,
+	 * and its file extents are kept in a tree of their own.  None of that
+	 * can be read yet, so don't let the mount fail later in some obscure
+	 * way, or read files as holes.
+	 */
+	if (sbi->s_vsb_raw->apfs_incompatible_features &
+	    cpu_to_le64(APFS_INCOMPAT_SEALED_VOLUME)) {
+		apfs_err(sb, "sealed volumes are not supported");
+		apfs_object_release(&sbi->s_vobject);
+		sbi->s_vsb_raw = NULL;
+		return -EOPNOTSUPP;
+	}
+	apfs_set_case_fold(sbi);
+	return 0;
+}
+
+/**
+ * apfs_find_data_volume - Find the data volume in the group of a system volume
+ * @sb:		superblock structure, with the volume superblock mapped
+ * @vol_nr:	on return, the index of the data volume
+ *
+ * Returns 0 on success, -ENOENT if the volume is not the system volume of a
+ * group, or another negative error code in case of failure.
+ */
+static int apfs_find_data_volume(struct super_block *sb, unsigned int *vol_nr)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_superblock *vsb_raw = sbi->s_vsb_raw;
+	static const char no_group[16];
+	unsigned int i;
+	int err;
+
+	if (le16_to_cpu(vsb_raw->apfs_role) != APFS_VOL_ROLE_SYSTEM)
+		return -ENOENT;
+	if (!memcmp(vsb_raw->apfs_volume_group_id, no_group, sizeof(no_group)))
+		return -ENOENT;
+
+	for (i = 0; i < APFS_NX_MAX_FILE_SYSTEMS; i++) {
+		struct apfs_object obj = {0};
+		struct apfs_superblock *other;
+		bool found;
+
+		if (i == sbi->s_vol_nr)
+			continue;
+		err = apfs_read_volume_super(sb, i, &obj);
+		if (err == -ENOENT)
+			continue;
+		if (err)
+			return err;
+
+		other = (struct apfs_superblock *)obj.data;
+		found = le16_to_cpu(other->apfs_role) == APFS_VOL_ROLE_DATA &&
+			!memcmp(other->apfs_volume_group_id,
+				vsb_raw->apfs_volume_group_id,
+				sizeof(vsb_raw->apfs_volume_group_id));
+		apfs_object_release(&obj);
+		if (found) {
+			*vol_nr = i;
+			return 0;
+		}
+	}
+	return -ENOENT;
+}
+
 /**
  * apfs_unmap_volume_super - Clean up apfs_map_volume_super()
  * @sb:	filesystem superblock
@@ -275,7 +651,7 @@ static inline void apfs_unmap_volume_super(struct super_block *sb)
 {
 	struct apfs_sb_info *sbi = APFS_SB(sb);
 
-	brelse(sbi->s_vobject.bh);
+	apfs_object_release(&sbi->s_vobject);
 }
 
 /**
@@ -321,6 +697,91 @@ static int apfs_read_omap(struct super_block *sb)
 	return 0;
 }
 
+/**
+ * apfs_pin_trees - Keep the top levels of the omap and catalog in memory
+ * @sb:	superblock structure
+ *
+ * Pinning is just an optimization, so a failure here is not fatal for the
+ * mount; it gets reported and the remaining nodes are read on demand.
+ */
+static void apfs_pin_trees(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	unsigned long count = 0;
+	int err;
+
+	if (sbi->s_pin_levels <= 1)
+		return;
+
+	err = apfs_btree_pin(sb, sbi->s_omap_root, APFS_QUERY_OMAP,
+			     sbi->s_pin_levels, &count);
+	if (!err)
+		err = apfs_btree_pin(sb, sbi->s_cat_root, APFS_QUERY_CAT,
+				     sbi->s_pin_levels, &count);
+	if (err)
+		apfs_warn(sb, "failed to pin b-tree nodes (%d)", err);
+
+	apfs_info(sb, "pinned %lu b-tree nodes (%lu KiB)", count,
+		  count * (apfs_node_size() + sb->s_blocksize) >> 10);
+}
+
+/**
+ * apfs_map_snapshot - Switch to the volume superblock of the chosen snapshot
+ * @sb:	superblock structure, with the live volume super and omap read
+ *
+ * The object map of a volume keeps the mappings for each of its snapshots, so
+ * the catalog of the snapshot is found by querying the omap with the xid of
+ * the snapshot.  Does nothing if no snapshot was requested.  Returns 0 on
+ * success, or a negative error code in case of failure.
+ */
+static int apfs_map_snapshot(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_superblock *vsb_raw;
+	struct apfs_snapshot snap;
+	struct apfs_object obj;
+	int err;
+
+	if (!sbi->s_snap_name)
+		return 0;
+
+	err = apfs_snapshot_find(sb, sbi->s_snap_name, &snap);
+	if (err) {
+		apfs_err(sb, "unable to find snapshot %s", sbi->s_snap_name);
+		return err;
+	}
+
+	err = apfs_object_read(sb, snap.sblock, 1 /* blocks */, &obj);
+	if (err) {
+		apfs_err(sb, "unable to read snapshot superblock");
+		return err;
+	}
+	vsb_raw = (struct apfs_superblock *)obj.data;
+	if (le32_to_cpu(vsb_raw->apfs_magic) != APFS_MAGIC) {
+		apfs_err(sb, "wrong magic in snapshot superblock");
+		err = -EINVAL;
+		goto fail;
+	}
+	if (!apfs_object_verify_csum(&obj)) {
+		apfs_err(sb, "inconsistent snapshot superblock");
+		err = -EFSBADCRC;
+		goto fail;
+	}
+	obj.oid = le64_to_cpu(vsb_raw->apfs_o.o_oid);
+
+	apfs_object_release(&sbi->s_vobject);
+	sbi->s_vobject = obj;
+	sbi->s_vsb_raw = vsb_raw;
+	apfs_set_case_fold(sbi);
+	sbi->s_xid = snap.xid;
+	sbi->s_snap_xid = snap.xid;
+	return 0;
+
+fail:
+	apfs_object_release(&obj);
+	return err;
+}
+
 /**
  * apfs_read_catalog - Find and read the catalog root node
  * @sb:	superblock structure
@@ -345,18 +806,52 @@ static int apfs_read_catalog(struct super_block *sb)
 	return 0;
 }
 
+/**
+ * apfs_free_sb_info - Free the sb info of a superblock
+ * @sbi: the sb info
+ */
+static void apfs_free_sb_info(struct apfs_sb_info *sbi)
+{
+	kfree(sbi->s_snap_name);
+	kfree(sbi->s_dev_name);
+	kfree(sbi->s_tier2_path);
+	kfree(sbi->s_catidx_path);
+	apfs_spec_destroy(sbi);
+	apfs_stats_destroy(sbi);
+	kfree(sbi);
+}
+
 static void apfs_put_super(struct super_block *sb)
 {
 	struct apfs_sb_info *sbi = APFS_SB(sb);
 
+	/* The firmlinks were all unmounted along with this volume */
+	mntput(sbi->s_vgroup_mnt);
+	apfs_warmup_stop(sb);
+	apfs_scrub_stop(sb);
+	apfs_meta_verify_flush(sb);
+	apfs_dir_ra_flush();
+	apfs_compress_flush();
+	apfs_fscache_put_super(sb);
+	apfs_debugfs_unregister(sb);
+	apfs_sysfs_unregister(sb);
+	apfs_catidx_destroy(sb);
 	apfs_node_put(sbi->s_cat_root);
 	apfs_node_put(sbi->s_omap_root);
-
+	apfs_name_cache_destroy(sb);
+	apfs_dir_indexes_destroy(sb);
+	apfs_chunk_cache_destroy(sb);
+	apfs_extent_maps_destroy(sb);
+	apfs_node_cache_destroy(sb);
+	apfs_meta_cache_put(sb);
+
+	apfs_dax_destroy(sb);
+	apfs_crypt_destroy(sb);
 	apfs_unmap_main_super(sb);
 	apfs_unmap_volume_super(sb);
 
 	sb->s_fs_info = NULL;
-	kfree(sbi);
+	apfs_free_sb_info(sbi);
 }
 
 static struct kmem_cache *apfs_inode_cachep;
@@ -372,15 +867,34 @@ static struct inode *apfs_alloc_inode(struct super_block *sb)
 	return &ai->vfs_inode;
 }
 
+static void apfs_evict_inode(struct inode *inode)
+{
+	truncate_inode_pages_final(&inode->i_data);
+	clear_inode(inode);
+	apfs_fscache_put_inode(inode);
+	apfs_xattr_stream_free(inode);
+}
+
 static void apfs_i_callback(struct rcu_head *head)
 {
 	struct inode *inode = container_of(head, struct inode, i_rcu);
 
+	/* Symlink targets get cached by apfs_get_link() */
+	if (S_ISLNK(inode->i_mode))
+		kfree(inode->i_link);
 	kmem_cache_free(apfs_inode_cachep, APFS_I(inode));
 }
 
 static void apfs_destroy_inode(struct inode *inode)
 {
+	apfs_extent_map_free(inode);
+	apfs_compress_free(inode);
+	apfs_dir_index_free(inode);
+	apfs_siblings_free(inode);
+	apfs_xattr_names_free(inode);
+	apfs_xattr_cache_free(inode);
+	kfree(APFS_I(inode)->i_name);
+	APFS_I(inode)->i_name = NULL;
 	call_rcu(&inode->i_rcu, apfs_i_callback);
 }
 
@@ -389,7 +903,23 @@ static void init_once(void *p)
 	struct apfs_inode_info *ai = (struct apfs_inode_info *)p;
 
 	spin_lock_init(&ai->i_extent_lock);
-	ai->i_cached_extent.len = 0;
+	RCU_INIT_POINTER(ai->i_extent_map, NULL);
+	ai->i_compress = NULL;
+	ai->i_xattr_stream = NULL;
+	ai->i_siblings = NULL;
+	ai->i_xattr_names = NULL;
+	ai->i_xattr_cache = NULL;
+	ai->i_name = NULL;
+#ifdef CONFIG_APFS_FSCACHE
+	ai->i_fscache = NULL;
+#endif
+	INIT_LIST_HEAD(&ai->i_extent_list);
+	RCU_INIT_POINTER(ai->i_dir_index, NULL);
+	INIT_LIST_HEAD(&ai->i_dir_index_list);
+	RCU_INIT_POINTER(ai->i_dir_bloom, NULL);
+	RCU_INIT_POINTER(ai->i_dir_listing, NULL);
+	INIT_LIST_HEAD(&ai->i_dir_listing_list);
+	ai->i_dir_listing_state = 0;
 	inode_init_once(&ai->vfs_inode);
 }
 
@@ -416,14 +946,14 @@ static void destroy_inodecache(void)
 }
 
 /**
- * apfs_count_used_blocks - Count the blocks in use across all volumes
+ * apfs_read_used_blocks - Count the blocks in use across all volumes
  * @sb:		filesystem superblock
  * @count:	on return it will store the block count
  *
  * This function probably belongs in a separate file, but for now it is
  * only called by statfs.
  */
-static int apfs_count_used_blocks(struct super_block *sb, u64 *count)
+static int apfs_read_used_blocks(struct super_block *sb, u64 *count)
 {
 	struct apfs_sb_info *sbi = APFS_SB(sb);
 	struct apfs_nx_superblock *msb_raw = sbi->s_msb_raw;
@@ -483,6 +1013,74 @@ static int apfs_count_used_blocks(struct super_block *sb, u64 *count)
 	return err;
 }
 
+/**
+ * apfs_count_used_blocks - Get the number of blocks in use across all volumes
+ * @sb:		filesystem superblock
+ * @count:	on return it will store the block count
+ *
+ * Reading the count takes a block read for every volume of the container,
+ * but it can't change while the checkpoint stays the same, so it's only done
+ * once for each checkpoint xid.  Returns 0 on success or a negative error code
+ * in case of failure.
+ */
+static int apfs_count_used_blocks(struct super_block *sb, u64 *count)
+{
+	struct apfs_nxsb_info *nxi = APFS_SB(sb)->s_nxi;
+	bool cached = false;
+	int err;
+
+	spin_lock(&nxi->nx_used_lock);
+	if (nxi->nx_used_xid == nxi->nx_xid) {
+		*count = nxi->nx_used_blocks;
+		cached = true;
+	}
+	spin_unlock(&nxi->nx_used_lock);
+	if (cached)
+		return 0;
+
+	err = apfs_read_used_blocks(sb, count);
+	if (err)
+		return err;
+
+	spin_lock(&nxi->nx_used_lock);
+	nxi->nx_used_blocks = *count;
+	nxi->nx_used_xid = nxi->nx_xid;
+	spin_unlock(&nxi->nx_used_lock);
+	return 0;
+}
+
+/**
+ * apfs_spaceman_statfs - Report free space from the space manager counters
+ * @sb:		filesystem superblock
+ * @buf:	statfs buffer with f_blocks already set
+ *
+ * Blocks reserved for other volumes are not available to this one, and the
+ * quota of the volume, if any, is a limit on top of that.
+ */
+static void apfs_spaceman_statfs(struct super_block *sb, struct kstatfs *buf)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_spaceman *sm = &sbi->s_nxi->nx_spaceman;
+	struct apfs_superblock *vol = sbi->s_vsb_raw;
+	u64 reserve = le64_to_cpu(vol->apfs_fs_reserve_block_count);
+	u64 quota = le64_to_cpu(vol->apfs_fs_quota_block_count);
+	u64 alloc = le64_to_cpu(vol->apfs_fs_alloc_count);
+	u64 unused_reserve, own_unused, avail;
+
+	buf->f_bfree = min_t(u64, sm->free_count, buf->f_blocks);
+
+	/* The reserve of this volume is unused until its allocations reach it */
+	unused_reserve = sm->reserve_count - sm->reserve_alloc_count;
+	own_unused = reserve > alloc ? reserve - alloc : 0;
+	own_unused = min(own_unused, unused_reserve);
+
+	avail = buf->f_bfree;
+	avail -= min(avail, unused_reserve - own_unused);
+	if (quota)
+		avail = min(avail, quota > alloc ? quota - alloc : 0);
+	buf->f_bavail = avail;
+}
+
 static int apfs_statfs(struct dentry *dentry, struct kstatfs *buf)
 {
 	struct super_block *sb = dentry->d_sb;
@@ -498,11 +1096,15 @@ static int apfs_statfs(struct dentry *dentry, struct kstatfs *buf)
 
 	/* Volumes share the whole disk space */
 	buf->f_blocks = le64_to_cpu(msb_raw->nx_block_count);
-	err = apfs_count_used_blocks(sb, &used_blocks);
-	if (err)
-		return err;
-	buf->f_bfree = buf->f_blocks - used_blocks;
-	buf->f_bavail = buf->f_bfree; /* I don't know any better */
+	if (sbi->s_nxi->nx_spaceman.valid) {
+		apfs_spaceman_statfs(sb, buf);
+	} else {
+		err = apfs_count_used_blocks(sb, &used_blocks);
+		if (err)
+			return err;
+		buf->f_bfree = buf->f_blocks - used_blocks;
+		buf->f_bavail = buf->f_bfree; /* I don't know any better */
+	}
 
 	/* The file count is only for the mounted volume */
 	buf->f_files = le64_to_cpu(vol->apfs_num_files) +
@@ -532,14 +1134,66 @@ static int apfs_show_options(struct seq_file *seq, struct dentry *root)
 
 	if (sbi->s_vol_nr != 0)
 		seq_printf(seq, ",vol=%u", sbi->s_vol_nr);
+	if (sbi->s_snap_name)
+		seq_show_option(seq, "snap", sbi->s_snap_name);
+	if (sbi->s_ckpt_xid)
+		seq_printf(seq, ",xid=%llu", sbi->s_ckpt_xid);
+	if (sbi->s_tier2_path)
+		seq_show_option(seq, "tier2", sbi->s_tier2_path);
+	if (sbi->s_catidx_path)
+		seq_show_option(seq, "index", sbi->s_catidx_path);
 	if (sbi->s_flags & APFS_UID_OVERRIDE)
 		seq_printf(seq, ",uid=%u", from_kuid(&init_user_ns,
 						     sbi->s_uid));
 	if (sbi->s_flags & APFS_GID_OVERRIDE)
 		seq_printf(seq, ",gid=%u", from_kgid(&init_user_ns,
 						     sbi->s_gid));
-	if (sbi->s_flags & APFS_CHECK_NODES)
-		seq_puts(seq, ",cknodes");
+	if (!(sbi->s_flags & APFS_CHECK_NODES))
+		seq_puts(seq, ",nocknodes");
+	if (sbi->s_omap_cache_size != APFS_OMAP_CACHE_DEFAULT_SIZE)
+		seq_printf(seq, ",omapcache=%u", sbi->s_omap_cache_size);
+	if (sbi->s_rec_cache_size != APFS_REC_CACHE_DEFAULT_SIZE)
+		seq_printf(seq, ",reccache=%u", sbi->s_rec_cache_size);
+	if (sbi->s_name_cache_size != APFS_NAME_CACHE_DEFAULT_SIZE)
+		seq_printf(seq, ",namecache=%u", sbi->s_name_cache_size);
+	if (sbi->s_pin_levels != 1)
+		seq_printf(seq, ",pinlevels=%u", sbi->s_pin_levels);
+	if (sbi->s_queue_depth)
+		seq_printf(seq, ",queuedepth=%u", sbi->s_queue_depth);
+	if (sbi->s_warmup.levels == APFS_WARMUP_CATALOG)
+		seq_puts(seq, ",warmup=catalog");
+	else if (sbi->s_warmup.levels)
+		seq_printf(seq, ",warmup=%u", sbi->s_warmup.levels);
+	if (sbi->s_flags & APFS_PREFETCH_INODES)
+		seq_puts(seq, ",prefetch");
+	if (sbi->s_flags & APFS_DIR_INDEX)
+		seq_puts(seq, ",dirindex");
+	if (sbi->s_flags & APFS_SCRUB_ON_MOUNT)
+		seq_puts(seq, ",scrub");
+	if (sbi->s_flags & APFS_METADATA_RAM)
+		seq_puts(seq, ",metadata=ram");
+	if (sbi->s_flags & APFS_SHARE_CLONES)
+		seq_puts(seq, ",shareclones");
+	if (sbi->s_flags & APFS_FSCACHE)
+		seq_puts(seq, ",fsc");
+	if (sbi->s_flags & APFS_DAX)
+		seq_puts(seq, ",dax");
+	if (sbi->s_flags & APFS_LOOP_DIO)
+		seq_puts(seq, ",loopdio");
+	if (sbi->s_flags & APFS_VGROUP)
+		seq_puts(seq, ",vgroup");
+	if (sbi->s_flags & APFS_SNAPDIR)
+		seq_puts(seq, ",snapdir");
+	if (sbi->s_flags & APFS_HEATMAP)
+		seq_puts(seq, ",heatmap");
+	if (sbi->s_flags & APFS_SHARE_CACHE)
+		seq_puts(seq, ",sharecache");
+	if (sbi->s_flags & APFS_SPEC_IDLE)
+		seq_puts(seq, ",specio=idle");
+	if (sbi->s_flags & APFS_SPEC_CGROUP)
+		seq_puts(seq, ",specio=cgroup");
+	if (sbi->s_meta_limit != APFS_META_LIMIT_DEFAULT)
+		seq_printf(seq, ",metadata_limit=%u", sbi->s_meta_limit);
 
 	return 0;
 }
@@ -547,20 +1201,59 @@ static int apfs_show_options(struct seq_file *seq, struct dentry *root)
 static const struct super_operations apfs_sops = {
 	.alloc_inode	= apfs_alloc_inode,
 	.destroy_inode	= apfs_destroy_inode,
+	.evict_inode	= apfs_evict_inode,
 	.put_super	= apfs_put_super,
 	.statfs		= apfs_statfs,
 	.show_options	= apfs_show_options,
+	.show_stats	= apfs_show_stats,
 };
 
 enum {
-	Opt_cknodes, Opt_uid, Opt_gid, Opt_vol, Opt_err,
+	Opt_cknodes, Opt_nocknodes, Opt_uid, Opt_gid, Opt_vol, Opt_omapcache,
+	Opt_pinlevels, Opt_prefetch, Opt_noprefetch, Opt_dirindex,
+	Opt_nodirindex, Opt_reccache, Opt_warmup_catalog, Opt_warmup, Opt_snap,
+	Opt_tier2, Opt_scrub, Opt_metadata_ram, Opt_metadata_limit,
+	Opt_shareclones, Opt_noshareclones, Opt_fsc, Opt_dax, Opt_loopdio,
+	Opt_vgroup, Opt_snapdir, Opt_index, Opt_xid, Opt_queuedepth,
+	Opt_heatmap, Opt_sharecache, Opt_specio_idle, Opt_specio_cgroup,
+	Opt_namecache, Opt_err,
 };
 
 static const match_table_t tokens = {
 	{Opt_cknodes, "cknodes"},
+	{Opt_nocknodes, "nocknodes"},
 	{Opt_uid, "uid=%u"},
 	{Opt_gid, "gid=%u"},
 	{Opt_vol, "vol=%u"},
+	{Opt_omapcache, "omapcache=%u"},
+	{Opt_pinlevels, "pinlevels=%u"},
+	{Opt_prefetch, "prefetch"},
+	{Opt_noprefetch, "noprefetch"},
+	{Opt_dirindex, "dirindex"},
+	{Opt_nodirindex, "nodirindex"},
+	{Opt_reccache, "reccache=%u"},
+	{Opt_warmup_catalog, "warmup=catalog"},
+	{Opt_warmup, "warmup=%u"},
+	{Opt_snap, "snap=%s"},
+	{Opt_tier2, "tier2=%s"},
+	{Opt_scrub, "scrub"},
+	{Opt_metadata_ram, "metadata=ram"},
+	{Opt_metadata_limit, "metadata_limit=%u"},
+	{Opt_shareclones, "shareclones"},
+	{Opt_noshareclones, "noshareclones"},
+	{Opt_fsc, "fsc"},
+	{Opt_dax, "dax"},
+	{Opt_loopdio, "loopdio"},
+	{Opt_vgroup, "vgroup"},
+	{Opt_snapdir, "snapdir"},
+	{Opt_index, "index=%s"},
+	{Opt_xid, "xid=%s"},
+	{Opt_queuedepth, "queuedepth=%u"},
+	{Opt_heatmap, "heatmap"},
+	{Opt_sharecache, "sharecache"},
+	{Opt_specio_idle, "specio=idle"},
+	{Opt_specio_cgroup, "specio=cgroup"},
+	{Opt_namecache, "namecache=%u"},
 	{Opt_err, NULL}
 };
 
@@ -578,7 +1271,14 @@ static int parse_options(struct super_block *sb, char *options)
 
 	/* Set default values before parsing */
 	sbi->s_vol_nr = 0;
-	sbi->s_flags = 0;
+	sbi->s_flags = APFS_CHECK_NODES;
+	sbi->s_omap_cache_size = APFS_OMAP_CACHE_DEFAULT_SIZE;
+	sbi->s_rec_cache_size = APFS_REC_CACHE_DEFAULT_SIZE;
+	sbi->s_name_cache_size = APFS_NAME_CACHE_DEFAULT_SIZE;
+	sbi->s_pin_levels = 1;
+	sbi->s_queue_depth = 0;
+	sbi->s_meta_limit = APFS_META_LIMIT_DEFAULT;
+	sbi->s_warmup.levels = 0;
 
 	if (!options)
 		return 0;
@@ -591,12 +1291,11 @@ static int parse_options(struct super_block *sb, char *options)
 		token = match_token(p, tokens, args);
 		switch (token) {
 		case Opt_cknodes:
-			/*
-			 * Right now, node checksums are too costly to enable
-			 * by default.  TODO: try to improve this.
-			 */
 			sbi->s_flags |= APFS_CHECK_NODES;
 			break;
+		case Opt_nocknodes:
+			sbi->s_flags &= ~APFS_CHECK_NODES;
+			break;
 		case Opt_uid:
 			err = match_int(&args[0], &option);
 			if (err)
@@ -624,6 +1323,148 @@ static int parse_options(struct super_block *sb, char *options)
 			if (err)
 				return err;
 			break;
+		case Opt_omapcache:
+			err = match_int(&args[0], &sbi->s_omap_cache_size);
+			if (err)
+				return err;
+			if (sbi->s_omap_cache_size > APFS_OMAP_CACHE_MAX_SIZE) {
+				apfs_err(sb, "omap cache size is too big");
+				return -EINVAL;
+			}
+			break;
+		case Opt_reccache:
+			err = match_int(&args[0], &sbi->s_rec_cache_size);
+			if (err)
+				return err;
+			if (sbi->s_rec_cache_size > APFS_REC_CACHE_MAX_SIZE) {
+				apfs_err(sb, "record cache size is too big");
+				return -EINVAL;
+			}
+			break;
+		case Opt_namecache:
+			err = match_int(&args[0], &sbi->s_name_cache_size);
+			if (err)
+				return err;
+			if (sbi->s_name_cache_size > APFS_NAME_CACHE_MAX_SIZE) {
+				apfs_err(sb, "name cache size is too big");
+				return -EINVAL;
+			}
+			break;
+		case Opt_pinlevels:
+			err = match_int(&args[0], &sbi->s_pin_levels);
+			if (err)
+				return err;
+			if (sbi->s_pin_levels < 1 ||
+			    sbi->s_pin_levels > APFS_BTREE_MAX_PIN_LEVELS) {
+				apfs_err(sb, "pinlevels must be between 1 and %d",
+					 APFS_BTREE_MAX_PIN_LEVELS);
+				return -EINVAL;
+			}
+			break;
+		case Opt_queuedepth:
+			err = match_int(&args[0], &sbi->s_queue_depth);
+			if (err)
+				return err;
+			if (sbi->s_queue_depth < 1 ||
+			    sbi->s_queue_depth > APFS_BTREE_QUEUE_MAX) {
+				apfs_err(sb, "queuedepth must be 1 to %d",
+					 APFS_BTREE_QUEUE_MAX);
+				return -EINVAL;
+			}
+			break;
+		case Opt_snap:
+		case Opt_xid:
+			/* Already parsed by apfs_mount() */
+			break;
+		case Opt_tier2:
+			kfree(sbi->s_tier2_path);
+			sbi->s_tier2_path = match_strdup(&args[0]);
+			if (!sbi->s_tier2_path)
+				return -ENOMEM;
+			break;
+		case Opt_index:
+			kfree(sbi->s_catidx_path);
+			sbi->s_catidx_path = match_strdup(&args[0]);
+			if (!sbi->s_catidx_path)
+				return -ENOMEM;
+			break;
+		case Opt_warmup_catalog:
+			sbi->s_warmup.levels = APFS_WARMUP_CATALOG;
+			break;
+		case Opt_warmup:
+			err = match_int(&args[0], &sbi->s_warmup.levels);
+			if (err)
+				return err;
+			if (sbi->s_warmup.levels > APFS_BTREE_MAX_DEPTH) {
+				apfs_err(sb, "warmup must be at most %d levels",
+					 APFS_BTREE_MAX_DEPTH);
+				return -EINVAL;
+			}
+			break;
+		case Opt_scrub:
+			sbi->s_flags |= APFS_SCRUB_ON_MOUNT;
+			break;
+		case Opt_metadata_ram:
+			sbi->s_flags |= APFS_METADATA_RAM;
+			break;
+		case Opt_metadata_limit:
+			err = match_int(&args[0], &sbi->s_meta_limit);
+			if (err)
+				return err;
+			if (!sbi->s_meta_limit) {
+				apfs_err(sb, "metadata_limit must be positive");
+				return -EINVAL;
+			}
+			break;
+		case Opt_prefetch:
+			sbi->s_flags |= APFS_PREFETCH_INODES;
+			break;
+		case Opt_noprefetch:
+			sbi->s_flags &= ~APFS_PREFETCH_INODES;
+			break;
+		case Opt_dirindex:
+			sbi->s_flags |= APFS_DIR_INDEX;
+			break;
+		case Opt_nodirindex:
+			sbi->s_flags &= ~APFS_DIR_INDEX;
+			break;
+		case Opt_shareclones:
+			sbi->s_flags |= APFS_SHARE_CLONES;
+			break;
+		case Opt_noshareclones:
+			sbi->s_flags &= ~APFS_SHARE_CLONES;
+			break;
+		case Opt_fsc:
+			if (!IS_ENABLED(CONFIG_APFS_FSCACHE)) {
+				apfs_err(sb, "fsc needs CONFIG_APFS_FSCACHE");
+				return -EINVAL;
+			}
+			sbi->s_flags |= APFS_FSCACHE;
+			break;
+		case Opt_dax:
+			sbi->s_flags |= APFS_DAX;
+			break;
+		case Opt_loopdio:
+			sbi->s_flags |= APFS_LOOP_DIO;
+			break;
+		case Opt_vgroup:
+			sbi->s_flags |= APFS_VGROUP;
+			break;
+		case Opt_snapdir:
+			sbi->s_flags |= APFS_SNAPDIR;
+			break;
+		case Opt_heatmap:
+			sbi->s_flags |= APFS_HEATMAP;
+			break;
+		case Opt_sharecache:
+			sbi->s_flags |= APFS_SHARE_CACHE;
+			break;
+		case Opt_specio_idle:
+			sbi->s_flags |= APFS_SPEC_IDLE;
+			break;
+		case Opt_specio_cgroup:
+			sbi->s_flags |= APFS_SPEC_CGROUP;
+			break;
 		default:
 			return -EINVAL;
 		}
@@ -631,51 +1472,156 @@ static int parse_options(struct super_block *sb, char *options)
 	return 0;
 }
 
+/**
+ * apfs_loop_set_dio - Switch a loop device to direct I/O for the loopdio option
+ * @sb:		filesystem superblock
+ *
+ * An image mounted through a buffered loop device has every block cached
+ * twice: in the page cache of the device, and in that of the backing file.
+ * With direct I/O the loop driver bypasses the latter, so the device cache is
+ * the only one left.  The device keeps this mode after the unmount, until it
+ * is detached.  Failure is not fatal, the mount goes on with both caches.
+ */
+static void apfs_loop_set_dio(struct super_block *sb)
+{
+	struct block_device *bdev = sb->s_bdev;
+	int err;
+
+	if (!(APFS_SB(sb)->s_flags & APFS_LOOP_DIO))
+		return;
+	if (bdev->bd_disk->major != LOOP_MAJOR) {
+		apfs_warn(sb, "not a loop device, loopdio has no effect");
+		return;
+	}
+	err = ioctl_by_bdev(bdev, LOOP_SET_DIRECT_IO, 1);
+	if (err)
+		apfs_warn(sb, "direct I/O not supported by the backing file (%d)",
+			  err);
+}
+
 static int apfs_fill_super(struct super_block *sb, void *data, int silent)
 {
 	struct apfs_sb_info *sbi;
 	struct inode *root;
+	u64 start;
 	int err;
 
 	apfs_notice(sb, "this module is read-only");
 	sb->s_flags |= SB_RDONLY;
 
-	sbi = kzalloc(sizeof(*sbi), GFP_KERNEL);
-	if (!sbi)
-		return -ENOMEM;
-	sb->s_fs_info = sbi;
+	/* Allocated by apfs_mount(), since sget() needs the volume number */
+	sbi = APFS_SB(sb);
 
+	err = apfs_stats_init(sb);
+	if (err)
+		goto failed_main_super;
+
+	/* The container may need the tier2 option to be mapped */
+	err = parse_options(sb, data);
+	if (err)
+		goto failed_main_super;
+
+	apfs_spec_init(sb);
+
+	/* Before any block gets into the page cache of the backing file */
+	apfs_loop_set_dio(sb);
+
+	start = ktime_get_ns();
 	err = apfs_map_main_super(sb);
+	trace_apfs_mount_phase(sb, APFS_MOUNT_CHECKPOINT, start, err);
 	if (err)
 		goto failed_main_super;
 
-	/* For now we only support blocksize < PAGE_SIZE */
+	err = apfs_heatmap_init(sb);
+	if (err)
+		goto failed_meta_cache;
+
+	/* Blocks bigger than a page were rejected with the container super */
 	sbi->s_blocksize = sb->s_blocksize;
 	sbi->s_blocksize_bits = sb->s_blocksize_bits;
 
-	err = parse_options(sb, data);
+	err = apfs_meta_cache_get(sb);
+	if (err)
+		goto failed_meta_cache;
+	apfs_btree_ra_init(sb);
+
+	err = apfs_node_cache_init(sb);
+	if (err)
+		goto failed_meta_cache;
+
+	err = apfs_extent_maps_init(sb);
 	if (err)
-		goto failed_volume_super;
+		goto failed_node_cache;
+	apfs_chunk_cache_init(sb);
 
+	err = apfs_dir_indexes_init(sb);
+	if (err)
+		goto failed_extent_maps;
+
+	err = apfs_name_cache_init(sb);
+	if (err)
+		goto failed_dir_indexes;
+
+	start = ktime_get_ns();
 	err = apfs_map_volume_super(sb);
+	trace_apfs_mount_phase(sb, APFS_MOUNT_VOLUME, start, err);
+	if (err)
+		goto failed_dir_indexes;
+	/* Overlap the read of the omap with the setup of the keys and dax */
+	apfs_meta_readahead(sb, le64_to_cpu(sbi->s_vsb_raw->apfs_omap_oid));
+
+	err = apfs_crypt_init(sb);
+	if (err)
+		goto failed_crypt;
+
+	err = apfs_dax_init(sb);
 	if (err)
-		goto failed_volume_super;
+		goto failed_dax;
 
 	/* The omap needs to be set before the call to apfs_read_catalog() */
+	start = ktime_get_ns();
 	err = apfs_read_omap(sb);
+	trace_apfs_mount_phase(sb, APFS_MOUNT_OMAP, start, err);
 	if (err)
 		goto failed_omap;
 
-	err = apfs_read_catalog(sb);
+	start = ktime_get_ns();
+	err = apfs_map_snapshot(sb);
+	if (!err)
+		err = apfs_read_catalog(sb);
+	trace_apfs_mount_phase(sb, APFS_MOUNT_CATALOG, start, err);
 	if (err)
 		goto failed_cat;
+	apfs_catidx_load(sb);
+
+	if (sbi->s_flags & APFS_METADATA_RAM) {
+		err = apfs_warmup_load(sb);
+		if (err)
+			goto failed_load;
+	} else {
+		apfs_pin_trees(sb);
+	}
+
+	err = apfs_fscache_get_super(sb);
+	if (err)
+		goto failed_fscache;
+
+	apfs_scrub_init(sb);
+	err = apfs_sysfs_register(sb);
+	if (err)
+		goto failed_sysfs;
+	apfs_debugfs_register(sb);
 
 	sb->s_op = &apfs_sops;
 	sb->s_d_op = &apfs_dentry_operations;
+	sb->s_export_op = &apfs_export_ops;
 	sb->s_xattr = apfs_xattr_handlers;
 	sb->s_maxbytes = MAX_LFS_FILESIZE;
 
+	start = ktime_get_ns();
 	root = apfs_iget(sb, APFS_ROOT_DIR_INO_NUM);
+	trace_apfs_mount_phase(sb, APFS_MOUNT_ROOT, start,
+			       PTR_ERR_OR_ZERO(root));
 	if (IS_ERR(root)) {
 		apfs_err(sb, "unable to get root inode");
 		err = PTR_ERR(root);
@@ -687,33 +1633,318 @@ static int apfs_fill_super(struct super_block *sb, void *data, int silent)
 		err = -ENOMEM;
 		goto failed_mount;
 	}
+
+	apfs_warmup_start(sb);
+	if (sbi->s_flags & APFS_SCRUB_ON_MOUNT) {
+		err = apfs_scrub_start(&sbi->s_scrub);
+		if (err)
+			apfs_warn(sb, "unable to start the scrub (%d)", err);
+	}
 	return 0;
 
 failed_mount:
+	apfs_debugfs_unregister(sb);
+	apfs_sysfs_unregister(sb);
+failed_sysfs:
+	apfs_fscache_put_super(sb);
+failed_fscache:
+failed_load:
+	apfs_catidx_destroy(sb);
 	apfs_node_put(sbi->s_cat_root);
 failed_cat:
 	apfs_node_put(sbi->s_omap_root);
 failed_omap:
+	apfs_dax_destroy(sb);
+failed_dax:
+	apfs_crypt_destroy(sb);
+failed_crypt:
 	apfs_unmap_volume_super(sb);
-failed_volume_super:
+failed_dir_indexes:
+	apfs_name_cache_destroy(sb);
+	apfs_dir_indexes_destroy(sb);
+failed_extent_maps:
+	apfs_chunk_cache_destroy(sb);
+	apfs_extent_maps_destroy(sb);
+failed_node_cache:
+	apfs_node_cache_destroy(sb);
+failed_meta_cache:
+	apfs_meta_cache_put(sb);
 	apfs_unmap_main_super(sb);
 failed_main_super:
+	/* The checks of the blocks read ahead so far still need the sbi */
+	apfs_meta_verify_flush(sb);
 	sb->s_fs_info = NULL;
-	kfree(sbi);
+	apfs_free_sb_info(sbi);
 	return err;
 }
 
+/**
+ * apfs_parse_sb_key - Find the volume and snapshot in the mount options
+ * @options:	mount options string, left untouched
+ * @sbi:	sb info to set the s_vol_nr, s_snap_name and s_ckpt_xid fields of
+ *
+ * These options are needed to look for an existing superblock, before
+ * apfs_fill_super() goes through all the others.  Returns 0 on success, or a
+ * negative error code in case of failure.
+ */
+static int apfs_parse_sb_key(const char *options, struct apfs_sb_info *sbi)
+{
+	char *opts, *orig, *p;
+	substring_t args[MAX_OPT_ARGS];
+	int option;
+	int err = 0;
+
+	sbi->s_vol_nr = 0;
+	if (!options)
+		return 0;
+	orig = opts = kstrdup(options, GFP_KERNEL);
+	if (!opts)
+		return -ENOMEM;
+
+	while ((p = strsep(&opts, ",")) != NULL) {
+		if (!*p)
+			continue;
+		switch (match_token(p, tokens, args)) {
+		case Opt_vol:
+			err = match_int(&args[0], &option);
+			if (err)
+				goto out;
+			sbi->s_vol_nr = option;
+			break;
+		case Opt_snap:
+			kfree(sbi->s_snap_name);
+			sbi->s_snap_name = match_strdup(&args[0]);
+			if (!sbi->s_snap_name) {
+				err = -ENOMEM;
+				goto out;
+			}
+			break;
+		case Opt_xid:
+			err = match_u64(&args[0], &sbi->s_ckpt_xid);
+			if (err)
+				goto out;
+			break;
+		}
+	}
+out:
+	kfree(orig);
+	return err;
+}
+
+/**
+ * apfs_mount_sibling - Mount another volume or snapshot of the container
+ * @sb:		superblock of a mounted volume
+ * @vol_nr:	index of the volume to mount
+ * @snap_xid:	xid of the snapshot to mount, or 0 for the live volume
+ *
+ * The new mount is internal, read-only, and gets the same checkpoint and
+ * ownership options as @sb.  Returns the mount on success, or an ERR_PTR in
+ * case of failure.
+ */
+struct vfsmount *apfs_mount_sibling(struct super_block *sb,
+				    unsigned int vol_nr, u64 snap_xid)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	char opts[128];
+	int len;
+
+	len = snprintf(opts, sizeof(opts), "vol=%u", vol_nr);
+	/* The xid is accepted as a name, and it needs no escapes */
+	if (snap_xid)
+		len += snprintf(opts + len, sizeof(opts) - len, ",snap=%llu",
+				snap_xid);
+	if (sbi->s_ckpt_xid)
+		len += snprintf(opts + len, sizeof(opts) - len, ",xid=%llu",
+				sbi->s_ckpt_xid);
+	if (sbi->s_flags & APFS_UID_OVERRIDE)
+		len += snprintf(opts + len, sizeof(opts) - len, ",uid=%u",
+				from_kuid(&init_user_ns, sbi->s_uid));
+	if (sbi->s_flags & APFS_GID_OVERRIDE)
+		len += snprintf(opts + len, sizeof(opts) - len, ",gid=%u",
+				from_kgid(&init_user_ns, sbi->s_gid));
+
+	return vfs_kern_mount(sb->s_type, SB_RDONLY, sbi->s_dev_name, opts);
+}
+
+/**
+ * apfs_open_data_volume - Mount the data volume for the vgroup option
+ * @sb:		superblock of the system volume, just filled
+ *
+ * The data volume is mounted internally with the same ownership options, and
+ * shares the container with @sb.  Returns 0 on success, or a negative error
+ * code in case of failure.
+ */
+static int apfs_open_data_volume(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct vfsmount *mnt;
+	unsigned int vol_nr;
+	int err;
+
+	if (!(sbi->s_flags & APFS_VGROUP))
+		return 0;
+	/* The firmlinks would lead into the live data volume */
+	if (sbi->s_snap_name) {
+		apfs_err(sb, "vgroup is not supported for snapshots");
+		return -EINVAL;
+	}
+	err = apfs_find_data_volume(sb, &vol_nr);
+	if (err == -ENOENT) {
+		apfs_err(sb, "vgroup needs the system volume of a group");
+		return -EINVAL;
+	}
+	if (err)
+		return err;
+
+	mnt = apfs_mount_sibling(sb, vol_nr, 0 /* snap_xid */);
+	if (IS_ERR(mnt)) {
+		apfs_err(sb, "unable to mount data volume %u", vol_nr);
+		return PTR_ERR(mnt);
+	}
+	sbi->s_vgroup_mnt = mnt;
+	return 0;
+}
+
+/*
+ * Key used by sget() to find the superblock of a mounted volume
+ */
+struct apfs_sb_key {
+	struct block_device *bdev;	/* Device of the container */
+	struct apfs_sb_info *sbi;	/* New sb info, with the volume number */
+};
+
+static int apfs_test_super(struct super_block *sb, void *data)
+{
+	struct apfs_sb_key *key = data;
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+
+	/* The sb info is gone if the superblock failed to mount */
+	if (!sbi || sb->s_bdev != key->bdev)
+		return 0;
+	if (sbi->s_vol_nr != key->sbi->s_vol_nr ||
+	    sbi->s_ckpt_xid != key->sbi->s_ckpt_xid)
+		return 0;
+
+	/* Snapshots get their own superblocks, like separate volumes */
+	if (!sbi->s_snap_name || !key->sbi->s_snap_name)
+		return sbi->s_snap_name == key->sbi->s_snap_name;
+	return strcmp(sbi->s_snap_name, key->sbi->s_snap_name) == 0;
+}
+
+static int apfs_set_super(struct super_block *sb, void *data)
+{
+	struct apfs_sb_key *key = data;
+
+	sb->s_bdev = key->bdev;
+	sb->s_dev = key->bdev->bd_dev;
+	sb->s_bdi = bdi_get(key->bdev->bd_bdi);
+	sb->s_fs_info = key->sbi;
+	return 0;
+}
+
+/*
+ * Like mount_bdev(), but with a separate superblock for each volume of the
+ * container, so that they can all be mounted at the same time.
+ */
 static struct dentry *apfs_mount(struct file_system_type *fs_type,
 		int flags, const char *dev_name, void *data)
 {
-	return mount_bdev(fs_type, flags, dev_name, data, apfs_fill_super);
+	struct block_device *bdev;
+	struct super_block *sb;
+	struct apfs_sb_key key;
+	fmode_t mode = FMODE_READ | FMODE_EXCL;
+	int err;
+
+	if (!(flags & SB_RDONLY))
+		mode |= FMODE_WRITE;
+
+	key.sbi = kzalloc(sizeof(*key.sbi), GFP_KERNEL);
+	if (!key.sbi)
+		return ERR_PTR(-ENOMEM);
+	apfs_msg_init(key.sbi);
+	err = apfs_parse_sb_key(data, key.sbi);
+	if (err)
+		goto fail_sbi;
+
+	bdev = blkdev_get_by_path(dev_name, mode, fs_type);
+	if (IS_ERR(bdev)) {
+		err = PTR_ERR(bdev);
+		goto fail_sbi;
+	}
+	key.bdev = bdev;
+
+	mutex_lock(&bdev->bd_fsfreeze_mutex);
+	if (bdev->bd_fsfreeze_count > 0) {
+		mutex_unlock(&bdev->bd_fsfreeze_mutex);
+		err = -EBUSY;
+		goto fail_bdev;
+	}
+	sb = sget(fs_type, apfs_test_super, apfs_set_super, flags | SB_NOSEC,
+		  &key);
+	mutex_unlock(&bdev->bd_fsfreeze_mutex);
+	if (IS_ERR(sb)) {
+		err = PTR_ERR(sb);
+		goto fail_bdev;
+	}
+
+	if (sb->s_root) {
+		/* This volume was already mounted */
+		apfs_free_sb_info(key.sbi);
+		if ((flags ^ sb->s_flags) & SB_RDONLY) {
+			deactivate_locked_super(sb);
+			blkdev_put(bdev, mode);
+			return ERR_PTR(-EBUSY);
+		}
+		up_write(&sb->s_umount);
+		blkdev_put(bdev, mode);
+		down_write(&sb->s_umount);
+	} else {
+		sb->s_mode = mode;
+		snprintf(sb->s_id, sizeof(sb->s_id), "%pg", bdev);
+		sb_set_blocksize(sb, block_size(bdev));
+		err = apfs_fill_super(sb, data, flags & SB_SILENT ? 1 : 0);
+		if (err) {
+			/* The sb info was freed already */
+			deactivate_locked_super(sb);
+			return ERR_PTR(err);
+		}
+		sb->s_flags |= SB_ACTIVE;
+		bdev->bd_super = sb;
+
+		/* Other volumes may get mounted from here, on the same device */
+		APFS_SB(sb)->s_dev_name = kstrdup(dev_name, GFP_KERNEL);
+		err = APFS_SB(sb)->s_dev_name ? 0 : -ENOMEM;
+		if (!err)
+			err = apfs_open_data_volume(sb);
+		if (err) {
+			deactivate_locked_super(sb);
+			return ERR_PTR(err);
+		}
+	}
+	return dget(sb->s_root);
+
+fail_bdev:
+	blkdev_put(bdev, mode);
+fail_sbi:
+	apfs_free_sb_info(key.sbi);
+	return ERR_PTR(err);
+}
+
+/*
+ * The readahead workers of compressed files hold references to inodes, and
+ * evict_inodes() would skip those, so wait for them before the shutdown.
+ */
+static void apfs_kill_sb(struct super_block *sb)
+{
+	apfs_compress_flush();
+	kill_block_super(sb);
 }
 
 static struct file_system_type apfs_fs_type = {
 	.owner		= THIS_MODULE,
 	.name		= "apfs",
 	.mount		= apfs_mount,
-	.kill_sb	= kill_block_super,
+	.kill_sb	= apfs_kill_sb,
 	.fs_flags	= FS_REQUIRES_DEV,
 };
 MODULE_ALIAS_FS("apfs");
@@ -725,15 +1956,66 @@ static int __init init_apfs_fs(void)
 	err = init_inodecache();
 	if (err)
 		return err;
+	err = apfs_sysfs_init();
+	if (err)
+		goto failed_sysfs;
+	err = apfs_warmup_init();
+	if (err)
+		goto failed_warmup;
+	err = apfs_workspace_init();
+	if (err)
+		goto failed_workspace;
+	err = apfs_object_init();
+	if (err)
+		goto failed_object;
+	err = apfs_node_init();
+	if (err)
+		goto failed_node;
+	err = apfs_dir_init();
+	if (err)
+		goto failed_dir;
+	err = apfs_fscache_register();
+	if (err)
+		goto failed_fscache;
+	apfs_debugfs_init();
 	err = register_filesystem(&apfs_fs_type);
 	if (err)
-		destroy_inodecache();
+		goto failed_register;
+	apfs_bench_run();
+	return 0;
+
+failed_register:
+	apfs_debugfs_exit();
+	apfs_fscache_unregister();
+failed_fscache:
+	apfs_dir_exit();
+failed_dir:
+	apfs_node_exit();
+failed_node:
+	apfs_object_exit();
+failed_object:
+	apfs_workspace_exit();
+failed_workspace:
+	apfs_warmup_exit();
+failed_warmup:
+	apfs_sysfs_exit();
+failed_sysfs:
+	destroy_inodecache();
 	return err;
 }
 
 static void __exit exit_apfs_fs(void)
 {
 	unregister_filesystem(&apfs_fs_type);
+	apfs_snapdir_exit();
+	apfs_debugfs_exit();
+	apfs_fscache_unregister();
+	apfs_dir_exit();
+	apfs_node_exit();
+	apfs_object_exit();
+	apfs_workspace_exit();
+	apfs_warmup_exit();
+	apfs_sysfs_exit();
 	destroy_inodecache();
 }
 
@@ -8,9 +8,35 @@
 #ifndef _APFS_SUPER_H
 #define _APFS_SUPER_H
 
+#include <linux/completion.h>
 #include <linux/fs.h>
+#include <linux/kobject.h>
+#include <linux/list.h>
+#include <linux/ratelimit.h>
+#include <linux/spinlock.h>
 #include <linux/types.h>
+#include "btree.h"
+#include "cachelimit.h"
+#include "catidx.h"
+#include "compress.h"
+#include "dirindex.h"
+#include "extents.h"
+#include "freeidx.h"
+#include "namecache.h"
+#include "node.h"
 #include "object.h"
+#include "scrub.h"
+#include "spaceman.h"
+#include "warmup.h"
+
+struct apfs_heatmap;
+struct apfs_latency;
+struct apfs_stats;
+struct cgroup_subsys_state;
+struct crypto_skcipher;
+struct dax_device;
+struct fscache_cookie;
+struct vfsmount;
 
 /*
  * Structure used to store a range of physical blocks
@@ -33,6 +59,9 @@ struct apfs_prange {
 #define APFS_NX_TX_MIN_CHECKPOINT_COUNT		4
 #define APFS_NX_EPH_INFO_VERSION_1		1
 
+/* Checkpoint descriptor blocks to read ahead at once during mount */
+#define APFS_NX_DESC_RA_BLOCKS			64
+
 /* Container flags */
 #define APFS_NX_RESERVED_1			0x00000001LL
 #define APFS_NX_RESERVED_2			0x00000002LL
@@ -129,6 +158,10 @@ struct apfs_nx_superblock {
 #define APFS_MAX_HIST				8
 #define APFS_VOLNAME_LEN			256
 
+/* Volume roles */
+#define APFS_VOL_ROLE_SYSTEM			0x0001
+#define APFS_VOL_ROLE_DATA			0x0040
+
 /* Volume flags */
 #define APFS_FS_UNENCRYPTED			0x00000001LL
 #define APFS_FS_EFFACEABLE			0x00000002LL
@@ -164,6 +197,8 @@ struct apfs_nx_superblock {
 #define APFS_INCOMPAT_DATALESS_SNAPS		0x00000002LL
 #define APFS_INCOMPAT_ENC_ROLLED		0x00000004LL
 #define APFS_INCOMPAT_NORMALIZATION_INSENSITIVE	0x00000008LL
+#define APFS_INCOMPAT_INCOMPLETE_RESTORE	0x00000010LL
+#define APFS_INCOMPAT_SEALED_VOLUME		0x00000020LL
 
 #define APFS_SUPPORTED_INCOMPAT_MASK  (APFS_INCOMPAT_CASE_INSENSITIVE \
 				      | APFS_INCOMPAT_DATALESS_SNAPS \
@@ -254,31 +289,135 @@ struct apfs_superblock {
 
 /*3C8*/	__le64 apfs_root_to_xid;
 	__le64 apfs_er_state_oid;
+
+	/* Only set by newer implementations, zero otherwise */
+/*3D8*/	__le64 apfs_cloneinfo_id_epoch;
+	__le64 apfs_cloneinfo_xid;
+/*3E8*/	__le64 apfs_snap_meta_ext_oid;
+/*3F0*/	char apfs_volume_group_id[16];
+/*400*/	__le64 apfs_integrity_meta_oid;
+	__le64 apfs_fext_tree_oid;
+/*410*/	__le32 apfs_fext_tree_type;
+	__le32 reserved_type;
+	__le64 reserved_oid;
 } __packed;
 
 /* Mount option flags */
 #define APFS_UID_OVERRIDE	1
 #define APFS_GID_OVERRIDE	2
 #define APFS_CHECK_NODES	4
+#define APFS_PREFETCH_INODES	8
+#define APFS_DIR_INDEX		16
+#define APFS_SCRUB_ON_MOUNT	32
+#define APFS_METADATA_RAM	64
+#define APFS_SHARE_CLONES	128
+#define APFS_FSCACHE		256
+#define APFS_DAX		512
+#define APFS_LOOP_DIO		1024
+#define APFS_VGROUP		2048
+#define APFS_SNAPDIR		4096
+#define APFS_HEATMAP		8192
+#define APFS_SHARE_CACHE	16384
+#define APFS_SPEC_IDLE		32768
+#define APFS_SPEC_CGROUP	65536
+
+/* Phases of apfs_fill_super(), for the apfs_mount_phase tracepoint */
+enum apfs_mount_phase {
+	APFS_MOUNT_CHECKPOINT,	/* Scan of the checkpoint descriptors */
+	APFS_MOUNT_VOLUME,	/* Volume superblock */
+	APFS_MOUNT_OMAP,	/* Root of the object map */
+	APFS_MOUNT_CATALOG,	/* Snapshot and root of the catalog */
+	APFS_MOUNT_ROOT,	/* Inode of the root directory */
+};
 
 /*
  * Superblock data in memory, both from the main superblock and the volume
  * checkpoint superblock.
  */
+/*
+ * Container data in memory, shared by all the mounted volumes of a device
+ */
+struct apfs_nxsb_info {
+	struct block_device *nx_bdev;	/* Device of the container */
+	struct list_head nx_list;	/* Entry in the list of containers */
+	unsigned int nx_refcnt;		/* Number of mounted volumes */
+	u64 nx_ckpt_xid;		/* Checkpoint asked for, or 0 */
+
+	struct apfs_nx_superblock *nx_raw; /* On-disk main sb */
+	struct buffer_head *nx_bh;	/* Buffer head for @nx_raw */
+	u64 nx_xid;			/* Transaction id of the checkpoint */
+	unsigned long nx_blocksize;
+	struct apfs_ckpt_map *nx_ckpt_map; /* Ephemeral objects, or NULL */
+	struct apfs_spaceman nx_spaceman; /* Space manager counters */
+	struct apfs_free_index nx_free_index; /* Free extents of the device */
+
+	/* Fusion containers only */
+	struct block_device *nx_tier2_bdev; /* Slow device, or NULL */
+	u64 nx_fusion_mt;		/* Root of the middle tree, or 0 */
+
+	spinlock_t nx_used_lock;	/* Protects the used block count */
+	u64 nx_used_blocks;		/* Blocks in use in the container */
+	u64 nx_used_xid;		/* Checkpoint of the count, or 0 */
+};
+
 struct apfs_sb_info {
-	struct apfs_nx_superblock *s_msb_raw;		/* On-disk main sb */
+	struct apfs_nxsb_info *s_nxi;			/* Shared container */
+	struct apfs_nx_superblock *s_msb_raw;		/* Same as nxi->nx_raw */
 	struct apfs_superblock *s_vsb_raw;		/* On-disk volume sb */
+	bool s_case_fold;		/* Is the volume case insensitive? */
 
-	u64 s_xid;			/* Latest transaction id */
+	u64 s_xid;			/* Same as nxi->nx_xid, or snapshot's */
+	u64 s_snap_xid;			/* Xid of the snapshot, or 0 if live */
 	struct apfs_node *s_cat_root;	/* Root of the catalog tree */
 	struct apfs_node *s_omap_root;	/* Root of the object map tree */
+	struct apfs_node_cache s_node_cache; /* Cache of parsed nodes */
+	struct apfs_meta_cache *s_meta_cache; /* Omap and record caches */
+	struct apfs_btree_ra s_btree_ra; /* Feedback for the readahead */
+	struct apfs_catidx s_catidx;	/* External catalog index, if any */
+	struct apfs_extent_maps s_extent_maps; /* Inodes with extent maps */
+	struct apfs_cache_limits s_cache_limits; /* Budgets of the caches */
+	struct apfs_chunk_cache s_chunk_cache; /* Decompressed chunks */
+	struct apfs_dir_indexes s_dir_indexes; /* Dirs with name indexes */
+	struct apfs_name_cache s_name_cache; /* Parents and names of inodes */
+	struct apfs_warmup s_warmup;	/* Background metadata reads */
+	struct apfs_scrub s_scrub;	/* Background checksum verification */
+	struct apfs_stats __percpu *s_stats; /* Performance counters */
+	struct apfs_heatmap *s_heatmap;	/* Reads by region, or NULL */
+	struct cgroup_subsys_state *s_spec_css; /* Charged for speculative io */
+	struct ratelimit_state s_msg_ratelimit; /* For the error messages */
+	atomic64_t s_msg_suppressed;	/* Error messages dropped in total */
+	atomic_t s_msg_missed;		/* Error messages dropped, unreported */
+	atomic_t s_verify_pending;	/* Reads ahead with a check to come */
+#ifdef CONFIG_APFS_DEBUG
+	struct apfs_latency __percpu *s_latency; /* Latency histograms */
+#endif
 
-	struct apfs_object s_mobject;	/* Main superblock object */
 	struct apfs_object s_vobject;	/* Volume superblock object */
+	struct crypto_skcipher *s_tfm;	/* Cipher of an encrypted volume */
+	struct dax_device *s_daxdev;	/* Device for the dax option, or NULL */
+	struct vfsmount *s_vgroup_mnt;	/* Data volume of the group, or NULL */
+#ifdef CONFIG_APFS_FSCACHE
+	struct fscache_cookie *s_fscache; /* Index for the mount, or NULL */
+#endif
+
+	struct kobject s_kobj;		/* Directory in /sys/fs/apfs */
+	struct completion s_kobj_unregister;
+	struct dentry *s_debugfs;	/* Directory in debugfs, or NULL */
 
 	/* Mount options */
 	unsigned int s_flags;
 	unsigned int s_vol_nr;		/* Index of the volume in the sb list */
+	char *s_snap_name;		/* Snapshot to mount, or NULL */
+	u64 s_ckpt_xid;			/* Checkpoint to mount, or 0 if latest */
+	char *s_dev_name;		/* Device name given for the mount */
+	char *s_tier2_path;		/* Slow device of a Fusion container */
+	char *s_catidx_path;		/* External catalog index, or NULL */
+	unsigned int s_omap_cache_size;	/* Entries in the omap cache */
+	unsigned int s_rec_cache_size;	/* Entries in the record cache */
+	unsigned int s_name_cache_size;	/* Entries in the name cache */
+	unsigned int s_pin_levels;	/* Tree levels kept in memory */
+	unsigned int s_queue_depth;	/* Most node reads ahead, or 0 */
+	unsigned int s_meta_limit;	/* MiB allowed for metadata=ram */
 	kuid_t s_uid;			/* uid to override on-disk uid */
 	kgid_t s_gid;			/* gid to override on-disk gid */
 
@@ -294,8 +433,23 @@ static inline struct apfs_sb_info *APFS_SB(struct super_block *sb)
 
 static inline bool apfs_is_case_insensitive(struct super_block *sb)
 {
-	return (APFS_SB(sb)->s_vsb_raw->apfs_incompatible_features &
-	       cpu_to_le64(APFS_INCOMPAT_CASE_INSENSITIVE)) != 0;
+	return APFS_SB(sb)->s_case_fold;
 }
 
+/**
+ * apfs_set_case_fold - Cache the case sensitivity of a volume
+ * @sbi: in-memory superblock info, with the volume superblock already read
+ *
+ * The feature bit is resolved once at mount, so that the filename code needs
+ * no byte swapping or pointer chasing to learn its mode.
+ */
+static inline void apfs_set_case_fold(struct apfs_sb_info *sbi)
+{
+	sbi->s_case_fold = (sbi->s_vsb_raw->apfs_incompatible_features &
+			    cpu_to_le64(APFS_INCOMPAT_CASE_INSENSITIVE)) != 0;
+}
+
+extern struct vfsmount *apfs_mount_sibling(struct super_block *sb,
+					   unsigned int vol_nr, u64 snap_xid);
+
 #endif	/* _APFS_SUPER_H */
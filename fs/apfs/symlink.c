@@ -17,8 +17,10 @@
  * @inode:	inode for the link
  * @done:	delayed call to free the returned buffer after use
  *
- * Returns a pointer to a buffer containing the target path, or an appropriate
- * error pointer in case of failure.
+ * The target is kept in @inode->i_link, so this only gets called once for
+ * each inode; later follows, and rcu-walk, are served by the vfs.  Returns a
+ * pointer to a buffer containing the target path, or an appropriate error
+ * pointer in case of failure.
  */
 static const char *apfs_get_link(struct dentry *dentry, struct inode *inode,
 				 struct delayed_call *done)
@@ -27,23 +29,14 @@ static const char *apfs_get_link(struct dentry *dentry, struct inode *inode,
 	char *target, *err;
 	int size;
 
+	/* Not cached yet, and reading the xattr may block */
 	if (!dentry)
 		return ERR_PTR(-ECHILD);
 
-	size = apfs_xattr_get(inode, APFS_XATTR_NAME_SYMLINK,
-			      NULL /* buffer */, 0 /* size */);
+	size = apfs_xattr_get_alloc(inode, APFS_XATTR_NAME_SYMLINK, PATH_MAX,
+				    (void **)&target);
 	if (size < 0) /* TODO: return a better error code */
 		return ERR_PTR(size);
-
-	target = kmalloc(size, GFP_KERNEL);
-	if (!target)
-		return ERR_PTR(-ENOMEM);
-
-	size = apfs_xattr_get(inode, APFS_XATTR_NAME_SYMLINK, target, size);
-	if (size < 0) {
-		err = ERR_PTR(size);
-		goto fail;
-	}
 	if (size == 0 || *(target + size - 1) != 0) {
 		/* Target path must be NULL-terminated */
 		apfs_alert(sb, "bad link target in inode 0x%llx",
@@ -52,8 +45,10 @@ static const char *apfs_get_link(struct dentry *dentry, struct inode *inode,
 		goto fail;
 	}
 
-	set_delayed_call(done, kfree_link, target);
-	return target;
+	/* Freed along with the inode, after an rcu grace period */
+	if (cmpxchg(&inode->i_link, NULL, target) != NULL)
+		kfree(target);
+	return inode->i_link;
 
 fail:
 	kfree(target);
@@ -0,0 +1,371 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/sysfs.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ *
+ * Statistics for each mount, under /sys/fs/apfs/<device>/, and the limits of
+ * its caches
+ */
+
+#include <linux/fs.h>
+#include <linux/kobject.h>
+#include <linux/math64.h>
+#include <linux/string.h>
+#include <linux/sysfs.h>
+#include "apfs.h"
+#include "btree.h"
+#include "cachelimit.h"
+#include "freeidx.h"
+#include "scrub.h"
+#include "stats.h"
+#include "super.h"
+#include "sysfs.h"
+
+/* The /sys/fs/apfs directory */
+static struct kset *apfs_kset;
+
+struct apfs_attr {
+	struct attribute attr;
+	ssize_t (*show)(struct apfs_sb_info *sbi, char *buf);
+	ssize_t (*store)(struct apfs_sb_info *sbi, const char *buf,
+			 size_t len);
+};
+
+#define APFS_ATTR_RO(name)	\
+	static struct apfs_attr apfs_attr_##name = __ATTR_RO(name)
+#define APFS_ATTR_RW(name)	\
+	static struct apfs_attr apfs_attr_##name = __ATTR_RW(name)
+#define APFS_ATTR_LIST(name)	(&apfs_attr_##name.attr)
+
+static ssize_t bloom_hits_show(struct apfs_sb_info *sbi, char *buf)
+{
+	return sprintf(buf, "%lld\n",
+		       atomic64_read(&sbi->s_dir_indexes.bloom_hits));
+}
+APFS_ATTR_RO(bloom_hits);
+
+static ssize_t bloom_false_positives_show(struct apfs_sb_info *sbi, char *buf)
+{
+	return sprintf(buf, "%lld\n",
+		       atomic64_read(&sbi->s_dir_indexes.bloom_false_pos));
+}
+APFS_ATTR_RO(bloom_false_positives);
+
+#define APFS_STAT_ATTR(name, item)					\
+	static ssize_t name##_show(struct apfs_sb_info *sbi, char *buf)	\
+	{								\
+		return sprintf(buf, "%llu\n", apfs_stat_read(sbi, item));	\
+	}								\
+	APFS_ATTR_RO(name)
+
+APFS_STAT_ATTR(node_reads, APFS_STAT_NODE_READS);
+APFS_STAT_ATTR(node_cache_hits, APFS_STAT_NODE_CACHE_HITS);
+APFS_STAT_ATTR(omap_cache_hits, APFS_STAT_OMAP_CACHE_HITS);
+APFS_STAT_ATTR(omap_cache_misses, APFS_STAT_OMAP_CACHE_MISSES);
+APFS_STAT_ATTR(rec_cache_hits, APFS_STAT_REC_CACHE_HITS);
+APFS_STAT_ATTR(finger_hits, APFS_STAT_FINGER_HITS);
+APFS_STAT_ATTR(catidx_hits, APFS_STAT_CATIDX_HITS);
+APFS_STAT_ATTR(child_map_hits, APFS_STAT_CHILD_MAP_HITS);
+APFS_STAT_ATTR(queries_omap, APFS_STAT_QUERY_OMAP);
+APFS_STAT_ATTR(queries_cat, APFS_STAT_QUERY_CAT);
+APFS_STAT_ATTR(queries_other, APFS_STAT_QUERY_OTHER);
+APFS_STAT_ATTR(queries_exact, APFS_STAT_QUERY_EXACT);
+APFS_STAT_ATTR(queries_multiple, APFS_STAT_QUERY_MULTIPLE);
+APFS_STAT_ATTR(extent_cache_hits, APFS_STAT_EXTENT_HITS);
+APFS_STAT_ATTR(extent_cache_misses, APFS_STAT_EXTENT_MISSES);
+APFS_STAT_ATTR(readdir_restarts, APFS_STAT_READDIR_RESTARTS);
+APFS_STAT_ATTR(listing_hits, APFS_STAT_LISTING_HITS);
+APFS_STAT_ATTR(metadata_bytes_read, APFS_STAT_META_BYTES);
+APFS_STAT_ATTR(data_bytes_read, APFS_STAT_DATA_BYTES);
+APFS_STAT_ATTR(clone_pages_shared, APFS_STAT_CLONE_PAGES);
+
+/* Average number of levels gone down by each search, in hundredths */
+static ssize_t descent_depth_show(struct apfs_sb_info *sbi, char *buf)
+{
+	u64 descents = apfs_stat_read(sbi, APFS_STAT_DESCENTS);
+	u64 levels = apfs_stat_read(sbi, APFS_STAT_DESCENT_LEVELS);
+	u64 avg = descents ? div64_u64(levels * 100, descents) : 0;
+
+	return sprintf(buf, "%llu.%02llu\n", avg / 100, avg % 100);
+}
+APFS_ATTR_RO(descent_depth);
+
+static ssize_t readahead_depth_show(struct apfs_sb_info *sbi, char *buf)
+{
+	return sprintf(buf, "%d\n", atomic_read(&sbi->s_btree_ra.depth));
+}
+APFS_ATTR_RO(readahead_depth);
+
+/* Share of the nodes read ahead since mount that got used, in hundredths */
+static ssize_t readahead_hit_ratio_show(struct apfs_sb_info *sbi, char *buf)
+{
+	u64 issued = atomic64_read(&sbi->s_btree_ra.total_issued);
+	u64 used = atomic64_read(&sbi->s_btree_ra.total_used);
+	u64 ratio = issued ? div64_u64(used * 100, issued) : 0;
+
+	return sprintf(buf, "%llu.%02llu\n", ratio / 100, ratio % 100);
+}
+APFS_ATTR_RO(readahead_hit_ratio);
+
+static ssize_t scrub_show(struct apfs_sb_info *sbi, char *buf)
+{
+	return apfs_scrub_show_state(&sbi->s_scrub, buf);
+}
+
+/* Writing "start" begins a new scrub, and "stop" cancels the running one */
+static ssize_t scrub_store(struct apfs_sb_info *sbi, const char *buf,
+			   size_t len)
+{
+	int err;
+
+	if (sysfs_streq(buf, "start")) {
+		err = apfs_scrub_start(&sbi->s_scrub);
+		if (err)
+			return err;
+	} else if (sysfs_streq(buf, "stop")) {
+		apfs_scrub_cancel(&sbi->s_scrub);
+	} else {
+		return -EINVAL;
+	}
+	return len;
+}
+APFS_ATTR_RW(scrub);
+
+static ssize_t scrub_bad_show(struct apfs_sb_info *sbi, char *buf)
+{
+	return apfs_scrub_show_bad(&sbi->s_scrub, buf);
+}
+APFS_ATTR_RO(scrub_bad);
+
+static ssize_t free_extents_show(struct apfs_sb_info *sbi, char *buf)
+{
+	return apfs_free_index_show(sbi, buf);
+}
+APFS_ATTR_RO(free_extents);
+
+static ssize_t messages_suppressed_show(struct apfs_sb_info *sbi, char *buf)
+{
+	return sprintf(buf, "%lld\n", atomic64_read(&sbi->s_msg_suppressed));
+}
+APFS_ATTR_RO(messages_suppressed);
+
+/**
+ * apfs_parse_bytes - Parse a cache limit written to sysfs
+ * @buf:	the string, with an optional K, M or G suffix
+ * @bytes:	on return, the limit in bytes
+ *
+ * Returns 0 on success, or -EINVAL if the string is not a size.
+ */
+static int apfs_parse_bytes(const char *buf, u64 *bytes)
+{
+	char *end;
+
+	*bytes = memparse(buf, &end);
+	if (end == buf || *skip_spaces(end))
+		return -EINVAL;
+	return 0;
+}
+
+/*
+ * Each cache limit reads as the bytes in use followed by the limit, and takes
+ * a new limit in bytes
+ */
+#define APFS_CACHE_LIMIT_ATTR(name, kind)				\
+	static ssize_t name##_show(struct apfs_sb_info *sbi, char *buf)	\
+	{								\
+		return apfs_cache_limit_show(sbi, kind, buf);		\
+	}								\
+	static ssize_t name##_store(struct apfs_sb_info *sbi,		\
+				    const char *buf, size_t len)	\
+	{								\
+		u64 bytes;						\
+		int err;						\
+									\
+		err = apfs_parse_bytes(buf, &bytes);			\
+		if (!err)						\
+			err = apfs_cache_limit_store(sbi, kind, bytes);	\
+		return err ? err : len;					\
+	}								\
+	APFS_ATTR_RW(name)
+
+APFS_CACHE_LIMIT_ATTR(node_cache_limit, APFS_CACHE_NODE);
+APFS_CACHE_LIMIT_ATTR(omap_cache_limit, APFS_CACHE_OMAP);
+APFS_CACHE_LIMIT_ATTR(rec_cache_limit, APFS_CACHE_REC);
+APFS_CACHE_LIMIT_ATTR(extent_cache_limit, APFS_CACHE_EXTENT);
+
+static struct attribute *apfs_attrs[] = {
+	APFS_ATTR_LIST(bloom_hits),
+	APFS_ATTR_LIST(bloom_false_positives),
+	APFS_ATTR_LIST(node_reads),
+	APFS_ATTR_LIST(node_cache_hits),
+	APFS_ATTR_LIST(omap_cache_hits),
+	APFS_ATTR_LIST(omap_cache_misses),
+	APFS_ATTR_LIST(rec_cache_hits),
+	APFS_ATTR_LIST(finger_hits),
+	APFS_ATTR_LIST(catidx_hits),
+	APFS_ATTR_LIST(child_map_hits),
+	APFS_ATTR_LIST(queries_omap),
+	APFS_ATTR_LIST(queries_cat),
+	APFS_ATTR_LIST(queries_other),
+	APFS_ATTR_LIST(queries_exact),
+	APFS_ATTR_LIST(queries_multiple),
+	APFS_ATTR_LIST(descent_depth),
+	APFS_ATTR_LIST(readahead_depth),
+	APFS_ATTR_LIST(readahead_hit_ratio),
+	APFS_ATTR_LIST(extent_cache_hits),
+	APFS_ATTR_LIST(extent_cache_misses),
+	APFS_ATTR_LIST(readdir_restarts),
+	APFS_ATTR_LIST(listing_hits),
+	APFS_ATTR_LIST(metadata_bytes_read),
+	APFS_ATTR_LIST(data_bytes_read),
+	APFS_ATTR_LIST(clone_pages_shared),
+	APFS_ATTR_LIST(scrub),
+	APFS_ATTR_LIST(scrub_bad),
+	APFS_ATTR_LIST(messages_suppressed),
+	APFS_ATTR_LIST(free_extents),
+	APFS_ATTR_LIST(node_cache_limit),
+	APFS_ATTR_LIST(omap_cache_limit),
+	APFS_ATTR_LIST(rec_cache_limit),
+	APFS_ATTR_LIST(extent_cache_limit),
+	NULL,
+};
+
+static ssize_t apfs_attr_show(struct kobject *kobj, struct attribute *attr,
+			      char *buf)
+{
+	struct apfs_sb_info *sbi = container_of(kobj, struct apfs_sb_info,
+						s_kobj);
+	struct apfs_attr *a = container_of(attr, struct apfs_attr, attr);
+
+	return a->show ? a->show(sbi, buf) : -EIO;
+}
+
+static ssize_t apfs_attr_store(struct kobject *kobj, struct attribute *attr,
+			       const char *buf, size_t len)
+{
+	struct apfs_sb_info *sbi = container_of(kobj, struct apfs_sb_info,
+						s_kobj);
+	struct apfs_attr *a = container_of(attr, struct apfs_attr, attr);
+
+	return a->store ? a->store(sbi, buf, len) : -EIO;
+}
+
+static const struct sysfs_ops apfs_attr_ops = {
+	.show	= apfs_attr_show,
+	.store	= apfs_attr_store,
+};
+
+static void apfs_sb_release(struct kobject *kobj)
+{
+	struct apfs_sb_info *sbi = container_of(kobj, struct apfs_sb_info,
+						s_kobj);
+
+	complete(&sbi->s_kobj_unregister);
+}
+
+static struct kobj_type apfs_sb_ktype = {
+	.default_attrs	= apfs_attrs,
+	.sysfs_ops	= &apfs_attr_ops,
+	.release	= apfs_sb_release,
+};
+
+/**
+ * apfs_sysfs_register - Create the sysfs directory for a new mount
+ * @sb:		filesystem superblock
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+int apfs_sysfs_register(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	int err;
+
+	apfs_cache_limits_register(sb);
+	sbi->s_kobj.kset = apfs_kset;
+	init_completion(&sbi->s_kobj_unregister);
+	/* Several volumes of one device may be mounted at the same time */
+	if (sbi->s_snap_xid)
+		err = kobject_init_and_add(&sbi->s_kobj, &apfs_sb_ktype, NULL,
+					   "%s:%u@%llu", sb->s_id,
+					   sbi->s_vol_nr, sbi->s_snap_xid);
+	else if (sbi->s_vol_nr == 0)
+		err = kobject_init_and_add(&sbi->s_kobj, &apfs_sb_ktype, NULL,
+					   "%s", sb->s_id);
+	else
+		err = kobject_init_and_add(&sbi->s_kobj, &apfs_sb_ktype, NULL,
+					   "%s:%u", sb->s_id, sbi->s_vol_nr);
+	if (err) {
+		kobject_put(&sbi->s_kobj);
+		wait_for_completion(&sbi->s_kobj_unregister);
+		apfs_cache_limits_unregister(sb);
+	}
+	return err;
+}
+
+/**
+ * apfs_sysfs_unregister - Remove the sysfs directory of a mount
+ * @sb:		filesystem superblock
+ *
+ * Waits until nobody is using the attributes, so that @sb can be freed.
+ */
+void apfs_sysfs_unregister(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+
+	kobject_del(&sbi->s_kobj);
+	kobject_put(&sbi->s_kobj);
+	wait_for_completion(&sbi->s_kobj_unregister);
+	apfs_cache_limits_unregister(sb);
+}
+
+/*
+ * The global cap for the cache limits of all mounts, in /sys/fs/apfs.  It
+ * reads as the sum of the limits followed by the cap, and zero means no cap.
+ */
+static ssize_t cache_cap_show(struct kobject *kobj,
+			      struct kobj_attribute *attr, char *buf)
+{
+	return apfs_cache_cap_show(buf);
+}
+
+static ssize_t cache_cap_store(struct kobject *kobj,
+			       struct kobj_attribute *attr, const char *buf,
+			       size_t len)
+{
+	u64 bytes;
+	int err;
+
+	err = apfs_parse_bytes(buf, &bytes);
+	if (!err)
+		err = apfs_cache_cap_store(bytes);
+	return err ? err : len;
+}
+
+static struct kobj_attribute apfs_cache_cap_attr = __ATTR_RW(cache_cap);
+
+/**
+ * apfs_sysfs_init - Create the sysfs directory for the module
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+int __init apfs_sysfs_init(void)
+{
+	int err;
+
+	apfs_kset = kset_create_and_add("apfs", NULL, fs_kobj);
+	if (!apfs_kset)
+		return -ENOMEM;
+	err = sysfs_create_file(&apfs_kset->kobj, &apfs_cache_cap_attr.attr);
+	if (err)
+		kset_unregister(apfs_kset);
+	return err;
+}
+
+/**
+ * apfs_sysfs_exit - Remove the sysfs directory of the module
+ */
+void apfs_sysfs_exit(void)
+{
+	kset_unregister(apfs_kset);
+}
@@ -0,0 +1,18 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/sysfs.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_SYSFS_H
+#define _APFS_SYSFS_H
+
+struct super_block;
+
+extern int apfs_sysfs_register(struct super_block *sb);
+extern void apfs_sysfs_unregister(struct super_block *sb);
+extern int __init apfs_sysfs_init(void);
+extern void apfs_sysfs_exit(void);
+
+#endif	/* _APFS_SYSFS_H */
@@ -0,0 +1,14 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/trace.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#include "apfs.h"
+#include "btree.h"
+#include "inode.h"
+#include "super.h"
+
+#define CREATE_TRACE_POINTS
+#include "trace.h"
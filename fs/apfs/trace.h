@@ -0,0 +1,280 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/trace.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#undef TRACE_SYSTEM
+#define TRACE_SYSTEM apfs
+
+#if !defined(_APFS_TRACE_H) || defined(TRACE_HEADER_MULTI_READ)
+#define _APFS_TRACE_H
+
+#include <linux/fs.h>
+#include <linux/iomap.h>
+#include <linux/tracepoint.h>
+#include <linux/types.h>
+#include "btree.h"
+#include "inode.h"
+#include "super.h"
+
+#define show_apfs_query_tree(flags)				\
+	__print_symbolic((flags) & APFS_QUERY_TREE_MASK,	\
+		{ APFS_QUERY_OMAP,	"omap" },		\
+		{ APFS_QUERY_CAT,	"cat" },		\
+		{ APFS_QUERY_SNAP_META,	"snap_meta" },		\
+		{ APFS_QUERY_EXTENTREF,	"extentref" },		\
+		{ APFS_QUERY_FUSION,	"fusion" })
+
+#define show_apfs_mount_phase(phase)				\
+	__print_symbolic(phase,					\
+		{ APFS_MOUNT_CHECKPOINT, "checkpoint" },	\
+		{ APFS_MOUNT_VOLUME,	"volume" },		\
+		{ APFS_MOUNT_OMAP,	"omap" },		\
+		{ APFS_MOUNT_CATALOG,	"catalog" },		\
+		{ APFS_MOUNT_ROOT,	"root" })
+
+#define show_apfs_query_flags(flags)				\
+	__print_flags((flags) & ~APFS_QUERY_TREE_MASK, "|",	\
+		{ APFS_QUERY_NEXT,	"NEXT" },		\
+		{ APFS_QUERY_EXACT,	"EXACT" },		\
+		{ APFS_QUERY_DONE,	"DONE" },		\
+		{ APFS_QUERY_ANY_NAME,	"ANY_NAME" },		\
+		{ APFS_QUERY_ANY_NUMBER, "ANY_NUMBER" },	\
+		{ APFS_QUERY_ANY_ID,	"ANY_ID" })
+
+TRACE_EVENT(apfs_btree_query,
+	TP_PROTO(struct super_block *sb, unsigned int flags,
+		 unsigned int depth, int ret),
+
+	TP_ARGS(sb, flags, depth, ret),
+
+	TP_STRUCT__entry(
+		__field(dev_t,		dev)
+		__field(unsigned int,	flags)
+		__field(unsigned int,	depth)
+		__field(int,		ret)
+	),
+
+	TP_fast_assign(
+		__entry->dev	= sb->s_dev;
+		__entry->flags	= flags;
+		__entry->depth	= depth;
+		__entry->ret	= ret;
+	),
+
+	TP_printk("dev %d:%d tree %s flags %s depth %u ret %d",
+		  MAJOR(__entry->dev), MINOR(__entry->dev),
+		  show_apfs_query_tree(__entry->flags),
+		  show_apfs_query_flags(__entry->flags),
+		  __entry->depth, __entry->ret)
+);
+
+TRACE_EVENT(apfs_read_node,
+	TP_PROTO(struct super_block *sb, u64 block, bool hit, u64 csum_ns),
+
+	TP_ARGS(sb, block, hit, csum_ns),
+
+	TP_STRUCT__entry(
+		__field(dev_t,	dev)
+		__field(u64,	block)
+		__field(bool,	hit)
+		__field(u64,	csum_ns)
+	),
+
+	TP_fast_assign(
+		__entry->dev		= sb->s_dev;
+		__entry->block		= block;
+		__entry->hit		= hit;
+		__entry->csum_ns	= csum_ns;
+	),
+
+	TP_printk("dev %d:%d block 0x%llx %s csum_ns %llu",
+		  MAJOR(__entry->dev), MINOR(__entry->dev),
+		  __entry->block, __entry->hit ? "hit" : "miss",
+		  __entry->csum_ns)
+);
+
+TRACE_EVENT(apfs_omap_lookup_block,
+	TP_PROTO(struct super_block *sb, u64 oid, u64 block, bool cached,
+		 int ret),
+
+	TP_ARGS(sb, oid, block, cached, ret),
+
+	TP_STRUCT__entry(
+		__field(dev_t,	dev)
+		__field(u64,	oid)
+		__field(u64,	block)
+		__field(bool,	cached)
+		__field(int,	ret)
+	),
+
+	TP_fast_assign(
+		__entry->dev	= sb->s_dev;
+		__entry->oid	= oid;
+		__entry->block	= block;
+		__entry->cached	= cached;
+		__entry->ret	= ret;
+	),
+
+	TP_printk("dev %d:%d oid 0x%llx block 0x%llx %s ret %d",
+		  MAJOR(__entry->dev), MINOR(__entry->dev),
+		  __entry->oid, __entry->block,
+		  __entry->cached ? "cached" : "queried", __entry->ret)
+);
+
+TRACE_EVENT(apfs_iomap_begin,
+	TP_PROTO(struct inode *inode, loff_t pos, loff_t length,
+		 struct iomap *iomap, int ret),
+
+	TP_ARGS(inode, pos, length, iomap, ret),
+
+	TP_STRUCT__entry(
+		__field(dev_t,		dev)
+		__field(u64,		ino)
+		__field(loff_t,		pos)
+		__field(loff_t,		length)
+		__field(u64,		offset)
+		__field(u64,		map_length)
+		__field(u64,		addr)
+		__field(u16,		type)
+		__field(int,		ret)
+	),
+
+	TP_fast_assign(
+		__entry->dev		= inode->i_sb->s_dev;
+		__entry->ino		= apfs_ino(inode);
+		__entry->pos		= pos;
+		__entry->length		= length;
+		__entry->offset		= iomap->offset;
+		__entry->map_length	= iomap->length;
+		__entry->addr		= iomap->addr;
+		__entry->type		= iomap->type;
+		__entry->ret		= ret;
+	),
+
+	TP_printk("dev %d:%d ino 0x%llx pos %lld length %lld extent %llu+%llu "
+		  "%s addr 0x%llx ret %d",
+		  MAJOR(__entry->dev), MINOR(__entry->dev), __entry->ino,
+		  __entry->pos, __entry->length, __entry->offset,
+		  __entry->map_length,
+		  __entry->type == IOMAP_HOLE ? "hole" : "mapped",
+		  __entry->addr, __entry->ret)
+);
+
+TRACE_EVENT(apfs_readdir,
+	TP_PROTO(struct inode *dir, loff_t pos, unsigned long skipped,
+		 unsigned long emitted, int ret),
+
+	TP_ARGS(dir, pos, skipped, emitted, ret),
+
+	TP_STRUCT__entry(
+		__field(dev_t,		dev)
+		__field(u64,		ino)
+		__field(loff_t,		pos)
+		__field(unsigned long,	skipped)
+		__field(unsigned long,	emitted)
+		__field(int,		ret)
+	),
+
+	TP_fast_assign(
+		__entry->dev		= dir->i_sb->s_dev;
+		__entry->ino		= apfs_ino(dir);
+		__entry->pos		= pos;
+		__entry->skipped	= skipped;
+		__entry->emitted	= emitted;
+		__entry->ret		= ret;
+	),
+
+	TP_printk("dev %d:%d ino 0x%llx pos %lld skipped %lu emitted %lu "
+		  "ret %d",
+		  MAJOR(__entry->dev), MINOR(__entry->dev), __entry->ino,
+		  __entry->pos, __entry->skipped, __entry->emitted,
+		  __entry->ret)
+);
+
+TRACE_EVENT(apfs_lookup,
+	TP_PROTO(struct inode *dir, const struct qstr *name, u64 ino, int ret),
+
+	TP_ARGS(dir, name, ino, ret),
+
+	TP_STRUCT__entry(
+		__field(dev_t,		dev)
+		__field(u64,		dir)
+		__field(u64,		ino)
+		__field(int,		ret)
+		__string(name,		name->name)
+	),
+
+	TP_fast_assign(
+		__entry->dev	= dir->i_sb->s_dev;
+		__entry->dir	= apfs_ino(dir);
+		__entry->ino	= ino;
+		__entry->ret	= ret;
+		__assign_str(name, name->name);
+	),
+
+	/* The name goes last, so that it can be told apart from the rest */
+	TP_printk("dev %d:%d dir 0x%llx ino 0x%llx ret %d name %s",
+		  MAJOR(__entry->dev), MINOR(__entry->dev), __entry->dir,
+		  __entry->ino, __entry->ret, __get_str(name))
+);
+
+TRACE_EVENT(apfs_getattr,
+	TP_PROTO(struct inode *inode),
+
+	TP_ARGS(inode),
+
+	TP_STRUCT__entry(
+		__field(dev_t,	dev)
+		__field(u64,	ino)
+	),
+
+	TP_fast_assign(
+		__entry->dev	= inode->i_sb->s_dev;
+		__entry->ino	= apfs_ino(inode);
+	),
+
+	TP_printk("dev %d:%d ino 0x%llx",
+		  MAJOR(__entry->dev), MINOR(__entry->dev), __entry->ino)
+);
+
+/*
+ * The time of the phase is taken here, so that it costs nothing when the
+ * tracepoint is off but the call to ktime_get_ns() for @start.
+ */
+TRACE_EVENT(apfs_mount_phase,
+	TP_PROTO(struct super_block *sb, enum apfs_mount_phase phase,
+		 u64 start, int ret),
+
+	TP_ARGS(sb, phase, start, ret),
+
+	TP_STRUCT__entry(
+		__field(dev_t,		dev)
+		__field(unsigned int,	phase)
+		__field(u64,		ns)
+		__field(int,		ret)
+	),
+
+	TP_fast_assign(
+		__entry->dev	= sb->s_dev;
+		__entry->phase	= phase;
+		__entry->ns	= ktime_get_ns() - start;
+		__entry->ret	= ret;
+	),
+
+	TP_printk("dev %d:%d phase %s ns %llu ret %d",
+		  MAJOR(__entry->dev), MINOR(__entry->dev),
+		  show_apfs_mount_phase(__entry->phase), __entry->ns,
+		  __entry->ret)
+);
+
+#endif	/* _APFS_TRACE_H */
+
+/* This part must be outside protection */
+#undef TRACE_INCLUDE_PATH
+#define TRACE_INCLUDE_PATH .
+#undef TRACE_INCLUDE_FILE
+#define TRACE_INCLUDE_FILE trace
+#include <trace/define_trace.h>
@@ -9,69 +9,59 @@
  */
 
 #include <linux/kernel.h>
+#include <linux/crc32c.h>
 #include <linux/errno.h>
 #include <linux/slab.h>
 #include <linux/types.h>
 #include <linux/nls.h>
 #include <linux/ctype.h>
+#include <linux/string.h>
 #include "unicode.h"
 
+/*
+ * Unicode data for a single character.  The nfd and cf fields locate the
+ * decomposition and case folding of the character in apfs_nfd and apfs_cf,
+ * or are zero if the character maps to itself.
+ */
+struct apfs_uni_props {
+	u16 nfd;
+	u16 cf;
+	u8 ccc;				/* Canonical combining class */
+};
+
+/*
+ * The properties of all characters are kept in pages of consecutive code
+ * points, and the page for each block of code points is found in an index.
+ * Most blocks have no data, so they share page zero, which is all zeroes;
+ * so do all the characters past the end of the index.
+ */
+#define APFS_UNI_BLOCK_SHIFT	6
+#define APFS_UNI_BLOCK_SIZE	(1 << APFS_UNI_BLOCK_SHIFT)
+#define APFS_UNI_BLOCK_MASK	(APFS_UNI_BLOCK_SIZE - 1)
+#define APFS_UNI_INDEX_SIZE	3049
+
 /* The arrays of unicode data are defined at the bottom of the file */
-/* TODO: would a single trie with all the data be more efficient? */
-static u16 apfs_nfd_trie[];
+static const u8 apfs_uni_index[APFS_UNI_INDEX_SIZE];
+static const struct apfs_uni_props apfs_uni_pages[][APFS_UNI_BLOCK_SIZE];
 static unicode_t apfs_nfd[];
-static u16 apfs_cf_trie[];
 static unicode_t apfs_cf[];
-static u8 apfs_ccc_trie[];
-
-#define TRIE_HEIGHT		5
 
-/* A trie node has one child for each possible nibble in the key */
-#define TRIE_CHILD_SHIFT	4
-#define TRIE_CHILD_MASK		((1 << TRIE_CHILD_SHIFT) - 1)
-
-/* A trie value length is stored in the last three bits of its position */
-#define TRIE_POS_SHIFT		3
-#define TRIE_SIZE_MASK		((1 << TRIE_POS_SHIFT) - 1)
+/* A value length is stored in the last three bits of its position */
+#define UNI_POS_SHIFT		3
+#define UNI_SIZE_MASK		((1 << UNI_POS_SHIFT) - 1)
 
 /**
- * apfs_trie_find - Look up a trie value
- * @trie:	trie to search
- * @key:	search key (a unicode character)
- * @result:	on return, this either holds the value (on a ccc lookup) or its
- *		position in the value array (on a cf or nfd lookup).
- * @is_ccc:	true if this a ccc (canonical combining class) lookup
- *
- * Returns the length of the value (0 if it doesn't exist).
+ * apfs_uni_props - Look up the unicode data for a character
+ * @utf32char:	the character
  */
-static int apfs_trie_find(void *trie, unicode_t key, void *result, bool is_ccc)
+static inline const struct apfs_uni_props *apfs_uni_props(unicode_t utf32char)
 {
-	int node = 0;
-	int h;
-
-	for (h = TRIE_HEIGHT - 1; h >= 0; --h) {
-		int child = (key >> (TRIE_CHILD_SHIFT * h)) & TRIE_CHILD_MASK;
-		int child_index = (node << TRIE_CHILD_SHIFT) + child;
-
-		if (is_ccc)
-			node = ((u8 *)trie)[child_index];
-		else
-			node = ((u16 *)trie)[child_index];
-
-		if (node == 0) {
-			*(u8 *)result = 0;
-			return 0;
-		}
-	}
+	unicode_t block = utf32char >> APFS_UNI_BLOCK_SHIFT;
 
-	if (is_ccc) {
-		/* ccc values fit in one byte, so no need for a value array */
-		*(u8 *)result = node;
-		return 1;
-	}
-
-	*(u16 *)result = node >> TRIE_POS_SHIFT;
-	return node & TRIE_SIZE_MASK;
+	if (block >= APFS_UNI_INDEX_SIZE)
+		return &apfs_uni_pages[0][0];
+	return &apfs_uni_pages[apfs_uni_index[block]]
+			      [utf32char & APFS_UNI_BLOCK_MASK];
 }
 
 /**
@@ -82,6 +72,7 @@ static int apfs_trie_find(void *trie, unicode_t key, void *result, bool is_ccc)
 void apfs_init_unicursor(struct apfs_unicursor *cursor, const char *utf8str)
 {
 	cursor->utf8curr = utf8str;
+	cursor->skip = 0;
 	cursor->length = -1;
 	cursor->last_pos = -1;
 	cursor->last_ccc = 0;
@@ -163,26 +154,25 @@ static unicode_t apfs_decompose_hangul(unicode_t utf32char, int off)
  * Returns the single character at offset @off in the normalization of
  * @utf32char, or NORM_END if this offset is past the end.
  */
-static unicode_t apfs_normalize_char(unicode_t utf32char, int off,
-				     bool case_fold)
+static __always_inline unicode_t apfs_normalize_char(unicode_t utf32char,
+						     int off,
+						     const bool case_fold)
 {
+	const struct apfs_uni_props *props;
 	int nfd_len;
 	unicode_t *nfd, *cf;
-	u16 pos;
-	int ret;
 
 	if (apfs_is_precomposed_hangul(utf32char)) /* Hangul has no case */
 		return apfs_decompose_hangul(utf32char, off);
 
-	ret = apfs_trie_find(apfs_nfd_trie, utf32char,
-			     &pos, false /* is_ccc */);
-	if (!ret) {
+	props = apfs_uni_props(utf32char);
+	if (!props->nfd) {
 		/* The decomposition is just the same character */
 		nfd_len = 1;
 		nfd = &utf32char;
 	} else {
-		nfd_len = ret;
-		nfd = &apfs_nfd[pos];
+		nfd_len = props->nfd & UNI_SIZE_MASK;
+		nfd = &apfs_nfd[props->nfd >> UNI_POS_SHIFT];
 	}
 
 	if (!case_fold) {
@@ -194,15 +184,16 @@ static unicode_t apfs_normalize_char(unicode_t utf32char, int off,
 	for (; nfd_len > 0; nfd++, nfd_len--) {
 		int cf_len;
 
-		ret = apfs_trie_find(apfs_cf_trie, *nfd,
-				     &pos, false /* is_ccc */);
-		if (!ret) {
+		/* No need for another lookup if there was no decomposition */
+		if (nfd != &utf32char)
+			props = apfs_uni_props(*nfd);
+		if (!props->cf) {
 			/* The case folding is just the same character */
 			cf_len = 1;
 			cf = nfd;
 		} else {
-			cf_len = ret;
-			cf = &apfs_cf[pos];
+			cf_len = props->cf & UNI_SIZE_MASK;
+			cf = &apfs_cf[props->cf >> UNI_POS_SHIFT];
 		}
 
 		if (off < cf_len)
@@ -216,13 +207,20 @@ static unicode_t apfs_normalize_char(unicode_t utf32char, int off,
 /**
  * apfs_get_normalization_length - Count the characters until the next starter
  * @utf8str:	string to normalize, may begin with several starters
+ * @skip:	characters to leave out from the normalization of the first one
  * @case_fold:	true if the count should consider case folding
  *
  * Returns the number of unicode characters in the normalization of the
  * substring that begins at @utf8str and ends at the first nonconsecutive
  * starter. Or 0 if the substring has invalid UTF-8.
+ *
+ * The starter that ends the substring may come in the middle of the
+ * normalization of a single character: case folding turns the ypogegrammeni
+ * of U+1FB4 into an iota, after the acute accent.
  */
-static int apfs_get_normalization_length(const char *utf8str, bool case_fold)
+static __always_inline int
+apfs_get_normalization_length(const char *utf8str, int skip,
+			      const bool case_fold)
 {
 	int utf8len, pos, norm_len = 0;
 	bool starters_over = false;
@@ -235,7 +233,7 @@ static int apfs_get_normalization_length(const char *utf8str, bool case_fold)
 		if (utf8len < 0) /* Invalid unicode; don't normalize anything */
 			return 0;
 
-		for (pos = 0;; pos++, norm_len++) {
+		for (pos = skip;; pos++, norm_len++) {
 			unicode_t utf32norm;
 			u8 ccc;
 
@@ -244,8 +242,7 @@ static int apfs_get_normalization_length(const char *utf8str, bool case_fold)
 			if (utf32norm == NORM_END)
 				break;
 
-			apfs_trie_find(apfs_ccc_trie, utf32norm, &ccc,
-				       true /* is_ccc */);
+			ccc = apfs_uni_props(utf32norm)->ccc;
 
 			if (ccc != 0)
 				starters_over = true;
@@ -253,24 +250,28 @@ static int apfs_get_normalization_length(const char *utf8str, bool case_fold)
 				return norm_len;
 		}
 		utf8str += utf8len;
+		skip = 0;
 	}
 }
 
 /**
- * apfs_normalize_next - Return the next normalized character from a string
+ * __apfs_normalize_next - Return the next normalized character from a string
  * @cursor:	unicode cursor for the string
- * @case_fold:	case fold the string?
+ * @case_fold:	case fold the string?  Must be a constant, so that each caller
+ *		gets a copy of the loops without the mode checks.
  *
  * Sets @cursor->length to the length of the normalized substring between
  * @cursor->utf8curr and the first nonconsecutive starter. Returns a single
  * normalized character, setting @cursor->last_ccc and @cursor->last_pos to
  * its CCC and position in the substring. When the end of the substring is
  * reached, updates @cursor->utf8curr to point to the beginning of the next
- * one.
+ * one, and @cursor->skip to the characters of its normalization that were
+ * part of this substring.
  *
  * Returns 0 if the substring has invalid UTF-8.
  */
-unicode_t apfs_normalize_next(struct apfs_unicursor *cursor, bool case_fold)
+static __always_inline unicode_t
+__apfs_normalize_next(struct apfs_unicursor *cursor, const bool case_fold)
 {
 	const char *utf8str = cursor->utf8curr;
 	int str_pos, min_pos = -1;
@@ -278,6 +279,7 @@ unicode_t apfs_normalize_next(struct apfs_unicursor *cursor, bool case_fold)
 	u8 min_ccc;
 
 new_starter:
+	/* A substring that begins inside a character is never ascii */
 	if (likely(isascii(*utf8str))) {
 		cursor->utf8curr = utf8str + 1;
 		if (case_fold)
@@ -287,6 +289,7 @@ unicode_t apfs_normalize_next(struct apfs_unicursor *cursor, bool case_fold)
 
 	if (cursor->length < 0) {
 		cursor->length = apfs_get_normalization_length(utf8str,
+							       cursor->skip,
 							       case_fold);
 		if (cursor->length == 0)
 			return 0;
@@ -296,21 +299,23 @@ unicode_t apfs_normalize_next(struct apfs_unicursor *cursor, bool case_fold)
 	min_ccc = 0xFF;	/* Above all possible ccc's */
 
 	while (1) {
-		unicode_t utf32char;
+		unicode_t utf32char, utf32norm;
 		int utf8len, pos;
 
 		utf8len = utf8_to_utf32(utf8str, 4, &utf32char);
-		for (pos = 0;; pos++, str_pos++) {
-			unicode_t utf32norm;
+		pos = utf8str == cursor->utf8curr ? cursor->skip : 0;
+		for (;; pos++, str_pos++) {
 			u8 ccc;
 
+			utf32norm = NORM_END;
+			if (str_pos == cursor->length)
+				break;
 			utf32norm = apfs_normalize_char(utf32char, pos,
 							case_fold);
 			if (utf32norm == NORM_END)
 				break;
 
-			apfs_trie_find(apfs_ccc_trie, utf32norm, &ccc,
-				       true /* is_ccc */);
+			ccc = apfs_uni_props(utf32norm)->ccc;
 
 			if (ccc >= min_ccc || ccc < cursor->last_ccc)
 				continue;
@@ -322,22 +327,269 @@ unicode_t apfs_normalize_next(struct apfs_unicursor *cursor, bool case_fold)
 			}
 		}
 
-		utf8str += utf8len;
-		if (str_pos == cursor->length) {
-			/* Reached the following starter */
-			if (min_ccc != 0xFF) {
-				/* Not done with this substring yet */
-				cursor->last_ccc = min_ccc;
-				cursor->last_pos = min_pos;
-				return utf32min;
-			}
-			/* Continue from the next starter */
+		if (str_pos != cursor->length) {
+			utf8str += utf8len;
+			continue;
+		}
+
+		/* Reached the following starter */
+		if (min_ccc != 0xFF) {
+			/* Not done with this substring yet */
+			cursor->last_ccc = min_ccc;
+			cursor->last_pos = min_pos;
+			return utf32min;
+		}
+
+		/* Continue from the next starter, maybe inside this char */
+		if (utf32norm == NORM_END)
+			utf32norm = apfs_normalize_char(utf32char, pos,
+							case_fold);
+		if (utf32norm == NORM_END) {
+			apfs_init_unicursor(cursor, utf8str + utf8len);
+		} else {
 			apfs_init_unicursor(cursor, utf8str);
-			goto new_starter;
+			cursor->skip = pos;
 		}
+		utf8str = cursor->utf8curr;
+		goto new_starter;
 	}
 }
 
+/**
+ * apfs_normalize_next_cs - Return the next normalized character from a string
+ * @cursor:	unicode cursor for the string
+ *
+ * Same as __apfs_normalize_next(), for case sensitive volumes.
+ */
+unicode_t apfs_normalize_next_cs(struct apfs_unicursor *cursor)
+{
+	return __apfs_normalize_next(cursor, false /* case_fold */);
+}
+
+/**
+ * apfs_normalize_next_cf - Return the next normalized and case folded
+ *			    character from a string
+ * @cursor:	unicode cursor for the string
+ *
+ * Same as __apfs_normalize_next(), for case insensitive volumes.
+ */
+unicode_t apfs_normalize_next_cf(struct apfs_unicursor *cursor)
+{
+	return __apfs_normalize_next(cursor, true /* case_fold */);
+}
+
+/**
+ * apfs_nname_push - Append a character to a normalized name
+ * @nname:	the normalized name
+ * @utf32char:	character to append
+ *
+ * Returns 0 on success, or -ENOMEM if the buffer couldn't be grown.
+ */
+static int apfs_nname_push(struct apfs_nname *nname, unicode_t utf32char)
+{
+	if (unlikely(nname->len == nname->size)) {
+		unicode_t *chars;
+
+		chars = kmalloc_array(2 * nname->size, sizeof(*chars),
+				      GFP_KERNEL);
+		if (!chars)
+			return -ENOMEM;
+		memcpy(chars, nname->chars, nname->len * sizeof(*chars));
+		if (nname->chars != nname->inline_chars)
+			kfree(nname->chars);
+		nname->chars = chars;
+		nname->size *= 2;
+	}
+	nname->chars[nname->len++] = utf32char;
+	return 0;
+}
+
+/**
+ * apfs_nname_reorder - Put a sequence of nonstarters in canonical order
+ * @chars:	the nonstarters
+ * @count:	number of characters in @chars
+ *
+ * This is a stable sort by ccc, so characters of the same class keep their
+ * order.  The sequences are short, so an insertion sort is good enough.
+ */
+static void apfs_nname_reorder(unicode_t *chars, unsigned int count)
+{
+	unsigned int i, j;
+
+	for (i = 1; i < count; i++) {
+		unicode_t utf32char = chars[i];
+		u8 ccc = apfs_uni_props(utf32char)->ccc;
+
+		for (j = i; j > 0 && apfs_uni_props(chars[j - 1])->ccc > ccc;
+		     j--)
+			chars[j] = chars[j - 1];
+		chars[j] = utf32char;
+	}
+}
+
+/**
+ * __apfs_normalize_name - Normalize a whole string into a buffer
+ * @utf8str:	string to normalize
+ * @case_fold:	case fold the string?  Must be a constant, like for
+ *		__apfs_normalize_next().
+ * @nname:	on return, the normalized string
+ *
+ * Each character is decomposed just once, and the nonstarters of each
+ * substring are sorted in place when the next starter is reached.  The result
+ * is the same sequence of characters that apfs_normalize_next() would return,
+ * including for invalid UTF-8: the normalization stops before the substring
+ * that has it.
+ *
+ * Returns 0 on success, or -ENOMEM in case of failure; @nname must be freed
+ * with apfs_nname_free() either way.
+ */
+static __always_inline int __apfs_normalize_name(const char *utf8str,
+						 const bool case_fold,
+						 struct apfs_nname *nname)
+{
+	unsigned int start = 0, nonstarters = 0;
+	bool in_substr = false, starters_over = false;
+	int err;
+
+	nname->chars = nname->inline_chars;
+	nname->len = 0;
+	nname->size = APFS_NNAME_INLINE;
+
+	while (*utf8str) {
+		unicode_t utf32char;
+		int utf8len, pos;
+
+		if (likely(isascii(*utf8str)) && (!in_substr || starters_over)) {
+			/* An ascii starter ends the substring, if any */
+			if (in_substr)
+				apfs_nname_reorder(nname->chars + nonstarters,
+						   nname->len - nonstarters);
+			in_substr = starters_over = false;
+			err = apfs_nname_push(nname, case_fold ?
+					      tolower(*utf8str) : *utf8str);
+			if (err)
+				return err;
+			utf8str++;
+			continue;
+		}
+
+		utf8len = utf8_to_utf32(utf8str, 4, &utf32char);
+		if (utf8len < 0) {
+			/* Invalid unicode; drop the whole substring */
+			if (in_substr)
+				nname->len = start;
+			return 0;
+		}
+		if (!in_substr) {
+			in_substr = true;
+			start = nname->len;
+		}
+
+		for (pos = 0;; pos++) {
+			unicode_t utf32norm;
+			u8 ccc;
+
+			utf32norm = apfs_normalize_char(utf32char, pos,
+							case_fold);
+			if (utf32norm == NORM_END)
+				break;
+
+			ccc = apfs_uni_props(utf32norm)->ccc;
+			if (ccc == 0 && starters_over) {
+				/* Reached the next starter */
+				apfs_nname_reorder(nname->chars + nonstarters,
+						   nname->len - nonstarters);
+				starters_over = false;
+				start = nname->len;
+			} else if (ccc != 0 && !starters_over) {
+				starters_over = true;
+				nonstarters = nname->len;
+			}
+			err = apfs_nname_push(nname, utf32norm);
+			if (err)
+				return err;
+		}
+		utf8str += utf8len;
+	}
+	if (starters_over)
+		apfs_nname_reorder(nname->chars + nonstarters,
+				   nname->len - nonstarters);
+	return 0;
+}
+
+/**
+ * apfs_normalize_name_cs - Normalize a whole string into a buffer
+ * @utf8str:	string to normalize
+ * @nname:	on return, the normalized string
+ *
+ * Same as __apfs_normalize_name(), for case sensitive volumes.
+ */
+int apfs_normalize_name_cs(const char *utf8str, struct apfs_nname *nname)
+{
+	return __apfs_normalize_name(utf8str, false /* case_fold */, nname);
+}
+
+/**
+ * apfs_normalize_name_cf - Normalize and case fold a whole string into a
+ *			    buffer
+ * @utf8str:	string to normalize
+ * @nname:	on return, the normalized string
+ *
+ * Same as __apfs_normalize_name(), for case insensitive volumes.
+ */
+int apfs_normalize_name_cf(const char *utf8str, struct apfs_nname *nname)
+{
+	return __apfs_normalize_name(utf8str, true /* case_fold */, nname);
+}
+
+/**
+ * apfs_nname_free - Free the buffer of a normalized name
+ * @nname:	the normalized name
+ */
+void apfs_nname_free(struct apfs_nname *nname)
+{
+	if (nname->chars != nname->inline_chars)
+		kfree(nname->chars);
+	nname->chars = nname->inline_chars;
+	nname->len = 0;
+}
+
+/**
+ * apfs_nname_cmp - Compare two normalized names
+ * @nname1:	first name
+ * @nname2:	second name
+ *
+ * Returns the same result as apfs_filename_cmp() for the original strings:
+ * the names are sorted by their characters in order, and a name goes before
+ * any longer one that begins with it.
+ */
+int apfs_nname_cmp(const struct apfs_nname *nname1,
+		   const struct apfs_nname *nname2)
+{
+	unsigned int len = min(nname1->len, nname2->len);
+	unsigned int i;
+
+	for (i = 0; i < len; i++) {
+		if (nname1->chars[i] != nname2->chars[i])
+			return nname1->chars[i] < nname2->chars[i] ? -1 : 1;
+	}
+	if (nname1->len == nname2->len)
+		return 0;
+	return nname1->len < nname2->len ? -1 : 1;
+}
+
+/**
+ * apfs_nname_hash - Compute the crc32c of a normalized name
+ * @nname:	the normalized name
+ *
+ * This is the same as the hash of the original string, as computed for the
+ * keys of directory records.
+ */
+u32 apfs_nname_hash(const struct apfs_nname *nname)
+{
+	return crc32c(~0, nname->chars, nname->len * sizeof(*nname->chars));
+}
+
 /*
  * The following arrays were built with data provided by the Unicode Standard,
  * version 9.0.
@@ -346,760 +598,6639 @@ unicode_t apfs_normalize_next(struct apfs_unicursor *cursor, bool case_fold)
  * under the Terms of Use in http://www.unicode.org/copyright.html.
  */
 
-static u16 apfs_nfd_trie[] = {
-	/* Node for range 0x_____ */
-	0x0001, 0x0002, 0x0003, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0____ */
-	0x0004, 0x0005, 0x0006, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0008,
-	/* Node for range 0x1____ */
-	0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x000a, 0x0000, 0x0000,
-	/* Node for range 0x2____ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x000b,
-	/* Node for range 0x00___ */
-	0x000c, 0x000d, 0x000e, 0x000f, 0x0010, 0x0000, 0x0011, 0x0000,
-	0x0000, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0000, 0x0017,
-	/* Node for range 0x01___ */
-	0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0019, 0x0000, 0x0000, 0x001a, 0x001b,
-	/* Node for range 0x02___ */
-	0x001c, 0x001d, 0x001e, 0x001f, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x03___ */
-	0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0f___ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0022, 0x0023, 0x0024, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x11___ */
-	0x0025, 0x0026, 0x0000, 0x0027, 0x0028, 0x0029, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x1d___ */
-	0x0000, 0x002a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x2f___ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x002b, 0x002c, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x000__ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x002e, 0x002f, 0x0030, 0x0031,
-	/* Node for range 0x001__ */
-	0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039,
-	0x0000, 0x0000, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f,
-	/* Node for range 0x002__ */
-	0x0040, 0x0041, 0x0042, 0x0043, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x003__ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0044, 0x0000, 0x0000, 0x0045,
-	0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x0000, 0x0000,
-	/* Node for range 0x004__ */
-	0x004c, 0x004d, 0x0000, 0x004e, 0x0000, 0x004f, 0x0000, 0x0050,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0051, 0x0052, 0x0053, 0x0054,
-	/* Node for range 0x006__ */
-	0x0000, 0x0000, 0x0055, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0056, 0x0057, 0x0000, 0x0000,
-	/* Node for range 0x009__ */
-	0x0000, 0x0000, 0x0058, 0x0059, 0x0000, 0x005a, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x005b, 0x005c, 0x0000, 0x0000,
-	/* Node for range 0x00a__ */
-	0x0000, 0x0000, 0x0000, 0x005d, 0x0000, 0x005e, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x00b__ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x005f, 0x0060, 0x0000, 0x0000,
-	0x0000, 0x0061, 0x0000, 0x0000, 0x0062, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x00c__ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0063, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0064, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x00d__ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0065, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0066, 0x0000, 0x0000,
-	/* Node for range 0x00f__ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0067, 0x0068, 0x0069, 0x006a,
-	0x006b, 0x006c, 0x006d, 0x006e, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x010__ */
-	0x0000, 0x0000, 0x006f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x01b__ */
-	0x0070, 0x0071, 0x0000, 0x0072, 0x0073, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x01e__ */
-	0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x007b,
-	0x007c, 0x007d, 0x007e, 0x007f, 0x0080, 0x0081, 0x0082, 0x0083,
-	/* Node for range 0x01f__ */
-	0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008a, 0x008b,
-	0x008c, 0x008d, 0x008e, 0x008f, 0x0090, 0x0091, 0x0092, 0x0093,
-	/* Node for range 0x020__ */
-	0x0094, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x021__ */
-	0x0000, 0x0000, 0x0095, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0096, 0x0097, 0x0000, 0x0098, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x022__ */
-	0x0099, 0x0000, 0x009a, 0x0000, 0x009b, 0x0000, 0x009c, 0x009d,
-	0x009e, 0x0000, 0x009f, 0x0000, 0x0000, 0x0000, 0x00a0, 0x0000,
-	/* Node for range 0x023__ */
-	0x0000, 0x0000, 0x00a1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x02a__ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00a2, 0x0000, 0x0000,
-	/* Node for range 0x030__ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x00a3, 0x00a4, 0x00a5, 0x00a6,
-	0x0000, 0x00a7, 0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x0000, 0x00ac,
-	/* Node for range 0x0f9__ */
-	0x00ad, 0x00ae, 0x00af, 0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b4,
-	0x00b5, 0x00b6, 0x00b7, 0x00b8, 0x00b9, 0x00ba, 0x00bb, 0x00bc,
-	/* Node for range 0x0fa__ */
-	0x00bd, 0x00be, 0x00bf, 0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4,
-	0x00c5, 0x00c6, 0x00c7, 0x00c8, 0x00c9, 0x00ca, 0x0000, 0x0000,
-	/* Node for range 0x0fb__ */
-	0x0000, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x110__ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x00cf, 0x00d0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x111__ */
-	0x0000, 0x0000, 0x00d1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x113__ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x00d2, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x114__ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x00d3, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x115__ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x00d4, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x1d1__ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00d5, 0x00d6, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x00d7, 0x00d8, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x2f8__ */
-	0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df, 0x00e0,
-	0x00e1, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x00e7, 0x00e8,
-	/* Node for range 0x2f9__ */
-	0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef, 0x00f0,
-	0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x00f7, 0x00f8,
-	/* Node for range 0x2fa__ */
-	0x00f9, 0x00fa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x000c_ */
-	0x0002, 0x0012, 0x0022, 0x0032, 0x0042, 0x0052, 0x0000, 0x0062,
-	0x0072, 0x0082, 0x0092, 0x00a2, 0x00b2, 0x00c2, 0x00d2, 0x00e2,
-	/* Node for range 0x000d_ */
-	0x0000, 0x00f2, 0x0102, 0x0112, 0x0122, 0x0132, 0x0142, 0x0000,
-	0x0000, 0x0152, 0x0162, 0x0172, 0x0182, 0x0192, 0x0000, 0x0000,
-	/* Node for range 0x000e_ */
-	0x01a2, 0x01b2, 0x01c2, 0x01d2, 0x01e2, 0x01f2, 0x0000, 0x0202,
-	0x0212, 0x0222, 0x0232, 0x0242, 0x0252, 0x0262, 0x0272, 0x0282,
-	/* Node for range 0x000f_ */
-	0x0000, 0x0292, 0x02a2, 0x02b2, 0x02c2, 0x02d2, 0x02e2, 0x0000,
-	0x0000, 0x02f2, 0x0302, 0x0312, 0x0322, 0x0332, 0x0000, 0x0342,
-	/* Node for range 0x0010_ */
-	0x0352, 0x0362, 0x0372, 0x0382, 0x0392, 0x03a2, 0x03b2, 0x03c2,
-	0x03d2, 0x03e2, 0x03f2, 0x0402, 0x0412, 0x0422, 0x0432, 0x0442,
-	/* Node for range 0x0011_ */
-	0x0000, 0x0000, 0x0452, 0x0462, 0x0472, 0x0482, 0x0492, 0x04a2,
-	0x04b2, 0x04c2, 0x04d2, 0x04e2, 0x04f2, 0x0502, 0x0512, 0x0522,
-	/* Node for range 0x0012_ */
-	0x0532, 0x0542, 0x0552, 0x0562, 0x0572, 0x0582, 0x0000, 0x0000,
-	0x0592, 0x05a2, 0x05b2, 0x05c2, 0x05d2, 0x05e2, 0x05f2, 0x0602,
-	/* Node for range 0x0013_ */
-	0x0612, 0x0000, 0x0000, 0x0000, 0x0622, 0x0632, 0x0642, 0x0652,
-	0x0000, 0x0662, 0x0672, 0x0682, 0x0692, 0x06a2, 0x06b2, 0x0000,
-	/* Node for range 0x0014_ */
-	0x0000, 0x0000, 0x0000, 0x06c2, 0x06d2, 0x06e2, 0x06f2, 0x0702,
-	0x0712, 0x0000, 0x0000, 0x0000, 0x0722, 0x0732, 0x0742, 0x0752,
-	/* Node for range 0x0015_ */
-	0x0762, 0x0772, 0x0000, 0x0000, 0x0782, 0x0792, 0x07a2, 0x07b2,
-	0x07c2, 0x07d2, 0x07e2, 0x07f2, 0x0802, 0x0812, 0x0822, 0x0832,
-	/* Node for range 0x0016_ */
-	0x0842, 0x0852, 0x0862, 0x0872, 0x0882, 0x0892, 0x0000, 0x0000,
-	0x08a2, 0x08b2, 0x08c2, 0x08d2, 0x08e2, 0x08f2, 0x0902, 0x0912,
-	/* Node for range 0x0017_ */
-	0x0922, 0x0932, 0x0942, 0x0952, 0x0962, 0x0972, 0x0982, 0x0992,
-	0x09a2, 0x09b2, 0x09c2, 0x09d2, 0x09e2, 0x09f2, 0x0a02, 0x0000,
-	/* Node for range 0x001a_ */
-	0x0a12, 0x0a22, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0a32,
-	/* Node for range 0x001b_ */
-	0x0a42, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x001c_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0a52, 0x0a62, 0x0a72,
-	/* Node for range 0x001d_ */
-	0x0a82, 0x0a92, 0x0aa2, 0x0ab2, 0x0ac2, 0x0ad3, 0x0aeb, 0x0b03,
-	0x0b1b, 0x0b33, 0x0b4b, 0x0b63, 0x0b7b, 0x0000, 0x0b93, 0x0bab,
-	/* Node for range 0x001e_ */
-	0x0bc3, 0x0bdb, 0x0bf2, 0x0c02, 0x0000, 0x0000, 0x0c12, 0x0c22,
-	0x0c32, 0x0c42, 0x0c52, 0x0c62, 0x0c73, 0x0c8b, 0x0ca2, 0x0cb2,
-	/* Node for range 0x001f_ */
-	0x0cc2, 0x0000, 0x0000, 0x0000, 0x0cd2, 0x0ce2, 0x0000, 0x0000,
-	0x0cf2, 0x0d02, 0x0d13, 0x0d2b, 0x0d42, 0x0d52, 0x0d62, 0x0d72,
-	/* Node for range 0x0020_ */
-	0x0d82, 0x0d92, 0x0da2, 0x0db2, 0x0dc2, 0x0dd2, 0x0de2, 0x0df2,
-	0x0e02, 0x0e12, 0x0e22, 0x0e32, 0x0e42, 0x0e52, 0x0e62, 0x0e72,
-	/* Node for range 0x0021_ */
-	0x0e82, 0x0e92, 0x0ea2, 0x0eb2, 0x0ec2, 0x0ed2, 0x0ee2, 0x0ef2,
-	0x0f02, 0x0f12, 0x0f22, 0x0f32, 0x0000, 0x0000, 0x0f42, 0x0f52,
-	/* Node for range 0x0022_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0f62, 0x0f72,
-	0x0f82, 0x0f92, 0x0fa3, 0x0fbb, 0x0fd3, 0x0feb, 0x1002, 0x1012,
-	/* Node for range 0x0023_ */
-	0x1023, 0x103b, 0x1052, 0x1062, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0034_ */
-	0x1071, 0x1079, 0x0000, 0x1081, 0x108a, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0037_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x1099, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a1, 0x0000,
-	/* Node for range 0x0038_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10aa, 0x10ba, 0x10c9,
-	0x10d2, 0x10e2, 0x10f2, 0x0000, 0x1102, 0x0000, 0x1112, 0x1122,
-	/* Node for range 0x0039_ */
-	0x1133, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x003a_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x114a, 0x115a, 0x116a, 0x117a, 0x118a, 0x119a,
-	/* Node for range 0x003b_ */
-	0x11ab, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x003c_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x11c2, 0x11d2, 0x11e2, 0x11f2, 0x1202, 0x0000,
-	/* Node for range 0x003d_ */
-	0x0000, 0x0000, 0x0000, 0x1212, 0x1222, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0040_ */
-	0x1232, 0x1242, 0x0000, 0x1252, 0x0000, 0x0000, 0x0000, 0x1262,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x1272, 0x1282, 0x1292, 0x0000,
-	/* Node for range 0x0041_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x12a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0043_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x12b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0045_ */
-	0x12c2, 0x12d2, 0x0000, 0x12e2, 0x0000, 0x0000, 0x0000, 0x12f2,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x1302, 0x1312, 0x1322, 0x0000,
-	/* Node for range 0x0047_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1332, 0x1342,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x004c_ */
-	0x0000, 0x1352, 0x1362, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x004d_ */
-	0x1372, 0x1382, 0x1392, 0x13a2, 0x0000, 0x0000, 0x13b2, 0x13c2,
-	0x0000, 0x0000, 0x13d2, 0x13e2, 0x13f2, 0x1402, 0x1412, 0x1422,
-	/* Node for range 0x004e_ */
-	0x0000, 0x0000, 0x1432, 0x1442, 0x1452, 0x1462, 0x1472, 0x1482,
-	0x0000, 0x0000, 0x1492, 0x14a2, 0x14b2, 0x14c2, 0x14d2, 0x14e2,
-	/* Node for range 0x004f_ */
-	0x14f2, 0x1502, 0x1512, 0x1522, 0x1532, 0x1542, 0x0000, 0x0000,
-	0x1552, 0x1562, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0062_ */
-	0x0000, 0x0000, 0x1572, 0x1582, 0x1592, 0x15a2, 0x15b2, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x006c_ */
-	0x15c2, 0x0000, 0x15d2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x006d_ */
-	0x0000, 0x0000, 0x0000, 0x15e2, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0092_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x15f2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0093_ */
-	0x0000, 0x1602, 0x0000, 0x0000, 0x1612, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0095_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x1622, 0x1632, 0x1642, 0x1652, 0x1662, 0x1672, 0x1682, 0x1692,
-	/* Node for range 0x009c_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x16a2, 0x16b2, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x009d_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x16c2, 0x16d2, 0x0000, 0x16e2,
-	/* Node for range 0x00a3_ */
-	0x0000, 0x0000, 0x0000, 0x16f2, 0x0000, 0x0000, 0x1702, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x00a5_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x1712, 0x1722, 0x1732, 0x0000, 0x0000, 0x1742, 0x0000,
-	/* Node for range 0x00b4_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x1752, 0x0000, 0x0000, 0x1762, 0x1772, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x00b5_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x1782, 0x1792, 0x0000, 0x0000,
-	/* Node for range 0x00b9_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x17a2, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x00bc_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x17b2, 0x17c2, 0x17d2, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x00c4_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x17e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x00cc_ */
-	0x17f2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1802,
-	0x1812, 0x0000, 0x1822, 0x1833, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x00d4_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x184a, 0x185a, 0x186a, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x00dd_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x187a, 0x0000, 0x188a, 0x189b, 0x18b2, 0x0000,
-	/* Node for range 0x00f4_ */
-	0x0000, 0x0000, 0x0000, 0x18c2, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18d2, 0x0000, 0x0000,
-	/* Node for range 0x00f5_ */
-	0x0000, 0x0000, 0x18e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x18f2,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x1902, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x00f6_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x1912, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x00f7_ */
-	0x0000, 0x0000, 0x0000, 0x1922, 0x0000, 0x1932, 0x1942, 0x0000,
-	0x1952, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x00f8_ */
-	0x0000, 0x1962, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x00f9_ */
-	0x0000, 0x0000, 0x0000, 0x1972, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1982, 0x0000, 0x0000,
-	/* Node for range 0x00fa_ */
-	0x0000, 0x0000, 0x1992, 0x0000, 0x0000, 0x0000, 0x0000, 0x19a2,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x19b2, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x00fb_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x19c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0102_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19d2, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x01b0_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19e2, 0x0000,
-	0x19f2, 0x0000, 0x1a02, 0x0000, 0x1a12, 0x0000, 0x1a22, 0x0000,
-	/* Node for range 0x01b1_ */
-	0x0000, 0x0000, 0x1a32, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x01b3_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x1a42, 0x0000, 0x1a52, 0x0000, 0x0000,
-	/* Node for range 0x01b4_ */
-	0x1a62, 0x1a72, 0x0000, 0x1a82, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x01e0_ */
-	0x1a92, 0x1aa2, 0x1ab2, 0x1ac2, 0x1ad2, 0x1ae2, 0x1af2, 0x1b02,
-	0x1b13, 0x1b2b, 0x1b42, 0x1b52, 0x1b62, 0x1b72, 0x1b82, 0x1b92,
-	/* Node for range 0x01e1_ */
-	0x1ba2, 0x1bb2, 0x1bc2, 0x1bd2, 0x1be3, 0x1bfb, 0x1c13, 0x1c2b,
-	0x1c42, 0x1c52, 0x1c62, 0x1c72, 0x1c83, 0x1c9b, 0x1cb2, 0x1cc2,
-	/* Node for range 0x01e2_ */
-	0x1cd2, 0x1ce2, 0x1cf2, 0x1d02, 0x1d12, 0x1d22, 0x1d32, 0x1d42,
-	0x1d52, 0x1d62, 0x1d72, 0x1d82, 0x1d92, 0x1da2, 0x1db3, 0x1dcb,
-	/* Node for range 0x01e3_ */
-	0x1de2, 0x1df2, 0x1e02, 0x1e12, 0x1e22, 0x1e32, 0x1e42, 0x1e52,
-	0x1e63, 0x1e7b, 0x1e92, 0x1ea2, 0x1eb2, 0x1ec2, 0x1ed2, 0x1ee2,
-	/* Node for range 0x01e4_ */
-	0x1ef2, 0x1f02, 0x1f12, 0x1f22, 0x1f32, 0x1f42, 0x1f52, 0x1f62,
-	0x1f72, 0x1f82, 0x1f92, 0x1fa2, 0x1fb3, 0x1fcb, 0x1fe3, 0x1ffb,
-	/* Node for range 0x01e5_ */
-	0x2013, 0x202b, 0x2043, 0x205b, 0x2072, 0x2082, 0x2092, 0x20a2,
-	0x20b2, 0x20c2, 0x20d2, 0x20e2, 0x20f3, 0x210b, 0x2122, 0x2132,
-	/* Node for range 0x01e6_ */
-	0x2142, 0x2152, 0x2162, 0x2172, 0x2183, 0x219b, 0x21b3, 0x21cb,
-	0x21e3, 0x21fb, 0x2212, 0x2222, 0x2232, 0x2242, 0x2252, 0x2262,
-	/* Node for range 0x01e7_ */
-	0x2272, 0x2282, 0x2292, 0x22a2, 0x22b2, 0x22c2, 0x22d2, 0x22e2,
-	0x22f3, 0x230b, 0x2323, 0x233b, 0x2352, 0x2362, 0x2372, 0x2382,
-	/* Node for range 0x01e8_ */
-	0x2392, 0x23a2, 0x23b2, 0x23c2, 0x23d2, 0x23e2, 0x23f2, 0x2402,
-	0x2412, 0x2422, 0x2432, 0x2442, 0x2452, 0x2462, 0x2472, 0x2482,
-	/* Node for range 0x01e9_ */
-	0x2492, 0x24a2, 0x24b2, 0x24c2, 0x24d2, 0x24e2, 0x24f2, 0x2502,
-	0x2512, 0x2522, 0x0000, 0x2532, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x01ea_ */
-	0x2542, 0x2552, 0x2562, 0x2572, 0x2583, 0x259b, 0x25b3, 0x25cb,
-	0x25e3, 0x25fb, 0x2613, 0x262b, 0x2643, 0x265b, 0x2673, 0x268b,
-	/* Node for range 0x01eb_ */
-	0x26a3, 0x26bb, 0x26d3, 0x26eb, 0x2703, 0x271b, 0x2733, 0x274b,
-	0x2762, 0x2772, 0x2782, 0x2792, 0x27a2, 0x27b2, 0x27c3, 0x27db,
-	/* Node for range 0x01ec_ */
-	0x27f3, 0x280b, 0x2823, 0x283b, 0x2853, 0x286b, 0x2883, 0x289b,
-	0x28b2, 0x28c2, 0x28d2, 0x28e2, 0x28f2, 0x2902, 0x2912, 0x2922,
-	/* Node for range 0x01ed_ */
-	0x2933, 0x294b, 0x2963, 0x297b, 0x2993, 0x29ab, 0x29c3, 0x29db,
-	0x29f3, 0x2a0b, 0x2a23, 0x2a3b, 0x2a53, 0x2a6b, 0x2a83, 0x2a9b,
-	/* Node for range 0x01ee_ */
-	0x2ab3, 0x2acb, 0x2ae3, 0x2afb, 0x2b12, 0x2b22, 0x2b32, 0x2b42,
-	0x2b53, 0x2b6b, 0x2b83, 0x2b9b, 0x2bb3, 0x2bcb, 0x2be3, 0x2bfb,
-	/* Node for range 0x01ef_ */
-	0x2c13, 0x2c2b, 0x2c42, 0x2c52, 0x2c62, 0x2c72, 0x2c82, 0x2c92,
-	0x2ca2, 0x2cb2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x01f0_ */
-	0x2cc2, 0x2cd2, 0x2ce3, 0x2cfb, 0x2d13, 0x2d2b, 0x2d43, 0x2d5b,
-	0x2d72, 0x2d82, 0x2d93, 0x2dab, 0x2dc3, 0x2ddb, 0x2df3, 0x2e0b,
-	/* Node for range 0x01f1_ */
-	0x2e22, 0x2e32, 0x2e43, 0x2e5b, 0x2e73, 0x2e8b, 0x0000, 0x0000,
-	0x2ea2, 0x2eb2, 0x2ec3, 0x2edb, 0x2ef3, 0x2f0b, 0x0000, 0x0000,
-	/* Node for range 0x01f2_ */
-	0x2f22, 0x2f32, 0x2f43, 0x2f5b, 0x2f73, 0x2f8b, 0x2fa3, 0x2fbb,
-	0x2fd2, 0x2fe2, 0x2ff3, 0x300b, 0x3023, 0x303b, 0x3053, 0x306b,
-	/* Node for range 0x01f3_ */
-	0x3082, 0x3092, 0x30a3, 0x30bb, 0x30d3, 0x30eb, 0x3103, 0x311b,
-	0x3132, 0x3142, 0x3153, 0x316b, 0x3183, 0x319b, 0x31b3, 0x31cb,
-	/* Node for range 0x01f4_ */
-	0x31e2, 0x31f2, 0x3203, 0x321b, 0x3233, 0x324b, 0x0000, 0x0000,
-	0x3262, 0x3272, 0x3283, 0x329b, 0x32b3, 0x32cb, 0x0000, 0x0000,
-	/* Node for range 0x01f5_ */
-	0x32e2, 0x32f2, 0x3303, 0x331b, 0x3333, 0x334b, 0x3363, 0x337b,
-	0x0000, 0x3392, 0x0000, 0x33a3, 0x0000, 0x33bb, 0x0000, 0x33d3,
-	/* Node for range 0x01f6_ */
-	0x33ea, 0x33fa, 0x340b, 0x3423, 0x343b, 0x3453, 0x346b, 0x3483,
-	0x349a, 0x34aa, 0x34bb, 0x34d3, 0x34eb, 0x3503, 0x351b, 0x3533,
-	/* Node for range 0x01f7_ */
-	0x354a, 0x355a, 0x356a, 0x357a, 0x358a, 0x359a, 0x35aa, 0x35ba,
-	0x35ca, 0x35da, 0x35ea, 0x35fa, 0x360a, 0x361a, 0x0000, 0x0000,
-	/* Node for range 0x01f8_ */
-	0x362b, 0x3643, 0x365c, 0x367c, 0x369c, 0x36bc, 0x36dc, 0x36fc,
-	0x371b, 0x3733, 0x374c, 0x376c, 0x378c, 0x37ac, 0x37cc, 0x37ec,
-	/* Node for range 0x01f9_ */
-	0x380b, 0x3823, 0x383c, 0x385c, 0x387c, 0x389c, 0x38bc, 0x38dc,
-	0x38fb, 0x3913, 0x392c, 0x394c, 0x396c, 0x398c, 0x39ac, 0x39cc,
-	/* Node for range 0x01fa_ */
-	0x39eb, 0x3a03, 0x3a1c, 0x3a3c, 0x3a5c, 0x3a7c, 0x3a9c, 0x3abc,
-	0x3adb, 0x3af3, 0x3b0c, 0x3b2c, 0x3b4c, 0x3b6c, 0x3b8c, 0x3bac,
-	/* Node for range 0x01fb_ */
-	0x3bca, 0x3bda, 0x3beb, 0x3c02, 0x3c13, 0x0000, 0x3c2a, 0x3c3b,
-	0x3c52, 0x3c62, 0x3c72, 0x3c82, 0x3c92, 0x0000, 0x3ca1, 0x0000,
-	/* Node for range 0x01fc_ */
-	0x0000, 0x3caa, 0x3cbb, 0x3cd2, 0x3ce3, 0x0000, 0x3cfa, 0x3d0b,
-	0x3d22, 0x3d32, 0x3d42, 0x3d52, 0x3d62, 0x3d72, 0x3d82, 0x3d92,
-	/* Node for range 0x01fd_ */
-	0x3da2, 0x3db2, 0x3dc3, 0x3ddb, 0x0000, 0x0000, 0x3df2, 0x3e03,
-	0x3e1a, 0x3e2a, 0x3e3a, 0x3e4a, 0x0000, 0x3e5a, 0x3e6a, 0x3e7a,
-	/* Node for range 0x01fe_ */
-	0x3e8a, 0x3e9a, 0x3eab, 0x3ec3, 0x3eda, 0x3eea, 0x3efa, 0x3f0b,
-	0x3f22, 0x3f32, 0x3f42, 0x3f52, 0x3f62, 0x3f72, 0x3f82, 0x3f91,
-	/* Node for range 0x01ff_ */
-	0x0000, 0x0000, 0x3f9b, 0x3fb2, 0x3fc3, 0x0000, 0x3fda, 0x3feb,
-	0x4002, 0x4012, 0x4022, 0x4032, 0x4042, 0x4051, 0x0000, 0x0000,
-	/* Node for range 0x0200_ */
-	0x4059, 0x4061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0212_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4069, 0x0000,
-	0x0000, 0x0000, 0x4071, 0x407a, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0219_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x408a, 0x409a, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x021a_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x40aa, 0x0000,
-	/* Node for range 0x021c_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x40ba, 0x40ca, 0x40da,
-	/* Node for range 0x0220_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x40ea, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x40fa, 0x0000, 0x0000, 0x410a, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0222_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x411a, 0x0000, 0x412a, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0224_ */
-	0x0000, 0x413a, 0x0000, 0x0000, 0x414a, 0x0000, 0x0000, 0x415a,
-	0x0000, 0x416a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0226_ */
-	0x417a, 0x0000, 0x418a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x419a, 0x41aa, 0x41ba,
-	/* Node for range 0x0227_ */
-	0x41ca, 0x41da, 0x0000, 0x0000, 0x41ea, 0x41fa, 0x0000, 0x0000,
-	0x420a, 0x421a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0228_ */
-	0x422a, 0x423a, 0x0000, 0x0000, 0x424a, 0x425a, 0x0000, 0x0000,
-	0x426a, 0x427a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x022a_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x428a, 0x429a, 0x42aa, 0x42ba,
-	/* Node for range 0x022e_ */
-	0x42ca, 0x42da, 0x42ea, 0x42fa, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x430a, 0x431a, 0x432a, 0x433a, 0x0000, 0x0000,
-	/* Node for range 0x0232_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x4349, 0x4351, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x02ad_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x435a, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0304_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x436a, 0x0000, 0x437a, 0x0000,
-	/* Node for range 0x0305_ */
-	0x438a, 0x0000, 0x439a, 0x0000, 0x43aa, 0x0000, 0x43ba, 0x0000,
-	0x43ca, 0x0000, 0x43da, 0x0000, 0x43ea, 0x0000, 0x43fa, 0x0000,
-	/* Node for range 0x0306_ */
-	0x440a, 0x0000, 0x441a, 0x0000, 0x0000, 0x442a, 0x0000, 0x443a,
-	0x0000, 0x444a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0307_ */
-	0x445a, 0x446a, 0x0000, 0x447a, 0x448a, 0x0000, 0x449a, 0x44aa,
-	0x0000, 0x44ba, 0x44ca, 0x0000, 0x44da, 0x44ea, 0x0000, 0x0000,
-	/* Node for range 0x0309_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x44fa, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x450a, 0x0000,
-	/* Node for range 0x030a_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x451a, 0x0000, 0x452a, 0x0000,
-	/* Node for range 0x030b_ */
-	0x453a, 0x0000, 0x454a, 0x0000, 0x455a, 0x0000, 0x456a, 0x0000,
-	0x457a, 0x0000, 0x458a, 0x0000, 0x459a, 0x0000, 0x45aa, 0x0000,
-	/* Node for range 0x030c_ */
-	0x45ba, 0x0000, 0x45ca, 0x0000, 0x0000, 0x45da, 0x0000, 0x45ea,
-	0x0000, 0x45fa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x030d_ */
-	0x460a, 0x461a, 0x0000, 0x462a, 0x463a, 0x0000, 0x464a, 0x465a,
-	0x0000, 0x466a, 0x467a, 0x0000, 0x468a, 0x469a, 0x0000, 0x0000,
-	/* Node for range 0x030f_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x46aa, 0x0000, 0x0000, 0x46ba,
-	0x46ca, 0x46da, 0x46ea, 0x0000, 0x0000, 0x0000, 0x46fa, 0x0000,
-	/* Node for range 0x0f90_ */
-	0x4709, 0x4711, 0x4719, 0x4721, 0x4729, 0x4731, 0x4739, 0x4741,
-	0x4749, 0x4751, 0x4759, 0x4761, 0x4769, 0x4771, 0x4779, 0x4781,
-	/* Node for range 0x0f91_ */
-	0x4789, 0x4791, 0x4799, 0x47a1, 0x47a9, 0x47b1, 0x47b9, 0x47c1,
-	0x47c9, 0x47d1, 0x47d9, 0x47e1, 0x47e9, 0x47f1, 0x47f9, 0x4801,
-	/* Node for range 0x0f92_ */
-	0x4809, 0x4811, 0x4819, 0x4821, 0x4829, 0x4831, 0x4839, 0x4841,
-	0x4849, 0x4851, 0x4859, 0x4861, 0x4869, 0x4871, 0x4879, 0x4881,
-	/* Node for range 0x0f93_ */
-	0x4889, 0x4891, 0x4899, 0x48a1, 0x48a9, 0x48b1, 0x48b9, 0x48c1,
-	0x48c9, 0x48d1, 0x48d9, 0x48e1, 0x48e9, 0x48f1, 0x48f9, 0x4901,
-	/* Node for range 0x0f94_ */
-	0x4909, 0x4911, 0x4919, 0x4921, 0x4929, 0x4931, 0x4939, 0x4941,
-	0x4949, 0x4951, 0x4959, 0x4961, 0x4969, 0x4971, 0x4979, 0x4981,
-	/* Node for range 0x0f95_ */
-	0x4989, 0x4991, 0x4999, 0x49a1, 0x49a9, 0x49b1, 0x49b9, 0x49c1,
-	0x49c9, 0x49d1, 0x49d9, 0x49e1, 0x49e9, 0x49f1, 0x49f9, 0x4a01,
-	/* Node for range 0x0f96_ */
-	0x4a09, 0x4a11, 0x4a19, 0x4a21, 0x4a29, 0x4a31, 0x4a39, 0x4a41,
-	0x4a49, 0x4a51, 0x4a59, 0x4a61, 0x4a69, 0x4a71, 0x4a79, 0x4a81,
-	/* Node for range 0x0f97_ */
-	0x4a89, 0x4a91, 0x4a99, 0x4aa1, 0x4aa9, 0x4ab1, 0x4ab9, 0x4ac1,
-	0x4ac9, 0x4ad1, 0x4ad9, 0x4ae1, 0x4ae9, 0x4af1, 0x4af9, 0x4b01,
-	/* Node for range 0x0f98_ */
-	0x4b09, 0x4b11, 0x4b19, 0x4b21, 0x4b29, 0x4b31, 0x4b39, 0x4b41,
-	0x4b49, 0x4b51, 0x4b59, 0x4b61, 0x4b69, 0x4b71, 0x4b79, 0x4b81,
-	/* Node for range 0x0f99_ */
-	0x4b89, 0x4b91, 0x4b99, 0x4ba1, 0x4ba9, 0x4bb1, 0x4bb9, 0x4bc1,
-	0x4bc9, 0x4bd1, 0x4bd9, 0x4be1, 0x4be9, 0x4bf1, 0x4bf9, 0x4c01,
-	/* Node for range 0x0f9a_ */
-	0x4c09, 0x4c11, 0x4c19, 0x4c21, 0x4c29, 0x4c31, 0x4c39, 0x4c41,
-	0x4c49, 0x4c51, 0x4c59, 0x4c61, 0x4c69, 0x4c71, 0x4c79, 0x4c81,
-	/* Node for range 0x0f9b_ */
-	0x4c89, 0x4c91, 0x4c99, 0x4ca1, 0x4ca9, 0x4cb1, 0x4cb9, 0x4cc1,
-	0x4cc9, 0x4cd1, 0x4cd9, 0x4ce1, 0x4ce9, 0x4cf1, 0x4cf9, 0x4d01,
-	/* Node for range 0x0f9c_ */
-	0x4d09, 0x4d11, 0x4d19, 0x4d21, 0x4d29, 0x4d31, 0x4d39, 0x4d41,
-	0x4d49, 0x4d51, 0x4d59, 0x4d61, 0x4d69, 0x4d71, 0x4d79, 0x4d81,
-	/* Node for range 0x0f9d_ */
-	0x4d89, 0x4d91, 0x4d99, 0x4da1, 0x4da9, 0x4db1, 0x4db9, 0x4dc1,
-	0x4dc9, 0x4dd1, 0x4dd9, 0x4de1, 0x4de9, 0x4df1, 0x4df9, 0x4e01,
-	/* Node for range 0x0f9e_ */
-	0x4e09, 0x4e11, 0x4e19, 0x4e21, 0x4e29, 0x4e31, 0x4e39, 0x4e41,
-	0x4e49, 0x4e51, 0x4e59, 0x4e61, 0x4e69, 0x4e71, 0x4e79, 0x4e81,
-	/* Node for range 0x0f9f_ */
-	0x4e89, 0x4e91, 0x4e99, 0x4ea1, 0x4ea9, 0x4eb1, 0x4eb9, 0x4ec1,
-	0x4ec9, 0x4ed1, 0x4ed9, 0x4ee1, 0x4ee9, 0x4ef1, 0x4ef9, 0x4f01,
-	/* Node for range 0x0fa0_ */
-	0x4f09, 0x4f11, 0x4f19, 0x4f21, 0x4f29, 0x4f31, 0x4f39, 0x4f41,
-	0x4f49, 0x4f51, 0x4f59, 0x4f61, 0x4f69, 0x4f71, 0x0000, 0x0000,
-	/* Node for range 0x0fa1_ */
-	0x4f79, 0x0000, 0x4f81, 0x0000, 0x0000, 0x4f89, 0x4f91, 0x4f99,
-	0x4fa1, 0x4fa9, 0x4fb1, 0x4fb9, 0x4fc1, 0x4fc9, 0x4fd1, 0x0000,
-	/* Node for range 0x0fa2_ */
-	0x4fd9, 0x0000, 0x4fe1, 0x0000, 0x0000, 0x4fe9, 0x4ff1, 0x0000,
-	0x0000, 0x0000, 0x4ff9, 0x5001, 0x5009, 0x5011, 0x5019, 0x5021,
-	/* Node for range 0x0fa3_ */
-	0x5029, 0x5031, 0x5039, 0x5041, 0x5049, 0x5051, 0x5059, 0x5061,
-	0x5069, 0x5071, 0x5079, 0x5081, 0x5089, 0x5091, 0x5099, 0x50a1,
-	/* Node for range 0x0fa4_ */
-	0x50a9, 0x50b1, 0x50b9, 0x50c1, 0x50c9, 0x50d1, 0x50d9, 0x50e1,
-	0x50e9, 0x50f1, 0x50f9, 0x5101, 0x5109, 0x5111, 0x5119, 0x5121,
-	/* Node for range 0x0fa5_ */
-	0x5129, 0x5131, 0x5139, 0x5141, 0x5149, 0x5151, 0x5159, 0x5161,
-	0x5169, 0x5171, 0x5179, 0x5181, 0x5189, 0x5191, 0x5199, 0x51a1,
-	/* Node for range 0x0fa6_ */
-	0x51a9, 0x51b1, 0x51b9, 0x51c1, 0x51c9, 0x51d1, 0x51d9, 0x51e1,
-	0x51e9, 0x51f1, 0x51f9, 0x5201, 0x5209, 0x5211, 0x0000, 0x0000,
-	/* Node for range 0x0fa7_ */
-	0x5219, 0x5221, 0x5229, 0x5231, 0x5239, 0x5241, 0x5249, 0x5251,
-	0x5259, 0x5261, 0x5269, 0x5271, 0x5279, 0x5281, 0x5289, 0x5291,
-	/* Node for range 0x0fa8_ */
-	0x5299, 0x52a1, 0x52a9, 0x52b1, 0x52b9, 0x52c1, 0x52c9, 0x52d1,
-	0x52d9, 0x52e1, 0x52e9, 0x52f1, 0x52f9, 0x5301, 0x5309, 0x5311,
-	/* Node for range 0x0fa9_ */
-	0x5319, 0x5321, 0x5329, 0x5331, 0x5339, 0x5341, 0x5349, 0x5351,
-	0x5359, 0x5361, 0x5369, 0x5371, 0x5379, 0x5381, 0x5389, 0x5391,
-	/* Node for range 0x0faa_ */
-	0x5399, 0x53a1, 0x53a9, 0x53b1, 0x53b9, 0x53c1, 0x53c9, 0x53d1,
-	0x53d9, 0x53e1, 0x53e9, 0x53f1, 0x53f9, 0x5401, 0x5409, 0x5411,
-	/* Node for range 0x0fab_ */
-	0x5419, 0x5421, 0x5429, 0x5431, 0x5439, 0x5441, 0x5449, 0x5451,
-	0x5459, 0x5461, 0x5469, 0x5471, 0x5479, 0x5481, 0x5489, 0x5491,
-	/* Node for range 0x0fac_ */
-	0x5499, 0x54a1, 0x54a9, 0x54b1, 0x54b9, 0x54c1, 0x54c9, 0x54d1,
-	0x54d9, 0x54e1, 0x54e9, 0x54f1, 0x54f9, 0x5501, 0x5509, 0x5511,
-	/* Node for range 0x0fad_ */
-	0x5519, 0x5521, 0x5529, 0x5531, 0x5539, 0x5541, 0x5549, 0x5551,
-	0x5559, 0x5561, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0fb1_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x556a, 0x0000, 0x557a,
-	/* Node for range 0x0fb2_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x558a, 0x559a, 0x55ab, 0x55c3, 0x55da, 0x55ea,
-	/* Node for range 0x0fb3_ */
-	0x55fa, 0x560a, 0x561a, 0x562a, 0x563a, 0x564a, 0x565a, 0x0000,
-	0x566a, 0x567a, 0x568a, 0x569a, 0x56aa, 0x0000, 0x56ba, 0x0000,
-	/* Node for range 0x0fb4_ */
-	0x56ca, 0x56da, 0x0000, 0x56ea, 0x56fa, 0x0000, 0x570a, 0x571a,
-	0x572a, 0x573a, 0x574a, 0x575a, 0x576a, 0x577a, 0x578a, 0x0000,
-	/* Node for range 0x1109_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x579a, 0x0000, 0x57aa, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x110a_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x57ba, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x1112_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x57ca, 0x57da,
-	/* Node for range 0x1134_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x57ea, 0x57fa, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x114b_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x580a, 0x581a, 0x0000, 0x582a, 0x0000,
-	/* Node for range 0x115b_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x583a, 0x584a, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x1d15_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x585a, 0x586a,
-	/* Node for range 0x1d16_ */
-	0x587b, 0x5893, 0x58ab, 0x58c3, 0x58db, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x1d1b_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x58f2, 0x5902, 0x5913, 0x592b, 0x5943,
-	/* Node for range 0x1d1c_ */
-	0x595b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x2f80_ */
-	0x5971, 0x5979, 0x5981, 0x5989, 0x5991, 0x5999, 0x59a1, 0x59a9,
-	0x59b1, 0x59b9, 0x59c1, 0x59c9, 0x59d1, 0x59d9, 0x59e1, 0x59e9,
-	/* Node for range 0x2f81_ */
-	0x59f1, 0x59f9, 0x5a01, 0x5a09, 0x5a11, 0x5a19, 0x5a21, 0x5a29,
-	0x5a31, 0x5a39, 0x5a41, 0x5a49, 0x5a51, 0x5a59, 0x5a61, 0x5a69,
-	/* Node for range 0x2f82_ */
-	0x5a71, 0x5a79, 0x5a81, 0x5a89, 0x5a91, 0x5a99, 0x5aa1, 0x5aa9,
-	0x5ab1, 0x5ab9, 0x5ac1, 0x5ac9, 0x5ad1, 0x5ad9, 0x5ae1, 0x5ae9,
-	/* Node for range 0x2f83_ */
-	0x5af1, 0x5af9, 0x5b01, 0x5b09, 0x5b11, 0x5b19, 0x5b21, 0x5b29,
-	0x5b31, 0x5b39, 0x5b41, 0x5b49, 0x5b51, 0x5b59, 0x5b61, 0x5b69,
-	/* Node for range 0x2f84_ */
-	0x5b71, 0x5b79, 0x5b81, 0x5b89, 0x5b91, 0x5b99, 0x5ba1, 0x5ba9,
-	0x5bb1, 0x5bb9, 0x5bc1, 0x5bc9, 0x5bd1, 0x5bd9, 0x5be1, 0x5be9,
-	/* Node for range 0x2f85_ */
-	0x5bf1, 0x5bf9, 0x5c01, 0x5c09, 0x5c11, 0x5c19, 0x5c21, 0x5c29,
-	0x5c31, 0x5c39, 0x5c41, 0x5c49, 0x5c51, 0x5c59, 0x5c61, 0x5c69,
-	/* Node for range 0x2f86_ */
-	0x5c71, 0x5c79, 0x5c81, 0x5c89, 0x5c91, 0x5c99, 0x5ca1, 0x5ca9,
-	0x5cb1, 0x5cb9, 0x5cc1, 0x5cc9, 0x5cd1, 0x5cd9, 0x5ce1, 0x5ce9,
-	/* Node for range 0x2f87_ */
-	0x5cf1, 0x5cf9, 0x5d01, 0x5d09, 0x5d11, 0x5d19, 0x5d21, 0x5d29,
-	0x5d31, 0x5d39, 0x5d41, 0x5d49, 0x5d51, 0x5d59, 0x5d61, 0x5d69,
-	/* Node for range 0x2f88_ */
-	0x5d71, 0x5d79, 0x5d81, 0x5d89, 0x5d91, 0x5d99, 0x5da1, 0x5da9,
-	0x5db1, 0x5db9, 0x5dc1, 0x5dc9, 0x5dd1, 0x5dd9, 0x5de1, 0x5de9,
-	/* Node for range 0x2f89_ */
-	0x5df1, 0x5df9, 0x5e01, 0x5e09, 0x5e11, 0x5e19, 0x5e21, 0x5e29,
-	0x5e31, 0x5e39, 0x5e41, 0x5e49, 0x5e51, 0x5e59, 0x5e61, 0x5e69,
-	/* Node for range 0x2f8a_ */
-	0x5e71, 0x5e79, 0x5e81, 0x5e89, 0x5e91, 0x5e99, 0x5ea1, 0x5ea9,
-	0x5eb1, 0x5eb9, 0x5ec1, 0x5ec9, 0x5ed1, 0x5ed9, 0x5ee1, 0x5ee9,
-	/* Node for range 0x2f8b_ */
-	0x5ef1, 0x5ef9, 0x5f01, 0x5f09, 0x5f11, 0x5f19, 0x5f21, 0x5f29,
-	0x5f31, 0x5f39, 0x5f41, 0x5f49, 0x5f51, 0x5f59, 0x5f61, 0x5f69,
-	/* Node for range 0x2f8c_ */
-	0x5f71, 0x5f79, 0x5f81, 0x5f89, 0x5f91, 0x5f99, 0x5fa1, 0x5fa9,
-	0x5fb1, 0x5fb9, 0x5fc1, 0x5fc9, 0x5fd1, 0x5fd9, 0x5fe1, 0x5fe9,
-	/* Node for range 0x2f8d_ */
-	0x5ff1, 0x5ff9, 0x6001, 0x6009, 0x6011, 0x6019, 0x6021, 0x6029,
-	0x6031, 0x6039, 0x6041, 0x6049, 0x6051, 0x6059, 0x6061, 0x6069,
-	/* Node for range 0x2f8e_ */
-	0x6071, 0x6079, 0x6081, 0x6089, 0x6091, 0x6099, 0x60a1, 0x60a9,
-	0x60b1, 0x60b9, 0x60c1, 0x60c9, 0x60d1, 0x60d9, 0x60e1, 0x60e9,
-	/* Node for range 0x2f8f_ */
-	0x60f1, 0x60f9, 0x6101, 0x6109, 0x6111, 0x6119, 0x6121, 0x6129,
-	0x6131, 0x6139, 0x6141, 0x6149, 0x6151, 0x6159, 0x6161, 0x6169,
-	/* Node for range 0x2f90_ */
-	0x6171, 0x6179, 0x6181, 0x6189, 0x6191, 0x6199, 0x61a1, 0x61a9,
-	0x61b1, 0x61b9, 0x61c1, 0x61c9, 0x61d1, 0x61d9, 0x61e1, 0x61e9,
-	/* Node for range 0x2f91_ */
-	0x61f1, 0x61f9, 0x6201, 0x6209, 0x6211, 0x6219, 0x6221, 0x6229,
-	0x6231, 0x6239, 0x6241, 0x6249, 0x6251, 0x6259, 0x6261, 0x6269,
-	/* Node for range 0x2f92_ */
-	0x6271, 0x6279, 0x6281, 0x6289, 0x6291, 0x6299, 0x62a1, 0x62a9,
-	0x62b1, 0x62b9, 0x62c1, 0x62c9, 0x62d1, 0x62d9, 0x62e1, 0x62e9,
-	/* Node for range 0x2f93_ */
-	0x62f1, 0x62f9, 0x6301, 0x6309, 0x6311, 0x6319, 0x6321, 0x6329,
-	0x6331, 0x6339, 0x6341, 0x6349, 0x6351, 0x6359, 0x6361, 0x6369,
-	/* Node for range 0x2f94_ */
-	0x6371, 0x6379, 0x6381, 0x6389, 0x6391, 0x6399, 0x63a1, 0x63a9,
-	0x63b1, 0x63b9, 0x63c1, 0x63c9, 0x63d1, 0x63d9, 0x63e1, 0x63e9,
-	/* Node for range 0x2f95_ */
-	0x63f1, 0x63f9, 0x6401, 0x6409, 0x6411, 0x6419, 0x6421, 0x6429,
-	0x6431, 0x6439, 0x6441, 0x6449, 0x6451, 0x6459, 0x6461, 0x6469,
-	/* Node for range 0x2f96_ */
-	0x6471, 0x6479, 0x6481, 0x6489, 0x6491, 0x6499, 0x64a1, 0x64a9,
-	0x64b1, 0x64b9, 0x64c1, 0x64c9, 0x64d1, 0x64d9, 0x64e1, 0x64e9,
-	/* Node for range 0x2f97_ */
-	0x64f1, 0x64f9, 0x6501, 0x6509, 0x6511, 0x6519, 0x6521, 0x6529,
-	0x6531, 0x6539, 0x6541, 0x6549, 0x6551, 0x6559, 0x6561, 0x6569,
-	/* Node for range 0x2f98_ */
-	0x6571, 0x6579, 0x6581, 0x6589, 0x6591, 0x6599, 0x65a1, 0x65a9,
-	0x65b1, 0x65b9, 0x65c1, 0x65c9, 0x65d1, 0x65d9, 0x65e1, 0x65e9,
-	/* Node for range 0x2f99_ */
-	0x65f1, 0x65f9, 0x6601, 0x6609, 0x6611, 0x6619, 0x6621, 0x6629,
-	0x6631, 0x6639, 0x6641, 0x6649, 0x6651, 0x6659, 0x6661, 0x6669,
-	/* Node for range 0x2f9a_ */
-	0x6671, 0x6679, 0x6681, 0x6689, 0x6691, 0x6699, 0x66a1, 0x66a9,
-	0x66b1, 0x66b9, 0x66c1, 0x66c9, 0x66d1, 0x66d9, 0x66e1, 0x66e9,
-	/* Node for range 0x2f9b_ */
-	0x66f1, 0x66f9, 0x6701, 0x6709, 0x6711, 0x6719, 0x6721, 0x6729,
-	0x6731, 0x6739, 0x6741, 0x6749, 0x6751, 0x6759, 0x6761, 0x6769,
-	/* Node for range 0x2f9c_ */
-	0x6771, 0x6779, 0x6781, 0x6789, 0x6791, 0x6799, 0x67a1, 0x67a9,
-	0x67b1, 0x67b9, 0x67c1, 0x67c9, 0x67d1, 0x67d9, 0x67e1, 0x67e9,
-	/* Node for range 0x2f9d_ */
-	0x67f1, 0x67f9, 0x6801, 0x6809, 0x6811, 0x6819, 0x6821, 0x6829,
-	0x6831, 0x6839, 0x6841, 0x6849, 0x6851, 0x6859, 0x6861, 0x6869,
-	/* Node for range 0x2f9e_ */
-	0x6871, 0x6879, 0x6881, 0x6889, 0x6891, 0x6899, 0x68a1, 0x68a9,
-	0x68b1, 0x68b9, 0x68c1, 0x68c9, 0x68d1, 0x68d9, 0x68e1, 0x68e9,
-	/* Node for range 0x2f9f_ */
-	0x68f1, 0x68f9, 0x6901, 0x6909, 0x6911, 0x6919, 0x6921, 0x6929,
-	0x6931, 0x6939, 0x6941, 0x6949, 0x6951, 0x6959, 0x6961, 0x6969,
-	/* Node for range 0x2fa0_ */
-	0x6971, 0x6979, 0x6981, 0x6989, 0x6991, 0x6999, 0x69a1, 0x69a9,
-	0x69b1, 0x69b9, 0x69c1, 0x69c9, 0x69d1, 0x69d9, 0x69e1, 0x69e9,
-	/* Node for range 0x2fa1_ */
-	0x69f1, 0x69f9, 0x6a01, 0x6a09, 0x6a11, 0x6a19, 0x6a21, 0x6a29,
-	0x6a31, 0x6a39, 0x6a41, 0x6a49, 0x6a51, 0x6a59, 0x0000, 0x0000,
+static const u8 apfs_uni_index[APFS_UNI_INDEX_SIZE] = {
+	/* Blocks for range 0x00000-0x00fff */
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+	0x08, 0x09, 0x00, 0x00, 0x0a, 0x0b, 0x0c, 0x0d,
+	0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+	0x16, 0x17, 0x00, 0x18, 0x19, 0x1a, 0x00, 0x1b,
+	0x1c, 0x1d, 0x00, 0x1e, 0x1f, 0x20, 0x21, 0x22,
+	0x23, 0x24, 0x21, 0x25, 0x21, 0x26, 0x27, 0x28,
+	0x00, 0x29, 0x21, 0x2a, 0x00, 0x2b, 0x00, 0x2c,
+	0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0x34,
+	/* Blocks for range 0x01000-0x01fff */
+	0x35, 0x00, 0x36, 0x37, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x39,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x3b,
+	0x00, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x00, 0x00,
+	0x3e, 0x3f, 0x40, 0x00, 0x41, 0x42, 0x43, 0x44,
+	0x45, 0x00, 0x46, 0x47, 0x00, 0x00, 0x00, 0x48,
+	0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+	/* Blocks for range 0x02000-0x02fff */
+	0x51, 0x00, 0x00, 0x52, 0x53, 0x54, 0x55, 0x56,
+	0x57, 0x58, 0x59, 0x5a, 0x5b, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x5c, 0x5d, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x00,
+	0x5f, 0x60, 0x61, 0x62, 0x00, 0x63, 0x00, 0x64,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x03000-0x03fff */
+	0x65, 0x66, 0x67, 0x68, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x04000-0x04fff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x05000-0x05fff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x06000-0x06fff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x07000-0x07fff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x08000-0x08fff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x09000-0x09fff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x0a000-0x0afff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x00,
+	0x6f, 0x00, 0x00, 0x70, 0x71, 0x72, 0x73, 0x74,
+	0x00, 0x00, 0x75, 0x76, 0x00, 0x77, 0x78, 0x79,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x0b000-0x0bfff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x0c000-0x0cfff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x0d000-0x0dfff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x0e000-0x0efff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x0f000-0x0ffff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x7a, 0x7b, 0x7c, 0x7d,
+	0x7e, 0x7f, 0x80, 0x81, 0x82, 0x83, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x84, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x10000-0x10fff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86,
+	0x00, 0x00, 0x00, 0x87, 0x00, 0x88, 0x00, 0x00,
+	0x89, 0x00, 0x8a, 0x8b, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x8c, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x11000-0x11fff */
+	0x00, 0x8f, 0x90, 0x00, 0x91, 0x73, 0x00, 0x92,
+	0x93, 0x00, 0x00, 0x94, 0x21, 0x95, 0x00, 0x00,
+	0x00, 0x96, 0x97, 0x98, 0x00, 0x00, 0x99, 0x9a,
+	0x63, 0x00, 0x9b, 0x00, 0x9c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x12000-0x12fff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x13000-0x13fff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x14000-0x14fff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x15000-0x15fff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x16000-0x16fff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x9e, 0x9f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x17000-0x17fff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x18000-0x18fff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x19000-0x19fff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x1a000-0x1afff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x1b000-0x1bfff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x1c000-0x1cfff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x1d000-0x1dfff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xa2, 0xa3,
+	0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x1e000-0x1efff */
+	0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xa6, 0xa7, 0xa8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x1f000-0x1ffff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x20000-0x20fff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x21000-0x21fff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x22000-0x22fff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x23000-0x23fff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x24000-0x24fff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x25000-0x25fff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x26000-0x26fff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x27000-0x27fff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x28000-0x28fff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x29000-0x29fff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x2a000-0x2afff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x2b000-0x2bfff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x2c000-0x2cfff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x2d000-0x2dfff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x2e000-0x2efff */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Blocks for range 0x2f000-0x2fa3f */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf, 0xb0,
+	0xb1,
+};
+
+static const struct apfs_uni_props apfs_uni_pages[][APFS_UNI_BLOCK_SIZE] = {
+	/* Page 0x00, first used for range 0x00000-0x0003f */
+	{
+		/* All zeroes */
+	},
+	/* Page 0x01, first used for range 0x00040-0x0007f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0001,   0 },
+		{ 0x0000, 0x0009,   0 }, { 0x0000, 0x0011,   0 },
+		{ 0x0000, 0x0019,   0 }, { 0x0000, 0x0021,   0 },
+		{ 0x0000, 0x0029,   0 }, { 0x0000, 0x0031,   0 },
+		{ 0x0000, 0x0039,   0 }, { 0x0000, 0x0041,   0 },
+		{ 0x0000, 0x0049,   0 }, { 0x0000, 0x0051,   0 },
+		{ 0x0000, 0x0059,   0 }, { 0x0000, 0x0061,   0 },
+		{ 0x0000, 0x0069,   0 }, { 0x0000, 0x0071,   0 },
+		{ 0x0000, 0x0079,   0 }, { 0x0000, 0x0081,   0 },
+		{ 0x0000, 0x0089,   0 }, { 0x0000, 0x0091,   0 },
+		{ 0x0000, 0x0099,   0 }, { 0x0000, 0x00a1,   0 },
+		{ 0x0000, 0x00a9,   0 }, { 0x0000, 0x00b1,   0 },
+		{ 0x0000, 0x00b9,   0 }, { 0x0000, 0x00c1,   0 },
+		{ 0x0000, 0x00c9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x02, first used for range 0x00080-0x000bf */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x00d1,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x03, first used for range 0x000c0-0x000ff */
+	{
+		{ 0x0002, 0x00d9,   0 }, { 0x0012, 0x00e1,   0 },
+		{ 0x0022, 0x00e9,   0 }, { 0x0032, 0x00f1,   0 },
+		{ 0x0042, 0x00f9,   0 }, { 0x0052, 0x0101,   0 },
+		{ 0x0000, 0x0109,   0 }, { 0x0062, 0x0111,   0 },
+		{ 0x0072, 0x0119,   0 }, { 0x0082, 0x0121,   0 },
+		{ 0x0092, 0x0129,   0 }, { 0x00a2, 0x0131,   0 },
+		{ 0x00b2, 0x0139,   0 }, { 0x00c2, 0x0141,   0 },
+		{ 0x00d2, 0x0149,   0 }, { 0x00e2, 0x0151,   0 },
+		{ 0x0000, 0x0159,   0 }, { 0x00f2, 0x0161,   0 },
+		{ 0x0102, 0x0169,   0 }, { 0x0112, 0x0171,   0 },
+		{ 0x0122, 0x0179,   0 }, { 0x0132, 0x0181,   0 },
+		{ 0x0142, 0x0189,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0191,   0 }, { 0x0152, 0x0199,   0 },
+		{ 0x0162, 0x01a1,   0 }, { 0x0172, 0x01a9,   0 },
+		{ 0x0182, 0x01b1,   0 }, { 0x0192, 0x01b9,   0 },
+		{ 0x0000, 0x01c1,   0 }, { 0x0000, 0x01ca,   0 },
+		{ 0x01a2, 0x0000,   0 }, { 0x01b2, 0x0000,   0 },
+		{ 0x01c2, 0x0000,   0 }, { 0x01d2, 0x0000,   0 },
+		{ 0x01e2, 0x0000,   0 }, { 0x01f2, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0202, 0x0000,   0 },
+		{ 0x0212, 0x0000,   0 }, { 0x0222, 0x0000,   0 },
+		{ 0x0232, 0x0000,   0 }, { 0x0242, 0x0000,   0 },
+		{ 0x0252, 0x0000,   0 }, { 0x0262, 0x0000,   0 },
+		{ 0x0272, 0x0000,   0 }, { 0x0282, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0292, 0x0000,   0 },
+		{ 0x02a2, 0x0000,   0 }, { 0x02b2, 0x0000,   0 },
+		{ 0x02c2, 0x0000,   0 }, { 0x02d2, 0x0000,   0 },
+		{ 0x02e2, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x02f2, 0x0000,   0 },
+		{ 0x0302, 0x0000,   0 }, { 0x0312, 0x0000,   0 },
+		{ 0x0322, 0x0000,   0 }, { 0x0332, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0342, 0x0000,   0 },
+	},
+	/* Page 0x04, first used for range 0x00100-0x0013f */
+	{
+		{ 0x0352, 0x01d9,   0 }, { 0x0362, 0x0000,   0 },
+		{ 0x0372, 0x01e1,   0 }, { 0x0382, 0x0000,   0 },
+		{ 0x0392, 0x01e9,   0 }, { 0x03a2, 0x0000,   0 },
+		{ 0x03b2, 0x01f1,   0 }, { 0x03c2, 0x0000,   0 },
+		{ 0x03d2, 0x01f9,   0 }, { 0x03e2, 0x0000,   0 },
+		{ 0x03f2, 0x0201,   0 }, { 0x0402, 0x0000,   0 },
+		{ 0x0412, 0x0209,   0 }, { 0x0422, 0x0000,   0 },
+		{ 0x0432, 0x0211,   0 }, { 0x0442, 0x0000,   0 },
+		{ 0x0000, 0x0219,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0452, 0x0221,   0 }, { 0x0462, 0x0000,   0 },
+		{ 0x0472, 0x0229,   0 }, { 0x0482, 0x0000,   0 },
+		{ 0x0492, 0x0231,   0 }, { 0x04a2, 0x0000,   0 },
+		{ 0x04b2, 0x0239,   0 }, { 0x04c2, 0x0000,   0 },
+		{ 0x04d2, 0x0241,   0 }, { 0x04e2, 0x0000,   0 },
+		{ 0x04f2, 0x0249,   0 }, { 0x0502, 0x0000,   0 },
+		{ 0x0512, 0x0251,   0 }, { 0x0522, 0x0000,   0 },
+		{ 0x0532, 0x0259,   0 }, { 0x0542, 0x0000,   0 },
+		{ 0x0552, 0x0261,   0 }, { 0x0562, 0x0000,   0 },
+		{ 0x0572, 0x0269,   0 }, { 0x0582, 0x0000,   0 },
+		{ 0x0000, 0x0271,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0592, 0x0279,   0 }, { 0x05a2, 0x0000,   0 },
+		{ 0x05b2, 0x0281,   0 }, { 0x05c2, 0x0000,   0 },
+		{ 0x05d2, 0x0289,   0 }, { 0x05e2, 0x0000,   0 },
+		{ 0x05f2, 0x0291,   0 }, { 0x0602, 0x0000,   0 },
+		{ 0x0612, 0x029a,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x02a9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0622, 0x02b1,   0 }, { 0x0632, 0x0000,   0 },
+		{ 0x0642, 0x02b9,   0 }, { 0x0652, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0662, 0x02c1,   0 },
+		{ 0x0672, 0x0000,   0 }, { 0x0682, 0x02c9,   0 },
+		{ 0x0692, 0x0000,   0 }, { 0x06a2, 0x02d1,   0 },
+		{ 0x06b2, 0x0000,   0 }, { 0x0000, 0x02d9,   0 },
+	},
+	/* Page 0x05, first used for range 0x00140-0x0017f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x02e1,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x06c2, 0x02e9,   0 },
+		{ 0x06d2, 0x0000,   0 }, { 0x06e2, 0x02f1,   0 },
+		{ 0x06f2, 0x0000,   0 }, { 0x0702, 0x02f9,   0 },
+		{ 0x0712, 0x0000,   0 }, { 0x0000, 0x0302,   0 },
+		{ 0x0000, 0x0311,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0722, 0x0319,   0 }, { 0x0732, 0x0000,   0 },
+		{ 0x0742, 0x0321,   0 }, { 0x0752, 0x0000,   0 },
+		{ 0x0762, 0x0329,   0 }, { 0x0772, 0x0000,   0 },
+		{ 0x0000, 0x0331,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0782, 0x0339,   0 }, { 0x0792, 0x0000,   0 },
+		{ 0x07a2, 0x0341,   0 }, { 0x07b2, 0x0000,   0 },
+		{ 0x07c2, 0x0349,   0 }, { 0x07d2, 0x0000,   0 },
+		{ 0x07e2, 0x0351,   0 }, { 0x07f2, 0x0000,   0 },
+		{ 0x0802, 0x0359,   0 }, { 0x0812, 0x0000,   0 },
+		{ 0x0822, 0x0361,   0 }, { 0x0832, 0x0000,   0 },
+		{ 0x0842, 0x0369,   0 }, { 0x0852, 0x0000,   0 },
+		{ 0x0862, 0x0371,   0 }, { 0x0872, 0x0000,   0 },
+		{ 0x0882, 0x0379,   0 }, { 0x0892, 0x0000,   0 },
+		{ 0x0000, 0x0381,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x08a2, 0x0389,   0 }, { 0x08b2, 0x0000,   0 },
+		{ 0x08c2, 0x0391,   0 }, { 0x08d2, 0x0000,   0 },
+		{ 0x08e2, 0x0399,   0 }, { 0x08f2, 0x0000,   0 },
+		{ 0x0902, 0x03a1,   0 }, { 0x0912, 0x0000,   0 },
+		{ 0x0922, 0x03a9,   0 }, { 0x0932, 0x0000,   0 },
+		{ 0x0942, 0x03b1,   0 }, { 0x0952, 0x0000,   0 },
+		{ 0x0962, 0x03b9,   0 }, { 0x0972, 0x0000,   0 },
+		{ 0x0982, 0x03c1,   0 }, { 0x0992, 0x0000,   0 },
+		{ 0x09a2, 0x03c9,   0 }, { 0x09b2, 0x03d1,   0 },
+		{ 0x09c2, 0x0000,   0 }, { 0x09d2, 0x03d9,   0 },
+		{ 0x09e2, 0x0000,   0 }, { 0x09f2, 0x03e1,   0 },
+		{ 0x0a02, 0x0000,   0 }, { 0x0000, 0x03e9,   0 },
+	},
+	/* Page 0x06, first used for range 0x00180-0x001bf */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x03f1,   0 },
+		{ 0x0000, 0x03f9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0401,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0409,   0 }, { 0x0000, 0x0411,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0419,   0 },
+		{ 0x0000, 0x0421,   0 }, { 0x0000, 0x0429,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0431,   0 }, { 0x0000, 0x0439,   0 },
+		{ 0x0000, 0x0441,   0 }, { 0x0000, 0x0449,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0451,   0 },
+		{ 0x0000, 0x0459,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0461,   0 }, { 0x0000, 0x0469,   0 },
+		{ 0x0000, 0x0471,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0479,   0 }, { 0x0000, 0x0481,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0489,   0 },
+		{ 0x0a12, 0x0491,   0 }, { 0x0a22, 0x0000,   0 },
+		{ 0x0000, 0x0499,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x04a1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x04a9,   0 }, { 0x0000, 0x04b1,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x04b9,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x04c1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x04c9,   0 }, { 0x0a32, 0x04d1,   0 },
+		{ 0x0a42, 0x0000,   0 }, { 0x0000, 0x04d9,   0 },
+		{ 0x0000, 0x04e1,   0 }, { 0x0000, 0x04e9,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x04f1,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x04f9,   0 },
+		{ 0x0000, 0x0501,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0509,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x07, first used for range 0x001c0-0x001ff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0511,   0 }, { 0x0000, 0x0519,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0521,   0 },
+		{ 0x0000, 0x0529,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0531,   0 }, { 0x0000, 0x0539,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0a52, 0x0541,   0 },
+		{ 0x0a62, 0x0000,   0 }, { 0x0a72, 0x0549,   0 },
+		{ 0x0a82, 0x0000,   0 }, { 0x0a92, 0x0551,   0 },
+		{ 0x0aa2, 0x0000,   0 }, { 0x0ab2, 0x0559,   0 },
+		{ 0x0ac2, 0x0000,   0 }, { 0x0ad3, 0x0561,   0 },
+		{ 0x0aeb, 0x0000,   0 }, { 0x0b03, 0x0569,   0 },
+		{ 0x0b1b, 0x0000,   0 }, { 0x0b33, 0x0571,   0 },
+		{ 0x0b4b, 0x0000,   0 }, { 0x0b63, 0x0579,   0 },
+		{ 0x0b7b, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0b93, 0x0581,   0 }, { 0x0bab, 0x0000,   0 },
+		{ 0x0bc3, 0x0589,   0 }, { 0x0bdb, 0x0000,   0 },
+		{ 0x0bf2, 0x0591,   0 }, { 0x0c02, 0x0000,   0 },
+		{ 0x0000, 0x0599,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0c12, 0x05a1,   0 }, { 0x0c22, 0x0000,   0 },
+		{ 0x0c32, 0x05a9,   0 }, { 0x0c42, 0x0000,   0 },
+		{ 0x0c52, 0x05b1,   0 }, { 0x0c62, 0x0000,   0 },
+		{ 0x0c73, 0x05b9,   0 }, { 0x0c8b, 0x0000,   0 },
+		{ 0x0ca2, 0x05c1,   0 }, { 0x0cb2, 0x0000,   0 },
+		{ 0x0cc2, 0x05ca,   0 }, { 0x0000, 0x05d9,   0 },
+		{ 0x0000, 0x05e1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0cd2, 0x05e9,   0 }, { 0x0ce2, 0x0000,   0 },
+		{ 0x0000, 0x05f1,   0 }, { 0x0000, 0x05f9,   0 },
+		{ 0x0cf2, 0x0601,   0 }, { 0x0d02, 0x0000,   0 },
+		{ 0x0d13, 0x0609,   0 }, { 0x0d2b, 0x0000,   0 },
+		{ 0x0d42, 0x0611,   0 }, { 0x0d52, 0x0000,   0 },
+		{ 0x0d62, 0x0619,   0 }, { 0x0d72, 0x0000,   0 },
+	},
+	/* Page 0x08, first used for range 0x00200-0x0023f */
+	{
+		{ 0x0d82, 0x0621,   0 }, { 0x0d92, 0x0000,   0 },
+		{ 0x0da2, 0x0629,   0 }, { 0x0db2, 0x0000,   0 },
+		{ 0x0dc2, 0x0631,   0 }, { 0x0dd2, 0x0000,   0 },
+		{ 0x0de2, 0x0639,   0 }, { 0x0df2, 0x0000,   0 },
+		{ 0x0e02, 0x0641,   0 }, { 0x0e12, 0x0000,   0 },
+		{ 0x0e22, 0x0649,   0 }, { 0x0e32, 0x0000,   0 },
+		{ 0x0e42, 0x0651,   0 }, { 0x0e52, 0x0000,   0 },
+		{ 0x0e62, 0x0659,   0 }, { 0x0e72, 0x0000,   0 },
+		{ 0x0e82, 0x0661,   0 }, { 0x0e92, 0x0000,   0 },
+		{ 0x0ea2, 0x0669,   0 }, { 0x0eb2, 0x0000,   0 },
+		{ 0x0ec2, 0x0671,   0 }, { 0x0ed2, 0x0000,   0 },
+		{ 0x0ee2, 0x0679,   0 }, { 0x0ef2, 0x0000,   0 },
+		{ 0x0f02, 0x0681,   0 }, { 0x0f12, 0x0000,   0 },
+		{ 0x0f22, 0x0689,   0 }, { 0x0f32, 0x0000,   0 },
+		{ 0x0000, 0x0691,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0f42, 0x0699,   0 }, { 0x0f52, 0x0000,   0 },
+		{ 0x0000, 0x06a1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x06a9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x06b1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0f62, 0x06b9,   0 }, { 0x0f72, 0x0000,   0 },
+		{ 0x0f82, 0x06c1,   0 }, { 0x0f92, 0x0000,   0 },
+		{ 0x0fa3, 0x06c9,   0 }, { 0x0fbb, 0x0000,   0 },
+		{ 0x0fd3, 0x06d1,   0 }, { 0x0feb, 0x0000,   0 },
+		{ 0x1002, 0x06d9,   0 }, { 0x1012, 0x0000,   0 },
+		{ 0x1023, 0x06e1,   0 }, { 0x103b, 0x0000,   0 },
+		{ 0x1052, 0x06e9,   0 }, { 0x1062, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x06f1,   0 }, { 0x0000, 0x06f9,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0701,   0 },
+		{ 0x0000, 0x0709,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x09, first used for range 0x00240-0x0027f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0711,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0719,   0 },
+		{ 0x0000, 0x0721,   0 }, { 0x0000, 0x0729,   0 },
+		{ 0x0000, 0x0731,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0739,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0741,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0749,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0751,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x0a, first used for range 0x00300-0x0033f */
+	{
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 232 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 232 }, { 0x0000, 0x0000, 216 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 202 },
+		{ 0x0000, 0x0000, 202 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 202 },
+		{ 0x0000, 0x0000, 202 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000,   1 }, { 0x0000, 0x0000,   1 },
+		{ 0x0000, 0x0000,   1 }, { 0x0000, 0x0000,   1 },
+		{ 0x0000, 0x0000,   1 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+	},
+	/* Page 0x0b, first used for range 0x00340-0x0037f */
+	{
+		{ 0x1071, 0x0000, 230 }, { 0x1079, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x1081, 0x0000, 230 },
+		{ 0x108a, 0x0000, 230 }, { 0x0000, 0x0759, 240 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 232 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 233 }, { 0x0000, 0x0000, 234 },
+		{ 0x0000, 0x0000, 234 }, { 0x0000, 0x0000, 233 },
+		{ 0x0000, 0x0000, 234 }, { 0x0000, 0x0000, 234 },
+		{ 0x0000, 0x0000, 233 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0761,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0769,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x1099, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0771,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x10a1, 0x0000,   0 }, { 0x0000, 0x0779,   0 },
+	},
+	/* Page 0x0c, first used for range 0x00380-0x003bf */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x10aa, 0x0000,   0 },
+		{ 0x10ba, 0x0781,   0 }, { 0x10c9, 0x0000,   0 },
+		{ 0x10d2, 0x0789,   0 }, { 0x10e2, 0x0791,   0 },
+		{ 0x10f2, 0x0799,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x1102, 0x07a1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x1112, 0x07a9,   0 }, { 0x1122, 0x07b1,   0 },
+		{ 0x1133, 0x07bb,   0 }, { 0x0000, 0x07d1,   0 },
+		{ 0x0000, 0x07d9,   0 }, { 0x0000, 0x07e1,   0 },
+		{ 0x0000, 0x07e9,   0 }, { 0x0000, 0x07f1,   0 },
+		{ 0x0000, 0x07f9,   0 }, { 0x0000, 0x0801,   0 },
+		{ 0x0000, 0x0809,   0 }, { 0x0000, 0x0811,   0 },
+		{ 0x0000, 0x0819,   0 }, { 0x0000, 0x0821,   0 },
+		{ 0x0000, 0x0829,   0 }, { 0x0000, 0x0831,   0 },
+		{ 0x0000, 0x0839,   0 }, { 0x0000, 0x0841,   0 },
+		{ 0x0000, 0x0849,   0 }, { 0x0000, 0x0851,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0859,   0 },
+		{ 0x0000, 0x0861,   0 }, { 0x0000, 0x0869,   0 },
+		{ 0x0000, 0x0871,   0 }, { 0x0000, 0x0879,   0 },
+		{ 0x0000, 0x0881,   0 }, { 0x0000, 0x0889,   0 },
+		{ 0x114a, 0x0891,   0 }, { 0x115a, 0x0899,   0 },
+		{ 0x116a, 0x0000,   0 }, { 0x117a, 0x0000,   0 },
+		{ 0x118a, 0x0000,   0 }, { 0x119a, 0x0000,   0 },
+		{ 0x11ab, 0x08a3,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x0d, first used for range 0x003c0-0x003ff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x08b9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x11c2, 0x0000,   0 }, { 0x11d2, 0x0000,   0 },
+		{ 0x11e2, 0x0000,   0 }, { 0x11f2, 0x0000,   0 },
+		{ 0x1202, 0x0000,   0 }, { 0x0000, 0x08c1,   0 },
+		{ 0x0000, 0x08c9,   0 }, { 0x0000, 0x08d1,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x1212, 0x0000,   0 },
+		{ 0x1222, 0x0000,   0 }, { 0x0000, 0x08d9,   0 },
+		{ 0x0000, 0x08e1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x08e9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x08f1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x08f9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0901,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0909,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0911,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0919,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0921,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0929,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0931,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0939,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0941,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0949,   0 }, { 0x0000, 0x0951,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0959,   0 }, { 0x0000, 0x0961,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0969,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0971,   0 },
+		{ 0x0000, 0x0979,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0981,   0 },
+		{ 0x0000, 0x0989,   0 }, { 0x0000, 0x0991,   0 },
+	},
+	/* Page 0x0e, first used for range 0x00400-0x0043f */
+	{
+		{ 0x1232, 0x0999,   0 }, { 0x1242, 0x09a1,   0 },
+		{ 0x0000, 0x09a9,   0 }, { 0x1252, 0x09b1,   0 },
+		{ 0x0000, 0x09b9,   0 }, { 0x0000, 0x09c1,   0 },
+		{ 0x0000, 0x09c9,   0 }, { 0x1262, 0x09d1,   0 },
+		{ 0x0000, 0x09d9,   0 }, { 0x0000, 0x09e1,   0 },
+		{ 0x0000, 0x09e9,   0 }, { 0x0000, 0x09f1,   0 },
+		{ 0x1272, 0x09f9,   0 }, { 0x1282, 0x0a01,   0 },
+		{ 0x1292, 0x0a09,   0 }, { 0x0000, 0x0a11,   0 },
+		{ 0x0000, 0x0a19,   0 }, { 0x0000, 0x0a21,   0 },
+		{ 0x0000, 0x0a29,   0 }, { 0x0000, 0x0a31,   0 },
+		{ 0x0000, 0x0a39,   0 }, { 0x0000, 0x0a41,   0 },
+		{ 0x0000, 0x0a49,   0 }, { 0x0000, 0x0a51,   0 },
+		{ 0x0000, 0x0a59,   0 }, { 0x12a2, 0x0a61,   0 },
+		{ 0x0000, 0x0a69,   0 }, { 0x0000, 0x0a71,   0 },
+		{ 0x0000, 0x0a79,   0 }, { 0x0000, 0x0a81,   0 },
+		{ 0x0000, 0x0a89,   0 }, { 0x0000, 0x0a91,   0 },
+		{ 0x0000, 0x0a99,   0 }, { 0x0000, 0x0aa1,   0 },
+		{ 0x0000, 0x0aa9,   0 }, { 0x0000, 0x0ab1,   0 },
+		{ 0x0000, 0x0ab9,   0 }, { 0x0000, 0x0ac1,   0 },
+		{ 0x0000, 0x0ac9,   0 }, { 0x0000, 0x0ad1,   0 },
+		{ 0x0000, 0x0ad9,   0 }, { 0x0000, 0x0ae1,   0 },
+		{ 0x0000, 0x0ae9,   0 }, { 0x0000, 0x0af1,   0 },
+		{ 0x0000, 0x0af9,   0 }, { 0x0000, 0x0b01,   0 },
+		{ 0x0000, 0x0b09,   0 }, { 0x0000, 0x0b11,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x12b2, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x0f, first used for range 0x00440-0x0047f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x12c2, 0x0000,   0 }, { 0x12d2, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x12e2, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x12f2, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x1302, 0x0000,   0 }, { 0x1312, 0x0000,   0 },
+		{ 0x1322, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0b19,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0b21,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0b29,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0b31,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0b39,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0b41,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0b49,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0b51,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0b59,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0b61,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0b69,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x1332, 0x0b71,   0 }, { 0x1342, 0x0000,   0 },
+		{ 0x0000, 0x0b79,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0b81,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0b89,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0b91,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x10, first used for range 0x00480-0x004bf */
+	{
+		{ 0x0000, 0x0b99,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0ba1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0ba9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0bb1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0bb9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0bc1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0bc9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0bd1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0bd9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0be1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0be9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0bf1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0bf9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0c01,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0c09,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0c11,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0c19,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0c21,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0c29,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0c31,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0c39,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0c41,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0c49,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0c51,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0c59,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0c61,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0c69,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0c71,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x11, first used for range 0x004c0-0x004ff */
+	{
+		{ 0x0000, 0x0c79,   0 }, { 0x1352, 0x0c81,   0 },
+		{ 0x1362, 0x0000,   0 }, { 0x0000, 0x0c89,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0c91,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0c99,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0ca1,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0ca9,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0cb1,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x1372, 0x0cb9,   0 }, { 0x1382, 0x0000,   0 },
+		{ 0x1392, 0x0cc1,   0 }, { 0x13a2, 0x0000,   0 },
+		{ 0x0000, 0x0cc9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x13b2, 0x0cd1,   0 }, { 0x13c2, 0x0000,   0 },
+		{ 0x0000, 0x0cd9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x13d2, 0x0ce1,   0 }, { 0x13e2, 0x0000,   0 },
+		{ 0x13f2, 0x0ce9,   0 }, { 0x1402, 0x0000,   0 },
+		{ 0x1412, 0x0cf1,   0 }, { 0x1422, 0x0000,   0 },
+		{ 0x0000, 0x0cf9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x1432, 0x0d01,   0 }, { 0x1442, 0x0000,   0 },
+		{ 0x1452, 0x0d09,   0 }, { 0x1462, 0x0000,   0 },
+		{ 0x1472, 0x0d11,   0 }, { 0x1482, 0x0000,   0 },
+		{ 0x0000, 0x0d19,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x1492, 0x0d21,   0 }, { 0x14a2, 0x0000,   0 },
+		{ 0x14b2, 0x0d29,   0 }, { 0x14c2, 0x0000,   0 },
+		{ 0x14d2, 0x0d31,   0 }, { 0x14e2, 0x0000,   0 },
+		{ 0x14f2, 0x0d39,   0 }, { 0x1502, 0x0000,   0 },
+		{ 0x1512, 0x0d41,   0 }, { 0x1522, 0x0000,   0 },
+		{ 0x1532, 0x0d49,   0 }, { 0x1542, 0x0000,   0 },
+		{ 0x0000, 0x0d51,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x1552, 0x0d59,   0 }, { 0x1562, 0x0000,   0 },
+		{ 0x0000, 0x0d61,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0d69,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0d71,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x12, first used for range 0x00500-0x0053f */
+	{
+		{ 0x0000, 0x0d79,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0d81,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0d89,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0d91,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0d99,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0da1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0da9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0db1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0db9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0dc1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0dc9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0dd1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0dd9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0de1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0de9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0df1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0df9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0e01,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0e09,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0e11,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0e19,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0e21,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0e29,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0e31,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0e39,   0 },
+		{ 0x0000, 0x0e41,   0 }, { 0x0000, 0x0e49,   0 },
+		{ 0x0000, 0x0e51,   0 }, { 0x0000, 0x0e59,   0 },
+		{ 0x0000, 0x0e61,   0 }, { 0x0000, 0x0e69,   0 },
+		{ 0x0000, 0x0e71,   0 }, { 0x0000, 0x0e79,   0 },
+		{ 0x0000, 0x0e81,   0 }, { 0x0000, 0x0e89,   0 },
+		{ 0x0000, 0x0e91,   0 }, { 0x0000, 0x0e99,   0 },
+		{ 0x0000, 0x0ea1,   0 }, { 0x0000, 0x0ea9,   0 },
+	},
+	/* Page 0x13, first used for range 0x00540-0x0057f */
+	{
+		{ 0x0000, 0x0eb1,   0 }, { 0x0000, 0x0eb9,   0 },
+		{ 0x0000, 0x0ec1,   0 }, { 0x0000, 0x0ec9,   0 },
+		{ 0x0000, 0x0ed1,   0 }, { 0x0000, 0x0ed9,   0 },
+		{ 0x0000, 0x0ee1,   0 }, { 0x0000, 0x0ee9,   0 },
+		{ 0x0000, 0x0ef1,   0 }, { 0x0000, 0x0ef9,   0 },
+		{ 0x0000, 0x0f01,   0 }, { 0x0000, 0x0f09,   0 },
+		{ 0x0000, 0x0f11,   0 }, { 0x0000, 0x0f19,   0 },
+		{ 0x0000, 0x0f21,   0 }, { 0x0000, 0x0f29,   0 },
+		{ 0x0000, 0x0f31,   0 }, { 0x0000, 0x0f39,   0 },
+		{ 0x0000, 0x0f41,   0 }, { 0x0000, 0x0f49,   0 },
+		{ 0x0000, 0x0f51,   0 }, { 0x0000, 0x0f59,   0 },
+		{ 0x0000, 0x0f61,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x14, first used for range 0x00580-0x005bf */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0f6a,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 222 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 222 },
+		{ 0x0000, 0x0000, 228 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,  10 }, { 0x0000, 0x0000,  11 },
+		{ 0x0000, 0x0000,  12 }, { 0x0000, 0x0000,  13 },
+		{ 0x0000, 0x0000,  14 }, { 0x0000, 0x0000,  15 },
+		{ 0x0000, 0x0000,  16 }, { 0x0000, 0x0000,  17 },
+		{ 0x0000, 0x0000,  18 }, { 0x0000, 0x0000,  19 },
+		{ 0x0000, 0x0000,  19 }, { 0x0000, 0x0000,  20 },
+		{ 0x0000, 0x0000,  21 }, { 0x0000, 0x0000,  22 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,  23 },
+	},
+	/* Page 0x15, first used for range 0x005c0-0x005ff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,  24 },
+		{ 0x0000, 0x0000,  25 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,  18 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x16, first used for range 0x00600-0x0063f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,  30 }, { 0x0000, 0x0000,  31 },
+		{ 0x0000, 0x0000,  32 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x1572, 0x0000,   0 }, { 0x1582, 0x0000,   0 },
+		{ 0x1592, 0x0000,   0 }, { 0x15a2, 0x0000,   0 },
+		{ 0x15b2, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x17, first used for range 0x00640-0x0067f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,  27 },
+		{ 0x0000, 0x0000,  28 }, { 0x0000, 0x0000,  29 },
+		{ 0x0000, 0x0000,  30 }, { 0x0000, 0x0000,  31 },
+		{ 0x0000, 0x0000,  32 }, { 0x0000, 0x0000,  33 },
+		{ 0x0000, 0x0000,  34 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,  35 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x18, first used for range 0x006c0-0x006ff */
+	{
+		{ 0x15c2, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x15d2, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x15e2, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x19, first used for range 0x00700-0x0073f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,  36 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 230 },
+	},
+	/* Page 0x1a, first used for range 0x00740-0x0077f */
+	{
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x1b, first used for range 0x007c0-0x007ff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x1c, first used for range 0x00800-0x0083f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x1d, first used for range 0x00840-0x0087f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x1e, first used for range 0x008c0-0x008ff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000,  27 }, { 0x0000, 0x0000,  28 },
+		{ 0x0000, 0x0000,  29 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+	},
+	/* Page 0x1f, first used for range 0x00900-0x0093f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x15f2, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x1602, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x1612, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   7 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x20, first used for range 0x00940-0x0097f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   9 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x1622, 0x0000,   0 }, { 0x1632, 0x0000,   0 },
+		{ 0x1642, 0x0000,   0 }, { 0x1652, 0x0000,   0 },
+		{ 0x1662, 0x0000,   0 }, { 0x1672, 0x0000,   0 },
+		{ 0x1682, 0x0000,   0 }, { 0x1692, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x21, first used for range 0x00980-0x009bf */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   7 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x22, first used for range 0x009c0-0x009ff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x16a2, 0x0000,   0 },
+		{ 0x16b2, 0x0000,   0 }, { 0x0000, 0x0000,   9 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x16c2, 0x0000,   0 }, { 0x16d2, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x16e2, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x23, first used for range 0x00a00-0x00a3f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x16f2, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x1702, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   7 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x24, first used for range 0x00a40-0x00a7f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   9 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x1712, 0x0000,   0 },
+		{ 0x1722, 0x0000,   0 }, { 0x1732, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x1742, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x25, first used for range 0x00ac0-0x00aff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   9 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x26, first used for range 0x00b40-0x00b7f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x1752, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x1762, 0x0000,   0 },
+		{ 0x1772, 0x0000,   0 }, { 0x0000, 0x0000,   9 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x1782, 0x0000,   0 }, { 0x1792, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x27, first used for range 0x00b80-0x00bbf */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x17a2, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x28, first used for range 0x00bc0-0x00bff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x17b2, 0x0000,   0 }, { 0x17c2, 0x0000,   0 },
+		{ 0x17d2, 0x0000,   0 }, { 0x0000, 0x0000,   9 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x29, first used for range 0x00c40-0x00c7f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x17e2, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   9 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,  84 },
+		{ 0x0000, 0x0000,  91 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x2a, first used for range 0x00cc0-0x00cff */
+	{
+		{ 0x17f2, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x1802, 0x0000,   0 },
+		{ 0x1812, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x1822, 0x0000,   0 }, { 0x1833, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   9 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x2b, first used for range 0x00d40-0x00d7f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x184a, 0x0000,   0 }, { 0x185a, 0x0000,   0 },
+		{ 0x186a, 0x0000,   0 }, { 0x0000, 0x0000,   9 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x2c, first used for range 0x00dc0-0x00dff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   9 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x187a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x188a, 0x0000,   0 }, { 0x189b, 0x0000,   0 },
+		{ 0x18b2, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x2d, first used for range 0x00e00-0x00e3f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 103 }, { 0x0000, 0x0000, 103 },
+		{ 0x0000, 0x0000,   9 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x2e, first used for range 0x00e40-0x00e7f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 107 }, { 0x0000, 0x0000, 107 },
+		{ 0x0000, 0x0000, 107 }, { 0x0000, 0x0000, 107 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x2f, first used for range 0x00e80-0x00ebf */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 118 }, { 0x0000, 0x0000, 118 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x30, first used for range 0x00ec0-0x00eff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 122 }, { 0x0000, 0x0000, 122 },
+		{ 0x0000, 0x0000, 122 }, { 0x0000, 0x0000, 122 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x31, first used for range 0x00f00-0x00f3f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 216 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x32, first used for range 0x00f40-0x00f7f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x18c2, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x18d2, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x18e2, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x18f2, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x1902, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x1912, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 129 },
+		{ 0x0000, 0x0000, 130 }, { 0x1922, 0x0000,   0 },
+		{ 0x0000, 0x0000, 132 }, { 0x1932, 0x0000,   0 },
+		{ 0x1942, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x1952, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 130 }, { 0x0000, 0x0000, 130 },
+		{ 0x0000, 0x0000, 130 }, { 0x0000, 0x0000, 130 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x33, first used for range 0x00f80-0x00fbf */
+	{
+		{ 0x0000, 0x0000, 130 }, { 0x1962, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   9 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x1972, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x1982, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x1992, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x19a2, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x19b2, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x19c2, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x34, first used for range 0x00fc0-0x00fff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x35, first used for range 0x01000-0x0103f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x19d2, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   7 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   9 },
+		{ 0x0000, 0x0000,   9 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x36, first used for range 0x01080-0x010bf */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0f79,   0 }, { 0x0000, 0x0f81,   0 },
+		{ 0x0000, 0x0f89,   0 }, { 0x0000, 0x0f91,   0 },
+		{ 0x0000, 0x0f99,   0 }, { 0x0000, 0x0fa1,   0 },
+		{ 0x0000, 0x0fa9,   0 }, { 0x0000, 0x0fb1,   0 },
+		{ 0x0000, 0x0fb9,   0 }, { 0x0000, 0x0fc1,   0 },
+		{ 0x0000, 0x0fc9,   0 }, { 0x0000, 0x0fd1,   0 },
+		{ 0x0000, 0x0fd9,   0 }, { 0x0000, 0x0fe1,   0 },
+		{ 0x0000, 0x0fe9,   0 }, { 0x0000, 0x0ff1,   0 },
+		{ 0x0000, 0x0ff9,   0 }, { 0x0000, 0x1001,   0 },
+		{ 0x0000, 0x1009,   0 }, { 0x0000, 0x1011,   0 },
+		{ 0x0000, 0x1019,   0 }, { 0x0000, 0x1021,   0 },
+		{ 0x0000, 0x1029,   0 }, { 0x0000, 0x1031,   0 },
+		{ 0x0000, 0x1039,   0 }, { 0x0000, 0x1041,   0 },
+		{ 0x0000, 0x1049,   0 }, { 0x0000, 0x1051,   0 },
+		{ 0x0000, 0x1059,   0 }, { 0x0000, 0x1061,   0 },
+		{ 0x0000, 0x1069,   0 }, { 0x0000, 0x1071,   0 },
+	},
+	/* Page 0x37, first used for range 0x010c0-0x010ff */
+	{
+		{ 0x0000, 0x1079,   0 }, { 0x0000, 0x1081,   0 },
+		{ 0x0000, 0x1089,   0 }, { 0x0000, 0x1091,   0 },
+		{ 0x0000, 0x1099,   0 }, { 0x0000, 0x10a1,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x10a9,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x10b1,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x38, first used for range 0x01340-0x0137f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x39, first used for range 0x013c0-0x013ff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x10b9,   0 }, { 0x0000, 0x10c1,   0 },
+		{ 0x0000, 0x10c9,   0 }, { 0x0000, 0x10d1,   0 },
+		{ 0x0000, 0x10d9,   0 }, { 0x0000, 0x10e1,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x3a, first used for range 0x01700-0x0173f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   9 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   9 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x3b, first used for range 0x017c0-0x017ff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   9 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x3c, first used for range 0x01880-0x018bf */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 228 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x3d, first used for range 0x01900-0x0193f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 222 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x3e, first used for range 0x01a00-0x01a3f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x3f, first used for range 0x01a40-0x01a7f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   9 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 220 },
+	},
+	/* Page 0x40, first used for range 0x01a80-0x01abf */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x41, first used for range 0x01b00-0x01b3f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x19e2, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x19f2, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x1a02, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x1a12, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x1a22, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x1a32, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   7 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x1a42, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x1a52, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x42, first used for range 0x01b40-0x01b7f */
+	{
+		{ 0x1a62, 0x0000,   0 }, { 0x1a72, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x1a82, 0x0000,   0 },
+		{ 0x0000, 0x0000,   9 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x43, first used for range 0x01b80-0x01bbf */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   9 }, { 0x0000, 0x0000,   9 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x44, first used for range 0x01bc0-0x01bff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   7 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   9 }, { 0x0000, 0x0000,   9 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x45, first used for range 0x01c00-0x01c3f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   7 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x46, first used for range 0x01c80-0x01cbf */
+	{
+		{ 0x0000, 0x10e9,   0 }, { 0x0000, 0x10f1,   0 },
+		{ 0x0000, 0x10f9,   0 }, { 0x0000, 0x1101,   0 },
+		{ 0x0000, 0x1109,   0 }, { 0x0000, 0x1111,   0 },
+		{ 0x0000, 0x1119,   0 }, { 0x0000, 0x1121,   0 },
+		{ 0x0000, 0x1129,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x47, first used for range 0x01cc0-0x01cff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   1 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   1 }, { 0x0000, 0x0000,   1 },
+		{ 0x0000, 0x0000,   1 }, { 0x0000, 0x0000,   1 },
+		{ 0x0000, 0x0000,   1 }, { 0x0000, 0x0000,   1 },
+		{ 0x0000, 0x0000,   1 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x48, first used for range 0x01dc0-0x01dff */
+	{
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 234 },
+		{ 0x0000, 0x0000, 214 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 202 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 233 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 220 },
+	},
+	/* Page 0x49, first used for range 0x01e00-0x01e3f */
+	{
+		{ 0x1a92, 0x1131,   0 }, { 0x1aa2, 0x0000,   0 },
+		{ 0x1ab2, 0x1139,   0 }, { 0x1ac2, 0x0000,   0 },
+		{ 0x1ad2, 0x1141,   0 }, { 0x1ae2, 0x0000,   0 },
+		{ 0x1af2, 0x1149,   0 }, { 0x1b02, 0x0000,   0 },
+		{ 0x1b13, 0x1151,   0 }, { 0x1b2b, 0x0000,   0 },
+		{ 0x1b42, 0x1159,   0 }, { 0x1b52, 0x0000,   0 },
+		{ 0x1b62, 0x1161,   0 }, { 0x1b72, 0x0000,   0 },
+		{ 0x1b82, 0x1169,   0 }, { 0x1b92, 0x0000,   0 },
+		{ 0x1ba2, 0x1171,   0 }, { 0x1bb2, 0x0000,   0 },
+		{ 0x1bc2, 0x1179,   0 }, { 0x1bd2, 0x0000,   0 },
+		{ 0x1be3, 0x1181,   0 }, { 0x1bfb, 0x0000,   0 },
+		{ 0x1c13, 0x1189,   0 }, { 0x1c2b, 0x0000,   0 },
+		{ 0x1c42, 0x1191,   0 }, { 0x1c52, 0x0000,   0 },
+		{ 0x1c62, 0x1199,   0 }, { 0x1c72, 0x0000,   0 },
+		{ 0x1c83, 0x11a1,   0 }, { 0x1c9b, 0x0000,   0 },
+		{ 0x1cb2, 0x11a9,   0 }, { 0x1cc2, 0x0000,   0 },
+		{ 0x1cd2, 0x11b1,   0 }, { 0x1ce2, 0x0000,   0 },
+		{ 0x1cf2, 0x11b9,   0 }, { 0x1d02, 0x0000,   0 },
+		{ 0x1d12, 0x11c1,   0 }, { 0x1d22, 0x0000,   0 },
+		{ 0x1d32, 0x11c9,   0 }, { 0x1d42, 0x0000,   0 },
+		{ 0x1d52, 0x11d1,   0 }, { 0x1d62, 0x0000,   0 },
+		{ 0x1d72, 0x11d9,   0 }, { 0x1d82, 0x0000,   0 },
+		{ 0x1d92, 0x11e1,   0 }, { 0x1da2, 0x0000,   0 },
+		{ 0x1db3, 0x11e9,   0 }, { 0x1dcb, 0x0000,   0 },
+		{ 0x1de2, 0x11f1,   0 }, { 0x1df2, 0x0000,   0 },
+		{ 0x1e02, 0x11f9,   0 }, { 0x1e12, 0x0000,   0 },
+		{ 0x1e22, 0x1201,   0 }, { 0x1e32, 0x0000,   0 },
+		{ 0x1e42, 0x1209,   0 }, { 0x1e52, 0x0000,   0 },
+		{ 0x1e63, 0x1211,   0 }, { 0x1e7b, 0x0000,   0 },
+		{ 0x1e92, 0x1219,   0 }, { 0x1ea2, 0x0000,   0 },
+		{ 0x1eb2, 0x1221,   0 }, { 0x1ec2, 0x0000,   0 },
+		{ 0x1ed2, 0x1229,   0 }, { 0x1ee2, 0x0000,   0 },
+	},
+	/* Page 0x4a, first used for range 0x01e40-0x01e7f */
+	{
+		{ 0x1ef2, 0x1231,   0 }, { 0x1f02, 0x0000,   0 },
+		{ 0x1f12, 0x1239,   0 }, { 0x1f22, 0x0000,   0 },
+		{ 0x1f32, 0x1241,   0 }, { 0x1f42, 0x0000,   0 },
+		{ 0x1f52, 0x1249,   0 }, { 0x1f62, 0x0000,   0 },
+		{ 0x1f72, 0x1251,   0 }, { 0x1f82, 0x0000,   0 },
+		{ 0x1f92, 0x1259,   0 }, { 0x1fa2, 0x0000,   0 },
+		{ 0x1fb3, 0x1261,   0 }, { 0x1fcb, 0x0000,   0 },
+		{ 0x1fe3, 0x1269,   0 }, { 0x1ffb, 0x0000,   0 },
+		{ 0x2013, 0x1271,   0 }, { 0x202b, 0x0000,   0 },
+		{ 0x2043, 0x1279,   0 }, { 0x205b, 0x0000,   0 },
+		{ 0x2072, 0x1281,   0 }, { 0x2082, 0x0000,   0 },
+		{ 0x2092, 0x1289,   0 }, { 0x20a2, 0x0000,   0 },
+		{ 0x20b2, 0x1291,   0 }, { 0x20c2, 0x0000,   0 },
+		{ 0x20d2, 0x1299,   0 }, { 0x20e2, 0x0000,   0 },
+		{ 0x20f3, 0x12a1,   0 }, { 0x210b, 0x0000,   0 },
+		{ 0x2122, 0x12a9,   0 }, { 0x2132, 0x0000,   0 },
+		{ 0x2142, 0x12b1,   0 }, { 0x2152, 0x0000,   0 },
+		{ 0x2162, 0x12b9,   0 }, { 0x2172, 0x0000,   0 },
+		{ 0x2183, 0x12c1,   0 }, { 0x219b, 0x0000,   0 },
+		{ 0x21b3, 0x12c9,   0 }, { 0x21cb, 0x0000,   0 },
+		{ 0x21e3, 0x12d1,   0 }, { 0x21fb, 0x0000,   0 },
+		{ 0x2212, 0x12d9,   0 }, { 0x2222, 0x0000,   0 },
+		{ 0x2232, 0x12e1,   0 }, { 0x2242, 0x0000,   0 },
+		{ 0x2252, 0x12e9,   0 }, { 0x2262, 0x0000,   0 },
+		{ 0x2272, 0x12f1,   0 }, { 0x2282, 0x0000,   0 },
+		{ 0x2292, 0x12f9,   0 }, { 0x22a2, 0x0000,   0 },
+		{ 0x22b2, 0x1301,   0 }, { 0x22c2, 0x0000,   0 },
+		{ 0x22d2, 0x1309,   0 }, { 0x22e2, 0x0000,   0 },
+		{ 0x22f3, 0x1311,   0 }, { 0x230b, 0x0000,   0 },
+		{ 0x2323, 0x1319,   0 }, { 0x233b, 0x0000,   0 },
+		{ 0x2352, 0x1321,   0 }, { 0x2362, 0x0000,   0 },
+		{ 0x2372, 0x1329,   0 }, { 0x2382, 0x0000,   0 },
+	},
+	/* Page 0x4b, first used for range 0x01e80-0x01ebf */
+	{
+		{ 0x2392, 0x1331,   0 }, { 0x23a2, 0x0000,   0 },
+		{ 0x23b2, 0x1339,   0 }, { 0x23c2, 0x0000,   0 },
+		{ 0x23d2, 0x1341,   0 }, { 0x23e2, 0x0000,   0 },
+		{ 0x23f2, 0x1349,   0 }, { 0x2402, 0x0000,   0 },
+		{ 0x2412, 0x1351,   0 }, { 0x2422, 0x0000,   0 },
+		{ 0x2432, 0x1359,   0 }, { 0x2442, 0x0000,   0 },
+		{ 0x2452, 0x1361,   0 }, { 0x2462, 0x0000,   0 },
+		{ 0x2472, 0x1369,   0 }, { 0x2482, 0x0000,   0 },
+		{ 0x2492, 0x1371,   0 }, { 0x24a2, 0x0000,   0 },
+		{ 0x24b2, 0x1379,   0 }, { 0x24c2, 0x0000,   0 },
+		{ 0x24d2, 0x1381,   0 }, { 0x24e2, 0x0000,   0 },
+		{ 0x24f2, 0x138a,   0 }, { 0x2502, 0x139a,   0 },
+		{ 0x2512, 0x13aa,   0 }, { 0x2522, 0x13ba,   0 },
+		{ 0x0000, 0x13ca,   0 }, { 0x2532, 0x13d9,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x13e2,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x2542, 0x13f1,   0 }, { 0x2552, 0x0000,   0 },
+		{ 0x2562, 0x13f9,   0 }, { 0x2572, 0x0000,   0 },
+		{ 0x2583, 0x1401,   0 }, { 0x259b, 0x0000,   0 },
+		{ 0x25b3, 0x1409,   0 }, { 0x25cb, 0x0000,   0 },
+		{ 0x25e3, 0x1411,   0 }, { 0x25fb, 0x0000,   0 },
+		{ 0x2613, 0x1419,   0 }, { 0x262b, 0x0000,   0 },
+		{ 0x2643, 0x1421,   0 }, { 0x265b, 0x0000,   0 },
+		{ 0x2673, 0x1429,   0 }, { 0x268b, 0x0000,   0 },
+		{ 0x26a3, 0x1431,   0 }, { 0x26bb, 0x0000,   0 },
+		{ 0x26d3, 0x1439,   0 }, { 0x26eb, 0x0000,   0 },
+		{ 0x2703, 0x1441,   0 }, { 0x271b, 0x0000,   0 },
+		{ 0x2733, 0x1449,   0 }, { 0x274b, 0x0000,   0 },
+		{ 0x2762, 0x1451,   0 }, { 0x2772, 0x0000,   0 },
+		{ 0x2782, 0x1459,   0 }, { 0x2792, 0x0000,   0 },
+		{ 0x27a2, 0x1461,   0 }, { 0x27b2, 0x0000,   0 },
+		{ 0x27c3, 0x1469,   0 }, { 0x27db, 0x0000,   0 },
+	},
+	/* Page 0x4c, first used for range 0x01ec0-0x01eff */
+	{
+		{ 0x27f3, 0x1471,   0 }, { 0x280b, 0x0000,   0 },
+		{ 0x2823, 0x1479,   0 }, { 0x283b, 0x0000,   0 },
+		{ 0x2853, 0x1481,   0 }, { 0x286b, 0x0000,   0 },
+		{ 0x2883, 0x1489,   0 }, { 0x289b, 0x0000,   0 },
+		{ 0x28b2, 0x1491,   0 }, { 0x28c2, 0x0000,   0 },
+		{ 0x28d2, 0x1499,   0 }, { 0x28e2, 0x0000,   0 },
+		{ 0x28f2, 0x14a1,   0 }, { 0x2902, 0x0000,   0 },
+		{ 0x2912, 0x14a9,   0 }, { 0x2922, 0x0000,   0 },
+		{ 0x2933, 0x14b1,   0 }, { 0x294b, 0x0000,   0 },
+		{ 0x2963, 0x14b9,   0 }, { 0x297b, 0x0000,   0 },
+		{ 0x2993, 0x14c1,   0 }, { 0x29ab, 0x0000,   0 },
+		{ 0x29c3, 0x14c9,   0 }, { 0x29db, 0x0000,   0 },
+		{ 0x29f3, 0x14d1,   0 }, { 0x2a0b, 0x0000,   0 },
+		{ 0x2a23, 0x14d9,   0 }, { 0x2a3b, 0x0000,   0 },
+		{ 0x2a53, 0x14e1,   0 }, { 0x2a6b, 0x0000,   0 },
+		{ 0x2a83, 0x14e9,   0 }, { 0x2a9b, 0x0000,   0 },
+		{ 0x2ab3, 0x14f1,   0 }, { 0x2acb, 0x0000,   0 },
+		{ 0x2ae3, 0x14f9,   0 }, { 0x2afb, 0x0000,   0 },
+		{ 0x2b12, 0x1501,   0 }, { 0x2b22, 0x0000,   0 },
+		{ 0x2b32, 0x1509,   0 }, { 0x2b42, 0x0000,   0 },
+		{ 0x2b53, 0x1511,   0 }, { 0x2b6b, 0x0000,   0 },
+		{ 0x2b83, 0x1519,   0 }, { 0x2b9b, 0x0000,   0 },
+		{ 0x2bb3, 0x1521,   0 }, { 0x2bcb, 0x0000,   0 },
+		{ 0x2be3, 0x1529,   0 }, { 0x2bfb, 0x0000,   0 },
+		{ 0x2c13, 0x1531,   0 }, { 0x2c2b, 0x0000,   0 },
+		{ 0x2c42, 0x1539,   0 }, { 0x2c52, 0x0000,   0 },
+		{ 0x2c62, 0x1541,   0 }, { 0x2c72, 0x0000,   0 },
+		{ 0x2c82, 0x1549,   0 }, { 0x2c92, 0x0000,   0 },
+		{ 0x2ca2, 0x1551,   0 }, { 0x2cb2, 0x0000,   0 },
+		{ 0x0000, 0x1559,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x1561,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x1569,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x4d, first used for range 0x01f00-0x01f3f */
+	{
+		{ 0x2cc2, 0x0000,   0 }, { 0x2cd2, 0x0000,   0 },
+		{ 0x2ce3, 0x0000,   0 }, { 0x2cfb, 0x0000,   0 },
+		{ 0x2d13, 0x0000,   0 }, { 0x2d2b, 0x0000,   0 },
+		{ 0x2d43, 0x0000,   0 }, { 0x2d5b, 0x0000,   0 },
+		{ 0x2d72, 0x1571,   0 }, { 0x2d82, 0x1579,   0 },
+		{ 0x2d93, 0x1581,   0 }, { 0x2dab, 0x1589,   0 },
+		{ 0x2dc3, 0x1591,   0 }, { 0x2ddb, 0x1599,   0 },
+		{ 0x2df3, 0x15a1,   0 }, { 0x2e0b, 0x15a9,   0 },
+		{ 0x2e22, 0x0000,   0 }, { 0x2e32, 0x0000,   0 },
+		{ 0x2e43, 0x0000,   0 }, { 0x2e5b, 0x0000,   0 },
+		{ 0x2e73, 0x0000,   0 }, { 0x2e8b, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x2ea2, 0x15b1,   0 }, { 0x2eb2, 0x15b9,   0 },
+		{ 0x2ec3, 0x15c1,   0 }, { 0x2edb, 0x15c9,   0 },
+		{ 0x2ef3, 0x15d1,   0 }, { 0x2f0b, 0x15d9,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x2f22, 0x0000,   0 }, { 0x2f32, 0x0000,   0 },
+		{ 0x2f43, 0x0000,   0 }, { 0x2f5b, 0x0000,   0 },
+		{ 0x2f73, 0x0000,   0 }, { 0x2f8b, 0x0000,   0 },
+		{ 0x2fa3, 0x0000,   0 }, { 0x2fbb, 0x0000,   0 },
+		{ 0x2fd2, 0x15e1,   0 }, { 0x2fe2, 0x15e9,   0 },
+		{ 0x2ff3, 0x15f1,   0 }, { 0x300b, 0x15f9,   0 },
+		{ 0x3023, 0x1601,   0 }, { 0x303b, 0x1609,   0 },
+		{ 0x3053, 0x1611,   0 }, { 0x306b, 0x1619,   0 },
+		{ 0x3082, 0x0000,   0 }, { 0x3092, 0x0000,   0 },
+		{ 0x30a3, 0x0000,   0 }, { 0x30bb, 0x0000,   0 },
+		{ 0x30d3, 0x0000,   0 }, { 0x30eb, 0x0000,   0 },
+		{ 0x3103, 0x0000,   0 }, { 0x311b, 0x0000,   0 },
+		{ 0x3132, 0x1621,   0 }, { 0x3142, 0x1629,   0 },
+		{ 0x3153, 0x1631,   0 }, { 0x316b, 0x1639,   0 },
+		{ 0x3183, 0x1641,   0 }, { 0x319b, 0x1649,   0 },
+		{ 0x31b3, 0x1651,   0 }, { 0x31cb, 0x1659,   0 },
+	},
+	/* Page 0x4e, first used for range 0x01f40-0x01f7f */
+	{
+		{ 0x31e2, 0x0000,   0 }, { 0x31f2, 0x0000,   0 },
+		{ 0x3203, 0x0000,   0 }, { 0x321b, 0x0000,   0 },
+		{ 0x3233, 0x0000,   0 }, { 0x324b, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x3262, 0x1661,   0 }, { 0x3272, 0x1669,   0 },
+		{ 0x3283, 0x1671,   0 }, { 0x329b, 0x1679,   0 },
+		{ 0x32b3, 0x1681,   0 }, { 0x32cb, 0x1689,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x32e2, 0x1692,   0 }, { 0x32f2, 0x0000,   0 },
+		{ 0x3303, 0x16a3,   0 }, { 0x331b, 0x0000,   0 },
+		{ 0x3333, 0x16bb,   0 }, { 0x334b, 0x0000,   0 },
+		{ 0x3363, 0x16d3,   0 }, { 0x337b, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x3392, 0x16e9,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x33a3, 0x16f1,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x33bb, 0x16f9,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x33d3, 0x1701,   0 },
+		{ 0x33ea, 0x0000,   0 }, { 0x33fa, 0x0000,   0 },
+		{ 0x340b, 0x0000,   0 }, { 0x3423, 0x0000,   0 },
+		{ 0x343b, 0x0000,   0 }, { 0x3453, 0x0000,   0 },
+		{ 0x346b, 0x0000,   0 }, { 0x3483, 0x0000,   0 },
+		{ 0x349a, 0x1709,   0 }, { 0x34aa, 0x1711,   0 },
+		{ 0x34bb, 0x1719,   0 }, { 0x34d3, 0x1721,   0 },
+		{ 0x34eb, 0x1729,   0 }, { 0x3503, 0x1731,   0 },
+		{ 0x351b, 0x1739,   0 }, { 0x3533, 0x1741,   0 },
+		{ 0x354a, 0x0000,   0 }, { 0x355a, 0x0000,   0 },
+		{ 0x356a, 0x0000,   0 }, { 0x357a, 0x0000,   0 },
+		{ 0x358a, 0x0000,   0 }, { 0x359a, 0x0000,   0 },
+		{ 0x35aa, 0x0000,   0 }, { 0x35ba, 0x0000,   0 },
+		{ 0x35ca, 0x0000,   0 }, { 0x35da, 0x0000,   0 },
+		{ 0x35ea, 0x0000,   0 }, { 0x35fa, 0x0000,   0 },
+		{ 0x360a, 0x0000,   0 }, { 0x361a, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x4f, first used for range 0x01f80-0x01fbf */
+	{
+		{ 0x362b, 0x174a,   0 }, { 0x3643, 0x175a,   0 },
+		{ 0x365c, 0x176a,   0 }, { 0x367c, 0x177a,   0 },
+		{ 0x369c, 0x178a,   0 }, { 0x36bc, 0x179a,   0 },
+		{ 0x36dc, 0x17aa,   0 }, { 0x36fc, 0x17ba,   0 },
+		{ 0x371b, 0x17ca,   0 }, { 0x3733, 0x17da,   0 },
+		{ 0x374c, 0x17ea,   0 }, { 0x376c, 0x17fa,   0 },
+		{ 0x378c, 0x180a,   0 }, { 0x37ac, 0x181a,   0 },
+		{ 0x37cc, 0x182a,   0 }, { 0x37ec, 0x183a,   0 },
+		{ 0x380b, 0x184a,   0 }, { 0x3823, 0x185a,   0 },
+		{ 0x383c, 0x186a,   0 }, { 0x385c, 0x187a,   0 },
+		{ 0x387c, 0x188a,   0 }, { 0x389c, 0x189a,   0 },
+		{ 0x38bc, 0x18aa,   0 }, { 0x38dc, 0x18ba,   0 },
+		{ 0x38fb, 0x18ca,   0 }, { 0x3913, 0x18da,   0 },
+		{ 0x392c, 0x18ea,   0 }, { 0x394c, 0x18fa,   0 },
+		{ 0x396c, 0x190a,   0 }, { 0x398c, 0x191a,   0 },
+		{ 0x39ac, 0x192a,   0 }, { 0x39cc, 0x193a,   0 },
+		{ 0x39eb, 0x194a,   0 }, { 0x3a03, 0x195a,   0 },
+		{ 0x3a1c, 0x196a,   0 }, { 0x3a3c, 0x197a,   0 },
+		{ 0x3a5c, 0x198a,   0 }, { 0x3a7c, 0x199a,   0 },
+		{ 0x3a9c, 0x19aa,   0 }, { 0x3abc, 0x19ba,   0 },
+		{ 0x3adb, 0x19ca,   0 }, { 0x3af3, 0x19da,   0 },
+		{ 0x3b0c, 0x19ea,   0 }, { 0x3b2c, 0x19fa,   0 },
+		{ 0x3b4c, 0x1a0a,   0 }, { 0x3b6c, 0x1a1a,   0 },
+		{ 0x3b8c, 0x1a2a,   0 }, { 0x3bac, 0x1a3a,   0 },
+		{ 0x3bca, 0x0000,   0 }, { 0x3bda, 0x0000,   0 },
+		{ 0x3beb, 0x1a4a,   0 }, { 0x3c02, 0x1a5a,   0 },
+		{ 0x3c13, 0x1a6a,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x3c2a, 0x1a7a,   0 }, { 0x3c3b, 0x1a8b,   0 },
+		{ 0x3c52, 0x1aa1,   0 }, { 0x3c62, 0x1aa9,   0 },
+		{ 0x3c72, 0x1ab1,   0 }, { 0x3c82, 0x1ab9,   0 },
+		{ 0x3c92, 0x1ac2,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x3ca1, 0x1ad1,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x50, first used for range 0x01fc0-0x01fff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x3caa, 0x0000,   0 },
+		{ 0x3cbb, 0x1ada,   0 }, { 0x3cd2, 0x1aea,   0 },
+		{ 0x3ce3, 0x1afa,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x3cfa, 0x1b0a,   0 }, { 0x3d0b, 0x1b1b,   0 },
+		{ 0x3d22, 0x1b31,   0 }, { 0x3d32, 0x1b39,   0 },
+		{ 0x3d42, 0x1b41,   0 }, { 0x3d52, 0x1b49,   0 },
+		{ 0x3d62, 0x1b52,   0 }, { 0x3d72, 0x0000,   0 },
+		{ 0x3d82, 0x0000,   0 }, { 0x3d92, 0x0000,   0 },
+		{ 0x3da2, 0x0000,   0 }, { 0x3db2, 0x0000,   0 },
+		{ 0x3dc3, 0x1b63,   0 }, { 0x3ddb, 0x1b7b,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x3df2, 0x1b92,   0 }, { 0x3e03, 0x1ba3,   0 },
+		{ 0x3e1a, 0x1bb9,   0 }, { 0x3e2a, 0x1bc1,   0 },
+		{ 0x3e3a, 0x1bc9,   0 }, { 0x3e4a, 0x1bd1,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x3e5a, 0x0000,   0 },
+		{ 0x3e6a, 0x0000,   0 }, { 0x3e7a, 0x0000,   0 },
+		{ 0x3e8a, 0x0000,   0 }, { 0x3e9a, 0x0000,   0 },
+		{ 0x3eab, 0x1bdb,   0 }, { 0x3ec3, 0x1bf3,   0 },
+		{ 0x3eda, 0x1c0a,   0 }, { 0x3eea, 0x0000,   0 },
+		{ 0x3efa, 0x1c1a,   0 }, { 0x3f0b, 0x1c2b,   0 },
+		{ 0x3f22, 0x1c41,   0 }, { 0x3f32, 0x1c49,   0 },
+		{ 0x3f42, 0x1c51,   0 }, { 0x3f52, 0x1c59,   0 },
+		{ 0x3f62, 0x1c61,   0 }, { 0x3f72, 0x0000,   0 },
+		{ 0x3f82, 0x0000,   0 }, { 0x3f91, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x3f9b, 0x1c6a,   0 }, { 0x3fb2, 0x1c7a,   0 },
+		{ 0x3fc3, 0x1c8a,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x3fda, 0x1c9a,   0 }, { 0x3feb, 0x1cab,   0 },
+		{ 0x4002, 0x1cc1,   0 }, { 0x4012, 0x1cc9,   0 },
+		{ 0x4022, 0x1cd1,   0 }, { 0x4032, 0x1cd9,   0 },
+		{ 0x4042, 0x1ce2,   0 }, { 0x4051, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x51, first used for range 0x02000-0x0203f */
+	{
+		{ 0x4059, 0x0000,   0 }, { 0x4061, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x52, first used for range 0x020c0-0x020ff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   1 }, { 0x0000, 0x0000,   1 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   1 }, { 0x0000, 0x0000,   1 },
+		{ 0x0000, 0x0000,   1 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   1 },
+		{ 0x0000, 0x0000,   1 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   1 }, { 0x0000, 0x0000,   1 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x53, first used for range 0x02100-0x0213f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x4069, 0x1cf1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x4071, 0x1cf9,   0 }, { 0x407a, 0x1d01,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x1d09,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x54, first used for range 0x02140-0x0217f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x1d11,   0 }, { 0x0000, 0x1d19,   0 },
+		{ 0x0000, 0x1d21,   0 }, { 0x0000, 0x1d29,   0 },
+		{ 0x0000, 0x1d31,   0 }, { 0x0000, 0x1d39,   0 },
+		{ 0x0000, 0x1d41,   0 }, { 0x0000, 0x1d49,   0 },
+		{ 0x0000, 0x1d51,   0 }, { 0x0000, 0x1d59,   0 },
+		{ 0x0000, 0x1d61,   0 }, { 0x0000, 0x1d69,   0 },
+		{ 0x0000, 0x1d71,   0 }, { 0x0000, 0x1d79,   0 },
+		{ 0x0000, 0x1d81,   0 }, { 0x0000, 0x1d89,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x55, first used for range 0x02180-0x021bf */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x1d91,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x408a, 0x0000,   0 }, { 0x409a, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x40aa, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x56, first used for range 0x021c0-0x021ff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x40ba, 0x0000,   0 },
+		{ 0x40ca, 0x0000,   0 }, { 0x40da, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x57, first used for range 0x02200-0x0223f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x40ea, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x40fa, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x410a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x411a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x412a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x58, first used for range 0x02240-0x0227f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x413a, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x414a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x415a, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x416a, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x417a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x418a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x419a, 0x0000,   0 },
+		{ 0x41aa, 0x0000,   0 }, { 0x41ba, 0x0000,   0 },
+		{ 0x41ca, 0x0000,   0 }, { 0x41da, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x41ea, 0x0000,   0 }, { 0x41fa, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x420a, 0x0000,   0 }, { 0x421a, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x59, first used for range 0x02280-0x022bf */
+	{
+		{ 0x422a, 0x0000,   0 }, { 0x423a, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x424a, 0x0000,   0 }, { 0x425a, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x426a, 0x0000,   0 }, { 0x427a, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x428a, 0x0000,   0 }, { 0x429a, 0x0000,   0 },
+		{ 0x42aa, 0x0000,   0 }, { 0x42ba, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x5a, first used for range 0x022c0-0x022ff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x42ca, 0x0000,   0 }, { 0x42da, 0x0000,   0 },
+		{ 0x42ea, 0x0000,   0 }, { 0x42fa, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x430a, 0x0000,   0 }, { 0x431a, 0x0000,   0 },
+		{ 0x432a, 0x0000,   0 }, { 0x433a, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x5b, first used for range 0x02300-0x0233f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x4349, 0x0000,   0 },
+		{ 0x4351, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x5c, first used for range 0x02480-0x024bf */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x1d99,   0 }, { 0x0000, 0x1da1,   0 },
+		{ 0x0000, 0x1da9,   0 }, { 0x0000, 0x1db1,   0 },
+		{ 0x0000, 0x1db9,   0 }, { 0x0000, 0x1dc1,   0 },
+		{ 0x0000, 0x1dc9,   0 }, { 0x0000, 0x1dd1,   0 },
+		{ 0x0000, 0x1dd9,   0 }, { 0x0000, 0x1de1,   0 },
+	},
+	/* Page 0x5d, first used for range 0x024c0-0x024ff */
+	{
+		{ 0x0000, 0x1de9,   0 }, { 0x0000, 0x1df1,   0 },
+		{ 0x0000, 0x1df9,   0 }, { 0x0000, 0x1e01,   0 },
+		{ 0x0000, 0x1e09,   0 }, { 0x0000, 0x1e11,   0 },
+		{ 0x0000, 0x1e19,   0 }, { 0x0000, 0x1e21,   0 },
+		{ 0x0000, 0x1e29,   0 }, { 0x0000, 0x1e31,   0 },
+		{ 0x0000, 0x1e39,   0 }, { 0x0000, 0x1e41,   0 },
+		{ 0x0000, 0x1e49,   0 }, { 0x0000, 0x1e51,   0 },
+		{ 0x0000, 0x1e59,   0 }, { 0x0000, 0x1e61,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x5e, first used for range 0x02ac0-0x02aff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x435a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x5f, first used for range 0x02c00-0x02c3f */
+	{
+		{ 0x0000, 0x1e69,   0 }, { 0x0000, 0x1e71,   0 },
+		{ 0x0000, 0x1e79,   0 }, { 0x0000, 0x1e81,   0 },
+		{ 0x0000, 0x1e89,   0 }, { 0x0000, 0x1e91,   0 },
+		{ 0x0000, 0x1e99,   0 }, { 0x0000, 0x1ea1,   0 },
+		{ 0x0000, 0x1ea9,   0 }, { 0x0000, 0x1eb1,   0 },
+		{ 0x0000, 0x1eb9,   0 }, { 0x0000, 0x1ec1,   0 },
+		{ 0x0000, 0x1ec9,   0 }, { 0x0000, 0x1ed1,   0 },
+		{ 0x0000, 0x1ed9,   0 }, { 0x0000, 0x1ee1,   0 },
+		{ 0x0000, 0x1ee9,   0 }, { 0x0000, 0x1ef1,   0 },
+		{ 0x0000, 0x1ef9,   0 }, { 0x0000, 0x1f01,   0 },
+		{ 0x0000, 0x1f09,   0 }, { 0x0000, 0x1f11,   0 },
+		{ 0x0000, 0x1f19,   0 }, { 0x0000, 0x1f21,   0 },
+		{ 0x0000, 0x1f29,   0 }, { 0x0000, 0x1f31,   0 },
+		{ 0x0000, 0x1f39,   0 }, { 0x0000, 0x1f41,   0 },
+		{ 0x0000, 0x1f49,   0 }, { 0x0000, 0x1f51,   0 },
+		{ 0x0000, 0x1f59,   0 }, { 0x0000, 0x1f61,   0 },
+		{ 0x0000, 0x1f69,   0 }, { 0x0000, 0x1f71,   0 },
+		{ 0x0000, 0x1f79,   0 }, { 0x0000, 0x1f81,   0 },
+		{ 0x0000, 0x1f89,   0 }, { 0x0000, 0x1f91,   0 },
+		{ 0x0000, 0x1f99,   0 }, { 0x0000, 0x1fa1,   0 },
+		{ 0x0000, 0x1fa9,   0 }, { 0x0000, 0x1fb1,   0 },
+		{ 0x0000, 0x1fb9,   0 }, { 0x0000, 0x1fc1,   0 },
+		{ 0x0000, 0x1fc9,   0 }, { 0x0000, 0x1fd1,   0 },
+		{ 0x0000, 0x1fd9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x60, first used for range 0x02c40-0x02c7f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x1fe1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x1fe9,   0 }, { 0x0000, 0x1ff1,   0 },
+		{ 0x0000, 0x1ff9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x2001,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x2009,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x2011,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x2019,   0 },
+		{ 0x0000, 0x2021,   0 }, { 0x0000, 0x2029,   0 },
+		{ 0x0000, 0x2031,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2039,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x2041,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2049,   0 }, { 0x0000, 0x2051,   0 },
+	},
+	/* Page 0x61, first used for range 0x02c80-0x02cbf */
+	{
+		{ 0x0000, 0x2059,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2061,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2069,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2071,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2079,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2081,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2089,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2091,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2099,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x20a1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x20a9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x20b1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x20b9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x20c1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x20c9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x20d1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x20d9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x20e1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x20e9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x20f1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x20f9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2101,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2109,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2111,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2119,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2121,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2129,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2131,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2139,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2141,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2149,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2151,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x62, first used for range 0x02cc0-0x02cff */
+	{
+		{ 0x0000, 0x2159,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2161,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2169,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2171,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2179,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2181,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2189,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2191,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2199,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x21a1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x21a9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x21b1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x21b9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x21c1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x21c9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x21d1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x21d9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x21e1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x21e9,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x21f1,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x21f9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x63, first used for range 0x02d40-0x02d7f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   9 },
+	},
+	/* Page 0x64, first used for range 0x02dc0-0x02dff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+	},
+	/* Page 0x65, first used for range 0x03000-0x0303f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 218 }, { 0x0000, 0x0000, 228 },
+		{ 0x0000, 0x0000, 232 }, { 0x0000, 0x0000, 222 },
+		{ 0x0000, 0x0000, 224 }, { 0x0000, 0x0000, 224 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x66, first used for range 0x03040-0x0307f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x436a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x437a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x438a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x439a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x43aa, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x43ba, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x43ca, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x43da, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x43ea, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x43fa, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x440a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x441a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x442a, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x443a, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x444a, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x445a, 0x0000,   0 }, { 0x446a, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x447a, 0x0000,   0 },
+		{ 0x448a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x449a, 0x0000,   0 }, { 0x44aa, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x44ba, 0x0000,   0 },
+		{ 0x44ca, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x44da, 0x0000,   0 }, { 0x44ea, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x67, first used for range 0x03080-0x030bf */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x44fa, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   8 },
+		{ 0x0000, 0x0000,   8 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x450a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x451a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x452a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x453a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x454a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x455a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x456a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x457a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x458a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x459a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x45aa, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x68, first used for range 0x030c0-0x030ff */
+	{
+		{ 0x45ba, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x45ca, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x45da, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x45ea, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x45fa, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x460a, 0x0000,   0 }, { 0x461a, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x462a, 0x0000,   0 },
+		{ 0x463a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x464a, 0x0000,   0 }, { 0x465a, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x466a, 0x0000,   0 },
+		{ 0x467a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x468a, 0x0000,   0 }, { 0x469a, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x46aa, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x46ba, 0x0000,   0 },
+		{ 0x46ca, 0x0000,   0 }, { 0x46da, 0x0000,   0 },
+		{ 0x46ea, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x46fa, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x69, first used for range 0x0a640-0x0a67f */
+	{
+		{ 0x0000, 0x2201,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2209,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2211,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2219,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2221,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2229,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2231,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2239,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2241,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2249,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2251,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2259,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2261,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2269,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2271,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2279,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2281,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2289,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2291,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2299,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x22a1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x22a9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x22b1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x6a, first used for range 0x0a680-0x0a6bf */
+	{
+		{ 0x0000, 0x22b9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x22c1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x22c9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x22d1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x22d9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x22e1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x22e9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x22f1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x22f9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2301,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2309,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2311,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2319,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2321,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x6b, first used for range 0x0a6c0-0x0a6ff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x6c, first used for range 0x0a700-0x0a73f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2329,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2331,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2339,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2341,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2349,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2351,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2359,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2361,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2369,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2371,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2379,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2381,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2389,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2391,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x6d, first used for range 0x0a740-0x0a77f */
+	{
+		{ 0x0000, 0x2399,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x23a1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x23a9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x23b1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x23b9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x23c1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x23c9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x23d1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x23d9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x23e1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x23e9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x23f1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x23f9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2401,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2409,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2411,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2419,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2421,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2429,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2431,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2439,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2441,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2449,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2451,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x2459,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x2461,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x2469,   0 },
+		{ 0x0000, 0x2471,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x6e, first used for range 0x0a780-0x0a7bf */
+	{
+		{ 0x0000, 0x2479,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2481,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2489,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2491,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x2499,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x24a1,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x24a9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x24b1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x24b9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x24c1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x24c9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x24d1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x24d9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x24e1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x24e9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x24f1,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x24f9,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2501,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2509,   0 }, { 0x0000, 0x2511,   0 },
+		{ 0x0000, 0x2519,   0 }, { 0x0000, 0x2521,   0 },
+		{ 0x0000, 0x2529,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2531,   0 }, { 0x0000, 0x2539,   0 },
+		{ 0x0000, 0x2541,   0 }, { 0x0000, 0x2549,   0 },
+		{ 0x0000, 0x2551,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2559,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x6f, first used for range 0x0a800-0x0a83f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   9 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x70, first used for range 0x0a8c0-0x0a8ff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   9 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x71, first used for range 0x0a900-0x0a93f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x72, first used for range 0x0a940-0x0a97f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   9 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x73, first used for range 0x0a980-0x0a9bf */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   7 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x74, first used for range 0x0a9c0-0x0a9ff */
+	{
+		{ 0x0000, 0x0000,   9 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x75, first used for range 0x0aa80-0x0aabf */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+	},
+	/* Page 0x76, first used for range 0x0aac0-0x0aaff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   9 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x77, first used for range 0x0ab40-0x0ab7f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2561,   0 }, { 0x0000, 0x2569,   0 },
+		{ 0x0000, 0x2571,   0 }, { 0x0000, 0x2579,   0 },
+		{ 0x0000, 0x2581,   0 }, { 0x0000, 0x2589,   0 },
+		{ 0x0000, 0x2591,   0 }, { 0x0000, 0x2599,   0 },
+		{ 0x0000, 0x25a1,   0 }, { 0x0000, 0x25a9,   0 },
+		{ 0x0000, 0x25b1,   0 }, { 0x0000, 0x25b9,   0 },
+		{ 0x0000, 0x25c1,   0 }, { 0x0000, 0x25c9,   0 },
+		{ 0x0000, 0x25d1,   0 }, { 0x0000, 0x25d9,   0 },
+	},
+	/* Page 0x78, first used for range 0x0ab80-0x0abbf */
+	{
+		{ 0x0000, 0x25e1,   0 }, { 0x0000, 0x25e9,   0 },
+		{ 0x0000, 0x25f1,   0 }, { 0x0000, 0x25f9,   0 },
+		{ 0x0000, 0x2601,   0 }, { 0x0000, 0x2609,   0 },
+		{ 0x0000, 0x2611,   0 }, { 0x0000, 0x2619,   0 },
+		{ 0x0000, 0x2621,   0 }, { 0x0000, 0x2629,   0 },
+		{ 0x0000, 0x2631,   0 }, { 0x0000, 0x2639,   0 },
+		{ 0x0000, 0x2641,   0 }, { 0x0000, 0x2649,   0 },
+		{ 0x0000, 0x2651,   0 }, { 0x0000, 0x2659,   0 },
+		{ 0x0000, 0x2661,   0 }, { 0x0000, 0x2669,   0 },
+		{ 0x0000, 0x2671,   0 }, { 0x0000, 0x2679,   0 },
+		{ 0x0000, 0x2681,   0 }, { 0x0000, 0x2689,   0 },
+		{ 0x0000, 0x2691,   0 }, { 0x0000, 0x2699,   0 },
+		{ 0x0000, 0x26a1,   0 }, { 0x0000, 0x26a9,   0 },
+		{ 0x0000, 0x26b1,   0 }, { 0x0000, 0x26b9,   0 },
+		{ 0x0000, 0x26c1,   0 }, { 0x0000, 0x26c9,   0 },
+		{ 0x0000, 0x26d1,   0 }, { 0x0000, 0x26d9,   0 },
+		{ 0x0000, 0x26e1,   0 }, { 0x0000, 0x26e9,   0 },
+		{ 0x0000, 0x26f1,   0 }, { 0x0000, 0x26f9,   0 },
+		{ 0x0000, 0x2701,   0 }, { 0x0000, 0x2709,   0 },
+		{ 0x0000, 0x2711,   0 }, { 0x0000, 0x2719,   0 },
+		{ 0x0000, 0x2721,   0 }, { 0x0000, 0x2729,   0 },
+		{ 0x0000, 0x2731,   0 }, { 0x0000, 0x2739,   0 },
+		{ 0x0000, 0x2741,   0 }, { 0x0000, 0x2749,   0 },
+		{ 0x0000, 0x2751,   0 }, { 0x0000, 0x2759,   0 },
+		{ 0x0000, 0x2761,   0 }, { 0x0000, 0x2769,   0 },
+		{ 0x0000, 0x2771,   0 }, { 0x0000, 0x2779,   0 },
+		{ 0x0000, 0x2781,   0 }, { 0x0000, 0x2789,   0 },
+		{ 0x0000, 0x2791,   0 }, { 0x0000, 0x2799,   0 },
+		{ 0x0000, 0x27a1,   0 }, { 0x0000, 0x27a9,   0 },
+		{ 0x0000, 0x27b1,   0 }, { 0x0000, 0x27b9,   0 },
+		{ 0x0000, 0x27c1,   0 }, { 0x0000, 0x27c9,   0 },
+		{ 0x0000, 0x27d1,   0 }, { 0x0000, 0x27d9,   0 },
+	},
+	/* Page 0x79, first used for range 0x0abc0-0x0abff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   9 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x7a, first used for range 0x0f900-0x0f93f */
+	{
+		{ 0x4709, 0x0000,   0 }, { 0x4711, 0x0000,   0 },
+		{ 0x4719, 0x0000,   0 }, { 0x4721, 0x0000,   0 },
+		{ 0x4729, 0x0000,   0 }, { 0x4731, 0x0000,   0 },
+		{ 0x4739, 0x0000,   0 }, { 0x4741, 0x0000,   0 },
+		{ 0x4749, 0x0000,   0 }, { 0x4751, 0x0000,   0 },
+		{ 0x4759, 0x0000,   0 }, { 0x4761, 0x0000,   0 },
+		{ 0x4769, 0x0000,   0 }, { 0x4771, 0x0000,   0 },
+		{ 0x4779, 0x0000,   0 }, { 0x4781, 0x0000,   0 },
+		{ 0x4789, 0x0000,   0 }, { 0x4791, 0x0000,   0 },
+		{ 0x4799, 0x0000,   0 }, { 0x47a1, 0x0000,   0 },
+		{ 0x47a9, 0x0000,   0 }, { 0x47b1, 0x0000,   0 },
+		{ 0x47b9, 0x0000,   0 }, { 0x47c1, 0x0000,   0 },
+		{ 0x47c9, 0x0000,   0 }, { 0x47d1, 0x0000,   0 },
+		{ 0x47d9, 0x0000,   0 }, { 0x47e1, 0x0000,   0 },
+		{ 0x47e9, 0x0000,   0 }, { 0x47f1, 0x0000,   0 },
+		{ 0x47f9, 0x0000,   0 }, { 0x4801, 0x0000,   0 },
+		{ 0x4809, 0x0000,   0 }, { 0x4811, 0x0000,   0 },
+		{ 0x4819, 0x0000,   0 }, { 0x4821, 0x0000,   0 },
+		{ 0x4829, 0x0000,   0 }, { 0x4831, 0x0000,   0 },
+		{ 0x4839, 0x0000,   0 }, { 0x4841, 0x0000,   0 },
+		{ 0x4849, 0x0000,   0 }, { 0x4851, 0x0000,   0 },
+		{ 0x4859, 0x0000,   0 }, { 0x4861, 0x0000,   0 },
+		{ 0x4869, 0x0000,   0 }, { 0x4871, 0x0000,   0 },
+		{ 0x4879, 0x0000,   0 }, { 0x4881, 0x0000,   0 },
+		{ 0x4889, 0x0000,   0 }, { 0x4891, 0x0000,   0 },
+		{ 0x4899, 0x0000,   0 }, { 0x48a1, 0x0000,   0 },
+		{ 0x48a9, 0x0000,   0 }, { 0x48b1, 0x0000,   0 },
+		{ 0x48b9, 0x0000,   0 }, { 0x48c1, 0x0000,   0 },
+		{ 0x48c9, 0x0000,   0 }, { 0x48d1, 0x0000,   0 },
+		{ 0x48d9, 0x0000,   0 }, { 0x48e1, 0x0000,   0 },
+		{ 0x48e9, 0x0000,   0 }, { 0x48f1, 0x0000,   0 },
+		{ 0x48f9, 0x0000,   0 }, { 0x4901, 0x0000,   0 },
+	},
+	/* Page 0x7b, first used for range 0x0f940-0x0f97f */
+	{
+		{ 0x4909, 0x0000,   0 }, { 0x4911, 0x0000,   0 },
+		{ 0x4919, 0x0000,   0 }, { 0x4921, 0x0000,   0 },
+		{ 0x4929, 0x0000,   0 }, { 0x4931, 0x0000,   0 },
+		{ 0x4939, 0x0000,   0 }, { 0x4941, 0x0000,   0 },
+		{ 0x4949, 0x0000,   0 }, { 0x4951, 0x0000,   0 },
+		{ 0x4959, 0x0000,   0 }, { 0x4961, 0x0000,   0 },
+		{ 0x4969, 0x0000,   0 }, { 0x4971, 0x0000,   0 },
+		{ 0x4979, 0x0000,   0 }, { 0x4981, 0x0000,   0 },
+		{ 0x4989, 0x0000,   0 }, { 0x4991, 0x0000,   0 },
+		{ 0x4999, 0x0000,   0 }, { 0x49a1, 0x0000,   0 },
+		{ 0x49a9, 0x0000,   0 }, { 0x49b1, 0x0000,   0 },
+		{ 0x49b9, 0x0000,   0 }, { 0x49c1, 0x0000,   0 },
+		{ 0x49c9, 0x0000,   0 }, { 0x49d1, 0x0000,   0 },
+		{ 0x49d9, 0x0000,   0 }, { 0x49e1, 0x0000,   0 },
+		{ 0x49e9, 0x0000,   0 }, { 0x49f1, 0x0000,   0 },
+		{ 0x49f9, 0x0000,   0 }, { 0x4a01, 0x0000,   0 },
+		{ 0x4a09, 0x0000,   0 }, { 0x4a11, 0x0000,   0 },
+		{ 0x4a19, 0x0000,   0 }, { 0x4a21, 0x0000,   0 },
+		{ 0x4a29, 0x0000,   0 }, { 0x4a31, 0x0000,   0 },
+		{ 0x4a39, 0x0000,   0 }, { 0x4a41, 0x0000,   0 },
+		{ 0x4a49, 0x0000,   0 }, { 0x4a51, 0x0000,   0 },
+		{ 0x4a59, 0x0000,   0 }, { 0x4a61, 0x0000,   0 },
+		{ 0x4a69, 0x0000,   0 }, { 0x4a71, 0x0000,   0 },
+		{ 0x4a79, 0x0000,   0 }, { 0x4a81, 0x0000,   0 },
+		{ 0x4a89, 0x0000,   0 }, { 0x4a91, 0x0000,   0 },
+		{ 0x4a99, 0x0000,   0 }, { 0x4aa1, 0x0000,   0 },
+		{ 0x4aa9, 0x0000,   0 }, { 0x4ab1, 0x0000,   0 },
+		{ 0x4ab9, 0x0000,   0 }, { 0x4ac1, 0x0000,   0 },
+		{ 0x4ac9, 0x0000,   0 }, { 0x4ad1, 0x0000,   0 },
+		{ 0x4ad9, 0x0000,   0 }, { 0x4ae1, 0x0000,   0 },
+		{ 0x4ae9, 0x0000,   0 }, { 0x4af1, 0x0000,   0 },
+		{ 0x4af9, 0x0000,   0 }, { 0x4b01, 0x0000,   0 },
+	},
+	/* Page 0x7c, first used for range 0x0f980-0x0f9bf */
+	{
+		{ 0x4b09, 0x0000,   0 }, { 0x4b11, 0x0000,   0 },
+		{ 0x4b19, 0x0000,   0 }, { 0x4b21, 0x0000,   0 },
+		{ 0x4b29, 0x0000,   0 }, { 0x4b31, 0x0000,   0 },
+		{ 0x4b39, 0x0000,   0 }, { 0x4b41, 0x0000,   0 },
+		{ 0x4b49, 0x0000,   0 }, { 0x4b51, 0x0000,   0 },
+		{ 0x4b59, 0x0000,   0 }, { 0x4b61, 0x0000,   0 },
+		{ 0x4b69, 0x0000,   0 }, { 0x4b71, 0x0000,   0 },
+		{ 0x4b79, 0x0000,   0 }, { 0x4b81, 0x0000,   0 },
+		{ 0x4b89, 0x0000,   0 }, { 0x4b91, 0x0000,   0 },
+		{ 0x4b99, 0x0000,   0 }, { 0x4ba1, 0x0000,   0 },
+		{ 0x4ba9, 0x0000,   0 }, { 0x4bb1, 0x0000,   0 },
+		{ 0x4bb9, 0x0000,   0 }, { 0x4bc1, 0x0000,   0 },
+		{ 0x4bc9, 0x0000,   0 }, { 0x4bd1, 0x0000,   0 },
+		{ 0x4bd9, 0x0000,   0 }, { 0x4be1, 0x0000,   0 },
+		{ 0x4be9, 0x0000,   0 }, { 0x4bf1, 0x0000,   0 },
+		{ 0x4bf9, 0x0000,   0 }, { 0x4c01, 0x0000,   0 },
+		{ 0x4c09, 0x0000,   0 }, { 0x4c11, 0x0000,   0 },
+		{ 0x4c19, 0x0000,   0 }, { 0x4c21, 0x0000,   0 },
+		{ 0x4c29, 0x0000,   0 }, { 0x4c31, 0x0000,   0 },
+		{ 0x4c39, 0x0000,   0 }, { 0x4c41, 0x0000,   0 },
+		{ 0x4c49, 0x0000,   0 }, { 0x4c51, 0x0000,   0 },
+		{ 0x4c59, 0x0000,   0 }, { 0x4c61, 0x0000,   0 },
+		{ 0x4c69, 0x0000,   0 }, { 0x4c71, 0x0000,   0 },
+		{ 0x4c79, 0x0000,   0 }, { 0x4c81, 0x0000,   0 },
+		{ 0x4c89, 0x0000,   0 }, { 0x4c91, 0x0000,   0 },
+		{ 0x4c99, 0x0000,   0 }, { 0x4ca1, 0x0000,   0 },
+		{ 0x4ca9, 0x0000,   0 }, { 0x4cb1, 0x0000,   0 },
+		{ 0x4cb9, 0x0000,   0 }, { 0x4cc1, 0x0000,   0 },
+		{ 0x4cc9, 0x0000,   0 }, { 0x4cd1, 0x0000,   0 },
+		{ 0x4cd9, 0x0000,   0 }, { 0x4ce1, 0x0000,   0 },
+		{ 0x4ce9, 0x0000,   0 }, { 0x4cf1, 0x0000,   0 },
+		{ 0x4cf9, 0x0000,   0 }, { 0x4d01, 0x0000,   0 },
+	},
+	/* Page 0x7d, first used for range 0x0f9c0-0x0f9ff */
+	{
+		{ 0x4d09, 0x0000,   0 }, { 0x4d11, 0x0000,   0 },
+		{ 0x4d19, 0x0000,   0 }, { 0x4d21, 0x0000,   0 },
+		{ 0x4d29, 0x0000,   0 }, { 0x4d31, 0x0000,   0 },
+		{ 0x4d39, 0x0000,   0 }, { 0x4d41, 0x0000,   0 },
+		{ 0x4d49, 0x0000,   0 }, { 0x4d51, 0x0000,   0 },
+		{ 0x4d59, 0x0000,   0 }, { 0x4d61, 0x0000,   0 },
+		{ 0x4d69, 0x0000,   0 }, { 0x4d71, 0x0000,   0 },
+		{ 0x4d79, 0x0000,   0 }, { 0x4d81, 0x0000,   0 },
+		{ 0x4d89, 0x0000,   0 }, { 0x4d91, 0x0000,   0 },
+		{ 0x4d99, 0x0000,   0 }, { 0x4da1, 0x0000,   0 },
+		{ 0x4da9, 0x0000,   0 }, { 0x4db1, 0x0000,   0 },
+		{ 0x4db9, 0x0000,   0 }, { 0x4dc1, 0x0000,   0 },
+		{ 0x4dc9, 0x0000,   0 }, { 0x4dd1, 0x0000,   0 },
+		{ 0x4dd9, 0x0000,   0 }, { 0x4de1, 0x0000,   0 },
+		{ 0x4de9, 0x0000,   0 }, { 0x4df1, 0x0000,   0 },
+		{ 0x4df9, 0x0000,   0 }, { 0x4e01, 0x0000,   0 },
+		{ 0x4e09, 0x0000,   0 }, { 0x4e11, 0x0000,   0 },
+		{ 0x4e19, 0x0000,   0 }, { 0x4e21, 0x0000,   0 },
+		{ 0x4e29, 0x0000,   0 }, { 0x4e31, 0x0000,   0 },
+		{ 0x4e39, 0x0000,   0 }, { 0x4e41, 0x0000,   0 },
+		{ 0x4e49, 0x0000,   0 }, { 0x4e51, 0x0000,   0 },
+		{ 0x4e59, 0x0000,   0 }, { 0x4e61, 0x0000,   0 },
+		{ 0x4e69, 0x0000,   0 }, { 0x4e71, 0x0000,   0 },
+		{ 0x4e79, 0x0000,   0 }, { 0x4e81, 0x0000,   0 },
+		{ 0x4e89, 0x0000,   0 }, { 0x4e91, 0x0000,   0 },
+		{ 0x4e99, 0x0000,   0 }, { 0x4ea1, 0x0000,   0 },
+		{ 0x4ea9, 0x0000,   0 }, { 0x4eb1, 0x0000,   0 },
+		{ 0x4eb9, 0x0000,   0 }, { 0x4ec1, 0x0000,   0 },
+		{ 0x4ec9, 0x0000,   0 }, { 0x4ed1, 0x0000,   0 },
+		{ 0x4ed9, 0x0000,   0 }, { 0x4ee1, 0x0000,   0 },
+		{ 0x4ee9, 0x0000,   0 }, { 0x4ef1, 0x0000,   0 },
+		{ 0x4ef9, 0x0000,   0 }, { 0x4f01, 0x0000,   0 },
+	},
+	/* Page 0x7e, first used for range 0x0fa00-0x0fa3f */
+	{
+		{ 0x4f09, 0x0000,   0 }, { 0x4f11, 0x0000,   0 },
+		{ 0x4f19, 0x0000,   0 }, { 0x4f21, 0x0000,   0 },
+		{ 0x4f29, 0x0000,   0 }, { 0x4f31, 0x0000,   0 },
+		{ 0x4f39, 0x0000,   0 }, { 0x4f41, 0x0000,   0 },
+		{ 0x4f49, 0x0000,   0 }, { 0x4f51, 0x0000,   0 },
+		{ 0x4f59, 0x0000,   0 }, { 0x4f61, 0x0000,   0 },
+		{ 0x4f69, 0x0000,   0 }, { 0x4f71, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x4f79, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x4f81, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x4f89, 0x0000,   0 },
+		{ 0x4f91, 0x0000,   0 }, { 0x4f99, 0x0000,   0 },
+		{ 0x4fa1, 0x0000,   0 }, { 0x4fa9, 0x0000,   0 },
+		{ 0x4fb1, 0x0000,   0 }, { 0x4fb9, 0x0000,   0 },
+		{ 0x4fc1, 0x0000,   0 }, { 0x4fc9, 0x0000,   0 },
+		{ 0x4fd1, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x4fd9, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x4fe1, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x4fe9, 0x0000,   0 },
+		{ 0x4ff1, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x4ff9, 0x0000,   0 }, { 0x5001, 0x0000,   0 },
+		{ 0x5009, 0x0000,   0 }, { 0x5011, 0x0000,   0 },
+		{ 0x5019, 0x0000,   0 }, { 0x5021, 0x0000,   0 },
+		{ 0x5029, 0x0000,   0 }, { 0x5031, 0x0000,   0 },
+		{ 0x5039, 0x0000,   0 }, { 0x5041, 0x0000,   0 },
+		{ 0x5049, 0x0000,   0 }, { 0x5051, 0x0000,   0 },
+		{ 0x5059, 0x0000,   0 }, { 0x5061, 0x0000,   0 },
+		{ 0x5069, 0x0000,   0 }, { 0x5071, 0x0000,   0 },
+		{ 0x5079, 0x0000,   0 }, { 0x5081, 0x0000,   0 },
+		{ 0x5089, 0x0000,   0 }, { 0x5091, 0x0000,   0 },
+		{ 0x5099, 0x0000,   0 }, { 0x50a1, 0x0000,   0 },
+	},
+	/* Page 0x7f, first used for range 0x0fa40-0x0fa7f */
+	{
+		{ 0x50a9, 0x0000,   0 }, { 0x50b1, 0x0000,   0 },
+		{ 0x50b9, 0x0000,   0 }, { 0x50c1, 0x0000,   0 },
+		{ 0x50c9, 0x0000,   0 }, { 0x50d1, 0x0000,   0 },
+		{ 0x50d9, 0x0000,   0 }, { 0x50e1, 0x0000,   0 },
+		{ 0x50e9, 0x0000,   0 }, { 0x50f1, 0x0000,   0 },
+		{ 0x50f9, 0x0000,   0 }, { 0x5101, 0x0000,   0 },
+		{ 0x5109, 0x0000,   0 }, { 0x5111, 0x0000,   0 },
+		{ 0x5119, 0x0000,   0 }, { 0x5121, 0x0000,   0 },
+		{ 0x5129, 0x0000,   0 }, { 0x5131, 0x0000,   0 },
+		{ 0x5139, 0x0000,   0 }, { 0x5141, 0x0000,   0 },
+		{ 0x5149, 0x0000,   0 }, { 0x5151, 0x0000,   0 },
+		{ 0x5159, 0x0000,   0 }, { 0x5161, 0x0000,   0 },
+		{ 0x5169, 0x0000,   0 }, { 0x5171, 0x0000,   0 },
+		{ 0x5179, 0x0000,   0 }, { 0x5181, 0x0000,   0 },
+		{ 0x5189, 0x0000,   0 }, { 0x5191, 0x0000,   0 },
+		{ 0x5199, 0x0000,   0 }, { 0x51a1, 0x0000,   0 },
+		{ 0x51a9, 0x0000,   0 }, { 0x51b1, 0x0000,   0 },
+		{ 0x51b9, 0x0000,   0 }, { 0x51c1, 0x0000,   0 },
+		{ 0x51c9, 0x0000,   0 }, { 0x51d1, 0x0000,   0 },
+		{ 0x51d9, 0x0000,   0 }, { 0x51e1, 0x0000,   0 },
+		{ 0x51e9, 0x0000,   0 }, { 0x51f1, 0x0000,   0 },
+		{ 0x51f9, 0x0000,   0 }, { 0x5201, 0x0000,   0 },
+		{ 0x5209, 0x0000,   0 }, { 0x5211, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x5219, 0x0000,   0 }, { 0x5221, 0x0000,   0 },
+		{ 0x5229, 0x0000,   0 }, { 0x5231, 0x0000,   0 },
+		{ 0x5239, 0x0000,   0 }, { 0x5241, 0x0000,   0 },
+		{ 0x5249, 0x0000,   0 }, { 0x5251, 0x0000,   0 },
+		{ 0x5259, 0x0000,   0 }, { 0x5261, 0x0000,   0 },
+		{ 0x5269, 0x0000,   0 }, { 0x5271, 0x0000,   0 },
+		{ 0x5279, 0x0000,   0 }, { 0x5281, 0x0000,   0 },
+		{ 0x5289, 0x0000,   0 }, { 0x5291, 0x0000,   0 },
+	},
+	/* Page 0x80, first used for range 0x0fa80-0x0fabf */
+	{
+		{ 0x5299, 0x0000,   0 }, { 0x52a1, 0x0000,   0 },
+		{ 0x52a9, 0x0000,   0 }, { 0x52b1, 0x0000,   0 },
+		{ 0x52b9, 0x0000,   0 }, { 0x52c1, 0x0000,   0 },
+		{ 0x52c9, 0x0000,   0 }, { 0x52d1, 0x0000,   0 },
+		{ 0x52d9, 0x0000,   0 }, { 0x52e1, 0x0000,   0 },
+		{ 0x52e9, 0x0000,   0 }, { 0x52f1, 0x0000,   0 },
+		{ 0x52f9, 0x0000,   0 }, { 0x5301, 0x0000,   0 },
+		{ 0x5309, 0x0000,   0 }, { 0x5311, 0x0000,   0 },
+		{ 0x5319, 0x0000,   0 }, { 0x5321, 0x0000,   0 },
+		{ 0x5329, 0x0000,   0 }, { 0x5331, 0x0000,   0 },
+		{ 0x5339, 0x0000,   0 }, { 0x5341, 0x0000,   0 },
+		{ 0x5349, 0x0000,   0 }, { 0x5351, 0x0000,   0 },
+		{ 0x5359, 0x0000,   0 }, { 0x5361, 0x0000,   0 },
+		{ 0x5369, 0x0000,   0 }, { 0x5371, 0x0000,   0 },
+		{ 0x5379, 0x0000,   0 }, { 0x5381, 0x0000,   0 },
+		{ 0x5389, 0x0000,   0 }, { 0x5391, 0x0000,   0 },
+		{ 0x5399, 0x0000,   0 }, { 0x53a1, 0x0000,   0 },
+		{ 0x53a9, 0x0000,   0 }, { 0x53b1, 0x0000,   0 },
+		{ 0x53b9, 0x0000,   0 }, { 0x53c1, 0x0000,   0 },
+		{ 0x53c9, 0x0000,   0 }, { 0x53d1, 0x0000,   0 },
+		{ 0x53d9, 0x0000,   0 }, { 0x53e1, 0x0000,   0 },
+		{ 0x53e9, 0x0000,   0 }, { 0x53f1, 0x0000,   0 },
+		{ 0x53f9, 0x0000,   0 }, { 0x5401, 0x0000,   0 },
+		{ 0x5409, 0x0000,   0 }, { 0x5411, 0x0000,   0 },
+		{ 0x5419, 0x0000,   0 }, { 0x5421, 0x0000,   0 },
+		{ 0x5429, 0x0000,   0 }, { 0x5431, 0x0000,   0 },
+		{ 0x5439, 0x0000,   0 }, { 0x5441, 0x0000,   0 },
+		{ 0x5449, 0x0000,   0 }, { 0x5451, 0x0000,   0 },
+		{ 0x5459, 0x0000,   0 }, { 0x5461, 0x0000,   0 },
+		{ 0x5469, 0x0000,   0 }, { 0x5471, 0x0000,   0 },
+		{ 0x5479, 0x0000,   0 }, { 0x5481, 0x0000,   0 },
+		{ 0x5489, 0x0000,   0 }, { 0x5491, 0x0000,   0 },
+	},
+	/* Page 0x81, first used for range 0x0fac0-0x0faff */
+	{
+		{ 0x5499, 0x0000,   0 }, { 0x54a1, 0x0000,   0 },
+		{ 0x54a9, 0x0000,   0 }, { 0x54b1, 0x0000,   0 },
+		{ 0x54b9, 0x0000,   0 }, { 0x54c1, 0x0000,   0 },
+		{ 0x54c9, 0x0000,   0 }, { 0x54d1, 0x0000,   0 },
+		{ 0x54d9, 0x0000,   0 }, { 0x54e1, 0x0000,   0 },
+		{ 0x54e9, 0x0000,   0 }, { 0x54f1, 0x0000,   0 },
+		{ 0x54f9, 0x0000,   0 }, { 0x5501, 0x0000,   0 },
+		{ 0x5509, 0x0000,   0 }, { 0x5511, 0x0000,   0 },
+		{ 0x5519, 0x0000,   0 }, { 0x5521, 0x0000,   0 },
+		{ 0x5529, 0x0000,   0 }, { 0x5531, 0x0000,   0 },
+		{ 0x5539, 0x0000,   0 }, { 0x5541, 0x0000,   0 },
+		{ 0x5549, 0x0000,   0 }, { 0x5551, 0x0000,   0 },
+		{ 0x5559, 0x0000,   0 }, { 0x5561, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x82, first used for range 0x0fb00-0x0fb3f */
+	{
+		{ 0x0000, 0x27e2,   0 }, { 0x0000, 0x27f2,   0 },
+		{ 0x0000, 0x2802,   0 }, { 0x0000, 0x2813,   0 },
+		{ 0x0000, 0x282b,   0 }, { 0x0000, 0x2842,   0 },
+		{ 0x0000, 0x2852,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x2862,   0 },
+		{ 0x0000, 0x2872,   0 }, { 0x0000, 0x2882,   0 },
+		{ 0x0000, 0x2892,   0 }, { 0x0000, 0x28a2,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x556a, 0x0000,   0 },
+		{ 0x0000, 0x0000,  26 }, { 0x557a, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x558a, 0x0000,   0 }, { 0x559a, 0x0000,   0 },
+		{ 0x55ab, 0x0000,   0 }, { 0x55c3, 0x0000,   0 },
+		{ 0x55da, 0x0000,   0 }, { 0x55ea, 0x0000,   0 },
+		{ 0x55fa, 0x0000,   0 }, { 0x560a, 0x0000,   0 },
+		{ 0x561a, 0x0000,   0 }, { 0x562a, 0x0000,   0 },
+		{ 0x563a, 0x0000,   0 }, { 0x564a, 0x0000,   0 },
+		{ 0x565a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x566a, 0x0000,   0 }, { 0x567a, 0x0000,   0 },
+		{ 0x568a, 0x0000,   0 }, { 0x569a, 0x0000,   0 },
+		{ 0x56aa, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x56ba, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x83, first used for range 0x0fb40-0x0fb7f */
+	{
+		{ 0x56ca, 0x0000,   0 }, { 0x56da, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x56ea, 0x0000,   0 },
+		{ 0x56fa, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x570a, 0x0000,   0 }, { 0x571a, 0x0000,   0 },
+		{ 0x572a, 0x0000,   0 }, { 0x573a, 0x0000,   0 },
+		{ 0x574a, 0x0000,   0 }, { 0x575a, 0x0000,   0 },
+		{ 0x576a, 0x0000,   0 }, { 0x577a, 0x0000,   0 },
+		{ 0x578a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x84, first used for range 0x0fe00-0x0fe3f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x85, first used for range 0x0ff00-0x0ff3f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x28b1,   0 },
+		{ 0x0000, 0x28b9,   0 }, { 0x0000, 0x28c1,   0 },
+		{ 0x0000, 0x28c9,   0 }, { 0x0000, 0x28d1,   0 },
+		{ 0x0000, 0x28d9,   0 }, { 0x0000, 0x28e1,   0 },
+		{ 0x0000, 0x28e9,   0 }, { 0x0000, 0x28f1,   0 },
+		{ 0x0000, 0x28f9,   0 }, { 0x0000, 0x2901,   0 },
+		{ 0x0000, 0x2909,   0 }, { 0x0000, 0x2911,   0 },
+		{ 0x0000, 0x2919,   0 }, { 0x0000, 0x2921,   0 },
+		{ 0x0000, 0x2929,   0 }, { 0x0000, 0x2931,   0 },
+		{ 0x0000, 0x2939,   0 }, { 0x0000, 0x2941,   0 },
+		{ 0x0000, 0x2949,   0 }, { 0x0000, 0x2951,   0 },
+		{ 0x0000, 0x2959,   0 }, { 0x0000, 0x2961,   0 },
+		{ 0x0000, 0x2969,   0 }, { 0x0000, 0x2971,   0 },
+		{ 0x0000, 0x2979,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x86, first used for range 0x101c0-0x101ff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x87, first used for range 0x102c0-0x102ff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x88, first used for range 0x10340-0x1037f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x89, first used for range 0x10400-0x1043f */
+	{
+		{ 0x0000, 0x2981,   0 }, { 0x0000, 0x2989,   0 },
+		{ 0x0000, 0x2991,   0 }, { 0x0000, 0x2999,   0 },
+		{ 0x0000, 0x29a1,   0 }, { 0x0000, 0x29a9,   0 },
+		{ 0x0000, 0x29b1,   0 }, { 0x0000, 0x29b9,   0 },
+		{ 0x0000, 0x29c1,   0 }, { 0x0000, 0x29c9,   0 },
+		{ 0x0000, 0x29d1,   0 }, { 0x0000, 0x29d9,   0 },
+		{ 0x0000, 0x29e1,   0 }, { 0x0000, 0x29e9,   0 },
+		{ 0x0000, 0x29f1,   0 }, { 0x0000, 0x29f9,   0 },
+		{ 0x0000, 0x2a01,   0 }, { 0x0000, 0x2a09,   0 },
+		{ 0x0000, 0x2a11,   0 }, { 0x0000, 0x2a19,   0 },
+		{ 0x0000, 0x2a21,   0 }, { 0x0000, 0x2a29,   0 },
+		{ 0x0000, 0x2a31,   0 }, { 0x0000, 0x2a39,   0 },
+		{ 0x0000, 0x2a41,   0 }, { 0x0000, 0x2a49,   0 },
+		{ 0x0000, 0x2a51,   0 }, { 0x0000, 0x2a59,   0 },
+		{ 0x0000, 0x2a61,   0 }, { 0x0000, 0x2a69,   0 },
+		{ 0x0000, 0x2a71,   0 }, { 0x0000, 0x2a79,   0 },
+		{ 0x0000, 0x2a81,   0 }, { 0x0000, 0x2a89,   0 },
+		{ 0x0000, 0x2a91,   0 }, { 0x0000, 0x2a99,   0 },
+		{ 0x0000, 0x2aa1,   0 }, { 0x0000, 0x2aa9,   0 },
+		{ 0x0000, 0x2ab1,   0 }, { 0x0000, 0x2ab9,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x8a, first used for range 0x10480-0x104bf */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2ac1,   0 }, { 0x0000, 0x2ac9,   0 },
+		{ 0x0000, 0x2ad1,   0 }, { 0x0000, 0x2ad9,   0 },
+		{ 0x0000, 0x2ae1,   0 }, { 0x0000, 0x2ae9,   0 },
+		{ 0x0000, 0x2af1,   0 }, { 0x0000, 0x2af9,   0 },
+		{ 0x0000, 0x2b01,   0 }, { 0x0000, 0x2b09,   0 },
+		{ 0x0000, 0x2b11,   0 }, { 0x0000, 0x2b19,   0 },
+		{ 0x0000, 0x2b21,   0 }, { 0x0000, 0x2b29,   0 },
+		{ 0x0000, 0x2b31,   0 }, { 0x0000, 0x2b39,   0 },
+	},
+	/* Page 0x8b, first used for range 0x104c0-0x104ff */
+	{
+		{ 0x0000, 0x2b41,   0 }, { 0x0000, 0x2b49,   0 },
+		{ 0x0000, 0x2b51,   0 }, { 0x0000, 0x2b59,   0 },
+		{ 0x0000, 0x2b61,   0 }, { 0x0000, 0x2b69,   0 },
+		{ 0x0000, 0x2b71,   0 }, { 0x0000, 0x2b79,   0 },
+		{ 0x0000, 0x2b81,   0 }, { 0x0000, 0x2b89,   0 },
+		{ 0x0000, 0x2b91,   0 }, { 0x0000, 0x2b99,   0 },
+		{ 0x0000, 0x2ba1,   0 }, { 0x0000, 0x2ba9,   0 },
+		{ 0x0000, 0x2bb1,   0 }, { 0x0000, 0x2bb9,   0 },
+		{ 0x0000, 0x2bc1,   0 }, { 0x0000, 0x2bc9,   0 },
+		{ 0x0000, 0x2bd1,   0 }, { 0x0000, 0x2bd9,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x8c, first used for range 0x10a00-0x10a3f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000,   1 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   9 },
+	},
+	/* Page 0x8d, first used for range 0x10ac0-0x10aff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x8e, first used for range 0x10c80-0x10cbf */
+	{
+		{ 0x0000, 0x2be1,   0 }, { 0x0000, 0x2be9,   0 },
+		{ 0x0000, 0x2bf1,   0 }, { 0x0000, 0x2bf9,   0 },
+		{ 0x0000, 0x2c01,   0 }, { 0x0000, 0x2c09,   0 },
+		{ 0x0000, 0x2c11,   0 }, { 0x0000, 0x2c19,   0 },
+		{ 0x0000, 0x2c21,   0 }, { 0x0000, 0x2c29,   0 },
+		{ 0x0000, 0x2c31,   0 }, { 0x0000, 0x2c39,   0 },
+		{ 0x0000, 0x2c41,   0 }, { 0x0000, 0x2c49,   0 },
+		{ 0x0000, 0x2c51,   0 }, { 0x0000, 0x2c59,   0 },
+		{ 0x0000, 0x2c61,   0 }, { 0x0000, 0x2c69,   0 },
+		{ 0x0000, 0x2c71,   0 }, { 0x0000, 0x2c79,   0 },
+		{ 0x0000, 0x2c81,   0 }, { 0x0000, 0x2c89,   0 },
+		{ 0x0000, 0x2c91,   0 }, { 0x0000, 0x2c99,   0 },
+		{ 0x0000, 0x2ca1,   0 }, { 0x0000, 0x2ca9,   0 },
+		{ 0x0000, 0x2cb1,   0 }, { 0x0000, 0x2cb9,   0 },
+		{ 0x0000, 0x2cc1,   0 }, { 0x0000, 0x2cc9,   0 },
+		{ 0x0000, 0x2cd1,   0 }, { 0x0000, 0x2cd9,   0 },
+		{ 0x0000, 0x2ce1,   0 }, { 0x0000, 0x2ce9,   0 },
+		{ 0x0000, 0x2cf1,   0 }, { 0x0000, 0x2cf9,   0 },
+		{ 0x0000, 0x2d01,   0 }, { 0x0000, 0x2d09,   0 },
+		{ 0x0000, 0x2d11,   0 }, { 0x0000, 0x2d19,   0 },
+		{ 0x0000, 0x2d21,   0 }, { 0x0000, 0x2d29,   0 },
+		{ 0x0000, 0x2d31,   0 }, { 0x0000, 0x2d39,   0 },
+		{ 0x0000, 0x2d41,   0 }, { 0x0000, 0x2d49,   0 },
+		{ 0x0000, 0x2d51,   0 }, { 0x0000, 0x2d59,   0 },
+		{ 0x0000, 0x2d61,   0 }, { 0x0000, 0x2d69,   0 },
+		{ 0x0000, 0x2d71,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x8f, first used for range 0x11040-0x1107f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   9 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   9 },
+	},
+	/* Page 0x90, first used for range 0x11080-0x110bf */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x579a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x57aa, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x57ba, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   9 },
+		{ 0x0000, 0x0000,   7 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x91, first used for range 0x11100-0x1113f */
+	{
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x57ca, 0x0000,   0 }, { 0x57da, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   9 },
+		{ 0x0000, 0x0000,   9 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x92, first used for range 0x111c0-0x111ff */
+	{
+		{ 0x0000, 0x0000,   9 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   7 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x93, first used for range 0x11200-0x1123f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   9 },
+		{ 0x0000, 0x0000,   7 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x94, first used for range 0x112c0-0x112ff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   7 },
+		{ 0x0000, 0x0000,   9 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x95, first used for range 0x11340-0x1137f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x57ea, 0x0000,   0 },
+		{ 0x57fa, 0x0000,   0 }, { 0x0000, 0x0000,   9 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x96, first used for range 0x11440-0x1147f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   9 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   7 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x97, first used for range 0x11480-0x114bf */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x580a, 0x0000,   0 },
+		{ 0x581a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x582a, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x98, first used for range 0x114c0-0x114ff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   9 }, { 0x0000, 0x0000,   7 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x99, first used for range 0x11580-0x115bf */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x583a, 0x0000,   0 }, { 0x584a, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   9 },
+	},
+	/* Page 0x9a, first used for range 0x115c0-0x115ff */
+	{
+		{ 0x0000, 0x0000,   7 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x9b, first used for range 0x11680-0x116bf */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   9 }, { 0x0000, 0x0000,   7 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x9c, first used for range 0x11700-0x1173f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   9 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x9d, first used for range 0x11880-0x118bf */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x2d79,   0 }, { 0x0000, 0x2d81,   0 },
+		{ 0x0000, 0x2d89,   0 }, { 0x0000, 0x2d91,   0 },
+		{ 0x0000, 0x2d99,   0 }, { 0x0000, 0x2da1,   0 },
+		{ 0x0000, 0x2da9,   0 }, { 0x0000, 0x2db1,   0 },
+		{ 0x0000, 0x2db9,   0 }, { 0x0000, 0x2dc1,   0 },
+		{ 0x0000, 0x2dc9,   0 }, { 0x0000, 0x2dd1,   0 },
+		{ 0x0000, 0x2dd9,   0 }, { 0x0000, 0x2de1,   0 },
+		{ 0x0000, 0x2de9,   0 }, { 0x0000, 0x2df1,   0 },
+		{ 0x0000, 0x2df9,   0 }, { 0x0000, 0x2e01,   0 },
+		{ 0x0000, 0x2e09,   0 }, { 0x0000, 0x2e11,   0 },
+		{ 0x0000, 0x2e19,   0 }, { 0x0000, 0x2e21,   0 },
+		{ 0x0000, 0x2e29,   0 }, { 0x0000, 0x2e31,   0 },
+		{ 0x0000, 0x2e39,   0 }, { 0x0000, 0x2e41,   0 },
+		{ 0x0000, 0x2e49,   0 }, { 0x0000, 0x2e51,   0 },
+		{ 0x0000, 0x2e59,   0 }, { 0x0000, 0x2e61,   0 },
+		{ 0x0000, 0x2e69,   0 }, { 0x0000, 0x2e71,   0 },
+	},
+	/* Page 0x9e, first used for range 0x16ac0-0x16aff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   1 }, { 0x0000, 0x0000,   1 },
+		{ 0x0000, 0x0000,   1 }, { 0x0000, 0x0000,   1 },
+		{ 0x0000, 0x0000,   1 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0x9f, first used for range 0x16b00-0x16b3f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0xa0, first used for range 0x1bc80-0x1bcbf */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   1 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0xa1, first used for range 0x1d140-0x1d17f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x585a, 0x0000,   0 }, { 0x586a, 0x0000,   0 },
+		{ 0x587b, 0x0000,   0 }, { 0x5893, 0x0000,   0 },
+		{ 0x58ab, 0x0000,   0 }, { 0x58c3, 0x0000,   0 },
+		{ 0x58db, 0x0000,   0 }, { 0x0000, 0x0000, 216 },
+		{ 0x0000, 0x0000, 216 }, { 0x0000, 0x0000,   1 },
+		{ 0x0000, 0x0000,   1 }, { 0x0000, 0x0000,   1 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 226 },
+		{ 0x0000, 0x0000, 216 }, { 0x0000, 0x0000, 216 },
+		{ 0x0000, 0x0000, 216 }, { 0x0000, 0x0000, 216 },
+		{ 0x0000, 0x0000, 216 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+	},
+	/* Page 0xa2, first used for range 0x1d180-0x1d1bf */
+	{
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x58f2, 0x0000,   0 },
+		{ 0x5902, 0x0000,   0 }, { 0x5913, 0x0000,   0 },
+		{ 0x592b, 0x0000,   0 }, { 0x5943, 0x0000,   0 },
+	},
+	/* Page 0xa3, first used for range 0x1d1c0-0x1d1ff */
+	{
+		{ 0x595b, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0xa4, first used for range 0x1d240-0x1d27f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0xa5, first used for range 0x1e000-0x1e03f */
+	{
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0xa6, first used for range 0x1e8c0-0x1e8ff */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000, 220 },
+		{ 0x0000, 0x0000, 220 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0xa7, first used for range 0x1e900-0x1e93f */
+	{
+		{ 0x0000, 0x2e79,   0 }, { 0x0000, 0x2e81,   0 },
+		{ 0x0000, 0x2e89,   0 }, { 0x0000, 0x2e91,   0 },
+		{ 0x0000, 0x2e99,   0 }, { 0x0000, 0x2ea1,   0 },
+		{ 0x0000, 0x2ea9,   0 }, { 0x0000, 0x2eb1,   0 },
+		{ 0x0000, 0x2eb9,   0 }, { 0x0000, 0x2ec1,   0 },
+		{ 0x0000, 0x2ec9,   0 }, { 0x0000, 0x2ed1,   0 },
+		{ 0x0000, 0x2ed9,   0 }, { 0x0000, 0x2ee1,   0 },
+		{ 0x0000, 0x2ee9,   0 }, { 0x0000, 0x2ef1,   0 },
+		{ 0x0000, 0x2ef9,   0 }, { 0x0000, 0x2f01,   0 },
+		{ 0x0000, 0x2f09,   0 }, { 0x0000, 0x2f11,   0 },
+		{ 0x0000, 0x2f19,   0 }, { 0x0000, 0x2f21,   0 },
+		{ 0x0000, 0x2f29,   0 }, { 0x0000, 0x2f31,   0 },
+		{ 0x0000, 0x2f39,   0 }, { 0x0000, 0x2f41,   0 },
+		{ 0x0000, 0x2f49,   0 }, { 0x0000, 0x2f51,   0 },
+		{ 0x0000, 0x2f59,   0 }, { 0x0000, 0x2f61,   0 },
+		{ 0x0000, 0x2f69,   0 }, { 0x0000, 0x2f71,   0 },
+		{ 0x0000, 0x2f79,   0 }, { 0x0000, 0x2f81,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0xa8, first used for range 0x1e940-0x1e97f */
+	{
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000, 230 }, { 0x0000, 0x0000, 230 },
+		{ 0x0000, 0x0000,   7 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
+	/* Page 0xa9, first used for range 0x2f800-0x2f83f */
+	{
+		{ 0x5971, 0x0000,   0 }, { 0x5979, 0x0000,   0 },
+		{ 0x5981, 0x0000,   0 }, { 0x5989, 0x0000,   0 },
+		{ 0x5991, 0x0000,   0 }, { 0x5999, 0x0000,   0 },
+		{ 0x59a1, 0x0000,   0 }, { 0x59a9, 0x0000,   0 },
+		{ 0x59b1, 0x0000,   0 }, { 0x59b9, 0x0000,   0 },
+		{ 0x59c1, 0x0000,   0 }, { 0x59c9, 0x0000,   0 },
+		{ 0x59d1, 0x0000,   0 }, { 0x59d9, 0x0000,   0 },
+		{ 0x59e1, 0x0000,   0 }, { 0x59e9, 0x0000,   0 },
+		{ 0x59f1, 0x0000,   0 }, { 0x59f9, 0x0000,   0 },
+		{ 0x5a01, 0x0000,   0 }, { 0x5a09, 0x0000,   0 },
+		{ 0x5a11, 0x0000,   0 }, { 0x5a19, 0x0000,   0 },
+		{ 0x5a21, 0x0000,   0 }, { 0x5a29, 0x0000,   0 },
+		{ 0x5a31, 0x0000,   0 }, { 0x5a39, 0x0000,   0 },
+		{ 0x5a41, 0x0000,   0 }, { 0x5a49, 0x0000,   0 },
+		{ 0x5a51, 0x0000,   0 }, { 0x5a59, 0x0000,   0 },
+		{ 0x5a61, 0x0000,   0 }, { 0x5a69, 0x0000,   0 },
+		{ 0x5a71, 0x0000,   0 }, { 0x5a79, 0x0000,   0 },
+		{ 0x5a81, 0x0000,   0 }, { 0x5a89, 0x0000,   0 },
+		{ 0x5a91, 0x0000,   0 }, { 0x5a99, 0x0000,   0 },
+		{ 0x5aa1, 0x0000,   0 }, { 0x5aa9, 0x0000,   0 },
+		{ 0x5ab1, 0x0000,   0 }, { 0x5ab9, 0x0000,   0 },
+		{ 0x5ac1, 0x0000,   0 }, { 0x5ac9, 0x0000,   0 },
+		{ 0x5ad1, 0x0000,   0 }, { 0x5ad9, 0x0000,   0 },
+		{ 0x5ae1, 0x0000,   0 }, { 0x5ae9, 0x0000,   0 },
+		{ 0x5af1, 0x0000,   0 }, { 0x5af9, 0x0000,   0 },
+		{ 0x5b01, 0x0000,   0 }, { 0x5b09, 0x0000,   0 },
+		{ 0x5b11, 0x0000,   0 }, { 0x5b19, 0x0000,   0 },
+		{ 0x5b21, 0x0000,   0 }, { 0x5b29, 0x0000,   0 },
+		{ 0x5b31, 0x0000,   0 }, { 0x5b39, 0x0000,   0 },
+		{ 0x5b41, 0x0000,   0 }, { 0x5b49, 0x0000,   0 },
+		{ 0x5b51, 0x0000,   0 }, { 0x5b59, 0x0000,   0 },
+		{ 0x5b61, 0x0000,   0 }, { 0x5b69, 0x0000,   0 },
+	},
+	/* Page 0xaa, first used for range 0x2f840-0x2f87f */
+	{
+		{ 0x5b71, 0x0000,   0 }, { 0x5b79, 0x0000,   0 },
+		{ 0x5b81, 0x0000,   0 }, { 0x5b89, 0x0000,   0 },
+		{ 0x5b91, 0x0000,   0 }, { 0x5b99, 0x0000,   0 },
+		{ 0x5ba1, 0x0000,   0 }, { 0x5ba9, 0x0000,   0 },
+		{ 0x5bb1, 0x0000,   0 }, { 0x5bb9, 0x0000,   0 },
+		{ 0x5bc1, 0x0000,   0 }, { 0x5bc9, 0x0000,   0 },
+		{ 0x5bd1, 0x0000,   0 }, { 0x5bd9, 0x0000,   0 },
+		{ 0x5be1, 0x0000,   0 }, { 0x5be9, 0x0000,   0 },
+		{ 0x5bf1, 0x0000,   0 }, { 0x5bf9, 0x0000,   0 },
+		{ 0x5c01, 0x0000,   0 }, { 0x5c09, 0x0000,   0 },
+		{ 0x5c11, 0x0000,   0 }, { 0x5c19, 0x0000,   0 },
+		{ 0x5c21, 0x0000,   0 }, { 0x5c29, 0x0000,   0 },
+		{ 0x5c31, 0x0000,   0 }, { 0x5c39, 0x0000,   0 },
+		{ 0x5c41, 0x0000,   0 }, { 0x5c49, 0x0000,   0 },
+		{ 0x5c51, 0x0000,   0 }, { 0x5c59, 0x0000,   0 },
+		{ 0x5c61, 0x0000,   0 }, { 0x5c69, 0x0000,   0 },
+		{ 0x5c71, 0x0000,   0 }, { 0x5c79, 0x0000,   0 },
+		{ 0x5c81, 0x0000,   0 }, { 0x5c89, 0x0000,   0 },
+		{ 0x5c91, 0x0000,   0 }, { 0x5c99, 0x0000,   0 },
+		{ 0x5ca1, 0x0000,   0 }, { 0x5ca9, 0x0000,   0 },
+		{ 0x5cb1, 0x0000,   0 }, { 0x5cb9, 0x0000,   0 },
+		{ 0x5cc1, 0x0000,   0 }, { 0x5cc9, 0x0000,   0 },
+		{ 0x5cd1, 0x0000,   0 }, { 0x5cd9, 0x0000,   0 },
+		{ 0x5ce1, 0x0000,   0 }, { 0x5ce9, 0x0000,   0 },
+		{ 0x5cf1, 0x0000,   0 }, { 0x5cf9, 0x0000,   0 },
+		{ 0x5d01, 0x0000,   0 }, { 0x5d09, 0x0000,   0 },
+		{ 0x5d11, 0x0000,   0 }, { 0x5d19, 0x0000,   0 },
+		{ 0x5d21, 0x0000,   0 }, { 0x5d29, 0x0000,   0 },
+		{ 0x5d31, 0x0000,   0 }, { 0x5d39, 0x0000,   0 },
+		{ 0x5d41, 0x0000,   0 }, { 0x5d49, 0x0000,   0 },
+		{ 0x5d51, 0x0000,   0 }, { 0x5d59, 0x0000,   0 },
+		{ 0x5d61, 0x0000,   0 }, { 0x5d69, 0x0000,   0 },
+	},
+	/* Page 0xab, first used for range 0x2f880-0x2f8bf */
+	{
+		{ 0x5d71, 0x0000,   0 }, { 0x5d79, 0x0000,   0 },
+		{ 0x5d81, 0x0000,   0 }, { 0x5d89, 0x0000,   0 },
+		{ 0x5d91, 0x0000,   0 }, { 0x5d99, 0x0000,   0 },
+		{ 0x5da1, 0x0000,   0 }, { 0x5da9, 0x0000,   0 },
+		{ 0x5db1, 0x0000,   0 }, { 0x5db9, 0x0000,   0 },
+		{ 0x5dc1, 0x0000,   0 }, { 0x5dc9, 0x0000,   0 },
+		{ 0x5dd1, 0x0000,   0 }, { 0x5dd9, 0x0000,   0 },
+		{ 0x5de1, 0x0000,   0 }, { 0x5de9, 0x0000,   0 },
+		{ 0x5df1, 0x0000,   0 }, { 0x5df9, 0x0000,   0 },
+		{ 0x5e01, 0x0000,   0 }, { 0x5e09, 0x0000,   0 },
+		{ 0x5e11, 0x0000,   0 }, { 0x5e19, 0x0000,   0 },
+		{ 0x5e21, 0x0000,   0 }, { 0x5e29, 0x0000,   0 },
+		{ 0x5e31, 0x0000,   0 }, { 0x5e39, 0x0000,   0 },
+		{ 0x5e41, 0x0000,   0 }, { 0x5e49, 0x0000,   0 },
+		{ 0x5e51, 0x0000,   0 }, { 0x5e59, 0x0000,   0 },
+		{ 0x5e61, 0x0000,   0 }, { 0x5e69, 0x0000,   0 },
+		{ 0x5e71, 0x0000,   0 }, { 0x5e79, 0x0000,   0 },
+		{ 0x5e81, 0x0000,   0 }, { 0x5e89, 0x0000,   0 },
+		{ 0x5e91, 0x0000,   0 }, { 0x5e99, 0x0000,   0 },
+		{ 0x5ea1, 0x0000,   0 }, { 0x5ea9, 0x0000,   0 },
+		{ 0x5eb1, 0x0000,   0 }, { 0x5eb9, 0x0000,   0 },
+		{ 0x5ec1, 0x0000,   0 }, { 0x5ec9, 0x0000,   0 },
+		{ 0x5ed1, 0x0000,   0 }, { 0x5ed9, 0x0000,   0 },
+		{ 0x5ee1, 0x0000,   0 }, { 0x5ee9, 0x0000,   0 },
+		{ 0x5ef1, 0x0000,   0 }, { 0x5ef9, 0x0000,   0 },
+		{ 0x5f01, 0x0000,   0 }, { 0x5f09, 0x0000,   0 },
+		{ 0x5f11, 0x0000,   0 }, { 0x5f19, 0x0000,   0 },
+		{ 0x5f21, 0x0000,   0 }, { 0x5f29, 0x0000,   0 },
+		{ 0x5f31, 0x0000,   0 }, { 0x5f39, 0x0000,   0 },
+		{ 0x5f41, 0x0000,   0 }, { 0x5f49, 0x0000,   0 },
+		{ 0x5f51, 0x0000,   0 }, { 0x5f59, 0x0000,   0 },
+		{ 0x5f61, 0x0000,   0 }, { 0x5f69, 0x0000,   0 },
+	},
+	/* Page 0xac, first used for range 0x2f8c0-0x2f8ff */
+	{
+		{ 0x5f71, 0x0000,   0 }, { 0x5f79, 0x0000,   0 },
+		{ 0x5f81, 0x0000,   0 }, { 0x5f89, 0x0000,   0 },
+		{ 0x5f91, 0x0000,   0 }, { 0x5f99, 0x0000,   0 },
+		{ 0x5fa1, 0x0000,   0 }, { 0x5fa9, 0x0000,   0 },
+		{ 0x5fb1, 0x0000,   0 }, { 0x5fb9, 0x0000,   0 },
+		{ 0x5fc1, 0x0000,   0 }, { 0x5fc9, 0x0000,   0 },
+		{ 0x5fd1, 0x0000,   0 }, { 0x5fd9, 0x0000,   0 },
+		{ 0x5fe1, 0x0000,   0 }, { 0x5fe9, 0x0000,   0 },
+		{ 0x5ff1, 0x0000,   0 }, { 0x5ff9, 0x0000,   0 },
+		{ 0x6001, 0x0000,   0 }, { 0x6009, 0x0000,   0 },
+		{ 0x6011, 0x0000,   0 }, { 0x6019, 0x0000,   0 },
+		{ 0x6021, 0x0000,   0 }, { 0x6029, 0x0000,   0 },
+		{ 0x6031, 0x0000,   0 }, { 0x6039, 0x0000,   0 },
+		{ 0x6041, 0x0000,   0 }, { 0x6049, 0x0000,   0 },
+		{ 0x6051, 0x0000,   0 }, { 0x6059, 0x0000,   0 },
+		{ 0x6061, 0x0000,   0 }, { 0x6069, 0x0000,   0 },
+		{ 0x6071, 0x0000,   0 }, { 0x6079, 0x0000,   0 },
+		{ 0x6081, 0x0000,   0 }, { 0x6089, 0x0000,   0 },
+		{ 0x6091, 0x0000,   0 }, { 0x6099, 0x0000,   0 },
+		{ 0x60a1, 0x0000,   0 }, { 0x60a9, 0x0000,   0 },
+		{ 0x60b1, 0x0000,   0 }, { 0x60b9, 0x0000,   0 },
+		{ 0x60c1, 0x0000,   0 }, { 0x60c9, 0x0000,   0 },
+		{ 0x60d1, 0x0000,   0 }, { 0x60d9, 0x0000,   0 },
+		{ 0x60e1, 0x0000,   0 }, { 0x60e9, 0x0000,   0 },
+		{ 0x60f1, 0x0000,   0 }, { 0x60f9, 0x0000,   0 },
+		{ 0x6101, 0x0000,   0 }, { 0x6109, 0x0000,   0 },
+		{ 0x6111, 0x0000,   0 }, { 0x6119, 0x0000,   0 },
+		{ 0x6121, 0x0000,   0 }, { 0x6129, 0x0000,   0 },
+		{ 0x6131, 0x0000,   0 }, { 0x6139, 0x0000,   0 },
+		{ 0x6141, 0x0000,   0 }, { 0x6149, 0x0000,   0 },
+		{ 0x6151, 0x0000,   0 }, { 0x6159, 0x0000,   0 },
+		{ 0x6161, 0x0000,   0 }, { 0x6169, 0x0000,   0 },
+	},
+	/* Page 0xad, first used for range 0x2f900-0x2f93f */
+	{
+		{ 0x6171, 0x0000,   0 }, { 0x6179, 0x0000,   0 },
+		{ 0x6181, 0x0000,   0 }, { 0x6189, 0x0000,   0 },
+		{ 0x6191, 0x0000,   0 }, { 0x6199, 0x0000,   0 },
+		{ 0x61a1, 0x0000,   0 }, { 0x61a9, 0x0000,   0 },
+		{ 0x61b1, 0x0000,   0 }, { 0x61b9, 0x0000,   0 },
+		{ 0x61c1, 0x0000,   0 }, { 0x61c9, 0x0000,   0 },
+		{ 0x61d1, 0x0000,   0 }, { 0x61d9, 0x0000,   0 },
+		{ 0x61e1, 0x0000,   0 }, { 0x61e9, 0x0000,   0 },
+		{ 0x61f1, 0x0000,   0 }, { 0x61f9, 0x0000,   0 },
+		{ 0x6201, 0x0000,   0 }, { 0x6209, 0x0000,   0 },
+		{ 0x6211, 0x0000,   0 }, { 0x6219, 0x0000,   0 },
+		{ 0x6221, 0x0000,   0 }, { 0x6229, 0x0000,   0 },
+		{ 0x6231, 0x0000,   0 }, { 0x6239, 0x0000,   0 },
+		{ 0x6241, 0x0000,   0 }, { 0x6249, 0x0000,   0 },
+		{ 0x6251, 0x0000,   0 }, { 0x6259, 0x0000,   0 },
+		{ 0x6261, 0x0000,   0 }, { 0x6269, 0x0000,   0 },
+		{ 0x6271, 0x0000,   0 }, { 0x6279, 0x0000,   0 },
+		{ 0x6281, 0x0000,   0 }, { 0x6289, 0x0000,   0 },
+		{ 0x6291, 0x0000,   0 }, { 0x6299, 0x0000,   0 },
+		{ 0x62a1, 0x0000,   0 }, { 0x62a9, 0x0000,   0 },
+		{ 0x62b1, 0x0000,   0 }, { 0x62b9, 0x0000,   0 },
+		{ 0x62c1, 0x0000,   0 }, { 0x62c9, 0x0000,   0 },
+		{ 0x62d1, 0x0000,   0 }, { 0x62d9, 0x0000,   0 },
+		{ 0x62e1, 0x0000,   0 }, { 0x62e9, 0x0000,   0 },
+		{ 0x62f1, 0x0000,   0 }, { 0x62f9, 0x0000,   0 },
+		{ 0x6301, 0x0000,   0 }, { 0x6309, 0x0000,   0 },
+		{ 0x6311, 0x0000,   0 }, { 0x6319, 0x0000,   0 },
+		{ 0x6321, 0x0000,   0 }, { 0x6329, 0x0000,   0 },
+		{ 0x6331, 0x0000,   0 }, { 0x6339, 0x0000,   0 },
+		{ 0x6341, 0x0000,   0 }, { 0x6349, 0x0000,   0 },
+		{ 0x6351, 0x0000,   0 }, { 0x6359, 0x0000,   0 },
+		{ 0x6361, 0x0000,   0 }, { 0x6369, 0x0000,   0 },
+	},
+	/* Page 0xae, first used for range 0x2f940-0x2f97f */
+	{
+		{ 0x6371, 0x0000,   0 }, { 0x6379, 0x0000,   0 },
+		{ 0x6381, 0x0000,   0 }, { 0x6389, 0x0000,   0 },
+		{ 0x6391, 0x0000,   0 }, { 0x6399, 0x0000,   0 },
+		{ 0x63a1, 0x0000,   0 }, { 0x63a9, 0x0000,   0 },
+		{ 0x63b1, 0x0000,   0 }, { 0x63b9, 0x0000,   0 },
+		{ 0x63c1, 0x0000,   0 }, { 0x63c9, 0x0000,   0 },
+		{ 0x63d1, 0x0000,   0 }, { 0x63d9, 0x0000,   0 },
+		{ 0x63e1, 0x0000,   0 }, { 0x63e9, 0x0000,   0 },
+		{ 0x63f1, 0x0000,   0 }, { 0x63f9, 0x0000,   0 },
+		{ 0x6401, 0x0000,   0 }, { 0x6409, 0x0000,   0 },
+		{ 0x6411, 0x0000,   0 }, { 0x6419, 0x0000,   0 },
+		{ 0x6421, 0x0000,   0 }, { 0x6429, 0x0000,   0 },
+		{ 0x6431, 0x0000,   0 }, { 0x6439, 0x0000,   0 },
+		{ 0x6441, 0x0000,   0 }, { 0x6449, 0x0000,   0 },
+		{ 0x6451, 0x0000,   0 }, { 0x6459, 0x0000,   0 },
+		{ 0x6461, 0x0000,   0 }, { 0x6469, 0x0000,   0 },
+		{ 0x6471, 0x0000,   0 }, { 0x6479, 0x0000,   0 },
+		{ 0x6481, 0x0000,   0 }, { 0x6489, 0x0000,   0 },
+		{ 0x6491, 0x0000,   0 }, { 0x6499, 0x0000,   0 },
+		{ 0x64a1, 0x0000,   0 }, { 0x64a9, 0x0000,   0 },
+		{ 0x64b1, 0x0000,   0 }, { 0x64b9, 0x0000,   0 },
+		{ 0x64c1, 0x0000,   0 }, { 0x64c9, 0x0000,   0 },
+		{ 0x64d1, 0x0000,   0 }, { 0x64d9, 0x0000,   0 },
+		{ 0x64e1, 0x0000,   0 }, { 0x64e9, 0x0000,   0 },
+		{ 0x64f1, 0x0000,   0 }, { 0x64f9, 0x0000,   0 },
+		{ 0x6501, 0x0000,   0 }, { 0x6509, 0x0000,   0 },
+		{ 0x6511, 0x0000,   0 }, { 0x6519, 0x0000,   0 },
+		{ 0x6521, 0x0000,   0 }, { 0x6529, 0x0000,   0 },
+		{ 0x6531, 0x0000,   0 }, { 0x6539, 0x0000,   0 },
+		{ 0x6541, 0x0000,   0 }, { 0x6549, 0x0000,   0 },
+		{ 0x6551, 0x0000,   0 }, { 0x6559, 0x0000,   0 },
+		{ 0x6561, 0x0000,   0 }, { 0x6569, 0x0000,   0 },
+	},
+	/* Page 0xaf, first used for range 0x2f980-0x2f9bf */
+	{
+		{ 0x6571, 0x0000,   0 }, { 0x6579, 0x0000,   0 },
+		{ 0x6581, 0x0000,   0 }, { 0x6589, 0x0000,   0 },
+		{ 0x6591, 0x0000,   0 }, { 0x6599, 0x0000,   0 },
+		{ 0x65a1, 0x0000,   0 }, { 0x65a9, 0x0000,   0 },
+		{ 0x65b1, 0x0000,   0 }, { 0x65b9, 0x0000,   0 },
+		{ 0x65c1, 0x0000,   0 }, { 0x65c9, 0x0000,   0 },
+		{ 0x65d1, 0x0000,   0 }, { 0x65d9, 0x0000,   0 },
+		{ 0x65e1, 0x0000,   0 }, { 0x65e9, 0x0000,   0 },
+		{ 0x65f1, 0x0000,   0 }, { 0x65f9, 0x0000,   0 },
+		{ 0x6601, 0x0000,   0 }, { 0x6609, 0x0000,   0 },
+		{ 0x6611, 0x0000,   0 }, { 0x6619, 0x0000,   0 },
+		{ 0x6621, 0x0000,   0 }, { 0x6629, 0x0000,   0 },
+		{ 0x6631, 0x0000,   0 }, { 0x6639, 0x0000,   0 },
+		{ 0x6641, 0x0000,   0 }, { 0x6649, 0x0000,   0 },
+		{ 0x6651, 0x0000,   0 }, { 0x6659, 0x0000,   0 },
+		{ 0x6661, 0x0000,   0 }, { 0x6669, 0x0000,   0 },
+		{ 0x6671, 0x0000,   0 }, { 0x6679, 0x0000,   0 },
+		{ 0x6681, 0x0000,   0 }, { 0x6689, 0x0000,   0 },
+		{ 0x6691, 0x0000,   0 }, { 0x6699, 0x0000,   0 },
+		{ 0x66a1, 0x0000,   0 }, { 0x66a9, 0x0000,   0 },
+		{ 0x66b1, 0x0000,   0 }, { 0x66b9, 0x0000,   0 },
+		{ 0x66c1, 0x0000,   0 }, { 0x66c9, 0x0000,   0 },
+		{ 0x66d1, 0x0000,   0 }, { 0x66d9, 0x0000,   0 },
+		{ 0x66e1, 0x0000,   0 }, { 0x66e9, 0x0000,   0 },
+		{ 0x66f1, 0x0000,   0 }, { 0x66f9, 0x0000,   0 },
+		{ 0x6701, 0x0000,   0 }, { 0x6709, 0x0000,   0 },
+		{ 0x6711, 0x0000,   0 }, { 0x6719, 0x0000,   0 },
+		{ 0x6721, 0x0000,   0 }, { 0x6729, 0x0000,   0 },
+		{ 0x6731, 0x0000,   0 }, { 0x6739, 0x0000,   0 },
+		{ 0x6741, 0x0000,   0 }, { 0x6749, 0x0000,   0 },
+		{ 0x6751, 0x0000,   0 }, { 0x6759, 0x0000,   0 },
+		{ 0x6761, 0x0000,   0 }, { 0x6769, 0x0000,   0 },
+	},
+	/* Page 0xb0, first used for range 0x2f9c0-0x2f9ff */
+	{
+		{ 0x6771, 0x0000,   0 }, { 0x6779, 0x0000,   0 },
+		{ 0x6781, 0x0000,   0 }, { 0x6789, 0x0000,   0 },
+		{ 0x6791, 0x0000,   0 }, { 0x6799, 0x0000,   0 },
+		{ 0x67a1, 0x0000,   0 }, { 0x67a9, 0x0000,   0 },
+		{ 0x67b1, 0x0000,   0 }, { 0x67b9, 0x0000,   0 },
+		{ 0x67c1, 0x0000,   0 }, { 0x67c9, 0x0000,   0 },
+		{ 0x67d1, 0x0000,   0 }, { 0x67d9, 0x0000,   0 },
+		{ 0x67e1, 0x0000,   0 }, { 0x67e9, 0x0000,   0 },
+		{ 0x67f1, 0x0000,   0 }, { 0x67f9, 0x0000,   0 },
+		{ 0x6801, 0x0000,   0 }, { 0x6809, 0x0000,   0 },
+		{ 0x6811, 0x0000,   0 }, { 0x6819, 0x0000,   0 },
+		{ 0x6821, 0x0000,   0 }, { 0x6829, 0x0000,   0 },
+		{ 0x6831, 0x0000,   0 }, { 0x6839, 0x0000,   0 },
+		{ 0x6841, 0x0000,   0 }, { 0x6849, 0x0000,   0 },
+		{ 0x6851, 0x0000,   0 }, { 0x6859, 0x0000,   0 },
+		{ 0x6861, 0x0000,   0 }, { 0x6869, 0x0000,   0 },
+		{ 0x6871, 0x0000,   0 }, { 0x6879, 0x0000,   0 },
+		{ 0x6881, 0x0000,   0 }, { 0x6889, 0x0000,   0 },
+		{ 0x6891, 0x0000,   0 }, { 0x6899, 0x0000,   0 },
+		{ 0x68a1, 0x0000,   0 }, { 0x68a9, 0x0000,   0 },
+		{ 0x68b1, 0x0000,   0 }, { 0x68b9, 0x0000,   0 },
+		{ 0x68c1, 0x0000,   0 }, { 0x68c9, 0x0000,   0 },
+		{ 0x68d1, 0x0000,   0 }, { 0x68d9, 0x0000,   0 },
+		{ 0x68e1, 0x0000,   0 }, { 0x68e9, 0x0000,   0 },
+		{ 0x68f1, 0x0000,   0 }, { 0x68f9, 0x0000,   0 },
+		{ 0x6901, 0x0000,   0 }, { 0x6909, 0x0000,   0 },
+		{ 0x6911, 0x0000,   0 }, { 0x6919, 0x0000,   0 },
+		{ 0x6921, 0x0000,   0 }, { 0x6929, 0x0000,   0 },
+		{ 0x6931, 0x0000,   0 }, { 0x6939, 0x0000,   0 },
+		{ 0x6941, 0x0000,   0 }, { 0x6949, 0x0000,   0 },
+		{ 0x6951, 0x0000,   0 }, { 0x6959, 0x0000,   0 },
+		{ 0x6961, 0x0000,   0 }, { 0x6969, 0x0000,   0 },
+	},
+	/* Page 0xb1, first used for range 0x2fa00-0x2fa3f */
+	{
+		{ 0x6971, 0x0000,   0 }, { 0x6979, 0x0000,   0 },
+		{ 0x6981, 0x0000,   0 }, { 0x6989, 0x0000,   0 },
+		{ 0x6991, 0x0000,   0 }, { 0x6999, 0x0000,   0 },
+		{ 0x69a1, 0x0000,   0 }, { 0x69a9, 0x0000,   0 },
+		{ 0x69b1, 0x0000,   0 }, { 0x69b9, 0x0000,   0 },
+		{ 0x69c1, 0x0000,   0 }, { 0x69c9, 0x0000,   0 },
+		{ 0x69d1, 0x0000,   0 }, { 0x69d9, 0x0000,   0 },
+		{ 0x69e1, 0x0000,   0 }, { 0x69e9, 0x0000,   0 },
+		{ 0x69f1, 0x0000,   0 }, { 0x69f9, 0x0000,   0 },
+		{ 0x6a01, 0x0000,   0 }, { 0x6a09, 0x0000,   0 },
+		{ 0x6a11, 0x0000,   0 }, { 0x6a19, 0x0000,   0 },
+		{ 0x6a21, 0x0000,   0 }, { 0x6a29, 0x0000,   0 },
+		{ 0x6a31, 0x0000,   0 }, { 0x6a39, 0x0000,   0 },
+		{ 0x6a41, 0x0000,   0 }, { 0x6a49, 0x0000,   0 },
+		{ 0x6a51, 0x0000,   0 }, { 0x6a59, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+		{ 0x0000, 0x0000,   0 }, { 0x0000, 0x0000,   0 },
+	},
 };
 
 static unicode_t apfs_nfd[] = {
@@ -1673,561 +7804,6 @@ static unicode_t apfs_nfd[] = {
 	0x009f3b, 0x02a600,
 };
 
-static u16 apfs_cf_trie[] = {
-	/* Node for range 0x_____ */
-	0x0001, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0____ */
-	0x0003, 0x0004, 0x0005, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007,
-	/* Node for range 0x1____ */
-	0x0008, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x000a, 0x0000,
-	/* Node for range 0x00___ */
-	0x000b, 0x000c, 0x000d, 0x000e, 0x000f, 0x0010, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x01___ */
-	0x0011, 0x0000, 0x0000, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0013, 0x0000, 0x0014, 0x0015,
-	/* Node for range 0x02___ */
-	0x0000, 0x0016, 0x0000, 0x0000, 0x0017, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0a___ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0019, 0x001a,
-	0x0000, 0x0000, 0x0000, 0x001b, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0f___ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x001c, 0x0000, 0x0000, 0x0000, 0x001d,
-	/* Node for range 0x10___ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x001e, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x001f, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x11___ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x1e___ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x000__ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0023, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0024, 0x0025, 0x0026, 0x0000, 0x0000,
-	/* Node for range 0x001__ */
-	0x0027, 0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e,
-	0x002f, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036,
-	/* Node for range 0x002__ */
-	0x0037, 0x0038, 0x0039, 0x003a, 0x003b, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x003__ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x003c, 0x0000, 0x0000, 0x003d,
-	0x003e, 0x003f, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045,
-	/* Node for range 0x004__ */
-	0x0046, 0x0047, 0x0048, 0x0000, 0x0000, 0x0000, 0x0049, 0x004a,
-	0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051, 0x0052,
-	/* Node for range 0x005__ */
-	0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0000, 0x0000,
-	0x0059, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x010__ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x005a, 0x005b, 0x005c, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x013__ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x005d,
-	/* Node for range 0x01c__ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x005e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x01e__ */
-	0x005f, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066,
-	0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e,
-	/* Node for range 0x01f__ */
-	0x006f, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0000,
-	0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d,
-	/* Node for range 0x021__ */
-	0x0000, 0x0000, 0x007e, 0x007f, 0x0000, 0x0000, 0x0080, 0x0000,
-	0x0081, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x024__ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0082, 0x0083, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x02c__ */
-	0x0084, 0x0085, 0x0086, 0x0000, 0x0000, 0x0000, 0x0087, 0x0088,
-	0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f, 0x0090,
-	/* Node for range 0x0a6__ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0091, 0x0092, 0x0093, 0x0000,
-	0x0094, 0x0095, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0a7__ */
-	0x0000, 0x0000, 0x0096, 0x0097, 0x0098, 0x0099, 0x009a, 0x009b,
-	0x009c, 0x009d, 0x009e, 0x009f, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0ab__ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00a0,
-	0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0fb__ */
-	0x00a5, 0x00a6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0ff__ */
-	0x0000, 0x0000, 0x00a7, 0x00a8, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x104__ */
-	0x00a9, 0x00aa, 0x00ab, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x00ac, 0x00ad, 0x00ae, 0x0000, 0x0000,
-	/* Node for range 0x10c__ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x00af, 0x00b0, 0x00b1, 0x00b2, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x118__ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x00b3, 0x00b4, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x1e9__ */
-	0x00b5, 0x00b6, 0x00b7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0004_ */
-	0x0000, 0x0001, 0x0009, 0x0011, 0x0019, 0x0021, 0x0029, 0x0031,
-	0x0039, 0x0041, 0x0049, 0x0051, 0x0059, 0x0061, 0x0069, 0x0071,
-	/* Node for range 0x0005_ */
-	0x0079, 0x0081, 0x0089, 0x0091, 0x0099, 0x00a1, 0x00a9, 0x00b1,
-	0x00b9, 0x00c1, 0x00c9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x000b_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00d1, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x000c_ */
-	0x00d9, 0x00e1, 0x00e9, 0x00f1, 0x00f9, 0x0101, 0x0109, 0x0111,
-	0x0119, 0x0121, 0x0129, 0x0131, 0x0139, 0x0141, 0x0149, 0x0151,
-	/* Node for range 0x000d_ */
-	0x0159, 0x0161, 0x0169, 0x0171, 0x0179, 0x0181, 0x0189, 0x0000,
-	0x0191, 0x0199, 0x01a1, 0x01a9, 0x01b1, 0x01b9, 0x01c1, 0x01ca,
-	/* Node for range 0x0010_ */
-	0x01d9, 0x0000, 0x01e1, 0x0000, 0x01e9, 0x0000, 0x01f1, 0x0000,
-	0x01f9, 0x0000, 0x0201, 0x0000, 0x0209, 0x0000, 0x0211, 0x0000,
-	/* Node for range 0x0011_ */
-	0x0219, 0x0000, 0x0221, 0x0000, 0x0229, 0x0000, 0x0231, 0x0000,
-	0x0239, 0x0000, 0x0241, 0x0000, 0x0249, 0x0000, 0x0251, 0x0000,
-	/* Node for range 0x0012_ */
-	0x0259, 0x0000, 0x0261, 0x0000, 0x0269, 0x0000, 0x0271, 0x0000,
-	0x0279, 0x0000, 0x0281, 0x0000, 0x0289, 0x0000, 0x0291, 0x0000,
-	/* Node for range 0x0013_ */
-	0x029a, 0x0000, 0x02a9, 0x0000, 0x02b1, 0x0000, 0x02b9, 0x0000,
-	0x0000, 0x02c1, 0x0000, 0x02c9, 0x0000, 0x02d1, 0x0000, 0x02d9,
-	/* Node for range 0x0014_ */
-	0x0000, 0x02e1, 0x0000, 0x02e9, 0x0000, 0x02f1, 0x0000, 0x02f9,
-	0x0000, 0x0302, 0x0311, 0x0000, 0x0319, 0x0000, 0x0321, 0x0000,
-	/* Node for range 0x0015_ */
-	0x0329, 0x0000, 0x0331, 0x0000, 0x0339, 0x0000, 0x0341, 0x0000,
-	0x0349, 0x0000, 0x0351, 0x0000, 0x0359, 0x0000, 0x0361, 0x0000,
-	/* Node for range 0x0016_ */
-	0x0369, 0x0000, 0x0371, 0x0000, 0x0379, 0x0000, 0x0381, 0x0000,
-	0x0389, 0x0000, 0x0391, 0x0000, 0x0399, 0x0000, 0x03a1, 0x0000,
-	/* Node for range 0x0017_ */
-	0x03a9, 0x0000, 0x03b1, 0x0000, 0x03b9, 0x0000, 0x03c1, 0x0000,
-	0x03c9, 0x03d1, 0x0000, 0x03d9, 0x0000, 0x03e1, 0x0000, 0x03e9,
-	/* Node for range 0x0018_ */
-	0x0000, 0x03f1, 0x03f9, 0x0000, 0x0401, 0x0000, 0x0409, 0x0411,
-	0x0000, 0x0419, 0x0421, 0x0429, 0x0000, 0x0000, 0x0431, 0x0439,
-	/* Node for range 0x0019_ */
-	0x0441, 0x0449, 0x0000, 0x0451, 0x0459, 0x0000, 0x0461, 0x0469,
-	0x0471, 0x0000, 0x0000, 0x0000, 0x0479, 0x0481, 0x0000, 0x0489,
-	/* Node for range 0x001a_ */
-	0x0491, 0x0000, 0x0499, 0x0000, 0x04a1, 0x0000, 0x04a9, 0x04b1,
-	0x0000, 0x04b9, 0x0000, 0x0000, 0x04c1, 0x0000, 0x04c9, 0x04d1,
-	/* Node for range 0x001b_ */
-	0x0000, 0x04d9, 0x04e1, 0x04e9, 0x0000, 0x04f1, 0x0000, 0x04f9,
-	0x0501, 0x0000, 0x0000, 0x0000, 0x0509, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x001c_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0511, 0x0519, 0x0000, 0x0521,
-	0x0529, 0x0000, 0x0531, 0x0539, 0x0000, 0x0541, 0x0000, 0x0549,
-	/* Node for range 0x001d_ */
-	0x0000, 0x0551, 0x0000, 0x0559, 0x0000, 0x0561, 0x0000, 0x0569,
-	0x0000, 0x0571, 0x0000, 0x0579, 0x0000, 0x0000, 0x0581, 0x0000,
-	/* Node for range 0x001e_ */
-	0x0589, 0x0000, 0x0591, 0x0000, 0x0599, 0x0000, 0x05a1, 0x0000,
-	0x05a9, 0x0000, 0x05b1, 0x0000, 0x05b9, 0x0000, 0x05c1, 0x0000,
-	/* Node for range 0x001f_ */
-	0x05ca, 0x05d9, 0x05e1, 0x0000, 0x05e9, 0x0000, 0x05f1, 0x05f9,
-	0x0601, 0x0000, 0x0609, 0x0000, 0x0611, 0x0000, 0x0619, 0x0000,
-	/* Node for range 0x0020_ */
-	0x0621, 0x0000, 0x0629, 0x0000, 0x0631, 0x0000, 0x0639, 0x0000,
-	0x0641, 0x0000, 0x0649, 0x0000, 0x0651, 0x0000, 0x0659, 0x0000,
-	/* Node for range 0x0021_ */
-	0x0661, 0x0000, 0x0669, 0x0000, 0x0671, 0x0000, 0x0679, 0x0000,
-	0x0681, 0x0000, 0x0689, 0x0000, 0x0691, 0x0000, 0x0699, 0x0000,
-	/* Node for range 0x0022_ */
-	0x06a1, 0x0000, 0x06a9, 0x0000, 0x06b1, 0x0000, 0x06b9, 0x0000,
-	0x06c1, 0x0000, 0x06c9, 0x0000, 0x06d1, 0x0000, 0x06d9, 0x0000,
-	/* Node for range 0x0023_ */
-	0x06e1, 0x0000, 0x06e9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x06f1, 0x06f9, 0x0000, 0x0701, 0x0709, 0x0000,
-	/* Node for range 0x0024_ */
-	0x0000, 0x0711, 0x0000, 0x0719, 0x0721, 0x0729, 0x0731, 0x0000,
-	0x0739, 0x0000, 0x0741, 0x0000, 0x0749, 0x0000, 0x0751, 0x0000,
-	/* Node for range 0x0034_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0759, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0037_ */
-	0x0761, 0x0000, 0x0769, 0x0000, 0x0000, 0x0000, 0x0771, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0779,
-	/* Node for range 0x0038_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0781, 0x0000,
-	0x0789, 0x0791, 0x0799, 0x0000, 0x07a1, 0x0000, 0x07a9, 0x07b1,
-	/* Node for range 0x0039_ */
-	0x07bb, 0x07d1, 0x07d9, 0x07e1, 0x07e9, 0x07f1, 0x07f9, 0x0801,
-	0x0809, 0x0811, 0x0819, 0x0821, 0x0829, 0x0831, 0x0839, 0x0841,
-	/* Node for range 0x003a_ */
-	0x0849, 0x0851, 0x0000, 0x0859, 0x0861, 0x0869, 0x0871, 0x0879,
-	0x0881, 0x0889, 0x0891, 0x0899, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x003b_ */
-	0x08a3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x003c_ */
-	0x0000, 0x0000, 0x08b9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08c1,
-	/* Node for range 0x003d_ */
-	0x08c9, 0x08d1, 0x0000, 0x0000, 0x0000, 0x08d9, 0x08e1, 0x0000,
-	0x08e9, 0x0000, 0x08f1, 0x0000, 0x08f9, 0x0000, 0x0901, 0x0000,
-	/* Node for range 0x003e_ */
-	0x0909, 0x0000, 0x0911, 0x0000, 0x0919, 0x0000, 0x0921, 0x0000,
-	0x0929, 0x0000, 0x0931, 0x0000, 0x0939, 0x0000, 0x0941, 0x0000,
-	/* Node for range 0x003f_ */
-	0x0949, 0x0951, 0x0000, 0x0000, 0x0959, 0x0961, 0x0000, 0x0969,
-	0x0000, 0x0971, 0x0979, 0x0000, 0x0000, 0x0981, 0x0989, 0x0991,
-	/* Node for range 0x0040_ */
-	0x0999, 0x09a1, 0x09a9, 0x09b1, 0x09b9, 0x09c1, 0x09c9, 0x09d1,
-	0x09d9, 0x09e1, 0x09e9, 0x09f1, 0x09f9, 0x0a01, 0x0a09, 0x0a11,
-	/* Node for range 0x0041_ */
-	0x0a19, 0x0a21, 0x0a29, 0x0a31, 0x0a39, 0x0a41, 0x0a49, 0x0a51,
-	0x0a59, 0x0a61, 0x0a69, 0x0a71, 0x0a79, 0x0a81, 0x0a89, 0x0a91,
-	/* Node for range 0x0042_ */
-	0x0a99, 0x0aa1, 0x0aa9, 0x0ab1, 0x0ab9, 0x0ac1, 0x0ac9, 0x0ad1,
-	0x0ad9, 0x0ae1, 0x0ae9, 0x0af1, 0x0af9, 0x0b01, 0x0b09, 0x0b11,
-	/* Node for range 0x0046_ */
-	0x0b19, 0x0000, 0x0b21, 0x0000, 0x0b29, 0x0000, 0x0b31, 0x0000,
-	0x0b39, 0x0000, 0x0b41, 0x0000, 0x0b49, 0x0000, 0x0b51, 0x0000,
-	/* Node for range 0x0047_ */
-	0x0b59, 0x0000, 0x0b61, 0x0000, 0x0b69, 0x0000, 0x0b71, 0x0000,
-	0x0b79, 0x0000, 0x0b81, 0x0000, 0x0b89, 0x0000, 0x0b91, 0x0000,
-	/* Node for range 0x0048_ */
-	0x0b99, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0ba1, 0x0000, 0x0ba9, 0x0000, 0x0bb1, 0x0000,
-	/* Node for range 0x0049_ */
-	0x0bb9, 0x0000, 0x0bc1, 0x0000, 0x0bc9, 0x0000, 0x0bd1, 0x0000,
-	0x0bd9, 0x0000, 0x0be1, 0x0000, 0x0be9, 0x0000, 0x0bf1, 0x0000,
-	/* Node for range 0x004a_ */
-	0x0bf9, 0x0000, 0x0c01, 0x0000, 0x0c09, 0x0000, 0x0c11, 0x0000,
-	0x0c19, 0x0000, 0x0c21, 0x0000, 0x0c29, 0x0000, 0x0c31, 0x0000,
-	/* Node for range 0x004b_ */
-	0x0c39, 0x0000, 0x0c41, 0x0000, 0x0c49, 0x0000, 0x0c51, 0x0000,
-	0x0c59, 0x0000, 0x0c61, 0x0000, 0x0c69, 0x0000, 0x0c71, 0x0000,
-	/* Node for range 0x004c_ */
-	0x0c79, 0x0c81, 0x0000, 0x0c89, 0x0000, 0x0c91, 0x0000, 0x0c99,
-	0x0000, 0x0ca1, 0x0000, 0x0ca9, 0x0000, 0x0cb1, 0x0000, 0x0000,
-	/* Node for range 0x004d_ */
-	0x0cb9, 0x0000, 0x0cc1, 0x0000, 0x0cc9, 0x0000, 0x0cd1, 0x0000,
-	0x0cd9, 0x0000, 0x0ce1, 0x0000, 0x0ce9, 0x0000, 0x0cf1, 0x0000,
-	/* Node for range 0x004e_ */
-	0x0cf9, 0x0000, 0x0d01, 0x0000, 0x0d09, 0x0000, 0x0d11, 0x0000,
-	0x0d19, 0x0000, 0x0d21, 0x0000, 0x0d29, 0x0000, 0x0d31, 0x0000,
-	/* Node for range 0x004f_ */
-	0x0d39, 0x0000, 0x0d41, 0x0000, 0x0d49, 0x0000, 0x0d51, 0x0000,
-	0x0d59, 0x0000, 0x0d61, 0x0000, 0x0d69, 0x0000, 0x0d71, 0x0000,
-	/* Node for range 0x0050_ */
-	0x0d79, 0x0000, 0x0d81, 0x0000, 0x0d89, 0x0000, 0x0d91, 0x0000,
-	0x0d99, 0x0000, 0x0da1, 0x0000, 0x0da9, 0x0000, 0x0db1, 0x0000,
-	/* Node for range 0x0051_ */
-	0x0db9, 0x0000, 0x0dc1, 0x0000, 0x0dc9, 0x0000, 0x0dd1, 0x0000,
-	0x0dd9, 0x0000, 0x0de1, 0x0000, 0x0de9, 0x0000, 0x0df1, 0x0000,
-	/* Node for range 0x0052_ */
-	0x0df9, 0x0000, 0x0e01, 0x0000, 0x0e09, 0x0000, 0x0e11, 0x0000,
-	0x0e19, 0x0000, 0x0e21, 0x0000, 0x0e29, 0x0000, 0x0e31, 0x0000,
-	/* Node for range 0x0053_ */
-	0x0000, 0x0e39, 0x0e41, 0x0e49, 0x0e51, 0x0e59, 0x0e61, 0x0e69,
-	0x0e71, 0x0e79, 0x0e81, 0x0e89, 0x0e91, 0x0e99, 0x0ea1, 0x0ea9,
-	/* Node for range 0x0054_ */
-	0x0eb1, 0x0eb9, 0x0ec1, 0x0ec9, 0x0ed1, 0x0ed9, 0x0ee1, 0x0ee9,
-	0x0ef1, 0x0ef9, 0x0f01, 0x0f09, 0x0f11, 0x0f19, 0x0f21, 0x0f29,
-	/* Node for range 0x0055_ */
-	0x0f31, 0x0f39, 0x0f41, 0x0f49, 0x0f51, 0x0f59, 0x0f61, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0058_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0f6a,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x010a_ */
-	0x0f79, 0x0f81, 0x0f89, 0x0f91, 0x0f99, 0x0fa1, 0x0fa9, 0x0fb1,
-	0x0fb9, 0x0fc1, 0x0fc9, 0x0fd1, 0x0fd9, 0x0fe1, 0x0fe9, 0x0ff1,
-	/* Node for range 0x010b_ */
-	0x0ff9, 0x1001, 0x1009, 0x1011, 0x1019, 0x1021, 0x1029, 0x1031,
-	0x1039, 0x1041, 0x1049, 0x1051, 0x1059, 0x1061, 0x1069, 0x1071,
-	/* Node for range 0x010c_ */
-	0x1079, 0x1081, 0x1089, 0x1091, 0x1099, 0x10a1, 0x0000, 0x10a9,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10b1, 0x0000, 0x0000,
-	/* Node for range 0x013f_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x10b9, 0x10c1, 0x10c9, 0x10d1, 0x10d9, 0x10e1, 0x0000, 0x0000,
-	/* Node for range 0x01c8_ */
-	0x10e9, 0x10f1, 0x10f9, 0x1101, 0x1109, 0x1111, 0x1119, 0x1121,
-	0x1129, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x01e0_ */
-	0x1131, 0x0000, 0x1139, 0x0000, 0x1141, 0x0000, 0x1149, 0x0000,
-	0x1151, 0x0000, 0x1159, 0x0000, 0x1161, 0x0000, 0x1169, 0x0000,
-	/* Node for range 0x01e1_ */
-	0x1171, 0x0000, 0x1179, 0x0000, 0x1181, 0x0000, 0x1189, 0x0000,
-	0x1191, 0x0000, 0x1199, 0x0000, 0x11a1, 0x0000, 0x11a9, 0x0000,
-	/* Node for range 0x01e2_ */
-	0x11b1, 0x0000, 0x11b9, 0x0000, 0x11c1, 0x0000, 0x11c9, 0x0000,
-	0x11d1, 0x0000, 0x11d9, 0x0000, 0x11e1, 0x0000, 0x11e9, 0x0000,
-	/* Node for range 0x01e3_ */
-	0x11f1, 0x0000, 0x11f9, 0x0000, 0x1201, 0x0000, 0x1209, 0x0000,
-	0x1211, 0x0000, 0x1219, 0x0000, 0x1221, 0x0000, 0x1229, 0x0000,
-	/* Node for range 0x01e4_ */
-	0x1231, 0x0000, 0x1239, 0x0000, 0x1241, 0x0000, 0x1249, 0x0000,
-	0x1251, 0x0000, 0x1259, 0x0000, 0x1261, 0x0000, 0x1269, 0x0000,
-	/* Node for range 0x01e5_ */
-	0x1271, 0x0000, 0x1279, 0x0000, 0x1281, 0x0000, 0x1289, 0x0000,
-	0x1291, 0x0000, 0x1299, 0x0000, 0x12a1, 0x0000, 0x12a9, 0x0000,
-	/* Node for range 0x01e6_ */
-	0x12b1, 0x0000, 0x12b9, 0x0000, 0x12c1, 0x0000, 0x12c9, 0x0000,
-	0x12d1, 0x0000, 0x12d9, 0x0000, 0x12e1, 0x0000, 0x12e9, 0x0000,
-	/* Node for range 0x01e7_ */
-	0x12f1, 0x0000, 0x12f9, 0x0000, 0x1301, 0x0000, 0x1309, 0x0000,
-	0x1311, 0x0000, 0x1319, 0x0000, 0x1321, 0x0000, 0x1329, 0x0000,
-	/* Node for range 0x01e8_ */
-	0x1331, 0x0000, 0x1339, 0x0000, 0x1341, 0x0000, 0x1349, 0x0000,
-	0x1351, 0x0000, 0x1359, 0x0000, 0x1361, 0x0000, 0x1369, 0x0000,
-	/* Node for range 0x01e9_ */
-	0x1371, 0x0000, 0x1379, 0x0000, 0x1381, 0x0000, 0x138a, 0x139a,
-	0x13aa, 0x13ba, 0x13ca, 0x13d9, 0x0000, 0x0000, 0x13e2, 0x0000,
-	/* Node for range 0x01ea_ */
-	0x13f1, 0x0000, 0x13f9, 0x0000, 0x1401, 0x0000, 0x1409, 0x0000,
-	0x1411, 0x0000, 0x1419, 0x0000, 0x1421, 0x0000, 0x1429, 0x0000,
-	/* Node for range 0x01eb_ */
-	0x1431, 0x0000, 0x1439, 0x0000, 0x1441, 0x0000, 0x1449, 0x0000,
-	0x1451, 0x0000, 0x1459, 0x0000, 0x1461, 0x0000, 0x1469, 0x0000,
-	/* Node for range 0x01ec_ */
-	0x1471, 0x0000, 0x1479, 0x0000, 0x1481, 0x0000, 0x1489, 0x0000,
-	0x1491, 0x0000, 0x1499, 0x0000, 0x14a1, 0x0000, 0x14a9, 0x0000,
-	/* Node for range 0x01ed_ */
-	0x14b1, 0x0000, 0x14b9, 0x0000, 0x14c1, 0x0000, 0x14c9, 0x0000,
-	0x14d1, 0x0000, 0x14d9, 0x0000, 0x14e1, 0x0000, 0x14e9, 0x0000,
-	/* Node for range 0x01ee_ */
-	0x14f1, 0x0000, 0x14f9, 0x0000, 0x1501, 0x0000, 0x1509, 0x0000,
-	0x1511, 0x0000, 0x1519, 0x0000, 0x1521, 0x0000, 0x1529, 0x0000,
-	/* Node for range 0x01ef_ */
-	0x1531, 0x0000, 0x1539, 0x0000, 0x1541, 0x0000, 0x1549, 0x0000,
-	0x1551, 0x0000, 0x1559, 0x0000, 0x1561, 0x0000, 0x1569, 0x0000,
-	/* Node for range 0x01f0_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x1571, 0x1579, 0x1581, 0x1589, 0x1591, 0x1599, 0x15a1, 0x15a9,
-	/* Node for range 0x01f1_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x15b1, 0x15b9, 0x15c1, 0x15c9, 0x15d1, 0x15d9, 0x0000, 0x0000,
-	/* Node for range 0x01f2_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x15e1, 0x15e9, 0x15f1, 0x15f9, 0x1601, 0x1609, 0x1611, 0x1619,
-	/* Node for range 0x01f3_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x1621, 0x1629, 0x1631, 0x1639, 0x1641, 0x1649, 0x1651, 0x1659,
-	/* Node for range 0x01f4_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x1661, 0x1669, 0x1671, 0x1679, 0x1681, 0x1689, 0x0000, 0x0000,
-	/* Node for range 0x01f5_ */
-	0x1692, 0x0000, 0x16a3, 0x0000, 0x16bb, 0x0000, 0x16d3, 0x0000,
-	0x0000, 0x16e9, 0x0000, 0x16f1, 0x0000, 0x16f9, 0x0000, 0x1701,
-	/* Node for range 0x01f6_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x1709, 0x1711, 0x1719, 0x1721, 0x1729, 0x1731, 0x1739, 0x1741,
-	/* Node for range 0x01f8_ */
-	0x174a, 0x175a, 0x176a, 0x177a, 0x178a, 0x179a, 0x17aa, 0x17ba,
-	0x17ca, 0x17da, 0x17ea, 0x17fa, 0x180a, 0x181a, 0x182a, 0x183a,
-	/* Node for range 0x01f9_ */
-	0x184a, 0x185a, 0x186a, 0x187a, 0x188a, 0x189a, 0x18aa, 0x18ba,
-	0x18ca, 0x18da, 0x18ea, 0x18fa, 0x190a, 0x191a, 0x192a, 0x193a,
-	/* Node for range 0x01fa_ */
-	0x194a, 0x195a, 0x196a, 0x197a, 0x198a, 0x199a, 0x19aa, 0x19ba,
-	0x19ca, 0x19da, 0x19ea, 0x19fa, 0x1a0a, 0x1a1a, 0x1a2a, 0x1a3a,
-	/* Node for range 0x01fb_ */
-	0x0000, 0x0000, 0x1a4a, 0x1a5a, 0x1a6a, 0x0000, 0x1a7a, 0x1a8b,
-	0x1aa1, 0x1aa9, 0x1ab1, 0x1ab9, 0x1ac2, 0x0000, 0x1ad1, 0x0000,
-	/* Node for range 0x01fc_ */
-	0x0000, 0x0000, 0x1ada, 0x1aea, 0x1afa, 0x0000, 0x1b0a, 0x1b1b,
-	0x1b31, 0x1b39, 0x1b41, 0x1b49, 0x1b52, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x01fd_ */
-	0x0000, 0x0000, 0x1b63, 0x1b7b, 0x0000, 0x0000, 0x1b92, 0x1ba3,
-	0x1bb9, 0x1bc1, 0x1bc9, 0x1bd1, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x01fe_ */
-	0x0000, 0x0000, 0x1bdb, 0x1bf3, 0x1c0a, 0x0000, 0x1c1a, 0x1c2b,
-	0x1c41, 0x1c49, 0x1c51, 0x1c59, 0x1c61, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x01ff_ */
-	0x0000, 0x0000, 0x1c6a, 0x1c7a, 0x1c8a, 0x0000, 0x1c9a, 0x1cab,
-	0x1cc1, 0x1cc9, 0x1cd1, 0x1cd9, 0x1ce2, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0212_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1cf1, 0x0000,
-	0x0000, 0x0000, 0x1cf9, 0x1d01, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0213_ */
-	0x0000, 0x0000, 0x1d09, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0216_ */
-	0x1d11, 0x1d19, 0x1d21, 0x1d29, 0x1d31, 0x1d39, 0x1d41, 0x1d49,
-	0x1d51, 0x1d59, 0x1d61, 0x1d69, 0x1d71, 0x1d79, 0x1d81, 0x1d89,
-	/* Node for range 0x0218_ */
-	0x0000, 0x0000, 0x0000, 0x1d91, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x024b_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1d99, 0x1da1,
-	0x1da9, 0x1db1, 0x1db9, 0x1dc1, 0x1dc9, 0x1dd1, 0x1dd9, 0x1de1,
-	/* Node for range 0x024c_ */
-	0x1de9, 0x1df1, 0x1df9, 0x1e01, 0x1e09, 0x1e11, 0x1e19, 0x1e21,
-	0x1e29, 0x1e31, 0x1e39, 0x1e41, 0x1e49, 0x1e51, 0x1e59, 0x1e61,
-	/* Node for range 0x02c0_ */
-	0x1e69, 0x1e71, 0x1e79, 0x1e81, 0x1e89, 0x1e91, 0x1e99, 0x1ea1,
-	0x1ea9, 0x1eb1, 0x1eb9, 0x1ec1, 0x1ec9, 0x1ed1, 0x1ed9, 0x1ee1,
-	/* Node for range 0x02c1_ */
-	0x1ee9, 0x1ef1, 0x1ef9, 0x1f01, 0x1f09, 0x1f11, 0x1f19, 0x1f21,
-	0x1f29, 0x1f31, 0x1f39, 0x1f41, 0x1f49, 0x1f51, 0x1f59, 0x1f61,
-	/* Node for range 0x02c2_ */
-	0x1f69, 0x1f71, 0x1f79, 0x1f81, 0x1f89, 0x1f91, 0x1f99, 0x1fa1,
-	0x1fa9, 0x1fb1, 0x1fb9, 0x1fc1, 0x1fc9, 0x1fd1, 0x1fd9, 0x0000,
-	/* Node for range 0x02c6_ */
-	0x1fe1, 0x0000, 0x1fe9, 0x1ff1, 0x1ff9, 0x0000, 0x0000, 0x2001,
-	0x0000, 0x2009, 0x0000, 0x2011, 0x0000, 0x2019, 0x2021, 0x2029,
-	/* Node for range 0x02c7_ */
-	0x2031, 0x0000, 0x2039, 0x0000, 0x0000, 0x2041, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2049, 0x2051,
-	/* Node for range 0x02c8_ */
-	0x2059, 0x0000, 0x2061, 0x0000, 0x2069, 0x0000, 0x2071, 0x0000,
-	0x2079, 0x0000, 0x2081, 0x0000, 0x2089, 0x0000, 0x2091, 0x0000,
-	/* Node for range 0x02c9_ */
-	0x2099, 0x0000, 0x20a1, 0x0000, 0x20a9, 0x0000, 0x20b1, 0x0000,
-	0x20b9, 0x0000, 0x20c1, 0x0000, 0x20c9, 0x0000, 0x20d1, 0x0000,
-	/* Node for range 0x02ca_ */
-	0x20d9, 0x0000, 0x20e1, 0x0000, 0x20e9, 0x0000, 0x20f1, 0x0000,
-	0x20f9, 0x0000, 0x2101, 0x0000, 0x2109, 0x0000, 0x2111, 0x0000,
-	/* Node for range 0x02cb_ */
-	0x2119, 0x0000, 0x2121, 0x0000, 0x2129, 0x0000, 0x2131, 0x0000,
-	0x2139, 0x0000, 0x2141, 0x0000, 0x2149, 0x0000, 0x2151, 0x0000,
-	/* Node for range 0x02cc_ */
-	0x2159, 0x0000, 0x2161, 0x0000, 0x2169, 0x0000, 0x2171, 0x0000,
-	0x2179, 0x0000, 0x2181, 0x0000, 0x2189, 0x0000, 0x2191, 0x0000,
-	/* Node for range 0x02cd_ */
-	0x2199, 0x0000, 0x21a1, 0x0000, 0x21a9, 0x0000, 0x21b1, 0x0000,
-	0x21b9, 0x0000, 0x21c1, 0x0000, 0x21c9, 0x0000, 0x21d1, 0x0000,
-	/* Node for range 0x02ce_ */
-	0x21d9, 0x0000, 0x21e1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x21e9, 0x0000, 0x21f1, 0x0000, 0x0000,
-	/* Node for range 0x02cf_ */
-	0x0000, 0x0000, 0x21f9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0a64_ */
-	0x2201, 0x0000, 0x2209, 0x0000, 0x2211, 0x0000, 0x2219, 0x0000,
-	0x2221, 0x0000, 0x2229, 0x0000, 0x2231, 0x0000, 0x2239, 0x0000,
-	/* Node for range 0x0a65_ */
-	0x2241, 0x0000, 0x2249, 0x0000, 0x2251, 0x0000, 0x2259, 0x0000,
-	0x2261, 0x0000, 0x2269, 0x0000, 0x2271, 0x0000, 0x2279, 0x0000,
-	/* Node for range 0x0a66_ */
-	0x2281, 0x0000, 0x2289, 0x0000, 0x2291, 0x0000, 0x2299, 0x0000,
-	0x22a1, 0x0000, 0x22a9, 0x0000, 0x22b1, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0a68_ */
-	0x22b9, 0x0000, 0x22c1, 0x0000, 0x22c9, 0x0000, 0x22d1, 0x0000,
-	0x22d9, 0x0000, 0x22e1, 0x0000, 0x22e9, 0x0000, 0x22f1, 0x0000,
-	/* Node for range 0x0a69_ */
-	0x22f9, 0x0000, 0x2301, 0x0000, 0x2309, 0x0000, 0x2311, 0x0000,
-	0x2319, 0x0000, 0x2321, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0a72_ */
-	0x0000, 0x0000, 0x2329, 0x0000, 0x2331, 0x0000, 0x2339, 0x0000,
-	0x2341, 0x0000, 0x2349, 0x0000, 0x2351, 0x0000, 0x2359, 0x0000,
-	/* Node for range 0x0a73_ */
-	0x0000, 0x0000, 0x2361, 0x0000, 0x2369, 0x0000, 0x2371, 0x0000,
-	0x2379, 0x0000, 0x2381, 0x0000, 0x2389, 0x0000, 0x2391, 0x0000,
-	/* Node for range 0x0a74_ */
-	0x2399, 0x0000, 0x23a1, 0x0000, 0x23a9, 0x0000, 0x23b1, 0x0000,
-	0x23b9, 0x0000, 0x23c1, 0x0000, 0x23c9, 0x0000, 0x23d1, 0x0000,
-	/* Node for range 0x0a75_ */
-	0x23d9, 0x0000, 0x23e1, 0x0000, 0x23e9, 0x0000, 0x23f1, 0x0000,
-	0x23f9, 0x0000, 0x2401, 0x0000, 0x2409, 0x0000, 0x2411, 0x0000,
-	/* Node for range 0x0a76_ */
-	0x2419, 0x0000, 0x2421, 0x0000, 0x2429, 0x0000, 0x2431, 0x0000,
-	0x2439, 0x0000, 0x2441, 0x0000, 0x2449, 0x0000, 0x2451, 0x0000,
-	/* Node for range 0x0a77_ */
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x2459, 0x0000, 0x2461, 0x0000, 0x2469, 0x2471, 0x0000,
-	/* Node for range 0x0a78_ */
-	0x2479, 0x0000, 0x2481, 0x0000, 0x2489, 0x0000, 0x2491, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x2499, 0x0000, 0x24a1, 0x0000, 0x0000,
-	/* Node for range 0x0a79_ */
-	0x24a9, 0x0000, 0x24b1, 0x0000, 0x0000, 0x0000, 0x24b9, 0x0000,
-	0x24c1, 0x0000, 0x24c9, 0x0000, 0x24d1, 0x0000, 0x24d9, 0x0000,
-	/* Node for range 0x0a7a_ */
-	0x24e1, 0x0000, 0x24e9, 0x0000, 0x24f1, 0x0000, 0x24f9, 0x0000,
-	0x2501, 0x0000, 0x2509, 0x2511, 0x2519, 0x2521, 0x2529, 0x0000,
-	/* Node for range 0x0a7b_ */
-	0x2531, 0x2539, 0x2541, 0x2549, 0x2551, 0x0000, 0x2559, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0ab7_ */
-	0x2561, 0x2569, 0x2571, 0x2579, 0x2581, 0x2589, 0x2591, 0x2599,
-	0x25a1, 0x25a9, 0x25b1, 0x25b9, 0x25c1, 0x25c9, 0x25d1, 0x25d9,
-	/* Node for range 0x0ab8_ */
-	0x25e1, 0x25e9, 0x25f1, 0x25f9, 0x2601, 0x2609, 0x2611, 0x2619,
-	0x2621, 0x2629, 0x2631, 0x2639, 0x2641, 0x2649, 0x2651, 0x2659,
-	/* Node for range 0x0ab9_ */
-	0x2661, 0x2669, 0x2671, 0x2679, 0x2681, 0x2689, 0x2691, 0x2699,
-	0x26a1, 0x26a9, 0x26b1, 0x26b9, 0x26c1, 0x26c9, 0x26d1, 0x26d9,
-	/* Node for range 0x0aba_ */
-	0x26e1, 0x26e9, 0x26f1, 0x26f9, 0x2701, 0x2709, 0x2711, 0x2719,
-	0x2721, 0x2729, 0x2731, 0x2739, 0x2741, 0x2749, 0x2751, 0x2759,
-	/* Node for range 0x0abb_ */
-	0x2761, 0x2769, 0x2771, 0x2779, 0x2781, 0x2789, 0x2791, 0x2799,
-	0x27a1, 0x27a9, 0x27b1, 0x27b9, 0x27c1, 0x27c9, 0x27d1, 0x27d9,
-	/* Node for range 0x0fb0_ */
-	0x27e2, 0x27f2, 0x2802, 0x2813, 0x282b, 0x2842, 0x2852, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0fb1_ */
-	0x0000, 0x0000, 0x0000, 0x2862, 0x2872, 0x2882, 0x2892, 0x28a2,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x0ff2_ */
-	0x0000, 0x28b1, 0x28b9, 0x28c1, 0x28c9, 0x28d1, 0x28d9, 0x28e1,
-	0x28e9, 0x28f1, 0x28f9, 0x2901, 0x2909, 0x2911, 0x2919, 0x2921,
-	/* Node for range 0x0ff3_ */
-	0x2929, 0x2931, 0x2939, 0x2941, 0x2949, 0x2951, 0x2959, 0x2961,
-	0x2969, 0x2971, 0x2979, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x1040_ */
-	0x2981, 0x2989, 0x2991, 0x2999, 0x29a1, 0x29a9, 0x29b1, 0x29b9,
-	0x29c1, 0x29c9, 0x29d1, 0x29d9, 0x29e1, 0x29e9, 0x29f1, 0x29f9,
-	/* Node for range 0x1041_ */
-	0x2a01, 0x2a09, 0x2a11, 0x2a19, 0x2a21, 0x2a29, 0x2a31, 0x2a39,
-	0x2a41, 0x2a49, 0x2a51, 0x2a59, 0x2a61, 0x2a69, 0x2a71, 0x2a79,
-	/* Node for range 0x1042_ */
-	0x2a81, 0x2a89, 0x2a91, 0x2a99, 0x2aa1, 0x2aa9, 0x2ab1, 0x2ab9,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x104b_ */
-	0x2ac1, 0x2ac9, 0x2ad1, 0x2ad9, 0x2ae1, 0x2ae9, 0x2af1, 0x2af9,
-	0x2b01, 0x2b09, 0x2b11, 0x2b19, 0x2b21, 0x2b29, 0x2b31, 0x2b39,
-	/* Node for range 0x104c_ */
-	0x2b41, 0x2b49, 0x2b51, 0x2b59, 0x2b61, 0x2b69, 0x2b71, 0x2b79,
-	0x2b81, 0x2b89, 0x2b91, 0x2b99, 0x2ba1, 0x2ba9, 0x2bb1, 0x2bb9,
-	/* Node for range 0x104d_ */
-	0x2bc1, 0x2bc9, 0x2bd1, 0x2bd9, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x10c8_ */
-	0x2be1, 0x2be9, 0x2bf1, 0x2bf9, 0x2c01, 0x2c09, 0x2c11, 0x2c19,
-	0x2c21, 0x2c29, 0x2c31, 0x2c39, 0x2c41, 0x2c49, 0x2c51, 0x2c59,
-	/* Node for range 0x10c9_ */
-	0x2c61, 0x2c69, 0x2c71, 0x2c79, 0x2c81, 0x2c89, 0x2c91, 0x2c99,
-	0x2ca1, 0x2ca9, 0x2cb1, 0x2cb9, 0x2cc1, 0x2cc9, 0x2cd1, 0x2cd9,
-	/* Node for range 0x10ca_ */
-	0x2ce1, 0x2ce9, 0x2cf1, 0x2cf9, 0x2d01, 0x2d09, 0x2d11, 0x2d19,
-	0x2d21, 0x2d29, 0x2d31, 0x2d39, 0x2d41, 0x2d49, 0x2d51, 0x2d59,
-	/* Node for range 0x10cb_ */
-	0x2d61, 0x2d69, 0x2d71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	/* Node for range 0x118a_ */
-	0x2d79, 0x2d81, 0x2d89, 0x2d91, 0x2d99, 0x2da1, 0x2da9, 0x2db1,
-	0x2db9, 0x2dc1, 0x2dc9, 0x2dd1, 0x2dd9, 0x2de1, 0x2de9, 0x2df1,
-	/* Node for range 0x118b_ */
-	0x2df9, 0x2e01, 0x2e09, 0x2e11, 0x2e19, 0x2e21, 0x2e29, 0x2e31,
-	0x2e39, 0x2e41, 0x2e49, 0x2e51, 0x2e59, 0x2e61, 0x2e69, 0x2e71,
-	/* Node for range 0x1e90_ */
-	0x2e79, 0x2e81, 0x2e89, 0x2e91, 0x2e99, 0x2ea1, 0x2ea9, 0x2eb1,
-	0x2eb9, 0x2ec1, 0x2ec9, 0x2ed1, 0x2ed9, 0x2ee1, 0x2ee9, 0x2ef1,
-	/* Node for range 0x1e91_ */
-	0x2ef9, 0x2f01, 0x2f09, 0x2f11, 0x2f19, 0x2f21, 0x2f29, 0x2f31,
-	0x2f39, 0x2f41, 0x2f49, 0x2f51, 0x2f59, 0x2f61, 0x2f69, 0x2f71,
-	/* Node for range 0x1e92_ */
-	0x2f79, 0x2f81, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-};
-
 static unicode_t apfs_cf[] = {
 	0x000061, 0x000062, 0x000063, 0x000064, 0x000065, 0x000066,
 	0x000067, 0x000068, 0x000069, 0x00006a, 0x00006b, 0x00006c,
@@ -2484,666 +8060,3 @@ static unicode_t apfs_cf[] = {
 	0x01e93b, 0x01e93c, 0x01e93d, 0x01e93e, 0x01e93f, 0x01e940,
 	0x01e941, 0x01e942, 0x01e943,
 };
-
-static u8 apfs_ccc_trie[] = {
-	/* Node for range 0x_____ */
-	0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x0____ */
-	0x03, 0x04, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x08,
-	/* Node for range 0x1____ */
-	0x09, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00,
-	0x00, 0x00, 0x00, 0x0c, 0x00, 0x0d, 0x0e, 0x00,
-	/* Node for range 0x00___ */
-	0x00, 0x00, 0x00, 0x0f, 0x10, 0x11, 0x12, 0x13,
-	0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b,
-	/* Node for range 0x01___ */
-	0x1c, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1e,
-	0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x00, 0x00,
-	/* Node for range 0x02___ */
-	0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x26, 0x27, 0x00, 0x00,
-	/* Node for range 0x03___ */
-	0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x0a___ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00,
-	0x2a, 0x2b, 0x2c, 0x2d, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x0f___ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2f, 0x00,
-	/* Node for range 0x10___ */
-	0x00, 0x30, 0x31, 0x32, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x11___ */
-	0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b,
-	0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-	/* Node for range 0x16___ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x3d, 0x3e, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x1b___ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00,
-	/* Node for range 0x1d___ */
-	0x00, 0x40, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x1e___ */
-	0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x43, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x003__ */
-	0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x004__ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x005__ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x4d, 0x4e, 0x4f, 0x50, 0x00, 0x00, 0x00,
-	/* Node for range 0x006__ */
-	0x00, 0x51, 0x00, 0x00, 0x52, 0x53, 0x00, 0x54,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x56, 0x00,
-	/* Node for range 0x007__ */
-	0x00, 0x57, 0x00, 0x58, 0x59, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5b,
-	/* Node for range 0x008__ */
-	0x00, 0x5c, 0x5d, 0x00, 0x00, 0x5e, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x60, 0x61,
-	/* Node for range 0x009__ */
-	0x00, 0x00, 0x00, 0x62, 0x63, 0x64, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x65, 0x66, 0x00, 0x00, 0x00,
-	/* Node for range 0x00a__ */
-	0x00, 0x00, 0x00, 0x67, 0x68, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x69, 0x6a, 0x00, 0x00, 0x00,
-	/* Node for range 0x00b__ */
-	0x00, 0x00, 0x00, 0x6b, 0x6c, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00,
-	/* Node for range 0x00c__ */
-	0x00, 0x00, 0x00, 0x00, 0x6e, 0x6f, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x70, 0x71, 0x00, 0x00, 0x00,
-	/* Node for range 0x00d__ */
-	0x00, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00,
-	/* Node for range 0x00e__ */
-	0x00, 0x00, 0x00, 0x74, 0x75, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x76, 0x77, 0x00, 0x00, 0x00,
-	/* Node for range 0x00f__ */
-	0x00, 0x78, 0x00, 0x79, 0x00, 0x00, 0x00, 0x7a,
-	0x7b, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00,
-	/* Node for range 0x010__ */
-	0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x00,
-	0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x013__ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x017__ */
-	0x00, 0x80, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00,
-	/* Node for range 0x018__ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x019__ */
-	0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x01a__ */
-	0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x86, 0x87,
-	0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x01b__ */
-	0x00, 0x00, 0x00, 0x89, 0x8a, 0x00, 0x8b, 0x8c,
-	0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x8e, 0x8f,
-	/* Node for range 0x01c__ */
-	0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x92, 0x93,
-	/* Node for range 0x01d__ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x94, 0x95, 0x96, 0x97,
-	/* Node for range 0x020__ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x99, 0x9a,
-	/* Node for range 0x02c__ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0x9c,
-	/* Node for range 0x02d__ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x9f,
-	/* Node for range 0x030__ */
-	0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x0a6__ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xa3,
-	0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5,
-	/* Node for range 0x0a8__ */
-	0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xa7, 0x00, 0xa8, 0xa9,
-	/* Node for range 0x0a9__ */
-	0x00, 0x00, 0xaa, 0x00, 0x00, 0xab, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xac, 0xad, 0x00, 0x00, 0x00,
-	/* Node for range 0x0aa__ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xae, 0xaf, 0x00, 0x00, 0xb0,
-	/* Node for range 0x0ab__ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x00,
-	/* Node for range 0x0fb__ */
-	0x00, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x0fe__ */
-	0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x101__ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4,
-	/* Node for range 0x102__ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x00,
-	/* Node for range 0x103__ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x10a__ */
-	0xb7, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x00,
-	/* Node for range 0x110__ */
-	0x00, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0xbb,
-	0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x111__ */
-	0xbd, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00, 0xbf,
-	0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
-	/* Node for range 0x112__ */
-	0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x00,
-	/* Node for range 0x113__ */
-	0x00, 0x00, 0x00, 0xc3, 0xc4, 0x00, 0xc5, 0xc6,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x114__ */
-	0x00, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00,
-	/* Node for range 0x115__ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xc9, 0xca, 0x00, 0x00, 0x00,
-	/* Node for range 0x116__ */
-	0x00, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x117__ */
-	0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x11c__ */
-	0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x16a__ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf,
-	/* Node for range 0x16b__ */
-	0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x1bc__ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x1d1__ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xd3,
-	0xd4, 0x00, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x1d2__ */
-	0x00, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x1e0__ */
-	0xd7, 0xd8, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x1e8__ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00,
-	/* Node for range 0x1e9__ */
-	0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x0030_ */
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-	/* Node for range 0x0031_ */
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe8, 0xdc, 0xdc,
-	0xdc, 0xdc, 0xe8, 0xd8, 0xdc, 0xdc, 0xdc, 0xdc,
-	/* Node for range 0x0032_ */
-	0xdc, 0xca, 0xca, 0xdc, 0xdc, 0xdc, 0xdc, 0xca,
-	0xca, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc,
-	/* Node for range 0x0033_ */
-	0xdc, 0xdc, 0xdc, 0xdc, 0x01, 0x01, 0x01, 0x01,
-	0x01, 0xdc, 0xdc, 0xdc, 0xdc, 0xe6, 0xe6, 0xe6,
-	/* Node for range 0x0034_ */
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xf0, 0xe6, 0xdc,
-	0xdc, 0xdc, 0xe6, 0xe6, 0xe6, 0xdc, 0xdc, 0x00,
-	/* Node for range 0x0035_ */
-	0xe6, 0xe6, 0xe6, 0xdc, 0xdc, 0xdc, 0xdc, 0xe6,
-	0xe8, 0xdc, 0xdc, 0xe6, 0xe9, 0xea, 0xea, 0xe9,
-	/* Node for range 0x0036_ */
-	0xea, 0xea, 0xe9, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-	/* Node for range 0x0048_ */
-	0x00, 0x00, 0x00, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x0059_ */
-	0x00, 0xdc, 0xe6, 0xe6, 0xe6, 0xe6, 0xdc, 0xe6,
-	0xe6, 0xe6, 0xde, 0xdc, 0xe6, 0xe6, 0xe6, 0xe6,
-	/* Node for range 0x005a_ */
-	0xe6, 0xe6, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc,
-	0xe6, 0xe6, 0xdc, 0xe6, 0xe6, 0xde, 0xe4, 0xe6,
-	/* Node for range 0x005b_ */
-	0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11,
-	0x12, 0x13, 0x13, 0x14, 0x15, 0x16, 0x00, 0x17,
-	/* Node for range 0x005c_ */
-	0x00, 0x18, 0x19, 0x00, 0xe6, 0xdc, 0x00, 0x12,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x0061_ */
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-	0x1e, 0x1f, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x0064_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
-	/* Node for range 0x0065_ */
-	0x20, 0x21, 0x22, 0xe6, 0xe6, 0xdc, 0xdc, 0xe6,
-	0xe6, 0xe6, 0xe6, 0xe6, 0xdc, 0xe6, 0xe6, 0xdc,
-	/* Node for range 0x0067_ */
-	0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x006d_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xe6,
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x00, 0x00, 0xe6,
-	/* Node for range 0x006e_ */
-	0xe6, 0xe6, 0xe6, 0xdc, 0xe6, 0x00, 0x00, 0xe6,
-	0xe6, 0x00, 0xdc, 0xe6, 0xe6, 0xdc, 0x00, 0x00,
-	/* Node for range 0x0071_ */
-	0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x0073_ */
-	0xe6, 0xdc, 0xe6, 0xe6, 0xdc, 0xe6, 0xe6, 0xdc,
-	0xdc, 0xdc, 0xe6, 0xdc, 0xdc, 0xe6, 0xdc, 0xe6,
-	/* Node for range 0x0074_ */
-	0xe6, 0xe6, 0xdc, 0xe6, 0xdc, 0xe6, 0xdc, 0xe6,
-	0xdc, 0xe6, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x007e_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-	/* Node for range 0x007f_ */
-	0xe6, 0xe6, 0xdc, 0xe6, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x0081_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xe6,
-	0xe6, 0xe6, 0x00, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-	/* Node for range 0x0082_ */
-	0xe6, 0xe6, 0xe6, 0xe6, 0x00, 0xe6, 0xe6, 0xe6,
-	0x00, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x00, 0x00,
-	/* Node for range 0x0085_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xdc, 0xdc, 0xdc, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x008d_ */
-	0x00, 0x00, 0x00, 0x00, 0xe6, 0xe6, 0xe6, 0xe6,
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-	/* Node for range 0x008e_ */
-	0xe6, 0xe6, 0x00, 0xdc, 0xe6, 0xe6, 0xdc, 0xe6,
-	0xe6, 0xdc, 0xe6, 0xe6, 0xe6, 0xdc, 0xdc, 0xdc,
-	/* Node for range 0x008f_ */
-	0x1b, 0x1c, 0x1d, 0xe6, 0xe6, 0xe6, 0xdc, 0xe6,
-	0xe6, 0xdc, 0xdc, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-	/* Node for range 0x0093_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-	/* Node for range 0x0094_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
-	/* Node for range 0x0095_ */
-	0x00, 0xe6, 0xdc, 0xe6, 0xe6, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x009b_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-	/* Node for range 0x009c_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
-	/* Node for range 0x00a3_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-	/* Node for range 0x00a4_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
-	/* Node for range 0x00ab_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-	/* Node for range 0x00ac_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
-	/* Node for range 0x00b3_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-	/* Node for range 0x00b4_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
-	/* Node for range 0x00bc_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
-	/* Node for range 0x00c4_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
-	/* Node for range 0x00c5_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x5b, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x00cb_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-	/* Node for range 0x00cc_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
-	/* Node for range 0x00d4_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
-	/* Node for range 0x00dc_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x00e3_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x67, 0x67, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x00e4_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x6b, 0x6b, 0x6b, 0x6b, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x00eb_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x76, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x00ec_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x7a, 0x7a, 0x7a, 0x7a, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x00f1_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xdc, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x00f3_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x00, 0xdc,
-	0x00, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x00f7_ */
-	0x00, 0x81, 0x82, 0x00, 0x84, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x82, 0x82, 0x82, 0x82, 0x00, 0x00,
-	/* Node for range 0x00f8_ */
-	0x82, 0x00, 0xe6, 0xe6, 0x09, 0x00, 0xe6, 0xe6,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x00fc_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x0103_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-	0x00, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x0108_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00,
-	/* Node for range 0x0135_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xe6, 0xe6,
-	/* Node for range 0x0171_ */
-	0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x0173_ */
-	0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x017d_ */
-	0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x00,
-	/* Node for range 0x018a_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x0193_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xde, 0xe6, 0xdc, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x01a1_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6,
-	0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x01a6_ */
-	0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x01a7_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xe6, 0xe6,
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x00, 0x00, 0xdc,
-	/* Node for range 0x01ab_ */
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xdc, 0xdc, 0xdc,
-	0xdc, 0xdc, 0xdc, 0xe6, 0xe6, 0xdc, 0x00, 0x00,
-	/* Node for range 0x01b3_ */
-	0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x01b4_ */
-	0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x01b6_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xe6, 0xdc, 0xe6, 0xe6, 0xe6,
-	/* Node for range 0x01b7_ */
-	0xe6, 0xe6, 0xe6, 0xe6, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x01ba_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x01be_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x01bf_ */
-	0x00, 0x00, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x01c3_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x01cd_ */
-	0xe6, 0xe6, 0xe6, 0x00, 0x01, 0xdc, 0xdc, 0xdc,
-	0xdc, 0xdc, 0xe6, 0xe6, 0xdc, 0xdc, 0xdc, 0xdc,
-	/* Node for range 0x01ce_ */
-	0xe6, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00,
-	/* Node for range 0x01cf_ */
-	0x00, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x00, 0x00,
-	0xe6, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x01dc_ */
-	0xe6, 0xe6, 0xdc, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-	0xe6, 0xe6, 0xdc, 0xe6, 0xe6, 0xea, 0xd6, 0xdc,
-	/* Node for range 0x01dd_ */
-	0xca, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-	/* Node for range 0x01de_ */
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-	/* Node for range 0x01df_ */
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xe6, 0xe9, 0xdc, 0xe6, 0xdc,
-	/* Node for range 0x020d_ */
-	0xe6, 0xe6, 0x01, 0x01, 0xe6, 0xe6, 0xe6, 0xe6,
-	0x01, 0x01, 0x01, 0xe6, 0xe6, 0x00, 0x00, 0x00,
-	/* Node for range 0x020e_ */
-	0x00, 0xe6, 0x00, 0x00, 0x00, 0x01, 0x01, 0xe6,
-	0xdc, 0xe6, 0x01, 0x01, 0xdc, 0xdc, 0xdc, 0xdc,
-	/* Node for range 0x020f_ */
-	0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x02ce_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6,
-	/* Node for range 0x02cf_ */
-	0xe6, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x02d7_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-	/* Node for range 0x02de_ */
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-	/* Node for range 0x02df_ */
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-	/* Node for range 0x0302_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xda, 0xe4, 0xe8, 0xde, 0xe0, 0xe0,
-	/* Node for range 0x0309_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x0a66_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6,
-	/* Node for range 0x0a67_ */
-	0x00, 0x00, 0x00, 0x00, 0xe6, 0xe6, 0xe6, 0xe6,
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x00, 0x00,
-	/* Node for range 0x0a69_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xe6,
-	/* Node for range 0x0a6f_ */
-	0xe6, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x0a80_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x0a8c_ */
-	0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x0a8e_ */
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-	/* Node for range 0x0a8f_ */
-	0xe6, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x0a92_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xdc, 0xdc, 0xdc, 0x00, 0x00,
-	/* Node for range 0x0a95_ */
-	0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x0a9b_ */
-	0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x0a9c_ */
-	0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x0aab_ */
-	0xe6, 0x00, 0xe6, 0xe6, 0xdc, 0x00, 0x00, 0xe6,
-	0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xe6,
-	/* Node for range 0x0aac_ */
-	0x00, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x0aaf_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x0abe_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
-	/* Node for range 0x0fb1_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00,
-	/* Node for range 0x0fe2_ */
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xdc,
-	0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xe6, 0xe6,
-	/* Node for range 0x101f_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00,
-	/* Node for range 0x102e_ */
-	0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x1037_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xe6,
-	0xe6, 0xe6, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x10a0_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x00, 0xe6,
-	/* Node for range 0x10a3_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xe6, 0x01, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x09,
-	/* Node for range 0x10ae_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xdc, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x1104_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x1107_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-	/* Node for range 0x110b_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x1110_ */
-	0xe6, 0xe6, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x1113_ */
-	0x00, 0x00, 0x00, 0x09, 0x09, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x1117_ */
-	0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x111c_ */
-	0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x1123_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x07, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x112e_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x07, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x1133_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-	/* Node for range 0x1134_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
-	/* Node for range 0x1136_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xe6,
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x00, 0x00, 0x00,
-	/* Node for range 0x1137_ */
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x1144_ */
-	0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x07, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x114c_ */
-	0x00, 0x00, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x115b_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-	/* Node for range 0x115c_ */
-	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x1163_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-	/* Node for range 0x116b_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x07,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x1172_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x11c3_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-	/* Node for range 0x16af_ */
-	0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x16b3_ */
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x1bc9_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-	/* Node for range 0x1d16_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xd8, 0x01,
-	0x01, 0x01, 0x00, 0x00, 0x00, 0xe2, 0xd8, 0xd8,
-	/* Node for range 0x1d17_ */
-	0xd8, 0xd8, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc,
-	/* Node for range 0x1d18_ */
-	0xdc, 0xdc, 0xdc, 0x00, 0x00, 0xe6, 0xe6, 0xe6,
-	0xe6, 0xe6, 0xdc, 0xdc, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x1d1a_ */
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xe6, 0xe6, 0xe6, 0xe6, 0x00, 0x00,
-	/* Node for range 0x1d24_ */
-	0x00, 0x00, 0xe6, 0xe6, 0xe6, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x1e00_ */
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x00,
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-	/* Node for range 0x1e01_ */
-	0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-	0xe6, 0x00, 0x00, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
-	/* Node for range 0x1e02_ */
-	0xe6, 0xe6, 0x00, 0xe6, 0xe6, 0x00, 0xe6, 0xe6,
-	0xe6, 0xe6, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x1e8d_ */
-	0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	/* Node for range 0x1e94_ */
-	0x00, 0x00, 0x00, 0x00, 0xe6, 0xe6, 0xe6, 0xe6,
-	0xe6, 0xe6, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-};
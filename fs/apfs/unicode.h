@@ -9,6 +9,8 @@
 #define _APFS_UNICODE_H
 
 #include <linux/nls.h>
+#include <linux/string.h>
+#include <linux/types.h>
 
 /*
  * This structure helps apfs_normalize_next() to retrieve one normalized
@@ -16,14 +18,103 @@
  */
 struct apfs_unicursor {
 	const char *utf8curr;	/* Start of UTF-8 to decompose and reorder */
+	int skip;		/* Chars of its normalization already done */
 	int length;		/* Length of normalization until next starter */
 	int last_pos;           /* Offset in substring of last char returned */
 	u8 last_ccc;		/* CCC of the last character returned */
 };
 
+/* Characters that fit in struct apfs_nname without an allocation */
+#define APFS_NNAME_INLINE	32
+
+/*
+ * A whole string after normalization (and case folding), as UTF-32.  Two of
+ * these can be compared with a single memcmp(), and hashed in one go.
+ */
+struct apfs_nname {
+	unicode_t *chars;	/* The characters, not null-terminated */
+	unsigned int len;	/* Number of characters in @chars */
+	unsigned int size;	/* Capacity of @chars */
+	unicode_t inline_chars[APFS_NNAME_INLINE];
+};
+
+/* Set in the word if any of its eight bytes is not ascii */
+#define APFS_ASCII_HIGH_BITS	0x8080808080808080ULL
+
+/**
+ * apfs_ascii_fold_word - Case fold eight ascii characters at once
+ * @word: the characters, none of them above 0x7f
+ *
+ * Returns @word with each of its bytes in the 'A' to 'Z' range set to lower
+ * case, just like tolower() would do byte by byte.
+ */
+static inline u64 apfs_ascii_fold_word(u64 word)
+{
+	/* The high bit gets set for bytes from 'A' on, and from '[' on */
+	u64 from_a = word + 0x3f3f3f3f3f3f3f3fULL;
+	u64 past_z = word + 0x2525252525252525ULL;
+
+	return word | ((from_a & ~past_z & APFS_ASCII_HIGH_BITS) >> 2);
+}
+
 extern void apfs_init_unicursor(struct apfs_unicursor *cursor,
 				 const char *utf8str);
-extern unicode_t apfs_normalize_next(struct apfs_unicursor *cursor,
-				     bool case_fold);
+extern unicode_t apfs_normalize_next_cs(struct apfs_unicursor *cursor);
+extern unicode_t apfs_normalize_next_cf(struct apfs_unicursor *cursor);
+
+/**
+ * apfs_normalize_next - Return the next normalized character from a string
+ * @cursor:	unicode cursor for the string
+ * @case_fold:	case fold the string?
+ *
+ * The per-character loops are specialized for each mode; when @case_fold is a
+ * constant, the choice between them is made at build time.
+ */
+static inline unicode_t apfs_normalize_next(struct apfs_unicursor *cursor,
+					    bool case_fold)
+{
+	if (case_fold)
+		return apfs_normalize_next_cf(cursor);
+	return apfs_normalize_next_cs(cursor);
+}
+
+extern int apfs_normalize_name_cs(const char *utf8str,
+				  struct apfs_nname *nname);
+extern int apfs_normalize_name_cf(const char *utf8str,
+				  struct apfs_nname *nname);
+extern void apfs_nname_free(struct apfs_nname *nname);
+extern int apfs_nname_cmp(const struct apfs_nname *nname1,
+			  const struct apfs_nname *nname2);
+extern u32 apfs_nname_hash(const struct apfs_nname *nname);
+
+/**
+ * apfs_normalize_name - Normalize a whole string into a buffer
+ * @utf8str:	string to normalize
+ * @case_fold:	case fold the string?
+ * @nname:	on return, the normalized string
+ *
+ * Returns 0 on success, or -ENOMEM in case of failure.  Either way, @nname
+ * must be released with apfs_nname_free().
+ */
+static inline int apfs_normalize_name(const char *utf8str, bool case_fold,
+				      struct apfs_nname *nname)
+{
+	if (case_fold)
+		return apfs_normalize_name_cf(utf8str, nname);
+	return apfs_normalize_name_cs(utf8str, nname);
+}
+
+/**
+ * apfs_nname_equal - Check if two normalized names are the same
+ * @nname1:	first name
+ * @nname2:	second name
+ */
+static inline bool apfs_nname_equal(const struct apfs_nname *nname1,
+				    const struct apfs_nname *nname2)
+{
+	return nname1->len == nname2->len &&
+	       !memcmp(nname1->chars, nname2->chars,
+		       nname1->len * sizeof(*nname1->chars));
+}
 
 #endif	/* _APFS_UNICODE_H */
@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/vgroup.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ *
+ * Firmlinks between the system and data volumes of a volume group.  With the
+ * vgroup mount option, the data volume is mounted internally along with the
+ * system volume, and each firmlink directory of the system volume becomes an
+ * automount point for its target in the data volume.  Path walks only pay
+ * for the firmlink the first time they cross it; after that the vfs finds
+ * the mount in its hash table like any other.
+ */
+
+#include <linux/dcache.h>
+#include <linux/limits.h>
+#include <linux/mount.h>
+#include <linux/namei.h>
+#include <linux/path.h>
+#include <linux/slab.h>
+#include "apfs.h"
+#include "inode.h"
+#include "message.h"
+#include "super.h"
+#include "vgroup.h"
+#include "xattr.h"
+
+/**
+ * apfs_firmlink_setup - Find out if a new directory inode is a firmlink
+ * @inode:	the directory, already read from disk
+ *
+ * Only needs a catalog search if the xattrs didn't fit in the inode's leaf.
+ */
+void apfs_firmlink_setup(struct inode *inode)
+{
+	struct apfs_inode_info *ai = APFS_I(inode);
+
+	if (!(APFS_SB(inode->i_sb)->s_flags & APFS_VGROUP))
+		return;
+	if (ai->i_firmlink != APFS_FIRMLINK_UNKNOWN)
+		return;
+	if (apfs_xattr_get(inode, APFS_XATTR_NAME_FIRMLINK, NULL, 0) > 0)
+		ai->i_firmlink = APFS_FIRMLINK_YES;
+	else
+		ai->i_firmlink = APFS_FIRMLINK_NONE;
+}
+
+/**
+ * apfs_firmlink_set_dentry - Make the dentry of a firmlink an automount point
+ * @dentry:	new dentry, not yet spliced
+ * @inode:	inode for @dentry, or NULL
+ *
+ * The usual dentry operations would turn every dentry into an automount
+ * point, so firmlinks get their own.  Both sets hash and compare the same
+ * way, so the flags for those are still right.
+ */
+void apfs_firmlink_set_dentry(struct dentry *dentry, struct inode *inode)
+{
+	if (!inode || !S_ISDIR(inode->i_mode))
+		return;
+	if (APFS_I(inode)->i_firmlink != APFS_FIRMLINK_YES)
+		return;
+	if (!APFS_SB(inode->i_sb)->s_vgroup_mnt)
+		return;
+
+	spin_lock(&dentry->d_lock);
+	dentry->d_op = &apfs_firmlink_dentry_operations;
+	dentry->d_flags |= DCACHE_NEED_AUTOMOUNT;
+	spin_unlock(&dentry->d_lock);
+}
+
+/**
+ * apfs_firmlink_target - Read the target of a firmlink
+ * @inode:	the firmlink directory
+ *
+ * Returns the path of the target inside the data volume, to be freed by the
+ * caller, or an ERR_PTR in case of failure.
+ */
+static char *apfs_firmlink_target(struct inode *inode)
+{
+	char *target;
+	int len;
+
+	target = kmalloc(PATH_MAX, GFP_KERNEL);
+	if (!target)
+		return ERR_PTR(-ENOMEM);
+	len = apfs_xattr_get(inode, APFS_XATTR_NAME_FIRMLINK, target,
+			     PATH_MAX - 1);
+	if (len < 0) {
+		kfree(target);
+		return ERR_PTR(len);
+	}
+	target[len] = 0;
+
+	/* The value is null-terminated on disk, and relative to the root */
+	if (!len || strlen(target) != len - 1 || target[0] == '/') {
+		apfs_alert(inode->i_sb, "bad firmlink in inode 0x%llx",
+			   apfs_ino(inode));
+		kfree(target);
+		return ERR_PTR(-EFSCORRUPTED);
+	}
+	return target;
+}
+
+/**
+ * apfs_firmlink_automount - Cross a firmlink into the data volume
+ * @path:	the firmlink directory
+ *
+ * Returns a private mount of the data volume rooted at the firmlink target,
+ * for the vfs to mount over @path, or an ERR_PTR in case of failure.
+ */
+struct vfsmount *apfs_firmlink_automount(struct path *path)
+{
+	struct inode *inode = d_inode(path->dentry);
+	struct vfsmount *data_mnt = APFS_SB(inode->i_sb)->s_vgroup_mnt;
+	struct vfsmount *mnt;
+	struct path target_path;
+	char *target;
+	int err;
+
+	target = apfs_firmlink_target(inode);
+	if (IS_ERR(target))
+		return ERR_CAST(target);
+	err = vfs_path_lookup(data_mnt->mnt_root, data_mnt, target,
+			      LOOKUP_DIRECTORY, &target_path);
+	if (err) {
+		apfs_warn(inode->i_sb, "firmlink target %s not found (%d)",
+			  target, err);
+		kfree(target);
+		return ERR_PTR(err);
+	}
+	kfree(target);
+
+	mnt = clone_private_mount(&target_path);
+	path_put(&target_path);
+	return mnt;
+}
@@ -0,0 +1,26 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/vgroup.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_VGROUP_H
+#define _APFS_VGROUP_H
+
+struct dentry;
+struct inode;
+struct path;
+struct vfsmount;
+
+/* Firmlink state of a directory, for the vgroup mount option */
+#define APFS_FIRMLINK_UNKNOWN	0	/* Not all xattrs were seen yet */
+#define APFS_FIRMLINK_NONE	1
+#define APFS_FIRMLINK_YES	2
+
+extern void apfs_firmlink_setup(struct inode *inode);
+extern void apfs_firmlink_set_dentry(struct dentry *dentry,
+				     struct inode *inode);
+extern struct vfsmount *apfs_firmlink_automount(struct path *path);
+
+#endif	/* _APFS_VGROUP_H */
@@ -0,0 +1,691 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ *  linux/fs/apfs/warmup.c
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#include <linux/blkdev.h>
+#include <linux/buffer_head.h>
+#include <linux/mm.h>
+#include <linux/sched.h>
+#include <linux/sched/signal.h>
+#include <linux/slab.h>
+#include <linux/sort.h>
+#include <linux/uaccess.h>
+#include <linux/workqueue.h>
+#include "apfs.h"
+#include "btree.h"
+#include "ioctl.h"
+#include "message.h"
+#include "node.h"
+#include "super.h"
+#include "warmup.h"
+
+static struct workqueue_struct *apfs_warmup_wq;
+static struct workqueue_struct *apfs_load_wq;
+
+/*
+ * Leaf blocks found by a warm-up, waiting to be read ahead
+ */
+struct apfs_warmup_batch {
+	u64 *bnos;		/* Block numbers of the leaves */
+	unsigned int nr;	/* Number of entries in @bnos */
+	unsigned long total;	/* Leaves read ahead so far */
+};
+
+static int apfs_warmup_bno_cmp(const void *a, const void *b)
+{
+	u64 bno_a = *(const u64 *)a;
+	u64 bno_b = *(const u64 *)b;
+
+	return bno_a < bno_b ? -1 : bno_a > bno_b;
+}
+
+/**
+ * apfs_warmup_readahead - Start the reads for a list of blocks
+ * @sb:		filesystem superblock
+ * @bnos:	block numbers, already sorted
+ * @nr:		number of entries in @bnos
+ */
+static void apfs_warmup_readahead(struct super_block *sb, const u64 *bnos,
+				  unsigned int nr)
+{
+	struct blk_plug plug;
+	unsigned int i;
+
+	blk_start_plug(&plug);
+	for (i = 0; i < nr; ++i)
+		apfs_spec_readahead(sb, bnos[i]);
+	blk_finish_plug(&plug);
+}
+
+/**
+ * apfs_warmup_flush - Read ahead a batch of leaves in block order
+ * @sb:		filesystem superblock
+ * @batch:	the batch, which is left empty
+ */
+static void apfs_warmup_flush(struct super_block *sb,
+			      struct apfs_warmup_batch *batch)
+{
+	sort(batch->bnos, batch->nr, sizeof(*batch->bnos),
+	     apfs_warmup_bno_cmp, NULL);
+	apfs_warmup_readahead(sb, batch->bnos, batch->nr);
+
+	batch->total += batch->nr;
+	batch->nr = 0;
+}
+
+/**
+ * apfs_warmup_tree - Read the top levels of a b-tree into the node cache
+ * @wu:		warm-up structure
+ * @node:	root of the subtree, which the caller already holds
+ * @flags:	tree type
+ * @levels:	number of levels to read, counting @node
+ * @batch:	if not NULL, the leaves are only read ahead, through this batch
+ * @count:	incremented by the number of nodes read
+ *
+ * Returns 0 on success, -EINTR if the filesystem is being unmounted, or
+ * another negative error code in case of failure.
+ */
+static int apfs_warmup_tree(struct apfs_warmup *wu, struct apfs_node *node,
+			    unsigned int flags, unsigned int levels,
+			    struct apfs_warmup_batch *batch,
+			    unsigned long *count)
+{
+	struct super_block *sb = wu->sb;
+	struct apfs_btree_node_phys *raw;
+	struct apfs_query query;
+	bool leaf_parent;
+	int err = 0;
+
+	if (levels <= 1 || apfs_node_is_leaf(node))
+		return 0;
+	raw = (struct apfs_btree_node_phys *)node->object.data;
+	leaf_parent = le16_to_cpu(raw->btn_level) == 1;
+
+	apfs_init_query(&query, node);
+	query.flags = flags;
+	for (query.index = 0; query.index < node->records; query.index++) {
+		struct apfs_node *child;
+
+		if (READ_ONCE(wu->stop)) {
+			err = -EINTR;
+			break;
+		}
+
+		err = apfs_node_read_record(&query, NULL /* key */);
+		if (err)
+			break;
+
+		if (batch && leaf_parent) {
+			u64 child_id, child_blk;
+
+			err = apfs_query_child_block(sb, &query, &child_id,
+						     &child_blk);
+			if (err)
+				break;
+			batch->bnos[batch->nr++] = child_blk;
+			if (batch->nr == APFS_WARMUP_BATCH)
+				apfs_warmup_flush(sb, batch);
+			continue;
+		}
+
+		child = apfs_query_read_child(sb, &query);
+		if (IS_ERR(child)) {
+			err = PTR_ERR(child);
+			break;
+		}
+		(*count)++;
+		err = apfs_warmup_tree(wu, child, flags, levels - 1, batch,
+				       count);
+		apfs_node_put(child);
+		if (err)
+			break;
+		cond_resched();
+	}
+	apfs_free_query(sb, &query);
+	return err;
+}
+
+/**
+ * apfs_warmup_work - Read the metadata requested by the warmup mount option
+ * @work:	work structure embedded in the warm-up
+ *
+ * The top levels of the omap and the catalog get parsed into the node cache.
+ * For a full catalog warm-up, the leaves are too many to keep parsed, so they
+ * are only read ahead into the page cache of the device, sorted by block
+ * number one batch at a time.
+ */
+static void apfs_warmup_work(struct work_struct *work)
+{
+	struct apfs_warmup *wu = container_of(work, struct apfs_warmup, work);
+	struct super_block *sb = wu->sb;
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_warmup_batch batch = {0};
+	struct apfs_warmup_batch *bp = NULL;
+	unsigned int levels = wu->levels;
+	unsigned long count = 0;
+	int err;
+
+	if (levels == APFS_WARMUP_CATALOG) {
+		levels = APFS_BTREE_MAX_DEPTH;
+		batch.bnos = kvmalloc_array(APFS_WARMUP_BATCH,
+					    sizeof(*batch.bnos), GFP_KERNEL);
+		if (!batch.bnos) {
+			err = -ENOMEM;
+			goto out;
+		}
+		bp = &batch;
+	}
+
+	err = apfs_warmup_tree(wu, sbi->s_omap_root, APFS_QUERY_OMAP, levels,
+			       bp, &count);
+	if (bp)
+		apfs_warmup_flush(sb, bp);
+	if (err)
+		goto out;
+
+	err = apfs_warmup_tree(wu, sbi->s_cat_root, APFS_QUERY_CAT, levels,
+			       bp, &count);
+	if (bp)
+		apfs_warmup_flush(sb, bp);
+
+out:
+	kvfree(batch.bnos);
+	if (err == -EINTR)
+		return;
+	if (err)
+		apfs_warn(sb, "metadata warm-up failed (%d)", err);
+	else
+		apfs_info(sb, "warm-up read %lu nodes, %lu leaves ahead",
+			  count, batch.total);
+}
+
+/*
+ * Growable list of the blocks for one level of a b-tree
+ */
+struct apfs_load_level {
+	u64 *bnos;
+	unsigned long nr;
+	unsigned long alloc;
+};
+
+/**
+ * apfs_load_level_add - Add the children of an index node to a level
+ * @sb:		filesystem superblock
+ * @node:	the index node
+ * @flags:	tree type
+ * @level:	the level
+ * @room:	maximum number of entries the level may hold
+ *
+ * Returns 0 on success, -EFBIG if the level would grow beyond @room, or
+ * another negative error code in case of failure.
+ */
+static int apfs_load_level_add(struct super_block *sb, struct apfs_node *node,
+			       unsigned int flags, struct apfs_load_level *level,
+			       unsigned long room)
+{
+	struct apfs_query query;
+	int err = 0;
+
+	if (level->nr + node->records > room)
+		return -EFBIG;
+	if (level->nr + node->records > level->alloc) {
+		unsigned long alloc = max(2 * level->alloc,
+					  level->nr + node->records);
+		u64 *bnos;
+
+		alloc = min(alloc, room);
+		bnos = kvmalloc_array(alloc, sizeof(*bnos), GFP_KERNEL);
+		if (!bnos)
+			return -ENOMEM;
+		if (level->nr)
+			memcpy(bnos, level->bnos, level->nr * sizeof(*bnos));
+		kvfree(level->bnos);
+		level->bnos = bnos;
+		level->alloc = alloc;
+	}
+
+	apfs_init_query(&query, node);
+	query.flags = flags;
+	for (query.index = 0; query.index < node->records; query.index++) {
+		u64 child_id;
+
+		err = apfs_node_read_record(&query, NULL /* key */);
+		if (err)
+			break;
+		err = apfs_query_child_block(sb, &query, &child_id,
+					     &level->bnos[level->nr]);
+		if (err)
+			break;
+		level->nr++;
+	}
+	apfs_free_query(sb, &query);
+	return err;
+}
+
+/*
+ * Share of one level of a b-tree, for a worker of apfs_load_tree()
+ */
+struct apfs_load_work {
+	struct work_struct work;
+	struct super_block *sb;
+	unsigned int flags;		/* Tree type */
+	const u64 *bnos;		/* Sorted blocks of the share */
+	unsigned long nr;		/* Number of entries in @bnos */
+	struct apfs_load_level next;	/* Children found in the share */
+	atomic_long_t *count;		/* Nodes pinned by all workers */
+	unsigned long max;		/* Maximum for @count */
+	bool *abort;			/* Set when one of the workers fails */
+	int err;
+};
+
+/**
+ * apfs_load_share - Read, parse and pin the nodes of a share of a level
+ * @lw:		the share
+ *
+ * The blocks of the share are read ahead in batches.  The children of each
+ * index node go to the next level of the share, so the workers never touch
+ * each other's lists.  On failure, @lw->err is set and the other workers are
+ * told to give up.
+ */
+static void apfs_load_share(struct apfs_load_work *lw)
+{
+	struct super_block *sb = lw->sb;
+	unsigned long i, j;
+	int err = 0;
+
+	for (i = 0; i < lw->nr && !err; i += APFS_WARMUP_BATCH) {
+		unsigned long nr = min_t(unsigned long, lw->nr - i,
+					 APFS_WARMUP_BATCH);
+
+		apfs_warmup_readahead(sb, lw->bnos + i, nr);
+		for (j = i; j < i + nr; ++j) {
+			struct apfs_node *node;
+			long count;
+
+			if (READ_ONCE(*lw->abort)) {
+				err = -ECANCELED;
+				break;
+			}
+			node = apfs_read_node(sb, lw->bnos[j]);
+			if (IS_ERR(node)) {
+				err = PTR_ERR(node);
+				break;
+			}
+			if (apfs_node_pin(node))
+				atomic_long_inc(lw->count);
+			count = atomic_long_read(lw->count);
+			/* The other shares are checked once they are merged */
+			if (count > lw->max)
+				err = -EFBIG;
+			else if (!apfs_node_is_leaf(node))
+				err = apfs_load_level_add(sb, node, lw->flags,
+							  &lw->next,
+							  lw->max - count);
+			apfs_node_put(node);
+			if (err)
+				break;
+		}
+		cond_resched();
+	}
+
+	lw->err = err;
+	if (err)
+		WRITE_ONCE(*lw->abort, true);
+}
+
+static void apfs_load_work_fn(struct work_struct *work)
+{
+	apfs_load_share(container_of(work, struct apfs_load_work, work));
+}
+
+/**
+ * apfs_load_level - Read, parse and pin all the nodes of a level
+ * @sb:		filesystem superblock
+ * @flags:	tree type
+ * @curr:	the level, already sorted
+ * @next:	level to fill with the children of @curr, empty on entry
+ * @count:	number of nodes pinned so far
+ * @max:	maximum for @count
+ *
+ * The level is split into contiguous shares of blocks, each one read in
+ * parallel by a worker of the load workqueue, so that parsing and checksums
+ * use every cpu while the disk still sees ascending reads.  Small levels are
+ * read by the caller alone.  Returns 0 on success, -EFBIG if the tree needs
+ * more than @max nodes, or another negative error code in case of failure.
+ */
+static int apfs_load_level(struct super_block *sb, unsigned int flags,
+			   const struct apfs_load_level *curr,
+			   struct apfs_load_level *next, atomic_long_t *count,
+			   unsigned long max)
+{
+	struct apfs_load_work *works;
+	unsigned long total = 0, start = 0;
+	unsigned int nr_works, i;
+	bool abort = false;
+	int err = 0;
+
+	nr_works = min_t(unsigned long, num_online_cpus(),
+			 DIV_ROUND_UP(curr->nr, APFS_LOAD_MIN_SHARE));
+	nr_works = clamp_t(unsigned int, nr_works, 1, APFS_LOAD_MAX_WORKERS);
+	works = kcalloc(nr_works, sizeof(*works), GFP_KERNEL);
+	if (!works)
+		return -ENOMEM;
+
+	for (i = 0; i < nr_works; i++) {
+		struct apfs_load_work *lw = &works[i];
+		unsigned long end = curr->nr * (i + 1) / nr_works;
+
+		lw->sb = sb;
+		lw->flags = flags;
+		lw->bnos = curr->bnos + start;
+		lw->nr = end - start;
+		lw->count = count;
+		lw->max = max;
+		lw->abort = &abort;
+		start = end;
+		INIT_WORK(&lw->work, apfs_load_work_fn);
+		/* The caller takes the first share itself */
+		if (i)
+			queue_work(apfs_load_wq, &lw->work);
+	}
+	apfs_load_share(&works[0]);
+	for (i = 1; i < nr_works; i++)
+		flush_work(&works[i].work);
+
+	for (i = 0; i < nr_works; i++) {
+		if (!err && works[i].err != -ECANCELED)
+			err = works[i].err;
+		total += works[i].next.nr;
+	}
+	if (!err && total > max - atomic_long_read(count))
+		err = -EFBIG;
+	if (!err && total) {
+		next->bnos = kvmalloc_array(total, sizeof(*next->bnos),
+					    GFP_KERNEL);
+		if (!next->bnos)
+			err = -ENOMEM;
+	}
+	for (i = 0; i < nr_works; i++) {
+		struct apfs_load_level *part = &works[i].next;
+
+		if (!err && part->nr) {
+			memcpy(next->bnos + next->nr, part->bnos,
+			       part->nr * sizeof(*part->bnos));
+			next->nr += part->nr;
+		}
+		kvfree(part->bnos);
+	}
+	next->alloc = next->nr;
+	kfree(works);
+	return err;
+}
+
+/**
+ * apfs_load_tree - Read a whole b-tree into memory and pin it there
+ * @sb:		filesystem superblock
+ * @root:	root of the tree
+ * @flags:	tree type
+ * @count:	incremented by the number of nodes pinned
+ * @max:	maximum number of nodes to pin, counting the ones in @count
+ *
+ * The tree is read one level at a time.  The blocks of each level are sorted
+ * before they get read, so the disk sees a single sweep per level instead of
+ * the seeks of a depth-first walk; the readahead of each chunk of blocks is
+ * submitted together.  The size of each level is known before reading it, so
+ * a tree that's too big gets refused without wasting the reads.
+ *
+ * Returns 0 on success, -EFBIG if the tree needs more than @max nodes, or
+ * another negative error code in case of failure.
+ */
+static int apfs_load_tree(struct super_block *sb, struct apfs_node *root,
+			  unsigned int flags, unsigned long *count,
+			  unsigned long max)
+{
+	struct apfs_load_level curr = {0}, next = {0};
+	atomic_long_t pinned;
+	unsigned int depth;
+	int err = 0;
+
+	if (*count >= max)
+		return -EFBIG;
+	if (apfs_node_pin(root))
+		(*count)++;
+	if (apfs_node_is_leaf(root))
+		return 0;
+	err = apfs_load_level_add(sb, root, flags, &curr, max - *count);
+	if (err)
+		goto out;
+
+	atomic_long_set(&pinned, *count);
+	for (depth = 1; curr.nr; ++depth) {
+		if (depth >= APFS_BTREE_MAX_DEPTH) {
+			apfs_alert(sb, "b-tree is corrupted");
+			err = -EFSCORRUPTED;
+			break;
+		}
+		if (fatal_signal_pending(current)) {
+			err = -EINTR;
+			break;
+		}
+		sort(curr.bnos, curr.nr, sizeof(*curr.bnos),
+		     apfs_warmup_bno_cmp, NULL);
+
+		err = apfs_load_level(sb, flags, &curr, &next, &pinned, max);
+		kvfree(curr.bnos);
+		curr = next;
+		memset(&next, 0, sizeof(next));
+		if (err)
+			break;
+	}
+	*count = atomic_long_read(&pinned);
+
+out:
+	kvfree(curr.bnos);
+	return err;
+}
+
+/**
+ * apfs_warmup_load - Read all the metadata of a new mount into memory
+ * @sb:		filesystem superblock
+ *
+ * Used for the metadata=ram mount option.  The whole object map and catalog
+ * get read and pinned in the node cache, so the lookups never need to wait
+ * for the disk after the mount.  The memory taken by each node is known, so
+ * the mount is refused if the trees would take more than the metadata_limit.
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+int apfs_warmup_load(struct super_block *sb)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	unsigned long node_bytes = apfs_node_size() + sb->s_blocksize;
+	unsigned long max, count = 0, omap_count;
+	int err;
+
+	max = ((unsigned long)sbi->s_meta_limit << 20) / node_bytes;
+
+	err = apfs_load_tree(sb, sbi->s_omap_root, APFS_QUERY_OMAP, &count,
+			     max);
+	omap_count = count;
+	if (!err)
+		err = apfs_load_tree(sb, sbi->s_cat_root, APFS_QUERY_CAT,
+				     &count, max);
+	if (err == -EFBIG) {
+		apfs_err(sb, "metadata won't fit in %u MiB, set a higher metadata_limit or drop metadata=ram",
+			 sbi->s_meta_limit);
+		return -ENOMEM;
+	}
+	if (err) {
+		apfs_err(sb, "failed to load the metadata (%d)", err);
+		return err;
+	}
+
+	apfs_info(sb, "metadata=ram: %lu omap and %lu catalog nodes in memory (%lu KiB of %u MiB)",
+		  omap_count, count - omap_count, count * node_bytes >> 10,
+		  sbi->s_meta_limit);
+	return 0;
+}
+
+/**
+ * apfs_warmup_start - Queue the metadata warm-up for a new mount
+ * @sb:	filesystem superblock
+ *
+ * Does nothing unless the warmup mount option was given.  The mount goes on
+ * without waiting for the reads.
+ */
+void apfs_warmup_start(struct super_block *sb)
+{
+	struct apfs_warmup *wu = &APFS_SB(sb)->s_warmup;
+
+	wu->sb = sb;
+	wu->stop = false;
+	INIT_WORK(&wu->work, apfs_warmup_work);
+	if (wu->levels)
+		queue_work(apfs_warmup_wq, &wu->work);
+}
+
+/**
+ * apfs_warmup_stop - Cancel the metadata warm-up of a mount
+ * @sb:	filesystem superblock
+ *
+ * Must be called on unmount, before the trees are released.
+ */
+void apfs_warmup_stop(struct super_block *sb)
+{
+	struct apfs_warmup *wu = &APFS_SB(sb)->s_warmup;
+
+	if (!wu->levels)
+		return;
+	WRITE_ONCE(wu->stop, true);
+	cancel_work_sync(&wu->work);
+}
+
+/**
+ * apfs_warmset_id - Set the fields that identify the mount in a warm set
+ * @sb:		filesystem superblock
+ * @req:	the warm set request
+ */
+static void apfs_warmset_id(struct super_block *sb,
+			    struct apfs_warmset_req *req)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+
+	memcpy(req->ws_nx_uuid, sbi->s_msb_raw->nx_uuid,
+	       sizeof(req->ws_nx_uuid));
+	memcpy(req->ws_vol_uuid, sbi->s_vsb_raw->apfs_vol_uuid,
+	       sizeof(req->ws_vol_uuid));
+	req->ws_xid = sbi->s_xid;
+}
+
+/**
+ * apfs_warmset_get - Report the blocks of the nodes in the cache
+ * @sb:		filesystem superblock
+ * @req:	the request, already checked by the caller
+ *
+ * The list can be saved before unmount and given back to the next mount
+ * with apfs_warmset_load(), so that it gets its working set back without
+ * waiting for every node on the disk.  Returns 0 on success, or a negative
+ * error code in case of failure; on success @req is updated with the entries
+ * filled and the identity of the mount.
+ */
+int apfs_warmset_get(struct super_block *sb, struct apfs_warmset_req *req)
+{
+	u64 *bnos;
+	unsigned long nr;
+	int err = 0;
+
+	bnos = kvmalloc_array(req->ws_count, sizeof(*bnos), GFP_KERNEL);
+	if (!bnos)
+		return -ENOMEM;
+	nr = apfs_node_cache_collect(sb, bnos, req->ws_count);
+	sort(bnos, nr, sizeof(*bnos), apfs_warmup_bno_cmp, NULL);
+	if (copy_to_user(u64_to_user_ptr(req->ws_buffer), bnos,
+			 nr * sizeof(*bnos)))
+		err = -EFAULT;
+	kvfree(bnos);
+	if (err)
+		return err;
+
+	req->ws_count = nr;
+	apfs_warmset_id(sb, req);
+	return 0;
+}
+
+/**
+ * apfs_warmset_load - Read ahead the blocks of a saved warm set
+ * @sb:		filesystem superblock
+ * @req:	the request, already checked by the caller
+ *
+ * The reads are only started, in batches sorted by block number.  Returns 0
+ * on success, -ESTALE if the warm set was saved for another volume or
+ * checkpoint, or another negative error code in case of failure.
+ */
+int apfs_warmset_load(struct super_block *sb,
+		      const struct apfs_warmset_req *req)
+{
+	const u64 __user *ubuf = u64_to_user_ptr(req->ws_buffer);
+	struct apfs_warmset_req id;
+	u64 *bnos;
+	u32 done, nr;
+	int err = 0;
+
+	apfs_warmset_id(sb, &id);
+	if (memcmp(id.ws_nx_uuid, req->ws_nx_uuid, sizeof(id.ws_nx_uuid)) ||
+	    memcmp(id.ws_vol_uuid, req->ws_vol_uuid, sizeof(id.ws_vol_uuid)) ||
+	    id.ws_xid != req->ws_xid)
+		return -ESTALE;
+
+	bnos = kmalloc_array(APFS_WARMUP_BATCH, sizeof(*bnos), GFP_KERNEL);
+	if (!bnos)
+		return -ENOMEM;
+	for (done = 0; done < req->ws_count; done += nr) {
+		nr = min_t(u32, req->ws_count - done, APFS_WARMUP_BATCH);
+		if (copy_from_user(bnos, ubuf + done, nr * sizeof(*bnos))) {
+			err = -EFAULT;
+			break;
+		}
+		sort(bnos, nr, sizeof(*bnos), apfs_warmup_bno_cmp, NULL);
+		apfs_warmup_readahead(sb, bnos, nr);
+
+		if (fatal_signal_pending(current)) {
+			err = -EINTR;
+			break;
+		}
+		cond_resched();
+	}
+	kfree(bnos);
+	return err;
+}
+
+/**
+ * apfs_warmup_init - Create the workqueues for the metadata warm-ups and loads
+ *
+ * A single warm-up runs at a time, so that several mounts don't compete for
+ * the disk.  The loads for metadata=ram get a bounded pool of workers, since
+ * they hold up the mount.  Returns 0 on success, or -ENOMEM in case of failure.
+ */
+int __init apfs_warmup_init(void)
+{
+	apfs_warmup_wq = alloc_workqueue("apfs-warmup", WQ_UNBOUND, 1);
+	if (!apfs_warmup_wq)
+		return -ENOMEM;
+	apfs_load_wq = alloc_workqueue("apfs-load", WQ_UNBOUND,
+				       APFS_LOAD_MAX_WORKERS);
+	if (!apfs_load_wq) {
+		destroy_workqueue(apfs_warmup_wq);
+		return -ENOMEM;
+	}
+	return 0;
+}
+
+/**
+ * apfs_warmup_exit - Destroy the workqueues for the metadata warm-ups and loads
+ */
+void apfs_warmup_exit(void)
+{
+	destroy_workqueue(apfs_load_wq);
+	destroy_workqueue(apfs_warmup_wq);
+}
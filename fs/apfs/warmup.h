@@ -0,0 +1,50 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ *  linux/fs/apfs/warmup.h
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ */
+
+#ifndef _APFS_WARMUP_H
+#define _APFS_WARMUP_H
+
+#include <linux/types.h>
+#include <linux/workqueue.h>
+
+struct apfs_warmset_req;
+struct super_block;
+
+/* Value of the warmup level count that stands for the whole catalog */
+#define APFS_WARMUP_CATALOG	UINT_MAX
+
+/* Default for the metadata_limit mount option, in MiB */
+#define APFS_META_LIMIT_DEFAULT	512
+
+/* Leaf blocks to sort and read ahead together in the catalog warm-up */
+#define APFS_WARMUP_BATCH	4096
+
+/* Workers for each level loaded by metadata=ram, and the least they get */
+#define APFS_LOAD_MAX_WORKERS	8
+#define APFS_LOAD_MIN_SHARE	64
+
+/*
+ * Background read of the b-tree metadata of a new mount
+ */
+struct apfs_warmup {
+	struct work_struct work;
+	struct super_block *sb;
+	unsigned int levels;	/* Tree levels to read, 0 if disabled */
+	bool stop;		/* Set on unmount */
+};
+
+extern int apfs_warmup_load(struct super_block *sb);
+extern void apfs_warmup_start(struct super_block *sb);
+extern void apfs_warmup_stop(struct super_block *sb);
+extern int apfs_warmset_get(struct super_block *sb,
+			    struct apfs_warmset_req *req);
+extern int apfs_warmset_load(struct super_block *sb,
+			     const struct apfs_warmset_req *req);
+extern int apfs_warmup_init(void);
+extern void apfs_warmup_exit(void);
+
+#endif	/* _APFS_WARMUP_H */
@@ -5,15 +5,25 @@
  * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
  */
 
+#include <linux/blkdev.h>
 #include <linux/buffer_head.h>
+#include <linux/highmem.h>
+#include <linux/overflow.h>
+#include <linux/pagemap.h>
+#include <linux/slab.h>
 #include <linux/xattr.h>
 #include "apfs.h"
 #include "btree.h"
+#include "crypto.h"
 #include "extents.h"
+#include "inode.h"
+#include "ioctl.h"
 #include "key.h"
+#include "stats.h"
 #include "super.h"
 #include "node.h"
 #include "message.h"
+#include "vgroup.h"
 #include "xattr.h"
 
 /**
@@ -33,7 +43,7 @@ static int apfs_xattr_from_query(struct apfs_query *query,
 {
 	struct apfs_xattr_val *xattr_val;
 	struct apfs_xattr_key *xattr_key;
-	char *raw = query->node->object.bh->b_data;
+	char *raw = query->node->object.data;
 	int datalen = query->len - sizeof(*xattr_val);
 	int namelen = query->key_len - sizeof(*xattr_key);
 
@@ -66,51 +76,178 @@ static int apfs_xattr_from_query(struct apfs_query *query,
 }
 
 /**
- * apfs_xattr_extents_read - Read the value of a xattr from its extents
+ * apfs_xattr_readahead - Start the reads for a range of blocks of a xattr
+ * @sb:		filesystem superblock
+ * @bno:	first block number
+ * @count:	number of blocks
+ *
+ * The reads are plugged together, so that the block layer can merge them in
+ * large requests; the copy that follows only has to wait for them.
+ */
+static void apfs_xattr_readahead(struct super_block *sb, u64 bno, u64 count)
+{
+	struct blk_plug plug;
+
+	blk_start_plug(&plug);
+	while (count--)
+		sb_breadahead(sb, bno++);
+	blk_finish_plug(&plug);
+}
+
+/**
+ * apfs_xattr_stream - Get the page cache inode for the dstream of a xattr
  * @parent:	inode the attribute belongs to
- * @xattr:	the xattr structure
- * @buffer:	where to copy the attribute value
- * @size:	size of @buffer
+ * @xattr:	the xattr structure, which must have a dstream
  *
- * Copies the value of @xattr to @buffer, if provided. If @buffer is NULL, just
- * computes the size of the buffer required.
+ * Each inode caches a single dstream xattr: other than compressed files, with
+ * their resource forks, few have more than one.  Returns NULL if the stream
+ * can't be cached, so that the caller reads the blocks directly instead.  The
+ * stream lives as long as @parent.
+ */
+static struct inode *apfs_xattr_stream(struct inode *parent,
+				       struct apfs_xattr *xattr)
+{
+	struct apfs_inode_info *ai = APFS_I(parent);
+	struct apfs_xattr_dstream *xdata;
+	struct inode *stream, *old;
+	u64 extent_id, size;
+
+	xdata = (struct apfs_xattr_dstream *) xattr->xdata;
+	extent_id = le64_to_cpu(xdata->xattr_obj_id);
+	size = le64_to_cpu(xdata->dstream.size);
+
+	stream = READ_ONCE(ai->i_xattr_stream);
+	if (!stream) {
+		if (size > MAX_LFS_FILESIZE)
+			return NULL;
+		stream = apfs_new_stream_inode(parent, extent_id, size);
+		if (!stream)
+			return NULL;
+		old = cmpxchg(&ai->i_xattr_stream, NULL, stream);
+		if (old) { /* Lost a race with another reader */
+			iput(stream);
+			stream = old;
+		}
+	}
+	if (APFS_I(stream)->i_extent_id != extent_id)
+		return NULL;
+	return stream;
+}
+
+/**
+ * apfs_xattr_stream_copy - Copy part of the value of a xattr from page cache
+ * @stream:	page cache inode for the dstream of the xattr
+ * @buffer:	where to copy the data
+ * @off:	offset of the data in the attribute value
+ * @len:	length of the data; @off + @len must not exceed the value size
  *
- * Returns the number of bytes used/required, or a negative error code in case
- * of failure.
+ * Pages that are not cached yet are read ahead, up to APFS_XATTR_RA_SIZE at a
+ * time.  Returns 0 on success, or a negative error code in case of failure.
  */
-static int apfs_xattr_extents_read(struct inode *parent,
+static int apfs_xattr_stream_copy(struct inode *stream, void *buffer,
+				  u64 off, u64 len)
+{
+	struct address_space *mapping = stream->i_mapping;
+	struct file_ra_state ra;
+	pgoff_t last;
+
+	if (!len)
+		return 0;
+	last = (off + len - 1) >> PAGE_SHIFT;
+	file_ra_state_init(&ra, mapping);
+	ra.ra_pages = APFS_XATTR_RA_SIZE >> PAGE_SHIFT;
+
+	while (len) {
+		pgoff_t index = off >> PAGE_SHIFT;
+		unsigned int page_off = offset_in_page(off);
+		unsigned int count = min_t(u64, len, PAGE_SIZE - page_off);
+		struct page *page;
+		void *addr;
+
+		page = find_get_page(mapping, index);
+		if (page)
+			put_page(page);
+		else
+			page_cache_sync_readahead(mapping, &ra, NULL, index,
+						  last - index + 1);
+		page = read_mapping_page(mapping, index, NULL);
+		if (IS_ERR(page))
+			return PTR_ERR(page);
+
+		addr = kmap(page);
+		memcpy(buffer, addr + page_off, count);
+		kunmap(page);
+		put_page(page);
+
+		buffer += count;
+		off += count;
+		len -= count;
+	}
+	return 0;
+}
+
+/**
+ * apfs_xattr_stream_free - Drop the xattr page cache of an inode
+ * @inode:	the inode, which is being evicted
+ */
+void apfs_xattr_stream_free(struct inode *inode)
+{
+	struct apfs_inode_info *ai = APFS_I(inode);
+
+	if (!ai->i_xattr_stream)
+		return;
+	iput(ai->i_xattr_stream);
+	ai->i_xattr_stream = NULL;
+}
+
+/**
+ * apfs_xattr_extents_copy - Copy part of the value of a xattr from its extents
+ * @parent:	inode the attribute belongs to
+ * @xattr:	the xattr structure, which must have a dstream
+ * @buffer:	where to copy the data
+ * @off:	offset of the data in the attribute value
+ * @len:	length of the data; @off + @len must not exceed the value size
+ *
+ * The data comes from the page cache of the stream if possible; otherwise the
+ * blocks are read directly.  Returns 0 on success, or a negative error code in
+ * case of failure.
+ */
+static int apfs_xattr_extents_copy(struct inode *parent,
 				   struct apfs_xattr *xattr,
-				   void *buffer, size_t size)
+				   void *buffer, u64 off, u64 len)
 {
 	struct super_block *sb = parent->i_sb;
 	struct apfs_sb_info *sbi = APFS_SB(sb);
 	struct apfs_key key;
-	struct apfs_query *query;
+	struct apfs_query query;
 	struct apfs_xattr_dstream *xdata;
-	u64 extent_id;
-	int length;
+	struct inode *stream;
+	struct page *bounce = NULL;
+	u64 extent_id, end = off + len;
+	u64 ra_max = APFS_XATTR_RA_SIZE >> sb->s_blocksize_bits;
 	int ret;
 	int i;
 
-	xdata = (struct apfs_xattr_dstream *) xattr->xdata;
-	length = le64_to_cpu(xdata->dstream.size);
-	if (length < 0 || length < le64_to_cpu(xdata->dstream.size))
-		return -E2BIG;
+	apfs_stat_inc(sb, APFS_STAT_XATTR_READS);
+	apfs_stat_add(sb, APFS_STAT_XATTR_BYTES, len);
 
-	if (!buffer) /* All we want is the length */
-		return length;
-	if (length > size) /* xattr won't fit in the buffer */
-		return -ERANGE;
+	stream = apfs_xattr_stream(parent, xattr);
+	if (stream)
+		return apfs_xattr_stream_copy(stream, buffer, off, len);
 
+	/* Encrypted blocks are decrypted here before the copy */
+	if (sbi->s_tfm) {
+		bounce = alloc_page(GFP_NOFS);
+		if (!bounce)
+			return -ENOMEM;
+	}
+
+	xdata = (struct apfs_xattr_dstream *) xattr->xdata;
 	extent_id = le64_to_cpu(xdata->xattr_obj_id);
-	/* We will read all the extents, starting with the last one */
+	/* We will read all the extents, in order */
 	apfs_init_file_extent_key(extent_id, 0 /* offset */, &key);
-
-	query = apfs_alloc_query(sbi->s_cat_root, NULL /* parent */);
-	if (!query)
-		return -ENOMEM;
-	query->key = &key;
-	query->flags = APFS_QUERY_CAT | APFS_QUERY_MULTIPLE | APFS_QUERY_EXACT;
+	apfs_btree_iter_init(&query, sbi->s_cat_root, &key,
+			     APFS_QUERY_CAT | APFS_QUERY_MULTIPLE);
 
 	/*
 	 * The logic in this loop would allow a crafted filesystem with a large
@@ -118,15 +255,17 @@ static int apfs_xattr_extents_read(struct inode *parent,
 	 * the xattr length to put a limit on the number of iterations.
 	 */
 	ret = -EFSCORRUPTED;
-	for (i = 0; i < (length >> parent->i_blkbits) + 2; i++) {
+	for (i = 0; i < (end >> parent->i_blkbits) + 2; i++) {
 		struct apfs_file_extent ext;
-		u64 block_count, file_off;
+		u64 block_count, file_off, j, ra_next;
 		int err;
-		int j;
 
-		err = apfs_btree_query(sb, &query);
+		if (i == 0)
+			err = apfs_btree_iter_seek(sb, &query);
+		else
+			err = apfs_btree_iter_next(sb, &query);
 		if (err == -ENODATA) { /* No more records to search */
-			ret = length;
+			ret = 0;
 			goto done;
 		}
 		if (err) {
@@ -134,7 +273,7 @@ static int apfs_xattr_extents_read(struct inode *parent,
 			goto done;
 		}
 
-		err = apfs_extent_from_query(query, &ext);
+		err = apfs_extent_from_query(&query, &ext);
 		if (err) {
 			apfs_alert(sb, "bad extent for xattr in inode 0x%llx",
 				   (unsigned long long) parent->i_ino);
@@ -144,31 +283,107 @@ static int apfs_xattr_extents_read(struct inode *parent,
 
 		block_count = ext.len >> sb->s_blocksize_bits;
 		file_off = ext.logical_addr;
-		for (j = 0; j < block_count; ++j) {
+
+		/* Skip the blocks that come before the range */
+		j = 0;
+		if (off > file_off) {
+			j = (off - file_off) >> sb->s_blocksize_bits;
+			file_off += (u64)j << sb->s_blocksize_bits;
+		}
+		ra_next = j;
+
+		for (; j < block_count; ++j) {
 			struct buffer_head *bh;
-			int bytes;
+			u64 blk_start, blk_end;
+			char *data;
 
-			if (length <= file_off) /* Read the whole extent */
-				break;
-			bytes = min(sb->s_blocksize,
-				    (unsigned long)(length - file_off));
+			if (end <= file_off) { /* We have all we wanted */
+				ret = 0;
+				goto done;
+			}
+			if (j == ra_next) {
+				u64 ra_count;
+
+				ra_count = DIV_ROUND_UP(end - file_off,
+							sb->s_blocksize);
+				ra_count = min3(ra_count, block_count - j, ra_max);
+				apfs_xattr_readahead(sb, ext.phys_block_num + j,
+						     ra_count);
+				ra_next = j + ra_count;
+			}
+			blk_start = max(file_off, off);
+			blk_end = min(file_off + sb->s_blocksize, end);
 
 			bh = sb_bread(sb, ext.phys_block_num + j);
 			if (!bh) {
 				ret = -EIO;
 				goto done;
 			}
-			memcpy(buffer + file_off, bh->b_data, bytes);
+			data = bh->b_data;
+			if (bounce) {
+				u64 tweak = ext.crypto_id + (file_off -
+					    ext.logical_addr) /
+					    APFS_CRYPT_UNIT_SIZE;
+
+				err = apfs_crypt_block(sb, bounce, bh->b_page,
+						       bh_offset(bh), tweak);
+				if (err) {
+					brelse(bh);
+					ret = err;
+					goto done;
+				}
+				data = page_address(bounce);
+			}
+			memcpy(buffer + blk_start - off,
+			       data + blk_start - file_off,
+			       blk_end - blk_start);
 			brelse(bh);
-			file_off = file_off + bytes;
+			file_off += sb->s_blocksize;
 		}
 	}
 
 done:
-	apfs_free_query(sb, query);
+	apfs_free_query(sb, &query);
+	if (bounce)
+		__free_page(bounce);
 	return ret;
 }
 
+/**
+ * apfs_xattr_extents_read - Read the value of a xattr from its extents
+ * @parent:	inode the attribute belongs to
+ * @xattr:	the xattr structure
+ * @buffer:	where to copy the attribute value
+ * @size:	size of @buffer
+ *
+ * Copies the value of @xattr to @buffer, if provided. If @buffer is NULL, just
+ * computes the size of the buffer required.
+ *
+ * Returns the number of bytes used/required, or a negative error code in case
+ * of failure.
+ */
+static int apfs_xattr_extents_read(struct inode *parent,
+				   struct apfs_xattr *xattr,
+				   void *buffer, size_t size)
+{
+	struct apfs_xattr_dstream *xdata;
+	int length;
+	int ret;
+
+	xdata = (struct apfs_xattr_dstream *) xattr->xdata;
+	length = le64_to_cpu(xdata->dstream.size);
+	if (length < 0 || length < le64_to_cpu(xdata->dstream.size))
+		return -E2BIG;
+
+	if (!buffer) /* All we want is the length */
+		return length;
+	if (length > size) /* xattr won't fit in the buffer */
+		return -ERANGE;
+
+	ret = apfs_xattr_extents_copy(parent, xattr, buffer, 0, length);
+	return ret ?: length;
+}
+
 /**
  * apfs_xattr_inline_read - Read the value of an inline xattr
  * @parent:	inode the attribute belongs to
@@ -196,6 +411,148 @@ static int apfs_xattr_inline_read(struct inode *parent,
 	return length;
 }
 
+/**
+ * apfs_xattr_find - Find the record for a named attribute
+ * @inode:	inode the attribute belongs to
+ * @name:	name of the attribute
+ * @query:	query to run, must be freed by the caller even on failure
+ * @xattr:	on return, the xattr record found
+ *
+ * The caller must not free @query while @xattr is in use.  Returns 0 on
+ * success, or a negative error code in case of failure.
+ */
+static int apfs_xattr_find(struct inode *inode, const char *name,
+			   struct apfs_query *query, struct apfs_xattr *xattr)
+{
+	struct super_block *sb = inode->i_sb;
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_key *key = query->key;
+	u64 cnid = inode->i_ino;
+	int ret;
+
+	apfs_init_xattr_key(cnid, name, key);
+
+	apfs_init_query(query, sbi->s_cat_root);
+	query->key = key;
+	query->flags |= APFS_QUERY_CAT | APFS_QUERY_EXACT;
+
+	/* Inode lookup may have seen all the records of the inode already */
+	if (APFS_I(inode)->i_no_xattrs)
+		return -ENODATA;
+
+	ret = apfs_btree_query(sb, query);
+	if (ret)
+		return ret;
+
+	ret = apfs_xattr_from_query(query, xattr);
+	if (ret)
+		apfs_alert(sb, "bad xattr record in inode 0x%llx", cnid);
+	return ret;
+}
+
+/**
+ * apfs_xattr_size - Get the size of the value of a xattr
+ * @xattr:	the xattr structure
+ */
+static u64 apfs_xattr_size(struct apfs_xattr *xattr)
+{
+	struct apfs_xattr_dstream *xdata;
+
+	if (!xattr->has_dstream)
+		return xattr->xdata_len;
+	xdata = (struct apfs_xattr_dstream *) xattr->xdata;
+	return le64_to_cpu(xdata->dstream.size);
+}
+
+/**
+ * apfs_xattr_cache_find - Find the cached value of a xattr
+ * @inode:	inode the attribute belongs to
+ * @name:	name of the attribute
+ *
+ * Returns the cached value, or NULL if there is none.
+ */
+static struct apfs_xattr_cached *apfs_xattr_cache_find(struct inode *inode,
+							const char *name)
+{
+	struct apfs_xattr_cached *cached;
+
+	cached = smp_load_acquire(&APFS_I(inode)->i_xattr_cache);
+	for (; cached; cached = cached->next) {
+		if (!strcmp(cached->name, name))
+			return cached;
+	}
+	return NULL;
+}
+
+/**
+ * apfs_xattr_cache_add - Keep a small inline xattr value in memory
+ * @inode:	inode the attribute belongs to
+ * @name:	name of the attribute, as given by the caller
+ * @xattr:	the xattr record, with an inline value
+ *
+ * Finder and the indexers keep asking for the same few small attributes, so
+ * the first read of each is remembered, up to APFS_XATTR_CACHE_MAX of them.
+ * The name is the one that was searched for, so other spellings that match
+ * the same record just get their own entries.  This is only an optimization,
+ * so failures are ignored.
+ */
+static void apfs_xattr_cache_add(struct inode *inode, const char *name,
+				 struct apfs_xattr *xattr)
+{
+	struct apfs_inode_info *ai = APFS_I(inode);
+	struct apfs_xattr_cached *cached, *head;
+	size_t name_len = strlen(name);
+
+	if (xattr->has_dstream || xattr->xdata_len > APFS_XATTR_CACHE_SIZE)
+		return;
+	head = smp_load_acquire(&ai->i_xattr_cache);
+	if (head && head->depth >= APFS_XATTR_CACHE_MAX)
+		return;
+
+	cached = kmalloc(sizeof(*cached) + xattr->xdata_len + name_len + 1,
+			 GFP_KERNEL | __GFP_NOWARN);
+	if (!cached)
+		return;
+	cached->len = xattr->xdata_len;
+	memcpy(cached->data, xattr->xdata, cached->len);
+	cached->name = cached->data + cached->len;
+	memcpy(cached->data + cached->len, name, name_len + 1);
+
+	while (1) {
+		struct apfs_xattr_cached *old;
+
+		cached->next = head;
+		cached->depth = head ? head->depth + 1 : 1;
+		old = cmpxchg(&ai->i_xattr_cache, head, cached);
+		if (old == head)
+			return;
+		/* Someone else added a value, maybe this same one */
+		head = old;
+		if (head->depth >= APFS_XATTR_CACHE_MAX ||
+		    apfs_xattr_cache_find(inode, name))
+			break;
+	}
+	kfree(cached);
+}
+
+/**
+ * apfs_xattr_cache_free - Release the cached xattr values of an inode
+ * @inode:	the inode, which is being destroyed
+ */
+void apfs_xattr_cache_free(struct inode *inode)
+{
+	struct apfs_inode_info *ai = APFS_I(inode);
+	struct apfs_xattr_cached *cached = ai->i_xattr_cache;
+
+	while (cached) {
+		struct apfs_xattr_cached *next = cached->next;
+
+		kfree(cached);
+		cached = next;
+	}
+	ai->i_xattr_cache = NULL;
+}
+
 /**
  * apfs_xattr_get - Find and read a named attribute
  * @inode:	inode the attribute belongs to
@@ -212,42 +569,286 @@ static int apfs_xattr_inline_read(struct inode *parent,
 int apfs_xattr_get(struct inode *inode, const char *name, void *buffer,
 		   size_t size)
 {
-	struct super_block *sb = inode->i_sb;
-	struct apfs_sb_info *sbi = APFS_SB(sb);
 	struct apfs_key key;
-	struct apfs_query *query;
+	struct apfs_query query;
 	struct apfs_xattr xattr;
-	u64 cnid = inode->i_ino;
+	struct apfs_xattr_cached *cached;
 	int ret;
 
-	apfs_init_xattr_key(cnid, name, &key);
+	cached = apfs_xattr_cache_find(inode, name);
+	if (cached) {
+		if (!buffer) /* All we want is the length */
+			return cached->len;
+		if (cached->len > size) /* xattr won't fit in the buffer */
+			return -ERANGE;
+		memcpy(buffer, cached->data, cached->len);
+		return cached->len;
+	}
 
-	query = apfs_alloc_query(sbi->s_cat_root, NULL /* parent */);
-	if (!query)
-		return -ENOMEM;
-	query->key = &key;
-	query->flags |= APFS_QUERY_CAT | APFS_QUERY_EXACT;
+	query.key = &key;
+	ret = apfs_xattr_find(inode, name, &query, &xattr);
+	if (ret)
+		goto done;
 
-	ret = apfs_btree_query(sb, &query);
+	if (xattr.has_dstream) {
+		ret = apfs_xattr_extents_read(inode, &xattr, buffer, size);
+	} else {
+		ret = apfs_xattr_inline_read(inode, &xattr, buffer, size);
+		apfs_xattr_cache_add(inode, name, &xattr);
+	}
+
+done:
+	apfs_free_query(inode->i_sb, &query);
+	return ret;
+}
+
+/**
+ * apfs_xattr_get_alloc - Find a named attribute and read it into a new buffer
+ * @inode:	inode the attribute belongs to
+ * @name:	name of the attribute
+ * @max_size:	largest value that the caller will accept
+ * @value:	on return, a kmalloc'd copy of the value, to be freed by the caller
+ *
+ * Unlike a pair of calls to apfs_xattr_get(), one for the size and one for the
+ * value, this only searches the catalog once.  Returns the length of the
+ * value, -E2BIG if it's longer than @max_size, or another negative error code
+ * in case of failure.
+ */
+int apfs_xattr_get_alloc(struct inode *inode, const char *name,
+			 size_t max_size, void **value)
+{
+	struct apfs_key key;
+	struct apfs_query query;
+	struct apfs_xattr xattr;
+	void *buffer = NULL;
+	u64 size;
+	int ret;
+
+	query.key = &key;
+	ret = apfs_xattr_find(inode, name, &query, &xattr);
 	if (ret)
 		goto done;
 
-	ret = apfs_xattr_from_query(query, &xattr);
-	if (ret) {
-		apfs_alert(sb, "bad xattr record in inode 0x%llx", cnid);
+	size = apfs_xattr_size(&xattr);
+	if (size > max_size || size > INT_MAX) {
+		ret = -E2BIG;
+		goto done;
+	}
+	buffer = kmalloc(size, GFP_KERNEL);
+	if (!buffer) {
+		ret = -ENOMEM;
+		goto done;
+	}
+
+	if (xattr.has_dstream) {
+		ret = apfs_xattr_extents_copy(inode, &xattr, buffer, 0, size);
+		if (ret)
+			goto done;
+	} else {
+		memcpy(buffer, xattr.xdata, size);
+	}
+	*value = buffer;
+	buffer = NULL;
+	ret = size;
+
+done:
+	kfree(buffer);
+	apfs_free_query(inode->i_sb, &query);
+	return ret;
+}
+
+/**
+ * apfs_xattr_get_view - Find a named attribute and map its inline value
+ * @inode:	inode the attribute belongs to
+ * @name:	name of the attribute
+ * @view:	on return, the location of the value in its catalog node
+ *
+ * This spares a copy to callers that only need to parse the value.  The node
+ * stays referenced until apfs_xattr_put_view() is called.  Returns the length
+ * of the value, -E2BIG if it is stored in a dstream instead, or another
+ * negative error code in case of failure.
+ */
+int apfs_xattr_get_view(struct inode *inode, const char *name,
+			struct apfs_xattr_view *view)
+{
+	struct apfs_key key;
+	struct apfs_query query;
+	struct apfs_xattr xattr;
+	int ret;
+
+	query.key = &key;
+	ret = apfs_xattr_find(inode, name, &query, &xattr);
+	if (ret)
+		goto done;
+	if (xattr.has_dstream) {
+		ret = -E2BIG;
+		goto done;
+	}
+
+	apfs_node_get(query.node);
+	view->node = query.node;
+	view->data = xattr.xdata;
+	view->len = xattr.xdata_len;
+	ret = view->len;
+
+done:
+	apfs_free_query(inode->i_sb, &query);
+	return ret;
+}
+
+/**
+ * apfs_xattr_put_view - Release the node mapped by apfs_xattr_get_view()
+ * @view:	the view, which must not be used any more
+ */
+void apfs_xattr_put_view(struct apfs_xattr_view *view)
+{
+	apfs_node_put(view->node);
+	view->node = NULL;
+}
+
+/**
+ * apfs_xattr_read_at - Read part of the value of a named attribute
+ * @inode:	inode the attribute belongs to
+ * @name:	name of the attribute
+ * @buffer:	where to copy the data
+ * @len:	number of bytes to read
+ * @off:	offset of the data in the attribute value
+ *
+ * Unlike apfs_xattr_get(), this doesn't need a buffer for the whole value,
+ * so it can be used with the large attributes that hold resource forks.
+ * Returns 0 on success, -ERANGE if the range goes beyond the end of the
+ * value, or another negative error code in case of failure.
+ */
+int apfs_xattr_read_at(struct inode *inode, const char *name, void *buffer,
+		       size_t len, u64 off)
+{
+	struct apfs_key key;
+	struct apfs_query query;
+	struct apfs_xattr xattr;
+	u64 size;
+	int ret;
+
+	query.key = &key;
+	ret = apfs_xattr_find(inode, name, &query, &xattr);
+	if (ret)
+		goto done;
+
+	size = apfs_xattr_size(&xattr);
+	if (off > size || len > size - off) {
+		ret = -ERANGE;
 		goto done;
 	}
 
 	if (xattr.has_dstream)
-		ret = apfs_xattr_extents_read(inode, &xattr, buffer, size);
+		ret = apfs_xattr_extents_copy(inode, &xattr, buffer, off, len);
 	else
-		ret = apfs_xattr_inline_read(inode, &xattr, buffer, size);
+		memcpy(buffer, xattr.xdata + off, len);
 
 done:
-	apfs_free_query(sb, query);
+	apfs_free_query(inode->i_sb, &query);
 	return ret;
 }
 
+/**
+ * apfs_xattr_open_stream - Get the page cache of a xattr for repeated reads
+ * @inode:	inode the attribute belongs to
+ * @name:	name of the attribute
+ * @size:	on return, the length of the value
+ * @alloced:	on return, the bytes allocated for the dstream, or 0
+ *
+ * Callers that read many parts of the same large attribute, like the chunks
+ * of a resource fork, can then skip the catalog search for its record each
+ * time.  Returns the page cache inode, which lives as long as @inode, or NULL
+ * if the attribute isn't in a dstream or its stream can't be cached; the
+ * caller should then use apfs_xattr_read_at().
+ */
+struct inode *apfs_xattr_open_stream(struct inode *inode, const char *name,
+				     u64 *size, u64 *alloced)
+{
+	struct apfs_key key;
+	struct apfs_query query;
+	struct apfs_xattr xattr;
+	struct inode *stream = NULL;
+
+	*alloced = 0;
+	query.key = &key;
+	if (!apfs_xattr_find(inode, name, &query, &xattr) &&
+	    xattr.has_dstream) {
+		struct apfs_xattr_dstream *xdata;
+
+		xdata = (struct apfs_xattr_dstream *)xattr.xdata;
+		*alloced = le64_to_cpu(xdata->dstream.alloced_size);
+		stream = apfs_xattr_stream(inode, &xattr);
+		*size = apfs_xattr_size(&xattr);
+	}
+	apfs_free_query(inode->i_sb, &query);
+	return stream;
+}
+
+/**
+ * apfs_xattr_stream_read - Read part of a xattr from its page cache
+ * @stream:	page cache inode from apfs_xattr_open_stream()
+ * @size:	length of the value
+ * @buffer:	where to copy the data
+ * @len:	number of bytes to read
+ * @off:	offset of the data in the attribute value
+ *
+ * Returns 0 on success, -ERANGE if the range goes beyond the end of the
+ * value, or another negative error code in case of failure.
+ */
+int apfs_xattr_stream_read(struct inode *stream, u64 size, void *buffer,
+			   size_t len, u64 off)
+{
+	if (off > size || len > size - off)
+		return -ERANGE;
+	apfs_stat_inc(stream->i_sb, APFS_STAT_XATTR_READS);
+	apfs_stat_add(stream->i_sb, APFS_STAT_XATTR_BYTES, len);
+	return apfs_xattr_stream_copy(stream, buffer, off, len);
+}
+
+/**
+ * apfs_xattr_prime_link - Cache the target of a symlink found during lookup
+ * @inode:	the symlink, being read from disk
+ * @query:	query set on one of the xattr records of @inode
+ *
+ * Saves apfs_get_link() a catalog search.  Bad targets are ignored here, and
+ * reported when the link gets followed.
+ */
+void apfs_xattr_prime_link(struct inode *inode, struct apfs_query *query)
+{
+	struct apfs_xattr xattr;
+
+	if (apfs_xattr_from_query(query, &xattr))
+		return;
+	if (xattr.has_dstream || strcmp(xattr.name, APFS_XATTR_NAME_SYMLINK))
+		return;
+	if (!xattr.xdata_len || xattr.xdata_len > PATH_MAX)
+		return;
+	if (xattr.xdata[xattr.xdata_len - 1] != 0)
+		return;
+	/* Freed along with the inode, like the ones set by apfs_get_link() */
+	inode->i_link = kmemdup(xattr.xdata, xattr.xdata_len, GFP_KERNEL);
+}
+
+/**
+ * apfs_xattr_prime_firmlink - Check a xattr of a directory found during lookup
+ * @inode:	the directory, being read from disk
+ * @query:	query set on one of the xattr records of @inode
+ *
+ * Saves apfs_firmlink_setup() a catalog search.
+ */
+void apfs_xattr_prime_firmlink(struct inode *inode, struct apfs_query *query)
+{
+	struct apfs_xattr xattr;
+
+	if (!(APFS_SB(inode->i_sb)->s_flags & APFS_VGROUP))
+		return;
+	if (apfs_xattr_from_query(query, &xattr))
+		return;
+	if (!strcmp(xattr.name, APFS_XATTR_NAME_FIRMLINK))
+		APFS_I(inode)->i_firmlink = APFS_FIRMLINK_YES;
+}
+
 static int apfs_xattr_osx_get(const struct xattr_handler *handler,
 				struct dentry *unused, struct inode *inode,
 				const char *name, void *buffer, size_t size)
@@ -267,30 +868,39 @@ const struct xattr_handler *apfs_xattr_handlers[] = {
 	NULL
 };
 
-ssize_t apfs_listxattr(struct dentry *dentry, char *buffer, size_t size)
+/**
+ * apfs_xattr_list_scan - List the names of all the xattrs of an inode
+ * @inode:	the inode
+ * @buffer:	where to copy the names, with the fake 'osx' prefix
+ * @size:	size of @buffer
+ *
+ * If @buffer is NULL, just computes the size of the buffer required.  Returns
+ * the number of bytes used/required, or a negative error code in case of
+ * failure.
+ */
+static ssize_t apfs_xattr_list_scan(struct inode *inode, char *buffer,
+				    size_t size)
 {
-	struct inode *inode = d_inode(dentry);
 	struct super_block *sb = inode->i_sb;
 	struct apfs_sb_info *sbi = APFS_SB(sb);
 	struct apfs_key key;
-	struct apfs_query *query;
+	struct apfs_query query;
 	u64 cnid = inode->i_ino;
 	size_t free = size;
 	ssize_t ret;
 
-	query = apfs_alloc_query(sbi->s_cat_root, NULL /* parent */);
-	if (!query)
-		return -ENOMEM;
+	if (APFS_I(inode)->i_no_xattrs)
+		return 0;
 
 	/* We want all the xattrs for the cnid, regardless of the name */
 	apfs_init_xattr_key(cnid, NULL /* name */, &key);
-	query->key = &key;
-	query->flags = APFS_QUERY_CAT | APFS_QUERY_MULTIPLE | APFS_QUERY_EXACT;
+	apfs_btree_iter_init(&query, sbi->s_cat_root, &key,
+			     APFS_QUERY_CAT | APFS_QUERY_MULTIPLE);
 
-	while (1) {
+	ret = apfs_btree_iter_seek(sb, &query);
+	for (;; ret = apfs_btree_iter_next(sb, &query)) {
 		struct apfs_xattr xattr;
 
-		ret = apfs_btree_query(sb, &query);
 		if (ret == -ENODATA) { /* Got all the xattrs */
 			ret = size - free;
 			break;
@@ -298,7 +908,7 @@ ssize_t apfs_listxattr(struct dentry *dentry, char *buffer, size_t size)
 		if (ret)
 			break;
 
-		ret = apfs_xattr_from_query(query, &xattr);
+		ret = apfs_xattr_from_query(&query, &xattr);
 		if (ret) {
 			apfs_alert(sb, "bad xattr key in inode %llx", cnid);
 			break;
@@ -320,6 +930,183 @@ ssize_t apfs_listxattr(struct dentry *dentry, char *buffer, size_t size)
 		free -= xattr.name_len + XATTR_MAC_OSX_PREFIX_LEN + 1;
 	}
 
-	apfs_free_query(sb, query);
+	apfs_free_query(sb, &query);
 	return ret;
 }
+
+/**
+ * apfs_xattr_names_get - Get the cached list of xattr names of an inode
+ * @inode:	the inode
+ *
+ * The list is built on the first call and kept until the inode goes away,
+ * since it never changes on a read-only mount.  Returns the list, -E2BIG if
+ * it's too long to be worth caching, or another error pointer in case of
+ * failure.
+ */
+static struct apfs_xattr_names *apfs_xattr_names_get(struct inode *inode)
+{
+	struct apfs_inode_info *ai = APFS_I(inode);
+	struct apfs_xattr_names *names, *old;
+	ssize_t len;
+
+	names = READ_ONCE(ai->i_xattr_names);
+	if (names)
+		return names;
+
+	len = apfs_xattr_list_scan(inode, NULL, 0);
+	if (len < 0)
+		return ERR_PTR(len);
+	if (len > XATTR_LIST_MAX)
+		return ERR_PTR(-E2BIG);
+	names = kmalloc(sizeof(*names) + len, GFP_KERNEL);
+	if (!names)
+		return ERR_PTR(-ENOMEM);
+	len = apfs_xattr_list_scan(inode, names->names, len);
+	if (len < 0) {
+		kfree(names);
+		return ERR_PTR(len);
+	}
+	names->len = len;
+
+	old = cmpxchg(&ai->i_xattr_names, NULL, names);
+	if (old) { /* Another reader got here first */
+		kfree(names);
+		return old;
+	}
+	return names;
+}
+
+/**
+ * apfs_xattr_names_free - Release the cached xattr names of an inode
+ * @inode:	the inode, which is being destroyed
+ */
+void apfs_xattr_names_free(struct inode *inode)
+{
+	struct apfs_inode_info *ai = APFS_I(inode);
+
+	kfree(ai->i_xattr_names);
+	ai->i_xattr_names = NULL;
+}
+
+ssize_t apfs_listxattr(struct dentry *dentry, char *buffer, size_t size)
+{
+	struct inode *inode = d_inode(dentry);
+	struct apfs_xattr_names *names;
+
+	names = apfs_xattr_names_get(inode);
+	if (IS_ERR(names)) {
+		if (PTR_ERR(names) == -E2BIG)
+			return apfs_xattr_list_scan(inode, buffer, size);
+		return PTR_ERR(names);
+	}
+
+	if (!buffer) /* All we want is the length */
+		return names->len;
+	if (names->len > size)
+		return -ERANGE;
+	memcpy(buffer, names->names, names->len);
+	return names->len;
+}
+
+/* Size of the record for a xattr without its value, for the name length */
+#define APFS_XATTR_ENTRY_HDR_LEN(name_len)				\
+	(sizeof(struct apfs_xattr_entry) + XATTR_MAC_OSX_PREFIX_LEN +	\
+	 (name_len) + 1)
+
+/**
+ * apfs_xattr_get_all - Read all the xattrs of an inode, names and values
+ * @inode:	the inode
+ * @req:	the APFS_IOC_GET_XATTRS request, already checked by the caller
+ * @buf:	kernel buffer of @req->xr_size bytes for the records
+ *
+ * All the records come from a single scan of the catalog, instead of the
+ * search that each getxattr() call would need, plus one more for its size.
+ * Sets @req->xr_size, @req->xr_count and @req->xr_pos for the reply.  Returns
+ * 0 on success, or a negative error code in case of failure.
+ */
+int apfs_xattr_get_all(struct inode *inode, struct apfs_xattrs_req *req,
+		       char *buf)
+{
+	struct super_block *sb = inode->i_sb;
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_key key;
+	struct apfs_query query;
+	u64 cnid = inode->i_ino;
+	u32 size = req->xr_size, used = 0, count = 0, pos = 0;
+	int err;
+
+	req->xr_size = 0;
+	req->xr_count = 0;
+	if (APFS_I(inode)->i_no_xattrs)
+		return 0;
+
+	apfs_init_xattr_key(cnid, NULL /* name */, &key);
+	apfs_btree_iter_init(&query, sbi->s_cat_root, &key,
+			     APFS_QUERY_CAT | APFS_QUERY_MULTIPLE);
+
+	err = apfs_btree_iter_seek(sb, &query);
+	for (; !err; err = apfs_btree_iter_next(sb, &query), pos++) {
+		struct apfs_xattr_entry *entry;
+		struct apfs_xattr xattr;
+		char *value;
+		u64 hdr_len, value_len, reclen;
+
+		if (pos < req->xr_pos)
+			continue;
+
+		err = apfs_xattr_from_query(&query, &xattr);
+		if (err) {
+			apfs_alert(sb, "bad xattr key in inode %llx", cnid);
+			break;
+		}
+
+		/* The value length comes from disk, so it may be anything */
+		hdr_len = APFS_XATTR_ENTRY_HDR_LEN(xattr.name_len);
+		value_len = apfs_xattr_size(&xattr);
+		if (value_len > APFS_XATTRS_MAX ||
+		    check_add_overflow(hdr_len, value_len, &reclen))
+			reclen = U32_MAX;
+		else
+			reclen = ALIGN(reclen, sizeof(u64));
+		if (reclen > size - used) {
+			if (!count) {
+				err = -ERANGE;
+				req->xr_size = min_t(u64, reclen, U32_MAX);
+			}
+			break;
+		}
+
+		entry = (struct apfs_xattr_entry *)(buf + used);
+		memset(entry, 0, sizeof(*entry));
+		entry->xe_reclen = reclen;
+		entry->xe_value_len = value_len;
+		entry->xe_name_len = XATTR_MAC_OSX_PREFIX_LEN + xattr.name_len;
+		memcpy(entry->xe_name, XATTR_MAC_OSX_PREFIX,
+		       XATTR_MAC_OSX_PREFIX_LEN);
+		memcpy(entry->xe_name + XATTR_MAC_OSX_PREFIX_LEN, xattr.name,
+		       xattr.name_len + 1);
+		value = entry->xe_name + entry->xe_name_len + 1;
+		if (xattr.has_dstream) {
+			err = apfs_xattr_extents_copy(inode, &xattr, value,
+						      0 /* off */, value_len);
+			if (err)
+				break;
+		} else {
+			memcpy(value, xattr.xdata, value_len);
+		}
+		/* Don't leak the old content of the buffer in the padding */
+		memset(value + value_len, 0,
+		       reclen - (value + value_len - (char *)entry));
+
+		used += reclen;
+		count++;
+	}
+	apfs_free_query(sb, &query);
+	if (err && err != -ENODATA)
+		return err;
+
+	req->xr_size = used;
+	req->xr_count = count;
+	req->xr_pos += count;
+	return 0;
+}
@@ -8,15 +8,29 @@
 #ifndef _APFS_XATTR_H
 #define _APFS_XATTR_H
 
+#include <linux/sizes.h>
 #include <linux/types.h>
 #include "inode.h"
 
+struct apfs_node;
+struct apfs_query;
+struct apfs_xattrs_req;
+
 /* Extended attributes constants */
 #define APFS_XATTR_MAX_EMBEDDED_SIZE	3804
 
+/* Most bytes of a xattr value to request from the device at once */
+#define APFS_XATTR_RA_SIZE		SZ_1M
+
+/* Largest inline xattr value kept in memory once read, and most per inode */
+#define APFS_XATTR_CACHE_SIZE		256
+#define APFS_XATTR_CACHE_MAX		4
+
 /* Extended attributes names */
 #define APFS_XATTR_NAME_SYMLINK		"com.apple.fs.symlink"
 #define APFS_XATTR_NAME_COMPRESSED	"com.apple.decmpfs"
+#define APFS_XATTR_NAME_RSRC_FORK	"com.apple.ResourceFork"
+#define APFS_XATTR_NAME_FIRMLINK	"com.apple.fs.firmlink"
 
 /* Extended attributes flags */
 enum {
@@ -54,9 +68,59 @@ struct apfs_xattr {
 	bool has_dstream;
 };
 
+/*
+ * Value of an inline xattr, mapped in place inside its catalog node
+ */
+struct apfs_xattr_view {
+	struct apfs_node *node;		/* Node holding the value */
+	const u8 *data;			/* Start of the value */
+	int len;			/* Length of the value */
+};
+
+/*
+ * Small inline xattr value, kept in memory after the first read.  The values
+ * of an inode are in a list, and they never change on a read-only mount.
+ */
+struct apfs_xattr_cached {
+	struct apfs_xattr_cached *next;	/* Value cached before this one */
+	unsigned int depth;		/* Length of the list from this one on */
+	int len;			/* Length of the value */
+	const char *name;		/* Name, right after the value */
+	u8 data[];
+};
+
+/*
+ * List of the names of all the xattrs of an inode, as returned by listxattr
+ */
+struct apfs_xattr_names {
+	size_t len;			/* Length of @names */
+	char names[];			/* Null-terminated, prefixed names */
+};
+
 extern int apfs_xattr_get(struct inode *inode, const char *name, void *buffer,
 			  size_t size);
+extern int apfs_xattr_get_alloc(struct inode *inode, const char *name,
+				size_t max_size, void **value);
+extern int apfs_xattr_get_view(struct inode *inode, const char *name,
+			       struct apfs_xattr_view *view);
+extern void apfs_xattr_put_view(struct apfs_xattr_view *view);
+extern int apfs_xattr_read_at(struct inode *inode, const char *name,
+			      void *buffer, size_t len, u64 off);
+extern struct inode *apfs_xattr_open_stream(struct inode *inode,
+					    const char *name, u64 *size,
+					    u64 *alloced);
+extern int apfs_xattr_stream_read(struct inode *stream, u64 size,
+				  void *buffer, size_t len, u64 off);
+extern void apfs_xattr_prime_link(struct inode *inode,
+				  struct apfs_query *query);
+extern void apfs_xattr_prime_firmlink(struct inode *inode,
+				      struct apfs_query *query);
+extern void apfs_xattr_stream_free(struct inode *inode);
+extern void apfs_xattr_names_free(struct inode *inode);
+extern void apfs_xattr_cache_free(struct inode *inode);
 extern ssize_t apfs_listxattr(struct dentry *dentry, char *buffer, size_t size);
+extern int apfs_xattr_get_all(struct inode *inode,
+			      struct apfs_xattrs_req *req, char *buf);
 
 extern const struct xattr_handler *apfs_xattr_handlers[];
 
@@ -0,0 +1,364 @@
+/* SPDX-License-Identifier: GPL-2.0 WITH Linux-syscall-note */
+/*
+ * The ioctls of the apfs filesystem
+ *
+ * Copyright (C) 2018 Ernesto A. Fernández <ernesto.mnd.fernandez@gmail.com>
+ *
+ * All the structures have the same layout on 32-bit and 64-bit
+ * architectures: the 64-bit fields are naturally aligned, and the padding is
+ * explicit.  Fields marked "must be zero" are checked by the kernel, so that
+ * they can be given a meaning later; padding in the records returned is
+ * always set to zero.
+ */
+
+#ifndef _UAPI_LINUX_APFS_H
+#define _UAPI_LINUX_APFS_H
+
+#include <linux/ioctl.h>
+#include <linux/types.h>
+
+/*
+ * Attributes of an inode, as reported by APFS_IOC_BULKSTAT.  The size is the
+ * one in the inode record, so it's zero for files with compressed content.
+ */
+struct apfs_bulkstat {
+	__u64 bs_ino;		/* Inode number */
+	__u64 bs_parent_id;	/* Inode number of the parent directory */
+	__u64 bs_size;		/* Size of the data stream, in bytes */
+	__u64 bs_blocks;	/* Space allocated, in 512-byte units */
+	__u64 bs_atime;		/* Times, in nanoseconds since the epoch */
+	__u64 bs_mtime;
+	__u64 bs_ctime;
+	__u64 bs_crtime;
+	__u32 bs_mode;
+	__u32 bs_nlink;		/* Link count, or children of a directory */
+	__u32 bs_uid;
+	__u32 bs_gid;
+	__u32 bs_bsd_flags;
+	__u32 bs_pad;
+};
+
+/*
+ * Request for APFS_IOC_BULKSTAT
+ */
+struct apfs_bulkstat_req {
+	__u64 br_ino;		/* First inode to report, then next to ask */
+	__u64 br_buffer;	/* User address of the apfs_bulkstat array */
+	__u32 br_count;		/* Size of the array, then entries filled */
+	__u32 br_flags;		/* Must be zero */
+};
+
+/* Most inodes reported by a single APFS_IOC_BULKSTAT call */
+#define APFS_BULKSTAT_MAX	4096
+
+/*
+ * Directory entry with the attributes of its inode, as reported by
+ * APFS_IOC_READDIR_PLUS.  The attributes are the same as for bulkstat, and
+ * they are left as zero if the inode record can't be found.
+ */
+struct apfs_dirent_plus {
+	__u64 dp_ino;		/* Inode number */
+	__u64 dp_size;		/* Size of the data stream, in bytes */
+	__u64 dp_mtime;		/* Times, in nanoseconds since the epoch */
+	__u64 dp_crtime;
+	__u32 dp_mode;
+	__u32 dp_bsd_flags;
+	__u16 dp_reclen;	/* Length of the record, a multiple of 8 */
+	__u16 dp_namelen;	/* Length of the name, not counting the null */
+	__u8 dp_type;		/* File type, as reported by readdir */
+	__u8 dp_pad[3];
+	char dp_name[];		/* Null-terminated name */
+};
+
+/*
+ * Request for APFS_IOC_READDIR_PLUS, on a directory.  The scan starts at the
+ * file position and leaves it after the last entry reported, just like
+ * getdents(), so both calls can be mixed.  The dot entries are skipped.  As
+ * for a stat() of each entry, search permission on the directory is needed.
+ */
+struct apfs_readdir_plus_req {
+	__u64 rp_buffer;	/* User address of the records */
+	__u32 rp_size;		/* Size of the buffer, then bytes filled */
+	__u32 rp_count;		/* On return, records filled; 0 at the end */
+	__u32 rp_flags;		/* Must be zero */
+	__u32 rp_pad;
+};
+
+/* Most bytes of records reported by a single APFS_IOC_READDIR_PLUS call */
+#define APFS_READDIR_PLUS_MAX	(1 << 20)
+
+/* Room for the name of a hard link, including the null termination */
+#define APFS_LINK_NAME_SIZE	1024
+
+/*
+ * Hard link of an inode, as reported by APFS_IOC_GET_LINKS
+ */
+struct apfs_link {
+	__u64 al_parent_id;	/* Inode number of the directory */
+	__u64 al_sibling_id;	/* Inode number reported by readdir */
+	char al_name[APFS_LINK_NAME_SIZE];
+};
+
+/*
+ * Request for APFS_IOC_GET_LINKS.  Inodes without hard links have none.
+ */
+struct apfs_links_req {
+	__u64 lr_buffer;	/* User address of the apfs_link array */
+	__u32 lr_count;		/* Size of the array, then entries filled */
+	__u32 lr_total;		/* On return, number of links of the inode */
+};
+
+/* Kinds of change reported by APFS_IOC_SNAP_DIFF */
+#define APFS_DIFF_ADDED		1	/* Only found in the target */
+#define APFS_DIFF_REMOVED	2	/* Only found in the base */
+#define APFS_DIFF_MODIFIED	3	/* Found in both, with another value */
+
+/*
+ * Catalog record that changed between two transactions, as reported by
+ * APFS_IOC_SNAP_DIFF.  The offset and length are only set for file extents.
+ */
+struct apfs_diff_entry {
+	__u64 de_id;		/* Inode number, or extent id of an extent */
+	__u64 de_offset;	/* Logical address of the file extent */
+	__u64 de_length;	/* Length of the file extent, in bytes */
+	__u32 de_type;		/* Type of the catalog record */
+	__u32 de_change;	/* One of the APFS_DIFF_* values */
+};
+
+/*
+ * Request for APFS_IOC_SNAP_DIFF
+ */
+struct apfs_diff_req {
+	__u64 dr_base_xid;	/* Xid of the older snapshot */
+	__u64 dr_target_xid;	/* Later snapshot, or 0 for the mount */
+	__u64 dr_oid;		/* First node to report, then next to ask for */
+	__u64 dr_buffer;	/* User address of the apfs_diff_entry array */
+	__u32 dr_count;		/* Size of the array, then entries filled */
+	__u32 dr_skip;		/* Changes of dr_oid already reported */
+	__u32 dr_flags;		/* Must be zero */
+	__u32 dr_pad;
+};
+
+/* Most changes reported by a single APFS_IOC_SNAP_DIFF call */
+#define APFS_DIFF_MAX		4096
+
+/*
+ * File extent, as reported by APFS_IOC_PHYS_EXTENTS
+ */
+struct apfs_extent_entry {
+	__u64 ee_block;		/* First physical block */
+	__u64 ee_id;		/* Extent id, from the inode record */
+	__u64 ee_offset;	/* Logical address in the file, in bytes */
+	__u64 ee_length;	/* Length of the extent, in bytes */
+};
+
+/* Only report the files under the directory of the ioctl */
+#define APFS_EXTENTS_SUBTREE	0x00000001
+
+/*
+ * Request for APFS_IOC_PHYS_EXTENTS.  Extents are sorted by block, id and
+ * offset, and only the ones after the given position get reported.
+ */
+struct apfs_extents_req {
+	__u64 er_block;		/* Report after this, then last reported */
+	__u64 er_id;
+	__u64 er_offset;
+	__u64 er_buffer;	/* User address of the entry array */
+	__u32 er_count;		/* Size of the array, then entries filled */
+	__u32 er_flags;		/* APFS_EXTENTS_* flags */
+};
+
+/* Most extents reported by a single APFS_IOC_PHYS_EXTENTS call */
+#define APFS_EXTENTS_MAX	16384
+
+/*
+ * Statistics for the whole tree under a directory, as reported by
+ * APFS_IOC_DIR_STATS.  Only directories with a dir-stats record have them.
+ */
+struct apfs_dir_stats {
+	__u64 ds_children;	/* Files and directories in the tree */
+	__u64 ds_total_size;	/* Logical size of all its files, in bytes */
+	__u64 ds_chained_id;	/* Stats record of the parent, or 0 */
+	__u64 ds_gen_count;	/* Changes whenever the stats are updated */
+};
+
+/* Offset reported for blocks that no file extent of the owner maps */
+#define APFS_OWNER_NO_OFFSET	(~0ULL)
+
+/*
+ * Physical extent that overlaps the range of APFS_IOC_BLOCK_OWNERS, clipped
+ * to the range.  The owner is an extent id, the same as the inode number for
+ * files that were never cloned; other clones that share the blocks are only
+ * counted in the reference count.
+ */
+struct apfs_owner_entry {
+	__u64 oe_block;		/* First block in the range */
+	__u64 oe_count;		/* Number of blocks in the range */
+	__u64 oe_owner;		/* Extent id of the owner */
+	__u64 oe_offset;	/* Logical address of oe_block, in bytes */
+	__u32 oe_refcnt;	/* References to the physical extent */
+	__u32 oe_kind;		/* Kind of the physical extent record */
+};
+
+/*
+ * Request for APFS_IOC_BLOCK_OWNERS
+ */
+struct apfs_owners_req {
+	__u64 or_block;		/* First block, then next to ask for */
+	__u64 or_end;		/* Block after the end of the range */
+	__u64 or_buffer;	/* User address of the apfs_owner_entry array */
+	__u32 or_count;		/* Size of the array, then entries filled */
+	__u32 or_flags;		/* Must be zero */
+};
+
+/* Most entries reported by a single APFS_IOC_BLOCK_OWNERS call */
+#define APFS_OWNERS_MAX		4096
+
+/*
+ * Request for APFS_IOC_PREFETCH, on a directory.  The counters are updated in
+ * the user copy as the prefetch goes on, so it can be followed from another
+ * thread; they must be zero on the call.
+ */
+struct apfs_prefetch_req {
+	__u64 pf_dirs;		/* Directories scanned */
+	__u64 pf_inodes;	/* Inode records loaded */
+	__u64 pf_extents;	/* First file extent records loaded */
+	__u32 pf_batch;		/* Most records per walk, or 0 for default */
+	__u32 pf_flags;		/* Must be zero */
+};
+
+/* Records looked up by each walk of an APFS_IOC_PREFETCH, by default */
+#define APFS_PREFETCH_BATCH	256
+/* Most records looked up by a single walk */
+#define APFS_PREFETCH_MAX	4096
+
+/*
+ * Request for APFS_IOC_GET_WARMSET and APFS_IOC_LOAD_WARMSET.  The warm set is
+ * the list of blocks of the b-tree nodes in the cache of the mount, sorted by
+ * block number.  It is only valid for the same volume and checkpoint.
+ */
+struct apfs_warmset_req {
+	__u8 ws_nx_uuid[16];	/* Uuid of the container */
+	__u8 ws_vol_uuid[16];	/* Uuid of the volume */
+	__u64 ws_xid;		/* Checkpoint or snapshot of the mount */
+	__u64 ws_buffer;	/* User address of the block number array */
+	__u32 ws_count;		/* Size of the array, then entries filled */
+	__u32 ws_flags;		/* Must be zero */
+};
+
+/* Most blocks in a single warm set */
+#define APFS_WARMSET_MAX	(1 << 20)
+
+/*
+ * Extended attribute of an inode, as reported by APFS_IOC_GET_XATTRS.  The
+ * name has the same "osx." prefix as for listxattr(), and the value follows
+ * right after its null termination.
+ */
+struct apfs_xattr_entry {
+	__u32 xe_reclen;	/* Length of the record, a multiple of 8 */
+	__u32 xe_value_len;	/* Length of the value */
+	__u16 xe_name_len;	/* Length of the name, not counting the null */
+	__u16 xe_pad[3];
+	char xe_name[];		/* Null-terminated name, then the value */
+};
+
+/*
+ * Request for APFS_IOC_GET_XATTRS.  The xattrs are reported in the order of
+ * the catalog, and the call can be repeated with the returned position for
+ * the ones that didn't fit.  If even the first one doesn't fit, the call
+ * fails with ERANGE, and xr_size is set to the length of its record.
+ */
+struct apfs_xattrs_req {
+	__u64 xr_buffer;	/* User address of the records */
+	__u32 xr_size;		/* Size of the buffer, then bytes filled */
+	__u32 xr_count;		/* On return, records filled; 0 at the end */
+	__u32 xr_pos;		/* Xattrs to skip, then next to ask for */
+	__u32 xr_flags;		/* Must be zero */
+};
+
+/* Most bytes of records reported by a single APFS_IOC_GET_XATTRS call */
+#define APFS_XATTRS_MAX		(16 << 20)
+
+/*
+ * Fragmentation of a regular file, as reported by APFS_IOC_FRAG_REPORT.  Holes
+ * are not extents, and they don't count as discontinuities either: only two
+ * neighbouring extents whose blocks are not contiguous on disk do.
+ */
+struct apfs_frag_report {
+	__u64 fr_extents;	/* Number of extents, not counting holes */
+	__u64 fr_avg_len;	/* Average length of the extents, in bytes */
+	__u64 fr_max_len;	/* Length of the largest extent, in bytes */
+	__u64 fr_discont;	/* Physical discontinuities between extents */
+	__u64 fr_mapped;	/* Bytes mapped by all the extents */
+	__u64 fr_shared;	/* Bytes mapped by shared extents */
+	__u32 fr_shared_ratio;	/* Shared bytes per 10000 mapped bytes */
+	__u32 fr_flags;		/* Must be zero */
+};
+
+/*
+ * Request for APFS_IOC_INO_PATH.  The path is relative to the root of the
+ * volume and starts with a slash; for an inode with hard links, it's one of
+ * them.  If the buffer is too small, the call fails with ERANGE but still sets
+ * @ip_size.
+ */
+struct apfs_ino_path_req {
+	__u64 ip_ino;		/* Inode to find the path of */
+	__u64 ip_buffer;	/* User address of the buffer for the path */
+	__u32 ip_size;		/* Size of the buffer, then size of the path */
+	__u32 ip_flags;		/* APFS_INO_PATH_* flags */
+	__u32 ip_hops;		/* On return, steps from inode to root */
+	__u32 ip_cached;	/* On return, steps found in the name cache */
+};
+
+/* Flags for APFS_IOC_INO_PATH */
+#define APFS_INO_PATH_CACHED	0x1	/* Fail with EAGAIN on a cache miss */
+
+/*
+ * Request for APFS_IOC_ARCHIVE.  The directory the ioctl is called on gets
+ * written to @ar_fd as a cpio archive in the "newc" format, with paths
+ * relative to the directory; hard links are archived as separate copies.  The
+ * counters are set even when the call fails, to tell how far it got.
+ */
+struct apfs_archive_req {
+	__s32 ar_fd;		/* Pipe or file to write the archive to */
+	__u32 ar_flags;		/* Must be zero */
+	__u64 ar_entries;	/* On return, entries written */
+	__u64 ar_bytes;		/* On return, bytes written */
+};
+
+/*
+ * Request for APFS_IOC_COPY_RANGE, made on the file to copy from.  Up to
+ * @cr_len bytes are copied to @cr_fd, a regular file on another filesystem;
+ * the holes of the source are never read.  Both offsets are moved past the
+ * copy on return, even when the call fails, so that it can be resumed.
+ */
+struct apfs_copy_range_req {
+	__s32 cr_fd;		/* File to copy to, open for writing */
+	__u32 cr_flags;		/* APFS_COPY_RANGE_* flags */
+	__u64 cr_src_off;	/* Source offset, then where it stopped */
+	__u64 cr_dst_off;	/* Offset in the destination, the same */
+	__u64 cr_len;		/* Bytes to copy, clamped to the source size */
+	__u64 cr_copied;	/* On return, bytes of data copied */
+	__u64 cr_holes;		/* On return, bytes of holes never read */
+};
+
+/* Flags for APFS_IOC_COPY_RANGE */
+#define APFS_COPY_RANGE_DIRECT	0x1	/* Read uncached data with direct I/O */
+
+#define APFS_IOC_BULKSTAT	_IOWR(0xB2, 1, struct apfs_bulkstat_req)
+#define APFS_IOC_GET_LINKS	_IOWR(0xB2, 2, struct apfs_links_req)
+#define APFS_IOC_SNAP_DIFF	_IOWR(0xB2, 3, struct apfs_diff_req)
+#define APFS_IOC_PHYS_EXTENTS	_IOWR(0xB2, 4, struct apfs_extents_req)
+#define APFS_IOC_DIR_STATS	_IOR(0xB2, 5, struct apfs_dir_stats)
+#define APFS_IOC_BLOCK_OWNERS	_IOWR(0xB2, 6, struct apfs_owners_req)
+#define APFS_IOC_PREFETCH	_IOWR(0xB2, 7, struct apfs_prefetch_req)
+#define APFS_IOC_GET_WARMSET	_IOWR(0xB2, 8, struct apfs_warmset_req)
+#define APFS_IOC_LOAD_WARMSET	_IOW(0xB2, 9, struct apfs_warmset_req)
+#define APFS_IOC_READDIR_PLUS	_IOWR(0xB2, 10, struct apfs_readdir_plus_req)
+#define APFS_IOC_GET_XATTRS	_IOWR(0xB2, 11, struct apfs_xattrs_req)
+#define APFS_IOC_FRAG_REPORT	_IOWR(0xB2, 12, struct apfs_frag_report)
+#define APFS_IOC_INO_PATH	_IOWR(0xB2, 13, struct apfs_ino_path_req)
+#define APFS_IOC_ARCHIVE	_IOWR(0xB2, 14, struct apfs_archive_req)
+#define APFS_IOC_COPY_RANGE	_IOWR(0xB2, 15, struct apfs_copy_range_req)
+
+#endif	/* _UAPI_LINUX_APFS_H */
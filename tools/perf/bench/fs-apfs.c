@@ -0,0 +1,530 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ * fs-apfs: Benchmark the metadata operations of a mounted apfs volume.
+ *
+ * The tree under the given path is listed once, and then each operation is
+ * run in turn by all the threads, on random entries of the tree, for a fixed
+ * time.  The result for each operation is the total throughput and the
+ * percentiles of the latency of a single call, taken from a log-linear
+ * histogram so that no call needs to be stored.  Nothing is written to the
+ * filesystem, so the same tree can be used to compare kernels and machines.
+ */
+
+#include <pthread.h>
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <ftw.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <linux/compiler.h>
+#include <linux/kernel.h>
+#include <linux/time64.h>
+#include <sys/stat.h>
+#include <sys/statfs.h>
+#include <sys/time.h>
+#include <sys/xattr.h>
+
+#include "../util/stat.h"
+#include <subcmd/parse-options.h>
+#include "bench.h"
+
+#include <err.h>
+
+#ifndef APFS_SUPER_MAGIC
+#define APFS_SUPER_MAGIC	0x4253584E
+#endif
+
+static const char *path;
+static const char *ops_str = "all";
+static unsigned int nthreads;
+static unsigned int nsecs = 5;
+static unsigned int nentries = 100000;
+static unsigned int read_size = 4096;
+static bool done, silent;
+
+static struct timeval start, end, runtime;
+static pthread_mutex_t thread_lock;
+static unsigned int threads_starting;
+static pthread_cond_t thread_parent, thread_worker;
+
+static const struct option options[] = {
+	OPT_STRING('p', "path", &path, "path", "Specify a directory on the mounted volume"),
+	OPT_STRING('o', "ops", &ops_str, "all", "Specify the operations to run, as a comma-separated list"),
+	OPT_UINTEGER('t', "threads", &nthreads, "Specify amount of threads"),
+	OPT_UINTEGER('r', "runtime", &nsecs, "Specify runtime of each operation (in seconds)"),
+	OPT_UINTEGER('e', "entries", &nentries, "Specify the most entries to list from the tree"),
+	OPT_UINTEGER('b', "block", &read_size, "Specify the size of each random read (in bytes)"),
+	OPT_BOOLEAN('s', "silent", &silent, "Silent mode: do not display the tree summary"),
+	OPT_END()
+};
+
+static const char * const bench_fs_apfs_usage[] = {
+	"perf bench fs apfs -p <path> <options>",
+	NULL
+};
+
+/*
+ * Latencies go to a log-linear histogram: values under HIST_SUB are exact,
+ * and each power of two above that is split in HIST_SUB buckets, so the error
+ * of a percentile is never over 1/HIST_SUB.
+ */
+#define HIST_SUB_BITS	4
+#define HIST_SUB	(1 << HIST_SUB_BITS)
+#define HIST_BUCKETS	((64 - HIST_SUB_BITS + 1) * HIST_SUB)
+
+struct entry_list {
+	char		**paths;
+	off_t		*sizes;
+	int		*fds;
+	unsigned long	nr;
+};
+
+/* Entries of the tree, by the operation that uses them */
+static struct entry_list all_entries, dir_entries, link_entries, file_entries;
+
+struct worker {
+	int		tid;
+	pthread_t	thread;
+	u64		seed;
+	unsigned long	ops;
+	unsigned long	errors;
+	char		*buf;
+	u64		hist[HIST_BUCKETS];
+	u64		max_ns;
+};
+
+struct fs_op {
+	const char		*name;
+	struct entry_list	*list;
+	int			(*fn)(struct worker *w, unsigned long i);
+};
+
+/* xorshift64, seeded per thread */
+static u64 next_rand(struct worker *w)
+{
+	w->seed ^= w->seed << 13;
+	w->seed ^= w->seed >> 7;
+	w->seed ^= w->seed << 17;
+	return w->seed;
+}
+
+static int do_lookup(struct worker *w __maybe_unused, unsigned long i)
+{
+	int fd = open(all_entries.paths[i], O_PATH | O_NOFOLLOW);
+
+	if (fd < 0)
+		return -1;
+	close(fd);
+	return 0;
+}
+
+static int do_stat(struct worker *w __maybe_unused, unsigned long i)
+{
+	struct stat st;
+
+	return lstat(all_entries.paths[i], &st);
+}
+
+static int do_readdir(struct worker *w __maybe_unused, unsigned long i)
+{
+	DIR *dir = opendir(dir_entries.paths[i]);
+
+	if (!dir)
+		return -1;
+	while (readdir(dir))
+		;
+	closedir(dir);
+	return 0;
+}
+
+static int do_listxattr(struct worker *w, unsigned long i)
+{
+	ssize_t len = llistxattr(all_entries.paths[i], w->buf, XATTR_LIST_MAX);
+
+	return len < 0 ? -1 : 0;
+}
+
+static int do_readlink(struct worker *w, unsigned long i)
+{
+	ssize_t len = readlink(link_entries.paths[i], w->buf, PATH_MAX);
+
+	return len < 0 ? -1 : 0;
+}
+
+static int do_read(struct worker *w, unsigned long i)
+{
+	off_t blocks = (file_entries.sizes[i] + read_size - 1) / read_size;
+	off_t off = (next_rand(w) % blocks) * read_size;
+
+	return pread(file_entries.fds[i], w->buf, read_size, off) < 0 ? -1 : 0;
+}
+
+static struct fs_op fs_ops[] = {
+	{ "lookup",	&all_entries,	do_lookup	},
+	{ "stat",	&all_entries,	do_stat		},
+	{ "readdir",	&dir_entries,	do_readdir	},
+	{ "listxattr",	&all_entries,	do_listxattr	},
+	{ "readlink",	&link_entries,	do_readlink	},
+	{ "read",	&file_entries,	do_read		},
+	{ NULL,		NULL,		NULL		}
+};
+
+static struct fs_op *curr_op;
+
+static bool list_add(struct entry_list *list, const char *entry, off_t size)
+{
+	if (list->nr >= nentries)
+		return false;
+	list->paths[list->nr] = strdup(entry);
+	if (!list->paths[list->nr])
+		err(EXIT_FAILURE, "strdup");
+	list->sizes[list->nr] = size;
+	list->nr++;
+	return true;
+}
+
+static int list_entry(const char *entry, const struct stat *st, int type,
+		      struct FTW *ftw __maybe_unused)
+{
+	if (!list_add(&all_entries, entry, st->st_size))
+		return 1; /* stop the walk */
+
+	if (type == FTW_D)
+		list_add(&dir_entries, entry, 0);
+	else if (type == FTW_SL)
+		list_add(&link_entries, entry, 0);
+	else if (type == FTW_F && S_ISREG(st->st_mode) && st->st_size)
+		list_add(&file_entries, entry, st->st_size);
+	return 0;
+}
+
+static void list_init(struct entry_list *list)
+{
+	list->paths = calloc(nentries, sizeof(*list->paths));
+	list->sizes = calloc(nentries, sizeof(*list->sizes));
+	if (!list->paths || !list->sizes)
+		err(EXIT_FAILURE, "calloc");
+}
+
+static void list_free(struct entry_list *list)
+{
+	unsigned long i;
+
+	for (i = 0; i < list->nr; i++) {
+		if (list->fds)
+			close(list->fds[i]);
+		free(list->paths[i]);
+	}
+	free(list->paths);
+	free(list->sizes);
+	free(list->fds);
+}
+
+/* The files are opened up front, so that the reads don't measure lookups */
+static void open_files(void)
+{
+	unsigned long i;
+
+	file_entries.fds = calloc(file_entries.nr, sizeof(*file_entries.fds));
+	if (!file_entries.fds)
+		err(EXIT_FAILURE, "calloc");
+	for (i = 0; i < file_entries.nr; i++) {
+		file_entries.fds[i] = open(file_entries.paths[i], O_RDONLY);
+		if (file_entries.fds[i] < 0)
+			err(EXIT_FAILURE, "%s", file_entries.paths[i]);
+	}
+}
+
+static u64 now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (u64)ts.tv_sec * NSEC_PER_SEC + ts.tv_nsec;
+}
+
+static unsigned int hist_bucket(u64 ns)
+{
+	unsigned int shift;
+
+	if (ns < HIST_SUB)
+		return ns;
+	shift = 63 - __builtin_clzll(ns) - HIST_SUB_BITS;
+	return (shift + 1) * HIST_SUB + ((ns >> shift) & (HIST_SUB - 1));
+}
+
+static u64 hist_value(unsigned int bucket)
+{
+	unsigned int shift;
+
+	if (bucket < HIST_SUB)
+		return bucket;
+	shift = bucket / HIST_SUB - 1;
+	return (u64)(HIST_SUB + bucket % HIST_SUB) << shift;
+}
+
+static void *workerfn(void *arg)
+{
+	struct worker *w = (struct worker *) arg;
+	struct entry_list *list = curr_op->list;
+	u64 t0, ns;
+
+	pthread_mutex_lock(&thread_lock);
+	threads_starting--;
+	if (!threads_starting)
+		pthread_cond_signal(&thread_parent);
+	pthread_cond_wait(&thread_worker, &thread_lock);
+	pthread_mutex_unlock(&thread_lock);
+
+	do {
+		unsigned long i = next_rand(w) % list->nr;
+
+		t0 = now_ns();
+		if (curr_op->fn(w, i))
+			w->errors++;
+		ns = now_ns() - t0;
+
+		w->hist[hist_bucket(ns)]++;
+		if (ns > w->max_ns)
+			w->max_ns = ns;
+		w->ops++;
+	} while (!done);
+
+	return NULL;
+}
+
+static void toggle_done(int sig __maybe_unused,
+			siginfo_t *info __maybe_unused,
+			void *uc __maybe_unused)
+{
+	/* inform all threads that we're done for the day */
+	done = true;
+	gettimeofday(&end, NULL);
+	timersub(&end, &start, &runtime);
+}
+
+/**
+ * percentile - Find the latency under which a share of the calls fall
+ * @hist:	merged histogram of all threads
+ * @total:	number of calls in @hist
+ * @pct:	the share, in percent
+ */
+static u64 percentile(const u64 *hist, u64 total, double pct)
+{
+	u64 target = total * pct / 100, seen = 0;
+	unsigned int i;
+
+	for (i = 0; i < HIST_BUCKETS; i++) {
+		seen += hist[i];
+		if (seen > target)
+			return hist_value(i);
+	}
+	return hist_value(HIST_BUCKETS - 1);
+}
+
+static void run_op(struct fs_op *op, struct worker *worker)
+{
+	struct stats throughput_stats;
+	u64 hist[HIST_BUCKETS] = {0};
+	u64 total = 0, errors = 0, max_ns = 0;
+	double secs, ops_sec;
+	unsigned int i, j;
+
+	if (!op->list->nr) {
+		if (bench_format == BENCH_FORMAT_DEFAULT)
+			printf("%-10s skipped, no entries for it under %s\n",
+			       op->name, path);
+		return;
+	}
+
+	curr_op = op;
+	done = false;
+	init_stats(&throughput_stats);
+	threads_starting = nthreads;
+	for (i = 0; i < nthreads; i++) {
+		char *buf = worker[i].buf;
+
+		memset(&worker[i], 0, sizeof(worker[i]));
+		worker[i].tid = i;
+		worker[i].seed = 0x9e3779b97f4a7c15ULL * (i + 1);
+		worker[i].buf = buf;
+		if (pthread_create(&worker[i].thread, NULL, workerfn,
+				   &worker[i]))
+			err(EXIT_FAILURE, "pthread_create");
+	}
+
+	pthread_mutex_lock(&thread_lock);
+	while (threads_starting)
+		pthread_cond_wait(&thread_parent, &thread_lock);
+	gettimeofday(&start, NULL);
+	pthread_cond_broadcast(&thread_worker);
+	pthread_mutex_unlock(&thread_lock);
+
+	sleep(nsecs);
+	toggle_done(0, NULL, NULL);
+
+	for (i = 0; i < nthreads; i++) {
+		if (pthread_join(worker[i].thread, NULL))
+			err(EXIT_FAILURE, "pthread_join");
+	}
+
+	secs = runtime.tv_sec + runtime.tv_usec / 1e6;
+	for (i = 0; i < nthreads; i++) {
+		update_stats(&throughput_stats, worker[i].ops / secs);
+		total += worker[i].ops;
+		errors += worker[i].errors;
+		if (worker[i].max_ns > max_ns)
+			max_ns = worker[i].max_ns;
+		for (j = 0; j < HIST_BUCKETS; j++)
+			hist[j] += worker[i].hist[j];
+	}
+	ops_sec = total / secs;
+
+	if (bench_format == BENCH_FORMAT_SIMPLE) {
+		printf("%s %.0f %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64 "\n",
+		       op->name, ops_sec, percentile(hist, total, 50),
+		       percentile(hist, total, 90), percentile(hist, total, 99),
+		       percentile(hist, total, 99.9), max_ns);
+		return;
+	}
+
+	printf("%-10s %12.0f ops/sec (+- %.2f%% per thread)  latency ns: p50 %" PRIu64
+	       "  p90 %" PRIu64 "  p99 %" PRIu64 "  p99.9 %" PRIu64 "  max %" PRIu64 "\n",
+	       op->name, ops_sec,
+	       rel_stddev_stats(stddev_stats(&throughput_stats),
+				avg_stats(&throughput_stats)),
+	       percentile(hist, total, 50), percentile(hist, total, 90),
+	       percentile(hist, total, 99), percentile(hist, total, 99.9),
+	       max_ns);
+	if (errors)
+		printf("%-10s %" PRIu64 " calls failed\n", "", errors);
+}
+
+static bool op_selected(const char *name)
+{
+	const char *p = ops_str;
+	size_t len = strlen(name);
+
+	if (!strcmp(ops_str, "all"))
+		return true;
+	while ((p = strstr(p, name))) {
+		if ((p == ops_str || p[-1] == ',') &&
+		    (p[len] == '\0' || p[len] == ','))
+			return true;
+		p += len;
+	}
+	return false;
+}
+
+static void check_ops(void)
+{
+	char *list = strdup(ops_str), *name, *saveptr = NULL;
+	struct fs_op *op;
+
+	if (!list)
+		err(EXIT_FAILURE, "strdup");
+	if (!strcmp(list, "all"))
+		goto out;
+	for (name = strtok_r(list, ",", &saveptr); name;
+	     name = strtok_r(NULL, ",", &saveptr)) {
+		for (op = fs_ops; op->name; op++) {
+			if (!strcmp(op->name, name))
+				break;
+		}
+		if (op->name)
+			continue;
+		fprintf(stderr, "Unknown operation: %s\nAvailable operations:", name);
+		for (op = fs_ops; op->name; op++)
+			fprintf(stderr, " %s", op->name);
+		fprintf(stderr, "\n");
+		exit(EXIT_FAILURE);
+	}
+out:
+	free(list);
+}
+
+int bench_fs_apfs(int argc, const char **argv)
+{
+	struct sigaction act;
+	struct worker *worker;
+	struct statfs sfs;
+	struct fs_op *op;
+	unsigned int i;
+
+	argc = parse_options(argc, argv, options, bench_fs_apfs_usage, 0);
+	if (argc || !path || !nsecs || !nentries || !read_size) {
+		usage_with_options(bench_fs_apfs_usage, options);
+		exit(EXIT_FAILURE);
+	}
+	check_ops();
+
+	if (statfs(path, &sfs))
+		err(EXIT_FAILURE, "%s", path);
+	if (sfs.f_type != APFS_SUPER_MAGIC)
+		fprintf(stderr, "Warning: %s is not on an apfs volume\n", path);
+
+	sigfillset(&act.sa_mask);
+	act.sa_sigaction = toggle_done;
+	sigaction(SIGINT, &act, NULL);
+
+	if (!nthreads) /* default to the number of CPUs */
+		nthreads = sysconf(_SC_NPROCESSORS_ONLN);
+
+	list_init(&all_entries);
+	list_init(&dir_entries);
+	list_init(&link_entries);
+	list_init(&file_entries);
+	if (nftw(path, list_entry, 64, FTW_PHYS | FTW_MOUNT) < 0)
+		err(EXIT_FAILURE, "%s", path);
+	open_files();
+
+	worker = calloc(nthreads, sizeof(*worker));
+	if (!worker)
+		err(EXIT_FAILURE, "calloc");
+	for (i = 0; i < nthreads; i++) {
+		/* XATTR_LIST_MAX is also enough for readlink() */
+		worker[i].buf = malloc(max(XATTR_LIST_MAX, (int)read_size));
+		if (!worker[i].buf)
+			err(EXIT_FAILURE, "malloc");
+	}
+
+	if (bench_format == BENCH_FORMAT_DEFAULT) {
+		printf("Run summary [PID %d]: %d threads, %d secs per operation.\n",
+		       getpid(), nthreads, nsecs);
+		if (!silent)
+			printf("Tree under %s: %lu entries, %lu directories, %lu symlinks, %lu files.\n",
+			       path, all_entries.nr, dir_entries.nr,
+			       link_entries.nr, file_entries.nr);
+		printf("\n");
+	}
+
+	pthread_mutex_init(&thread_lock, NULL);
+	pthread_cond_init(&thread_parent, NULL);
+	pthread_cond_init(&thread_worker, NULL);
+
+	for (op = fs_ops; op->name; op++) {
+		if (op_selected(op->name))
+			run_op(op, worker);
+	}
+
+	pthread_cond_destroy(&thread_parent);
+	pthread_cond_destroy(&thread_worker);
+	pthread_mutex_destroy(&thread_lock);
+
+	for (i = 0; i < nthreads; i++)
+		free(worker[i].buf);
+	free(worker);
+	list_free(&all_entries);
+	list_free(&dir_entries);
+	list_free(&link_entries);
+	list_free(&file_entries);
+	return 0;
+}
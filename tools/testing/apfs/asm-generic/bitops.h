@@ -0,0 +1,62 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_ASM_GENERIC_BITOPS_H
+#define _APFS_TEST_ASM_GENERIC_BITOPS_H
+
+/*
+ * Replaces the tools/include version, which needs more of asm-generic than
+ * this harness cares to have; the compiler builtins are good enough here.
+ */
+
+static inline unsigned long __ffs(unsigned long word)
+{
+	return __builtin_ctzl(word);
+}
+
+static inline unsigned long __fls(unsigned long word)
+{
+	return BITS_PER_LONG - 1 - __builtin_clzl(word);
+}
+
+static inline int fls(unsigned int x)
+{
+	return x ? 32 - __builtin_clz(x) : 0;
+}
+
+static inline int fls64(__u64 x)
+{
+	return x ? 64 - __builtin_clzll(x) : 0;
+}
+
+static inline unsigned long __ffs64(__u64 word)
+{
+	return __builtin_ctzll(word);
+}
+
+#define hweight32(w)	__builtin_popcount(w)
+#define hweight64(w)	__builtin_popcountll(w)
+
+static inline int test_bit(long nr, const volatile unsigned long *addr)
+{
+	return 1UL & (addr[nr / BITS_PER_LONG] >> (nr % BITS_PER_LONG));
+}
+
+static inline void set_bit(long nr, volatile unsigned long *addr)
+{
+	__sync_fetch_and_or(addr + nr / BITS_PER_LONG,
+			    1UL << (nr % BITS_PER_LONG));
+}
+
+static inline void clear_bit(long nr, volatile unsigned long *addr)
+{
+	__sync_fetch_and_and(addr + nr / BITS_PER_LONG,
+			     ~(1UL << (nr % BITS_PER_LONG)));
+}
+
+static inline int test_and_set_bit(long nr, volatile unsigned long *addr)
+{
+	unsigned long mask = 1UL << (nr % BITS_PER_LONG);
+
+	return (__sync_fetch_and_or(addr + nr / BITS_PER_LONG, mask) & mask) != 0;
+}
+
+#endif	/* _APFS_TEST_ASM_GENERIC_BITOPS_H */
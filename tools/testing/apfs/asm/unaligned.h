@@ -0,0 +1,55 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_ASM_UNALIGNED_H
+#define _APFS_TEST_ASM_UNALIGNED_H
+
+#include <string.h>
+#include "../compat.h"
+
+static inline u16 get_unaligned_le16(const void *p)
+{
+	__le16 v;
+
+	memcpy(&v, p, sizeof(v));
+	return le16_to_cpu(v);
+}
+
+static inline u32 get_unaligned_le32(const void *p)
+{
+	__le32 v;
+
+	memcpy(&v, p, sizeof(v));
+	return le32_to_cpu(v);
+}
+
+static inline u32 get_unaligned_be32(const void *p)
+{
+	__be32 v;
+
+	memcpy(&v, p, sizeof(v));
+	return be32_to_cpu(v);
+}
+
+static inline u64 get_unaligned_le64(const void *p)
+{
+	__le64 v;
+
+	memcpy(&v, p, sizeof(v));
+	return le64_to_cpu(v);
+}
+
+#define get_unaligned(p)						\
+({									\
+	typeof(*(p)) __v;						\
+									\
+	memcpy(&__v, (p), sizeof(__v));					\
+	__v;								\
+})
+
+#define put_unaligned(v, p)						\
+do {									\
+	typeof(*(p)) __v = (v);						\
+									\
+	memcpy((p), &__v, sizeof(__v));					\
+} while (0)
+
+#endif	/* _APFS_TEST_ASM_UNALIGNED_H */
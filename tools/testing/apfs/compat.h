@@ -0,0 +1,90 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ * Definitions shared by the kernel header shims of the apfs test harness
+ */
+#ifndef _APFS_TEST_COMPAT_H
+#define _APFS_TEST_COMPAT_H
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <linux/bitops.h>
+#include <linux/compiler.h>
+#include <linux/err.h>
+#include <linux/kern_levels.h>
+#include <linux/kernel.h>
+#include <linux/log2.h>
+#include <linux/types.h>
+
+#define __percpu
+
+#ifndef U16_MAX
+#define U16_MAX		((u16)~0U)
+#endif
+#ifndef U32_MAX
+#define U32_MAX		((u32)~0U)
+#endif
+#ifndef U64_MAX
+#define U64_MAX		((u64)~0ULL)
+#endif
+
+#ifndef min_t
+#define min_t(type, x, y)	({ type __x = (x); type __y = (y);	\
+				   __x < __y ? __x : __y; })
+#endif
+#ifndef max_t
+#define max_t(type, x, y)	({ type __x = (x); type __y = (y);	\
+				   __x > __y ? __x : __y; })
+#endif
+
+#define order_base_2(n)		((n) > 1 ? ilog2((n) - 1) + 1 : 0)
+
+#define le64_to_cpup(p)		le64_to_cpu(*(p))
+#define le32_to_cpup(p)		le32_to_cpu(*(p))
+#define le16_to_cpup(p)		le16_to_cpu(*(p))
+
+/* Only 64-bit hosts are supported, so no need for a real division helper */
+#define do_div(n, base) ({				\
+	u32 __base = (base);				\
+	u32 __rem = (u64)(n) % __base;			\
+	(n) = (u64)(n) / __base;			\
+	__rem; })
+
+#define cmpxchg(ptr, old, new)	__sync_val_compare_and_swap(ptr, old, new)
+#define smp_load_acquire(p)	__atomic_load_n(p, __ATOMIC_ACQUIRE)
+#define smp_store_release(p, v)	__atomic_store_n(p, v, __ATOMIC_RELEASE)
+
+#define ATOMIC_INIT(i)		{ (i) }
+#define atomic_read(v)		__atomic_load_n(&(v)->counter, __ATOMIC_RELAXED)
+#define atomic_inc(v)		__atomic_add_fetch(&(v)->counter, 1, __ATOMIC_SEQ_CST)
+#define atomic_dec_and_test(v)	\
+	(__atomic_sub_fetch(&(v)->counter, 1, __ATOMIC_SEQ_CST) == 0)
+#define atomic_set(v, i)	\
+	__atomic_store_n(&(v)->counter, i, __ATOMIC_RELAXED)
+#define atomic_sub(i, v)	\
+	__atomic_sub_fetch(&(v)->counter, i, __ATOMIC_SEQ_CST)
+#define atomic_inc_return(v)	\
+	__atomic_add_fetch(&(v)->counter, 1, __ATOMIC_SEQ_CST)
+#define atomic_xchg(v, i)	\
+	__atomic_exchange_n(&(v)->counter, i, __ATOMIC_SEQ_CST)
+#define atomic64_set		atomic_set
+#define atomic64_inc		atomic_inc
+
+
+#define no_printk(fmt, ...)	({ if (0) printf(fmt, ##__VA_ARGS__); 0; })
+#define pr_info(fmt, ...)	printf(fmt, ##__VA_ARGS__)
+#define pr_warn(fmt, ...)	fprintf(stderr, fmt, ##__VA_ARGS__)
+#define pr_err(fmt, ...)	fprintf(stderr, fmt, ##__VA_ARGS__)
+
+#define cond_resched()		do { } while (0)
+#define might_sleep()		do { } while (0)
+
+#define GFP_KERNEL	0
+#define GFP_NOFS	0
+#define GFP_NOWAIT	0
+#define __GFP_NOWARN	0
+#define __GFP_ACCOUNT	0
+
+#endif	/* _APFS_TEST_COMPAT_H */
@@ -0,0 +1,451 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ * Time the decmpfs decoders over a corpus of compressed files
+ *
+ * The lzvn and lzfse decoders of fs/apfs and the zlib inflate code of the
+ * kernel are compiled unchanged, and each compressed file of the corpus gets
+ * decoded the way the read path of the kernel would: inline data as a single
+ * stream, and resource forks chunk by chunk.  The corpus is a directory made
+ * with apfs_decomp_corpus.sh, in tools/testing/selftests/filesystems/apfs,
+ * where each file is the raw com.apple.decmpfs xattr as <name>.decmpfs, and
+ * the resource fork, if it has one, as <name>.rsrc.  The results go to stdout
+ * as lines of json, one for each codec, storage and size of the decoded unit,
+ * as in apfs_decompbench of the selftests.
+ */
+#include <dirent.h>
+#include <getopt.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <asm/unaligned.h>
+#include <linux/zlib.h>
+#include "apfs.h"
+#include "compress.h"
+#include "lzfse.h"
+
+/* Buckets for the size of the decoded units, by log2 of their KiB */
+#define BENCH_BUCKETS	16
+
+enum bench_codec {
+	BENCH_ZLIB,
+	BENCH_LZVN,
+	BENCH_LZFSE,
+	BENCH_NR_CODECS
+};
+
+static const char * const bench_codec_names[] = {
+	[BENCH_ZLIB]	= "zlib",
+	[BENCH_LZVN]	= "lzvn",
+	[BENCH_LZFSE]	= "lzfse",
+};
+
+/*
+ * Unit of compressed data that gets decoded in one go
+ */
+struct bench_unit {
+	enum bench_codec codec;
+	bool rsrc;			/* Chunk of a resource fork? */
+	const u8 *src;
+	size_t src_len;
+	size_t len;			/* Length of the decoded data */
+	u8 *buf;			/* Buffer of the file, for one unit */
+};
+
+struct bench_result {
+	u64 units;
+	u64 bytes;
+	u64 ns;
+};
+
+static struct bench_unit *units;
+static size_t nr_units;
+static struct bench_result results[BENCH_NR_CODECS][2][BENCH_BUCKETS];
+static void *zlib_workspace;
+static void *lzfse_workspace;
+
+static u64 now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (u64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void die(const char *msg)
+{
+	perror(msg);
+	exit(1);
+}
+
+/**
+ * read_file - Read a whole file into memory
+ * @dir:	directory of the file
+ * @name:	name of the file
+ * @len:	on return, length of the file
+ *
+ * Returns the contents, or NULL if the file doesn't exist.
+ */
+static u8 *read_file(const char *dir, const char *name, size_t *len)
+{
+	char path[PATH_MAX];
+	struct stat st;
+	FILE *file;
+	u8 *buf;
+
+	snprintf(path, sizeof(path), "%s/%s", dir, name);
+	file = fopen(path, "r");
+	if (!file)
+		return NULL;
+	if (fstat(fileno(file), &st))
+		die(path);
+	buf = malloc(st.st_size ?: 1);
+	if (!buf)
+		die("malloc");
+	if (fread(buf, 1, st.st_size, file) != st.st_size)
+		die(path);
+	fclose(file);
+	*len = st.st_size;
+	return buf;
+}
+
+static void add_unit(enum bench_codec codec, bool rsrc, const u8 *src,
+		     size_t src_len, size_t len, u8 *buf)
+{
+	static size_t alloc;
+	struct bench_unit *unit;
+
+	if (nr_units == alloc) {
+		alloc = alloc ? alloc * 2 : 4096;
+		units = realloc(units, alloc * sizeof(*units));
+		if (!units)
+			die("realloc");
+	}
+	unit = &units[nr_units++];
+	unit->codec = codec;
+	unit->rsrc = rsrc;
+	unit->src = src;
+	unit->src_len = src_len;
+	unit->len = len;
+	unit->buf = buf;
+}
+
+/**
+ * add_rsrc_chunks - Add the chunks of a resource fork to the corpus
+ * @codec:	codec of the file
+ * @rsrc:	the resource fork
+ * @rsrc_len:	length of @rsrc
+ * @size:	uncompressed size of the file
+ *
+ * Returns 0 on success, or -1 if the fork is malformed.
+ */
+static int add_rsrc_chunks(enum bench_codec codec, const u8 *rsrc,
+			   size_t rsrc_len, u64 size)
+{
+	u64 nchunks = DIV_ROUND_UP(size, APFS_COMPRESS_CHUNK_SIZE);
+	u64 base = 0, i;
+
+	if (codec == BENCH_ZLIB) {
+		/* The zlib chunk table, as in apfs_compress_read_table() */
+		if (rsrc_len < 4)
+			return -1;
+		base = (u64)get_unaligned_be32(rsrc) + 4;
+		if (base + 4 + nchunks * 8 > rsrc_len ||
+		    get_unaligned_le32(rsrc + base) < nchunks)
+			return -1;
+	} else if ((nchunks + 1) * 4 > rsrc_len) {
+		return -1;
+	}
+
+	for (i = 0; i < nchunks; i++) {
+		size_t want = min_t(u64, APFS_COMPRESS_CHUNK_SIZE,
+				    size - (i << APFS_COMPRESS_CHUNK_BITS));
+		u64 off, len;
+
+		if (codec == BENCH_ZLIB) {
+			const u8 *entry = rsrc + base + 4 + i * 8;
+
+			off = base + get_unaligned_le32(entry);
+			len = get_unaligned_le32(entry + 4);
+		} else {
+			off = get_unaligned_le32(rsrc + i * 4);
+			len = get_unaligned_le32(rsrc + i * 4 + 4);
+			if (len < off)
+				return -1;
+			len -= off;
+		}
+		if (off + len > rsrc_len)
+			return -1;
+		add_unit(codec, true, rsrc + off, len, want,
+			 i ? NULL : (u8 *)rsrc);
+	}
+	return 0;
+}
+
+/**
+ * add_file - Add a compressed file of the corpus
+ * @dir:	the corpus directory
+ * @name:	name of the decmpfs xattr file, ending in .decmpfs
+ *
+ * Returns 0 on success, or -1 if the file was skipped.
+ */
+static int add_file(const char *dir, const char *name)
+{
+	const struct apfs_decmpfs_hdr *hdr;
+	char rsrc_name[NAME_MAX + 1];
+	enum bench_codec codec;
+	size_t attr_len, rsrc_len, first = nr_units;
+	u8 *attr, *rsrc;
+	u64 size;
+
+	attr = read_file(dir, name, &attr_len);
+	if (!attr)
+		die(name);
+	hdr = (struct apfs_decmpfs_hdr *)attr;
+	if (attr_len < sizeof(*hdr) ||
+	    le32_to_cpu(hdr->magic) != APFS_DECMPFS_MAGIC)
+		goto bad;
+	size = le64_to_cpu(hdr->size);
+
+	switch (le32_to_cpu(hdr->type)) {
+	case APFS_COMPRESS_ZLIB_ATTR:
+		codec = BENCH_ZLIB;
+		break;
+	case APFS_COMPRESS_LZVN_ATTR:
+		codec = BENCH_LZVN;
+		break;
+	case APFS_COMPRESS_LZFSE_ATTR:
+		codec = BENCH_LZFSE;
+		break;
+	case APFS_COMPRESS_ZLIB_RSRC:
+		codec = BENCH_ZLIB;
+		goto rsrc;
+	case APFS_COMPRESS_LZVN_RSRC:
+		codec = BENCH_LZVN;
+		goto rsrc;
+	case APFS_COMPRESS_LZFSE_RSRC:
+		codec = BENCH_LZFSE;
+		goto rsrc;
+	default:
+		fprintf(stderr, "%s: unknown compression type, skipped\n",
+			name);
+		free(attr);
+		return -1;
+	}
+	/* Inline data is a single stream for the whole file */
+	if (size > APFS_COMPRESS_MAX_INLINE_SIZE)
+		goto bad;
+	add_unit(codec, false, hdr->data, attr_len - sizeof(*hdr), size,
+		 attr);
+	return 0;
+
+rsrc:
+	free(attr);
+	snprintf(rsrc_name, sizeof(rsrc_name), "%.*s.rsrc",
+		 (int)(strlen(name) - strlen(".decmpfs")), name);
+	rsrc = read_file(dir, rsrc_name, &rsrc_len);
+	if (!rsrc || add_rsrc_chunks(codec, rsrc, rsrc_len, size)) {
+		fprintf(stderr, "%s: bad resource fork, skipped\n", name);
+		/* Drop the chunks that were added before the bad one */
+		nr_units = first;
+		free(rsrc);
+		return -1;
+	}
+	if (nr_units == first) /* An empty file */
+		free(rsrc);
+	return 0;
+
+bad:
+	fprintf(stderr, "%s: bad decmpfs header, skipped\n", name);
+	free(attr);
+	return -1;
+}
+
+static void read_corpus(const char *dir)
+{
+	struct dirent *de;
+	DIR *d;
+
+	d = opendir(dir);
+	if (!d)
+		die(dir);
+	while ((de = readdir(d))) {
+		size_t len = strlen(de->d_name);
+
+		if (len > strlen(".decmpfs") &&
+		    !strcmp(de->d_name + len - strlen(".decmpfs"), ".decmpfs"))
+			add_file(dir, de->d_name);
+	}
+	closedir(d);
+}
+
+/**
+ * zlib_decode - Inflate a zlib unit, as apfs_zlib_decompress() does
+ * @src:	compressed data
+ * @src_len:	length of @src
+ * @dst:	buffer for the decoded data
+ * @dst_len:	length of @dst
+ *
+ * Returns the number of bytes decoded, or -1 in case of failure.
+ */
+static int zlib_decode(const u8 *src, size_t src_len, u8 *dst, size_t dst_len)
+{
+	z_stream strm;
+	int err, ret;
+
+	if (src_len && (src[0] & 0x0f) == 0x0f) {
+		/* The data was stored uncompressed */
+		ret = min(src_len - 1, dst_len);
+		memcpy(dst, src + 1, ret);
+		return ret;
+	}
+
+	strm.workspace = zlib_workspace;
+	strm.next_in = src;
+	strm.avail_in = src_len;
+	strm.next_out = dst;
+	strm.avail_out = dst_len;
+	if (zlib_inflateInit(&strm) != Z_OK)
+		return -1;
+	do {
+		err = zlib_inflate(&strm, Z_SYNC_FLUSH);
+	} while (err == Z_OK && strm.avail_out);
+	ret = (err == Z_OK || err == Z_STREAM_END) ?
+	      (int)(dst_len - strm.avail_out) : -1;
+	zlib_inflateEnd(&strm);
+	return ret;
+}
+
+static int decode(const struct bench_unit *unit, u8 *dst)
+{
+	switch (unit->codec) {
+	case BENCH_ZLIB:
+		return zlib_decode(unit->src, unit->src_len, dst, unit->len);
+	case BENCH_LZVN:
+		if (unit->src_len && unit->src[0] == 0x06) {
+			/* The data was stored uncompressed */
+			memcpy(dst, unit->src + 1,
+			       min(unit->src_len - 1, unit->len));
+			return min(unit->src_len - 1, unit->len);
+		}
+		return apfs_lzvn_decompress(unit->src, unit->src_len, dst,
+					    unit->len);
+	default:
+		return apfs_lzfse_decompress(lzfse_workspace, unit->src,
+					     unit->src_len, dst, unit->len);
+	}
+}
+
+static unsigned int bucket_of(size_t len)
+{
+	unsigned int bucket = 0;
+
+	while (bucket < BENCH_BUCKETS - 1 && (1024UL << bucket) < len)
+		bucket++;
+	return bucket;
+}
+
+static void usage(const char *prog)
+{
+	fprintf(stderr,
+		"usage: %s [-c cpu] [-n passes] <corpus>\n"
+		"  -c  run on this cpu only\n"
+		"  -n  passes over the whole corpus (default: 10)\n",
+		prog);
+	exit(2);
+}
+
+int main(int argc, char **argv)
+{
+	unsigned long passes = 10, pass;
+	int cpu = -1, opt, codec, rsrc, bucket;
+	u8 *dst;
+	size_t i;
+
+	while ((opt = getopt(argc, argv, "c:n:")) != -1) {
+		switch (opt) {
+		case 'c':
+			cpu = strtol(optarg, NULL, 0);
+			break;
+		case 'n':
+			passes = strtoul(optarg, NULL, 0);
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+	if (optind != argc - 1 || !passes)
+		usage(argv[0]);
+
+	if (cpu >= 0) {
+		cpu_set_t set;
+
+		CPU_ZERO(&set);
+		CPU_SET(cpu, &set);
+		if (sched_setaffinity(0, sizeof(set), &set))
+			die("sched_setaffinity");
+	}
+
+	read_corpus(argv[optind]);
+	if (!nr_units) {
+		fprintf(stderr, "%s: no compressed files\n", argv[optind]);
+		return 1;
+	}
+	zlib_workspace = malloc(zlib_inflate_workspacesize());
+	lzfse_workspace = malloc(apfs_lzfse_workspace_size());
+	dst = malloc(APFS_COMPRESS_MAX_INLINE_SIZE);
+	if (!zlib_workspace || !lzfse_workspace || !dst)
+		die("malloc");
+
+	for (pass = 0; pass < passes; pass++) {
+		for (i = 0; i < nr_units; i++) {
+			const struct bench_unit *unit = &units[i];
+			struct bench_result *res;
+			u64 start = now_ns();
+			int ret;
+
+			ret = decode(unit, dst);
+			res = &results[unit->codec][unit->rsrc]
+				      [bucket_of(unit->len)];
+			res->ns += now_ns() - start;
+			if (ret != unit->len) {
+				fprintf(stderr, "%s unit %zu: decode failed\n",
+					bench_codec_names[unit->codec], i);
+				return 1;
+			}
+			res->units++;
+			res->bytes += unit->len;
+		}
+	}
+
+	for (codec = 0; codec < BENCH_NR_CODECS; codec++) {
+		for (rsrc = 0; rsrc <= 1; rsrc++) {
+			for (bucket = 0; bucket < BENCH_BUCKETS; bucket++) {
+				struct bench_result *res;
+
+				res = &results[codec][rsrc][bucket];
+				if (!res->units)
+					continue;
+				printf("{\"test\":\"decomp\",\"codec\":\"%s\","
+				       "\"storage\":\"%s\",\"chunk_kib\":%lu,"
+				       "\"cpu\":%d,\"units\":%llu,"
+				       "\"bytes\":%llu,\"ns\":%llu,"
+				       "\"mb_per_s\":%.1f}\n",
+				       bench_codec_names[codec],
+				       rsrc ? "rsrc" : "attr", 1UL << bucket,
+				       sched_getcpu(), res->units, res->bytes,
+				       res->ns, res->ns ?
+				       res->bytes * 1000.0 / res->ns : 0.0);
+			}
+		}
+	}
+
+	for (i = 0; i < nr_units; i++)
+		free(units[i].buf);
+	free(units);
+	free(dst);
+	free(lzfse_workspace);
+	free(zlib_workspace);
+	return 0;
+}
@@ -0,0 +1,569 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ * Read-only consistency check of an apfs image, spread across threads
+ *
+ * The index nodes of the object map and of the catalog are read first, one
+ * level at a time, to find all the leaves.  The leaves are then sorted by
+ * block number and split into a contiguous run for each thread, which reads
+ * its run in order with node checks enabled, so the image gets swept at the
+ * bandwidth of the device.  Finally, the catalog is split into ranges of
+ * object ids, and each thread walks one of them to check the records:
+ *
+ *	- keys never go backwards;
+ *	- the parent of each inode, and the target of each directory entry,
+ *	  have an inode record;
+ *	- directory entries, extended attributes and sibling links belong to
+ *	  an inode, and a directory has as many entries as it says;
+ *	- the file extents of a data stream don't overlap.
+ *
+ * Every thread works on a mount of its own, so no caches are shared.  Errors
+ * go to stderr, and the result goes to stdout as a line of json, as in the
+ * selftests.  The exit code is 0 for a clean image, 4 if errors were found,
+ * and 8 if the check couldn't be done, like for fsck.
+ */
+#include <getopt.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include <linux/fs.h>
+#include "apfs.h"
+#include "btree.h"
+#include "dir.h"
+#include "extents.h"
+#include "inode.h"
+#include "key.h"
+#include "node.h"
+#include "shim.h"
+#include "super.h"
+
+#define FSCK_OK		0
+#define FSCK_ERRORS	4
+#define FSCK_FAILED	8
+
+/* Most errors reported in detail, the rest are only counted */
+#define FSCK_MAX_REPORTS	100
+
+/*
+ * Leaf of a tree, found in an index node
+ */
+struct fsck_leaf {
+	u64 bno;
+	u64 first_id;	/* Object id of the first key, for the catalog */
+};
+
+/*
+ * Growable list of leaves
+ */
+struct fsck_leaves {
+	struct fsck_leaf *leaves;
+	size_t nr;
+	size_t alloc;
+};
+
+struct fsck_result {
+	u64 nodes;		/* Nodes read */
+	u64 bad_nodes;		/* Nodes that failed the checks */
+	u64 records;		/* Catalog records checked */
+	u64 inodes;		/* Inode records checked */
+	u64 errors;		/* All the problems found */
+};
+
+/*
+ * Work for a single thread
+ */
+struct fsck_thread {
+	pthread_t thread;
+	struct super_block *sb;		/* Mount for this thread alone */
+	const u64 *bnos;		/* Leaves to read, sorted */
+	size_t nr_bnos;
+	u64 lo, hi;			/* Range of catalog ids, hi may be 0 */
+	struct fsck_result res;
+};
+
+/*
+ * Records of the catalog object that a walk is checking
+ */
+struct fsck_object {
+	u64 id;
+	bool inode;		/* It has an inode record */
+	bool dir;		/* The inode is a directory */
+	u64 nchildren;		/* From the inode record */
+	u64 drecs;		/* Directory entries found */
+	u64 ext_end;		/* End of the last file extent */
+};
+
+static unsigned long reports;
+
+static u64 now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (u64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/* The check can't go on */
+static void fail(const char *fmt, ...)
+{
+	va_list args;
+
+	va_start(args, fmt);
+	vfprintf(stderr, fmt, args);
+	va_end(args);
+	fputc('\n', stderr);
+	exit(FSCK_FAILED);
+}
+
+static void report(struct fsck_result *res, const char *fmt, ...)
+{
+	va_list args;
+
+	res->errors++;
+	if (__atomic_fetch_add(&reports, 1, __ATOMIC_RELAXED) >=
+	    FSCK_MAX_REPORTS)
+		return;
+	va_start(args, fmt);
+	vfprintf(stderr, fmt, args);
+	va_end(args);
+	fputc('\n', stderr);
+}
+
+static int leaves_add(struct fsck_leaves *list, u64 bno, u64 first_id)
+{
+	if (list->nr == list->alloc) {
+		size_t alloc = list->alloc ? 2 * list->alloc : 256;
+		struct fsck_leaf *leaves;
+
+		leaves = realloc(list->leaves, alloc * sizeof(*leaves));
+		if (!leaves)
+			return -ENOMEM;
+		list->leaves = leaves;
+		list->alloc = alloc;
+	}
+	list->leaves[list->nr].bno = bno;
+	list->leaves[list->nr].first_id = first_id;
+	list->nr++;
+	return 0;
+}
+
+/**
+ * collect_children - Add the children of an index node to a list
+ * @sb:		superblock structure
+ * @node:	the index node
+ * @flags:	tree type
+ * @list:	the list
+ * @res:	result for the errors found
+ *
+ * Returns 0 on success, or a negative error code if the check can't go on.
+ */
+static int collect_children(struct super_block *sb, struct apfs_node *node,
+			    unsigned int flags, struct fsck_leaves *list,
+			    struct fsck_result *res)
+{
+	struct apfs_query query;
+	int err = 0;
+
+	apfs_init_query(&query, node);
+	query.flags = flags;
+	for (query.index = 0; query.index < node->records; query.index++) {
+		struct apfs_key key;
+		u64 child_id, child_bno;
+
+		if (apfs_node_read_record(&query, &key) ||
+		    apfs_query_child_block(sb, &query, &child_id, &child_bno)) {
+			report(res, "bad index record %d in node 0x%llx",
+			       query.index, node->object.block_nr);
+			continue;
+		}
+		err = leaves_add(list, child_bno, key.id);
+		if (err)
+			break;
+	}
+	apfs_free_query(sb, &query);
+	return err;
+}
+
+/**
+ * collect_leaves - Read the index nodes of a tree, and list its leaves
+ * @sb:		superblock structure
+ * @root:	root of the tree
+ * @flags:	tree type
+ * @leaves:	list for the leaves, in key order
+ * @res:	result for the errors found
+ *
+ * Returns 0 on success, or a negative error code if the check can't go on.
+ */
+static int collect_leaves(struct super_block *sb, struct apfs_node *root,
+			  unsigned int flags, struct fsck_leaves *leaves,
+			  struct fsck_result *res)
+{
+	struct fsck_leaves curr = {0}, next = {0}, tmp;
+	struct apfs_btree_node_phys *raw;
+	unsigned int level, depth = 0;
+	size_t i;
+	int err;
+
+	raw = (struct apfs_btree_node_phys *)root->object.data;
+	level = le16_to_cpu(raw->btn_level);
+	if (level == 0)
+		return leaves_add(leaves, root->object.block_nr, 0);
+	err = collect_children(sb, root, flags, level == 1 ? leaves : &curr,
+			       res);
+
+	/* Each pass reads the index nodes of one level */
+	while (!err && curr.nr) {
+		if (++depth >= APFS_BTREE_MAX_DEPTH) {
+			report(res, "b-tree at 0x%llx is too deep",
+			       root->object.block_nr);
+			break;
+		}
+		--level;
+		for (i = 0; i < curr.nr && !err; i++) {
+			struct apfs_node *node;
+
+			res->nodes++;
+			node = apfs_read_node(sb, curr.leaves[i].bno);
+			if (IS_ERR(node)) {
+				res->bad_nodes++;
+				report(res, "bad index node 0x%llx (%ld)",
+				       curr.leaves[i].bno, PTR_ERR(node));
+				continue;
+			}
+			raw = (struct apfs_btree_node_phys *)node->object.data;
+			if (le16_to_cpu(raw->btn_level) != level) {
+				report(res, "node 0x%llx is at the wrong level",
+				       curr.leaves[i].bno);
+			} else {
+				err = collect_children(sb, node, flags,
+						       level == 1 ? leaves :
+								    &next,
+						       res);
+			}
+			apfs_node_put(node);
+		}
+		tmp = curr;
+		curr = next;
+		next = tmp;
+		next.nr = 0;
+	}
+	free(curr.leaves);
+	free(next.leaves);
+	return err;
+}
+
+static void *read_leaves(void *arg)
+{
+	struct fsck_thread *ft = arg;
+	size_t i;
+
+	for (i = 0; i < ft->nr_bnos; i++) {
+		struct apfs_node *node;
+
+		ft->res.nodes++;
+		node = apfs_read_node(ft->sb, ft->bnos[i]);
+		if (IS_ERR(node)) {
+			ft->res.bad_nodes++;
+			report(&ft->res, "bad leaf node 0x%llx (%ld)",
+			       ft->bnos[i], PTR_ERR(node));
+			continue;
+		}
+		if (!apfs_node_is_leaf(node))
+			report(&ft->res, "node 0x%llx is not a leaf",
+			       ft->bnos[i]);
+		apfs_node_put(node);
+	}
+	return NULL;
+}
+
+static bool inode_exists(struct super_block *sb, u64 ino)
+{
+	struct apfs_query query;
+	struct apfs_key key;
+	int err;
+
+	apfs_init_inode_key(ino, &key);
+	apfs_init_query(&query, APFS_SB(sb)->s_cat_root);
+	query.key = &key;
+	query.flags = APFS_QUERY_CAT | APFS_QUERY_EXACT;
+	err = apfs_btree_query(sb, &query);
+	apfs_free_query(sb, &query);
+	return !err;
+}
+
+static void object_done(struct fsck_thread *ft, struct fsck_object *obj)
+{
+	if (obj->dir && obj->drecs != obj->nchildren)
+		report(&ft->res, "directory 0x%llx has %llu entries, not %llu",
+		       obj->id, obj->drecs, obj->nchildren);
+}
+
+/**
+ * check_record - Check a single catalog record
+ * @ft:		the thread
+ * @query:	iterator positioned on the record
+ * @key:	key of the record
+ * @obj:	state of the object of @key
+ */
+static void check_record(struct fsck_thread *ft, struct apfs_query *query,
+			 struct apfs_key *key, struct fsck_object *obj)
+{
+	void *val = query->node->object.data + query->off;
+	struct apfs_inode_val *inode_val = val;
+	struct apfs_drec_val *drec_val = val;
+	struct apfs_file_extent_val *ext_val = val;
+	u64 parent, target, len;
+
+	switch (key->type) {
+	case APFS_TYPE_INODE:
+		ft->res.inodes++;
+		if (query->len < sizeof(*inode_val)) {
+			report(&ft->res, "inode 0x%llx: record too short",
+			       key->id);
+			break;
+		}
+		obj->inode = true;
+		obj->dir = S_ISDIR(le16_to_cpu(inode_val->mode));
+		obj->nchildren = le32_to_cpu(inode_val->nchildren);
+		parent = le64_to_cpu(inode_val->parent_id);
+		if (parent > APFS_ROOT_DIR_PARENT &&
+		    !inode_exists(ft->sb, parent))
+			report(&ft->res, "inode 0x%llx: no parent 0x%llx",
+			       key->id, parent);
+		break;
+	case APFS_TYPE_DIR_REC:
+		obj->drecs++;
+		if (query->len < sizeof(*drec_val)) {
+			report(&ft->res, "directory 0x%llx: entry too short",
+			       key->id);
+			break;
+		}
+		target = le64_to_cpu(drec_val->file_id);
+		if (!inode_exists(ft->sb, target))
+			report(&ft->res, "directory 0x%llx: %s has no inode",
+			       key->id, key->name);
+		/* fallthrough */
+	case APFS_TYPE_XATTR:
+	case APFS_TYPE_SIBLING_LINK:
+		if (!obj->inode)
+			report(&ft->res,
+			       "record of type %u for 0x%llx, no inode",
+			       key->type, key->id);
+		break;
+	case APFS_TYPE_FILE_EXTENT:
+		if (query->len < sizeof(*ext_val)) {
+			report(&ft->res, "stream 0x%llx: extent too short",
+			       key->id);
+			break;
+		}
+		len = le64_to_cpu(ext_val->len_and_flags) &
+		      APFS_FILE_EXTENT_LEN_MASK;
+		if (!len || key->number < obj->ext_end)
+			report(&ft->res, "stream 0x%llx: bad extent at 0x%llx",
+			       key->id, key->number);
+		obj->ext_end = key->number + len;
+		break;
+	}
+}
+
+static void *check_catalog(void *arg)
+{
+	struct fsck_thread *ft = arg;
+	struct super_block *sb = ft->sb;
+	struct apfs_key start = {0}, end = {0}, prev_key = {0}, key;
+	struct fsck_object obj = {0};
+	struct apfs_query query;
+	char prev_name[APFS_NAME_LEN + 1];
+	bool first = true, ordered = false;
+	int err;
+
+	start.id = ft->lo;
+	end.id = ft->hi;
+	if (ft->hi)
+		apfs_btree_iter_range(&query, APFS_SB(sb)->s_cat_root, &start,
+				      &end, APFS_QUERY_CAT);
+	else
+		apfs_btree_iter_init(&query, APFS_SB(sb)->s_cat_root, &start,
+				     APFS_QUERY_CAT | APFS_QUERY_ANY_ID);
+
+	for (err = apfs_btree_iter_seek(sb, &query); !err;
+	     err = apfs_btree_iter_next(sb, &query)) {
+		err = apfs_node_read_record(&query, &key);
+		if (err)
+			break;
+		ft->res.records++;
+		if (ordered && apfs_keycmp(sb, &key, &prev_key) < 0)
+			report(&ft->res,
+			       "key for 0x%llx out of order in 0x%llx",
+			       key.id, query.node->object.block_nr);
+		if (first || key.id != obj.id) {
+			if (!first)
+				object_done(ft, &obj);
+			memset(&obj, 0, sizeof(obj));
+			obj.id = key.id;
+		}
+		first = false;
+		check_record(ft, &query, &key, &obj);
+
+		/* The name points into the node, which may get evicted */
+		prev_key = key;
+		ordered = true;
+		if (key.name) {
+			ordered = strlen(key.name) < sizeof(prev_name);
+			if (ordered)
+				strcpy(prev_name, key.name);
+			prev_key.name = prev_name;
+		}
+	}
+	if (!first)
+		object_done(ft, &obj);
+	if (err != -ENODATA)
+		report(&ft->res, "catalog walk from 0x%llx failed (%d)", ft->lo,
+		       err);
+	apfs_free_query(sb, &query);
+	return NULL;
+}
+
+static int bno_cmp(const void *a, const void *b)
+{
+	u64 bno_a = *(const u64 *)a;
+	u64 bno_b = *(const u64 *)b;
+
+	return bno_a < bno_b ? -1 : bno_a > bno_b;
+}
+
+static void usage(const char *prog)
+{
+	fprintf(stderr,
+		"usage: %s [-j threads] [-v volume] <image>\n"
+		"  -j  number of threads (default: one per cpu)\n",
+		prog);
+	exit(FSCK_FAILED);
+}
+
+int main(int argc, char **argv)
+{
+	unsigned int nr_threads = sysconf(_SC_NPROCESSORS_ONLN);
+	unsigned int vol_nr = 0, t;
+	struct fsck_leaves omap_leaves = {0}, cat_leaves = {0};
+	struct fsck_result total = {0};
+	struct fsck_thread *threads;
+	struct super_block *sb;
+	size_t nr_bnos, i, start_idx;
+	u64 *bnos, start, ns;
+	int opt, err;
+
+	while ((opt = getopt(argc, argv, "j:v:")) != -1) {
+		switch (opt) {
+		case 'j':
+			nr_threads = strtoul(optarg, NULL, 0);
+			break;
+		case 'v':
+			vol_nr = strtoul(optarg, NULL, 0);
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+	if (optind != argc - 1 || !nr_threads)
+		usage(argv[0]);
+
+	/* The mounts are set up here, the harness code is not thread-safe */
+	threads = calloc(nr_threads, sizeof(*threads));
+	if (!threads)
+		fail("out of memory");
+	sb = apfs_test_mount(argv[optind], vol_nr, APFS_CHECK_NODES);
+	if (IS_ERR(sb))
+		fail("%s: mount failed (%ld)", argv[optind], PTR_ERR(sb));
+	for (t = 0; t < nr_threads; t++) {
+		threads[t].sb = apfs_test_mount(argv[optind], vol_nr,
+						APFS_CHECK_NODES);
+		if (IS_ERR(threads[t].sb))
+			fail("%s: mount failed (%ld)", argv[optind],
+			     PTR_ERR(threads[t].sb));
+	}
+
+	start = now_ns();
+	err = collect_leaves(sb, APFS_SB(sb)->s_omap_root, APFS_QUERY_OMAP,
+			     &omap_leaves, &total);
+	if (!err)
+		err = collect_leaves(sb, APFS_SB(sb)->s_cat_root,
+				     APFS_QUERY_CAT, &cat_leaves, &total);
+	if (err)
+		fail("unable to list the leaves (%d)", err);
+
+	/* Sweep all the leaves in physical order */
+	nr_bnos = omap_leaves.nr + cat_leaves.nr;
+	bnos = calloc(nr_bnos + 1, sizeof(*bnos));
+	if (!bnos)
+		fail("out of memory");
+	for (i = 0; i < omap_leaves.nr; i++)
+		bnos[i] = omap_leaves.leaves[i].bno;
+	for (i = 0; i < cat_leaves.nr; i++)
+		bnos[omap_leaves.nr + i] = cat_leaves.leaves[i].bno;
+	qsort(bnos, nr_bnos, sizeof(*bnos), bno_cmp);
+	for (t = 0, start_idx = 0; t < nr_threads; t++) {
+		size_t end_idx = nr_bnos * (t + 1) / nr_threads;
+
+		threads[t].bnos = bnos + start_idx;
+		threads[t].nr_bnos = end_idx - start_idx;
+		start_idx = end_idx;
+		if (pthread_create(&threads[t].thread, NULL, read_leaves,
+				   &threads[t]))
+			fail("unable to start thread %u", t);
+	}
+	for (t = 0; t < nr_threads; t++)
+		pthread_join(threads[t].thread, NULL);
+
+	/* Split the catalog by the first ids of its leaves, in key order */
+	for (t = 0; t < nr_threads; t++) {
+		size_t idx = cat_leaves.nr * t / nr_threads;
+
+		threads[t].lo = t && idx < cat_leaves.nr ?
+				cat_leaves.leaves[idx].first_id : 0;
+		if (t && threads[t].lo < threads[t - 1].lo)
+			threads[t].lo = threads[t - 1].lo;
+	}
+	for (t = 0; t < nr_threads; t++) {
+		threads[t].hi = t + 1 < nr_threads ? threads[t + 1].lo : 0;
+		/* Ranges that came out empty have nothing to walk */
+		if (t + 1 < nr_threads && threads[t].hi == threads[t].lo)
+			continue;
+		if (pthread_create(&threads[t].thread, NULL, check_catalog,
+				   &threads[t]))
+			fail("unable to start thread %u", t);
+	}
+	for (t = 0; t < nr_threads; t++) {
+		if (t + 1 < nr_threads && threads[t].hi == threads[t].lo)
+			continue;
+		pthread_join(threads[t].thread, NULL);
+	}
+	ns = now_ns() - start;
+
+	for (t = 0; t < nr_threads; t++) {
+		total.nodes += threads[t].res.nodes;
+		total.bad_nodes += threads[t].res.bad_nodes;
+		total.records += threads[t].res.records;
+		total.inodes += threads[t].res.inodes;
+		total.errors += threads[t].res.errors;
+		apfs_test_umount(threads[t].sb);
+	}
+	printf("{\"test\":\"fsck\",\"threads\":%u,\"nodes\":%llu,"
+	       "\"bad_nodes\":%llu,\"records\":%llu,\"inodes\":%llu,"
+	       "\"errors\":%llu,\"ns\":%llu,\"mib_per_s\":%.1f}\n",
+	       nr_threads, total.nodes, total.bad_nodes, total.records,
+	       total.inodes, total.errors, ns,
+	       ns ? (double)total.nodes * sb->s_blocksize * 1000000000 /
+		    ns / (1 << 20) : 0.0);
+
+	free(bnos);
+	free(omap_leaves.leaves);
+	free(cat_leaves.leaves);
+	apfs_test_umount(sb);
+	free(threads);
+	return total.errors ? FSCK_ERRORS : FSCK_OK;
+}
@@ -0,0 +1,236 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ * Fuzzer for the apfs node parser and b-tree queries
+ *
+ * Each input is a small header followed by the image of a few blocks.  The
+ * catalog root is block zero and the object map root is block one (block
+ * zero as well for object map queries), so the queries may go down through
+ * any children that the input cares to provide.  The header selects the query
+ * and its key:
+ *
+ *	byte 0		query type, from enum fuzz_op
+ *	byte 1		FUZZ_CASE_FOLD and FUZZ_CHECK_NODES flags
+ *	byte 2		index of a name in fuzz_names, for the named records
+ *	bytes 8-15	object or inode id, little endian
+ *
+ * The default build runs each file given on the command line, or stdin; with
+ * LIBFUZZER=1, the entry point is used by libFuzzer instead.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <asm/unaligned.h>
+#include "apfs.h"
+#include "btree.h"
+#include "key.h"
+#include "node.h"
+#include "shim.h"
+#include "super.h"
+
+#define FUZZ_HEADER_SIZE	16
+#define FUZZ_BLOCK_SIZE		4096
+#define FUZZ_MAX_BLOCKS		64
+
+enum fuzz_op {
+	FUZZ_OMAP,		/* Object map translation */
+	FUZZ_INODE,		/* Exact catalog query for an inode */
+	FUZZ_LOOKUP,		/* Exact catalog query for a dentry */
+	FUZZ_XATTR,		/* Exact catalog query for an xattr */
+	FUZZ_EXTENT,		/* Catalog query for the extent at an offset */
+	FUZZ_READDIR,		/* Multiple query for the dentries of a dir */
+	FUZZ_WALK,		/* Iteration over the whole catalog */
+	FUZZ_PIN,		/* Pin the top levels of the catalog */
+	FUZZ_NR_OPS
+};
+
+/* Flags for the second header byte */
+#define FUZZ_CASE_FOLD		0x01
+#define FUZZ_CHECK_NODES	0x02
+
+static const char * const fuzz_names[] = {
+	"", "a", "README", "Caf\xc3\xa9", "Cafe\xcc\x81", "\xc3\x9f",
+	"\xed\x95\x9c\xea\xb5\xad\xec\x96\xb4", "com.apple.decmpfs",
+	"\xf0\x9f\x93\xb7 Photos",
+};
+
+static int fuzz_iterate(struct super_block *sb, struct apfs_key *key,
+			unsigned int flags)
+{
+	struct apfs_query query;
+	struct apfs_key curr_key;
+	int err;
+
+	apfs_btree_iter_init(&query, APFS_SB(sb)->s_cat_root, key, flags);
+	err = apfs_btree_iter_seek(sb, &query);
+	while (!err) {
+		err = apfs_node_read_record(&query, &curr_key);
+		if (!err)
+			err = apfs_btree_iter_next(sb, &query);
+	}
+	apfs_free_query(sb, &query);
+	return err;
+}
+
+static int fuzz_query(struct super_block *sb, struct apfs_key *key,
+		      unsigned int flags)
+{
+	struct apfs_query query;
+	struct apfs_key curr_key;
+	int err;
+
+	apfs_init_query(&query, APFS_SB(sb)->s_cat_root);
+	query.key = key;
+	query.flags |= flags;
+	err = apfs_btree_query(sb, &query);
+	if (!err)
+		err = apfs_node_read_record(&query, &curr_key);
+	apfs_free_query(sb, &query);
+	return err;
+}
+
+static void fuzz_run(struct super_block *sb, enum fuzz_op op, u64 id,
+		     const char *name)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_key key;
+	unsigned long count = 0;
+	u64 bno;
+
+	switch (op) {
+	case FUZZ_OMAP:
+		/* The second lookup must be a hit in the omap cache */
+		apfs_omap_lookup_block(sb, sbi->s_omap_root, id, &bno);
+		apfs_omap_lookup_block(sb, sbi->s_omap_root, id, &bno);
+		break;
+	case FUZZ_INODE:
+		/* The second query goes through the record cache */
+		apfs_init_inode_key(id, &key);
+		if (!fuzz_query(sb, &key, APFS_QUERY_CAT | APFS_QUERY_EXACT))
+			fuzz_query(sb, &key, APFS_QUERY_CAT | APFS_QUERY_EXACT);
+		break;
+	case FUZZ_LOOKUP:
+		apfs_init_drec_hashed_key(sb, id, name, &key);
+		fuzz_query(sb, &key, APFS_QUERY_CAT | APFS_QUERY_EXACT);
+		break;
+	case FUZZ_XATTR:
+		apfs_init_xattr_key(id, name, &key);
+		fuzz_query(sb, &key, APFS_QUERY_CAT | APFS_QUERY_EXACT);
+		break;
+	case FUZZ_EXTENT:
+		apfs_init_file_extent_key(id, 0x10000, &key);
+		fuzz_query(sb, &key, APFS_QUERY_CAT);
+		break;
+	case FUZZ_READDIR:
+		apfs_init_drec_hashed_key(sb, id, NULL /* name */, &key);
+		fuzz_iterate(sb, &key, APFS_QUERY_CAT | APFS_QUERY_MULTIPLE);
+		break;
+	case FUZZ_WALK:
+		memset(&key, 0, sizeof(key));
+		fuzz_iterate(sb, &key, APFS_QUERY_CAT | APFS_QUERY_ANY_ID);
+		break;
+	case FUZZ_PIN:
+		apfs_btree_pin(sb, sbi->s_cat_root, APFS_QUERY_CAT,
+			       APFS_BTREE_MAX_PIN_LEVELS, &count);
+		break;
+	default:
+		break;
+	}
+}
+
+int LLVMFuzzerTestOneInput(const u8 *data, size_t size)
+{
+	struct super_block *sb;
+	struct apfs_sb_info *sbi;
+	struct apfs_node *node;
+	unsigned int flags = 0;
+	bool case_fold;
+	enum fuzz_op op;
+	const char *name;
+	u64 id, omap_bno;
+
+	if (size < FUZZ_HEADER_SIZE + FUZZ_BLOCK_SIZE)
+		return 0;
+	op = data[0] % FUZZ_NR_OPS;
+	case_fold = data[1] & FUZZ_CASE_FOLD;
+	if (data[1] & FUZZ_CHECK_NODES)
+		flags |= APFS_CHECK_NODES;
+	name = fuzz_names[data[2] % ARRAY_SIZE(fuzz_names)];
+	id = get_unaligned_le64(data + 8);
+
+	data += FUZZ_HEADER_SIZE;
+	size -= FUZZ_HEADER_SIZE;
+	size = min_t(size_t, size, FUZZ_MAX_BLOCKS * FUZZ_BLOCK_SIZE);
+	omap_bno = op == FUZZ_OMAP ? 0 : 1;
+	if (size < (omap_bno + 1) * FUZZ_BLOCK_SIZE)
+		return 0;
+
+	apfs_test_quiet = true;
+	sb = apfs_test_mount_mem(data, size, FUZZ_BLOCK_SIZE, flags);
+	if (IS_ERR(sb))
+		return 0;
+	sbi = APFS_SB(sb);
+	sbi->s_case_fold = case_fold;
+
+	node = apfs_read_node(sb, omap_bno);
+	if (IS_ERR(node))
+		goto out;
+	sbi->s_omap_root = node;
+	node = apfs_read_node(sb, 0);
+	if (IS_ERR(node))
+		goto out;
+	sbi->s_cat_root = node;
+
+	fuzz_run(sb, op, id, name);
+out:
+	apfs_test_umount(sb);
+	return 0;
+}
+
+#ifndef APFS_LIBFUZZER
+static int fuzz_file(FILE *file, const char *path)
+{
+	size_t len = 0, alloc = 0;
+	u8 *buf = NULL;
+
+	while (!feof(file)) {
+		if (len == alloc) {
+			alloc = alloc ? alloc * 2 : 65536;
+			buf = realloc(buf, alloc);
+			if (!buf) {
+				perror("realloc");
+				return 1;
+			}
+		}
+		len += fread(buf + len, 1, alloc - len, file);
+		if (ferror(file)) {
+			perror(path);
+			free(buf);
+			return 1;
+		}
+	}
+	LLVMFuzzerTestOneInput(buf, len);
+	free(buf);
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	int i, rc = 0;
+
+	if (argc < 2)
+		return fuzz_file(stdin, "stdin");
+
+	for (i = 1; i < argc; ++i) {
+		FILE *file = fopen(argv[i], "rb");
+
+		if (!file) {
+			perror(argv[i]);
+			rc = 1;
+			continue;
+		}
+		rc |= fuzz_file(file, argv[i]);
+		fclose(file);
+	}
+	return rc;
+}
+#endif	/* APFS_LIBFUZZER */
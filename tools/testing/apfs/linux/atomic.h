@@ -0,0 +1,7 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_ATOMIC_H
+#define _APFS_TEST_LINUX_ATOMIC_H
+
+#include <linux/types.h>
+
+#endif	/* _APFS_TEST_LINUX_ATOMIC_H */
@@ -0,0 +1,23 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_BLKDEV_H
+#define _APFS_TEST_LINUX_BLKDEV_H
+
+/* All reads are synchronous, so there is nothing to plug */
+struct blk_plug {
+	int unused;
+};
+
+static inline void blk_start_plug(struct blk_plug *plug)
+{
+}
+
+static inline void blk_finish_plug(struct blk_plug *plug)
+{
+}
+
+#define REQ_OP_READ	0
+#define REQ_META	(1 << 0)
+#define REQ_PRIO	(1 << 1)
+#define REQ_RAHEAD	(1 << 2)
+
+#endif	/* _APFS_TEST_LINUX_BLKDEV_H */
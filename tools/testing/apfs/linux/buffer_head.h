@@ -0,0 +1,99 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_BUFFER_HEAD_H
+#define _APFS_TEST_LINUX_BUFFER_HEAD_H
+
+#include <linux/fs.h>
+
+/*
+ * A block read straight from the image with pread(), with no caching at all;
+ * the apfs code only uses buffer heads for the superblocks.
+ */
+struct buffer_head;
+typedef void (bh_end_io_t)(struct buffer_head *bh, int uptodate);
+
+struct buffer_head {
+	char *b_data;
+	size_t b_size;
+	sector_t b_blocknr;
+	struct page *b_page;
+	bh_end_io_t *b_end_io;
+	void *b_private;
+};
+
+extern struct buffer_head *sb_bread(struct super_block *sb, sector_t block);
+extern void brelse(struct buffer_head *bh);
+extern int sb_set_blocksize(struct super_block *sb, int size);
+
+static inline void sb_breadahead(struct super_block *sb, sector_t block)
+{
+}
+
+/* Pages of the image come from pread(), without buffers attached */
+static inline int page_has_buffers(struct page *page)
+{
+	return 0;
+}
+
+static inline int try_to_free_buffers(struct page *page)
+{
+	return 1;
+}
+
+/* Reads are never done ahead, so there are no buffers to look up either */
+static inline struct buffer_head *__getblk(struct block_device *bdev,
+					   sector_t block, unsigned int size)
+{
+	return NULL;
+}
+
+static inline struct buffer_head *sb_getblk(struct super_block *sb,
+					    sector_t block)
+{
+	return NULL;
+}
+
+static inline int buffer_uptodate(struct buffer_head *bh)
+{
+	return 1;
+}
+
+static inline void wait_on_buffer(struct buffer_head *bh)
+{
+}
+
+static inline void ll_rw_block(int op, int op_flags, int nr,
+			       struct buffer_head *bhs[])
+{
+}
+
+static inline int trylock_buffer(struct buffer_head *bh)
+{
+	return 1;
+}
+
+static inline void unlock_buffer(struct buffer_head *bh)
+{
+}
+
+static inline void set_buffer_uptodate(struct buffer_head *bh)
+{
+}
+
+static inline void clear_buffer_uptodate(struct buffer_head *bh)
+{
+}
+
+static inline void put_bh(struct buffer_head *bh)
+{
+}
+
+static inline int submit_bh(int op, int op_flags, struct buffer_head *bh)
+{
+	return 0;
+}
+
+static inline void end_buffer_read_sync(struct buffer_head *bh, int uptodate)
+{
+}
+
+#endif	/* _APFS_TEST_LINUX_BUFFER_HEAD_H */
@@ -0,0 +1,7 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_CACHE_H
+#define _APFS_TEST_LINUX_CACHE_H
+
+#define ____cacheline_aligned_in_smp	__attribute__((__aligned__(64)))
+
+#endif	/* _APFS_TEST_LINUX_CACHE_H */
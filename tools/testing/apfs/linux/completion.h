@@ -0,0 +1,9 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_COMPLETION_H
+#define _APFS_TEST_LINUX_COMPLETION_H
+
+struct completion {
+	unsigned int done;
+};
+
+#endif	/* _APFS_TEST_LINUX_COMPLETION_H */
@@ -0,0 +1,9 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_CRC32C_H
+#define _APFS_TEST_LINUX_CRC32C_H
+
+#include "../compat.h"
+
+extern u32 crc32c(u32 crc, const void *address, unsigned int length);
+
+#endif	/* _APFS_TEST_LINUX_CRC32C_H */
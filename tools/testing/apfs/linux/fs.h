@@ -0,0 +1,62 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_FS_H
+#define _APFS_TEST_LINUX_FS_H
+
+#include <sys/types.h>
+#include "../compat.h"
+#include "../../../../include/uapi/linux/magic.h"
+
+typedef u64 sector_t;
+typedef unsigned long pgoff_t;
+typedef struct { uid_t val; } kuid_t;
+typedef struct { gid_t val; } kgid_t;
+
+#define MINORBITS	20
+#define MKDEV(ma, mi)	(((ma) << MINORBITS) | (mi))
+
+struct dentry;
+struct export_operations;
+struct file_operations;
+struct inode_operations;
+struct dentry_operations;
+struct address_space_operations;
+struct qstr;
+struct kstat;
+struct path;
+
+struct timespec64 {
+	s64 tv_sec;
+	long tv_nsec;
+};
+
+/*
+ * Backing store for the blocks of the container: either an image file, or a
+ * buffer in memory for the fuzzer
+ */
+struct address_space {
+	int fd;			/* Image file, or -1 */
+	const char *buf;	/* Image in memory, if @fd is -1 */
+	size_t size;		/* Size of the image */
+};
+
+struct inode {
+	struct super_block *i_sb;
+	struct address_space *i_mapping;
+	unsigned long i_ino;
+};
+
+struct block_device {
+	struct inode *bd_inode;
+};
+
+struct super_block {
+	unsigned long s_blocksize;
+	unsigned char s_blocksize_bits;
+	unsigned long s_magic;
+	dev_t s_dev;
+	char s_id[32];
+	struct block_device *s_bdev;
+	void *s_fs_info;
+};
+
+#endif	/* _APFS_TEST_LINUX_FS_H */
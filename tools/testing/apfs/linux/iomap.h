@@ -0,0 +1,9 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_IOMAP_H
+#define _APFS_TEST_LINUX_IOMAP_H
+
+/* Only needed for the prototypes in trace.h */
+struct iomap;
+struct iomap_ops;
+
+#endif	/* _APFS_TEST_LINUX_IOMAP_H */
@@ -0,0 +1,10 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_JIFFIES_H
+#define _APFS_TEST_LINUX_JIFFIES_H
+
+#include <linux/ktime.h>
+
+#define HZ		1000
+#define jiffies		((unsigned long)(ktime_get_ns() / 1000000))
+
+#endif	/* _APFS_TEST_LINUX_JIFFIES_H */
@@ -0,0 +1,9 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_KOBJECT_H
+#define _APFS_TEST_LINUX_KOBJECT_H
+
+struct kobject {
+	const char *name;
+};
+
+#endif	/* _APFS_TEST_LINUX_KOBJECT_H */
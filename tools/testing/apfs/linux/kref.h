@@ -0,0 +1,41 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_KREF_H
+#define _APFS_TEST_LINUX_KREF_H
+
+#include "../compat.h"
+
+struct kref {
+	int refcount;
+};
+
+static inline void kref_init(struct kref *kref)
+{
+	kref->refcount = 1;
+}
+
+static inline void kref_get(struct kref *kref)
+{
+	__sync_fetch_and_add(&kref->refcount, 1);
+}
+
+static inline int kref_get_unless_zero(struct kref *kref)
+{
+	int old = kref->refcount;
+
+	while (old && !__sync_bool_compare_and_swap(&kref->refcount, old,
+						   old + 1))
+		old = kref->refcount;
+	return old != 0;
+}
+
+static inline int kref_put(struct kref *kref,
+			   void (*release)(struct kref *kref))
+{
+	if (__sync_sub_and_fetch(&kref->refcount, 1) == 0) {
+		release(kref);
+		return 1;
+	}
+	return 0;
+}
+
+#endif	/* _APFS_TEST_LINUX_KREF_H */
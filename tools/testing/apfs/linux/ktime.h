@@ -0,0 +1,16 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_KTIME_H
+#define _APFS_TEST_LINUX_KTIME_H
+
+#include <time.h>
+#include "../compat.h"
+
+static inline u64 ktime_get_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (u64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+#endif	/* _APFS_TEST_LINUX_KTIME_H */
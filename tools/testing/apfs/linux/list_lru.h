@@ -0,0 +1,135 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_LIST_LRU_H
+#define _APFS_TEST_LINUX_LIST_LRU_H
+
+#include <linux/list.h>
+#include <linux/shrinker.h>
+#include <linux/spinlock.h>
+
+/* A single lru list, as if there was only one NUMA node */
+enum lru_status {
+	LRU_REMOVED,
+	LRU_REMOVED_RETRY,
+	LRU_ROTATE,
+	LRU_SKIP,
+	LRU_RETRY,
+};
+
+struct list_lru_one {
+	struct list_head list;
+	long nr_items;
+};
+
+struct list_lru {
+	spinlock_t lock;
+	struct list_lru_one one;
+};
+
+typedef enum lru_status (*list_lru_walk_cb)(struct list_head *item,
+		struct list_lru_one *list, spinlock_t *lock, void *cb_arg);
+
+static inline int list_lru_init(struct list_lru *lru)
+{
+	spin_lock_init(&lru->lock);
+	INIT_LIST_HEAD(&lru->one.list);
+	lru->one.nr_items = 0;
+	return 0;
+}
+
+/* There are no memory cgroups either */
+#define list_lru_init_memcg(lru, shrinker)	list_lru_init(lru)
+
+static inline void list_lru_destroy(struct list_lru *lru)
+{
+}
+
+static inline bool list_lru_add(struct list_lru *lru, struct list_head *item)
+{
+	bool added = false;
+
+	spin_lock(&lru->lock);
+	if (list_empty(item)) {
+		list_add_tail(item, &lru->one.list);
+		lru->one.nr_items++;
+		added = true;
+	}
+	spin_unlock(&lru->lock);
+	return added;
+}
+
+static inline bool list_lru_del(struct list_lru *lru, struct list_head *item)
+{
+	bool deleted = false;
+
+	spin_lock(&lru->lock);
+	if (!list_empty(item)) {
+		list_del_init(item);
+		lru->one.nr_items--;
+		deleted = true;
+	}
+	spin_unlock(&lru->lock);
+	return deleted;
+}
+
+static inline unsigned long list_lru_count(struct list_lru *lru)
+{
+	return lru->one.nr_items;
+}
+
+static inline void list_lru_isolate(struct list_lru_one *list,
+				    struct list_head *item)
+{
+	list_del_init(item);
+	list->nr_items--;
+}
+
+static inline void list_lru_isolate_move(struct list_lru_one *list,
+					 struct list_head *item,
+					 struct list_head *head)
+{
+	list_move(item, head);
+	list->nr_items--;
+}
+
+static inline unsigned long list_lru_walk(struct list_lru *lru,
+					  list_lru_walk_cb isolate,
+					  void *cb_arg,
+					  unsigned long nr_to_walk)
+{
+	struct list_head *item, *n;
+	unsigned long isolated = 0;
+
+	spin_lock(&lru->lock);
+	list_for_each_safe(item, n, &lru->one.list) {
+		if (!nr_to_walk--)
+			break;
+		switch (isolate(item, &lru->one, &lru->lock, cb_arg)) {
+		case LRU_REMOVED:
+			isolated++;
+			break;
+		case LRU_ROTATE:
+			list_move_tail(item, &lru->one.list);
+			break;
+		default:
+			break;
+		}
+	}
+	spin_unlock(&lru->lock);
+	return isolated;
+}
+
+static inline unsigned long list_lru_shrink_count(struct list_lru *lru,
+						  struct shrink_control *sc)
+{
+	return list_lru_count(lru);
+}
+
+static inline unsigned long list_lru_shrink_walk(struct list_lru *lru,
+						 struct shrink_control *sc,
+						 list_lru_walk_cb isolate,
+						 void *cb_arg)
+{
+	return list_lru_walk(lru, isolate, cb_arg, sc->nr_to_scan);
+}
+
+#endif	/* _APFS_TEST_LINUX_LIST_LRU_H */
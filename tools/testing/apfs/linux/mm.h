@@ -0,0 +1,43 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_MM_H
+#define _APFS_TEST_LINUX_MM_H
+
+#include <linux/fs.h>
+
+#define PAGE_SHIFT	12
+#define PAGE_SIZE	(1UL << PAGE_SHIFT)
+#define PAGE_MASK	(~(PAGE_SIZE - 1))
+
+/*
+ * Page of the image, read on demand.  Nothing is cached, so every page is
+ * freed with its last reference.
+ */
+struct page {
+	struct address_space *mapping;
+	void *addr;
+	unsigned long flags;
+	int count;
+};
+
+enum {
+	PG_checked,
+};
+
+static inline void *page_address(struct page *page)
+{
+	return page->addr;
+}
+
+static inline int PageChecked(struct page *page)
+{
+	return test_bit(PG_checked, &page->flags);
+}
+
+static inline void SetPageChecked(struct page *page)
+{
+	set_bit(PG_checked, &page->flags);
+}
+
+extern void put_page(struct page *page);
+
+#endif	/* _APFS_TEST_LINUX_MM_H */
@@ -0,0 +1,17 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_MUTEX_H
+#define _APFS_TEST_LINUX_MUTEX_H
+
+#include <pthread.h>
+
+struct mutex {
+	pthread_mutex_t lock;
+};
+
+#define DEFINE_MUTEX(m)		\
+	struct mutex m = { PTHREAD_MUTEX_INITIALIZER }
+#define mutex_init(m)		pthread_mutex_init(&(m)->lock, NULL)
+#define mutex_lock(m)		pthread_mutex_lock(&(m)->lock)
+#define mutex_unlock(m)		pthread_mutex_unlock(&(m)->lock)
+
+#endif	/* _APFS_TEST_LINUX_MUTEX_H */
@@ -0,0 +1,11 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_NLS_H
+#define _APFS_TEST_LINUX_NLS_H
+
+#include "../compat.h"
+
+typedef u32 unicode_t;
+
+extern int utf8_to_utf32(const u8 *s, int len, unicode_t *pu);
+
+#endif	/* _APFS_TEST_LINUX_NLS_H */
@@ -0,0 +1,22 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_PAGEMAP_H
+#define _APFS_TEST_LINUX_PAGEMAP_H
+
+#include <linux/mm.h>
+
+struct file;
+
+extern struct page *read_mapping_page(struct address_space *mapping,
+				      pgoff_t index, struct file *file);
+
+/* Pages are never shared between threads, so their lock is always free */
+static inline int trylock_page(struct page *page)
+{
+	return 1;
+}
+
+static inline void unlock_page(struct page *page)
+{
+}
+
+#endif	/* _APFS_TEST_LINUX_PAGEMAP_H */
@@ -0,0 +1,10 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_PERCPU_H
+#define _APFS_TEST_LINUX_PERCPU_H
+
+#include "../compat.h"
+
+/* A single copy of each per-cpu variable, shared by all threads */
+#define this_cpu_add(var, n)	__sync_fetch_and_add(&(var), n)
+
+#endif	/* _APFS_TEST_LINUX_PERCPU_H */
@@ -0,0 +1,7 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_PREFETCH_H
+#define _APFS_TEST_LINUX_PREFETCH_H
+
+#define prefetch(x)	__builtin_prefetch(x)
+
+#endif	/* _APFS_TEST_LINUX_PREFETCH_H */
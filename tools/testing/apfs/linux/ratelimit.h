@@ -0,0 +1,10 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_RATELIMIT_H
+#define _APFS_TEST_LINUX_RATELIMIT_H
+
+struct ratelimit_state {
+	int interval;
+	int burst;
+};
+
+#endif	/* _APFS_TEST_LINUX_RATELIMIT_H */
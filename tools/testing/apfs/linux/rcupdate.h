@@ -0,0 +1,25 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_RCUPDATE_H
+#define _APFS_TEST_LINUX_RCUPDATE_H
+
+#include <linux/hashtable.h>
+#include <linux/slab.h>
+
+struct rcu_head {
+	struct rcu_head *next;
+	void (*func)(struct rcu_head *head);
+};
+
+/* Caches are only used by one thread at a time, so there are no readers */
+#define rcu_read_lock()			do { } while (0)
+#define rcu_read_unlock()		do { } while (0)
+#define kfree_rcu(ptr, field)		kfree(ptr)
+#define call_rcu(head, func)		(func)(head)
+#define rcu_barrier()			do { } while (0)
+
+#define hash_add_rcu			hash_add
+#define hash_del_rcu			hash_del
+#define hash_for_each_possible_rcu	hash_for_each_possible
+#define hash_for_each_rcu		hash_for_each
+
+#endif	/* _APFS_TEST_LINUX_RCUPDATE_H */
@@ -0,0 +1,30 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_REFCOUNT_H
+#define _APFS_TEST_LINUX_REFCOUNT_H
+
+#include <stdbool.h>
+
+typedef struct {
+	int refs;
+} refcount_t;
+
+static inline void refcount_set(refcount_t *r, int n)
+{
+	r->refs = n;
+}
+
+static inline bool refcount_inc_not_zero(refcount_t *r)
+{
+	int old = r->refs;
+
+	while (old && !__sync_bool_compare_and_swap(&r->refs, old, old + 1))
+		old = r->refs;
+	return old != 0;
+}
+
+static inline bool refcount_dec_and_test(refcount_t *r)
+{
+	return __sync_sub_and_fetch(&r->refs, 1) == 0;
+}
+
+#endif	/* _APFS_TEST_LINUX_REFCOUNT_H */
@@ -0,0 +1,8 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_SEQ_FILE_H
+#define _APFS_TEST_LINUX_SEQ_FILE_H
+
+/* Nothing is shown in procfs from the harness */
+struct seq_file;
+
+#endif	/* _APFS_TEST_LINUX_SEQ_FILE_H */
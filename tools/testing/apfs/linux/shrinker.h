@@ -0,0 +1,47 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_SHRINKER_H
+#define _APFS_TEST_LINUX_SHRINKER_H
+
+/* There is no memory pressure to react to, so shrinkers are never called */
+struct shrink_control {
+	unsigned long nr_to_scan;
+};
+
+struct shrinker {
+	unsigned long (*count_objects)(struct shrinker *,
+				       struct shrink_control *sc);
+	unsigned long (*scan_objects)(struct shrinker *,
+				      struct shrink_control *sc);
+	int seeks;
+	unsigned int flags;
+};
+
+#define SHRINKER_NUMA_AWARE	(1 << 0)
+#define SHRINKER_MEMCG_AWARE	(1 << 1)
+
+#define DEFAULT_SEEKS	2
+#define SHRINK_EMPTY	(~0UL - 1)
+
+static inline int register_shrinker(struct shrinker *shrinker)
+{
+	return 0;
+}
+
+static inline void unregister_shrinker(struct shrinker *shrinker)
+{
+}
+
+static inline int prealloc_shrinker(struct shrinker *shrinker)
+{
+	return 0;
+}
+
+static inline void register_shrinker_prepared(struct shrinker *shrinker)
+{
+}
+
+static inline void free_prealloced_shrinker(struct shrinker *shrinker)
+{
+}
+
+#endif	/* _APFS_TEST_LINUX_SHRINKER_H */
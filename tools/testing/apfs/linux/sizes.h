@@ -0,0 +1,7 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_SIZES_H
+#define _APFS_TEST_LINUX_SIZES_H
+
+#include "../../../../include/linux/sizes.h"
+
+#endif	/* _APFS_TEST_LINUX_SIZES_H */
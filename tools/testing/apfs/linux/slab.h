@@ -0,0 +1,53 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_SLAB_H
+#define _APFS_TEST_LINUX_SLAB_H
+
+#include <stdlib.h>
+#include <string.h>
+#include "../compat.h"
+
+#define kmalloc(size, gfp)		malloc(size)
+#define kzalloc(size, gfp)		calloc(1, size)
+#define kmalloc_array(n, size, gfp)	malloc((n) * (size))
+#define kcalloc(n, size, gfp)		calloc(n, size)
+#define kvmalloc(size, gfp)		malloc(size)
+#define kvzalloc(size, gfp)		calloc(1, size)
+#define kvmalloc_array(n, size, gfp)	malloc((n) * (size))
+#define kvcalloc(n, size, gfp)		calloc(n, size)
+#define kfree(p)			free((void *)(p))
+#define kvfree(p)			free((void *)(p))
+#define kstrdup(s, gfp)			strdup(s)
+
+#define SLAB_RECLAIM_ACCOUNT	0
+#define SLAB_ACCOUNT		0
+
+/* Only the object size is needed, everything else comes from malloc() */
+struct kmem_cache {
+	unsigned int size;
+};
+
+static inline struct kmem_cache *
+kmem_cache_create(const char *name, unsigned int size, unsigned int align,
+		  unsigned long flags, void (*ctor)(void *))
+{
+	struct kmem_cache *cachep = malloc(sizeof(*cachep));
+
+	if (cachep)
+		cachep->size = size;
+	return cachep;
+}
+
+static inline void kmem_cache_destroy(struct kmem_cache *cachep)
+{
+	free(cachep);
+}
+
+static inline unsigned int kmem_cache_size(struct kmem_cache *cachep)
+{
+	return cachep->size;
+}
+
+#define kmem_cache_alloc(cachep, gfp)	malloc((cachep)->size)
+#define kmem_cache_free(cachep, p)	free(p)
+
+#endif	/* _APFS_TEST_LINUX_SLAB_H */
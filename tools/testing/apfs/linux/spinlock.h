@@ -0,0 +1,14 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_SPINLOCK_H
+#define _APFS_TEST_LINUX_SPINLOCK_H
+
+#include <pthread.h>
+
+/* Like the tools/include version, but without lockdep */
+#define spinlock_t		pthread_mutex_t
+#define spin_lock_init(x)	pthread_mutex_init(x, NULL)
+#define spin_lock(x)		pthread_mutex_lock(x)
+#define spin_unlock(x)		pthread_mutex_unlock(x)
+#define spin_trylock(x)		(!pthread_mutex_trylock(x))
+
+#endif	/* _APFS_TEST_LINUX_SPINLOCK_H */
@@ -0,0 +1,18 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_TRACEPOINT_H
+#define _APFS_TEST_LINUX_TRACEPOINT_H
+
+/* Tracepoints compile to nothing; perf can sample the harness directly */
+#define TP_PROTO(args...)	args
+#define TP_ARGS(args...)	args
+
+#define TRACE_EVENT(name, proto, args, tstruct, assign, print)	\
+	static inline void trace_##name(proto)			\
+	{							\
+	}							\
+	static inline bool trace_##name##_enabled(void)		\
+	{							\
+		return false;					\
+	}
+
+#endif	/* _APFS_TEST_LINUX_TRACEPOINT_H */
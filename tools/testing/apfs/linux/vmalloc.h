@@ -0,0 +1,15 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_VMALLOC_H
+#define _APFS_TEST_LINUX_VMALLOC_H
+
+#include <linux/mm.h>
+
+#define VM_MAP		0
+#define PAGE_KERNEL	0
+
+/* The pages get copied into a buffer of their own, there is no mmu to use */
+extern void *vmap(struct page **pages, unsigned int count,
+		  unsigned long flags, int prot);
+extern void vunmap(const void *addr);
+
+#endif	/* _APFS_TEST_LINUX_VMALLOC_H */
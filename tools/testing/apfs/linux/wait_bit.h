@@ -0,0 +1,9 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_WAIT_BIT_H
+#define _APFS_TEST_LINUX_WAIT_BIT_H
+
+/* Nothing runs in the background, so there is never anyone to wait for */
+#define wait_var_event(var, condition)	do { (void)(var); } while (0)
+#define wake_up_var(var)		do { (void)(var); } while (0)
+
+#endif	/* _APFS_TEST_LINUX_WAIT_BIT_H */
@@ -0,0 +1,33 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+#ifndef _APFS_TEST_LINUX_WORKQUEUE_H
+#define _APFS_TEST_LINUX_WORKQUEUE_H
+
+/* Background work is never started by the harness */
+struct work_struct {
+	unsigned long data;
+};
+
+struct workqueue_struct;
+
+#define WQ_UNBOUND	(1 << 1)
+
+#define INIT_WORK(work, func)	do { (void)(func); } while (0)
+
+static inline bool queue_work(struct workqueue_struct *wq,
+			      struct work_struct *work)
+{
+	return false;
+}
+
+static inline struct workqueue_struct *alloc_workqueue(const char *fmt,
+						       unsigned int flags,
+						       int max_active)
+{
+	return NULL;
+}
+
+static inline void destroy_workqueue(struct workqueue_struct *wq)
+{
+}
+
+#endif	/* _APFS_TEST_LINUX_WORKQUEUE_H */
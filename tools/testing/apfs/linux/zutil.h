@@ -0,0 +1,3 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/* The kernel header is plain C, so it gets used as it is */
+#include "../../../../include/linux/zutil.h"
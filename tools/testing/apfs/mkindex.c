@@ -0,0 +1,251 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ * Build an external catalog index for an apfs image, for the index option
+ *
+ * The whole catalog is walked once, and the location of every inode record,
+ * and of the first directory record for each name hash, goes to a hash table
+ * in the format of fs/apfs/catidx.h.  The index is bound to the container,
+ * the volume and the checkpoint, so it must be built again if the image
+ * changes.  With -c, every entry is then looked up through the index to check
+ * it, and a line of json is printed, as in the selftests.
+ */
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <linux/crc32c.h>
+#include "apfs.h"
+#include "btree.h"
+#include "catidx.h"
+#include "key.h"
+#include "node.h"
+#include "shim.h"
+#include "stats.h"
+#include "super.h"
+
+static struct apfs_catidx_slot *slots;
+static unsigned int bits;
+static u64 nr_slots;
+
+/* Mount being checked with -c, and records found in the right place */
+static struct super_block *check_sb;
+static unsigned long checked;
+
+static void die(const char *msg)
+{
+	perror(msg);
+	exit(1);
+}
+
+/**
+ * add_slot - Add the location of a catalog record to the table
+ * @key:	key of the record
+ * @bno:	leaf that holds the record
+ * @index:	index of the record in the leaf
+ *
+ * Records that share a key with an earlier one are left out.
+ */
+static void add_slot(const struct apfs_key *key, u64 bno, int index)
+{
+	u64 mask = (1ULL << bits) - 1;
+	u64 i = apfs_catidx_hash(key->id, key->type, key->number, bits);
+	struct apfs_catidx_slot *slot;
+
+	for (;; i = (i + 1) & mask) {
+		slot = &slots[i];
+		if (!slot->cs_type)
+			break;
+		if (slot->cs_type == key->type &&
+		    le64_to_cpu(slot->cs_id) == key->id &&
+		    le64_to_cpu(slot->cs_number) == key->number)
+			return;
+	}
+	slot->cs_id = cpu_to_le64(key->id);
+	slot->cs_number = cpu_to_le64(key->number);
+	slot->cs_bno = cpu_to_le64(bno);
+	slot->cs_index = cpu_to_le16(index);
+	slot->cs_type = key->type;
+	nr_slots++;
+}
+
+/**
+ * walk_catalog - Call a function for each indexed record of the catalog
+ * @sb:		superblock structure
+ * @fn:		the function, given the key and the location of the record
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int walk_catalog(struct super_block *sb,
+			void (*fn)(const struct apfs_key *, u64, int))
+{
+	struct apfs_query query;
+	struct apfs_key key = {0}, curr_key;
+	int err;
+
+	apfs_btree_iter_init(&query, APFS_SB(sb)->s_cat_root, &key,
+			     APFS_QUERY_CAT | APFS_QUERY_ANY_ID);
+	err = apfs_btree_iter_seek(sb, &query);
+	while (!err) {
+		err = apfs_node_read_record(&query, &curr_key);
+		if (err)
+			break;
+		if (query.index > U16_MAX)
+			goto next;
+
+		switch (curr_key.type) {
+		case APFS_TYPE_DIR_REC:
+			/* Lookups only go by the hash of the name */
+			curr_key.name = NULL;
+			/* fallthrough */
+		case APFS_TYPE_INODE:
+			fn(&curr_key, query.node->object.block_nr, query.index);
+			break;
+		}
+next:
+		err = apfs_btree_iter_next(sb, &query);
+	}
+	apfs_free_query(sb, &query);
+	return err == -ENODATA ? 0 : err;
+}
+
+static void check_slot(const struct apfs_key *key, u64 bno, int index)
+{
+	struct apfs_key query_key = *key;
+	struct apfs_query query;
+	int err;
+
+	apfs_init_query(&query, APFS_SB(check_sb)->s_cat_root);
+	query.key = &query_key;
+	query.flags |= APFS_QUERY_CAT | APFS_QUERY_EXACT;
+	if (key->type == APFS_TYPE_DIR_REC)
+		query.flags |= APFS_QUERY_ANY_NAME;
+	err = apfs_btree_query(check_sb, &query);
+	if (!err && query.node->object.block_nr == bno && query.index == index)
+		checked++;
+	apfs_free_query(check_sb, &query);
+}
+
+/**
+ * write_index - Write the table to the index file
+ * @sb:		superblock structure
+ * @path:	path to the index file
+ */
+static void write_index(struct super_block *sb, const char *path)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_catidx_header hdr;
+	size_t size = sizeof(*slots) << bits;
+	FILE *file;
+
+	memset(&hdr, 0, sizeof(hdr));
+	memcpy(hdr.ch_magic, APFS_CATIDX_MAGIC, sizeof(hdr.ch_magic));
+	hdr.ch_version = cpu_to_le32(APFS_CATIDX_VERSION);
+	hdr.ch_bits = cpu_to_le32(bits);
+	memcpy(hdr.ch_nx_uuid, sbi->s_msb_raw->nx_uuid, sizeof(hdr.ch_nx_uuid));
+	memcpy(hdr.ch_vol_uuid, sbi->s_vsb_raw->apfs_vol_uuid,
+	       sizeof(hdr.ch_vol_uuid));
+	hdr.ch_xid = cpu_to_le64(sbi->s_xid);
+	hdr.ch_count = cpu_to_le64(nr_slots);
+	hdr.ch_csum = cpu_to_le32(crc32c(~0, slots, size));
+
+	file = fopen(path, "w");
+	if (!file)
+		die(path);
+	if (fwrite(&hdr, sizeof(hdr), 1, file) != 1 ||
+	    fwrite(slots, size, 1, file) != 1)
+		die(path);
+	if (fclose(file))
+		die(path);
+}
+
+static void count_record(const struct apfs_key *key, u64 bno, int index)
+{
+	nr_slots++;
+}
+
+static void usage(const char *prog)
+{
+	fprintf(stderr,
+		"usage: %s [-c] [-v volume] <image> <index>\n"
+		"  -c  look up every record through the new index\n",
+		prog);
+	exit(2);
+}
+
+int main(int argc, char **argv)
+{
+	unsigned int vol_nr = 0;
+	struct apfs_sb_info *sbi;
+	struct super_block *sb;
+	bool check = false;
+	int opt, err;
+
+	while ((opt = getopt(argc, argv, "cv:")) != -1) {
+		switch (opt) {
+		case 'c':
+			check = true;
+			break;
+		case 'v':
+			vol_nr = strtoul(optarg, NULL, 0);
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+	if (optind != argc - 2)
+		usage(argv[0]);
+
+	sb = apfs_test_mount(argv[optind], vol_nr, 0 /* flags */);
+	if (IS_ERR(sb)) {
+		fprintf(stderr, "%s: mount failed (%ld)\n", argv[optind],
+			PTR_ERR(sb));
+		return 1;
+	}
+	sbi = APFS_SB(sb);
+
+	/* Size the table for a load factor of at most one half */
+	err = walk_catalog(sb, count_record);
+	if (err)
+		goto fail;
+	for (bits = 4; (1ULL << bits) < 2 * nr_slots; bits++)
+		;
+	if (bits > APFS_CATIDX_MAX_BITS) {
+		fprintf(stderr, "too many records for an index (%llu)\n",
+			nr_slots);
+		apfs_test_umount(sb);
+		return 1;
+	}
+	slots = calloc(1ULL << bits, sizeof(*slots));
+	if (!slots)
+		die("calloc");
+	nr_slots = 0;
+	err = walk_catalog(sb, add_slot);
+	if (err)
+		goto fail;
+	write_index(sb, argv[optind + 1]);
+
+	if (check) {
+		sbi->s_catidx.slots = slots;
+		sbi->s_catidx.bits = bits;
+		check_sb = sb;
+		/* Only the first record for each key is in the index */
+		err = walk_catalog(sb, check_slot);
+		if (err)
+			goto fail;
+		printf("{\"test\":\"mkindex\",\"records\":%llu,\"bits\":%u,"
+		       "\"checked\":%lu,\"catidx_hits\":%llu}\n",
+		       nr_slots, bits, checked,
+		       sbi->s_stats->count[APFS_STAT_CATIDX_HITS]);
+		sbi->s_catidx.slots = NULL;
+	}
+
+	free(slots);
+	apfs_test_umount(sb);
+	return 0;
+
+fail:
+	fprintf(stderr, "catalog walk failed (%d)\n", err);
+	free(slots);
+	apfs_test_umount(sb);
+	return 1;
+}
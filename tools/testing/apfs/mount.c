@@ -0,0 +1,369 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ * Read-only mount of an apfs image for the test harness
+ *
+ * This follows apfs_fill_super(), but only sets up what the b-tree code needs:
+ * the container and volume superblocks, the roots of the object map and the
+ * catalog, and the node, omap and record caches.
+ */
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <linux/buffer_head.h>
+#include <linux/fs.h>
+#include "apfs.h"
+#include "btree.h"
+#include "message.h"
+#include "node.h"
+#include "object.h"
+#include "shim.h"
+#include "stats.h"
+#include "super.h"
+
+/*
+ * Everything allocated for a mount, to be freed together
+ */
+struct apfs_test_mount {
+	struct super_block sb;
+	struct apfs_sb_info sbi;
+	struct apfs_nxsb_info nxi;
+	struct block_device bdev;
+	struct inode bd_inode;
+	struct address_space mapping;
+	struct apfs_stats stats;
+	struct apfs_superblock vsb;	/* Used if there is no real volume */
+};
+
+/**
+ * apfs_test_alloc - Allocate a mount and set up its caches
+ * @fd:		image file, or -1
+ * @buf:	image in memory, if @fd is -1
+ * @size:	size of the image
+ * @flags:	mount flags for the sb info structure
+ *
+ * Returns the new mount, or NULL in case of failure.
+ */
+static struct apfs_test_mount *apfs_test_alloc(int fd, const void *buf,
+					       size_t size, unsigned int flags)
+{
+	static bool node_cache_ready;
+	struct apfs_test_mount *mnt;
+	struct super_block *sb;
+	struct apfs_sb_info *sbi;
+
+	/* The slab cache for the nodes is shared by all mounts */
+	if (!node_cache_ready) {
+		if (apfs_node_init())
+			return NULL;
+		node_cache_ready = true;
+	}
+
+	mnt = calloc(1, sizeof(*mnt));
+	if (!mnt)
+		return NULL;
+	sb = &mnt->sb;
+	sbi = &mnt->sbi;
+
+	mnt->mapping.fd = fd;
+	mnt->mapping.buf = buf;
+	mnt->mapping.size = size;
+	mnt->bd_inode.i_mapping = &mnt->mapping;
+	mnt->bdev.bd_inode = &mnt->bd_inode;
+	sb->s_bdev = &mnt->bdev;
+	sb->s_fs_info = sbi;
+	snprintf(sb->s_id, sizeof(sb->s_id), "test");
+
+	sbi->s_nxi = &mnt->nxi;
+	sbi->s_vsb_raw = &mnt->vsb;
+	sbi->s_stats = &mnt->stats;
+	sbi->s_flags = flags;
+	sbi->s_omap_cache_size = APFS_OMAP_CACHE_DEFAULT_SIZE;
+	sbi->s_rec_cache_size = APFS_REC_CACHE_DEFAULT_SIZE;
+
+	if (apfs_node_cache_init(sb))
+		goto fail;
+	if (apfs_meta_cache_get(sb))
+		goto fail;
+	apfs_btree_ra_init(sb);
+	return mnt;
+
+fail:
+	apfs_meta_cache_put(sb);
+	free(mnt);
+	return NULL;
+}
+
+/**
+ * apfs_test_read_main_super - Find the latest container superblock
+ * @sb:		superblock structure
+ *
+ * Returns the buffer head for the latest valid checkpoint superblock, or an
+ * error pointer in case of failure.
+ */
+static struct buffer_head *apfs_test_read_main_super(struct super_block *sb)
+{
+	struct apfs_nx_superblock *msb_raw;
+	struct buffer_head *bh, *desc_bh;
+	u64 desc_base, xid;
+	u32 desc_blocks, i;
+
+	if (!sb_set_blocksize(sb, APFS_NX_DEFAULT_BLOCK_SIZE))
+		return ERR_PTR(-EINVAL);
+	bh = sb_bread(sb, APFS_NX_BLOCK_NUM);
+	if (!bh)
+		return ERR_PTR(-EIO);
+	msb_raw = (struct apfs_nx_superblock *)bh->b_data;
+	if (le32_to_cpu(msb_raw->nx_magic) != APFS_NX_MAGIC) {
+		apfs_err(sb, "not an apfs filesystem");
+		goto fail;
+	}
+	if (sb->s_blocksize != le32_to_cpu(msb_raw->nx_block_size)) {
+		if (!sb_set_blocksize(sb, le32_to_cpu(msb_raw->nx_block_size))) {
+			apfs_err(sb, "unsupported block size");
+			goto fail;
+		}
+		brelse(bh);
+		bh = sb_bread(sb, APFS_NX_BLOCK_NUM);
+		if (!bh)
+			return ERR_PTR(-EIO);
+		msb_raw = (struct apfs_nx_superblock *)bh->b_data;
+	}
+	if (!apfs_obj_verify_csum(sb, &msb_raw->nx_o)) {
+		apfs_err(sb, "inconsistent container superblock");
+		brelse(bh);
+		return ERR_PTR(-EFSBADCRC);
+	}
+
+	/* Unlike the kernel, just scan the whole checkpoint area */
+	desc_base = le64_to_cpu(msb_raw->nx_xp_desc_base);
+	desc_blocks = le32_to_cpu(msb_raw->nx_xp_desc_blocks);
+	if (desc_base >> 63 != 0 || desc_blocks > 10000)
+		return bh;
+	xid = le64_to_cpu(msb_raw->nx_o.o_xid);
+	for (i = 0; i < desc_blocks; ++i) {
+		struct apfs_nx_superblock *desc_raw;
+
+		desc_bh = sb_bread(sb, desc_base + i);
+		if (!desc_bh)
+			continue;
+		desc_raw = (struct apfs_nx_superblock *)desc_bh->b_data;
+		if (le32_to_cpu(desc_raw->nx_magic) != APFS_NX_MAGIC ||
+		    le64_to_cpu(desc_raw->nx_o.o_xid) <= xid ||
+		    !apfs_obj_verify_csum(sb, &desc_raw->nx_o)) {
+			brelse(desc_bh);
+			continue;
+		}
+		xid = le64_to_cpu(desc_raw->nx_o.o_xid);
+		brelse(bh);
+		bh = desc_bh;
+	}
+	return bh;
+
+fail:
+	brelse(bh);
+	return ERR_PTR(-EINVAL);
+}
+
+/**
+ * apfs_test_omap_root - Read the root node of an object map
+ * @sb:		superblock structure
+ * @bno:	block number of the object map
+ *
+ * Returns the root node, or an error pointer in case of failure.
+ */
+static struct apfs_node *apfs_test_omap_root(struct super_block *sb, u64 bno)
+{
+	struct apfs_omap_phys *omap_raw;
+	struct buffer_head *bh;
+	u64 root;
+
+	bh = sb_bread(sb, bno);
+	if (!bh)
+		return ERR_PTR(-EIO);
+	omap_raw = (struct apfs_omap_phys *)bh->b_data;
+	if (!apfs_obj_verify_csum(sb, &omap_raw->om_o)) {
+		apfs_err(sb, "bad checksum for object map in block 0x%llx",
+			 bno);
+		brelse(bh);
+		return ERR_PTR(-EFSBADCRC);
+	}
+	root = le64_to_cpu(omap_raw->om_tree_oid);
+	brelse(bh);
+	return apfs_read_node(sb, root);
+}
+
+/**
+ * apfs_test_map_volume - Read the volume superblock and the tree roots
+ * @sb:		superblock structure, with the container superblock read
+ * @vol_nr:	index of the volume in the container
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int apfs_test_map_volume(struct super_block *sb, unsigned int vol_nr)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_nx_superblock *msb_raw = sbi->s_msb_raw;
+	struct apfs_superblock *vsb_raw;
+	struct apfs_node *node;
+	u64 vol_id, vsb;
+	int err;
+
+	if (vol_nr >= APFS_NX_MAX_FILE_SYSTEMS)
+		return -EINVAL;
+	vol_id = le64_to_cpu(msb_raw->nx_fs_oid[vol_nr]);
+	if (!vol_id) {
+		apfs_err(sb, "requested volume does not exist");
+		return -EINVAL;
+	}
+
+	node = apfs_test_omap_root(sb, le64_to_cpu(msb_raw->nx_omap_oid));
+	if (IS_ERR(node))
+		return PTR_ERR(node);
+	err = apfs_omap_lookup_block(sb, node, vol_id, &vsb);
+	apfs_node_put(node);
+	if (err) {
+		apfs_err(sb, "volume not found");
+		return err;
+	}
+
+	err = apfs_object_read(sb, vsb, 1 /* blocks */, &sbi->s_vobject);
+	if (err)
+		return err;
+	vsb_raw = (struct apfs_superblock *)sbi->s_vobject.data;
+	if (le32_to_cpu(vsb_raw->apfs_magic) != APFS_MAGIC ||
+	    !apfs_object_verify_csum(&sbi->s_vobject)) {
+		apfs_err(sb, "bad volume superblock");
+		return -EFSCORRUPTED;
+	}
+	sbi->s_vsb_raw = vsb_raw;
+	apfs_set_case_fold(sbi);
+
+	node = apfs_test_omap_root(sb, le64_to_cpu(vsb_raw->apfs_omap_oid));
+	if (IS_ERR(node))
+		return PTR_ERR(node);
+	sbi->s_omap_root = node;
+
+	node = apfs_omap_read_node(sb, le64_to_cpu(vsb_raw->apfs_root_tree_oid));
+	if (IS_ERR(node))
+		return PTR_ERR(node);
+	sbi->s_cat_root = node;
+	return 0;
+}
+
+/**
+ * apfs_test_mount - Mount a volume of an image file
+ * @path:	path to the image, or to a block device
+ * @vol_nr:	index of the volume in the container
+ * @flags:	mount flags for the sb info structure, like APFS_CHECK_NODES
+ *
+ * Returns the superblock, or an error pointer in case of failure.
+ */
+struct super_block *apfs_test_mount(const char *path, unsigned int vol_nr,
+				    unsigned int flags)
+{
+	struct apfs_test_mount *mnt;
+	struct super_block *sb;
+	struct apfs_sb_info *sbi;
+	struct buffer_head *bh;
+	off_t size;
+	int fd, err;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return ERR_PTR(-errno);
+	size = lseek(fd, 0, SEEK_END);
+	if (size < 0) {
+		close(fd);
+		return ERR_PTR(-errno);
+	}
+
+	mnt = apfs_test_alloc(fd, NULL, size, flags);
+	if (!mnt) {
+		close(fd);
+		return ERR_PTR(-ENOMEM);
+	}
+	sb = &mnt->sb;
+	sbi = &mnt->sbi;
+	snprintf(sb->s_id, sizeof(sb->s_id), "%s", path);
+
+	bh = apfs_test_read_main_super(sb);
+	if (IS_ERR(bh)) {
+		err = PTR_ERR(bh);
+		goto fail;
+	}
+	mnt->nxi.nx_bh = bh;
+	mnt->nxi.nx_raw = (struct apfs_nx_superblock *)bh->b_data;
+	mnt->nxi.nx_xid = le64_to_cpu(mnt->nxi.nx_raw->nx_o.o_xid);
+	mnt->nxi.nx_blocksize = sb->s_blocksize;
+	sbi->s_msb_raw = mnt->nxi.nx_raw;
+	sbi->s_xid = mnt->nxi.nx_xid;
+	sbi->s_blocksize = sb->s_blocksize;
+	sbi->s_blocksize_bits = sb->s_blocksize_bits;
+
+	err = apfs_test_map_volume(sb, vol_nr);
+	if (err)
+		goto fail;
+	return sb;
+
+fail:
+	apfs_test_umount(sb);
+	return ERR_PTR(err);
+}
+
+/**
+ * apfs_test_mount_mem - Set up a mount for an image in memory
+ * @buf:	the image
+ * @size:	size of the image
+ * @blocksize:	block size to use
+ * @flags:	mount flags for the sb info structure
+ *
+ * No superblocks are read: the caller must set the tree roots it wants to
+ * query, and may set the case sensitivity of the mount.
+ * Every transaction is considered complete, so all object versions are seen.
+ * Returns the superblock, or an error pointer in case of failure.
+ */
+struct super_block *apfs_test_mount_mem(const void *buf, size_t size,
+					unsigned int blocksize,
+					unsigned int flags)
+{
+	struct apfs_test_mount *mnt;
+	struct super_block *sb;
+
+	mnt = apfs_test_alloc(-1, buf, size, flags);
+	if (!mnt)
+		return ERR_PTR(-ENOMEM);
+	sb = &mnt->sb;
+	if (!sb_set_blocksize(sb, blocksize)) {
+		apfs_test_umount(sb);
+		return ERR_PTR(-EINVAL);
+	}
+	mnt->sbi.s_blocksize = sb->s_blocksize;
+	mnt->sbi.s_blocksize_bits = sb->s_blocksize_bits;
+	mnt->nxi.nx_blocksize = sb->s_blocksize;
+	mnt->sbi.s_xid = U64_MAX;
+	return sb;
+}
+
+/**
+ * apfs_test_umount - Release a mount
+ * @sb:		superblock structure
+ */
+void apfs_test_umount(struct super_block *sb)
+{
+	struct apfs_test_mount *mnt =
+		container_of(sb, struct apfs_test_mount, sb);
+	struct apfs_sb_info *sbi = &mnt->sbi;
+
+	if (sbi->s_cat_root)
+		apfs_node_put(sbi->s_cat_root);
+	if (sbi->s_omap_root)
+		apfs_node_put(sbi->s_omap_root);
+	apfs_node_cache_destroy(sb);
+	apfs_meta_cache_put(sb);
+	apfs_object_release(&sbi->s_vobject);
+	brelse(mnt->nxi.nx_bh);
+	if (mnt->mapping.fd >= 0)
+		close(mnt->mapping.fd);
+	free(mnt);
+}
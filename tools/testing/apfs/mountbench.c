@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ * Mount the same apfs image many times over, and keep all the mounts alive
+ *
+ * This is meant to model a host that serves hundreds of images at once: the
+ * result is the time taken by each mount and the heap held by an idle one,
+ * which is mostly the caches of the b-tree code.  Each mount may optionally
+ * replay a few lookups of the root directory before the next one starts.  The
+ * result goes to stdout as a line of json, as in the selftests.
+ */
+#include <getopt.h>
+#include <malloc.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "apfs.h"
+#include "btree.h"
+#include "inode.h"
+#include "key.h"
+#include "node.h"
+#include "shim.h"
+#include "super.h"
+
+static u64 now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (u64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static size_t heap_bytes(void)
+{
+	struct mallinfo2 mi = mallinfo2();
+
+	return mi.uordblks + mi.hblkhd;
+}
+
+/**
+ * touch_root - Look up the inode of the root directory, a few times
+ * @sb:		the mount
+ * @lookups:	number of lookups
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int touch_root(struct super_block *sb, unsigned long lookups)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	unsigned long i;
+	int err = 0;
+
+	for (i = 0; i < lookups && !err; i++) {
+		struct apfs_query query;
+		struct apfs_key key;
+
+		apfs_init_inode_key(APFS_ROOT_DIR_INO_NUM, &key);
+		apfs_init_query(&query, sbi->s_cat_root);
+		query.key = &key;
+		query.flags = APFS_QUERY_CAT | APFS_QUERY_EXACT;
+		err = apfs_btree_query(sb, &query);
+		apfs_free_query(sb, &query);
+	}
+	return err;
+}
+
+static void usage(const char *prog)
+{
+	fprintf(stderr,
+		"usage: %s [-l lookups] [-n mounts] [-v volume] <image>\n"
+		"  -l  look up the root directory this many times per mount\n"
+		"  -n  number of mounts to keep alive at once (default: 500)\n",
+		prog);
+	exit(2);
+}
+
+int main(int argc, char **argv)
+{
+	unsigned long nr_mounts = 500, lookups = 0, i;
+	unsigned int vol_nr = 0;
+	struct super_block **sbs;
+	size_t heap_start, heap;
+	bool failed = false;
+	u64 start, ns;
+	int opt, err;
+
+	while ((opt = getopt(argc, argv, "l:n:v:")) != -1) {
+		switch (opt) {
+		case 'l':
+			lookups = strtoul(optarg, NULL, 0);
+			break;
+		case 'n':
+			nr_mounts = strtoul(optarg, NULL, 0);
+			break;
+		case 'v':
+			vol_nr = strtoul(optarg, NULL, 0);
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+	if (optind != argc - 1 || !nr_mounts)
+		usage(argv[0]);
+
+	sbs = calloc(nr_mounts, sizeof(*sbs));
+	if (!sbs) {
+		perror("calloc");
+		return 1;
+	}
+
+	heap_start = heap_bytes();
+	start = now_ns();
+	for (i = 0; i < nr_mounts; i++) {
+		sbs[i] = apfs_test_mount(argv[optind], vol_nr, 0 /* flags */);
+		if (IS_ERR(sbs[i])) {
+			fprintf(stderr, "%s: mount %lu failed (%ld)\n",
+				argv[optind], i, PTR_ERR(sbs[i]));
+			failed = true;
+			break;
+		}
+		err = touch_root(sbs[i], lookups);
+		if (err) {
+			fprintf(stderr, "root lookup failed (%d)\n", err);
+			apfs_test_umount(sbs[i]);
+			failed = true;
+			break;
+		}
+	}
+	ns = now_ns() - start;
+	heap = heap_bytes() - heap_start;
+
+	if (!failed)
+		printf("{\"test\":\"mountbench\",\"mounts\":%lu,\"ns\":%llu,"
+		       "\"ns_per_mount\":%.1f,\"heap_bytes\":%zu,"
+		       "\"heap_per_mount\":%zu}\n",
+		       nr_mounts, ns, (double)ns / nr_mounts, heap,
+		       heap / nr_mounts);
+
+	nr_mounts = i;
+	for (i = 0; i < nr_mounts; i++)
+		apfs_test_umount(sbs[i]);
+	free(sbs);
+	return failed ? 1 : 0;
+}
@@ -0,0 +1,452 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ * Replay a trace of catalog and object map lookups against an apfs image
+ *
+ * Each line of the trace is a single lookup:
+ *
+ *	inode <ino>		inode record
+ *	lookup <parent> <name>	directory entry, by name
+ *	xattr <ino> <name>	extended attribute, by name
+ *	extent <id> <offset>	file extent that covers a logical offset
+ *	readdir <ino>		every directory entry of a directory
+ *	read <ino> <offset>	file extent of an inode, for a read
+ *	omap <oid>		object map translation
+ *
+ * Numbers may be given in decimal or in hex.  A trace covering every record
+ * of the catalog, in key order, can be generated with -g; shuffle it to get
+ * random lookups.  Traces of a real workload can be captured from a kernel
+ * mount with apfs_capture.sh, in the apfs selftests.  The whole trace is
+ * replayed the requested number of times by each thread, and the result goes
+ * to stdout as a line of json, as in the selftests.  Each thread works on a
+ * mount of its own, since the caches of the harness are not thread safe.
+ */
+#include <getopt.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "apfs.h"
+#include "btree.h"
+#include "key.h"
+#include "node.h"
+#include "shim.h"
+#include "stats.h"
+#include "super.h"
+
+enum replay_op {
+	REPLAY_INODE,
+	REPLAY_LOOKUP,
+	REPLAY_XATTR,
+	REPLAY_EXTENT,
+	REPLAY_READDIR,
+	REPLAY_READ,
+	REPLAY_OMAP,
+};
+
+static const char * const replay_op_names[] = {
+	[REPLAY_INODE]		= "inode",
+	[REPLAY_LOOKUP]		= "lookup",
+	[REPLAY_XATTR]		= "xattr",
+	[REPLAY_EXTENT]		= "extent",
+	[REPLAY_READDIR]	= "readdir",
+	[REPLAY_READ]		= "read",
+	[REPLAY_OMAP]		= "omap",
+};
+
+struct replay_entry {
+	enum replay_op op;
+	u64 id;
+	u64 number;
+	char *name;
+};
+
+static struct replay_entry *entries;
+static size_t nr_entries;
+
+/*
+ * Work for a single thread
+ */
+struct replay_thread {
+	pthread_t thread;
+	struct super_block *sb;		/* Mount for this thread alone */
+	unsigned long passes;		/* Times to replay the whole trace */
+	unsigned long found;		/* Lookups that found a record */
+	unsigned long missing;		/* Lookups that found nothing */
+	int err;			/* First error, or 0 */
+};
+
+static void die(const char *msg)
+{
+	perror(msg);
+	exit(1);
+}
+
+static u64 now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (u64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void read_trace(const char *path)
+{
+	size_t alloc = 0, lineno = 0, len = 0;
+	char *line = NULL;
+	FILE *file;
+
+	file = strcmp(path, "-") ? fopen(path, "r") : stdin;
+	if (!file)
+		die(path);
+
+	while (getline(&line, &len, file) > 0) {
+		struct replay_entry *entry;
+		char *op, *arg, *end;
+		unsigned int i;
+
+		lineno++;
+		line[strcspn(line, "\n")] = 0;
+		op = strtok(line, " ");
+		if (!op || *op == '#')
+			continue;
+
+		if (nr_entries == alloc) {
+			alloc = alloc ? alloc * 2 : 4096;
+			entries = realloc(entries, alloc * sizeof(*entries));
+			if (!entries)
+				die("realloc");
+		}
+		entry = &entries[nr_entries];
+		memset(entry, 0, sizeof(*entry));
+
+		for (i = 0; i < ARRAY_SIZE(replay_op_names); ++i)
+			if (!strcmp(op, replay_op_names[i]))
+				break;
+		if (i == ARRAY_SIZE(replay_op_names))
+			goto bad;
+		entry->op = i;
+
+		arg = strtok(NULL, " ");
+		if (!arg)
+			goto bad;
+		entry->id = strtoull(arg, &end, 0);
+		if (*end)
+			goto bad;
+
+		/* The name is the rest of the line, spaces and all */
+		arg = strtok(NULL, "");
+		switch (entry->op) {
+		case REPLAY_LOOKUP:
+		case REPLAY_XATTR:
+			if (!arg)
+				goto bad;
+			entry->name = strdup(arg);
+			if (!entry->name)
+				die("strdup");
+			break;
+		case REPLAY_EXTENT:
+		case REPLAY_READ:
+			if (!arg)
+				goto bad;
+			entry->number = strtoull(arg, &end, 0);
+			if (*end)
+				goto bad;
+			break;
+		default:
+			if (arg)
+				goto bad;
+			break;
+		}
+		nr_entries++;
+		continue;
+bad:
+		fprintf(stderr, "%s:%zu: bad trace line\n", path, lineno);
+		exit(2);
+	}
+	free(line);
+	if (file != stdin)
+		fclose(file);
+}
+
+static int replay_query(struct super_block *sb, struct apfs_key *key,
+			unsigned int flags)
+{
+	struct apfs_query query;
+	int err;
+
+	apfs_init_query(&query, APFS_SB(sb)->s_cat_root);
+	query.key = key;
+	query.flags |= flags;
+	err = apfs_btree_query(sb, &query);
+	apfs_free_query(sb, &query);
+	return err;
+}
+
+static int replay_extent(struct super_block *sb, struct replay_entry *entry)
+{
+	struct apfs_key key, curr_key;
+	struct apfs_query query;
+	int err;
+
+	apfs_init_file_extent_key(entry->id, entry->number, &key);
+	apfs_init_query(&query, APFS_SB(sb)->s_cat_root);
+	query.key = &key;
+	query.flags = APFS_QUERY_CAT;
+	err = apfs_btree_query(sb, &query);
+	if (!err)
+		err = apfs_node_read_record(&query, &curr_key);
+	if (!err && (curr_key.id != key.id || curr_key.type != key.type))
+		err = -ENODATA;
+	apfs_free_query(sb, &query);
+	return err;
+}
+
+static int replay_readdir(struct super_block *sb, struct replay_entry *entry)
+{
+	struct apfs_query query;
+	struct apfs_key key;
+	int err;
+
+	apfs_init_drec_hashed_key(sb, entry->id, NULL /* name */, &key);
+	apfs_btree_iter_init(&query, APFS_SB(sb)->s_cat_root, &key,
+			     APFS_QUERY_CAT | APFS_QUERY_MULTIPLE);
+	err = apfs_btree_iter_seek(sb, &query);
+	while (!err)
+		err = apfs_btree_iter_next(sb, &query);
+	apfs_free_query(sb, &query);
+	return err == -ENODATA ? 0 : err;
+}
+
+static int replay_one(struct super_block *sb, struct replay_entry *entry)
+{
+	struct apfs_sb_info *sbi = APFS_SB(sb);
+	struct apfs_key key;
+	u64 bno;
+
+	switch (entry->op) {
+	case REPLAY_INODE:
+		apfs_init_inode_key(entry->id, &key);
+		return replay_query(sb, &key, APFS_QUERY_CAT | APFS_QUERY_EXACT);
+	case REPLAY_LOOKUP:
+		apfs_init_drec_hashed_key(sb, entry->id, entry->name, &key);
+		return replay_query(sb, &key, APFS_QUERY_CAT | APFS_QUERY_EXACT);
+	case REPLAY_XATTR:
+		apfs_init_xattr_key(entry->id, entry->name, &key);
+		return replay_query(sb, &key, APFS_QUERY_CAT | APFS_QUERY_EXACT);
+	case REPLAY_EXTENT:
+	case REPLAY_READ:
+		/* Reads come by inode, which is the dstream id but for clones */
+		return replay_extent(sb, entry);
+	case REPLAY_READDIR:
+		return replay_readdir(sb, entry);
+	case REPLAY_OMAP:
+		return apfs_omap_lookup_block(sb, sbi->s_omap_root, entry->id,
+					      &bno);
+	}
+	return -EINVAL;
+}
+
+/**
+ * generate_trace - Print a trace line for every record in the catalog
+ * @sb:		superblock structure
+ *
+ * Returns 0 on success, or a negative error code in case of failure.
+ */
+static int generate_trace(struct super_block *sb)
+{
+	struct apfs_query query;
+	struct apfs_key key = {0}, curr_key;
+	u64 last_dir = 0;
+	int err;
+
+	apfs_btree_iter_init(&query, APFS_SB(sb)->s_cat_root, &key,
+			     APFS_QUERY_CAT | APFS_QUERY_ANY_ID);
+	err = apfs_btree_iter_seek(sb, &query);
+	while (!err) {
+		err = apfs_node_read_record(&query, &curr_key);
+		if (err)
+			break;
+
+		switch (curr_key.type) {
+		case APFS_TYPE_INODE:
+			printf("inode %#llx\n", curr_key.id);
+			break;
+		case APFS_TYPE_DIR_REC:
+			if (curr_key.id != last_dir)
+				printf("readdir %#llx\n", curr_key.id);
+			last_dir = curr_key.id;
+			/* Names can't hold a newline in the trace format */
+			if (!strchr(curr_key.name, '\n'))
+				printf("lookup %#llx %s\n", curr_key.id,
+				       curr_key.name);
+			break;
+		case APFS_TYPE_XATTR:
+			if (!strchr(curr_key.name, '\n'))
+				printf("xattr %#llx %s\n", curr_key.id,
+				       curr_key.name);
+			break;
+		case APFS_TYPE_FILE_EXTENT:
+			printf("extent %#llx %#llx\n", curr_key.id,
+			       curr_key.number);
+			break;
+		}
+		err = apfs_btree_iter_next(sb, &query);
+	}
+	apfs_free_query(sb, &query);
+	return err == -ENODATA ? 0 : err;
+}
+
+/**
+ * replay_thread - Replay the whole trace on the mount of a thread
+ * @arg:	the thread
+ */
+static void *replay_thread(void *arg)
+{
+	struct replay_thread *rt = arg;
+	unsigned long pass;
+	size_t i;
+	int err;
+
+	for (pass = 0; pass < rt->passes; ++pass) {
+		for (i = 0; i < nr_entries; ++i) {
+			err = replay_one(rt->sb, &entries[i]);
+			if (!err) {
+				rt->found++;
+			} else if (err == -ENODATA) {
+				rt->missing++;
+			} else {
+				fprintf(stderr, "%s %#llx failed (%d)\n",
+					replay_op_names[entries[i].op],
+					entries[i].id, err);
+				rt->err = err;
+				return NULL;
+			}
+		}
+	}
+	return NULL;
+}
+
+static void usage(const char *prog)
+{
+	fprintf(stderr,
+		"usage: %s [-c] [-j threads] [-n passes] [-v volume] <image> "
+		"<trace>\n"
+		"       %s -g [-v volume] <image>\n"
+		"  -c  verify the checksum of every node read\n"
+		"  -g  print a trace that covers the whole catalog\n"
+		"  -j  replay the trace in that many threads at once\n",
+		prog, prog);
+	exit(2);
+}
+
+int main(int argc, char **argv)
+{
+	unsigned long passes = 1, found = 0, missing = 0;
+	unsigned int vol_nr = 0, flags = 0, nr_threads = 1, t;
+	u64 count[APFS_NR_STATS] = {0};
+	struct replay_thread *threads;
+	struct super_block *sb;
+	bool generate = false;
+	u64 start, ns, ops;
+	int opt, err = 0;
+
+	while ((opt = getopt(argc, argv, "cgj:n:v:")) != -1) {
+		switch (opt) {
+		case 'c':
+			flags |= APFS_CHECK_NODES;
+			break;
+		case 'g':
+			generate = true;
+			break;
+		case 'j':
+			nr_threads = strtoul(optarg, NULL, 0);
+			break;
+		case 'n':
+			passes = strtoul(optarg, NULL, 0);
+			break;
+		case 'v':
+			vol_nr = strtoul(optarg, NULL, 0);
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+	if (optind != argc - (generate ? 1 : 2) || !nr_threads)
+		usage(argv[0]);
+
+	if (generate) {
+		sb = apfs_test_mount(argv[optind], vol_nr, flags);
+		if (IS_ERR(sb)) {
+			fprintf(stderr, "%s: mount failed (%ld)\n",
+				argv[optind], PTR_ERR(sb));
+			return 1;
+		}
+		err = generate_trace(sb);
+		if (err)
+			fprintf(stderr, "catalog walk failed (%d)\n", err);
+		apfs_test_umount(sb);
+		return err ? 1 : 0;
+	}
+
+	read_trace(argv[optind + 1]);
+
+	/* The mounts are set up here, the harness code is not thread-safe */
+	threads = calloc(nr_threads, sizeof(*threads));
+	if (!threads)
+		die("calloc");
+	for (t = 0; t < nr_threads; t++) {
+		threads[t].sb = apfs_test_mount(argv[optind], vol_nr, flags);
+		if (IS_ERR(threads[t].sb)) {
+			fprintf(stderr, "%s: mount failed (%ld)\n",
+				argv[optind], PTR_ERR(threads[t].sb));
+			return 1;
+		}
+		threads[t].passes = passes;
+	}
+
+	start = now_ns();
+	for (t = 0; t < nr_threads; t++) {
+		if (pthread_create(&threads[t].thread, NULL, replay_thread,
+				   &threads[t])) {
+			fprintf(stderr, "unable to start thread %u\n", t);
+			return 1;
+		}
+	}
+	for (t = 0; t < nr_threads; t++)
+		pthread_join(threads[t].thread, NULL);
+	ns = now_ns() - start;
+
+	for (t = 0; t < nr_threads; t++) {
+		struct apfs_sb_info *sbi = APFS_SB(threads[t].sb);
+		unsigned int i;
+
+		found += threads[t].found;
+		missing += threads[t].missing;
+		if (!err)
+			err = threads[t].err;
+		for (i = 0; i < APFS_NR_STATS; i++)
+			count[i] += sbi->s_stats->count[i];
+		apfs_test_umount(threads[t].sb);
+	}
+	free(threads);
+	if (err)
+		return 1;
+
+	ops = (u64)nr_entries * passes * nr_threads;
+	printf("{\"test\":\"replay\",\"threads\":%u,\"ops\":%llu,\"ns\":%llu,"
+	       "\"ns_per_op\":%.1f,"
+	       "\"found\":%lu,\"missing\":%lu,\"node_reads\":%llu,"
+	       "\"node_cache_hits\":%llu,\"omap_cache_hits\":%llu,"
+	       "\"rec_cache_hits\":%llu,\"finger_hits\":%llu,"
+	       "\"descents\":%llu,\"meta_bytes\":%llu}\n",
+	       nr_threads, ops, ns, ops ? (double)ns / ops : 0.0,
+	       found, missing, count[APFS_STAT_NODE_READS],
+	       count[APFS_STAT_NODE_CACHE_HITS],
+	       count[APFS_STAT_OMAP_CACHE_HITS],
+	       count[APFS_STAT_REC_CACHE_HITS],
+	       count[APFS_STAT_FINGER_HITS],
+	       count[APFS_STAT_DESCENTS],
+	       count[APFS_STAT_META_BYTES]);
+	return 0;
+}
@@ -0,0 +1,268 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ * Userspace versions of the kernel functions used by the apfs b-tree code
+ *
+ * Blocks are read from the image on every request, without any caching, so
+ * the node cache and the other caches of the filesystem are the only ones in
+ * play.  That makes the harness a good place to measure them.
+ */
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <linux/buffer_head.h>
+#include <linux/crc32c.h>
+#include <linux/fs.h>
+#include <linux/mm.h>
+#include <linux/nls.h>
+#include <linux/pagemap.h>
+#include <linux/vmalloc.h>
+#include "crypto.h"
+#include "message.h"
+#include "shim.h"
+#include "specio.h"
+
+bool apfs_test_quiet;
+
+void apfs_msg(struct super_block *sb, const char *prefix, const char *fmt, ...)
+{
+	va_list args;
+
+	if (apfs_test_quiet)
+		return;
+
+	/* There is no log, so the level in @prefix is ignored */
+	fprintf(stderr, "APFS (%s): ", sb->s_id);
+	va_start(args, fmt);
+	vfprintf(stderr, fmt, args);
+	va_end(args);
+	fputc('\n', stderr);
+}
+
+/**
+ * apfs_test_read - Read part of the image
+ * @mapping:	the image
+ * @buf:	buffer for the data
+ * @len:	number of bytes to read
+ * @off:	offset of the data in the image
+ *
+ * Reads past the end of the image fail, like they would on a block device,
+ * except for the last partial page, which gets padded with zeroes.  Returns
+ * 0 on success or -EIO in case of failure.
+ */
+int apfs_test_read(struct address_space *mapping, void *buf, size_t len,
+		   u64 off)
+{
+	size_t avail;
+
+	if (off >= mapping->size)
+		return -EIO;
+	avail = min_t(u64, len, mapping->size - off);
+	memset(buf + avail, 0, len - avail);
+
+	if (mapping->fd < 0) {
+		memcpy(buf, mapping->buf + off, avail);
+		return 0;
+	}
+	while (avail) {
+		ssize_t ret = pread(mapping->fd, buf, avail, off);
+
+		if (ret <= 0)
+			return -EIO;
+		buf += ret;
+		off += ret;
+		avail -= ret;
+	}
+	return 0;
+}
+
+int sb_set_blocksize(struct super_block *sb, int size)
+{
+	if (size < 512 || size > PAGE_SIZE || (size & (size - 1)))
+		return 0;
+	sb->s_blocksize = size;
+	sb->s_blocksize_bits = ilog2(size);
+	return size;
+}
+
+struct buffer_head *sb_bread(struct super_block *sb, sector_t block)
+{
+	struct address_space *mapping = sb->s_bdev->bd_inode->i_mapping;
+	struct buffer_head *bh;
+
+	bh = malloc(sizeof(*bh));
+	if (!bh)
+		return NULL;
+	bh->b_size = sb->s_blocksize;
+	bh->b_blocknr = block;
+	bh->b_data = malloc(bh->b_size);
+	if (!bh->b_data)
+		goto fail;
+	if (apfs_test_read(mapping, bh->b_data, bh->b_size,
+			   block << sb->s_blocksize_bits))
+		goto fail;
+	return bh;
+
+fail:
+	free(bh->b_data);
+	free(bh);
+	return NULL;
+}
+
+void brelse(struct buffer_head *bh)
+{
+	if (!bh)
+		return;
+	free(bh->b_data);
+	free(bh);
+}
+
+struct page *read_mapping_page(struct address_space *mapping, pgoff_t index,
+			       struct file *file)
+{
+	struct page *page;
+	int err = -ENOMEM;
+
+	page = calloc(1, sizeof(*page));
+	if (!page)
+		return ERR_PTR(-ENOMEM);
+	page->count = 1;
+	page->addr = aligned_alloc(PAGE_SIZE, PAGE_SIZE);
+	if (!page->addr)
+		goto fail;
+	err = apfs_test_read(mapping, page->addr, PAGE_SIZE,
+			     (u64)index << PAGE_SHIFT);
+	if (err)
+		goto fail;
+	return page;
+
+fail:
+	free(page->addr);
+	free(page);
+	return ERR_PTR(err);
+}
+
+void put_page(struct page *page)
+{
+	if (--page->count)
+		return;
+	free(page->addr);
+	free(page);
+}
+
+void *vmap(struct page **pages, unsigned int count, unsigned long flags,
+	   int prot)
+{
+	char *addr;
+	unsigned int i;
+
+	addr = aligned_alloc(PAGE_SIZE, count * PAGE_SIZE);
+	if (!addr)
+		return NULL;
+	for (i = 0; i < count; ++i)
+		memcpy(addr + i * PAGE_SIZE, pages[i]->addr, PAGE_SIZE);
+	return addr;
+}
+
+void vunmap(const void *addr)
+{
+	free((void *)addr);
+}
+
+static u32 crc32c_table[256];
+static pthread_once_t crc32c_once = PTHREAD_ONCE_INIT;
+
+/* Reflected Castagnoli polynomial, with no inversions, as in lib/libcrc32c */
+static void crc32c_init(void)
+{
+	unsigned int i, j;
+
+	for (i = 0; i < 256; ++i) {
+		u32 c = i;
+
+		for (j = 0; j < 8; ++j)
+			c = (c >> 1) ^ (c & 1 ? 0x82f63b78 : 0);
+		crc32c_table[i] = c;
+	}
+}
+
+/* The checker calls this from several threads at once */
+u32 crc32c(u32 crc, const void *address, unsigned int length)
+{
+	const u32 *table = crc32c_table;
+	const u8 *p = address;
+
+	pthread_once(&crc32c_once, crc32c_init);
+	while (length--)
+		crc = table[(crc ^ *p++) & 0xff] ^ (crc >> 8);
+	return crc;
+}
+
+/*
+ * Same as in fs/nls/nls_base.c
+ */
+struct utf8_table {
+	int cmask;
+	int cval;
+	int shift;
+	long lmask;
+	long lval;
+};
+
+static const struct utf8_table utf8_table[] = {
+	{0x80,  0x00,   0*6,    0x7F,           0,         /* 1 byte sequence */},
+	{0xE0,  0xC0,   1*6,    0x7FF,          0x80,      /* 2 byte sequence */},
+	{0xF0,  0xE0,   2*6,    0xFFFF,         0x800,     /* 3 byte sequence */},
+	{0xF8,  0xF0,   3*6,    0x1FFFFF,       0x10000,   /* 4 byte sequence */},
+	{0xFC,  0xF8,   4*6,    0x3FFFFFF,      0x200000,  /* 5 byte sequence */},
+	{0xFE,  0xFC,   5*6,    0x7FFFFFFF,     0x4000000, /* 6 byte sequence */},
+	{0,						   /* end of table    */}
+};
+
+#define UNICODE_MAX	0x0010ffff
+#define SURROGATE_MASK	0xfffff800
+#define SURROGATE_PAIR	0x0000d800
+
+int utf8_to_utf32(const u8 *s, int inlen, unicode_t *pu)
+{
+	unsigned long l;
+	int c0, c, nc;
+	const struct utf8_table *t;
+
+	nc = 0;
+	c0 = *s;
+	l = c0;
+	for (t = utf8_table; t->cmask; t++) {
+		nc++;
+		if ((c0 & t->cmask) == t->cval) {
+			l &= t->lmask;
+			if (l < t->lval || l > UNICODE_MAX ||
+			    (l & SURROGATE_MASK) == SURROGATE_PAIR)
+				return -1;
+			*pu = (unicode_t) l;
+			return nc;
+		}
+		if (inlen <= nc)
+			return -1;
+		s++;
+		c = (*s ^ 0x80) & 0xFF;
+		if (c & 0xC0)
+			return -1;
+		l = (l << 6) | c;
+	}
+	return -1;
+}
+
+/* The test images are never encrypted, so s_tfm is always NULL */
+int apfs_crypt_node(struct super_block *sb, struct apfs_object *obj)
+{
+	return -EOPNOTSUPP;
+}
+
+/* Buffers are never read ahead, see sb_getblk() */
+void apfs_spec_submit_bh(struct super_block *sb, int op_flags,
+			 struct buffer_head *bh)
+{
+}
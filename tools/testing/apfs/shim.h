@@ -0,0 +1,26 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ * Interface of the apfs test harness
+ */
+#ifndef _APFS_TEST_SHIM_H
+#define _APFS_TEST_SHIM_H
+
+#include <linux/fs.h>
+
+struct address_space;
+
+/* Set to silence the messages from the filesystem, as the fuzzer does */
+extern bool apfs_test_quiet;
+
+extern int apfs_test_read(struct address_space *mapping, void *buf,
+			  size_t len, u64 off);
+
+extern struct super_block *apfs_test_mount(const char *path,
+					   unsigned int vol_nr,
+					   unsigned int flags);
+extern struct super_block *apfs_test_mount_mem(const void *buf, size_t size,
+					       unsigned int blocksize,
+					       unsigned int flags);
+extern void apfs_test_umount(struct super_block *sb);
+
+#endif	/* _APFS_TEST_SHIM_H */
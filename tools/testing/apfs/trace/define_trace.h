@@ -0,0 +1,2 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/* The tracepoint shims need no second pass over the trace header */
@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ * Checks of the filename normalization code
+ *
+ * Every name below is normalized one character at a time with the cursor,
+ * the way that lookups hash and compare names, and all at once into a buffer,
+ * the way the collision checks do; both must give the same characters, and
+ * the same hash.  Some of the names also have their expected normalization
+ * spelled out.  An alarm turns any loop that never ends into a failure.
+ */
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "apfs.h"
+#include "key.h"
+#include "super.h"
+#include "unicode.h"
+
+#define UNITEST_MAX_CHARS	256
+#define UNITEST_TIMEOUT		5
+
+struct unitest_case {
+	const char *name;
+	bool case_fold;
+	unicode_t expect[8];	/* Normalization, if given; null-terminated */
+};
+
+static const struct unitest_case unitest_cases[] = {
+	{ "README", false, { 'R', 'E', 'A', 'D', 'M', 'E' } },
+	{ "README", true, { 'r', 'e', 'a', 'd', 'm', 'e' } },
+	{ "Caf\xc3\xa9", true, { 'c', 'a', 'f', 'e', 0x0301 } },
+	{ "Cafe\xcc\x81", false, { 'C', 'a', 'f', 'e', 0x0301 } },
+	/* U+1FB4: the ypogegrammeni folds to an iota, a starter */
+	{ "\xe1\xbe\xb4", false, { 0x03b1, 0x0301, 0x0345 } },
+	{ "\xe1\xbe\xb4", true, { 0x03b1, 0x0301, 0x03b9 } },
+	/* U+1F84: the same, after two accents */
+	{ "\xe1\xbe\x84", false, { 0x03b1, 0x0313, 0x0301, 0x0345 } },
+	{ "\xe1\xbe\x84", true, { 0x03b1, 0x0313, 0x0301, 0x03b9 } },
+	{ "\xe1\xbe\xb4\xe1\xbe\x84", true },
+	{ "x\xe1\xbe\xb4y\xe1\xbe\x84z", true },
+	{ "\xe1\xbe\x84\xcc\x81\xcd\x85", true },
+	{ "\xe1\xbe\xb4" "abcdefghijklmnop", true },
+	{ "\xc3\x9f", true },
+	{ "\xed\x95\x9c\xea\xb5\xad\xec\x96\xb4", true },
+	{ "\xf0\x9f\x93\xb7 Photos", true },
+	{ "bad \xff utf-8", true },
+};
+
+static struct apfs_sb_info unitest_sbi;
+static struct super_block unitest_sb = { .s_fs_info = &unitest_sbi };
+
+static void unitest_timeout(int sig)
+{
+	fprintf(stderr, "FAIL: the normalization never ended\n");
+	_exit(1);
+}
+
+static int unitest_run(int nr, const struct unitest_case *test)
+{
+	struct super_block *sb = &unitest_sb;
+	unicode_t chars[UNITEST_MAX_CHARS];
+	struct apfs_unicursor cursor;
+	struct apfs_nname nname;
+	unsigned int len = 0, i;
+	unicode_t uni;
+	int ret = 0;
+
+	unitest_sbi.s_case_fold = test->case_fold;
+
+	apfs_init_unicursor(&cursor, test->name);
+	while ((uni = apfs_normalize_next(&cursor, test->case_fold))) {
+		if (len == UNITEST_MAX_CHARS) {
+			fprintf(stderr, "FAIL %d: too many characters\n", nr);
+			return 1;
+		}
+		chars[len++] = uni;
+	}
+
+	if (test->expect[0]) {
+		for (i = 0; test->expect[i] && i < len; i++)
+			if (chars[i] != test->expect[i])
+				break;
+		if (i != len || test->expect[i]) {
+			fprintf(stderr, "FAIL %d: bad normalization\n", nr);
+			ret = 1;
+		}
+	}
+
+	if (apfs_normalize_name(test->name, test->case_fold, &nname)) {
+		fprintf(stderr, "FAIL %d: out of memory\n", nr);
+		return 1;
+	}
+	if (nname.len != len ||
+	    memcmp(nname.chars, chars, len * sizeof(*chars))) {
+		fprintf(stderr, "FAIL %d: cursor and buffer disagree\n", nr);
+		ret = 1;
+	}
+	if (apfs_filename_hash(sb, test->name) != apfs_nname_hash(&nname)) {
+		fprintf(stderr, "FAIL %d: bad hash\n", nr);
+		ret = 1;
+	}
+	if (apfs_filename_cmp(sb, test->name, test->name)) {
+		fprintf(stderr, "FAIL %d: name differs from itself\n", nr);
+		ret = 1;
+	}
+	apfs_nname_free(&nname);
+	return ret;
+}
+
+int main(void)
+{
+	int i, failed = 0;
+
+	signal(SIGALRM, unitest_timeout);
+	alarm(UNITEST_TIMEOUT);
+	for (i = 0; i < ARRAY_SIZE(unitest_cases); i++)
+		failed += unitest_run(i, &unitest_cases[i]);
+	printf("{\"test\":\"unicode\",\"cases\":%zu,\"failed\":%d}\n",
+	       ARRAY_SIZE(unitest_cases), failed);
+	return failed ? 1 : 0;
+}
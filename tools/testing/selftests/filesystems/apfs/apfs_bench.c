@@ -0,0 +1,295 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ * Benchmarks for a mounted apfs volume
+ *
+ * Walks the whole mount once to find its files and directories, and then
+ * times lookups, failed lookups, stats, readdirs, sequential reads and random
+ * reads over them.  Every result goes to stdout as a line of json, so that
+ * runs on different kernel builds can be compared by a script.
+ */
+#define _GNU_SOURCE
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <ftw.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#define SEQ_BUF_SIZE	(1024 * 1024)
+#define RAND_READ_SIZE	4096
+
+struct path_list {
+	char **paths;
+	off_t *sizes;
+	size_t nr;
+	size_t alloc;
+};
+
+static struct path_list files, dirs;
+static size_t max_paths = 1000000;
+static bool drop_caches;
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void die(const char *msg)
+{
+	perror(msg);
+	exit(1);
+}
+
+static void report(const char *test, uint64_t ops, uint64_t ns,
+		   uint64_t bytes)
+{
+	double secs = ns / 1e9;
+
+	printf("{\"test\":\"%s\",\"ops\":%llu,\"ns\":%llu,\"ns_per_op\":%.1f,"
+	       "\"bytes\":%llu,\"mb_per_s\":%.2f}\n", test,
+	       (unsigned long long)ops, (unsigned long long)ns,
+	       ops ? (double)ns / ops : 0.0, (unsigned long long)bytes,
+	       secs > 0 ? bytes / secs / (1024 * 1024) : 0.0);
+	fflush(stdout);
+}
+
+static void cold_caches(void)
+{
+	int fd;
+
+	if (!drop_caches)
+		return;
+	sync();
+	fd = open("/proc/sys/vm/drop_caches", O_WRONLY);
+	if (fd < 0 || write(fd, "3", 1) != 1)
+		die("drop_caches");
+	close(fd);
+}
+
+static void list_add(struct path_list *list, const char *path, off_t size)
+{
+	if (list->nr == list->alloc) {
+		list->alloc = list->alloc ? list->alloc * 2 : 1024;
+		list->paths = realloc(list->paths,
+				      list->alloc * sizeof(*list->paths));
+		list->sizes = realloc(list->sizes,
+				      list->alloc * sizeof(*list->sizes));
+		if (!list->paths || !list->sizes)
+			die("realloc");
+	}
+	list->paths[list->nr] = strdup(path);
+	if (!list->paths[list->nr])
+		die("strdup");
+	list->sizes[list->nr++] = size;
+}
+
+static int walk_one(const char *path, const struct stat *st, int type,
+		    struct FTW *ftw)
+{
+	if (type == FTW_D)
+		list_add(&dirs, path, st->st_size);
+	else if (type == FTW_F && S_ISREG(st->st_mode))
+		list_add(&files, path, st->st_size);
+	return files.nr + dirs.nr >= max_paths;
+}
+
+static void bench_walk(const char *root)
+{
+	uint64_t start;
+
+	cold_caches();
+	start = now_ns();
+	if (nftw(root, walk_one, 64, FTW_PHYS) < 0)
+		die("nftw");
+	report("walk", files.nr + dirs.nr, now_ns() - start, 0);
+}
+
+static void bench_stat(void)
+{
+	struct stat st;
+	uint64_t start;
+	size_t i;
+
+	cold_caches();
+	start = now_ns();
+	for (i = 0; i < files.nr; ++i)
+		if (lstat(files.paths[i], &st))
+			die("lstat");
+	report("stat", files.nr, now_ns() - start, 0);
+}
+
+static void bench_lookup(void)
+{
+	uint64_t start;
+	size_t i;
+	int fd;
+
+	cold_caches();
+	start = now_ns();
+	for (i = 0; i < files.nr; ++i) {
+		fd = open(files.paths[i], O_PATH | O_NOFOLLOW);
+		if (fd < 0)
+			die("open");
+		close(fd);
+	}
+	report("lookup", files.nr, now_ns() - start, 0);
+}
+
+static void bench_lookup_miss(void)
+{
+	char path[PATH_MAX];
+	struct stat st;
+	uint64_t start;
+	size_t i;
+
+	cold_caches();
+	start = now_ns();
+	for (i = 0; i < dirs.nr; ++i) {
+		snprintf(path, sizeof(path), "%s/.apfs_bench_missing_%zu",
+			 dirs.paths[i], i);
+		if (!lstat(path, &st) || errno != ENOENT)
+			die("lstat of missing file");
+	}
+	report("lookup_miss", dirs.nr, now_ns() - start, 0);
+}
+
+static void bench_readdir(void)
+{
+	uint64_t start, entries = 0;
+	struct dirent *de;
+	size_t i;
+	DIR *dir;
+
+	cold_caches();
+	start = now_ns();
+	for (i = 0; i < dirs.nr; ++i) {
+		dir = opendir(dirs.paths[i]);
+		if (!dir)
+			die("opendir");
+		while ((de = readdir(dir)))
+			entries++;
+		closedir(dir);
+	}
+	report("readdir", entries, now_ns() - start, 0);
+}
+
+static void bench_seqread(void)
+{
+	uint64_t start, bytes = 0;
+	char *buf;
+	ssize_t ret;
+	size_t i;
+	int fd;
+
+	buf = malloc(SEQ_BUF_SIZE);
+	if (!buf)
+		die("malloc");
+
+	cold_caches();
+	start = now_ns();
+	for (i = 0; i < files.nr; ++i) {
+		fd = open(files.paths[i], O_RDONLY);
+		if (fd < 0)
+			die("open");
+		while ((ret = read(fd, buf, SEQ_BUF_SIZE)) > 0)
+			bytes += ret;
+		if (ret < 0)
+			die("read");
+		close(fd);
+	}
+	report("seqread", files.nr, now_ns() - start, bytes);
+	free(buf);
+}
+
+static void bench_randread(unsigned long nr_ops)
+{
+	char buf[RAND_READ_SIZE];
+	uint64_t start, bytes = 0;
+	unsigned long op;
+	size_t *big, nr_big = 0;
+	size_t i;
+	ssize_t ret;
+	int fd;
+
+	big = calloc(files.nr, sizeof(*big));
+	if (!big)
+		die("calloc");
+	for (i = 0; i < files.nr; ++i)
+		if (files.sizes[i] >= 16 * RAND_READ_SIZE)
+			big[nr_big++] = i;
+	if (!nr_big) {
+		report("randread", 0, 0, 0);
+		free(big);
+		return;
+	}
+
+	srandom(1);
+	cold_caches();
+	start = now_ns();
+	for (op = 0; op < nr_ops; ++op) {
+		size_t idx = big[random() % nr_big];
+		off_t blocks = files.sizes[idx] / RAND_READ_SIZE;
+		off_t off = (random() % blocks) * RAND_READ_SIZE;
+
+		fd = open(files.paths[idx], O_RDONLY);
+		if (fd < 0)
+			die("open");
+		ret = pread(fd, buf, sizeof(buf), off);
+		if (ret < 0)
+			die("pread");
+		bytes += ret;
+		close(fd);
+	}
+	report("randread", nr_ops, now_ns() - start, bytes);
+	free(big);
+}
+
+static void usage(const char *prog)
+{
+	fprintf(stderr, "usage: %s [-d] [-n max_paths] [-r rand_ops] <mount>\n"
+		"  -d  drop the caches before each test\n", prog);
+	exit(2);
+}
+
+int main(int argc, char **argv)
+{
+	unsigned long rand_ops = 10000;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "dn:r:")) != -1) {
+		switch (opt) {
+		case 'd':
+			drop_caches = true;
+			break;
+		case 'n':
+			max_paths = strtoul(optarg, NULL, 0);
+			break;
+		case 'r':
+			rand_ops = strtoul(optarg, NULL, 0);
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+	if (optind != argc - 1)
+		usage(argv[0]);
+
+	bench_walk(argv[optind]);
+	bench_stat();
+	bench_lookup();
+	bench_lookup_miss();
+	bench_readdir();
+	bench_seqread();
+	bench_randread(rand_ops);
+	return 0;
+}
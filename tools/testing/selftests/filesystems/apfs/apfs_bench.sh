@@ -0,0 +1,64 @@
+#!/bin/bash
+# SPDX-License-Identifier: GPL-2.0
+#
+# Mount each apfs image in $APFS_IMAGES and run apfs_bench on it.  There is
+# no mkfs for apfs on Linux, so the reference images must be made on macOS and
+# given to the test; a useful set covers many small files, directories with
+# hundreds of thousands of entries, fragmented files, compressed files and
+# deep directory trees.  $APFS_IMAGES may list image files or directories of
+# *.img files.  Every result is printed as a line of json, tagged with the
+# image name, and the mount time is reported as the "mount" test.
+
+# Kselftest framework requirement - SKIP code is 4.
+ksft_skip=4
+
+BENCH_OPTS=${APFS_BENCH_OPTS:--d}
+
+if [ "$(id -u)" -ne 0 ]; then
+	echo "SKIP: must be run as root"
+	exit $ksft_skip
+fi
+if [ -z "$APFS_IMAGES" ]; then
+	echo "SKIP: no images given in APFS_IMAGES"
+	exit $ksft_skip
+fi
+modprobe apfs 2>/dev/null
+if ! grep -qw apfs /proc/filesystems; then
+	echo "SKIP: apfs is not available"
+	exit $ksft_skip
+fi
+
+images=()
+for arg in $APFS_IMAGES; do
+	if [ -d "$arg" ]; then
+		images+=("$arg"/*.img)
+	else
+		images+=("$arg")
+	fi
+done
+
+mnt=$(mktemp -d)
+trap 'umount "$mnt" 2>/dev/null; rmdir "$mnt"' EXIT
+
+rc=0
+for img in "${images[@]}"; do
+	name=$(basename "$img")
+
+	sync
+	echo 3 > /proc/sys/vm/drop_caches
+	start=$(date +%s%N)
+	if ! mount -t apfs -o ro,loop "$img" "$mnt"; then
+		echo "FAIL: unable to mount $img" >&2
+		rc=1
+		continue
+	fi
+	end=$(date +%s%N)
+	echo "{\"image\":\"$name\",\"test\":\"mount\",\"ops\":1,\"ns\":$((end - start))}"
+
+	if ! ./apfs_bench $BENCH_OPTS "$mnt" | sed "s/^{/{\"image\":\"$name\",/"; then
+		echo "FAIL: benchmark failed on $img" >&2
+		rc=1
+	fi
+	umount "$mnt"
+done
+exit $rc
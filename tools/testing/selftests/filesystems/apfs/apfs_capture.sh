@@ -0,0 +1,75 @@
+#!/bin/bash
+# SPDX-License-Identifier: GPL-2.0
+#
+# Capture the lookups, stats, readdirs and reads of a mounted apfs volume from
+# its tracepoints, as a trace for apfs_replay or for apfs-replay in
+# tools/testing/apfs.  This is not a test, it's meant to run on a production
+# host while the workload of interest goes on:
+#
+#	apfs_capture.sh <mount> <trace> [seconds]
+#
+# The capture stops after the given number of seconds, or on SIGINT.  Only
+# the operations that reached the filesystem are in the trace: lookups served
+# by the dentry cache and reads served by the page cache are not seen.  Names
+# with a newline can't go in the trace format, so they come out truncated.
+
+if [ "$(id -u)" -ne 0 ]; then
+	echo "must be run as root" >&2
+	exit 1
+fi
+if [ $# -lt 2 ] || [ $# -gt 3 ]; then
+	echo "usage: $0 <mount> <trace> [seconds]" >&2
+	exit 2
+fi
+mnt=$1
+out=$2
+secs=$3
+
+tracefs=/sys/kernel/tracing
+[ -d $tracefs/events ] || tracefs=/sys/kernel/debug/tracing
+events="apfs_lookup apfs_getattr apfs_readdir apfs_iomap_begin"
+for ev in $events; do
+	if [ ! -d $tracefs/events/apfs/$ev ]; then
+		echo "no $ev tracepoint, is apfs loaded?" >&2
+		exit 1
+	fi
+done
+
+# The tracepoints give the device as major:minor, in decimal
+dev=$(mountpoint -d "$mnt") || {
+	echo "$mnt is not a mount point" >&2
+	exit 1
+}
+
+stop() {
+	for ev in $events; do
+		echo 0 > $tracefs/events/apfs/$ev/enable
+	done
+	[ -n "$pipe_pid" ] && kill "$pipe_pid" 2>/dev/null
+}
+trap stop EXIT
+trap 'exit 0' INT TERM
+
+echo > $tracefs/trace
+for ev in $events; do
+	echo "dev == $(( ${dev%:*} << 20 | ${dev#*:} ))" \
+		> $tracefs/events/apfs/$ev/filter
+	echo 1 > $tracefs/events/apfs/$ev/enable
+done
+
+# Each event becomes a line of the trace format
+event_re='.* apfs_\([a-z_]*\): dev [0-9:]*'
+hex='\(0x[0-9a-f]*\)'
+sed -nu \
+	-e "s/$event_re dir $hex ino [^ ]* ret [^ ]* name \(.*\)$/lookup \2 \3/p" \
+	-e "s/$event_re ino $hex$/inode \2/p" \
+	-e "s/$event_re ino $hex pos 0 skipped .*/readdir \2/p" \
+	-e "s/$event_re ino $hex pos \([0-9]*\) length .*/read \2 \3/p" \
+	< $tracefs/trace_pipe > "$out" &
+pipe_pid=$!
+
+if [ -n "$secs" ]; then
+	sleep "$secs"
+else
+	wait $pipe_pid
+fi
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ * Time from attach to first byte for an apfs device
+ *
+ * Mounts the device, looks up a deep path in the new mount and reads the
+ * first block of it, timing each step on its own.  The caches should be cold
+ * when this starts; apfs_coldstart.sh takes care of that, and of breaking the
+ * mount down into phases with the apfs_mount_phase tracepoint.  Every result
+ * goes to stdout as a line of json, as in apfs_bench.
+ */
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mount.h>
+#include <sys/stat.h>
+
+#define FIRST_READ_SIZE	4096
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void die(const char *msg)
+{
+	perror(msg);
+	exit(1);
+}
+
+static void report(const char *test, uint64_t ns)
+{
+	printf("{\"test\":\"%s\",\"ops\":1,\"ns\":%llu}\n", test,
+	       (unsigned long long)ns);
+	fflush(stdout);
+}
+
+static void usage(const char *prog)
+{
+	fprintf(stderr,
+		"usage: %s [-o options] <device> <mount> <path>\n"
+		"  -o  extra mount options for apfs\n"
+		"  <path> is relative to the root of the mount\n",
+		prog);
+	exit(2);
+}
+
+int main(int argc, char **argv)
+{
+	const char *options = NULL;
+	char buf[FIRST_READ_SIZE];
+	char *path;
+	struct stat st;
+	uint64_t attach, start;
+	int opt, fd;
+
+	while ((opt = getopt(argc, argv, "o:")) != -1) {
+		switch (opt) {
+		case 'o':
+			options = optarg;
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+	if (optind != argc - 3)
+		usage(argv[0]);
+	if (asprintf(&path, "%s/%s", argv[optind + 1], argv[optind + 2]) < 0)
+		die("asprintf");
+
+	attach = start = now_ns();
+	if (mount(argv[optind], argv[optind + 1], "apfs", MS_RDONLY, options))
+		die("mount");
+	report("cold_mount", now_ns() - start);
+
+	start = now_ns();
+	if (stat(path, &st))
+		die(path);
+	report("first_lookup", now_ns() - start);
+
+	start = now_ns();
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		die(path);
+	if (read(fd, buf, sizeof(buf)) < 0)
+		die("read");
+	report("first_read", now_ns() - start);
+	report("mount_to_first_byte", now_ns() - attach);
+	close(fd);
+
+	free(path);
+	return 0;
+}
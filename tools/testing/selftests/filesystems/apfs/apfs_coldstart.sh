@@ -0,0 +1,161 @@
+#!/bin/bash
+# SPDX-License-Identifier: GPL-2.0
+#
+# Time how long each apfs image in $APFS_IMAGES takes to become useful after
+# it's attached: the cold mount, the first lookup of the deepest file in the
+# image, and the first read from it.  The mount is broken down by phase with
+# the apfs_mount_phase tracepoint.  Each image is tried on a plain loop device
+# over the image file, and again behind dm-delay with $APFS_DELAY_MS of added
+# latency, if dmsetup is around; keep the images on the local NVMe drive to
+# compare the two.  The run is repeated $APFS_COLD_RUNS times.
+# Every result is printed as a line of json, tagged with the image name and
+# the device.
+
+# Kselftest framework requirement - SKIP code is 4.
+ksft_skip=4
+
+# The results go through sed, but a failed cold start must still be seen
+set -o pipefail
+
+RUNS=${APFS_COLD_RUNS:-5}
+DELAY_MS=${APFS_DELAY_MS:-1}
+MOUNT_OPTS=${APFS_COLD_OPTS:-}
+DM_NAME=apfs-coldstart
+
+if [ "$(id -u)" -ne 0 ]; then
+	echo "SKIP: must be run as root"
+	exit $ksft_skip
+fi
+if [ -z "$APFS_IMAGES" ]; then
+	echo "SKIP: no images given in APFS_IMAGES"
+	exit $ksft_skip
+fi
+modprobe apfs 2>/dev/null
+if ! grep -qw apfs /proc/filesystems; then
+	echo "SKIP: apfs is not available"
+	exit $ksft_skip
+fi
+
+tracefs=/sys/kernel/tracing
+[ -d $tracefs/events ] || tracefs=/sys/kernel/debug/tracing
+event=$tracefs/events/apfs/apfs_mount_phase
+if [ ! -d $event ]; then
+	echo "SKIP: no apfs_mount_phase tracepoint"
+	exit $ksft_skip
+fi
+
+images=()
+for arg in $APFS_IMAGES; do
+	if [ -d "$arg" ]; then
+		images+=("$arg"/*.img)
+	else
+		images+=("$arg")
+	fi
+done
+
+mnt=$(mktemp -d)
+loop=
+cleanup() {
+	umount "$mnt" 2>/dev/null
+	dmsetup remove $DM_NAME 2>/dev/null
+	[ -n "$loop" ] && losetup -d "$loop"
+	echo 0 > $event/enable
+	rmdir "$mnt"
+}
+trap cleanup EXIT
+
+# Print the deepest regular file under a mount, relative to its root
+deepest_file() {
+	(cd "$1" && find . -type f -printf '%d %P\n' 2>/dev/null) |
+		sort -rn | head -n 1 | cut -d' ' -f2-
+}
+
+# Print the phases found in the trace buffer for a device as json
+report_phases() {
+	local dev=$1 tag=$2
+	local pattern="apfs_mount_phase: dev $dev phase \([a-z]*\) ns \([0-9]*\)"
+
+	sed -n "s/.*$pattern .*/\1 \2/p" $tracefs/trace |
+	while read -r phase ns; do
+		printf '{%s,"test":"mount_phase","phase":"%s","ops":1,"ns":%s}\n' \
+		       "$tag" "$phase" "$ns"
+	done
+}
+
+# Run one cold start of a device, and tag the results
+cold_start() {
+	local dev=$1 path=$2 tag=$3 opts=()
+	local majmin
+
+	majmin=$(printf '%d:%d' $(stat -L -c '0x%t 0x%T' "$dev"))
+	[ -n "$MOUNT_OPTS" ] && opts=(-o "$MOUNT_OPTS")
+
+	sync
+	echo 3 > /proc/sys/vm/drop_caches
+	echo > $tracefs/trace
+	echo 1 > $event/enable
+	if ! ./apfs_coldstart "${opts[@]}" "$dev" "$mnt" "$path" |
+	     sed "s/^{/{$tag,/"; then
+		echo 0 > $event/enable
+		umount "$mnt" 2>/dev/null
+		return 1
+	fi
+	echo 0 > $event/enable
+	report_phases "$majmin" "$tag"
+	umount "$mnt"
+}
+
+rc=0
+for img in "${images[@]}"; do
+	name=$(basename "$img")
+
+	loop=$(losetup --find --show --read-only "$img") || {
+		echo "FAIL: unable to attach $img" >&2
+		rc=1
+		loop=
+		continue
+	}
+	if ! mount -t apfs -o ro "$loop" "$mnt"; then
+		echo "FAIL: unable to mount $img" >&2
+		rc=1
+		losetup -d "$loop"
+		loop=
+		continue
+	fi
+	path=$(deepest_file "$mnt")
+	umount "$mnt"
+	if [ -z "$path" ]; then
+		echo "FAIL: no regular files in $img" >&2
+		rc=1
+		losetup -d "$loop"
+		loop=
+		continue
+	fi
+
+	devs=("$loop")
+	if command -v dmsetup >/dev/null &&
+	   dmsetup create $DM_NAME --readonly --table \
+		"0 $(blockdev --getsz "$loop") delay $loop 0 $DELAY_MS"; then
+		devs+=(/dev/mapper/$DM_NAME)
+	else
+		echo "dm-delay is not available, skipping the delayed runs" >&2
+	fi
+
+	for dev in "${devs[@]}"; do
+		kind=loop
+		[ "$dev" != "$loop" ] && kind="dm-delay-${DELAY_MS}ms"
+		tag="\"image\":\"$name\",\"device\":\"$kind\""
+		for run in $(seq "$RUNS"); do
+			if ! cold_start "$dev" "$path" "$tag"; then
+				echo "FAIL: cold start failed for $img on $kind" >&2
+				rc=1
+				break
+			fi
+		done
+	done
+
+	dmsetup remove $DM_NAME 2>/dev/null
+	losetup -d "$loop"
+	loop=
+done
+exit $rc
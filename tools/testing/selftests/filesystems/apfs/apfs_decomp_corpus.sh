@@ -0,0 +1,54 @@
+#!/bin/bash
+# SPDX-License-Identifier: GPL-2.0
+#
+# Copy the compressed files of a mounted apfs volume into a corpus for
+# apfs-decompbench, in tools/testing/apfs.  This is not a test; point it to a
+# copy of a macOS system volume, which has compressed files of every kind, or
+# to an image made with apfs_mkdataset.sh:
+#
+#	apfs_decomp_corpus.sh <mount> <corpus> [max files]
+#
+# Each compressed file becomes <n>.decmpfs, with the raw com.apple.decmpfs
+# xattr, and <n>.rsrc with the resource fork, if it has one.  Only the
+# compressed data gets copied, and the names of the files are not kept.  The
+# xattrs are read with getfattr, so files with a resource fork over 64 KiB,
+# the limit of getxattr(), are skipped.  The default is to stop at 10000
+# files.
+
+if [ $# -lt 2 ] || [ $# -gt 3 ]; then
+	echo "usage: $0 <mount> <corpus> [max files]" >&2
+	exit 2
+fi
+mnt=$1
+out=$2
+max=${3:-10000}
+
+if ! command -v getfattr >/dev/null; then
+	echo "getfattr is needed to read the xattrs" >&2
+	exit 1
+fi
+mkdir -p "$out" || exit 1
+
+n=0
+skipped=0
+while IFS= read -r -d '' file; do
+	[ $n -lt "$max" ] || break
+	getfattr --only-values -n osx.com.apple.decmpfs "$file" \
+		> "$out/$n.decmpfs" 2>/dev/null || continue
+
+	# Types 4, 8 and 12 keep the compressed data in the resource fork
+	type=$(od -An -tu4 -j4 -N4 "$out/$n.decmpfs")
+	case $((type)) in
+	4|8|12)
+		if ! getfattr --only-values -n osx.com.apple.ResourceFork \
+			"$file" > "$out/$n.rsrc" 2>/dev/null; then
+			skipped=$((skipped + 1))
+			continue
+		fi
+		;;
+	esac
+	n=$((n + 1))
+done < <(find "$mnt" -xdev -type f -print0 2>/dev/null)
+rm -f "$out/$n.decmpfs" "$out/$n.rsrc"
+
+echo "$n compressed files copied to $out, $skipped skipped"
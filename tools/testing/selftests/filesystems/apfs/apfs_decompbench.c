@@ -0,0 +1,275 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ * Time the reads of the compressed files of a mounted apfs volume
+ *
+ * Finds the files that have a com.apple.decmpfs xattr, and reads each of them
+ * whole after dropping its page cache, so that every pass goes through the
+ * decoders of the kernel.  The image should be on a loop device whose backing
+ * file is in the page cache, so that the reads of the compressed data cost
+ * little next to their decoding.  A first pass is not timed, to get it there.
+ * The results go to stdout as lines of json, one for each codec and storage,
+ * as in apfs-decompbench of tools/testing/apfs.
+ */
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <ftw.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/xattr.h>
+
+#define READ_BUF_SIZE	(1024 * 1024)
+#define DECMPFS_XATTR	"osx.com.apple.decmpfs"
+#define DECMPFS_MAGIC	0x636d7066
+
+enum bench_codec {
+	BENCH_ZLIB,
+	BENCH_LZVN,
+	BENCH_LZFSE,
+	BENCH_NR_CODECS
+};
+
+static const char * const bench_codec_names[] = {
+	[BENCH_ZLIB]	= "zlib",
+	[BENCH_LZVN]	= "lzvn",
+	[BENCH_LZFSE]	= "lzfse",
+};
+
+struct bench_file {
+	char *path;
+	enum bench_codec codec;
+	bool rsrc;		/* Compressed data in the resource fork? */
+};
+
+struct bench_result {
+	uint64_t files;
+	uint64_t bytes;
+	uint64_t ns;
+};
+
+static struct bench_file *files;
+static size_t nr_files, alloc_files;
+static size_t max_files = 100000;
+static struct bench_result results[BENCH_NR_CODECS][2];
+static char *buf;
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void die(const char *msg)
+{
+	perror(msg);
+	exit(1);
+}
+
+/**
+ * read_decmpfs_type - Read the compression type of a file
+ * @path:	path to the file
+ *
+ * Returns the type from the decmpfs header, or -1 if the file is not
+ * compressed.
+ */
+static int read_decmpfs_type(const char *path)
+{
+	uint32_t *hdr;
+	ssize_t len;
+	int type = -1;
+
+	len = getxattr(path, DECMPFS_XATTR, NULL, 0);
+	if (len < 16)
+		return -1;
+	hdr = malloc(len);
+	if (!hdr)
+		die("malloc");
+	/* The header is little endian, as is every host this will run on */
+	if (getxattr(path, DECMPFS_XATTR, hdr, len) >= 16 &&
+	    hdr[0] == DECMPFS_MAGIC)
+		type = hdr[1];
+	free(hdr);
+	return type;
+}
+
+static int add_file(const char *path, const struct stat *st, int flag,
+		    struct FTW *ftw)
+{
+	struct bench_file *file;
+	int type;
+
+	if (flag != FTW_F || !S_ISREG(st->st_mode))
+		return 0;
+	type = read_decmpfs_type(path);
+	if (type < 0)
+		return 0;
+
+	if (nr_files == alloc_files) {
+		alloc_files = alloc_files ? alloc_files * 2 : 4096;
+		files = realloc(files, alloc_files * sizeof(*files));
+		if (!files)
+			die("realloc");
+	}
+	file = &files[nr_files];
+	switch (type) {
+	case 3:
+	case 4:
+		file->codec = BENCH_ZLIB;
+		break;
+	case 7:
+	case 8:
+		file->codec = BENCH_LZVN;
+		break;
+	case 11:
+	case 12:
+		file->codec = BENCH_LZFSE;
+		break;
+	default:
+		return 0;
+	}
+	/* The even types keep the data in the resource fork */
+	file->rsrc = !(type & 1);
+	file->path = strdup(path);
+	if (!file->path)
+		die("strdup");
+	nr_files++;
+	return nr_files < max_files ? 0 : 1;
+}
+
+/**
+ * read_file - Read a whole file, after dropping its page cache
+ * @file:	the file
+ * @res:	result to add the read to, or NULL
+ *
+ * Returns 0 on success, or -1 in case of failure.
+ */
+static int read_file(const struct bench_file *file, struct bench_result *res)
+{
+	uint64_t start, bytes = 0;
+	ssize_t ret;
+	int fd;
+
+	fd = open(file->path, O_RDONLY);
+	if (fd < 0)
+		return -1;
+	posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+
+	start = now_ns();
+	while ((ret = read(fd, buf, READ_BUF_SIZE)) > 0)
+		bytes += ret;
+	if (res && ret == 0) {
+		res->ns += now_ns() - start;
+		res->files++;
+		res->bytes += bytes;
+	}
+	if (ret < 0) {
+		ret = errno;
+		close(fd);
+		errno = ret;
+		return -1;
+	}
+	close(fd);
+	return 0;
+}
+
+static void usage(const char *prog)
+{
+	fprintf(stderr,
+		"usage: %s [-c cpu] [-m max files] [-n passes] <dir>...\n"
+		"  -c  run on this cpu only\n"
+		"  -m  stop looking for files after this many\n"
+		"  -n  timed passes over all the files (default: 3)\n",
+		prog);
+	exit(2);
+}
+
+int main(int argc, char **argv)
+{
+	unsigned long passes = 3, pass;
+	int cpu = -1, opt, codec, rsrc;
+	size_t i;
+
+	while ((opt = getopt(argc, argv, "c:m:n:")) != -1) {
+		switch (opt) {
+		case 'c':
+			cpu = strtol(optarg, NULL, 0);
+			break;
+		case 'm':
+			max_files = strtoul(optarg, NULL, 0);
+			break;
+		case 'n':
+			passes = strtoul(optarg, NULL, 0);
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+	if (optind >= argc || !passes || !max_files)
+		usage(argv[0]);
+
+	if (cpu >= 0) {
+		cpu_set_t set;
+
+		CPU_ZERO(&set);
+		CPU_SET(cpu, &set);
+		if (sched_setaffinity(0, sizeof(set), &set))
+			die("sched_setaffinity");
+	}
+
+	for (i = optind; i < argc; i++)
+		if (nftw(argv[i], add_file, 64, FTW_PHYS | FTW_MOUNT) < 0)
+			die(argv[i]);
+	if (!nr_files) {
+		fprintf(stderr, "no compressed files found\n");
+		return 1;
+	}
+	buf = malloc(READ_BUF_SIZE);
+	if (!buf)
+		die("malloc");
+
+	/* Get the compressed data into the page cache of the backing file */
+	for (i = 0; i < nr_files; i++)
+		read_file(&files[i], NULL);
+
+	for (pass = 0; pass < passes; pass++) {
+		for (i = 0; i < nr_files; i++) {
+			struct bench_file *file = &files[i];
+			struct bench_result *res;
+
+			res = &results[file->codec][file->rsrc];
+			if (read_file(file, res)) {
+				fprintf(stderr, "%s: %s\n", file->path,
+					strerror(errno));
+				return 1;
+			}
+		}
+	}
+
+	for (codec = 0; codec < BENCH_NR_CODECS; codec++) {
+		for (rsrc = 0; rsrc <= 1; rsrc++) {
+			struct bench_result *res = &results[codec][rsrc];
+
+			if (!res->files)
+				continue;
+			printf("{\"test\":\"decomp\",\"codec\":\"%s\","
+			       "\"storage\":\"%s\",\"cpu\":%d,"
+			       "\"files\":%llu,\"bytes\":%llu,\"ns\":%llu,"
+			       "\"mb_per_s\":%.1f}\n",
+			       bench_codec_names[codec], rsrc ? "rsrc" : "attr",
+			       sched_getcpu(), (unsigned long long)res->files,
+			       (unsigned long long)res->bytes,
+			       (unsigned long long)res->ns,
+			       res->ns ? res->bytes * 1000.0 / res->ns : 0.0);
+		}
+	}
+	return 0;
+}
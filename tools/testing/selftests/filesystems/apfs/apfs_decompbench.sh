@@ -0,0 +1,59 @@
+#!/bin/bash
+# SPDX-License-Identifier: GPL-2.0
+#
+# Mount each apfs image in $APFS_DECOMP_IMAGES and time the reads of its
+# compressed files with apfs_decompbench, once on each cpu listed in
+# $APFS_DECOMP_CPUS (default 0).  A copy of a macOS system volume has files
+# of every codec; the images of apfs_mkdataset.sh only have the codec that
+# ditto picks.  The same files can be copied with apfs_decomp_corpus.sh and
+# decoded in userspace by apfs-decompbench, in tools/testing/apfs, to tell the
+# decoders apart from the rest of the read path.  Every result is printed as
+# a line of json, tagged with the image name.
+
+# Kselftest framework requirement - SKIP code is 4.
+ksft_skip=4
+
+BENCH_OPTS=${APFS_DECOMP_OPTS:-}
+CPUS=${APFS_DECOMP_CPUS:-0}
+
+if [ "$(id -u)" -ne 0 ]; then
+	echo "SKIP: must be run as root"
+	exit $ksft_skip
+fi
+if [ -z "$APFS_DECOMP_IMAGES" ]; then
+	echo "SKIP: no images given in APFS_DECOMP_IMAGES"
+	exit $ksft_skip
+fi
+modprobe apfs 2>/dev/null
+if ! grep -qw apfs /proc/filesystems; then
+	echo "SKIP: apfs is not available"
+	exit $ksft_skip
+fi
+
+mnt=$(mktemp -d)
+trap 'umount "$mnt" 2>/dev/null; rmdir "$mnt"' EXIT
+
+# The status of a benchmark run is that of apfs_decompbench, not of sed
+set -o pipefail
+
+rc=0
+for img in $APFS_DECOMP_IMAGES; do
+	name=$(basename "$img")
+
+	# No loopdio, so that the image stays in the page cache
+	if ! mount -t apfs -o ro,loop "$img" "$mnt"; then
+		echo "FAIL: unable to mount $img" >&2
+		rc=1
+		continue
+	fi
+	for cpu in $CPUS; do
+		if ! ./apfs_decompbench $BENCH_OPTS -c "$cpu" "$mnt" |
+		     sed "s/^{/{\"image\":\"$name\",/"; then
+			echo "FAIL: benchmark failed on $img" >&2
+			rc=1
+			break
+		fi
+	done
+	umount "$mnt"
+done
+exit $rc
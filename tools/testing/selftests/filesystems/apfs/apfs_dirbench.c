@@ -0,0 +1,307 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ * Scalability benchmarks for huge apfs directories
+ *
+ * For each directory given, times a full readdir, getdents restarts from a
+ * set of offsets into the directory, and random positive and negative
+ * lookups with an increasing number of threads.  Every result goes to stdout
+ * as a line of json, tagged with the directory and its number of entries.
+ *
+ * The targets, over directories of 10^3 to 10^7 entries, are:
+ *   - readdir:      constant ns per entry, so that a full scan is linear
+ *   - restart:      constant ns per call, whatever the offset
+ *   - lookup:       ns per op growing with log(entries)
+ *   - lookup_miss:  same as lookup
+ *   - threads:      ops per second growing linearly with the thread count
+ */
+#define _GNU_SOURCE
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/types.h>
+
+#define GETDENTS_BUF_SIZE	(64 * 1024)
+#define RESTART_POINTS		16
+#define RESTART_REPEATS		64
+
+struct linux_dirent64 {
+	uint64_t d_ino;
+	int64_t d_off;
+	unsigned short d_reclen;
+	unsigned char d_type;
+	char d_name[];
+};
+
+struct dir_info {
+	const char *path;
+	int fd;
+	char **names;
+	off_t *offs;		/* Position right after each entry */
+	size_t nr;
+	size_t alloc;
+};
+
+struct lookup_args {
+	struct dir_info *dir;
+	unsigned long nr_ops;
+	unsigned int seed;
+	bool miss;
+};
+
+static bool drop_caches;
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void die(const char *msg)
+{
+	perror(msg);
+	exit(1);
+}
+
+static void report(struct dir_info *dir, const char *test,
+		   unsigned int threads, long long pos, uint64_t ops,
+		   uint64_t ns)
+{
+	printf("{\"dir\":\"%s\",\"entries\":%zu,\"test\":\"%s\","
+	       "\"threads\":%u,\"pos\":%lld,\"ops\":%llu,\"ns\":%llu,"
+	       "\"ns_per_op\":%.1f,\"ops_per_s\":%.0f}\n", dir->path, dir->nr,
+	       test, threads, pos, (unsigned long long)ops,
+	       (unsigned long long)ns, ops ? (double)ns / ops : 0.0,
+	       ns ? ops * 1e9 / ns : 0.0);
+	fflush(stdout);
+}
+
+static void cold_caches(void)
+{
+	int fd;
+
+	if (!drop_caches)
+		return;
+	sync();
+	fd = open("/proc/sys/vm/drop_caches", O_WRONLY);
+	if (fd < 0 || write(fd, "3", 1) != 1)
+		die("drop_caches");
+	close(fd);
+}
+
+static void dir_add(struct dir_info *dir, const char *name, off_t off)
+{
+	if (dir->nr == dir->alloc) {
+		dir->alloc = dir->alloc ? dir->alloc * 2 : 1024;
+		dir->names = realloc(dir->names,
+				     dir->alloc * sizeof(*dir->names));
+		dir->offs = realloc(dir->offs,
+				    dir->alloc * sizeof(*dir->offs));
+		if (!dir->names || !dir->offs)
+			die("realloc");
+	}
+	dir->names[dir->nr] = strdup(name);
+	if (!dir->names[dir->nr])
+		die("strdup");
+	dir->offs[dir->nr++] = off;
+}
+
+/* Returns the number of entries found in a single getdents64 call */
+static size_t getdents_once(int fd, char *buf, struct dir_info *dir)
+{
+	size_t count = 0;
+	long len, pos;
+
+	len = syscall(SYS_getdents64, fd, buf, GETDENTS_BUF_SIZE);
+	if (len < 0)
+		die("getdents64");
+	for (pos = 0; pos < len; count++) {
+		struct linux_dirent64 *de = (void *)(buf + pos);
+
+		if (dir && strcmp(de->d_name, ".") && strcmp(de->d_name, ".."))
+			dir_add(dir, de->d_name, de->d_off);
+		pos += de->d_reclen;
+	}
+	return count;
+}
+
+/* The first run also records the names and offsets for the other tests */
+static void bench_readdir(struct dir_info *dir, char *buf)
+{
+	struct dir_info *record = dir->nr ? NULL : dir;
+	uint64_t start, entries = 0;
+	size_t count;
+
+	cold_caches();
+	start = now_ns();
+	if (lseek(dir->fd, 0, SEEK_SET) < 0)
+		die("lseek");
+	do {
+		count = getdents_once(dir->fd, buf, record);
+		entries += count;
+	} while (count);
+	report(dir, "readdir", 1, 0, entries, now_ns() - start);
+}
+
+static void bench_restart(struct dir_info *dir, char *buf)
+{
+	unsigned int point, rep;
+	uint64_t start;
+
+	if (!dir->nr)
+		return;
+	for (point = 0; point < RESTART_POINTS; ++point) {
+		size_t idx = (dir->nr - 1) * point / (RESTART_POINTS - 1);
+		off_t pos = dir->offs[idx];
+
+		cold_caches();
+		start = now_ns();
+		for (rep = 0; rep < RESTART_REPEATS; ++rep) {
+			if (lseek(dir->fd, pos, SEEK_SET) < 0)
+				die("lseek");
+			getdents_once(dir->fd, buf, NULL);
+		}
+		report(dir, "restart", 1, idx, RESTART_REPEATS,
+		       now_ns() - start);
+	}
+}
+
+static void *lookup_thread(void *data)
+{
+	struct lookup_args *args = data;
+	struct dir_info *dir = args->dir;
+	char name[NAME_MAX + 1];
+	unsigned long op;
+	struct stat st;
+
+	for (op = 0; op < args->nr_ops; ++op) {
+		size_t idx = rand_r(&args->seed) % dir->nr;
+
+		if (args->miss) {
+			snprintf(name, sizeof(name), "%.200s.missing",
+				 dir->names[idx]);
+			if (!fstatat(dir->fd, name, &st, AT_SYMLINK_NOFOLLOW) ||
+			    errno != ENOENT)
+				die("lookup of missing file");
+		} else if (fstatat(dir->fd, dir->names[idx], &st,
+				   AT_SYMLINK_NOFOLLOW)) {
+			die("fstatat");
+		}
+	}
+	return NULL;
+}
+
+static void bench_lookup(struct dir_info *dir, unsigned int threads,
+			 unsigned long nr_ops, bool miss)
+{
+	struct lookup_args *args;
+	pthread_t *tids;
+	uint64_t start;
+	unsigned int i;
+
+	if (!dir->nr)
+		return;
+	args = calloc(threads, sizeof(*args));
+	tids = calloc(threads, sizeof(*tids));
+	if (!args || !tids)
+		die("calloc");
+
+	cold_caches();
+	start = now_ns();
+	for (i = 0; i < threads; ++i) {
+		args[i].dir = dir;
+		args[i].nr_ops = nr_ops;
+		args[i].seed = i + 1;
+		args[i].miss = miss;
+		if (pthread_create(&tids[i], NULL, lookup_thread, &args[i]))
+			die("pthread_create");
+	}
+	for (i = 0; i < threads; ++i)
+		pthread_join(tids[i], NULL);
+	report(dir, miss ? "lookup_miss" : "lookup", threads, 0,
+	       (uint64_t)threads * nr_ops, now_ns() - start);
+
+	free(tids);
+	free(args);
+}
+
+static void bench_dir(const char *path, unsigned int max_threads,
+		      unsigned long nr_ops)
+{
+	struct dir_info dir = { .path = path };
+	unsigned int threads;
+	char *buf;
+	size_t i;
+
+	buf = malloc(GETDENTS_BUF_SIZE);
+	if (!buf)
+		die("malloc");
+	dir.fd = open(path, O_RDONLY | O_DIRECTORY);
+	if (dir.fd < 0)
+		die(path);
+
+	bench_readdir(&dir, buf);
+	bench_restart(&dir, buf);
+	for (threads = 1; threads <= max_threads; threads *= 2) {
+		bench_lookup(&dir, threads, nr_ops, false /* miss */);
+		bench_lookup(&dir, threads, nr_ops, true /* miss */);
+	}
+
+	close(dir.fd);
+	for (i = 0; i < dir.nr; ++i)
+		free(dir.names[i]);
+	free(dir.names);
+	free(dir.offs);
+	free(buf);
+}
+
+static void usage(const char *prog)
+{
+	fprintf(stderr, "usage: %s [-d] [-l lookups] [-t max_threads] <dir>...\n"
+		"  -d  drop the caches before each test\n"
+		"  -l  lookups for each thread to make\n"
+		"  -t  highest thread count, doubled from 1\n", prog);
+	exit(2);
+}
+
+int main(int argc, char **argv)
+{
+	unsigned long nr_ops = 100000;
+	unsigned int max_threads = sysconf(_SC_NPROCESSORS_ONLN);
+	int opt;
+
+	while ((opt = getopt(argc, argv, "dl:t:")) != -1) {
+		switch (opt) {
+		case 'd':
+			drop_caches = true;
+			break;
+		case 'l':
+			nr_ops = strtoul(optarg, NULL, 0);
+			break;
+		case 't':
+			max_threads = strtoul(optarg, NULL, 0);
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+	if (optind == argc)
+		usage(argv[0]);
+	if (!max_threads)
+		max_threads = 1;
+
+	for (; optind < argc; ++optind)
+		bench_dir(argv[optind], max_threads, nr_ops);
+	return 0;
+}
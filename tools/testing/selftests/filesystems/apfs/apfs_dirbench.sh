@@ -0,0 +1,63 @@
+#!/bin/bash
+# SPDX-License-Identifier: GPL-2.0
+#
+# Mount each apfs image in $APFS_DIR_IMAGES and run apfs_dirbench on its huge
+# directories.  The images must be made on macOS, with directories of 10^3 to
+# 10^7 entries; $APFS_BENCH_DIRS lists their paths inside the image, and by
+# default every directory at the root of the image is used.  Every result is
+# printed as a line of json, tagged with the image name.
+
+# Kselftest framework requirement - SKIP code is 4.
+ksft_skip=4
+
+BENCH_OPTS=${APFS_DIRBENCH_OPTS:-}
+
+if [ "$(id -u)" -ne 0 ]; then
+	echo "SKIP: must be run as root"
+	exit $ksft_skip
+fi
+if [ -z "$APFS_DIR_IMAGES" ]; then
+	echo "SKIP: no images given in APFS_DIR_IMAGES"
+	exit $ksft_skip
+fi
+modprobe apfs 2>/dev/null
+if ! grep -qw apfs /proc/filesystems; then
+	echo "SKIP: apfs is not available"
+	exit $ksft_skip
+fi
+
+mnt=$(mktemp -d)
+trap 'umount "$mnt" 2>/dev/null; rmdir "$mnt"' EXIT
+
+rc=0
+for img in $APFS_DIR_IMAGES; do
+	name=$(basename "$img")
+
+	if ! mount -t apfs -o ro,loop "$img" "$mnt"; then
+		echo "FAIL: unable to mount $img" >&2
+		rc=1
+		continue
+	fi
+
+	dirs=()
+	if [ -n "$APFS_BENCH_DIRS" ]; then
+		for d in $APFS_BENCH_DIRS; do
+			dirs+=("$mnt/$d")
+		done
+	else
+		for d in "$mnt"/*/; do
+			[ -d "$d" ] && dirs+=("${d%/}")
+		done
+	fi
+
+	if [ ${#dirs[@]} -eq 0 ]; then
+		echo "FAIL: no directories to test in $img" >&2
+		rc=1
+	elif ! ./apfs_dirbench $BENCH_OPTS "${dirs[@]}" |
+	     sed "s/^{/{\"image\":\"$name\",/"; then
+		echo "FAIL: benchmark failed on $img" >&2
+		rc=1
+	fi
+	umount "$mnt"
+done
+exit $rc
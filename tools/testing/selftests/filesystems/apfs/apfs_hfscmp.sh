@@ -0,0 +1,88 @@
+#!/bin/bash
+# SPDX-License-Identifier: GPL-2.0
+#
+# Run apfs_bench against an apfs image and an hfsplus image that hold the same
+# dataset, and report how apfs compares.  The pairs of images are made on
+# macOS with apfs_mkdataset.sh; $APFS_CMP_IMAGES lists the apfs images, and
+# the hfsplus image of each is found next to it, as <name>.hfs.img for
+# <name>.apfs.img.  Every result is printed as a line of json tagged with the
+# dataset name and the filesystem, and each test then gets a "ratio" line
+# with the time per operation for apfs over the one for hfsplus.  A ratio of
+# 1.3 for lookup means that apfs is 30% slower than hfsplus at lookups.
+
+# Kselftest framework requirement - SKIP code is 4.
+ksft_skip=4
+
+BENCH_OPTS=${APFS_BENCH_OPTS:--d}
+
+if [ "$(id -u)" -ne 0 ]; then
+	echo "SKIP: must be run as root"
+	exit $ksft_skip
+fi
+if [ -z "$APFS_CMP_IMAGES" ]; then
+	echo "SKIP: no images given in APFS_CMP_IMAGES"
+	exit $ksft_skip
+fi
+for fs in apfs hfsplus; do
+	modprobe $fs 2>/dev/null
+	if ! grep -qw $fs /proc/filesystems; then
+		echo "SKIP: $fs is not available"
+		exit $ksft_skip
+	fi
+done
+
+mnt=$(mktemp -d)
+results=$(mktemp)
+trap 'umount "$mnt" 2>/dev/null; rmdir "$mnt"; rm -f "$results"' EXIT
+
+# Print the value of a numeric field in a line of json
+json_field() {
+	sed -n "s/.*\"$2\":\([0-9.]*\).*/\1/p" <<< "$1"
+}
+
+# Run the benchmark on an image, with its results tagged and saved
+run_bench() {
+	local img=$1 fs=$2 tag=$3 rc=0
+
+	if ! mount -t "$fs" -o ro,loop "$img" "$mnt"; then
+		echo "FAIL: unable to mount $img" >&2
+		return 1
+	fi
+	./apfs_bench $BENCH_OPTS "$mnt/data" > "$results" || rc=1
+	umount "$mnt"
+	sed "s/^{/{$tag,\"fs\":\"$fs\",/" "$results"
+	return $rc
+}
+
+rc=0
+for img in $APFS_CMP_IMAGES; do
+	name=$(basename "$img" .apfs.img)
+	hfs_img=${img%.apfs.img}.hfs.img
+	tag="\"dataset\":\"$name\""
+
+	if [ ! -f "$hfs_img" ]; then
+		echo "FAIL: no hfsplus image next to $img" >&2
+		rc=1
+		continue
+	fi
+	if ! hfs_out=$(run_bench "$hfs_img" hfsplus "$tag") ||
+	   ! apfs_out=$(run_bench "$img" apfs "$tag"); then
+		echo "FAIL: benchmark failed on $name" >&2
+		rc=1
+		continue
+	fi
+	echo "$hfs_out"
+	echo "$apfs_out"
+
+	while read -r line; do
+		test=$(sed -n 's/.*"test":"\([a-z_]*\)".*/\1/p' <<< "$line")
+		apfs_ns=$(json_field "$line" ns_per_op)
+		hfs_line=$(grep "\"test\":\"$test\"" <<< "$hfs_out")
+		hfs_ns=$(json_field "$hfs_line" ns_per_op)
+		[ -n "$apfs_ns" ] && [ -n "$hfs_ns" ] || continue
+		ratio=$(awk -v a="$apfs_ns" -v h="$hfs_ns" \
+			'BEGIN { if (h > 0) printf "%.3f", a / h; else print 0 }')
+		echo "{$tag,\"test\":\"$test\",\"ratio\":$ratio}"
+	done <<< "$apfs_out"
+done
+exit $rc
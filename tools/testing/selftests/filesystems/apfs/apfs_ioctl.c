@@ -0,0 +1,552 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ * Calls every apfs ioctl on a mounted volume
+ *
+ * Picks the first regular file found under the mount, and runs each ioctl on
+ * it, on its directory, or on the root, with a check that the answer makes
+ * sense against what the usual system calls report.  Some answers are
+ * checked against each other too: the block owners against the extents, the
+ * path of the inode against the one found by the walk.  Every result goes to
+ * stdout as a line of json.  This needs CAP_SYS_ADMIN.
+ */
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <ftw.h>
+#include <limits.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <linux/apfs.h>
+
+#define NR_ENTRIES	256
+#define BUF_SIZE	(64 * 1024)
+#define COPY_SIZE	(1024 * 1024)
+
+/* Bsd flag of the files with transparent compression */
+#define UF_COMPRESSED	0x20
+
+enum { PASS, FAIL, SKIP };
+
+struct ctx {
+	char *mnt;
+	int root_fd;
+	int dir_fd;		/* Directory of the file */
+	int file_fd;
+	char *path;		/* Path of the file, relative to the mount */
+	struct stat st;
+	bool compressed;
+	struct apfs_extent_entry ext;	/* First extent of the file */
+	bool has_ext;
+	char detail[128];
+};
+
+static char found[PATH_MAX];
+
+static int find_file(const char *fpath, const struct stat *sb, int type,
+		     struct FTW *ftw)
+{
+	if (type != FTW_F || !S_ISREG(sb->st_mode) || !sb->st_size)
+		return 0;
+	strncpy(found, fpath, sizeof(found) - 1);
+	return 1;
+}
+
+static void *xmalloc(size_t size)
+{
+	void *p = calloc(1, size);
+
+	if (!p) {
+		perror("calloc");
+		exit(1);
+	}
+	return p;
+}
+
+/* Fail with the errno of the ioctl, unless it's @expected */
+static int check_errno(struct ctx *ctx, int ret, int expected)
+{
+	if (ret == 0 && !expected)
+		return PASS;
+	if (ret < 0 && errno == expected)
+		return PASS;
+	snprintf(ctx->detail, sizeof(ctx->detail), "%s, expected %s",
+		 ret ? strerror(errno) : "success",
+		 expected ? strerror(expected) : "success");
+	return FAIL;
+}
+
+static int fail(struct ctx *ctx, const char *msg)
+{
+	snprintf(ctx->detail, sizeof(ctx->detail), "%s", msg);
+	return FAIL;
+}
+
+static int test_bulkstat(struct ctx *ctx)
+{
+	struct apfs_bulkstat *bs = xmalloc(NR_ENTRIES * sizeof(*bs));
+	struct apfs_bulkstat_req req = {
+		.br_buffer = (uintptr_t)bs,
+		.br_count = NR_ENTRIES,
+	};
+	unsigned int i;
+	int ret;
+
+	ret = check_errno(ctx, ioctl(ctx->root_fd, APFS_IOC_BULKSTAT, &req), 0);
+	if (ret)
+		goto out;
+	ret = fail(ctx, "no inodes reported");
+	if (!req.br_count)
+		goto out;
+	ret = PASS;
+	for (i = 0; i < req.br_count; i++) {
+		if (bs[i].bs_pad || (i && bs[i].bs_ino <= bs[i - 1].bs_ino)) {
+			ret = fail(ctx, "bad or unsorted entry");
+			goto out;
+		}
+	}
+
+	/* Look for the file itself, to know if it's compressed */
+	req.br_ino = ctx->st.st_ino;
+	req.br_count = 1;
+	if (ioctl(ctx->root_fd, APFS_IOC_BULKSTAT, &req) || !req.br_count ||
+	    bs[0].bs_ino != ctx->st.st_ino) {
+		ret = fail(ctx, "file not reported");
+		goto out;
+	}
+	ctx->compressed = bs[0].bs_bsd_flags & UF_COMPRESSED;
+out:
+	free(bs);
+	return ret;
+}
+
+static int test_get_links(struct ctx *ctx)
+{
+	struct apfs_link *links = xmalloc(4 * sizeof(*links));
+	struct apfs_links_req req = {
+		.lr_buffer = (uintptr_t)links,
+		.lr_count = 4,
+	};
+	unsigned int i;
+	int ret;
+
+	ret = check_errno(ctx, ioctl(ctx->file_fd, APFS_IOC_GET_LINKS, &req),
+			  0);
+	if (ret)
+		goto out;
+	if (req.lr_count > req.lr_total) {
+		ret = fail(ctx, "more links filled than found");
+		goto out;
+	}
+	for (i = 0; i < req.lr_count; i++) {
+		if (!memchr(links[i].al_name, 0, APFS_LINK_NAME_SIZE)) {
+			ret = fail(ctx, "link name not terminated");
+			goto out;
+		}
+	}
+out:
+	free(links);
+	return ret;
+}
+
+static int test_snap_diff(struct ctx *ctx)
+{
+	struct apfs_diff_entry ent;
+	struct apfs_diff_req req = {
+		.dr_buffer = (uintptr_t)&ent,
+		.dr_count = 1,
+		.dr_flags = 1,
+	};
+
+	/* A volume may have no snapshots, but bad flags are always caught */
+	return check_errno(ctx, ioctl(ctx->root_fd, APFS_IOC_SNAP_DIFF, &req),
+			   EINVAL);
+}
+
+static int test_phys_extents(struct ctx *ctx)
+{
+	struct apfs_extent_entry *ents = xmalloc(NR_ENTRIES * sizeof(*ents));
+	struct apfs_extents_req req = {
+		.er_buffer = (uintptr_t)ents,
+		.er_count = NR_ENTRIES,
+	};
+	unsigned int i;
+	int ret;
+
+	ret = ioctl(ctx->file_fd, APFS_IOC_PHYS_EXTENTS, &req);
+	if (ctx->compressed) {
+		ret = check_errno(ctx, ret, EOPNOTSUPP);
+		goto out;
+	}
+	ret = check_errno(ctx, ret, 0);
+	if (ret)
+		goto out;
+	for (i = 1; i < req.er_count; i++) {
+		if (ents[i].ee_block < ents[i - 1].ee_block) {
+			ret = fail(ctx, "extents not sorted by block");
+			goto out;
+		}
+	}
+	if (req.er_count) {
+		ctx->ext = ents[0];
+		ctx->has_ext = true;
+	}
+out:
+	free(ents);
+	return ret;
+}
+
+static int test_dir_stats(struct ctx *ctx)
+{
+	struct apfs_dir_stats stats;
+
+	if (ioctl(ctx->root_fd, APFS_IOC_DIR_STATS, &stats) < 0 &&
+	    errno == ENODATA)
+		return SKIP; /* Only some directories keep the stats */
+	return check_errno(ctx, ioctl(ctx->root_fd, APFS_IOC_DIR_STATS,
+				      &stats), 0);
+}
+
+static int test_block_owners(struct ctx *ctx)
+{
+	struct apfs_owner_entry ents[16];
+	struct apfs_owners_req req = {
+		.or_buffer = (uintptr_t)ents,
+		.or_count = 16,
+	};
+	unsigned int i;
+	int ret;
+
+	if (!ctx->has_ext) { /* No blocks to look up, just make the call */
+		req.or_end = 1;
+		return check_errno(ctx, ioctl(ctx->root_fd,
+					      APFS_IOC_BLOCK_OWNERS, &req), 0);
+	}
+
+	req.or_block = ctx->ext.ee_block;
+	req.or_end = ctx->ext.ee_block + 1;
+	ret = check_errno(ctx, ioctl(ctx->root_fd, APFS_IOC_BLOCK_OWNERS,
+				     &req), 0);
+	if (ret)
+		return ret;
+	for (i = 0; i < req.or_count; i++)
+		if (ents[i].oe_owner == ctx->ext.ee_id)
+			return PASS;
+	return fail(ctx, "the file doesn't own its first block");
+}
+
+static int test_prefetch(struct ctx *ctx)
+{
+	struct apfs_prefetch_req req = {0};
+	int ret;
+
+	ret = check_errno(ctx, ioctl(ctx->dir_fd, APFS_IOC_PREFETCH, &req), 0);
+	if (ret)
+		return ret;
+	if (!req.pf_dirs || !req.pf_inodes)
+		return fail(ctx, "nothing prefetched");
+	return PASS;
+}
+
+static int test_warmset(struct ctx *ctx, bool load)
+{
+	static const unsigned int count = 4096;
+	__u64 *blocks = xmalloc(count * sizeof(*blocks));
+	struct apfs_warmset_req req = {
+		.ws_buffer = (uintptr_t)blocks,
+		.ws_count = count,
+	};
+	unsigned int i;
+	int ret;
+
+	ret = check_errno(ctx, ioctl(ctx->root_fd, APFS_IOC_GET_WARMSET, &req),
+			  0);
+	if (ret)
+		goto out;
+	if (load) {
+		/* The set just taken is always valid for the same mount */
+		ret = check_errno(ctx, ioctl(ctx->root_fd,
+					     APFS_IOC_LOAD_WARMSET, &req), 0);
+		goto out;
+	}
+	ret = fail(ctx, "the cache is empty");
+	if (!req.ws_count)
+		goto out;
+	ret = PASS;
+	for (i = 1; i < req.ws_count; i++) {
+		if (blocks[i] <= blocks[i - 1]) {
+			ret = fail(ctx, "blocks not sorted");
+			break;
+		}
+	}
+out:
+	free(blocks);
+	return ret;
+}
+
+static int test_get_warmset(struct ctx *ctx)
+{
+	return test_warmset(ctx, false);
+}
+
+static int test_load_warmset(struct ctx *ctx)
+{
+	return test_warmset(ctx, true);
+}
+
+static int test_readdir_plus(struct ctx *ctx)
+{
+	const char *name = strrchr(ctx->path, '/');
+	char *buf = xmalloc(BUF_SIZE);
+	struct apfs_readdir_plus_req req = {
+		.rp_buffer = (uintptr_t)buf,
+	};
+	bool seen = false;
+	int fd, ret;
+
+	name = name ? name + 1 : ctx->path;
+	fd = openat(ctx->dir_fd, ".", O_RDONLY | O_DIRECTORY);
+	if (fd < 0) {
+		ret = fail(ctx, "can't open the directory");
+		goto out;
+	}
+	do {
+		struct apfs_dirent_plus *dp;
+		unsigned int off = 0;
+
+		req.rp_size = BUF_SIZE;
+		ret = check_errno(ctx, ioctl(fd, APFS_IOC_READDIR_PLUS, &req),
+				  0);
+		if (ret)
+			goto out_close;
+		while (off < req.rp_size) {
+			dp = (struct apfs_dirent_plus *)(buf + off);
+			if (!dp->dp_reclen || dp->dp_reclen % 8 ||
+			    dp->dp_namelen != strlen(dp->dp_name)) {
+				ret = fail(ctx, "bad record");
+				goto out_close;
+			}
+			if (!strcmp(dp->dp_name, name) &&
+			    dp->dp_ino == ctx->st.st_ino &&
+			    dp->dp_mode == ctx->st.st_mode)
+				seen = true;
+			off += dp->dp_reclen;
+		}
+	} while (req.rp_count);
+	if (!seen)
+		ret = fail(ctx, "the file is missing");
+out_close:
+	close(fd);
+out:
+	free(buf);
+	return ret;
+}
+
+static int test_get_xattrs(struct ctx *ctx)
+{
+	char *buf = xmalloc(BUF_SIZE);
+	struct apfs_xattrs_req req = {
+		.xr_buffer = (uintptr_t)buf,
+		.xr_size = BUF_SIZE,
+	};
+	unsigned int off = 0;
+	int ret;
+
+	ret = check_errno(ctx, ioctl(ctx->file_fd, APFS_IOC_GET_XATTRS, &req),
+			  0);
+	if (ret)
+		goto out;
+	while (off < req.xr_size) {
+		struct apfs_xattr_entry *xe = (void *)(buf + off);
+
+		if (!xe->xe_reclen || xe->xe_reclen % 8 ||
+		    xe->xe_name_len != strlen(xe->xe_name)) {
+			ret = fail(ctx, "bad record");
+			break;
+		}
+		off += xe->xe_reclen;
+	}
+out:
+	free(buf);
+	return ret;
+}
+
+static int test_frag_report(struct ctx *ctx)
+{
+	struct apfs_frag_report rep = {0};
+	int ret;
+
+	ret = ioctl(ctx->file_fd, APFS_IOC_FRAG_REPORT, &rep);
+	if (ctx->compressed)
+		return check_errno(ctx, ret, EOPNOTSUPP);
+	ret = check_errno(ctx, ret, 0);
+	if (ret)
+		return ret;
+	if (ctx->has_ext != !!rep.fr_extents)
+		return fail(ctx, "disagrees with the physical extents");
+	if (rep.fr_max_len > rep.fr_mapped || rep.fr_shared > rep.fr_mapped)
+		return fail(ctx, "bad lengths");
+	return PASS;
+}
+
+static int test_ino_path(struct ctx *ctx)
+{
+	char *buf = xmalloc(PATH_MAX);
+	struct apfs_ino_path_req req = {
+		.ip_ino = ctx->st.st_ino,
+		.ip_buffer = (uintptr_t)buf,
+		.ip_size = PATH_MAX,
+	};
+	int ret;
+
+	ret = check_errno(ctx, ioctl(ctx->root_fd, APFS_IOC_INO_PATH, &req),
+			  0);
+	if (ret)
+		goto out;
+	/* Any of the links may be reported */
+	if (ctx->st.st_nlink == 1 &&
+	    (buf[0] != '/' || strcmp(buf + 1, ctx->path)))
+		ret = fail(ctx, "wrong path");
+out:
+	free(buf);
+	return ret;
+}
+
+static int test_archive(struct ctx *ctx)
+{
+	struct apfs_archive_req req = {0};
+	int ret;
+
+	req.ar_fd = open("/dev/null", O_WRONLY);
+	if (req.ar_fd < 0)
+		return fail(ctx, "can't open /dev/null");
+	ret = check_errno(ctx, ioctl(ctx->dir_fd, APFS_IOC_ARCHIVE, &req), 0);
+	close(req.ar_fd);
+	if (ret)
+		return ret;
+	/* The file and the trailer at least */
+	if (req.ar_entries < 2 || req.ar_bytes < ctx->st.st_size)
+		return fail(ctx, "archive too small");
+	return PASS;
+}
+
+static int test_copy_range(struct ctx *ctx)
+{
+	char tmpl[] = "/tmp/apfs_ioctl.XXXXXX";
+	size_t len = ctx->st.st_size < COPY_SIZE ? ctx->st.st_size : COPY_SIZE;
+	char *src = xmalloc(len), *dst = xmalloc(len);
+	struct apfs_copy_range_req req = {
+		.cr_len = len,
+	};
+	int ret;
+
+	req.cr_fd = mkstemp(tmpl);
+	if (req.cr_fd < 0) {
+		ret = fail(ctx, "can't create the destination");
+		goto out;
+	}
+	unlink(tmpl);
+
+	ret = ioctl(ctx->file_fd, APFS_IOC_COPY_RANGE, &req);
+	if (ctx->compressed) {
+		ret = check_errno(ctx, ret, EOPNOTSUPP);
+		goto out_close;
+	}
+	ret = check_errno(ctx, ret, 0);
+	if (ret)
+		goto out_close;
+	if (req.cr_src_off != len || req.cr_dst_off != len ||
+	    req.cr_copied + req.cr_holes != len) {
+		ret = fail(ctx, "bad counters");
+		goto out_close;
+	}
+	if (pread(ctx->file_fd, src, len, 0) != len ||
+	    pread(req.cr_fd, dst, len, 0) != len || memcmp(src, dst, len))
+		ret = fail(ctx, "the copy differs");
+out_close:
+	close(req.cr_fd);
+out:
+	free(src);
+	free(dst);
+	return ret;
+}
+
+static const struct {
+	const char *name;
+	int (*fn)(struct ctx *ctx);
+} tests[] = {
+	/* Bulkstat goes first, to find out if the file is compressed */
+	{ "bulkstat", test_bulkstat },
+	{ "get_links", test_get_links },
+	{ "snap_diff", test_snap_diff },
+	/* Then the extents, for the block owners and the fragmentation */
+	{ "phys_extents", test_phys_extents },
+	{ "dir_stats", test_dir_stats },
+	{ "block_owners", test_block_owners },
+	/* The prefetch fills the cache for the warm set */
+	{ "prefetch", test_prefetch },
+	{ "get_warmset", test_get_warmset },
+	{ "load_warmset", test_load_warmset },
+	{ "readdir_plus", test_readdir_plus },
+	{ "get_xattrs", test_get_xattrs },
+	{ "frag_report", test_frag_report },
+	{ "ino_path", test_ino_path },
+	{ "archive", test_archive },
+	{ "copy_range", test_copy_range },
+};
+
+static const char *const results[] = { "pass", "fail", "skip" };
+
+int main(int argc, char **argv)
+{
+	struct ctx ctx = {0};
+	char *slash;
+	unsigned int i;
+	int failed = 0;
+
+	if (argc != 2) {
+		fprintf(stderr, "usage: %s <mountpoint>\n", argv[0]);
+		return 1;
+	}
+	ctx.mnt = argv[1];
+
+	if (nftw(ctx.mnt, find_file, 64, FTW_PHYS) != 1) {
+		fprintf(stderr, "no regular files under %s\n", ctx.mnt);
+		return 1;
+	}
+	ctx.path = found + strlen(ctx.mnt);
+	while (*ctx.path == '/')
+		ctx.path++;
+
+	ctx.root_fd = open(ctx.mnt, O_RDONLY | O_DIRECTORY);
+	ctx.file_fd = open(found, O_RDONLY);
+	slash = strrchr(found, '/');
+	*slash = 0;
+	ctx.dir_fd = open(found, O_RDONLY | O_DIRECTORY);
+	*slash = '/';
+	if (ctx.root_fd < 0 || ctx.file_fd < 0 || ctx.dir_fd < 0 ||
+	    fstat(ctx.file_fd, &ctx.st)) {
+		perror(found);
+		return 1;
+	}
+
+	for (i = 0; i < sizeof(tests) / sizeof(tests[0]); i++) {
+		int ret;
+
+		ctx.detail[0] = 0;
+		ret = tests[i].fn(&ctx);
+		if (ret == FAIL)
+			failed++;
+		printf("{\"ioctl\":\"%s\",\"file\":\"%s\",\"result\":\"%s\"",
+		       tests[i].name, ctx.path, results[ret]);
+		if (ctx.detail[0])
+			printf(",\"detail\":\"%s\"", ctx.detail);
+		printf("}\n");
+	}
+	return failed ? 1 : 0;
+}
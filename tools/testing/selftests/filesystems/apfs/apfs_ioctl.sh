@@ -0,0 +1,55 @@
+#!/bin/bash
+# SPDX-License-Identifier: GPL-2.0
+#
+# Mount each apfs image in $APFS_IMAGES and call every apfs ioctl on it with
+# apfs_ioctl.  Every result is printed as a line of json, tagged with the
+# image name.
+
+# Kselftest framework requirement - SKIP code is 4.
+ksft_skip=4
+
+# The results go through sed, but a failed ioctl must still be seen
+set -o pipefail
+
+if [ "$(id -u)" -ne 0 ]; then
+	echo "SKIP: must be run as root"
+	exit $ksft_skip
+fi
+if [ -z "$APFS_IMAGES" ]; then
+	echo "SKIP: no images given in APFS_IMAGES"
+	exit $ksft_skip
+fi
+modprobe apfs 2>/dev/null
+if ! grep -qw apfs /proc/filesystems; then
+	echo "SKIP: apfs is not available"
+	exit $ksft_skip
+fi
+
+images=()
+for arg in $APFS_IMAGES; do
+	if [ -d "$arg" ]; then
+		images+=("$arg"/*.img)
+	else
+		images+=("$arg")
+	fi
+done
+
+mnt=$(mktemp -d)
+trap 'umount "$mnt" 2>/dev/null; rmdir "$mnt"' EXIT
+
+rc=0
+for img in "${images[@]}"; do
+	name=$(basename "$img")
+
+	if ! mount -t apfs -o ro,loop "$img" "$mnt"; then
+		echo "FAIL: unable to mount $img" >&2
+		rc=1
+		continue
+	fi
+	if ! ./apfs_ioctl "$mnt" | sed "s/^{/{\"image\":\"$name\",/"; then
+		echo "FAIL: ioctls failed on $img" >&2
+		rc=1
+	fi
+	umount "$mnt"
+done
+exit $rc
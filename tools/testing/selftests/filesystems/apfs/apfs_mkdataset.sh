@@ -0,0 +1,105 @@
+#!/bin/bash
+# SPDX-License-Identifier: GPL-2.0
+#
+# Build an apfs image and an hfsplus image with the same synthetic dataset, for
+# apfs_hfscmp.sh.  There is no mkfs for apfs on Linux, so this must run on
+# macOS:
+#
+#	apfs_mkdataset.sh <name> [size]
+#
+# Writes <name>.apfs.img and <name>.hfs.img, raw images with no partition
+# map, so that they can be given to a loop device as they are.  The dataset
+# is built once in a temporary directory and copied into both images with
+# ditto.  The files meant to be compressed get compressed on the apfs image
+# only: the hfsplus driver of Linux can't read compressed files, so they go
+# in plain on the hfsplus image, and the reads of the two get compared.  The
+# shape of the dataset is set through the environment:
+#
+#	DATASET_DIRS		directories below each directory (default 8)
+#	DATASET_DEPTH		levels of directories (default 3)
+#	DATASET_FILES		files in each directory (default 64)
+#	DATASET_XATTRS		extended attributes on each file (default 2)
+#	DATASET_COMPRESSED	percentage of compressed files (default 25)
+#	DATASET_SEED		seed for the file sizes (default 1)
+
+set -e
+
+DIRS=${DATASET_DIRS:-8}
+DEPTH=${DATASET_DEPTH:-3}
+FILES=${DATASET_FILES:-64}
+XATTRS=${DATASET_XATTRS:-2}
+COMPRESSED=${DATASET_COMPRESSED:-25}
+RANDOM=${DATASET_SEED:-1}
+
+if [ "$(uname)" != Darwin ]; then
+	echo "the images can only be made on macOS" >&2
+	exit 1
+fi
+if [ $# -lt 1 ] || [ $# -gt 2 ]; then
+	echo "usage: $0 <name> [size]" >&2
+	exit 2
+fi
+name=$1
+size=${2:-4g}
+
+src=$(mktemp -d)
+trap 'rm -rf "$src"' EXIT
+
+# A file mix from empty files to a few MiB, with most of them small
+file_size() {
+	case $((RANDOM % 10)) in
+	0)		echo 0 ;;
+	[1-6])		echo $(((RANDOM % 16 + 1) * 1024)) ;;
+	[7-8])		echo $(((RANDOM % 256 + 16) * 1024)) ;;
+	9)		echo $(((RANDOM % 4 + 1) * 1024 * 1024)) ;;
+	esac
+}
+
+# Fill a directory with files, and recurse into its subdirectories
+fill_dir() {
+	local dir=$1 level=$2 i
+
+	mkdir -p "$dir"
+	for i in $(seq "$FILES"); do
+		local file=$dir/file$i
+		local bytes
+
+		bytes=$(file_size)
+		if [ $((RANDOM % 100)) -lt "$COMPRESSED" ]; then
+			# Text compresses well, so ditto will keep it compressed
+			yes "apfs dataset line $i" | head -c "$bytes" \
+				> "$file.cmp"
+		else
+			head -c "$bytes" /dev/urandom > "$file"
+		fi
+	done
+	for file in "$dir"/file*; do
+		for i in $(seq "$XATTRS"); do
+			xattr -w "user.dataset$i" "value $i of $file" "$file"
+		done
+	done
+	[ "$level" -lt "$DEPTH" ] || return 0
+	for i in $(seq "$DIRS"); do
+		fill_dir "$dir/dir$i" $((level + 1))
+	done
+}
+
+fill_dir "$src/data" 1
+
+for fs in apfs hfs; do
+	case $fs in
+	apfs)	fstype=APFS; ditto_opts=--hfsCompression ;;
+	hfs)	fstype=HFS+; ditto_opts=--nohfsCompression ;;
+	esac
+	img=$name.$fs.img
+	rm -f "$img" "$img.dmg"
+	hdiutil create -quiet -size "$size" -layout NONE -type UDIF \
+		-fs "$fstype" -volname dataset "$img.dmg"
+	mnt=$(mktemp -d)
+	hdiutil attach -quiet -nobrowse -mountpoint "$mnt" "$img.dmg"
+	ditto $ditto_opts "$src/data" "$mnt/data"
+	hdiutil detach -quiet "$mnt"
+	rmdir "$mnt"
+	# A read/write UDIF image is the raw blocks, with a trailer at the end
+	mv "$img.dmg" "$img"
+done
@@ -0,0 +1,369 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ * Replay a trace of apfs lookups against a mounted volume
+ *
+ * The trace format is the one of apfs-replay, in tools/testing/apfs, so a
+ * trace captured with apfs_capture.sh can be replayed both here, through the
+ * whole kernel, and there, against the b-tree code alone.  Inodes are opened
+ * by number with open_by_handle_at(), so this must run as root:
+ *
+ *	inode <ino>		stat of an inode
+ *	lookup <parent> <name>	stat of a name in a directory
+ *	xattr <ino> <name>	read of an extended attribute
+ *	extent <id> <offset>	read of a block, taking the id as the inode
+ *	readdir <ino>		listing of a whole directory
+ *	read <ino> <offset>	read of a block from a file
+ *	omap <oid>		skipped, there is no way to ask for it
+ *
+ * Each thread replays the whole trace the requested number of times, and the
+ * result goes to stdout as a line of json, as in apfs_bench.
+ */
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/xattr.h>
+
+#define READ_SIZE	4096
+#define DIRENT_BUF_SIZE	(64 * 1024)
+
+/* File handles of fs/apfs/export.c, with the inode number alone */
+#define APFS_FILEID_CNID	0xa1
+
+enum replay_op {
+	REPLAY_INODE,
+	REPLAY_LOOKUP,
+	REPLAY_XATTR,
+	REPLAY_EXTENT,
+	REPLAY_READDIR,
+	REPLAY_READ,
+	REPLAY_OMAP,
+};
+
+static const char * const replay_op_names[] = {
+	[REPLAY_INODE]		= "inode",
+	[REPLAY_LOOKUP]		= "lookup",
+	[REPLAY_XATTR]		= "xattr",
+	[REPLAY_EXTENT]		= "extent",
+	[REPLAY_READDIR]	= "readdir",
+	[REPLAY_READ]		= "read",
+	[REPLAY_OMAP]		= "omap",
+};
+
+struct replay_entry {
+	enum replay_op op;
+	uint64_t id;
+	uint64_t number;
+	char *name;
+};
+
+struct replay_thread {
+	pthread_t thread;
+	unsigned long found;		/* Operations that succeeded */
+	unsigned long missing;		/* Operations that found nothing */
+	unsigned long skipped;		/* Operations with no syscall for them */
+	int err;			/* First unexpected errno, or 0 */
+};
+
+static struct replay_entry *entries;
+static size_t nr_entries;
+static unsigned long passes = 1;
+static int mount_fd;
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void die(const char *msg)
+{
+	perror(msg);
+	exit(1);
+}
+
+static void read_trace(const char *path)
+{
+	size_t alloc = 0, lineno = 0, len = 0;
+	char *line = NULL;
+	FILE *file;
+
+	file = strcmp(path, "-") ? fopen(path, "r") : stdin;
+	if (!file)
+		die(path);
+
+	while (getline(&line, &len, file) > 0) {
+		struct replay_entry *entry;
+		char *op, *arg, *end;
+		unsigned int i;
+
+		lineno++;
+		line[strcspn(line, "\n")] = 0;
+		op = strtok(line, " ");
+		if (!op || *op == '#')
+			continue;
+
+		if (nr_entries == alloc) {
+			alloc = alloc ? alloc * 2 : 4096;
+			entries = realloc(entries, alloc * sizeof(*entries));
+			if (!entries)
+				die("realloc");
+		}
+		entry = &entries[nr_entries];
+		memset(entry, 0, sizeof(*entry));
+
+		for (i = 0; i < sizeof(replay_op_names) / sizeof(char *); ++i)
+			if (!strcmp(op, replay_op_names[i]))
+				break;
+		if (i == sizeof(replay_op_names) / sizeof(char *))
+			goto bad;
+		entry->op = i;
+
+		arg = strtok(NULL, " ");
+		if (!arg)
+			goto bad;
+		entry->id = strtoull(arg, &end, 0);
+		if (*end)
+			goto bad;
+
+		/* The name is the rest of the line, spaces and all */
+		arg = strtok(NULL, "");
+		switch (entry->op) {
+		case REPLAY_LOOKUP:
+		case REPLAY_XATTR:
+			if (!arg)
+				goto bad;
+			entry->name = strdup(arg);
+			if (!entry->name)
+				die("strdup");
+			break;
+		case REPLAY_EXTENT:
+		case REPLAY_READ:
+			if (!arg)
+				goto bad;
+			entry->number = strtoull(arg, &end, 0);
+			if (*end)
+				goto bad;
+			break;
+		default:
+			if (arg)
+				goto bad;
+			break;
+		}
+		nr_entries++;
+		continue;
+bad:
+		fprintf(stderr, "%s:%zu: bad trace line\n", path, lineno);
+		exit(2);
+	}
+	free(line);
+	if (file != stdin)
+		fclose(file);
+}
+
+/**
+ * open_ino - Open an inode of the mount by its number
+ * @ino:	inode number
+ * @flags:	flags for the open
+ *
+ * Returns the file descriptor, or -1 with errno set.
+ */
+static int open_ino(uint64_t ino, int flags)
+{
+	struct {
+		struct file_handle fh;
+		uint32_t cnid[2];
+	} handle;
+
+	handle.fh.handle_bytes = sizeof(handle.cnid);
+	handle.fh.handle_type = APFS_FILEID_CNID;
+	handle.cnid[0] = (uint32_t)ino;
+	handle.cnid[1] = ino >> 32;
+	return open_by_handle_at(mount_fd, &handle.fh, flags);
+}
+
+static int replay_readdir(int fd)
+{
+	char *buf = malloc(DIRENT_BUF_SIZE);
+	long ret;
+
+	if (!buf)
+		die("malloc");
+	do {
+		ret = syscall(SYS_getdents64, fd, buf, DIRENT_BUF_SIZE);
+	} while (ret > 0);
+	free(buf);
+	return ret;
+}
+
+/**
+ * replay_one - Replay a single entry of the trace
+ * @entry:	the entry
+ *
+ * Returns 0 on success, 1 if the entry can't be replayed, or -1 with errno
+ * set in case of failure.
+ */
+static int replay_one(const struct replay_entry *entry)
+{
+	char buf[READ_SIZE];
+	struct stat st;
+	int fd, ret;
+
+	switch (entry->op) {
+	case REPLAY_INODE:
+		fd = open_ino(entry->id, O_PATH);
+		if (fd < 0)
+			return -1;
+		ret = fstat(fd, &st);
+		break;
+	case REPLAY_LOOKUP:
+		fd = open_ino(entry->id, O_PATH | O_DIRECTORY);
+		if (fd < 0)
+			return -1;
+		ret = fstatat(fd, entry->name, &st, AT_SYMLINK_NOFOLLOW);
+		break;
+	case REPLAY_XATTR:
+		fd = open_ino(entry->id, O_RDONLY | O_NONBLOCK);
+		if (fd < 0)
+			return -1;
+		ret = fgetxattr(fd, entry->name, buf, sizeof(buf));
+		if (ret < 0 && errno == ERANGE)
+			ret = 0;
+		break;
+	case REPLAY_READDIR:
+		fd = open_ino(entry->id, O_RDONLY | O_DIRECTORY);
+		if (fd < 0)
+			return -1;
+		ret = replay_readdir(fd);
+		break;
+	case REPLAY_EXTENT:
+	case REPLAY_READ:
+		fd = open_ino(entry->id, O_RDONLY);
+		if (fd < 0)
+			return -1;
+		ret = pread(fd, buf, sizeof(buf), entry->number);
+		break;
+	default:
+		return 1;
+	}
+	if (ret < 0) {
+		ret = errno;
+		close(fd);
+		errno = ret;
+		return -1;
+	}
+	close(fd);
+	return 0;
+}
+
+static void *replay_thread(void *arg)
+{
+	struct replay_thread *rt = arg;
+	unsigned long pass;
+	size_t i;
+	int ret;
+
+	for (pass = 0; pass < passes; ++pass) {
+		for (i = 0; i < nr_entries; ++i) {
+			ret = replay_one(&entries[i]);
+			if (ret > 0) {
+				rt->skipped++;
+			} else if (!ret) {
+				rt->found++;
+			} else if (errno == ENOENT || errno == ESTALE ||
+				   errno == ENODATA) {
+				rt->missing++;
+			} else {
+				rt->err = errno;
+				fprintf(stderr, "%s %#llx: %s\n",
+					replay_op_names[entries[i].op],
+					(unsigned long long)entries[i].id,
+					strerror(errno));
+				return NULL;
+			}
+		}
+	}
+	return NULL;
+}
+
+static void usage(const char *prog)
+{
+	fprintf(stderr,
+		"usage: %s [-j threads] [-n passes] <mount> <trace>\n"
+		"  -j  replay the trace in that many threads at once\n",
+		prog);
+	exit(2);
+}
+
+int main(int argc, char **argv)
+{
+	unsigned long found = 0, missing = 0, skipped = 0;
+	unsigned int nr_threads = 1, t;
+	struct replay_thread *threads;
+	uint64_t start, ns, ops;
+	int opt, err = 0;
+
+	while ((opt = getopt(argc, argv, "j:n:")) != -1) {
+		switch (opt) {
+		case 'j':
+			nr_threads = strtoul(optarg, NULL, 0);
+			break;
+		case 'n':
+			passes = strtoul(optarg, NULL, 0);
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+	if (optind != argc - 2 || !nr_threads)
+		usage(argv[0]);
+
+	mount_fd = open(argv[optind], O_RDONLY | O_DIRECTORY);
+	if (mount_fd < 0)
+		die(argv[optind]);
+	read_trace(argv[optind + 1]);
+
+	threads = calloc(nr_threads, sizeof(*threads));
+	if (!threads)
+		die("calloc");
+	start = now_ns();
+	for (t = 0; t < nr_threads; t++) {
+		errno = pthread_create(&threads[t].thread, NULL, replay_thread,
+				       &threads[t]);
+		if (errno)
+			die("pthread_create");
+	}
+	for (t = 0; t < nr_threads; t++)
+		pthread_join(threads[t].thread, NULL);
+	ns = now_ns() - start;
+
+	for (t = 0; t < nr_threads; t++) {
+		found += threads[t].found;
+		missing += threads[t].missing;
+		skipped += threads[t].skipped;
+		if (!err)
+			err = threads[t].err;
+	}
+	free(threads);
+	if (err)
+		return 1;
+
+	ops = (uint64_t)nr_entries * passes * nr_threads;
+	printf("{\"test\":\"replay\",\"threads\":%u,\"ops\":%llu,\"ns\":%llu,"
+	       "\"ns_per_op\":%.1f,\"found\":%lu,\"missing\":%lu,"
+	       "\"skipped\":%lu}\n",
+	       nr_threads, (unsigned long long)ops, (unsigned long long)ns,
+	       ops ? (double)ns / ops : 0.0, found, missing, skipped);
+	return 0;
+}
@@ -0,0 +1,428 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+ * Thread scaling benchmarks for a mounted apfs volume
+ *
+ * Walks the mount once to find its directories and files, and then runs each
+ * workload with 1, 2, 4... threads for a fixed time, in two flavours: every
+ * thread on the same object, or each thread on objects of its own.  Where the
+ * shared flavour stops scaling and the disjoint one doesn't, the bottleneck is
+ * a per-object lock or cacheline, like the i_extent_lock of an inode; where
+ * both stop, it's something global, like the kref of the root node.  Every
+ * result goes to stdout as a line of json, with the speedup over one thread.
+ *
+ * The workloads are:
+ *   - lookup_shared:    negative and positive lookups in one directory
+ *   - lookup_disjoint:  the same, with a directory for each thread
+ *   - stat_same:        stats of one file from every thread
+ *   - stat_different:   stats of a different file for each op
+ *   - read_shared:      random 4k reads of one file from every thread
+ *   - read_many:        the same, with a file for each thread
+ */
+#define _GNU_SOURCE
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <ftw.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#define READ_SIZE		4096
+#define MIN_READ_FILE_SIZE	(64 * READ_SIZE)
+#define MAX_DIR_NAMES		4096
+
+struct dir_info {
+	char *path;
+	int fd;
+	char **names;
+	size_t nr;
+};
+
+struct list {
+	void *items;
+	size_t nr;
+	size_t alloc;
+	size_t size;		/* Size of each item */
+};
+
+enum workload {
+	LOOKUP_SHARED,
+	LOOKUP_DISJOINT,
+	STAT_SAME,
+	STAT_DIFFERENT,
+	READ_SHARED,
+	READ_MANY,
+	NR_WORKLOADS,
+};
+
+static const char * const workload_names[NR_WORKLOADS] = {
+	[LOOKUP_SHARED]		= "lookup_shared",
+	[LOOKUP_DISJOINT]	= "lookup_disjoint",
+	[STAT_SAME]		= "stat_same",
+	[STAT_DIFFERENT]	= "stat_different",
+	[READ_SHARED]		= "read_shared",
+	[READ_MANY]		= "read_many",
+};
+
+struct file_info {
+	char *path;
+	off_t size;
+	int fd;
+};
+
+struct worker {
+	pthread_t tid;
+	enum workload load;
+	unsigned int id;
+	unsigned int seed;
+	uint64_t ops;
+	char pad[64];		/* Keep the counters of the threads apart */
+};
+
+static struct list dirs = { .size = sizeof(struct dir_info) };
+static struct list files = { .size = sizeof(struct file_info) };
+static struct list big = { .size = sizeof(struct file_info *) };
+static size_t max_paths = 100000;
+static bool drop_caches;
+
+static pthread_barrier_t start_barrier;
+static volatile bool stop;
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void die(const char *msg)
+{
+	perror(msg);
+	exit(1);
+}
+
+static void report(enum workload load, unsigned int threads, uint64_t ops,
+		   uint64_t ns, double base)
+{
+	double rate = ns ? ops * 1e9 / ns : 0.0;
+
+	printf("{\"test\":\"%s\",\"threads\":%u,\"ops\":%llu,\"ns\":%llu,"
+	       "\"ops_per_s\":%.0f,\"speedup\":%.2f,\"efficiency\":%.2f}\n",
+	       workload_names[load], threads, (unsigned long long)ops,
+	       (unsigned long long)ns, rate, base ? rate / base : 0.0,
+	       base ? rate / base / threads : 0.0);
+	fflush(stdout);
+}
+
+static void cold_caches(void)
+{
+	int fd;
+
+	if (!drop_caches)
+		return;
+	sync();
+	fd = open("/proc/sys/vm/drop_caches", O_WRONLY);
+	if (fd < 0 || write(fd, "3", 1) != 1)
+		die("drop_caches");
+	close(fd);
+}
+
+static void *list_add(struct list *list)
+{
+	if (list->nr == list->alloc) {
+		list->alloc = list->alloc ? list->alloc * 2 : 256;
+		list->items = realloc(list->items, list->alloc * list->size);
+		if (!list->items)
+			die("realloc");
+	}
+	return (char *)list->items + list->nr++ * list->size;
+}
+
+static void *list_get(struct list *list, size_t idx)
+{
+	return (char *)list->items + idx * list->size;
+}
+
+static int walk_one(const char *path, const struct stat *st, int type,
+		    struct FTW *ftw)
+{
+	if (type == FTW_D) {
+		struct dir_info *dir = list_add(&dirs);
+
+		memset(dir, 0, sizeof(*dir));
+		dir->path = strdup(path);
+		if (!dir->path)
+			die("strdup");
+	} else if (type == FTW_F && S_ISREG(st->st_mode)) {
+		struct file_info *file = list_add(&files);
+
+		file->path = strdup(path);
+		if (!file->path)
+			die("strdup");
+		file->size = st->st_size;
+		file->fd = -1;
+	}
+	return files.nr + dirs.nr >= max_paths;
+}
+
+/* Remember some names of each directory, and keep the ones with entries */
+static void load_dirs(void)
+{
+	struct dir_info *dir;
+	struct dirent *de;
+	size_t i, nr = 0;
+	DIR *d;
+
+	for (i = 0; i < dirs.nr; ++i) {
+		dir = list_get(&dirs, i);
+		dir->fd = open(dir->path, O_RDONLY | O_DIRECTORY);
+		if (dir->fd < 0)
+			die(dir->path);
+		d = fdopendir(dup(dir->fd));
+		if (!d)
+			die("fdopendir");
+		dir->names = calloc(MAX_DIR_NAMES, sizeof(*dir->names));
+		if (!dir->names)
+			die("calloc");
+		while (dir->nr < MAX_DIR_NAMES && (de = readdir(d))) {
+			if (!strcmp(de->d_name, ".") ||
+			    !strcmp(de->d_name, ".."))
+				continue;
+			dir->names[dir->nr] = strdup(de->d_name);
+			if (!dir->names[dir->nr++])
+				die("strdup");
+		}
+		closedir(d);
+
+		if (!dir->nr) {
+			close(dir->fd);
+			free(dir->names);
+			free(dir->path);
+			continue;
+		}
+		memmove(list_get(&dirs, nr++), dir, sizeof(*dir));
+	}
+	dirs.nr = nr;
+}
+
+static void load_files(void)
+{
+	struct file_info *file;
+	size_t i;
+
+	for (i = 0; i < files.nr; ++i) {
+		file = list_get(&files, i);
+		if (file->size < MIN_READ_FILE_SIZE)
+			continue;
+		file->fd = open(file->path, O_RDONLY);
+		if (file->fd < 0)
+			die(file->path);
+		*(struct file_info **)list_add(&big) = file;
+	}
+}
+
+static void lookup_op(struct worker *w, struct dir_info *dir)
+{
+	char name[NAME_MAX + 1];
+	size_t idx = rand_r(&w->seed) % dir->nr;
+	struct stat st;
+
+	/* Half of the lookups miss, to get the negative dentries in too */
+	if (rand_r(&w->seed) & 1) {
+		snprintf(name, sizeof(name), "%.200s.missing.%u",
+			 dir->names[idx], w->id);
+		if (!fstatat(dir->fd, name, &st, AT_SYMLINK_NOFOLLOW) ||
+		    errno != ENOENT)
+			die("lookup of missing file");
+	} else if (fstatat(dir->fd, dir->names[idx], &st,
+			   AT_SYMLINK_NOFOLLOW)) {
+		die("fstatat");
+	}
+}
+
+static void read_op(struct worker *w, struct file_info *file)
+{
+	char buf[READ_SIZE];
+	off_t off = (rand_r(&w->seed) % (file->size / READ_SIZE)) * READ_SIZE;
+
+	if (pread(file->fd, buf, sizeof(buf), off) < 0)
+		die("pread");
+}
+
+static void *worker_thread(void *data)
+{
+	struct worker *w = data;
+	struct file_info *file;
+	struct stat st;
+
+	pthread_barrier_wait(&start_barrier);
+	while (!stop) {
+		switch (w->load) {
+		case LOOKUP_SHARED:
+			lookup_op(w, list_get(&dirs, 0));
+			break;
+		case LOOKUP_DISJOINT:
+			lookup_op(w, list_get(&dirs, w->id % dirs.nr));
+			break;
+		case STAT_SAME:
+			file = list_get(&files, 0);
+			if (lstat(file->path, &st))
+				die("lstat");
+			break;
+		case STAT_DIFFERENT:
+			file = list_get(&files, rand_r(&w->seed) % files.nr);
+			if (lstat(file->path, &st))
+				die("lstat");
+			break;
+		case READ_SHARED:
+			read_op(w, *(struct file_info **)list_get(&big, 0));
+			break;
+		case READ_MANY:
+			read_op(w, *(struct file_info **)list_get(&big,
+							w->id % big.nr));
+			break;
+		default:
+			break;
+		}
+		w->ops++;
+	}
+	return NULL;
+}
+
+/* Returns the rate in ops per second */
+static double run(enum workload load, unsigned int threads,
+		  unsigned int msecs, double base)
+{
+	struct timespec ts = {
+		.tv_sec = msecs / 1000,
+		.tv_nsec = (msecs % 1000) * 1000000L,
+	};
+	struct worker *workers;
+	uint64_t start, ns, ops = 0;
+	unsigned int i;
+	double rate;
+
+	workers = calloc(threads, sizeof(*workers));
+	if (!workers)
+		die("calloc");
+	if (pthread_barrier_init(&start_barrier, NULL, threads + 1))
+		die("pthread_barrier_init");
+
+	cold_caches();
+	stop = false;
+	for (i = 0; i < threads; ++i) {
+		workers[i].load = load;
+		workers[i].id = i;
+		workers[i].seed = i + 1;
+		if (pthread_create(&workers[i].tid, NULL, worker_thread,
+				   &workers[i]))
+			die("pthread_create");
+	}
+	pthread_barrier_wait(&start_barrier);
+	start = now_ns();
+	nanosleep(&ts, NULL);
+	stop = true;
+	for (i = 0; i < threads; ++i) {
+		pthread_join(workers[i].tid, NULL);
+		ops += workers[i].ops;
+	}
+	ns = now_ns() - start;
+	rate = ns ? ops * 1e9 / ns : 0.0;
+
+	/* The first run, with one thread, is the base of the speedups */
+	report(load, threads, ops, ns, base ? base : rate);
+	pthread_barrier_destroy(&start_barrier);
+	free(workers);
+	return rate;
+}
+
+static bool workload_ready(enum workload load)
+{
+	switch (load) {
+	case LOOKUP_SHARED:
+	case LOOKUP_DISJOINT:
+		return dirs.nr;
+	case STAT_SAME:
+	case STAT_DIFFERENT:
+		return files.nr;
+	case READ_SHARED:
+	case READ_MANY:
+		return big.nr;
+	default:
+		return false;
+	}
+}
+
+static void usage(const char *prog)
+{
+	fprintf(stderr, "usage: %s [-d] [-n max_paths] [-s msecs] "
+		"[-t max_threads] [-w workload] <mount>\n"
+		"  -d  drop the caches before each run\n"
+		"  -s  duration of each run\n"
+		"  -t  highest thread count, doubled from 1\n"
+		"  -w  run only this workload\n", prog);
+	exit(2);
+}
+
+int main(int argc, char **argv)
+{
+	unsigned int max_threads = sysconf(_SC_NPROCESSORS_ONLN);
+	unsigned int msecs = 2000, threads;
+	const char *only = NULL;
+	enum workload load;
+	double base;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "dn:s:t:w:")) != -1) {
+		switch (opt) {
+		case 'd':
+			drop_caches = true;
+			break;
+		case 'n':
+			max_paths = strtoul(optarg, NULL, 0);
+			break;
+		case 's':
+			msecs = strtoul(optarg, NULL, 0);
+			break;
+		case 't':
+			max_threads = strtoul(optarg, NULL, 0);
+			break;
+		case 'w':
+			only = optarg;
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+	if (optind != argc - 1)
+		usage(argv[0]);
+	if (!max_threads)
+		max_threads = 1;
+
+	if (nftw(argv[optind], walk_one, 64, FTW_PHYS) < 0)
+		die("nftw");
+	load_dirs();
+	load_files();
+
+	for (load = 0; load < NR_WORKLOADS; ++load) {
+		if (only && strcmp(only, workload_names[load]))
+			continue;
+		if (!workload_ready(load)) {
+			fprintf(stderr, "%s: nothing to test on\n",
+				workload_names[load]);
+			continue;
+		}
+		base = run(load, 1, msecs, 0.0);
+		for (threads = 2; threads <= max_threads; threads *= 2)
+			run(load, threads, msecs, base);
+	}
+	return 0;
+}
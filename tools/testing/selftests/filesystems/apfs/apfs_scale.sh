@@ -0,0 +1,113 @@
+#!/bin/bash
+# SPDX-License-Identifier: GPL-2.0
+#
+# Mount each apfs image in $APFS_IMAGES and run apfs_scale on it, to find the
+# thread count where lookups, stats and reads stop scaling.  Every result is
+# printed as a line of json, tagged with the image name.
+#
+# A flat curve only says that something is contended, not what.  On a kernel
+# with CONFIG_LOCK_STAT, the lock statistics are collected over each image
+# and the apfs locks with the most contentions are kept in
+# $APFS_SCALE_OUT/<image>.lockstat; with $APFS_SCALE_C2C set and perf around,
+# the run is also recorded with "perf c2c", for the cachelines bouncing
+# between the cpus with no lock at all, like the root node kref.  The hints
+# for reading both go to stderr at the end.
+
+# Kselftest framework requirement - SKIP code is 4.
+ksft_skip=4
+
+# The results go through sed, but a failed benchmark must still be seen
+set -o pipefail
+
+BENCH_OPTS=${APFS_SCALE_OPTS:-}
+OUT=${APFS_SCALE_OUT:-.}
+LOCKS=${APFS_SCALE_LOCKS:-20}
+lock_stat=/proc/lock_stat
+
+if [ "$(id -u)" -ne 0 ]; then
+	echo "SKIP: must be run as root"
+	exit $ksft_skip
+fi
+if [ -z "$APFS_IMAGES" ]; then
+	echo "SKIP: no images given in APFS_IMAGES"
+	exit $ksft_skip
+fi
+modprobe apfs 2>/dev/null
+if ! grep -qw apfs /proc/filesystems; then
+	echo "SKIP: apfs is not available"
+	exit $ksft_skip
+fi
+
+images=()
+for arg in $APFS_IMAGES; do
+	if [ -d "$arg" ]; then
+		images+=("$arg"/*.img)
+	else
+		images+=("$arg")
+	fi
+done
+
+c2c=
+if [ -n "$APFS_SCALE_C2C" ] && command -v perf >/dev/null; then
+	c2c=1
+fi
+
+mnt=$(mktemp -d)
+trap 'umount "$mnt" 2>/dev/null; rmdir "$mnt"' EXIT
+
+# Keep the header of the lock statistics, and the apfs locks from the top
+save_lockstat() {
+	{
+		head -n 4 $lock_stat
+		grep -E '^ *[^ -].*: +[0-9]' $lock_stat |
+		grep -E 'apfs|i_extent|s_node|cache' | head -n "$LOCKS"
+	} > "$1"
+}
+
+rc=0
+for img in "${images[@]}"; do
+	name=$(basename "$img")
+
+	if ! mount -t apfs -o ro,loop "$img" "$mnt"; then
+		echo "FAIL: unable to mount $img" >&2
+		rc=1
+		continue
+	fi
+
+	if [ -w $lock_stat ]; then
+		echo 0 > $lock_stat
+		echo 1 > /proc/sys/kernel/lock_stat
+	fi
+
+	cmd=(./apfs_scale $BENCH_OPTS "$mnt")
+	if [ -n "$c2c" ]; then
+		cmd=(perf c2c record -a -o "$OUT/$name.c2c.data" -- "${cmd[@]}")
+	fi
+	if ! "${cmd[@]}" | sed "s/^{/{\"image\":\"$name\",/"; then
+		echo "FAIL: benchmark failed on $img" >&2
+		rc=1
+	fi
+
+	if [ -w $lock_stat ]; then
+		echo 0 > /proc/sys/kernel/lock_stat
+		save_lockstat "$OUT/$name.lockstat"
+	fi
+	umount "$mnt"
+done
+
+if [ -w $lock_stat ]; then
+	echo "lock statistics in $OUT/*.lockstat: look at the contentions" \
+	     "and waittime-total of apfs locks like i_extent_lock" >&2
+else
+	echo "no lock statistics: build the kernel with CONFIG_LOCK_STAT" \
+	     "to see the contended apfs locks" >&2
+fi
+if [ -n "$c2c" ]; then
+	echo "cacheline contention in $OUT/*.c2c.data: run" \
+	     "\"perf c2c report -i <file> --stdio\" and look for HITM" \
+	     "on apfs symbols, like the kref of the nodes" >&2
+else
+	echo "for the contended cachelines, set APFS_SCALE_C2C and run" \
+	     "again with perf installed" >&2
+fi
+exit $rc